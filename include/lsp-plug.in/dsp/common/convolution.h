@@ -34,4 +34,48 @@
  */
 LSP_DSP_LIB_SYMBOL(void, convolve, float *dst, const float *src, const float *conv, size_t length, size_t count);
 
+/**
+ * Get the size of the problem starting from which the FFT convolution is faster
+ * than the direct convolution on the current CPU. The value is calibrated by the
+ * dsp.fft.convolve_fft performance test.
+ * @return minimum value of the length of convolution and the number of samples
+ *         in source signal starting from which the FFT convolution should be used
+ */
+LSP_DSP_LIB_SYMBOL(size_t, convolve_fft_threshold, void);
+
+/**
+ * Get the size of the buffer required by the FFT convolution
+ * @param length length of convolution
+ * @param count the number of samples in source signal to process
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, convolve_fft_size, size_t length, size_t count);
+
+/**
+ * Calculate convolution of source signal and convolution using fast convolution
+ * functions and add to destination buffer, the result is the same as for convolve()
+ * @param dst destination buffer to add result of convolution
+ * @param src source signal
+ * @param conv convolution
+ * @param length length of convolution
+ * @param count the number of samples in source signal to process
+ * @param buf temporary buffer of at least convolve_fft_size(length, count) bytes,
+ *        does not require any alignment
+ */
+LSP_DSP_LIB_SYMBOL(void, convolve_fft, float *dst, const float *src, const float *conv, size_t length, size_t count, void *buf);
+
+/**
+ * Calculate convolution of source signal and convolution and add to destination buffer,
+ * select direct or FFT convolution depending on the size of the problem and the
+ * value returned by convolve_fft_threshold()
+ * @param dst destination buffer to add result of convolution
+ * @param src source signal
+ * @param conv convolution
+ * @param length length of convolution
+ * @param count the number of samples in source signal to process
+ * @param buf temporary buffer of at least convolve_fft_size(length, count) bytes,
+ *        does not require any alignment, NULL forces the direct convolution
+ */
+LSP_DSP_LIB_SYMBOL(void, convolve_auto, float *dst, const float *src, const float *conv, size_t length, size_t count, void *buf);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_CONVOLUTION_H_ */
@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_CONVOLVER_H_
+#define LSP_PLUG_IN_DSP_COMMON_CONVOLVER_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+#pragma pack(push, 1)
+
+/**
+ * Uniformly partitioned convolver: the object that splits the impulse response
+ * into partitions of 2^(rank-1) samples and keeps the fast convolution data of
+ * each partition. The input stream is split into blocks of the same size, the
+ * fast convolution data of the recent blocks is kept in the frequency-domain
+ * delay line, so each block of input data costs only one direct and one reverse
+ * transform plus complex multiply-add for each partition.
+ * The output is delayed by 2^(rank-1) samples.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of convolver_size(rank, length) bytes to the convolver_init() function and keep
+ * it until the object is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(convolver_t)
+{
+    float      *spectrum;   // Fast convolution data of impulse response partitions, partitions * 2^(rank+1) samples
+    float      *fdl;        // Frequency-domain delay line of input blocks, partitions * 2^(rank+1) samples
+    float      *acc;        // Accumulated fast convolution data, 2^(rank+1) samples
+    float      *input;      // Input block, 2^(rank-1) samples
+    float      *output;     // Overlap-add buffer, 2^rank samples
+    float      *tmp;        // Restored convolution of the block, 2^rank samples
+    size_t      rank;       // Rank of fast convolution
+    size_t      partitions; // Number of impulse response partitions
+    size_t      head;       // Position of the most recent input block in the delay line
+    size_t      offset;     // Number of samples in the input block
+} LSP_DSP_LIB_TYPE(convolver_t);
+
+/**
+ * Matrix convolver: the uniformly partitioned convolver of N inputs and M outputs
+ * where each output is the sum of inputs convolved with the dedicated impulse
+ * response. The fast convolution data of each input block is computed once and
+ * shared between all outputs, so each block of input data costs one direct
+ * transform per input, one reverse transform per output and complex multiply-add
+ * for each partition of each impulse response.
+ * The output is delayed by 2^(rank-1) samples.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of mconvolver_size(rank, length, inputs, outputs) bytes to the mconvolver_init()
+ * function and keep it until the object is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(mconvolver_t)
+{
+    float      *spectrum;   // Fast convolution data of impulse responses, outputs * inputs * partitions * 2^(rank+1) samples
+    float      *fdl;        // Frequency-domain delay lines of inputs, inputs * partitions * 2^(rank+1) samples
+    float      *acc;        // Accumulated fast convolution data, 2^(rank+1) samples
+    float      *input;      // Input blocks, inputs * 2^(rank-1) samples
+    float      *output;     // Overlap-add buffers, outputs * 2^rank samples
+    float      *tmp;        // Restored convolution of the block, 2^rank samples
+    size_t      rank;       // Rank of fast convolution
+    size_t      partitions; // Number of impulse response partitions
+    size_t      inputs;     // Number of inputs
+    size_t      outputs;    // Number of outputs
+    size_t      head;       // Position of the most recent input block in the delay line
+    size_t      offset;     // Number of samples in the input block
+} LSP_DSP_LIB_TYPE(mconvolver_t);
+
+#pragma pack(pop)
+
+/**
+ * Stage of the non-uniformly partitioned convolver: the set of impulse response
+ * partitions of the same size processed by fast convolution. The work on each block
+ * of input data consists of partitions + 2 tasks performed in order: direct transform,
+ * multiply-add of each partition and reverse transform.
+ *
+ * The background stage publishes the work as the job which tasks are claimed one by one
+ * by the thread that holds the lock, the lock is never waited for. The stage keeps two sets
+ * of working data, so if the worker still performs the task when the result is required,
+ * the real-time thread performs the whole work with another set of data instead of waiting.
+ */
+typedef struct LSP_DSP_LIB_TYPE(nu_convolver_stage_t)
+{
+    float      *spectrum;   // Fast convolution data of impulse response partitions, partitions * 2^(rank+1) samples
+    float      *data[2];    // Sets of working data: frequency-domain delay line of input blocks (partitions * 2^(rank+1) samples),
+                            // accumulated fast convolution data (2^(rank+1) samples) and restored convolution (2^rank samples)
+    size_t      rank;       // Rank of fast convolution
+    size_t      partitions; // Number of impulse response partitions
+    size_t      offset;     // Offset of the first partition in the impulse response
+    size_t      head;       // Position of the most recent input block in the delay line
+    size_t      block;      // Position of the most recent input block in the input buffer
+    size_t      set;        // Index of the set of working data used by the real-time thread
+    size_t      state;      // State of the handoff, owned by the real-time thread
+    size_t      job_head;   // Position of the input block of the job in the delay line
+    size_t      job_block;  // Position of the input block of the job in the input buffer
+    size_t      job_set;    // Index of the set of working data of the job
+    uint32_t    lock;       // Lock of the job, non-zero if the job is owned by some thread
+    uint32_t    tasks;      // Number of tasks of the job, zero if there is no job
+    uint32_t    done;       // Number of performed tasks of the job
+} LSP_DSP_LIB_TYPE(nu_convolver_stage_t);
+
+/**
+ * Non-uniformly partitioned convolver: the object that computes convolution
+ * without latency. The first 2^(rank-1) samples of the impulse response are applied
+ * by the direct convolution, the rest of the impulse response is split into stages
+ * of fast convolution partitions which size doubles every two partitions until
+ * it reaches 2^(max_rank-1) samples. The work of each stage is split into
+ * steps (direct transform, multiply-add of each partition, reverse transform)
+ * which are evenly distributed between blocks of 2^(rank-1) samples, so large
+ * partitions do not cause spikes of CPU load.
+ *
+ * Alternatively, stages of large partitions can be processed in background, see
+ * nu_convolver_set_background(). The library does not start any threads: the host
+ * calls nu_convolver_background() by its own worker threads, the notification
+ * callback set by nu_convolver_set_notify() tells the host when the new work is
+ * handed off. Each block of input data of the background stage of 2^(r-1) samples
+ * is handed off at the end of the block, and the result is collected 2^(r-1) samples
+ * later, at the time when it becomes required for the output. The real-time thread
+ * performs tasks which have not been claimed by workers according to the same schedule
+ * as for other stages, and never waits for workers.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of nu_convolver_size(rank, max_rank, length) bytes to the nu_convolver_init()
+ * function and keep it until the object is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(nu_convolver_t)
+{
+    LSP_DSP_LIB_TYPE(nu_convolver_stage_t) *stages; // Fast convolution stages
+    float      *direct;     // Head of impulse response for direct convolution, 2^(rank-1) samples
+    float      *dout;       // Output of direct convolution, 2^rank samples
+    float      *input;      // Input ring buffer
+    float      *output;     // Output ring buffer
+    void      (*notify)(void *arg); // Callback called by the real-time thread when the work is handed off, may be NULL
+    void       *notify_arg; // Argument of the notification callback
+    size_t      rank;       // Rank of the minimum partition
+    size_t      length;     // Length of direct convolution
+    size_t      nstages;    // Number of fast convolution stages
+    size_t      background; // Index of the first stage processed in background
+    size_t      mask;       // Size of ring buffers minus one
+    size_t      position;   // Current position in ring buffers
+} LSP_DSP_LIB_TYPE(nu_convolver_t);
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/** Get the size of the buffer required by the convolver
+ *
+ * @param rank the rank of fast convolution, should be at least 3
+ * @param length length of the impulse response in samples
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, convolver_size, size_t rank, size_t length);
+
+/** Initialize the convolver with the impulse response and clear the state
+ *
+ * @param conv the convolver to initialize
+ * @param buf buffer of at least convolver_size(rank, length) bytes, does not require any alignment
+ * @param ir impulse response
+ * @param length length of the impulse response in samples
+ * @param rank the rank of fast convolution, should be at least 3
+ */
+LSP_DSP_LIB_SYMBOL(void, convolver_init, LSP_DSP_LIB_TYPE(convolver_t) *conv, void *buf, const float *ir, size_t length, size_t rank);
+
+/** Clear the state of the convolver
+ *
+ * @param conv the convolver
+ */
+LSP_DSP_LIB_SYMBOL(void, convolver_reset, LSP_DSP_LIB_TYPE(convolver_t) *conv);
+
+/** Process the block of samples of any size
+ *
+ * @param conv the convolver
+ * @param dst destination buffer, can be the same as source buffer
+ * @param src source buffer
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, convolver_process, LSP_DSP_LIB_TYPE(convolver_t) *conv, float *dst, const float *src, size_t count);
+
+/** Get the size of the buffer required by the matrix convolver
+ *
+ * @param rank the rank of fast convolution, should be at least 3
+ * @param length maximum length of impulse responses in samples
+ * @param inputs number of inputs
+ * @param outputs number of outputs
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, mconvolver_size, size_t rank, size_t length, size_t inputs, size_t outputs);
+
+/** Initialize the matrix convolver with impulse responses and clear the state
+ *
+ * @param conv the convolver to initialize
+ * @param buf buffer of at least mconvolver_size(rank, length, inputs, outputs) bytes, does not require any alignment
+ * @param ir matrix of inputs * outputs impulse responses, the impulse response
+ *        from input i to output o is ir[i * outputs + o], NULL means no connection
+ * @param length length of each impulse response in samples
+ * @param rank the rank of fast convolution, should be at least 3
+ * @param inputs number of inputs
+ * @param outputs number of outputs
+ */
+LSP_DSP_LIB_SYMBOL(void, mconvolver_init, LSP_DSP_LIB_TYPE(mconvolver_t) *conv, void *buf,
+    const float * const *ir, size_t length, size_t rank, size_t inputs, size_t outputs);
+
+/** Clear the state of the matrix convolver
+ *
+ * @param conv the convolver
+ */
+LSP_DSP_LIB_SYMBOL(void, mconvolver_reset, LSP_DSP_LIB_TYPE(mconvolver_t) *conv);
+
+/** Process the block of samples of any size for all inputs and outputs
+ *
+ * @param conv the convolver
+ * @param dst list of outputs buffers, buffers can be the same as input buffers
+ * @param src list of input buffers
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, mconvolver_process, LSP_DSP_LIB_TYPE(mconvolver_t) *conv,
+    float * const *dst, const float * const *src, size_t count);
+
+/** Get the size of the buffer required by the non-uniformly partitioned convolver
+ *
+ * @param rank the rank of the minimum partition, should be at least 3
+ * @param max_rank the rank of the maximum partition, should not be less than rank
+ * @param length length of the impulse response in samples
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, nu_convolver_size, size_t rank, size_t max_rank, size_t length);
+
+/** Initialize the non-uniformly partitioned convolver with the impulse response and clear the state
+ *
+ * @param conv the convolver to initialize
+ * @param buf buffer of at least nu_convolver_size(rank, max_rank, length) bytes, does not require any alignment
+ * @param ir impulse response
+ * @param length length of the impulse response in samples
+ * @param rank the rank of the minimum partition, should be at least 3
+ * @param max_rank the rank of the maximum partition, should not be less than rank
+ */
+LSP_DSP_LIB_SYMBOL(void, nu_convolver_init, LSP_DSP_LIB_TYPE(nu_convolver_t) *conv, void *buf,
+    const float *ir, size_t length, size_t rank, size_t max_rank);
+
+/** Clear the state of the non-uniformly partitioned convolver, does not wait for
+ * host threads which perform the background work at the moment
+ *
+ * @param conv the convolver
+ */
+LSP_DSP_LIB_SYMBOL(void, nu_convolver_reset, LSP_DSP_LIB_TYPE(nu_convolver_t) *conv);
+
+/** Process the block of samples of any size without latency
+ *
+ * @param conv the convolver
+ * @param dst destination buffer, can be the same as source buffer
+ * @param src source buffer
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, nu_convolver_process, LSP_DSP_LIB_TYPE(nu_convolver_t) *conv, float *dst, const float *src, size_t count);
+
+/** Process stages with partitions of rank not less than the specified rank in background,
+ * should be called after nu_convolver_init() or nu_convolver_reset() and before any processing.
+ * After that the nu_convolver_background() function should be called by the worker thread
+ * of the host after each handoff of the work, tasks that are not performed by workers in
+ * time are performed by nu_convolver_process() itself.
+ *
+ * @param conv the convolver
+ * @param rank minimum rank of partitions processed in background, the value above
+ *        the maximum rank of partitions disables background processing
+ */
+LSP_DSP_LIB_SYMBOL(void, nu_convolver_set_background, LSP_DSP_LIB_TYPE(nu_convolver_t) *conv, size_t rank);
+
+/** Perform the pending background work of the convolver, does not block and
+ * can be called simultaneously by several threads
+ *
+ * @param conv the convolver
+ * @return number of performed tasks
+ */
+LSP_DSP_LIB_SYMBOL(size_t, nu_convolver_background, LSP_DSP_LIB_TYPE(nu_convolver_t) *conv);
+
+/** Set the callback which is called by nu_convolver_process() each time the new background
+ * work is handed off, usually the callback wakes up worker threads of the host which call
+ * nu_convolver_background(). The callback is called by the real-time thread, so it should
+ * not block, for example it can post the semaphore. Should not be called during processing.
+ *
+ * @param conv the convolver
+ * @param notify the callback, NULL disables notifications
+ * @param arg argument passed to the callback
+ */
+LSP_DSP_LIB_SYMBOL(void, nu_convolver_set_notify, LSP_DSP_LIB_TYPE(nu_convolver_t) *conv,
+    void (*notify)(void *arg), void *arg);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_CONVOLVER_H_ */
@@ -46,6 +46,21 @@ typedef struct LSP_DSP_LIB_TYPE(correlation_t)
     float   b;      // the aggregated value of sum(b*b)
 } LSP_DSP_LIB_TYPE(correlation_t);
 
+/**
+ * Object to store the state of correlation between the signal a and the signal b
+ * shifted by each lag in range of 0 to lags-1. The correlation for each lag is computed
+ * using the same formula as for correlation_t, where the sample a[i] is paired with the
+ * sample b[i + lag]. Since the sum(a[i]*a[i]) is the same for all lags, it is stored once.
+ * The arrays of aggregated values are allocated by the caller.
+ */
+typedef struct LSP_DSP_LIB_TYPE(lag_correlation_t)
+{
+    float      *v;      // the aggregated values of sum(a*b) for each lag, lags elements
+    float      *b;      // the aggregated values of sum(b*b) for each lag, lags elements
+    float       a;      // the aggregated value of sum(a*a)
+    size_t      lags;   // number of lags
+} LSP_DSP_LIB_TYPE(lag_correlation_t);
+
 #pragma pack(pop)
 
 LSP_DSP_LIB_END_NAMESPACE
@@ -84,4 +99,107 @@ LSP_DSP_LIB_SYMBOL(void, corr_incr,
     const float *a_tail, const float *b_tail,
     size_t count);
 
+/**
+ * Compute the initial intermediate values of correlation between the signal a and the
+ * signal b for each lag, the function can be called multiple times, so aggregated values
+ * of the corr structure should be cleared before first call.
+ *
+ * @param corr the object to initialize with intermediate results
+ * @param a the pointer to the first signal buffer, count samples
+ * @param b the pointer to the second signal buffer, count + lags - 1 samples
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, corr_lags_init,
+    LSP_DSP_LIB_TYPE(lag_correlation_t) *corr,
+    const float *a, const float *b,
+    size_t count);
+
+/**
+ * Compute incremental value of normalized correlation between the signal a and the
+ * signal b for each lag. All lags are updated in one pass over the block of samples,
+ * and the normalized correlation of each lag at the end of the block is stored.
+ *
+ * @param corr the object that holds intermediate results
+ * @param dst destination buffer to store lags values of normalized correlation
+ * @param a_head the pointer to the head of the first signal buffer, count samples
+ * @param b_head the pointer to the head of the second signal buffer, count + lags - 1 samples
+ * @param a_tail the pointer to the tail of the first signal buffer, count samples
+ * @param b_tail the pointer to the tail of the second signal buffer, count + lags - 1 samples
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, corr_lags_incr,
+    LSP_DSP_LIB_TYPE(lag_correlation_t) *corr,
+    float *dst,
+    const float *a_head, const float *b_head,
+    const float *a_tail, const float *b_tail,
+    size_t count);
+
+/**
+ * Get the size of the buffer required by the xcorr() function
+ *
+ * @param a_count number of samples in the first signal
+ * @param b_count number of samples in the second signal
+ * @param min_lag minimum lag
+ * @param max_lag maximum lag
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, xcorr_size, size_t a_count, size_t b_count, ssize_t min_lag, ssize_t max_lag);
+
+/**
+ * Compute normalized cross-correlation between two signals for the range of lags
+ * using FFT. The correlation for the lag k is computed using the following formula:
+ *
+ *              sum(a[i+k] * b[i])
+ * r[k] = ---------------------------------
+ *         sqrt(sum(a*a) * sum(b*b))
+ *
+ * so the positive lag means that the first signal is delayed relative to the second one.
+ * The lags out of range -(b_count-1) to a_count-1 have zero correlation.
+ *
+ * @param dst destination buffer to store max_lag - min_lag + 1 values of correlation
+ *        for lags from min_lag to max_lag
+ * @param a the first signal
+ * @param a_count number of samples in the first signal
+ * @param b the second signal
+ * @param b_count number of samples in the second signal
+ * @param min_lag minimum lag
+ * @param max_lag maximum lag, should not be less than minimum lag
+ * @param buf temporary buffer of at least xcorr_size(a_count, b_count, min_lag, max_lag) bytes,
+ *        does not require any alignment
+ * @return the lag of the maximum correlation refined by the parabolic interpolation
+ */
+LSP_DSP_LIB_SYMBOL(float, xcorr, float *dst,
+    const float *a, size_t a_count,
+    const float *b, size_t b_count,
+    ssize_t min_lag, ssize_t max_lag,
+    void *buf);
+
+/**
+ * Get the size of the buffer required by the autocorr() function
+ *
+ * @param count number of samples in the signal
+ * @param max_lag maximum lag
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, autocorr_size, size_t count, size_t max_lag);
+
+/**
+ * Compute normalized autocorrelation of the signal for the range of lags using FFT,
+ * the value for the zero lag is 1. The lags not less than count have zero correlation.
+ *
+ * @param dst destination buffer to store max_lag - min_lag + 1 values of correlation
+ *        for lags from min_lag to max_lag
+ * @param src the signal
+ * @param count number of samples in the signal
+ * @param min_lag minimum lag
+ * @param max_lag maximum lag, should not be less than minimum lag
+ * @param buf temporary buffer of at least autocorr_size(count, max_lag) bytes,
+ *        does not require any alignment
+ * @return the lag of the maximum correlation refined by the parabolic interpolation
+ */
+LSP_DSP_LIB_SYMBOL(float, autocorr, float *dst,
+    const float *src, size_t count,
+    size_t min_lag, size_t max_lag,
+    void *buf);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_CORRELATION_H_ */
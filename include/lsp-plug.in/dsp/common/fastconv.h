@@ -64,4 +64,15 @@ LSP_DSP_LIB_SYMBOL(void, fastconv_restore, float *dst, float *src, size_t rank);
  */
 LSP_DSP_LIB_SYMBOL(void, fastconv_apply, float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
 
+/** Multiply two fast convolution data and add the result to the fast convolution data,
+ * the function allows to accumulate the spectrum of several convolutions before
+ * restoring it to the real data with the single call of fastconv_restore
+ *
+ * @param dst fast convolution data of 2^(rank+1) floats to add the product to
+ * @param c1 fast convolution data of 2^(rank+1) floats
+ * @param c2 fast convolution data of 2^(rank+1) floats
+ * @param rank the convolution rank
+ */
+LSP_DSP_LIB_SYMBOL(void, fastconv_fmadd, float *dst, const float *c1, const float *c2, size_t rank);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_FASTCONV_H_ */
@@ -24,6 +24,76 @@
 
 #include <lsp-plug.in/dsp/common/types.h>
 
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+#pragma pack(push, 1)
+
+/**
+ * FFT plan: the object that holds twiddle factors computed at runtime for
+ * the FFT of the specific rank. Unlike the direct_fft and reverse_fft functions
+ * that use precomputed tables, the plan is not limited by the rank of FFT
+ * and does not accumulate the error of the twiddle factor rotation.
+ *
+ * The plan does not allocate any memory: the caller should provide the buffer
+ * of fft_plan_size(rank) bytes to the fft_plan_init() function and keep it
+ * until the plan is no longer used. The plan can be shared between threads.
+ *
+ * The transforms with the plan are optimized for x86 (SSE, AVX, AVX-512) only,
+ * on ARM and AArch64 they are performed by the generic scalar implementation, so
+ * direct_fft and reverse_fft are faster there for ranks covered by static tables.
+ */
+typedef struct LSP_DSP_LIB_TYPE(fft_plan_t)
+{
+    float      *twiddle;    // Twiddle factors for each butterfly stage, aligned to the cache line
+    size_t      rank;       // Rank of the FFT
+} LSP_DSP_LIB_TYPE(fft_plan_t);
+
+/**
+ * Mixed-radix FFT plan: the object that allows to perform FFT of any size
+ * that can be factorized as 2^a * 3^b * 5^c, for example 480 or 960 samples.
+ * The transform is performed by the sequence of radix-8, radix-4, radix-2,
+ * radix-3 and radix-5 stages, the twiddle factors are computed at runtime.
+ *
+ * The plan does not allocate any memory: the caller should provide the buffer
+ * of mixed_fft_plan_size(size) bytes to the mixed_fft_plan_init() function and
+ * keep it until the plan is no longer used. The plan can be shared between threads.
+ */
+typedef struct LSP_DSP_LIB_TYPE(mixed_fft_plan_t)
+{
+    float      *twiddle;    // Twiddle factors for each stage, aligned to the cache line
+    size_t      size;       // Size of FFT
+    size_t      stages;     // Number of stages
+    uint8_t     radix[32];  // Radix of each stage
+} LSP_DSP_LIB_TYPE(mixed_fft_plan_t);
+
+/**
+ * Parallel FFT plan: the object that allows to perform the FFT of large rank by
+ * several threads using the six-step algorithm. The transform of size N = N1 * N2
+ * is performed as N2 transforms of size N1 followed by N1 transforms of size N2,
+ * so each thread works on short sequences that fit into the cache.
+ *
+ * Both passes of the transform are split into plan->jobs independent jobs. The library
+ * does not start any threads: the host executes jobs of each pass by its own worker
+ * threads with parallel_direct_fft_pass() and parallel_reverse_fft_pass() and waits
+ * for all jobs of the first pass before starting the second one.
+ *
+ * The plan does not allocate any memory: the caller should provide the buffer
+ * of parallel_fft_plan_size(rank) bytes to the parallel_fft_plan_init() function
+ * and keep it until the plan is no longer used. The plan can be shared between threads.
+ */
+typedef struct LSP_DSP_LIB_TYPE(parallel_fft_plan_t)
+{
+    float      *twiddle;    // Twiddle factors applied between row and column transforms
+    size_t      rank;       // Rank of the FFT
+    size_t      rows;       // Rank of the transforms of the first pass (N1)
+    size_t      jobs;       // Number of jobs in each pass
+    size_t      tmp_size;   // Size of the temporary buffer in floats
+} LSP_DSP_LIB_TYPE(parallel_fft_plan_t);
+
+#pragma pack(pop)
+
+LSP_DSP_LIB_END_NAMESPACE
+
 /** Direct Fast Fourier Transform
  * @param dst_re real part of spectrum
  * @param dst_im imaginary part of spectrum
@@ -56,6 +126,248 @@ LSP_DSP_LIB_SYMBOL(void, reverse_fft, float *dst_re, float *dst_im, const float
  */
 LSP_DSP_LIB_SYMBOL(void, packed_reverse_fft, float *dst, const float *src, size_t rank);
 
+/** Direct Fast Fourier Transform of the real-valued signal. Because the spectrum
+ * of the real signal is Hermitian-symmetric, only the non-negative half of
+ * spectrum is computed: the DC, 2^(rank-1)-1 harmonics and the Nyquist frequency.
+ * The transform is performed as a complex FFT of the half size, so it takes
+ * nearly twice less time than the complex transform of the same rank.
+ *
+ * @param dst complex half-spectrum [re, im, re, im ...], should contain at least (2^rank + 2) floats
+ * @param src real signal, 2^rank floats
+ * @param rank the rank of FFT
+ */
+LSP_DSP_LIB_SYMBOL(void, real_direct_fft, float *dst, const float *src, size_t rank);
+
+/** Reverse Fast Fourier Transform of the Hermitian-symmetric spectrum into the real-valued signal.
+ * Imaginary parts of the DC and Nyquist frequency are ignored. The output is normalized
+ * the same way as for reverse_fft, so real_reverse_fft(real_direct_fft(x)) == x.
+ * The source buffer is not modified unless it is the same as the destination buffer.
+ *
+ * @param dst real signal, 2^rank floats
+ * @param src complex half-spectrum [re, im, re, im ...], (2^rank + 2) floats
+ * @param rank the rank of FFT
+ */
+LSP_DSP_LIB_SYMBOL(void, real_reverse_fft, float *dst, const float *src, size_t rank);
+
+/** Get the size of the buffer required by the FFT plan
+ *
+ * @param rank the rank of FFT, should not be greater than 30
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, fft_plan_size, size_t rank);
+
+/** Initialize the FFT plan and compute the twiddle factors
+ *
+ * @param plan the plan to initialize
+ * @param buf buffer of at least fft_plan_size(rank) bytes, does not require any alignment
+ * @param rank the rank of FFT, should not be greater than 30
+ */
+LSP_DSP_LIB_SYMBOL(void, fft_plan_init, LSP_DSP_LIB_TYPE(fft_plan_t) *plan, void *buf, size_t rank);
+
+/** Direct Fast Fourier Transform using the plan
+ * @param plan the FFT plan
+ * @param dst_re real part of spectrum
+ * @param dst_im imaginary part of spectrum
+ * @param src_re real part of signal
+ * @param src_im imaginary part of signal
+ */
+LSP_DSP_LIB_SYMBOL(void, fft_plan_direct, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan,
+    float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+
+/** Reverse Fast Fourier Transform using the plan
+ * @param plan the FFT plan
+ * @param dst_re real part of signal
+ * @param dst_im imaginary part of signal
+ * @param src_re real part of spectrum
+ * @param src_im imaginary part of spectrum
+ */
+LSP_DSP_LIB_SYMBOL(void, fft_plan_reverse, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan,
+    float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+
+/** Direct Fast Fourier Transform with packed complex data using the plan
+ * @param plan the FFT plan
+ * @param dst complex spectrum [re, im, re, im ...]
+ * @param src complex signal [re, im, re, im ...]
+ */
+LSP_DSP_LIB_SYMBOL(void, fft_plan_packed_direct, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, const float *src);
+
+/** Reverse Fast Fourier Transform with packed complex data using the plan
+ * @param plan the FFT plan
+ * @param dst complex signal [re, im, re, im ...]
+ * @param src complex spectrum [re, im, re, im ...]
+ */
+LSP_DSP_LIB_SYMBOL(void, fft_plan_packed_reverse, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, const float *src);
+
+/** Get the size of the buffer required by the mixed-radix FFT plan
+ *
+ * @param size the size of FFT
+ * @return size of the buffer in bytes, including the space for alignment,
+ *   zero if the size of FFT can not be factorized as 2^a * 3^b * 5^c
+ */
+LSP_DSP_LIB_SYMBOL(size_t, mixed_fft_plan_size, size_t size);
+
+/** Initialize the mixed-radix FFT plan and compute the twiddle factors
+ *
+ * @param plan the plan to initialize
+ * @param buf buffer of at least mixed_fft_plan_size(size) bytes, does not require any alignment
+ * @param size the size of FFT, should be supported (mixed_fft_plan_size(size) returns non-zero value)
+ */
+LSP_DSP_LIB_SYMBOL(void, mixed_fft_plan_init, LSP_DSP_LIB_TYPE(mixed_fft_plan_t) *plan, void *buf, size_t size);
+
+/** Direct mixed-radix Fast Fourier Transform
+ * @param plan the mixed-radix FFT plan
+ * @param dst_re real part of spectrum, plan->size floats
+ * @param dst_im imaginary part of spectrum, plan->size floats
+ * @param src_re real part of signal, plan->size floats
+ * @param src_im imaginary part of signal, plan->size floats
+ * @param tmp temporary buffer of plan->size * 2 floats
+ */
+LSP_DSP_LIB_SYMBOL(void, mixed_direct_fft, const LSP_DSP_LIB_TYPE(mixed_fft_plan_t) *plan,
+    float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+
+/** Reverse mixed-radix Fast Fourier Transform
+ * @param plan the mixed-radix FFT plan
+ * @param dst_re real part of signal, plan->size floats
+ * @param dst_im imaginary part of signal, plan->size floats
+ * @param src_re real part of spectrum, plan->size floats
+ * @param src_im imaginary part of spectrum, plan->size floats
+ * @param tmp temporary buffer of plan->size * 2 floats
+ */
+LSP_DSP_LIB_SYMBOL(void, mixed_reverse_fft, const LSP_DSP_LIB_TYPE(mixed_fft_plan_t) *plan,
+    float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+
+/** Direct mixed-radix Fast Fourier Transform with packed complex data
+ * @param plan the mixed-radix FFT plan
+ * @param dst complex spectrum [re, im, re, im ...], plan->size * 2 floats
+ * @param src complex signal [re, im, re, im ...], plan->size * 2 floats
+ * @param tmp temporary buffer of plan->size * 2 floats
+ */
+LSP_DSP_LIB_SYMBOL(void, packed_mixed_direct_fft, const LSP_DSP_LIB_TYPE(mixed_fft_plan_t) *plan,
+    float *dst, const float *src, float *tmp);
+
+/** Reverse mixed-radix Fast Fourier Transform with packed complex data
+ * @param plan the mixed-radix FFT plan
+ * @param dst complex signal [re, im, re, im ...], plan->size * 2 floats
+ * @param src complex spectrum [re, im, re, im ...], plan->size * 2 floats
+ * @param tmp temporary buffer of plan->size * 2 floats
+ */
+LSP_DSP_LIB_SYMBOL(void, packed_mixed_reverse_fft, const LSP_DSP_LIB_TYPE(mixed_fft_plan_t) *plan,
+    float *dst, const float *src, float *tmp);
+
+/** Direct Fast Fourier Transform of multiple channels at once. The data of channel i
+ * is located at offset i * stride of each buffer. The result is the same as calling
+ * direct_fft() for each channel. Only the AVX implementation on x86_64 processes groups
+ * of 8 channels with shared twiddle factors, and only for ranks 3 to 7; the rest channels,
+ * other ranks and other architectures call direct_fft() for each channel.
+ *
+ * @param dst_re real part of spectrum
+ * @param dst_im imaginary part of spectrum
+ * @param src_re real part of signal
+ * @param src_im imaginary part of signal
+ * @param stride distance between channels in floats, should be not less than 2^rank
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, batch_direct_fft, float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+    size_t stride, size_t rank, size_t count);
+
+/** Reverse Fast Fourier Transform of multiple channels at once. The data of channel i
+ * is located at offset i * stride of each buffer. The result is the same as calling
+ * reverse_fft() for each channel. Only the AVX implementation on x86_64 processes groups
+ * of 8 channels with shared twiddle factors, and only for ranks 3 to 7; the rest channels,
+ * other ranks and other architectures call reverse_fft() for each channel.
+ *
+ * @param dst_re real part of signal
+ * @param dst_im imaginary part of signal
+ * @param src_re real part of spectrum
+ * @param src_im imaginary part of spectrum
+ * @param stride distance between channels in floats, should be not less than 2^rank
+ * @param rank the rank of FFT
+ * @param count number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, batch_reverse_fft, float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+    size_t stride, size_t rank, size_t count);
+
+/** Get the size of the buffer required by the parallel FFT plan
+ *
+ * @param rank the rank of FFT, should not be greater than 30
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, parallel_fft_plan_size, size_t rank);
+
+/** Initialize the parallel FFT plan and compute the twiddle factors
+ *
+ * @param plan the plan to initialize
+ * @param buf buffer of at least parallel_fft_plan_size(rank) bytes, does not require any alignment
+ * @param rank the rank of FFT, should not be greater than 30
+ * @param jobs desired number of jobs in each pass, usually the number of threads of the host
+ *   that perform the transform; the actual number is stored in plan->jobs
+ */
+LSP_DSP_LIB_SYMBOL(void, parallel_fft_plan_init, LSP_DSP_LIB_TYPE(parallel_fft_plan_t) *plan,
+    void *buf, size_t rank, size_t jobs);
+
+/** Direct Fast Fourier Transform using the parallel plan. All jobs of both passes
+ * are performed by the caller's thread.
+ *
+ * @param plan the parallel FFT plan
+ * @param dst_re real part of spectrum
+ * @param dst_im imaginary part of spectrum
+ * @param src_re real part of signal
+ * @param src_im imaginary part of signal
+ * @param tmp temporary buffer of plan->tmp_size floats
+ */
+LSP_DSP_LIB_SYMBOL(void, parallel_direct_fft, const LSP_DSP_LIB_TYPE(parallel_fft_plan_t) *plan,
+    float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+
+/** Perform one job of the pass of the direct Fast Fourier Transform using the parallel plan.
+ * Jobs of the same pass can be executed simultaneously by different threads in any order,
+ * the second pass should be started only after all jobs of the first pass have been completed.
+ * Transforms of rank below 10 are performed entirely by the job 0 of the pass 0.
+ *
+ * @param plan the parallel FFT plan
+ * @param dst_re real part of spectrum
+ * @param dst_im imaginary part of spectrum
+ * @param src_re real part of signal
+ * @param src_im imaginary part of signal
+ * @param tmp temporary buffer of plan->tmp_size floats shared by all jobs
+ * @param pass index of the pass: 0 or 1
+ * @param job index of the job, should be less than plan->jobs
+ */
+LSP_DSP_LIB_SYMBOL(void, parallel_direct_fft_pass, const LSP_DSP_LIB_TYPE(parallel_fft_plan_t) *plan,
+    float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp,
+    size_t pass, size_t job);
+
+/** Reverse Fast Fourier Transform using the parallel plan. All jobs of both passes
+ * are performed by the caller's thread.
+ *
+ * @param plan the parallel FFT plan
+ * @param dst_re real part of signal
+ * @param dst_im imaginary part of signal
+ * @param src_re real part of spectrum
+ * @param src_im imaginary part of spectrum
+ * @param tmp temporary buffer of plan->tmp_size floats
+ */
+LSP_DSP_LIB_SYMBOL(void, parallel_reverse_fft, const LSP_DSP_LIB_TYPE(parallel_fft_plan_t) *plan,
+    float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+
+/** Perform one job of the pass of the reverse Fast Fourier Transform using the parallel plan.
+ * Jobs of the same pass can be executed simultaneously by different threads in any order,
+ * the second pass should be started only after all jobs of the first pass have been completed.
+ * Transforms of rank below 10 are performed entirely by the job 0 of the pass 0.
+ *
+ * @param plan the parallel FFT plan
+ * @param dst_re real part of signal
+ * @param dst_im imaginary part of signal
+ * @param src_re real part of spectrum
+ * @param src_im imaginary part of spectrum
+ * @param tmp temporary buffer of plan->tmp_size floats shared by all jobs
+ * @param pass index of the pass: 0 or 1
+ * @param job index of the job, should be less than plan->jobs
+ */
+LSP_DSP_LIB_SYMBOL(void, parallel_reverse_fft_pass, const LSP_DSP_LIB_TYPE(parallel_fft_plan_t) *plan,
+    float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp,
+    size_t pass, size_t job);
+
 /** Normalize FFT coefficients
  *
  * @param dst_re target array for real part of signal
@@ -27,6 +27,7 @@
 #include <lsp-plug.in/dsp/common/filters/types.h>
 #include <lsp-plug.in/dsp/common/filters/dynamic.h>
 #include <lsp-plug.in/dsp/common/filters/static.h>
+#include <lsp-plug.in/dsp/common/filters/svf.h>
 #include <lsp-plug.in/dsp/common/filters/transfer.h>
 #include <lsp-plug.in/dsp/common/filters/transform.h>
 
@@ -65,4 +65,132 @@ LSP_DSP_LIB_SYMBOL(void, dyn_biquad_process_x4, float *dst, const float *src, fl
  */
 LSP_DSP_LIB_SYMBOL(void, dyn_biquad_process_x8, float *dst, const float *src, float *d, size_t count, const LSP_DSP_LIB_TYPE(biquad_x8_t) *f);
 
+/** Process single dynamic bi-quadratic filter for multiple samples, the filter bank is
+ * linearly interpolated between f0 and f1: the sample i is processed with the filter bank
+ * f0 + (f1 - f0) * i / count, so the next call starting with f1 continues the transition seamlessly.
+ * This does not require the per-sample array of filters like dyn_biquad_process_x1.
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (2 floats)
+ * @param count number of samples to process
+ * @param f0 filter bank at the start of the block
+ * @param f1 filter bank at the end of the block
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_lerp_x1, float *dst, const float *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(biquad_x1_t) *f0, const LSP_DSP_LIB_TYPE(biquad_x1_t) *f1);
+
+/** Process two dynamic bi-quadratic filters for multiple samples, the filter bank is
+ * linearly interpolated between f0 and f1: the sample i is processed with the filter bank
+ * f0 + (f1 - f0) * i / count, so the next call starting with f1 continues the transition seamlessly.
+ * This does not require the per-sample array of filters like dyn_biquad_process_x2.
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (4 floats)
+ * @param count number of samples to process
+ * @param f0 filter bank at the start of the block
+ * @param f1 filter bank at the end of the block
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_lerp_x2, float *dst, const float *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(biquad_x2_t) *f0, const LSP_DSP_LIB_TYPE(biquad_x2_t) *f1);
+
+/** Process four dynamic bi-quadratic filters for multiple samples, the filter bank is
+ * linearly interpolated between f0 and f1: the sample i is processed with the filter bank
+ * f0 + (f1 - f0) * i / count, so the next call starting with f1 continues the transition seamlessly.
+ * This does not require the per-sample array of filters like dyn_biquad_process_x4.
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (8 floats)
+ * @param count number of samples to process
+ * @param f0 filter bank at the start of the block
+ * @param f1 filter bank at the end of the block
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_lerp_x4, float *dst, const float *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(biquad_x4_t) *f0, const LSP_DSP_LIB_TYPE(biquad_x4_t) *f1);
+
+/** Process eight dynamic bi-quadratic filters for multiple samples, the filter bank is
+ * linearly interpolated between f0 and f1: the sample i is processed with the filter bank
+ * f0 + (f1 - f0) * i / count, so the next call starting with f1 continues the transition seamlessly.
+ * This does not require the per-sample array of filters like dyn_biquad_process_x8.
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (16 floats)
+ * @param count number of samples to process
+ * @param f0 filter bank at the start of the block
+ * @param f1 filter bank at the end of the block
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_lerp_x8, float *dst, const float *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(biquad_x8_t) *f0, const LSP_DSP_LIB_TYPE(biquad_x8_t) *f1);
+
+/** Process single dynamic bi-quadratic filter for multiple samples, the analog filter
+ * cascades are linearly interpolated between c0 and c1 and converted into the digital filter
+ * by the bilinear transform for each sample: the sample i is processed with the filter obtained
+ * from c0 + (c1 - c0) * i / count.
+ * This does not require the per-sample array of filters like dyn_biquad_process_x1.
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (2 floats)
+ * @param count number of samples to process
+ * @param c0 analog filter cascade at the start of the block
+ * @param c1 analog filter cascade at the end of the block
+ * @param kf frequency shift coefficient of the bilinear transform
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_cascade_lerp_x1, float *dst, const float *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(f_cascade_t) *c0, const LSP_DSP_LIB_TYPE(f_cascade_t) *c1, float kf);
+
+/** Process two dynamic bi-quadratic filters for multiple samples, the analog filter
+ * cascades are linearly interpolated between c0 and c1 and converted into the digital filter
+ * by the bilinear transform for each sample: the sample i is processed with the filter obtained
+ * from c0 + (c1 - c0) * i / count.
+ * This does not require the per-sample array of filters like dyn_biquad_process_x2.
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (4 floats)
+ * @param count number of samples to process
+ * @param c0 array of 2 analog filter cascades at the start of the block
+ * @param c1 array of 2 analog filter cascades at the end of the block
+ * @param kf frequency shift coefficient of the bilinear transform
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_cascade_lerp_x2, float *dst, const float *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(f_cascade_t) *c0, const LSP_DSP_LIB_TYPE(f_cascade_t) *c1, float kf);
+
+/** Process four dynamic bi-quadratic filters for multiple samples, the analog filter
+ * cascades are linearly interpolated between c0 and c1 and converted into the digital filter
+ * by the bilinear transform for each sample: the sample i is processed with the filter obtained
+ * from c0 + (c1 - c0) * i / count.
+ * This does not require the per-sample array of filters like dyn_biquad_process_x4.
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (8 floats)
+ * @param count number of samples to process
+ * @param c0 array of 4 analog filter cascades at the start of the block
+ * @param c1 array of 4 analog filter cascades at the end of the block
+ * @param kf frequency shift coefficient of the bilinear transform
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_cascade_lerp_x4, float *dst, const float *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(f_cascade_t) *c0, const LSP_DSP_LIB_TYPE(f_cascade_t) *c1, float kf);
+
+/** Process eight dynamic bi-quadratic filters for multiple samples, the analog filter
+ * cascades are linearly interpolated between c0 and c1 and converted into the digital filter
+ * by the bilinear transform for each sample: the sample i is processed with the filter obtained
+ * from c0 + (c1 - c0) * i / count.
+ * This does not require the per-sample array of filters like dyn_biquad_process_x8.
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (16 floats)
+ * @param count number of samples to process
+ * @param c0 array of 8 analog filter cascades at the start of the block
+ * @param c1 array of 8 analog filter cascades at the end of the block
+ * @param kf frequency shift coefficient of the bilinear transform
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_cascade_lerp_x8, float *dst, const float *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(f_cascade_t) *c0, const LSP_DSP_LIB_TYPE(f_cascade_t) *c1, float kf);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_FILTERS_DYNAMIC_H_ */
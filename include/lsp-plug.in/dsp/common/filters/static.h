@@ -61,4 +61,36 @@ LSP_DSP_LIB_SYMBOL(void, biquad_process_x4, float *dst, const float *src, size_t
  */
 LSP_DSP_LIB_SYMBOL(void, biquad_process_x8, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(biquad_t) *f);
 
+/** Process sixteen bi-quadratic filters for multiple samples simultaneously
+ *
+ * @param dst destination samples
+ * @param src source samples
+ * @param count number of samples to process
+ * @param f bi-quadratic filter structure for sixteen filters
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_x16, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(biquad16_t) *f);
+
+/** Process eight channels by cascades of bi-quadratic filters simultaneously. Each
+ * channel is processed by the dedicated lane of the x8 filter banks: the i-th channel
+ * uses coefficients b0[i], b1[i], b2[i], a1[i], a2[i] of each bank and the i-th
+ * elements of the d0 and d1 filter memory, so the filter state is kept separately
+ * for each channel.
+ *
+ * The banks are stored sequentially in memory and are applied in the order of their
+ * location: each block of samples is passed through all nc cascades before processing
+ * the next block. The function does nothing if nc is zero. The number of channels is
+ * fixed to eight: more channels should be processed in groups of eight with separate
+ * banks. All eight pointers should always be valid, so the unused channels of the last
+ * group should point to a scratch buffer of count samples (the same buffer may be
+ * used both as source and destination).
+ *
+ * @param dst array of eight pointers to destination samples
+ * @param src array of eight pointers to source samples, may point to the same buffers as dst
+ * @param count number of samples to process in each channel
+ * @param f array of nc bi-quadratic filter structures with the x8 filter banks
+ * @param nc number of cascades
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_mc8, float * const *dst, const float * const *src, size_t count,
+    LSP_DSP_LIB_TYPE(biquad_t) *f, size_t nc);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_FILTERS_STATIC_H_ */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_FILTERS_SVF_H_
+#define LSP_PLUG_IN_DSP_COMMON_FILTERS_SVF_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+#include <lsp-plug.in/dsp/common/filters/types.h>
+
+/** Process single state-variable filter with coefficients changing on each sample
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (2 floats)
+ * @param count number of samples to process
+ * @param f array of count memory-aligned state-variable filters
+ */
+LSP_DSP_LIB_SYMBOL(void, svf_process_x1, float *dst, const float *src, float *d, size_t count, const LSP_DSP_LIB_TYPE(svf_x1_t) *f);
+
+/** Process four channels by state-variable filters with coefficients changing on each sample,
+ * the i-th channel is processed by the i-th filter of the bank
+ *
+ * @param dst array of four pointers to destination samples
+ * @param src array of four pointers to source samples, may point to the same buffers as dst
+ * @param d pointer to filter memory (8 floats)
+ * @param count number of samples to process in each channel
+ * @param f array of count memory-aligned state-variable filter banks
+ */
+LSP_DSP_LIB_SYMBOL(void, svf_process_x4, float * const *dst, const float * const *src, float *d, size_t count, const LSP_DSP_LIB_TYPE(svf_x4_t) *f);
+
+/** Process eight channels by state-variable filters with coefficients changing on each sample,
+ * the i-th channel is processed by the i-th filter of the bank
+ *
+ * @param dst array of eight pointers to destination samples
+ * @param src array of eight pointers to source samples, may point to the same buffers as dst
+ * @param d pointer to filter memory (16 floats)
+ * @param count number of samples to process in each channel
+ * @param f array of count memory-aligned state-variable filter banks
+ */
+LSP_DSP_LIB_SYMBOL(void, svf_process_x8, float * const *dst, const float * const *src, float *d, size_t count, const LSP_DSP_LIB_TYPE(svf_x8_t) *f);
+
+/** Process single state-variable filter with coefficients linearly ramped between two states:
+ * the i-th sample is processed with coefficients f0 + (f1 - f0) * i / count
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (2 floats)
+ * @param count number of samples to process
+ * @param f0 state of the filter at the first sample
+ * @param f1 state of the filter at the sample next to the last one
+ */
+LSP_DSP_LIB_SYMBOL(void, svf_lerp_x1, float *dst, const float *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(svf_x1_t) *f0, const LSP_DSP_LIB_TYPE(svf_x1_t) *f1);
+
+/** Process four channels by state-variable filters with coefficients linearly ramped between
+ * two states: the i-th sample is processed with coefficients f0 + (f1 - f0) * i / count
+ *
+ * @param dst array of four pointers to destination samples
+ * @param src array of four pointers to source samples, may point to the same buffers as dst
+ * @param d pointer to filter memory (8 floats)
+ * @param count number of samples to process in each channel
+ * @param f0 state of the filter bank at the first sample
+ * @param f1 state of the filter bank at the sample next to the last one
+ */
+LSP_DSP_LIB_SYMBOL(void, svf_lerp_x4, float * const *dst, const float * const *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(svf_x4_t) *f0, const LSP_DSP_LIB_TYPE(svf_x4_t) *f1);
+
+/** Process eight channels by state-variable filters with coefficients linearly ramped between
+ * two states: the i-th sample is processed with coefficients f0 + (f1 - f0) * i / count
+ *
+ * @param dst array of eight pointers to destination samples
+ * @param src array of eight pointers to source samples, may point to the same buffers as dst
+ * @param d pointer to filter memory (16 floats)
+ * @param count number of samples to process in each channel
+ * @param f0 state of the filter bank at the first sample
+ * @param f1 state of the filter bank at the sample next to the last one
+ */
+LSP_DSP_LIB_SYMBOL(void, svf_lerp_x8, float * const *dst, const float * const *src, float *d, size_t count,
+        const LSP_DSP_LIB_TYPE(svf_x8_t) *f0, const LSP_DSP_LIB_TYPE(svf_x8_t) *f1);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_FILTERS_SVF_H_ */
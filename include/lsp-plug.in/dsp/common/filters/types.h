@@ -185,6 +185,40 @@
 
 */
 
+/*
+  STATE-VARIABLE FILTER
+
+    Topology-preserving (zero-delay feedback) state-variable filter is a
+    trapezoidal integration of the analog prototype:
+
+               m0*p^2 + (m1 + k*m0)*p + (m2 + m0)      g = tan(pi * frequency / sample_rate)
+      H(p) = -------------------------------------     k = 1 / Q - damping factor
+                       p^2 + k*p + 1
+
+    where the output is the mix of the highpass, bandpass and lowpass outputs
+    of the filter with gains m0, m1 + k*m0 and m2 + m0 respectively. For example:
+
+      lowpass:  m0 = 0, m1 = 0,      m2 = 1
+      bandpass: m0 = 0, m1 = 1,      m2 = 0
+      highpass: m0 = 1, m1 = -k,     m2 = -1
+      notch:    m0 = 1, m1 = -k,     m2 = 0
+      allpass:  m0 = 1, m1 = -2*k,   m2 = 0
+
+    The filter has two memory elements ic1 and ic2 and processes sample x as:
+
+      v1   = (ic1 + g * (x - ic2)) / (1 + g * (g + k))  - bandpass output
+      v2   = ic2 + g * v1                               - lowpass output
+      ic1' = 2 * v1 - ic1
+      ic2' = 2 * v2 - ic2
+      y    = m0 * x + m1 * v1 + m2 * v2
+
+    The filter remains stable for any positive g and k, so the coefficients
+    can be changed on each sample. The filter banks are organized in the same
+    way as the biquad filter banks: each coefficient of the x4 and x8 bank
+    is packed into distinct SIMD register, each filter of the bank
+    processes its own channel (voice).
+ */
+
 /**
  * These constants define the offset of filter constants relative to the memory in biquad_t structure,
  * filter alignment and maximum number of memory elements
@@ -194,6 +228,13 @@
 #define LSP_DSP_BIQUAD_ALIGN            0x40
 #define LSP_DSP_BIQUAD_D_ITEMS          16
 
+/**
+ * The same constants for the biquad16_t structure
+ */
+#define LSP_DSP_BIQUAD16_XN_OFF         0x80
+#define LSP_DSP_BIQUAD16_XN_SOFF        "0x80"
+#define LSP_DSP_BIQUAD16_D_ITEMS        32
+
 LSP_DSP_LIB_BEGIN_NAMESPACE
 
 #pragma pack(push, 1)
@@ -260,6 +301,18 @@ typedef struct LSP_DSP_LIB_TYPE(biquad_x8_t)
     float   a2[8];
 } LSP_DSP_LIB_TYPE(biquad_x8_t);
 
+/**
+ * Biquad filter bank for 16 digital biquad filters
+ */
+typedef struct LSP_DSP_LIB_TYPE(biquad_x16_t)
+{
+    float   b0[16];
+    float   b1[16];
+    float   b2[16];
+    float   a1[16];
+    float   a2[16];
+} LSP_DSP_LIB_TYPE(biquad_x16_t);
+
 /**
  * This is main filter structure with memory elements
  * It should be aligned at least to 16-byte boundary due to
@@ -279,6 +332,52 @@ typedef struct LSP_DSP_LIB_TYPE(biquad_t)
     float   __pad[8];
 } __lsp_aligned(LSP_DSP_BIQUAD_ALIGN) LSP_DSP_LIB_TYPE(biquad_t);
 
+/**
+ * Filter structure with memory elements for the bank of 16 digital biquad filters.
+ * It is kept separate from biquad_t to not to change the layout of biquad_t
+ * used by existing filter banks
+ */
+typedef struct LSP_DSP_LIB_TYPE(biquad16_t)
+{
+    float   d[LSP_DSP_BIQUAD16_D_ITEMS];
+    LSP_DSP_LIB_TYPE(biquad_x16_t) x16;
+} __lsp_aligned(LSP_DSP_BIQUAD_ALIGN) LSP_DSP_LIB_TYPE(biquad16_t);
+
+/**
+ * State-variable filter bank for 1 filter
+ * Non-used elements should be filled with zeros
+ */
+typedef struct LSP_DSP_LIB_TYPE(svf_x1_t)
+{
+    float   g, k;           // g = tan(pi*f/sr), k = 1/Q
+    float   m0, m1, m2;     // mix of input, bandpass and lowpass outputs
+    float   p0, p1, p2;     // padding (not used), SHOULD be zero
+} LSP_DSP_LIB_TYPE(svf_x1_t);
+
+/**
+ * State-variable filter bank for 4 filters
+ */
+typedef struct LSP_DSP_LIB_TYPE(svf_x4_t)
+{
+    float   g[4];
+    float   k[4];
+    float   m0[4];
+    float   m1[4];
+    float   m2[4];
+} LSP_DSP_LIB_TYPE(svf_x4_t);
+
+/**
+ * State-variable filter bank for 8 filters
+ */
+typedef struct LSP_DSP_LIB_TYPE(svf_x8_t)
+{
+    float   g[8];
+    float   k[8];
+    float   m0[8];
+    float   m1[8];
+    float   m2[8];
+} LSP_DSP_LIB_TYPE(svf_x8_t);
+
 #pragma pack(pop)
 
 LSP_DSP_LIB_END_NAMESPACE
@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_FIR_H_
+#define LSP_PLUG_IN_DSP_COMMON_FIR_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+#pragma pack(push, 1)
+
+/**
+ * Streaming FIR filter: the object that keeps the history of input samples
+ * of each channel between calls, so the signal can be processed by blocks
+ * of any size. All channels are filtered by the same set of taps. The taps
+ * are stored in reversed order, so each output sample is the dot product of
+ * taps and the window of input samples which both are read forward. Pairs of
+ * channels are processed at once, so the taps are loaded once for both channels.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of fir_size(length, channels) bytes to the fir_init() function and keep
+ * it until the object is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(fir_t)
+{
+    float      *taps;       // Reversed taps, length samples
+    float      *hist;       // Input history of channels, channels * stride samples
+    size_t      length;     // Number of taps
+    size_t      channels;   // Number of channels
+    size_t      stride;     // Size of the input history of each channel
+} LSP_DSP_LIB_TYPE(fir_t);
+
+/**
+ * Polyphase FIR interpolator: raises the sample rate by the integer factor.
+ * The prototype filter designed for the output sample rate is split into factor
+ * phases, each phase is applied directly to the input signal, so the zero samples
+ * inserted between input samples are never processed. The DC gain of the prototype
+ * filter should be equal to the interpolation factor to keep the level of the signal.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of fir_interpolator_size(length, factor) bytes to the fir_interpolator_init()
+ * function and keep it until the object is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(fir_interpolator_t)
+{
+    float      *taps;       // Reversed taps of each phase, factor * length samples
+    float      *hist;       // Input history
+    size_t      length;     // Number of taps of each phase
+    size_t      factor;     // Interpolation factor
+} LSP_DSP_LIB_TYPE(fir_interpolator_t);
+
+/**
+ * Polyphase FIR decimator: lowers the sample rate by the integer factor.
+ * The anti-aliasing filter is evaluated only for the samples that are kept,
+ * so no work is done for the discarded samples. The input can be passed by
+ * blocks of any size, the decimator keeps track of the input phase between calls.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of fir_decimator_size(length, factor) bytes to the fir_decimator_init()
+ * function and keep it until the object is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(fir_decimator_t)
+{
+    float      *taps;       // Reversed taps padded with zeros at the head, length samples
+    float      *hist;       // Input history
+    size_t      length;     // Number of taps including padding
+    size_t      factor;     // Decimation factor
+    size_t      fill;       // Number of samples stored in the input history
+} LSP_DSP_LIB_TYPE(fir_decimator_t);
+
+#pragma pack(pop)
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/** Apply FIR filter with reversed taps to the signal:
+ *   dst[i] = sum { taps[j] * src[i + j] }, j = 0 .. length-1
+ *
+ * @param dst destination buffer of count samples, can be the same as source buffer
+ * @param src source buffer of count + length - 1 samples
+ * @param taps reversed taps of the filter
+ * @param length number of taps, should be positive
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_direct, float *dst, const float *src, const float *taps, size_t length, size_t count);
+
+/** Apply FIR filter with reversed taps to two signals at once, see fir_direct()
+ *
+ * @param dst1 destination buffer of the first channel, can be the same as src1
+ * @param dst2 destination buffer of the second channel, can be the same as src2
+ * @param src1 source buffer of the first channel of count + length - 1 samples
+ * @param src2 source buffer of the second channel of count + length - 1 samples
+ * @param taps reversed taps of the filter
+ * @param length number of taps, should be positive
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_direct_x2, float *dst1, float *dst2, const float *src1, const float *src2,
+    const float *taps, size_t length, size_t count);
+
+/** Get the size of the buffer required by the FIR filter
+ *
+ * @param length number of taps
+ * @param channels number of channels
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, fir_size, size_t length, size_t channels);
+
+/** Initialize the FIR filter with taps and clear the state
+ *
+ * @param fir the filter to initialize
+ * @param buf buffer of at least fir_size(length, channels) bytes, does not require any alignment
+ * @param taps taps of the filter (impulse response) in natural order
+ * @param length number of taps, should be positive
+ * @param channels number of channels
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_init, LSP_DSP_LIB_TYPE(fir_t) *fir, void *buf, const float *taps, size_t length, size_t channels);
+
+/** Clear the input history of the FIR filter
+ *
+ * @param fir the filter
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_reset, LSP_DSP_LIB_TYPE(fir_t) *fir);
+
+/** Process the block of samples of any size for all channels
+ *
+ * @param fir the filter
+ * @param dst list of output buffers, buffers can be the same as input buffers
+ * @param src list of input buffers
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_process, LSP_DSP_LIB_TYPE(fir_t) *fir, float * const *dst, const float * const *src, size_t count);
+
+/** Apply polyphase FIR interpolation filter to the signal:
+ *   dst[i*factor + p] = sum { taps[p*length + j] * src[i + j] }, j = 0 .. length-1, p = 0 .. factor-1
+ *
+ * @param dst destination buffer of count * factor samples
+ * @param src source buffer of count + length - 1 samples
+ * @param taps reversed taps of each phase, factor * length samples
+ * @param length number of taps of each phase, should be positive
+ * @param factor interpolation factor
+ * @param count number of input samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_interpolate, float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+
+/** Apply FIR filter with reversed taps to the signal and keep only each factor'th sample:
+ *   dst[i] = sum { taps[j] * src[i*factor + j] }, j = 0 .. length-1
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of (count - 1) * factor + length samples
+ * @param taps reversed taps of the filter
+ * @param length number of taps, should be positive
+ * @param factor decimation factor
+ * @param count number of output samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_decimate, float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+
+/** Get the size of the buffer required by the polyphase interpolator
+ *
+ * @param length number of taps of the prototype filter
+ * @param factor interpolation factor
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, fir_interpolator_size, size_t length, size_t factor);
+
+/** Initialize the polyphase interpolator and clear the state
+ *
+ * @param intp the interpolator to initialize
+ * @param buf buffer of at least fir_interpolator_size(length, factor) bytes, does not require any alignment
+ * @param taps taps of the prototype filter in natural order
+ * @param length number of taps of the prototype filter, should be positive
+ * @param factor interpolation factor, should be positive
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_interpolator_init, LSP_DSP_LIB_TYPE(fir_interpolator_t) *intp, void *buf,
+    const float *taps, size_t length, size_t factor);
+
+/** Clear the input history of the polyphase interpolator
+ *
+ * @param intp the interpolator
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_interpolator_reset, LSP_DSP_LIB_TYPE(fir_interpolator_t) *intp);
+
+/** Process the block of samples of any size
+ *
+ * @param intp the interpolator
+ * @param dst destination buffer of count * factor samples
+ * @param src source buffer of count samples
+ * @param count number of input samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_interpolator_process, LSP_DSP_LIB_TYPE(fir_interpolator_t) *intp,
+    float *dst, const float *src, size_t count);
+
+/** Get the size of the buffer required by the polyphase decimator
+ *
+ * @param length number of taps of the anti-aliasing filter
+ * @param factor decimation factor
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, fir_decimator_size, size_t length, size_t factor);
+
+/** Initialize the polyphase decimator and clear the state
+ *
+ * @param dec the decimator to initialize
+ * @param buf buffer of at least fir_decimator_size(length, factor) bytes, does not require any alignment
+ * @param taps taps of the anti-aliasing filter in natural order
+ * @param length number of taps of the filter, should be positive
+ * @param factor decimation factor, should be positive
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_decimator_init, LSP_DSP_LIB_TYPE(fir_decimator_t) *dec, void *buf,
+    const float *taps, size_t length, size_t factor);
+
+/** Clear the input history of the polyphase decimator
+ *
+ * @param dec the decimator
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_decimator_reset, LSP_DSP_LIB_TYPE(fir_decimator_t) *dec);
+
+/** Process the block of samples of any size. The first output sample
+ * corresponds to the first input sample after initialization or reset,
+ * each next output sample corresponds to the factor'th next input sample.
+ *
+ * @param dec the decimator
+ * @param dst destination buffer of at least count / factor + 1 samples
+ * @param src source buffer of count samples
+ * @param count number of input samples to process
+ * @return number of samples written to the destination buffer
+ */
+LSP_DSP_LIB_SYMBOL(size_t, fir_decimator_process, LSP_DSP_LIB_TYPE(fir_decimator_t) *dec,
+    float *dst, const float *src, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_FIR_H_ */
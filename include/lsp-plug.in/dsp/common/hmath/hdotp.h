@@ -51,4 +51,16 @@ LSP_DSP_LIB_SYMBOL(float, h_sqr_dotp, const float *a, const float *b, size_t cou
  */
 LSP_DSP_LIB_SYMBOL(float, h_abs_dotp, const float *a, const float *b, size_t count);
 
+/** Calculate dot product of the vector and the linear interpolation between two vectors:
+ * sum {from 0 to count-1} (x[i] * (a[i] + (b[i] - a[i]) * k))
+ *
+ * @param x first vector
+ * @param a start of the interpolated vector
+ * @param b end of the interpolated vector
+ * @param k interpolation factor
+ * @param count number of elements
+ * @return scalar multiplication
+ */
+LSP_DSP_LIB_SYMBOL(float, h_lerp_dotp, const float *x, const float *a, const float *b, float k, size_t count);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_HMATH_HDOTP_H_ */
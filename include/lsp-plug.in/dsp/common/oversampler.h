@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_OVERSAMPLER_H_
+#define LSP_PLUG_IN_DSP_COMMON_OVERSAMPLER_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+#include <lsp-plug.in/dsp/common/fir.h>
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/** Processing function called by the oversampler for each chunk of the oversampled signal
+ *
+ * @param arg user argument passed to oversampler_process()
+ * @param buf oversampled signal to modify in place
+ * @param count number of oversampled samples, always a multiple of the oversampling factor
+ */
+typedef void (* LSP_DSP_LIB_TYPE(oversampler_callback_t))(void *arg, float *buf, size_t count);
+
+#pragma pack(push, 1)
+
+/**
+ * Oversampler: raises the sample rate of the signal by the integer factor, passes
+ * the oversampled signal to the callback and then lowers the sample rate back.
+ * Both the interpolation and the anti-aliasing filters are windowed sinc filters
+ * with the cutoff at the Nyquist frequency of the input signal, they are applied
+ * by the polyphase FIR interpolator and decimator that keep their tails between calls.
+ *
+ * The input is processed by chunks that are small enough to keep the oversampled
+ * signal in the CPU cache between the interpolation, the callback and the decimation.
+ * The latency of the oversampler is always an integer number of input samples and
+ * is stored in the latency field, so it can be compensated by the caller.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of oversampler_size(factor, zcross) bytes to the oversampler_init() function
+ * and keep it until the object is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(oversampler_t)
+{
+    LSP_DSP_LIB_TYPE(fir_interpolator_t)    up;         // Interpolation filter
+    LSP_DSP_LIB_TYPE(fir_decimator_t)       down;       // Anti-aliasing filter
+    float                                  *buf;        // Oversampled chunk of the signal
+    size_t                                  factor;     // Oversampling factor
+    size_t                                  latency;    // Latency in input samples
+} LSP_DSP_LIB_TYPE(oversampler_t);
+
+#pragma pack(pop)
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/** Get the size of the buffer required by the oversampler
+ *
+ * @param factor oversampling factor, should be positive
+ * @param zcross number of zero crossings of the sinc function at each side of filters,
+ *   in range of 1 to 64, the latency of the oversampler is 2*zcross input samples
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, oversampler_size, size_t factor, size_t zcross);
+
+/** Initialize the oversampler and clear the state
+ *
+ * @param os the oversampler to initialize
+ * @param buf buffer of at least oversampler_size(factor, zcross) bytes, does not require any alignment
+ * @param factor oversampling factor, should be positive
+ * @param zcross number of zero crossings of the sinc function at each side of filters
+ */
+LSP_DSP_LIB_SYMBOL(void, oversampler_init, LSP_DSP_LIB_TYPE(oversampler_t) *os, void *buf, size_t factor, size_t zcross);
+
+/** Clear the state of the oversampler
+ *
+ * @param os the oversampler
+ */
+LSP_DSP_LIB_SYMBOL(void, oversampler_reset, LSP_DSP_LIB_TYPE(oversampler_t) *os);
+
+/** Process the block of samples of any size
+ *
+ * @param os the oversampler
+ * @param dst destination buffer of count samples, can be the same as source buffer
+ * @param src source buffer of count samples
+ * @param count number of samples to process
+ * @param callback function that processes the oversampled signal, may be NULL
+ * @param arg argument passed to the callback
+ */
+LSP_DSP_LIB_SYMBOL(void, oversampler_process, LSP_DSP_LIB_TYPE(oversampler_t) *os, float *dst, const float *src, size_t count,
+    LSP_DSP_LIB_TYPE(oversampler_callback_t) callback, void *arg);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_OVERSAMPLER_H_ */
@@ -190,6 +190,15 @@ LSP_DSP_LIB_SYMBOL(void, pcomplex_c2r_div2, float *dst, const float *src, size_t
  */
 LSP_DSP_LIB_SYMBOL(void, pcomplex_c2r_rdiv2, float *dst, const float *src, size_t count);
 
+/**
+ * Calculate: dst[i] = dst[i] + src[i].re * k[i]
+ * @param dst destination real number array
+ * @param src source packed complex number array
+ * @param k real multiplier array
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, pcomplex_c2r_fmadd3, float *dst, const float *src, const float *k, size_t count);
+
 /**
  * Calculate: dst[i] = dst[i] + pcomplex{src[i], 0}
  * @param dst destination real number array
@@ -238,6 +247,15 @@ LSP_DSP_LIB_SYMBOL(void, pcomplex_r2c_div2, float *dst, const float *src, size_t
  */
 LSP_DSP_LIB_SYMBOL(void, pcomplex_r2c_rdiv2, float *dst, const float *src, size_t count);
 
+/**
+ * Calculate: dst[i] = pcomplex{src1[i] * src2[i], 0}
+ * @param dst destination packed complex number array
+ * @param src1 source real number array
+ * @param src2 source real number array
+ * @param count number of elements
+ */
+LSP_DSP_LIB_SYMBOL(void, pcomplex_r2c_mul3, float *dst, const float *src1, const float *src2, size_t count);
+
 /** Compute complex correlation between two sources and store to the result array
  *
  * @param dst_corr array to store normalized correlation
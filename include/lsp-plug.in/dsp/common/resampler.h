@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_RESAMPLER_H_
+#define LSP_PLUG_IN_DSP_COMMON_RESAMPLER_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+#pragma pack(push, 1)
+
+/**
+ * Streaming sample rate converter with arbitrary ratio. Each output sample is computed
+ * as the dot product of the input samples and the windowed sinc kernel shifted by the
+ * fractional position of the output sample. The kernel is precomputed for a fixed number
+ * of fractional positions (phases), the kernel for the actual position is linearly
+ * interpolated between two nearest phases.
+ *
+ * The ratio can be changed between calls to follow the drift of the clock. The cutoff
+ * frequency of the kernel is computed once by the initial ratio, so the ratio should
+ * not be lowered much below the initial one when the sample rate is reduced.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of resampler_size(ratio, zcross) bytes to the resampler_init() function and keep
+ * it until the object is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(resampler_t)
+{
+    float      *kernel;     // Kernel table, phases + 1 rows of taps samples
+    float      *hist;       // Input history
+    double      pos;        // Position of the next output sample in the input history
+    double      step;       // Distance between output samples in input samples
+    size_t      taps;       // Number of taps of each phase of the kernel
+    size_t      phases;     // Number of phases of the kernel
+    size_t      fill;       // Number of samples stored in the input history
+} LSP_DSP_LIB_TYPE(resampler_t);
+
+#pragma pack(pop)
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/** Get the size of the buffer required by the sample rate converter
+ *
+ * @param ratio the initial ratio between the output and the input sample rate
+ * @param zcross number of zero crossings of the sinc function at each side of the kernel,
+ *   higher values give steeper transition band at the cost of performance, 16 is a good choice
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, resampler_size, double ratio, size_t zcross);
+
+/** Initialize the sample rate converter and clear the state
+ *
+ * @param rs the sample rate converter to initialize
+ * @param buf buffer of at least resampler_size(ratio, zcross) bytes, does not require any alignment
+ * @param ratio the initial ratio between the output and the input sample rate
+ * @param zcross number of zero crossings of the sinc function at each side of the kernel
+ */
+LSP_DSP_LIB_SYMBOL(void, resampler_init, LSP_DSP_LIB_TYPE(resampler_t) *rs, void *buf, double ratio, size_t zcross);
+
+/** Change the ratio of the sample rate converter without clearing the state.
+ * The position of the next output sample is already known, so the new ratio
+ * affects the distance between the next output sample and the following ones
+ *
+ * @param rs the sample rate converter
+ * @param ratio the ratio between the output and the input sample rate
+ */
+LSP_DSP_LIB_SYMBOL(void, resampler_set_ratio, LSP_DSP_LIB_TYPE(resampler_t) *rs, double ratio);
+
+/** Clear the input history of the sample rate converter
+ *
+ * @param rs the sample rate converter
+ */
+LSP_DSP_LIB_SYMBOL(void, resampler_reset, LSP_DSP_LIB_TYPE(resampler_t) *rs);
+
+/** Process the block of samples of any size. The first output sample corresponds
+ * to the first input sample after initialization or reset.
+ *
+ * @param rs the sample rate converter
+ * @param dst destination buffer of at least count * ratio + 2 samples
+ * @param src source buffer of count samples
+ * @param count number of input samples to process
+ * @return number of samples written to the destination buffer
+ */
+LSP_DSP_LIB_SYMBOL(size_t, resampler_process, LSP_DSP_LIB_TYPE(resampler_t) *rs, float *dst, const float *src, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_RESAMPLER_H_ */
@@ -37,6 +37,27 @@ LSP_DSP_LIB_BEGIN_NAMESPACE
  */
 typedef void (* LSP_DSP_LIB_TYPE(resampling_function_t))(float *dst, const float *src, size_t count);
 
+#pragma pack(push, 1)
+
+/**
+ * Lanczos kernel with arbitrary oversampling times and number of lobes generated
+ * at runtime. The kernel is surrounded by zeros at both sides, this allows SIMD
+ * implementations to process the edges of the kernel without range checks.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of lanczos_kernel_size(times, lobes) bytes to the lanczos_kernel_init() function
+ * and keep it until the kernel is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(lanczos_kernel_t)
+{
+    const float    *data;       // Kernel samples, the value at index i is applied to dst[i]
+    size_t          times;      // Oversampling times, step of the kernel in the destination buffer
+    size_t          lobes;      // Number of lobes of the kernel
+    size_t          length;     // Number of samples in the kernel, 2 * times * lobes
+} LSP_DSP_LIB_TYPE(lanczos_kernel_t);
+
+#pragma pack(pop)
+
 LSP_DSP_LIB_END_NAMESPACE
 
 /**
@@ -358,4 +379,31 @@ LSP_DSP_LIB_SYMBOL(void, downsample_6x, float *dst, const float *src, size_t cou
  */
 LSP_DSP_LIB_SYMBOL(void, downsample_8x, float *dst, const float *src, size_t count);
 
+/** Get the size of the buffer required by the Lanczos kernel
+ *
+ * @param times oversampling times, should be at least 1
+ * @param lobes number of lobes, should be at least 1
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, lanczos_kernel_size, size_t times, size_t lobes);
+
+/** Generate the Lanczos kernel
+ *
+ * @param kernel the kernel to initialize
+ * @param buf buffer of at least lanczos_kernel_size(times, lobes) bytes, does not require any alignment
+ * @param times oversampling times, should be at least 1
+ * @param lobes number of lobes, should be at least 1
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_kernel_init, LSP_DSP_LIB_TYPE(lanczos_kernel_t) *kernel, void *buf, size_t times, size_t lobes);
+
+/** Perform lanczos oversampling with the generated kernel, destination buffer must be cleared
+ * and contain only resampling tail from previous resampling
+ *
+ * @param dst destination buffer of count*times + kernel->length samples
+ * @param src source buffer of count samples
+ * @param kernel the kernel generated by lanczos_kernel_init()
+ * @param count number of samples
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_resample, float *dst, const float *src, const LSP_DSP_LIB_TYPE(lanczos_kernel_t) *kernel, size_t count);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_RESAMPLING_H_ */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_STFT_H_
+#define LSP_PLUG_IN_DSP_COMMON_STFT_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/** Spectrum processing function called by the STFT for each frame
+ *
+ * @param arg user argument passed to stft_process()
+ * @param spectrum packed complex spectrum [re, im, re, im ...] of 2^rank items to modify in place
+ * @param rank the rank of FFT
+ */
+typedef void (* LSP_DSP_LIB_TYPE(stft_callback_t))(void *arg, float *spectrum, size_t rank);
+
+#pragma pack(push, 1)
+
+/**
+ * Short-time Fourier transform: the object that splits the input stream into
+ * overlapping frames of 2^rank samples taken with the step of hop samples,
+ * applies the analysis window, passes the spectrum of each frame to the callback,
+ * and then restores the output stream by applying the synthesis window
+ * and overlap-add of the restored frames. The synthesis window is normalized
+ * so that the output repeats the input if the callback does not modify the spectrum.
+ * The output is delayed by 2^rank samples.
+ *
+ * The object does not allocate any memory: the caller should provide the buffer
+ * of stft_size(rank) bytes to the stft_init() function and keep it until the
+ * object is no longer used.
+ */
+typedef struct LSP_DSP_LIB_TYPE(stft_t)
+{
+    float      *window;     // Analysis window, 2^rank samples
+    float      *synth;      // Synthesis window normalized for overlap-add, 2^rank samples
+    float      *input;      // Input ring buffer, 2^rank samples
+    float      *output;     // Overlap-add ring buffer, 2^rank samples
+    float      *spectrum;   // Packed complex spectrum of the frame, 2^(rank+1) samples
+    size_t      rank;       // Rank of FFT
+    size_t      hop;        // Number of samples between frames
+    size_t      head;       // Position of the oldest sample in ring buffers
+    size_t      offset;     // Number of samples processed since the last frame
+} LSP_DSP_LIB_TYPE(stft_t);
+
+#pragma pack(pop)
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/** Get the size of the buffer required by the STFT
+ *
+ * @param rank the rank of FFT
+ * @return size of the buffer in bytes, including the space for alignment
+ */
+LSP_DSP_LIB_SYMBOL(size_t, stft_size, size_t rank);
+
+/** Initialize the STFT and clear the state
+ *
+ * @param stft the STFT to initialize
+ * @param buf buffer of at least stft_size(rank) bytes, does not require any alignment
+ * @param rank the rank of FFT
+ * @param hop number of samples between frames, should be in range of 1 to 2^rank
+ * @param window analysis window of 2^rank samples, periodic Hann window is used if NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, stft_init, LSP_DSP_LIB_TYPE(stft_t) *stft, void *buf, size_t rank, size_t hop, const float *window);
+
+/** Clear the state of the STFT
+ *
+ * @param stft the STFT
+ */
+LSP_DSP_LIB_SYMBOL(void, stft_reset, LSP_DSP_LIB_TYPE(stft_t) *stft);
+
+/** Process the block of samples of any size
+ *
+ * @param stft the STFT
+ * @param dst destination buffer, can be the same as source buffer
+ * @param src source buffer
+ * @param count number of samples to process
+ * @param callback function that processes the spectrum of each frame, may be NULL
+ * @param arg argument passed to the callback
+ */
+LSP_DSP_LIB_SYMBOL(void, stft_process, LSP_DSP_LIB_TYPE(stft_t) *stft, float *dst, const float *src, size_t count,
+    LSP_DSP_LIB_TYPE(stft_callback_t) callback, void *arg);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_STFT_H_ */
@@ -48,11 +48,13 @@
 #include <lsp-plug.in/dsp/common/complex.h>
 #include <lsp-plug.in/dsp/common/context.h>
 #include <lsp-plug.in/dsp/common/convolution.h>
+#include <lsp-plug.in/dsp/common/convolver.h>
 #include <lsp-plug.in/dsp/common/correlation.h>
 #include <lsp-plug.in/dsp/common/copy.h>
 #include <lsp-plug.in/dsp/common/dynamics.h>
 #include <lsp-plug.in/dsp/common/fastconv.h>
 #include <lsp-plug.in/dsp/common/fft.h>
+#include <lsp-plug.in/dsp/common/fir.h>
 #include <lsp-plug.in/dsp/common/filters.h>
 #include <lsp-plug.in/dsp/common/float.h>
 #include <lsp-plug.in/dsp/common/graphics.h>
@@ -60,11 +62,14 @@
 #include <lsp-plug.in/dsp/common/mix.h>
 #include <lsp-plug.in/dsp/common/pan.h>
 #include <lsp-plug.in/dsp/common/msmatrix.h>
+#include <lsp-plug.in/dsp/common/oversampler.h>
 #include <lsp-plug.in/dsp/common/pcomplex.h>
 #include <lsp-plug.in/dsp/common/pmath.h>
+#include <lsp-plug.in/dsp/common/resampler.h>
 #include <lsp-plug.in/dsp/common/resampling.h>
 #include <lsp-plug.in/dsp/common/search.h>
 #include <lsp-plug.in/dsp/common/smath.h>
+#include <lsp-plug.in/dsp/common/stft.h>
 #include <lsp-plug.in/dsp/common/interpolation.h>
 
 #endif /* LSP_PLUG_IN_DSP_DSP_H_ */
@@ -353,6 +353,183 @@ namespace lsp
             );
         }
 
+        void corr_lags_incr(dsp::lag_correlation_t *corr, float *dst,
+            const float *a_head, const float *b_head,
+            const float *a_tail, const float *b_tail,
+            size_t count)
+        {
+            // The sum(a*a) is the same for all lags
+            float xa        = corr->a;
+            for (size_t i=0; i<count; ++i)
+                xa             += a_head[i]*a_head[i] - a_tail[i]*a_tail[i];
+            corr->a         = xa;
+
+            size_t j        = 0;
+
+            // 8x lag blocks
+            for ( ; (j + 8) <= corr->lags; j += 8)
+            {
+                const float *ah = a_head;
+                const float *at = a_tail;
+                const float *bh = &b_head[j];
+                const float *bt = &b_tail[j];
+                size_t left     = count;
+
+                ARCH_AARCH64_ASM(
+                    __ASM_EMIT("eor         v0.16b, v0.16b, v0.16b")            /* v0   = sum(ah*bh) */
+                    __ASM_EMIT("eor         v1.16b, v1.16b, v1.16b")
+                    __ASM_EMIT("eor         v2.16b, v2.16b, v2.16b")            /* v2   = sum(bh*bh) */
+                    __ASM_EMIT("eor         v3.16b, v3.16b, v3.16b")
+                    __ASM_EMIT("eor         v4.16b, v4.16b, v4.16b")            /* v4   = sum(at*bt) */
+                    __ASM_EMIT("eor         v5.16b, v5.16b, v5.16b")
+                    __ASM_EMIT("eor         v6.16b, v6.16b, v6.16b")            /* v6   = sum(bt*bt) */
+                    __ASM_EMIT("eor         v7.16b, v7.16b, v7.16b")
+                    __ASM_EMIT("cbz         %[count], 2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("ld1r        {v16.4s}, [%[ah]]")                 /* v16  = ah0 */
+                    __ASM_EMIT("ld1r        {v17.4s}, [%[at]]")                 /* v17  = at0 */
+                    __ASM_EMIT("ldp         q18, q19, [%[bh], 0x00]")           /* v18  = bh0, v19 = bh1 */
+                    __ASM_EMIT("ldp         q20, q21, [%[bt], 0x00]")           /* v20  = bt0, v21 = bt1 */
+                    __ASM_EMIT("fmla        v0.4s, v16.4s, v18.4s")             /* v0   = sum(ah*bh) + ah0*bh0 */
+                    __ASM_EMIT("fmla        v1.4s, v16.4s, v19.4s")
+                    __ASM_EMIT("fmla        v2.4s, v18.4s, v18.4s")             /* v2   = sum(bh*bh) + bh0*bh0 */
+                    __ASM_EMIT("fmla        v3.4s, v19.4s, v19.4s")
+                    __ASM_EMIT("fmla        v4.4s, v17.4s, v20.4s")             /* v4   = sum(at*bt) + at0*bt0 */
+                    __ASM_EMIT("fmla        v5.4s, v17.4s, v21.4s")
+                    __ASM_EMIT("fmla        v6.4s, v20.4s, v20.4s")             /* v6   = sum(bt*bt) + bt0*bt0 */
+                    __ASM_EMIT("fmla        v7.4s, v21.4s, v21.4s")
+                    __ASM_EMIT("add         %[ah], %[ah], #0x04")
+                    __ASM_EMIT("add         %[at], %[at], #0x04")
+                    __ASM_EMIT("subs        %[count], %[count], #1")
+                    __ASM_EMIT("add         %[bh], %[bh], #0x04")
+                    __ASM_EMIT("add         %[bt], %[bt], #0x04")
+                    __ASM_EMIT("b.ne        1b")
+                    __ASM_EMIT("2:")
+                    /* Update state */
+                    __ASM_EMIT("fsub        v0.4s, v0.4s, v4.4s")               /* v0   = DV = sum(ah*bh) - sum(at*bt) */
+                    __ASM_EMIT("fsub        v1.4s, v1.4s, v5.4s")
+                    __ASM_EMIT("fsub        v2.4s, v2.4s, v6.4s")               /* v2   = DB = sum(bh*bh) - sum(bt*bt) */
+                    __ASM_EMIT("fsub        v3.4s, v3.4s, v7.4s")
+                    __ASM_EMIT("ldp         q4, q5, [%[v], 0x00]")              /* v4   = v */
+                    __ASM_EMIT("ldp         q6, q7, [%[b], 0x00]")              /* v6   = b */
+                    __ASM_EMIT("fadd        v0.4s, v0.4s, v4.4s")               /* v0   = xv = v + DV */
+                    __ASM_EMIT("fadd        v1.4s, v1.4s, v5.4s")
+                    __ASM_EMIT("fadd        v2.4s, v2.4s, v6.4s")               /* v2   = xb = b + DB */
+                    __ASM_EMIT("fadd        v3.4s, v3.4s, v7.4s")
+                    __ASM_EMIT("stp         q0, q1, [%[v], 0x00]")
+                    __ASM_EMIT("stp         q2, q3, [%[b], 0x00]")
+                    /* Compute normalized correlation */
+                    __ASM_EMIT("ld1r        {v16.4s}, [%[xa]]")                 /* v16  = xa */
+                    __ASM_EMIT("ldr         q17, [%[CORR_CC]]")                 /* v17  = threshold */
+                    __ASM_EMIT("fmul        v2.4s, v2.4s, v16.4s")              /* v2   = B = xa*xb */
+                    __ASM_EMIT("fmul        v3.4s, v3.4s, v16.4s")
+                    __ASM_EMIT("fcmge       v18.4s, v2.4s, v17.4s")             /* v18  = B >= threshold */
+                    __ASM_EMIT("fcmge       v19.4s, v3.4s, v17.4s")
+                    __ASM_EMIT("fsqrt       v2.4s, v2.4s")                      /* v2   = sqrtf(B) */
+                    __ASM_EMIT("fsqrt       v3.4s, v3.4s")
+                    __ASM_EMIT("fdiv        v0.4s, v0.4s, v2.4s")               /* v0   = xv/sqrtf(B) */
+                    __ASM_EMIT("fdiv        v1.4s, v1.4s, v3.4s")
+                    __ASM_EMIT("and         v0.16b, v0.16b, v18.16b")           /* v0   = (B >= threshold) ? xv/sqrtf(B) : 0 */
+                    __ASM_EMIT("and         v1.16b, v1.16b, v19.16b")
+                    __ASM_EMIT("stp         q0, q1, [%[dst], 0x00]")
+
+                    : [ah] "+r" (ah), [at] "+r" (at),
+                      [bh] "+r" (bh), [bt] "+r" (bt),
+                      [count] "+r" (left)
+                    : [v] "r" (&corr->v[j]), [b] "r" (&corr->b[j]),
+                      [dst] "r" (&dst[j]), [xa] "r" (&xa),
+                      [CORR_CC] "r" (&corr_const[0])
+                    : "cc", "memory",
+                      "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7",
+                      "v16", "v17", "v18", "v19", "v20", "v21"
+                );
+            }
+
+            // 4x lag block
+            if ((j + 4) <= corr->lags)
+            {
+                const float *ah = a_head;
+                const float *at = a_tail;
+                const float *bh = &b_head[j];
+                const float *bt = &b_tail[j];
+                size_t left     = count;
+
+                ARCH_AARCH64_ASM(
+                    __ASM_EMIT("eor         v0.16b, v0.16b, v0.16b")            /* v0   = sum(ah*bh) */
+                    __ASM_EMIT("eor         v2.16b, v2.16b, v2.16b")            /* v2   = sum(bh*bh) */
+                    __ASM_EMIT("eor         v4.16b, v4.16b, v4.16b")            /* v4   = sum(at*bt) */
+                    __ASM_EMIT("eor         v6.16b, v6.16b, v6.16b")            /* v6   = sum(bt*bt) */
+                    __ASM_EMIT("cbz         %[count], 2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("ld1r        {v16.4s}, [%[ah]]")                 /* v16  = ah0 */
+                    __ASM_EMIT("ld1r        {v17.4s}, [%[at]]")                 /* v17  = at0 */
+                    __ASM_EMIT("ldr         q18, [%[bh], 0x00]")                /* v18  = bh0 */
+                    __ASM_EMIT("ldr         q20, [%[bt], 0x00]")                /* v20  = bt0 */
+                    __ASM_EMIT("fmla        v0.4s, v16.4s, v18.4s")             /* v0   = sum(ah*bh) + ah0*bh0 */
+                    __ASM_EMIT("fmla        v2.4s, v18.4s, v18.4s")             /* v2   = sum(bh*bh) + bh0*bh0 */
+                    __ASM_EMIT("fmla        v4.4s, v17.4s, v20.4s")             /* v4   = sum(at*bt) + at0*bt0 */
+                    __ASM_EMIT("fmla        v6.4s, v20.4s, v20.4s")             /* v6   = sum(bt*bt) + bt0*bt0 */
+                    __ASM_EMIT("add         %[ah], %[ah], #0x04")
+                    __ASM_EMIT("add         %[at], %[at], #0x04")
+                    __ASM_EMIT("subs        %[count], %[count], #1")
+                    __ASM_EMIT("add         %[bh], %[bh], #0x04")
+                    __ASM_EMIT("add         %[bt], %[bt], #0x04")
+                    __ASM_EMIT("b.ne        1b")
+                    __ASM_EMIT("2:")
+                    /* Update state */
+                    __ASM_EMIT("fsub        v0.4s, v0.4s, v4.4s")               /* v0   = DV = sum(ah*bh) - sum(at*bt) */
+                    __ASM_EMIT("fsub        v2.4s, v2.4s, v6.4s")               /* v2   = DB = sum(bh*bh) - sum(bt*bt) */
+                    __ASM_EMIT("ldr         q4, [%[v], 0x00]")                  /* v4   = v */
+                    __ASM_EMIT("ldr         q6, [%[b], 0x00]")                  /* v6   = b */
+                    __ASM_EMIT("fadd        v0.4s, v0.4s, v4.4s")               /* v0   = xv = v + DV */
+                    __ASM_EMIT("fadd        v2.4s, v2.4s, v6.4s")               /* v2   = xb = b + DB */
+                    __ASM_EMIT("str         q0, [%[v], 0x00]")
+                    __ASM_EMIT("str         q2, [%[b], 0x00]")
+                    /* Compute normalized correlation */
+                    __ASM_EMIT("ld1r        {v16.4s}, [%[xa]]")                 /* v16  = xa */
+                    __ASM_EMIT("ldr         q17, [%[CORR_CC]]")                 /* v17  = threshold */
+                    __ASM_EMIT("fmul        v2.4s, v2.4s, v16.4s")              /* v2   = B = xa*xb */
+                    __ASM_EMIT("fcmge       v18.4s, v2.4s, v17.4s")             /* v18  = B >= threshold */
+                    __ASM_EMIT("fsqrt       v2.4s, v2.4s")                      /* v2   = sqrtf(B) */
+                    __ASM_EMIT("fdiv        v0.4s, v0.4s, v2.4s")               /* v0   = xv/sqrtf(B) */
+                    __ASM_EMIT("and         v0.16b, v0.16b, v18.16b")           /* v0   = (B >= threshold) ? xv/sqrtf(B) : 0 */
+                    __ASM_EMIT("str         q0, [%[dst], 0x00]")
+
+                    : [ah] "+r" (ah), [at] "+r" (at),
+                      [bh] "+r" (bh), [bt] "+r" (bt),
+                      [count] "+r" (left)
+                    : [v] "r" (&corr->v[j]), [b] "r" (&corr->b[j]),
+                      [dst] "r" (&dst[j]), [xa] "r" (&xa),
+                      [CORR_CC] "r" (&corr_const[0])
+                    : "cc", "memory",
+                      "v0", "v2", "v4", "v6",
+                      "v16", "v17", "v18", "v20"
+                );
+
+                j += 4;
+            }
+
+            // Tail lags
+            for ( ; j<corr->lags; ++j)
+            {
+                float xv        = corr->v[j];
+                float xb        = corr->b[j];
+                const float *bh = &b_head[j];
+                const float *bt = &b_tail[j];
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    xv             += a_head[i]*bh[i] - a_tail[i]*bt[i];
+                    xb             += bh[i]*bh[i] - bt[i]*bt[i];
+                }
+
+                float B         = xa * xb;
+                dst[j]          = (B >= 1e-18f) ? xv / sqrtf(B) : 0.0f;
+                corr->v[j]      = xv;
+                corr->b[j]      = xb;
+            }
+        }
+
     } /* namespace asimd */
 } /* namespace lsp */
 
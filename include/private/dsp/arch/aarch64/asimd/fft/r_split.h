@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_FFT_R_SPLIT_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_FFT_R_SPLIT_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        static const float rfft_split_const[] __lsp_aligned16 =
+        {
+            LSP_DSP_VEC4(0.5f)
+        };
+
+        /* Load 4 harmonics from the head and 4 harmonics from the tail of the spectrum */
+        #define RFFT_SPLIT_LOAD(a, b) \
+            __ASM_EMIT("ld2             {v0.4s, v1.4s}, [%[" a "]]")        /* v0   = ar, v1 = ai */ \
+            __ASM_EMIT("ld2             {v2.4s, v3.4s}, [%[" b "]]")        /* v2   = br3 br2 br1 br0, v3 = bi3 bi2 bi1 bi0 */ \
+            __ASM_EMIT("rev64           v2.4s, v2.4s") \
+            __ASM_EMIT("rev64           v3.4s, v3.4s") \
+            __ASM_EMIT("ext             v2.16b, v2.16b, v2.16b, #8")        /* v2   = br */ \
+            __ASM_EMIT("ext             v3.16b, v3.16b, v3.16b, #8")        /* v3   = bi */
+
+        /* Store 4 harmonics to the head and 4 harmonics to the tail of the spectrum */
+        #define RFFT_SPLIT_STORE(a, b) \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v27.4s") \
+            __ASM_EMIT("fmul            v1.4s, v1.4s, v27.4s") \
+            __ASM_EMIT("fmul            v2.4s, v2.4s, v27.4s") \
+            __ASM_EMIT("fmul            v3.4s, v3.4s, v27.4s") \
+            __ASM_EMIT("rev64           v2.4s, v2.4s") \
+            __ASM_EMIT("rev64           v3.4s, v3.4s") \
+            __ASM_EMIT("ext             v2.16b, v2.16b, v2.16b, #8") \
+            __ASM_EMIT("ext             v3.16b, v3.16b, v3.16b, #8") \
+            __ASM_EMIT("st2             {v0.4s, v1.4s}, [%[" a "]]") \
+            __ASM_EMIT("st2             {v2.4s, v3.4s}, [%[" b "]]") \
+            __ASM_EMIT("add             %[" a "], %[" a "], #0x20") \
+            __ASM_EMIT("sub             %[" b "], %[" b "], #0x20")
+
+        /* Rotate twiddle factors and jump to the next iteration */
+        #define RFFT_SPLIT_ROTATE \
+            __ASM_EMIT("subs            %[blocks], %[blocks], #1") \
+            __ASM_EMIT("b.eq            2f") \
+            __ASM_EMIT("fmul            v4.4s, v28.4s, v31.4s")             /* v4   = w_re*dw_im */ \
+            __ASM_EMIT("fmul            v5.4s, v29.4s, v31.4s")             /* v5   = w_im*dw_im */ \
+            __ASM_EMIT("fmul            v28.4s, v28.4s, v30.4s")            /* v28  = w_re*dw_re */ \
+            __ASM_EMIT("fmul            v29.4s, v29.4s, v30.4s")            /* v29  = w_im*dw_re */ \
+            __ASM_EMIT("fsub            v28.4s, v28.4s, v5.4s")             /* v28  = w_re' = w_re*dw_re - w_im*dw_im */ \
+            __ASM_EMIT("fadd            v29.4s, v29.4s, v4.4s")             /* v29  = w_im' = w_im*dw_re + w_re*dw_im */ \
+            __ASM_EMIT("b               1b") \
+            __ASM_EMIT("2:")
+
+        /**
+         * Compute twiddle factors for the split pass from the FFT tables: initial angles
+         * (1..4)*pi/N and the rotation by 4*pi/N, N = 2^(rank-1), rank >= 4
+         */
+        static inline void real_split_twiddle(float *w, size_t rank)
+        {
+            const float *a      = &XFFT_A[(rank - 3) << 4];     // angles (0..7)*pi/N
+            const float *dw     = &XFFT_DW[(rank - 2) << 3];    // rotation by 4*pi/N
+
+            for (size_t i=0; i<4; ++i)
+            {
+                w[i]        = a[i + 1];
+                w[i + 4]    = a[i + 9];
+            }
+            for (size_t i=0; i<8; ++i)
+                w[i + 8]    = dw[i];
+        }
+
+        /**
+         * Split the spectrum of the complex FFT of half size into the spectrum of real FFT,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 4.
+         * X[k] = (Z[k] + Z*[N-k])/2 - j*W^k * (Z[k] - Z*[N-k])/2
+         */
+        static inline void real_split_direct(float *dst, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            float *a        = &dst[2];
+            float *b        = &dst[(items - 4) << 1];
+            float w[16] __lsp_aligned16;
+            real_split_twiddle(w, rank);
+            size_t blocks   = items >> 3;
+
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("ldp             q28, q29, [%[w], #0x00]")           /* v28  = w_re, v29 = w_im */
+                __ASM_EMIT("ldp             q30, q31, [%[w], #0x20]")           /* v30  = dw_re, v31 = dw_im */
+                __ASM_EMIT("ldr             q27, [%[half]]")                    /* v27  = 0.5 */
+                __ASM_EMIT("1:")
+                RFFT_SPLIT_LOAD("a", "b")
+                __ASM_EMIT("fadd            v4.4s, v0.4s, v2.4s")               /* v4   = s = ar + br */
+                __ASM_EMIT("fsub            v5.4s, v1.4s, v3.4s")               /* v5   = d = ai - bi */
+                __ASM_EMIT("fadd            v6.4s, v1.4s, v3.4s")               /* v6   = p = ai + bi */
+                __ASM_EMIT("fsub            v7.4s, v2.4s, v0.4s")               /* v7   = q = br - ar */
+                __ASM_EMIT("fmul            v16.4s, v28.4s, v6.4s")             /* v16  = w_re*p */
+                __ASM_EMIT("fmul            v17.4s, v28.4s, v7.4s")             /* v17  = w_re*q */
+                __ASM_EMIT("fmla            v16.4s, v29.4s, v7.4s")             /* v16  = t_re = w_re*p + w_im*q */
+                __ASM_EMIT("fmls            v17.4s, v29.4s, v6.4s")             /* v17  = t_im = w_re*q - w_im*p */
+                __ASM_EMIT("fadd            v0.4s, v4.4s, v16.4s")              /* v0   = s + t_re */
+                __ASM_EMIT("fadd            v1.4s, v17.4s, v5.4s")              /* v1   = t_im + d */
+                __ASM_EMIT("fsub            v2.4s, v4.4s, v16.4s")              /* v2   = s - t_re */
+                __ASM_EMIT("fsub            v3.4s, v17.4s, v5.4s")              /* v3   = t_im - d */
+                RFFT_SPLIT_STORE("a", "b")
+                RFFT_SPLIT_ROTATE
+                : [a] "+r" (a), [b] "+r" (b),
+                  [blocks] "+r" (blocks)
+                : [w] "r" (w), [half] "r" (&rfft_split_const[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17",
+                  "v27", "v28", "v29", "v30", "v31"
+            );
+        }
+
+        /**
+         * Join the spectrum of real FFT into the spectrum of the complex FFT of half size,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 4.
+         * Z[k] = (X[k] + X*[N-k])/2 + j*W^-k * (X[k] - X*[N-k])/2
+         */
+        static inline void real_split_reverse(float *dst, const float *src, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            const float *sa = &src[2];
+            const float *sb = &src[(items - 4) << 1];
+            float *da       = &dst[2];
+            float *db       = &dst[(items - 4) << 1];
+            float w[16] __lsp_aligned16;
+            real_split_twiddle(w, rank);
+            size_t blocks   = items >> 3;
+
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("ldp             q28, q29, [%[w], #0x00]")           /* v28  = w_re, v29 = w_im */
+                __ASM_EMIT("ldp             q30, q31, [%[w], #0x20]")           /* v30  = dw_re, v31 = dw_im */
+                __ASM_EMIT("ldr             q27, [%[half]]")                    /* v27  = 0.5 */
+                __ASM_EMIT("1:")
+                RFFT_SPLIT_LOAD("sa", "sb")
+                __ASM_EMIT("add             %[sa], %[sa], #0x20")
+                __ASM_EMIT("sub             %[sb], %[sb], #0x20")
+                __ASM_EMIT("fadd            v4.4s, v0.4s, v2.4s")               /* v4   = s = ar + br */
+                __ASM_EMIT("fsub            v5.4s, v1.4s, v3.4s")               /* v5   = d = ai - bi */
+                __ASM_EMIT("fsub            v6.4s, v0.4s, v2.4s")               /* v6   = p = ar - br */
+                __ASM_EMIT("fadd            v7.4s, v1.4s, v3.4s")               /* v7   = q = ai + bi */
+                __ASM_EMIT("fmul            v16.4s, v28.4s, v6.4s")             /* v16  = w_re*p */
+                __ASM_EMIT("fmul            v17.4s, v28.4s, v7.4s")             /* v17  = w_re*q */
+                __ASM_EMIT("fmls            v16.4s, v29.4s, v7.4s")             /* v16  = o_re = w_re*p - w_im*q */
+                __ASM_EMIT("fmla            v17.4s, v29.4s, v6.4s")             /* v17  = o_im = w_re*q + w_im*p */
+                __ASM_EMIT("fsub            v0.4s, v4.4s, v17.4s")              /* v0   = s - o_im */
+                __ASM_EMIT("fadd            v1.4s, v16.4s, v5.4s")              /* v1   = o_re + d */
+                __ASM_EMIT("fadd            v2.4s, v4.4s, v17.4s")              /* v2   = s + o_im */
+                __ASM_EMIT("fsub            v3.4s, v16.4s, v5.4s")              /* v3   = o_re - d */
+                RFFT_SPLIT_STORE("da", "db")
+                RFFT_SPLIT_ROTATE
+                : [sa] "+r" (sa), [sb] "+r" (sb),
+                  [da] "+r" (da), [db] "+r" (db),
+                  [blocks] "+r" (blocks)
+                : [w] "r" (w), [half] "r" (&rfft_split_const[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17",
+                  "v27", "v28", "v29", "v30", "v31"
+            );
+        }
+
+        #undef RFFT_SPLIT_LOAD
+        #undef RFFT_SPLIT_STORE
+        #undef RFFT_SPLIT_ROTATE
+    } /* namespace asimd */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_FFT_R_SPLIT_H_ */
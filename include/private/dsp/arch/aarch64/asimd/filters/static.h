@@ -432,6 +432,215 @@ namespace lsp
                   "v28", "v29"
             );
         }
+
+        /*
+         * Transpose 4x4 matrix stored in registers A, B, C, D.
+         * After the transpose the rows are stored in registers C, A, D, B
+         */
+        #define BIQUAD_MC_TRANSPOSE(A, B, C, D) \
+            __ASM_EMIT("trn1            v30.4s, " A ".4s, " B ".4s")                /* v30  = a0 b0 a2 b2 */ \
+            __ASM_EMIT("trn2            v31.4s, " A ".4s, " B ".4s")                /* v31  = a1 b1 a3 b3 */ \
+            __ASM_EMIT("trn1            " A ".4s, " C ".4s, " D ".4s")              /* A    = c0 d0 c2 d2 */ \
+            __ASM_EMIT("trn2            " B ".4s, " C ".4s, " D ".4s")              /* B    = c1 d1 c3 d3 */ \
+            __ASM_EMIT("trn1            " C ".2d, v30.2d, " A ".2d")                /* C    = a0 b0 c0 d0 */ \
+            __ASM_EMIT("trn2            " D ".2d, v30.2d, " A ".2d")                /* D    = a2 b2 c2 d2 */ \
+            __ASM_EMIT("trn1            " A ".2d, v31.2d, " B ".2d")                /* A    = a1 b1 c1 d1 */ \
+            __ASM_EMIT("trn2            " B ".2d, v31.2d, " B ".2d")                /* B    = a3 b3 c3 d3 */
+
+        /*
+         * Apply four biquad filters to the sample of four channels stored in register X,
+         * D0 and D1 contain the filter memory, B0, B1, B2, A1 and A2 contain the coefficients.
+         * After the processing D0 contains the output sample, D1 contains the updated d0
+         * and X contains the updated d1 memory
+         */
+        #define BIQUAD_MC_FILTER(D0, D1, X, B0, B1, B2, A1, A2) \
+            __ASM_EMIT("fmla            " D0 ".4s, " B0 ".4s, " X ".4s")            /* D0   = s2 = d0 + b0*s */ \
+            __ASM_EMIT("fmla            " D1 ".4s, " B1 ".4s, " X ".4s")            /* D1   = d1 + b1*s */ \
+            __ASM_EMIT("fmul            " X ".4s, " B2 ".4s, " X ".4s")             /* X    = b2*s */ \
+            __ASM_EMIT("fmla            " D1 ".4s, " A1 ".4s, " D0 ".4s")           /* D1   = d0' = d1 + b1*s + a1*s2 */ \
+            __ASM_EMIT("fmla            " X ".4s, " A2 ".4s, " D0 ".4s")            /* X    = d1' = b2*s + a2*s2 */
+
+        #define BIQUAD_MC_FILTER_A(D0, D1, X)   BIQUAD_MC_FILTER(D0, D1, X, "v20", "v21", "v22", "v23", "v24")
+        #define BIQUAD_MC_FILTER_B(D0, D1, X)   BIQUAD_MC_FILTER(D0, D1, X, "v25", "v26", "v27", "v28", "v29")
+
+        #define BIQUAD_MC_LOAD(IDX, Q) \
+            __ASM_EMIT("ldr             %[p], [%[src], #" IDX "]") \
+            __ASM_EMIT("ldr             " Q ", [%[p], %[off]]")
+
+        #define BIQUAD_MC_STORE(IDX, Q) \
+            __ASM_EMIT("ldr             %[p], [%[dst], #" IDX "]") \
+            __ASM_EMIT("str             " Q ", [%[p], %[off]]")
+
+        #define BIQUAD_MC_LOAD1(IDX, V, L) \
+            __ASM_EMIT("ldr             %[p], [%[src], #" IDX "]") \
+            __ASM_EMIT("add             %[p], %[p], %[off]") \
+            __ASM_EMIT("ld1             {" V ".s}[" L "], [%[p]]")
+
+        #define BIQUAD_MC_STORE1(IDX, V, L) \
+            __ASM_EMIT("ldr             %[p], [%[dst], #" IDX "]") \
+            __ASM_EMIT("add             %[p], %[p], %[off]") \
+            __ASM_EMIT("st1             {" V ".s}[" L "], [%[p]]")
+
+        /*
+         * Loop over cascades: the fp register points to the current cascade, the filter
+         * memory and the coefficients of the cascade are loaded before processing the block
+         * of samples
+         */
+        #define BIQUAD_MC_CASCADE_BEGIN(L) \
+            __ASM_EMIT("mov             %[fp], %[f]") \
+            __ASM_EMIT(L ":") \
+            __ASM_EMIT("ldp             q16, q17, [%[fp], #0x00]")                  /* v16-v17  = d0 */ \
+            __ASM_EMIT("ldp             q18, q19, [%[fp], #0x20]")                  /* v18-v19  = d1 */ \
+            __ASM_EMIT("ldp             q20, q25, [%[fp], #0x40]")                  /* v20,v25  = b0 */ \
+            __ASM_EMIT("ldp             q21, q26, [%[fp], #0x60]")                  /* v21,v26  = b1 */ \
+            __ASM_EMIT("ldp             q22, q27, [%[fp], #0x80]")                  /* v22,v27  = b2 */ \
+            __ASM_EMIT("ldp             q23, q28, [%[fp], #0xa0]")                  /* v23,v28  = a1 */ \
+            __ASM_EMIT("ldp             q24, q29, [%[fp], #0xc0]")                  /* v24,v29  = a2 */
+
+        /*
+         * Store the updated filter memory of the cascade: D0A, D0B contain d0,
+         * D1A, D1B contain d1 of channels 0-3 and 4-7
+         */
+        #define BIQUAD_MC_CASCADE_STORE(D0A, D0B, D1A, D1B) \
+            __ASM_EMIT("stp             " D0A ", " D0B ", [%[fp], #0x00]") \
+            __ASM_EMIT("stp             " D1A ", " D1B ", [%[fp], #0x20]")
+
+        #define BIQUAD_MC_CASCADE_END(L) \
+            __ASM_EMIT("add             %[fp], %[fp], #0x100")                      /* fp       = next cascade */ \
+            __ASM_EMIT("cmp             %[fp], %[fe]") \
+            __ASM_EMIT("b.lo            " L "b")
+
+        void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc)
+        {
+            if (nc <= 0)
+                return;
+
+            IF_ARCH_AARCH64(
+                const dsp::biquad_t *fe = &f[nc];
+                dsp::biquad_t *fp;
+                size_t off;
+                const float *p;
+            );
+
+            /* Register allocation:
+             * v0-v3    - samples of channels 0-3
+             * v4-v7    - samples of channels 4-7
+             * v16-v17  - d0
+             * v18-v19  - d1
+             * v20-v24  - b0, b1, b2, a1, a2 for channels 0-3
+             * v25-v29  - b0, b1, b2, a1, a2 for channels 4-7
+             * v30-v31  - temporary
+             */
+
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("mov             %[off], #0")
+
+                // 4x blocks: transpose samples, process by all cascades and transpose back
+                __ASM_EMIT("subs            %[count], %[count], #4")
+                __ASM_EMIT("b.lo            2f")
+                __ASM_EMIT("1:")
+                BIQUAD_MC_LOAD("0x00", "q0")
+                BIQUAD_MC_LOAD("0x08", "q1")
+                BIQUAD_MC_LOAD("0x10", "q2")
+                BIQUAD_MC_LOAD("0x18", "q3")
+                BIQUAD_MC_LOAD("0x20", "q4")
+                BIQUAD_MC_LOAD("0x28", "q5")
+                BIQUAD_MC_LOAD("0x30", "q6")
+                BIQUAD_MC_LOAD("0x38", "q7")
+                BIQUAD_MC_TRANSPOSE("v0", "v1", "v2", "v3")                             // v2, v0, v3, v1 = samples 0..3 of channels 0-3
+                BIQUAD_MC_TRANSPOSE("v4", "v5", "v6", "v7")                             // v6, v4, v7, v5 = samples 0..3 of channels 4-7
+                BIQUAD_MC_CASCADE_BEGIN("5")
+                BIQUAD_MC_FILTER_A("v16", "v18", "v2")                                  // v16      = s2[0], v18 = d0, v2 = d1
+                BIQUAD_MC_FILTER_B("v17", "v19", "v6")
+                BIQUAD_MC_FILTER_A("v18", "v2", "v0")                                   // v18      = s2[1], v2 = d0, v0 = d1
+                BIQUAD_MC_FILTER_B("v19", "v6", "v4")
+                BIQUAD_MC_FILTER_A("v2", "v0", "v3")                                    // v2       = s2[2], v0 = d0, v3 = d1
+                BIQUAD_MC_FILTER_B("v6", "v4", "v7")
+                BIQUAD_MC_FILTER_A("v0", "v3", "v1")                                    // v0       = s2[3], v3 = d0, v1 = d1
+                BIQUAD_MC_FILTER_B("v4", "v7", "v5")
+                BIQUAD_MC_CASCADE_STORE("q3", "q7", "q1", "q5")
+                __ASM_EMIT("mov             v3.16b, v2.16b")                            // v3, v7   = s2[2]
+                __ASM_EMIT("mov             v7.16b, v6.16b")
+                __ASM_EMIT("mov             v1.16b, v0.16b")                            // v1, v5   = s2[3]
+                __ASM_EMIT("mov             v5.16b, v4.16b")
+                __ASM_EMIT("mov             v2.16b, v16.16b")                           // v2, v6   = s2[0]
+                __ASM_EMIT("mov             v6.16b, v17.16b")
+                __ASM_EMIT("mov             v0.16b, v18.16b")                           // v0, v4   = s2[1]
+                __ASM_EMIT("mov             v4.16b, v19.16b")
+                BIQUAD_MC_CASCADE_END("5")
+                BIQUAD_MC_TRANSPOSE("v2", "v0", "v3", "v1")                             // v3, v2, v1, v0 = channels 0-3
+                BIQUAD_MC_TRANSPOSE("v6", "v4", "v7", "v5")                             // v7, v6, v5, v4 = channels 4-7
+                BIQUAD_MC_STORE("0x00", "q3")
+                BIQUAD_MC_STORE("0x08", "q2")
+                BIQUAD_MC_STORE("0x10", "q1")
+                BIQUAD_MC_STORE("0x18", "q0")
+                BIQUAD_MC_STORE("0x20", "q7")
+                BIQUAD_MC_STORE("0x28", "q6")
+                BIQUAD_MC_STORE("0x30", "q5")
+                BIQUAD_MC_STORE("0x38", "q4")
+                __ASM_EMIT("add             %[off], %[off], #0x10")
+                __ASM_EMIT("subs            %[count], %[count], #4")
+                __ASM_EMIT("b.hs            1b")
+
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[count], %[count], #4")
+                __ASM_EMIT("b.eq            4f")
+                __ASM_EMIT("3:")
+                BIQUAD_MC_LOAD1("0x00", "v0", "0")
+                BIQUAD_MC_LOAD1("0x08", "v0", "1")
+                BIQUAD_MC_LOAD1("0x10", "v0", "2")
+                BIQUAD_MC_LOAD1("0x18", "v0", "3")                                      // v0       = s of channels 0-3
+                BIQUAD_MC_LOAD1("0x20", "v1", "0")
+                BIQUAD_MC_LOAD1("0x28", "v1", "1")
+                BIQUAD_MC_LOAD1("0x30", "v1", "2")
+                BIQUAD_MC_LOAD1("0x38", "v1", "3")                                      // v1       = s of channels 4-7
+                BIQUAD_MC_CASCADE_BEGIN("6")
+                BIQUAD_MC_FILTER_A("v16", "v18", "v0")                                  // v16      = s2, v18 = d0, v0 = d1
+                BIQUAD_MC_FILTER_B("v17", "v19", "v1")
+                BIQUAD_MC_CASCADE_STORE("q18", "q19", "q0", "q1")
+                __ASM_EMIT("mov             v0.16b, v16.16b")                           // v0, v1   = s2
+                __ASM_EMIT("mov             v1.16b, v17.16b")
+                BIQUAD_MC_CASCADE_END("6")
+                BIQUAD_MC_STORE1("0x00", "v0", "0")
+                BIQUAD_MC_STORE1("0x08", "v0", "1")
+                BIQUAD_MC_STORE1("0x10", "v0", "2")
+                BIQUAD_MC_STORE1("0x18", "v0", "3")
+                BIQUAD_MC_STORE1("0x20", "v1", "0")
+                BIQUAD_MC_STORE1("0x28", "v1", "1")
+                BIQUAD_MC_STORE1("0x30", "v1", "2")
+                BIQUAD_MC_STORE1("0x38", "v1", "3")
+                __ASM_EMIT("add             %[off], %[off], #0x04")
+                __ASM_EMIT("subs            %[count], %[count], #1")
+                __ASM_EMIT("b.ne            3b")
+                __ASM_EMIT("4:")
+
+                : [count] "+r" (count),
+                  [off] "=&r" (off), [p] "=&r" (p), [fp] "=&r" (fp)
+                : [dst] "r" (dst), [src] "r" (src),
+                  [f] "r" (f), [fe] "r" (fe)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22", "v23",
+                  "v24", "v25", "v26", "v27",
+                  "v28", "v29", "v30", "v31"
+            );
+        }
+
+        #undef BIQUAD_MC_CASCADE_END
+        #undef BIQUAD_MC_CASCADE_STORE
+        #undef BIQUAD_MC_CASCADE_BEGIN
+        #undef BIQUAD_MC_STORE1
+        #undef BIQUAD_MC_LOAD1
+        #undef BIQUAD_MC_STORE
+        #undef BIQUAD_MC_LOAD
+        #undef BIQUAD_MC_FILTER_B
+        #undef BIQUAD_MC_FILTER_A
+        #undef BIQUAD_MC_FILTER
+        #undef BIQUAD_MC_TRANSPOSE
     }
 }
 
@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_FILTERS_SVF_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_FILTERS_SVF_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace lsp
+{
+    namespace asimd
+    {
+        /*
+         * Transpose 4x4 matrix stored in registers A, B, C, D.
+         * After the transpose the rows are stored in registers C, A, D, B
+         */
+        #define SVF_MC_TRANSPOSE(A, B, C, D) \
+            __ASM_EMIT("trn1            v30.4s, " A ".4s, " B ".4s")                /* v30  = a0 b0 a2 b2 */ \
+            __ASM_EMIT("trn2            v31.4s, " A ".4s, " B ".4s")                /* v31  = a1 b1 a3 b3 */ \
+            __ASM_EMIT("trn1            " A ".4s, " C ".4s, " D ".4s")              /* A    = c0 d0 c2 d2 */ \
+            __ASM_EMIT("trn2            " B ".4s, " C ".4s, " D ".4s")              /* B    = c1 d1 c3 d3 */ \
+            __ASM_EMIT("trn1            " C ".2d, v30.2d, " A ".2d")                /* C    = a0 b0 c0 d0 */ \
+            __ASM_EMIT("trn2            " D ".2d, v30.2d, " A ".2d")                /* D    = a2 b2 c2 d2 */ \
+            __ASM_EMIT("trn1            " A ".2d, v31.2d, " B ".2d")                /* A    = a1 b1 c1 d1 */ \
+            __ASM_EMIT("trn2            " B ".2d, v31.2d, " B ".2d")                /* B    = a3 b3 c3 d3 */
+
+        /*
+         * Apply four state-variable filters to the sample of four channels stored in register X,
+         * IC1 and IC2 contain the filter memory, G, K, M0, M1 and M2 contain the coefficients,
+         * v30 and v31 are used as temporary
+         */
+        #define SVF_MC_FILTER(X, IC1, IC2, G, K, M0, M1, M2) \
+            __ASM_EMIT("fadd            v30.4s, " G ".4s, " K ".4s")                /* v30  = g + k */ \
+            __ASM_EMIT("fmov            v31.4s, #1.0")                              /* v31  = 1 */ \
+            __ASM_EMIT("fmla            v31.4s, v30.4s, " G ".4s")                  /* v31  = 1 + g*(g + k) */ \
+            __ASM_EMIT("fsub            v30.4s, " X ".4s, " IC2 ".4s")              /* v30  = x - ic2 */ \
+            __ASM_EMIT("fmul            v30.4s, v30.4s, " G ".4s")                  /* v30  = g*(x - ic2) */ \
+            __ASM_EMIT("fadd            v30.4s, v30.4s, " IC1 ".4s")                /* v30  = ic1 + g*(x - ic2) */ \
+            __ASM_EMIT("fdiv            v30.4s, v30.4s, v31.4s")                    /* v30  = v1 = (ic1 + g*(x - ic2)) / (1 + g*(g + k)) */ \
+            __ASM_EMIT("fmul            " X ".4s, " X ".4s, " M0 ".4s")             /* X    = m0*x */ \
+            __ASM_EMIT("fmla            " X ".4s, v30.4s, " M1 ".4s")               /* X    = m0*x + m1*v1 */ \
+            __ASM_EMIT("fadd            v31.4s, v30.4s, v30.4s")                    /* v31  = 2*v1 */ \
+            __ASM_EMIT("fsub            " IC1 ".4s, v31.4s, " IC1 ".4s")            /* IC1  = ic1' = 2*v1 - ic1 */ \
+            __ASM_EMIT("mov             v31.16b, " IC2 ".16b")                      /* v31  = ic2 */ \
+            __ASM_EMIT("fmla            v31.4s, v30.4s, " G ".4s")                  /* v31  = v2 = ic2 + g*v1 */ \
+            __ASM_EMIT("fmla            " X ".4s, v31.4s, " M2 ".4s")               /* X    = y = m0*x + m1*v1 + m2*v2 */ \
+            __ASM_EMIT("fadd            v30.4s, v31.4s, v31.4s")                    /* v30  = 2*v2 */ \
+            __ASM_EMIT("fsub            " IC2 ".4s, v30.4s, " IC2 ".4s")            /* IC2  = ic2' = 2*v2 - ic2 */
+
+        #define SVF_MC_FILTER_A(X)      SVF_MC_FILTER(X, "v16", "v18", "v20", "v21", "v22", "v23", "v24")
+        #define SVF_MC_FILTER_B(X)      SVF_MC_FILTER(X, "v17", "v19", "v25", "v26", "v27", "v28", "v29")
+
+        /* Load coefficients of the x4 filter bank for the next sample */
+        #define SVF_MC_COEFF_X4 \
+            __ASM_EMIT("ldp             q20, q21, [%[f], #0x00]")                   /* v20  = g, v21 = k */ \
+            __ASM_EMIT("ldp             q22, q23, [%[f], #0x20]")                   /* v22  = m0, v23 = m1 */ \
+            __ASM_EMIT("ldr             q24, [%[f], #0x40]")                        /* v24  = m2 */ \
+            __ASM_EMIT("add             %[f], %[f], #0x50")
+
+        /* Load coefficients of the x8 filter bank for the next sample */
+        #define SVF_MC_COEFF_X8 \
+            __ASM_EMIT("ldp             q20, q25, [%[f], #0x00]")                   /* v20,v25  = g */ \
+            __ASM_EMIT("ldp             q21, q26, [%[f], #0x20]")                   /* v21,v26  = k */ \
+            __ASM_EMIT("ldp             q22, q27, [%[f], #0x40]")                   /* v22,v27  = m0 */ \
+            __ASM_EMIT("ldp             q23, q28, [%[f], #0x60]")                   /* v23,v28  = m1 */ \
+            __ASM_EMIT("ldp             q24, q29, [%[f], #0x80]")                   /* v24,v29  = m2 */ \
+            __ASM_EMIT("add             %[f], %[f], #0xa0")
+
+        #define SVF_MC_LOAD(IDX, Q) \
+            __ASM_EMIT("ldr             %[p], [%[src], #" IDX "]") \
+            __ASM_EMIT("ldr             " Q ", [%[p], %[off]]")
+
+        #define SVF_MC_STORE(IDX, Q) \
+            __ASM_EMIT("ldr             %[p], [%[dst], #" IDX "]") \
+            __ASM_EMIT("str             " Q ", [%[p], %[off]]")
+
+        #define SVF_MC_LOAD1(IDX, V, L) \
+            __ASM_EMIT("ldr             %[p], [%[src], #" IDX "]") \
+            __ASM_EMIT("add             %[p], %[p], %[off]") \
+            __ASM_EMIT("ld1             {" V ".s}[" L "], [%[p]]")
+
+        #define SVF_MC_STORE1(IDX, V, L) \
+            __ASM_EMIT("ldr             %[p], [%[dst], #" IDX "]") \
+            __ASM_EMIT("add             %[p], %[p], %[off]") \
+            __ASM_EMIT("st1             {" V ".s}[" L "], [%[p]]")
+
+        void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f)
+        {
+            IF_ARCH_AARCH64(
+                size_t off;
+                const float *p;
+            );
+
+            /* Register allocation:
+             * v0-v3    - samples of channels 0-3
+             * v16      - ic1
+             * v18      - ic2
+             * v20-v24  - g, k, m0, m1, m2 for channels 0-3
+             * v30-v31  - temporary
+             */
+
+            ARCH_AARCH64_ASM
+            (
+                // Prepare
+                __ASM_EMIT("ldp             q16, q18, [%[d]]")                          // v16      = ic1, v18 = ic2
+                __ASM_EMIT("mov             %[off], #0")
+
+                // 4x blocks: transpose samples, process and transpose back
+                __ASM_EMIT("subs            %[count], %[count], #4")
+                __ASM_EMIT("b.lo            2f")
+                __ASM_EMIT("1:")
+                SVF_MC_LOAD("0x00", "q0")
+                SVF_MC_LOAD("0x08", "q1")
+                SVF_MC_LOAD("0x10", "q2")
+                SVF_MC_LOAD("0x18", "q3")
+                SVF_MC_TRANSPOSE("v0", "v1", "v2", "v3")                                // v2, v0, v3, v1 = samples 0..3 of channels 0-3
+                SVF_MC_COEFF_X4
+                SVF_MC_FILTER_A("v2")
+                SVF_MC_COEFF_X4
+                SVF_MC_FILTER_A("v0")
+                SVF_MC_COEFF_X4
+                SVF_MC_FILTER_A("v3")
+                SVF_MC_COEFF_X4
+                SVF_MC_FILTER_A("v1")
+                SVF_MC_TRANSPOSE("v2", "v0", "v3", "v1")                                // v3, v2, v1, v0 = channels 0-3
+                SVF_MC_STORE("0x00", "q3")
+                SVF_MC_STORE("0x08", "q2")
+                SVF_MC_STORE("0x10", "q1")
+                SVF_MC_STORE("0x18", "q0")
+                __ASM_EMIT("add             %[off], %[off], #0x10")
+                __ASM_EMIT("subs            %[count], %[count], #4")
+                __ASM_EMIT("b.hs            1b")
+
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[count], %[count], #4")
+                __ASM_EMIT("b.eq            4f")
+                __ASM_EMIT("3:")
+                SVF_MC_LOAD1("0x00", "v0", "0")
+                SVF_MC_LOAD1("0x08", "v0", "1")
+                SVF_MC_LOAD1("0x10", "v0", "2")
+                SVF_MC_LOAD1("0x18", "v0", "3")                                         // v0       = x of channels 0-3
+                SVF_MC_COEFF_X4
+                SVF_MC_FILTER_A("v0")
+                SVF_MC_STORE1("0x00", "v0", "0")
+                SVF_MC_STORE1("0x08", "v0", "1")
+                SVF_MC_STORE1("0x10", "v0", "2")
+                SVF_MC_STORE1("0x18", "v0", "3")
+                __ASM_EMIT("add             %[off], %[off], #0x04")
+                __ASM_EMIT("subs            %[count], %[count], #1")
+                __ASM_EMIT("b.ne            3b")
+
+                // Store memory
+                __ASM_EMIT("4:")
+                __ASM_EMIT("stp             q16, q18, [%[d]]")                          // v16      = ic1, v18 = ic2
+
+                : [count] "+r" (count), [f] "+r" (f),
+                  [off] "=&r" (off), [p] "=&r" (p)
+                : [dst] "r" (dst), [src] "r" (src),
+                  [d] "r" (d)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v16", "v18",
+                  "v20", "v21", "v22", "v23",
+                  "v24", "v30", "v31"
+            );
+        }
+
+        void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f)
+        {
+            IF_ARCH_AARCH64(
+                size_t off;
+                const float *p;
+            );
+
+            /* Register allocation:
+             * v0-v3    - samples of channels 0-3
+             * v4-v7    - samples of channels 4-7
+             * v16-v17  - ic1
+             * v18-v19  - ic2
+             * v20-v24  - g, k, m0, m1, m2 for channels 0-3
+             * v25-v29  - g, k, m0, m1, m2 for channels 4-7
+             * v30-v31  - temporary
+             */
+
+            ARCH_AARCH64_ASM
+            (
+                // Prepare
+                __ASM_EMIT("ldp             q16, q17, [%[d], #0x00]")                   // v16-v17  = ic1
+                __ASM_EMIT("ldp             q18, q19, [%[d], #0x20]")                   // v18-v19  = ic2
+                __ASM_EMIT("mov             %[off], #0")
+
+                // 4x blocks: transpose samples, process and transpose back
+                __ASM_EMIT("subs            %[count], %[count], #4")
+                __ASM_EMIT("b.lo            2f")
+                __ASM_EMIT("1:")
+                SVF_MC_LOAD("0x00", "q0")
+                SVF_MC_LOAD("0x08", "q1")
+                SVF_MC_LOAD("0x10", "q2")
+                SVF_MC_LOAD("0x18", "q3")
+                SVF_MC_LOAD("0x20", "q4")
+                SVF_MC_LOAD("0x28", "q5")
+                SVF_MC_LOAD("0x30", "q6")
+                SVF_MC_LOAD("0x38", "q7")
+                SVF_MC_TRANSPOSE("v0", "v1", "v2", "v3")                                // v2, v0, v3, v1 = samples 0..3 of channels 0-3
+                SVF_MC_TRANSPOSE("v4", "v5", "v6", "v7")                                // v6, v4, v7, v5 = samples 0..3 of channels 4-7
+                SVF_MC_COEFF_X8
+                SVF_MC_FILTER_A("v2")
+                SVF_MC_FILTER_B("v6")
+                SVF_MC_COEFF_X8
+                SVF_MC_FILTER_A("v0")
+                SVF_MC_FILTER_B("v4")
+                SVF_MC_COEFF_X8
+                SVF_MC_FILTER_A("v3")
+                SVF_MC_FILTER_B("v7")
+                SVF_MC_COEFF_X8
+                SVF_MC_FILTER_A("v1")
+                SVF_MC_FILTER_B("v5")
+                SVF_MC_TRANSPOSE("v2", "v0", "v3", "v1")                                // v3, v2, v1, v0 = channels 0-3
+                SVF_MC_TRANSPOSE("v6", "v4", "v7", "v5")                                // v7, v6, v5, v4 = channels 4-7
+                SVF_MC_STORE("0x00", "q3")
+                SVF_MC_STORE("0x08", "q2")
+                SVF_MC_STORE("0x10", "q1")
+                SVF_MC_STORE("0x18", "q0")
+                SVF_MC_STORE("0x20", "q7")
+                SVF_MC_STORE("0x28", "q6")
+                SVF_MC_STORE("0x30", "q5")
+                SVF_MC_STORE("0x38", "q4")
+                __ASM_EMIT("add             %[off], %[off], #0x10")
+                __ASM_EMIT("subs            %[count], %[count], #4")
+                __ASM_EMIT("b.hs            1b")
+
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[count], %[count], #4")
+                __ASM_EMIT("b.eq            4f")
+                __ASM_EMIT("3:")
+                SVF_MC_LOAD1("0x00", "v0", "0")
+                SVF_MC_LOAD1("0x08", "v0", "1")
+                SVF_MC_LOAD1("0x10", "v0", "2")
+                SVF_MC_LOAD1("0x18", "v0", "3")                                         // v0       = x of channels 0-3
+                SVF_MC_LOAD1("0x20", "v1", "0")
+                SVF_MC_LOAD1("0x28", "v1", "1")
+                SVF_MC_LOAD1("0x30", "v1", "2")
+                SVF_MC_LOAD1("0x38", "v1", "3")                                         // v1       = x of channels 4-7
+                SVF_MC_COEFF_X8
+                SVF_MC_FILTER_A("v0")
+                SVF_MC_FILTER_B("v1")
+                SVF_MC_STORE1("0x00", "v0", "0")
+                SVF_MC_STORE1("0x08", "v0", "1")
+                SVF_MC_STORE1("0x10", "v0", "2")
+                SVF_MC_STORE1("0x18", "v0", "3")
+                SVF_MC_STORE1("0x20", "v1", "0")
+                SVF_MC_STORE1("0x28", "v1", "1")
+                SVF_MC_STORE1("0x30", "v1", "2")
+                SVF_MC_STORE1("0x38", "v1", "3")
+                __ASM_EMIT("add             %[off], %[off], #0x04")
+                __ASM_EMIT("subs            %[count], %[count], #1")
+                __ASM_EMIT("b.ne            3b")
+
+                // Store memory
+                __ASM_EMIT("4:")
+                __ASM_EMIT("stp             q16, q17, [%[d], #0x00]")                   // v16-v17  = ic1
+                __ASM_EMIT("stp             q18, q19, [%[d], #0x20]")                   // v18-v19  = ic2
+
+                : [count] "+r" (count), [f] "+r" (f),
+                  [off] "=&r" (off), [p] "=&r" (p)
+                : [dst] "r" (dst), [src] "r" (src),
+                  [d] "r" (d)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22", "v23",
+                  "v24", "v25", "v26", "v27",
+                  "v28", "v29", "v30", "v31"
+            );
+        }
+
+        #undef SVF_MC_STORE1
+        #undef SVF_MC_LOAD1
+        #undef SVF_MC_STORE
+        #undef SVF_MC_LOAD
+        #undef SVF_MC_COEFF_X8
+        #undef SVF_MC_COEFF_X4
+        #undef SVF_MC_FILTER_B
+        #undef SVF_MC_FILTER_A
+        #undef SVF_MC_FILTER
+        #undef SVF_MC_TRANSPOSE
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_FILTERS_SVF_H_ */
@@ -26,6 +26,10 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
 
+#include <private/dsp/arch/aarch64/asimd/pmath/exp.h>
+
+#define MATCHED_BATCH           64          /* Number of second-order polynoms solved at once */
+
 namespace lsp
 {
     namespace asimd
@@ -566,7 +570,628 @@ namespace lsp
                   "v28", "v29", "v30", "v31"
             );
         }
+
+        IF_ARCH_AARCH64(
+            static const uint32_t MATCHED_CONST[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0x3c23d70a),   // 0.01
+                LSP_DSP_VEC4(0x3dcccccd),   // 0.1
+                LSP_DSP_VEC4(0x40800000),   // 4.0
+                LSP_DSP_VEC4(0x3e22f983),   // 1/(2*PI)
+                LSP_DSP_VEC4(0x3f000000),   // 0.5
+                LSP_DSP_VEC4(0x40c90fdb),   // 2*PI
+                LSP_DSP_VEC4(0x3fc90fdb),   // PI/2
+                LSP_DSP_VEC4(0xb2d7322b),   // -1/11!
+                LSP_DSP_VEC4(0x3638ef1d),   // 1/9!
+                LSP_DSP_VEC4(0xb9500d01),   // -1/7!
+                LSP_DSP_VEC4(0x3c088889),   // 1/5!
+                LSP_DSP_VEC4(0xbe2aaaab),   // -1/3!
+                LSP_DSP_VEC4(0x3f800000),   // 1.0
+                LSP_DSP_VEC4(0x3ea2f983),   // 1/PI
+                LSP_DSP_VEC4(0x40490fdb),   // PI
+                LSP_DSP_VEC4(0x39500d01),   // 1/7!
+                LSP_DSP_VEC4(0x3ab60b61),   // 1/6!
+                LSP_DSP_VEC4(0x3c088889),   // 1/5!
+                LSP_DSP_VEC4(0x3d2aaaab),   // 1/4!
+                LSP_DSP_VEC4(0x3e2aaaab)    // 1/3!
+            };
+        )
+
+        typedef struct matched_ctx_t
+        {
+            float           w[8] __lsp_aligned16;   // td*kf/2, td*kf/20, 4 copies each
+            float          *vp[MATCHED_BATCH + 3];  // Batch of second-order polynoms
+            size_t          n;                      // Number of polynoms in the batch
+        } matched_ctx_t;
+
+        /*
+         * Compute v0 = sqrt(Q) = sqrt(expm1(X)^2 + 4*E*sin(Y)^2) for E = exp(X),
+         * v2, v4, v6, v8, v10, v11 are clobbered. The expm1(X) is computed by the Taylor series
+         * for abs(X) < 0.5 to keep the precision when exp(X) is close to 1
+         */
+        #define MATCHED_AMP_X4(X, E, Y) \
+            __ASM_EMIT("ldp             q8, q10, [%[MC], #0xf0]")       /* v8   = 1/7!, v10 = 1/6! */ \
+            __ASM_EMIT("fmul            v4.4s, " X ".4s, v8.4s")        /* v4   = x/7! */ \
+            __ASM_EMIT("fadd            v4.4s, v4.4s, v10.4s")          /* v4   = 1/6! + x/7! */ \
+            __ASM_EMIT("ldp             q8, q10, [%[MC], #0x110]")      /* v8   = 1/5!, v10 = 1/4! */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, " X ".4s") \
+            __ASM_EMIT("fadd            v4.4s, v4.4s, v8.4s")           /* v4   = 1/5! + x*(...) */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, " X ".4s") \
+            __ASM_EMIT("fadd            v4.4s, v4.4s, v10.4s")          /* v4   = 1/4! + x*(...) */ \
+            __ASM_EMIT("ldr             q8, [%[MC], #0x130]")           /* v8   = 1/3! */ \
+            __ASM_EMIT("ldr             q10, [%[MC], #0x40]")           /* v10  = 0.5 */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, " X ".4s") \
+            __ASM_EMIT("fadd            v4.4s, v4.4s, v8.4s")           /* v4   = 1/3! + x*(...) */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, " X ".4s") \
+            __ASM_EMIT("fadd            v4.4s, v4.4s, v10.4s")          /* v4   = 1/2! + x*(...) */ \
+            __ASM_EMIT("fmov            v8.4s, #1.0")                   /* v8   = 1 */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, " X ".4s") \
+            __ASM_EMIT("fadd            v4.4s, v4.4s, v8.4s")           /* v4   = 1 + x*(...) */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, " X ".4s")        /* v4   = x*(1 + x*(...)) */ \
+            __ASM_EMIT("fabs            v2.4s, " X ".4s")               /* v2   = abs(x) */ \
+            __ASM_EMIT("fsub            v6.4s, " E ".4s, v8.4s")        /* v6   = exp(x) - 1 */ \
+            __ASM_EMIT("fcmgt           v2.4s, v10.4s, v2.4s")          /* v2   = [abs(x) < 0.5] */ \
+            __ASM_EMIT("bif             v4.16b, v6.16b, v2.16b")        /* v4   = M = expm1(x) */ \
+            __ASM_EMIT("fmul            v4.4s, v4.4s, v4.4s")           /* v4   = M*M */ \
+            /* sin(y)^2 = sin(y - PI*n)^2 */ \
+            __ASM_EMIT("ldp             q8, q11, [%[MC], #0xd0]")       /* v8   = 1/PI, v11 = PI */ \
+            __ASM_EMIT("fabs            v6.4s, " Y ".4s")               /* v6   = abs(y) */ \
+            __ASM_EMIT("fmul            v0.4s, v6.4s, v8.4s")           /* v0   = abs(y)/PI */ \
+            __ASM_EMIT("fadd            v0.4s, v0.4s, v10.4s")          /* v0   = abs(y)/PI + 0.5 */ \
+            __ASM_EMIT("fcvtzs          v0.4s, v0.4s") \
+            __ASM_EMIT("scvtf           v0.4s, v0.4s")                  /* v0   = n = int(abs(y)/PI + 0.5) */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v11.4s")          /* v0   = PI*n */ \
+            __ASM_EMIT("fsub            v0.4s, v6.4s, v0.4s")           /* v0   = abs(y) - PI*n */ \
+            __ASM_EMIT("fmul            v2.4s, v0.4s, v0.4s")           /* v2   = y2 = y*y */ \
+            __ASM_EMIT("ldp             q8, q10, [%[MC], #0x70]")       /* v8   = S5, v10 = S4 */ \
+            __ASM_EMIT("fmul            v6.4s, v2.4s, v8.4s")           /* v6   = S5*y2 */ \
+            __ASM_EMIT("fadd            v6.4s, v6.4s, v10.4s")          /* v6   = S4 + S5*y2 */ \
+            __ASM_EMIT("ldp             q8, q10, [%[MC], #0x90]")       /* v8   = S3, v10 = S2 */ \
+            __ASM_EMIT("fmul            v6.4s, v6.4s, v2.4s") \
+            __ASM_EMIT("fadd            v6.4s, v6.4s, v8.4s")           /* v6   = S3 + y2*(S4 + S5*y2) */ \
+            __ASM_EMIT("fmul            v6.4s, v6.4s, v2.4s") \
+            __ASM_EMIT("fadd            v6.4s, v6.4s, v10.4s")          /* v6   = S2 + y2*(S3 + y2*(S4 + S5*y2)) */ \
+            __ASM_EMIT("ldp             q8, q10, [%[MC], #0xb0]")       /* v8   = S1, v10 = 1.0 */ \
+            __ASM_EMIT("fmul            v6.4s, v6.4s, v2.4s") \
+            __ASM_EMIT("fadd            v6.4s, v6.4s, v8.4s")           /* v6   = S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2))) */ \
+            __ASM_EMIT("fmul            v6.4s, v6.4s, v2.4s") \
+            __ASM_EMIT("fadd            v6.4s, v6.4s, v10.4s")          /* v6   = 1 + y2*(S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2)))) */ \
+            __ASM_EMIT("fmul            v6.4s, v6.4s, v0.4s")           /* v6   = sin(y) */ \
+            __ASM_EMIT("ldr             q8, [%[MC], #0x20]")            /* v8   = 4.0 */ \
+            __ASM_EMIT("fmul            v6.4s, v6.4s, v6.4s")           /* v6   = sin(y)^2 */ \
+            __ASM_EMIT("fmul            v2.4s, " E ".4s, v8.4s")        /* v2   = 4*exp(x) */ \
+            __ASM_EMIT("fmul            v6.4s, v6.4s, v2.4s")           /* v6   = 4*exp(x)*sin(y)^2 */ \
+            __ASM_EMIT("fadd            v0.4s, v4.4s, v6.4s")           /* v0   = Q = M*M + 4*exp(x)*sin(y)^2 */ \
+            __ASM_EMIT("fsqrt           v0.4s, v0.4s")                  /* v0   = sqrt(Q) */
+
+        /*
+         * Solve the batch of second-order polynoms, count should be multiple of 4:
+         *   p[0] = k, p[1] = -k*(exp(R0*T) + exp(R1*T)), p[2] = k*exp((R0+R1)*T) for real roots R0 and R1
+         *   p[0] = k, p[1] = -2*k*exp(R*T)*cos(K*T), p[2] = k*exp(2*R*T) for complex roots R+j*K and R-j*K
+         * Both cases are computed by the same formula
+         *   p[1] = -k*(exp(m - wr) + exp(m + wr))*cos(wc), p[2] = k*exp(m - wr)*exp(m + wr)
+         * where m = -R*T, wr = sqrt(D)*T/2 for D >= 0 and wc = sqrt(-D)*T/2 for D < 0
+         *
+         * The amplitude of the transformed polynom at the control frequency w is computed by roots:
+         *   A = abs(k) * sqrt(Q(m - wr, v - wc/2)) * sqrt(Q(m + wr, v + wc/2)), v = w/2
+         *   Q(x, y) = expm1(x)^2 + 4*exp(x)*sin(y)^2
+         * and p[3] receives the ratio of the continuous transfer function amplitude to A
+         */
+        static void matched_solve_x4(float * const *vp, size_t count, const float *w)
+        {
+            IF_ARCH_AARCH64(float *p);
+
+            ARCH_AARCH64_ASM
+            (
+                EXP_CORE_LOAD
+                __ASM_EMIT("1:")
+                // Load polynoms and transpose
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x00]")
+                __ASM_EMIT("ldr             q0, [%[p]]")                    // v0   = p0[0] p1[0] p2[0] p3[0]
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x08]")
+                __ASM_EMIT("ldr             q1, [%[p]]")                    // v1   = p0[1] p1[1] p2[1] p3[1]
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x10]")
+                __ASM_EMIT("ldr             q2, [%[p]]")                    // v2   = p0[2] p1[2] p2[2] p3[2]
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x18]")
+                __ASM_EMIT("ldr             q3, [%[p]]")                    // v3   = p0[3] p1[3] p2[3] p3[3]
+                __ASM_EMIT("zip1            v4.4s, v0.4s, v2.4s")           // v4   = p0[0] p0[2] p1[0] p1[2]
+                __ASM_EMIT("zip2            v5.4s, v0.4s, v2.4s")           // v5   = p2[0] p2[2] p3[0] p3[2]
+                __ASM_EMIT("zip1            v6.4s, v1.4s, v3.4s")           // v6   = p0[1] p0[3] p1[1] p1[3]
+                __ASM_EMIT("zip2            v7.4s, v1.4s, v3.4s")           // v7   = p2[1] p2[3] p3[1] p3[3]
+                __ASM_EMIT("zip1            v0.4s, v4.4s, v6.4s")           // v0   = P0
+                __ASM_EMIT("zip2            v1.4s, v4.4s, v6.4s")           // v1   = P1
+                __ASM_EMIT("zip1            v2.4s, v5.4s, v7.4s")           // v2   = P2
+                __ASM_EMIT("ldp             q8, q9, [%[MC], #0x00]")        // v8   = 0.01, v9 = 0.1
+                __ASM_EMIT("ldr             q10, [%[MC], #0x20]")           // v10  = 4.0
+                __ASM_EMIT("ldr             q11, [%[w], #0x00]")            // v11  = H
+                // Transfer function
+                __ASM_EMIT("fmul            v4.4s, v2.4s, v8.4s")           // v4   = P2*0.01
+                __ASM_EMIT("fmul            v5.4s, v1.4s, v9.4s")           // v5   = C = P1*0.1
+                __ASM_EMIT("fsub            v4.4s, v0.4s, v4.4s")           // v4   = B = P0 - P2*0.01
+                __ASM_EMIT("fmul            v5.4s, v5.4s, v5.4s")           // v5   = C*C
+                __ASM_EMIT("fmul            v4.4s, v4.4s, v4.4s")           // v4   = B*B
+                __ASM_EMIT("fadd            v7.4s, v4.4s, v5.4s")           // v7   = B*B + C*C
+                __ASM_EMIT("fsqrt           v7.4s, v7.4s")                  // v7   = P3 = sqrt(B*B + C*C)
+                // Roots
+                __ASM_EMIT("mov             v3.16b, v2.16b")                // v3   = K = P2
+                __ASM_EMIT("fdiv            v1.4s, v1.4s, v2.4s")           // v1   = X = P1/P2
+                __ASM_EMIT("fdiv            v0.4s, v0.4s, v2.4s")           // v0   = Y = P0/P2
+                __ASM_EMIT("fmul            v4.4s, v1.4s, v1.4s")           // v4   = X*X
+                __ASM_EMIT("fmul            v0.4s, v0.4s, v10.4s")          // v0   = 4*Y
+                __ASM_EMIT("fmul            v1.4s, v1.4s, v11.4s")          // v1   = X*H
+                __ASM_EMIT("fsub            v4.4s, v4.4s, v0.4s")           // v4   = D = X*X - 4*Y
+                __ASM_EMIT("fcmge           v2.4s, v4.4s, #0.0")            // v2   = [D >= 0]
+                __ASM_EMIT("fabs            v4.4s, v4.4s")                  // v4   = abs(D)
+                __ASM_EMIT("fneg            v1.4s, v1.4s")                  // v1   = m = -X*H
+                __ASM_EMIT("fsqrt           v4.4s, v4.4s")                  // v4   = sqrt(abs(D))
+                __ASM_EMIT("fmul            v4.4s, v4.4s, v11.4s")          // v4   = W = sqrt(abs(D))*H
+                __ASM_EMIT("and             v5.16b, v4.16b, v2.16b")        // v5   = wr = W & [D >= 0]
+                __ASM_EMIT("bic             v4.16b, v4.16b, v2.16b")        // v4   = wc = W & [D < 0]
+                __ASM_EMIT("fsub            v0.4s, v1.4s, v5.4s")           // v0   = m - wr
+                __ASM_EMIT("fadd            v5.4s, v1.4s, v5.4s")           // v5   = m + wr
+                __ASM_EMIT("mov             v1.16b, v4.16b")                // v1   = wc
+                __ASM_EMIT("mov             v12.16b, v0.16b")               // v12  = m - wr
+                // Exponents
+                EXP_CORE_X4_NOLOAD                                          // v0   = E1 = exp(m - wr)
+                __ASM_EMIT("mov             v9.16b, v0.16b")                // v9   = E1
+                __ASM_EMIT("mov             v0.16b, v5.16b")
+                EXP_CORE_X4_NOLOAD                                          // v0   = E2 = exp(m + wr)
+                __ASM_EMIT("mov             v14.16b, v0.16b")               // v14  = E2
+                // Amplitude of the transformed polynom
+                __ASM_EMIT("ldr             q13, [%[w], #0x10]")            // v13  = v
+                __ASM_EMIT("ldr             q10, [%[MC], #0x40]")           // v10  = 0.5
+                __ASM_EMIT("fmul            v11.4s, v1.4s, v10.4s")         // v11  = wc/2
+                __ASM_EMIT("fsub            v13.4s, v13.4s, v11.4s")        // v13  = v - wc/2
+                MATCHED_AMP_X4("v12", "v9", "v13")                          // v0   = sqrt(Q(m - wr, v - wc/2))
+                __ASM_EMIT("mov             v15.16b, v0.16b")               // v15  = sqrt(Q1)
+                __ASM_EMIT("ldr             q13, [%[w], #0x10]")            // v13  = v
+                __ASM_EMIT("ldr             q10, [%[MC], #0x40]")           // v10  = 0.5
+                __ASM_EMIT("fmul            v11.4s, v1.4s, v10.4s")         // v11  = wc/2
+                __ASM_EMIT("fadd            v13.4s, v13.4s, v11.4s")        // v13  = v + wc/2
+                MATCHED_AMP_X4("v5", "v14", "v13")                          // v0   = sqrt(Q(m + wr, v + wc/2))
+                __ASM_EMIT("fabs            v2.4s, v3.4s")                  // v2   = abs(K)
+                __ASM_EMIT("fmul            v0.4s, v0.4s, v15.4s")          // v0   = sqrt(Q1*Q2)
+                __ASM_EMIT("fmul            v0.4s, v0.4s, v2.4s")           // v0   = A = abs(K)*sqrt(Q1*Q2)
+                __ASM_EMIT("fdiv            v7.4s, v7.4s, v0.4s")           // v7   = P3' = P3/A
+                __ASM_EMIT("fmul            v5.4s, v9.4s, v14.4s")          // v5   = E1*E2
+                __ASM_EMIT("fadd            v9.4s, v9.4s, v14.4s")          // v9   = E1+E2
+                // Cosine: cos(wc) = sin(PI/2 - abs(wc - 2*PI*n))
+                __ASM_EMIT("ldp             q10, q11, [%[MC], #0x30]")      // v10  = 1/(2*PI), v11 = 0.5
+                __ASM_EMIT("ldp             q12, q13, [%[MC], #0x50]")      // v12  = 2*PI, v13 = PI/2
+                __ASM_EMIT("fmul            v0.4s, v1.4s, v10.4s")          // v0   = wc/(2*PI)
+                __ASM_EMIT("fadd            v0.4s, v0.4s, v11.4s")          // v0   = wc/(2*PI) + 0.5
+                __ASM_EMIT("fcvtzs          v0.4s, v0.4s")
+                __ASM_EMIT("scvtf           v0.4s, v0.4s")                  // v0   = n = int(wc/(2*PI) + 0.5)
+                __ASM_EMIT("fmul            v0.4s, v0.4s, v12.4s")          // v0   = 2*PI*n
+                __ASM_EMIT("fsub            v1.4s, v1.4s, v0.4s")           // v1   = wc - 2*PI*n
+                __ASM_EMIT("fabs            v1.4s, v1.4s")                  // v1   = abs(wc - 2*PI*n)
+                __ASM_EMIT("fsub            v0.4s, v13.4s, v1.4s")          // v0   = y = PI/2 - abs(wc - 2*PI*n)
+                __ASM_EMIT("fmul            v2.4s, v0.4s, v0.4s")           // v2   = y2 = y*y
+                __ASM_EMIT("ldp             q10, q11, [%[MC], #0x70]")      // v10  = S5, v11 = S4
+                __ASM_EMIT("ldp             q12, q13, [%[MC], #0x90]")      // v12  = S3, v13 = S2
+                __ASM_EMIT("ldp             q14, q15, [%[MC], #0xb0]")      // v14  = S1, v15 = 1.0
+                __ASM_EMIT("fmul            v4.4s, v2.4s, v10.4s")          // v4   = S5*y2
+                __ASM_EMIT("fadd            v4.4s, v4.4s, v11.4s")          // v4   = S4 + S5*y2
+                __ASM_EMIT("fmul            v4.4s, v4.4s, v2.4s")
+                __ASM_EMIT("fadd            v4.4s, v4.4s, v12.4s")          // v4   = S3 + y2*(S4 + S5*y2)
+                __ASM_EMIT("fmul            v4.4s, v4.4s, v2.4s")
+                __ASM_EMIT("fadd            v4.4s, v4.4s, v13.4s")          // v4   = S2 + y2*(S3 + y2*(S4 + S5*y2))
+                __ASM_EMIT("fmul            v4.4s, v4.4s, v2.4s")
+                __ASM_EMIT("fadd            v4.4s, v4.4s, v14.4s")          // v4   = S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2)))
+                __ASM_EMIT("fmul            v4.4s, v4.4s, v2.4s")
+                __ASM_EMIT("fadd            v4.4s, v4.4s, v15.4s")          // v4   = 1 + y2*(S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2))))
+                __ASM_EMIT("fmul            v4.4s, v4.4s, v0.4s")           // v4   = cos(wc)
+                // Transformed polynom
+                __ASM_EMIT("fmul            v9.4s, v9.4s, v4.4s")           // v9   = (E1+E2)*cos(wc)
+                __ASM_EMIT("fmul            v2.4s, v5.4s, v3.4s")           // v2   = P2' = K*E1*E2
+                __ASM_EMIT("fmul            v1.4s, v9.4s, v3.4s")           // v1   = K*(E1+E2)*cos(wc)
+                __ASM_EMIT("mov             v0.16b, v3.16b")                // v0   = P0' = K
+                __ASM_EMIT("fneg            v1.4s, v1.4s")                  // v1   = P1' = -K*(E1+E2)*cos(wc)
+                __ASM_EMIT("mov             v3.16b, v7.16b")                // v3   = P3
+                // Transpose back and store polynoms
+                __ASM_EMIT("zip1            v4.4s, v0.4s, v2.4s")
+                __ASM_EMIT("zip2            v5.4s, v0.4s, v2.4s")
+                __ASM_EMIT("zip1            v6.4s, v1.4s, v3.4s")
+                __ASM_EMIT("zip2            v7.4s, v1.4s, v3.4s")
+                __ASM_EMIT("zip1            v0.4s, v4.4s, v6.4s")           // v0   = p[0]
+                __ASM_EMIT("zip2            v1.4s, v4.4s, v6.4s")           // v1   = p[1]
+                __ASM_EMIT("zip1            v2.4s, v5.4s, v7.4s")           // v2   = p[2]
+                __ASM_EMIT("zip2            v3.4s, v5.4s, v7.4s")           // v3   = p[3]
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x00]")
+                __ASM_EMIT("str             q0, [%[p]]")
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x08]")
+                __ASM_EMIT("str             q1, [%[p]]")
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x10]")
+                __ASM_EMIT("str             q2, [%[p]]")
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x18]")
+                __ASM_EMIT("str             q3, [%[p]]")
+                // Repeat loop
+                __ASM_EMIT("add             %[vp], %[vp], #0x20")
+                __ASM_EMIT("subs            %[count], %[count], #4")
+                __ASM_EMIT("b.ne            1b")
+
+                : [vp] "+r" (vp), [count] "+r" (count),
+                  [p] "=&r" (p)
+                : [w] "r" (w),
+                  [MC] "r" (&MATCHED_CONST[0]),
+                  [E2C] "r" (&EXP2_CONST[0]),
+                  [LOG2E] "r" (&EXP_LOG2E[0])
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v8", "v9", "v10", "v11",
+                  "v12", "v13", "v14", "v15",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21", "v22", "v23",
+                  "v24", "v25", "v26", "v27"
+            );
+        }
+
+        static void matched_init(matched_ctx_t *ctx, float kf, float td)
+        {
+            float h         = 0.5f * kf * td;
+            float v         = 0.05f * kf * td;
+
+            for (size_t i=0; i<4; ++i)
+            {
+                ctx->w[i]       = h;
+                ctx->w[i+4]     = v;
+            }
+            ctx->n          = 0;
+        }
+
+        static void matched_flush(matched_ctx_t *ctx)
+        {
+            size_t n        = ctx->n;
+            if (n <= 0)
+                return;
+
+            // Pad the batch with the last polynom, it is loaded before the store
+            for ( ; n & 3; ++n)
+                ctx->vp[n]      = ctx->vp[n-1];
+
+            matched_solve_x4(ctx->vp, n, ctx->w);
+            ctx->n          = 0;
+        }
+
+        static void matched_solve(matched_ctx_t *ctx, float *p, float kf, float td, size_t count, size_t stride)
+        {
+            // The order of each polynom is tested individually
+            float s         = sinf(0.05f * kf * td);
+
+            while (count--)
+            {
+                if (p[2] != 0.0) // Test polynom for second-order
+                {
+                    // Second-order polynoms are collected into the batch
+                    ctx->vp[ctx->n++]   = p;
+                    if (ctx->n >= MATCHED_BATCH)
+                    {
+                        matched_solve_x4(ctx->vp, ctx->n, ctx->w);
+                        ctx->n              = 0;
+                    }
+                }
+                else if (p[1] != 0.0) // Test polynom for first order
+                {
+                    // First-order polynom:
+                    //   p(s) = p[0] + p[1]*(s/f)
+                    //
+                    // Transformed polynom:
+                    //   P[z] = p[1]/f - p[1]/f * exp(-f*p[0]*T/p[1]) * z^-1
+                    //
+                    // The p[3] receives the ratio of the continuous transfer function amplitude to
+                    // the amplitude of P[z] at the control frequency w computed by the root E:
+                    //   A = abs(p[1]/f) * sqrt(expm1(R*T)^2 + 4*E*sin(w/2)^2)
+                    float k     = p[1]/kf;
+                    float R     = -p[0]/k;
+                    float E     = expf(R*td);
+                    float M     = expm1f(R*td);
+                    float A     = fabsf(k) * sqrtf(M*M + 4.0f*E*s*s);
+
+                    p[3]        = sqrtf(p[0]*p[0] + p[1]*p[1]*0.01f) / A; // transfer function
+                    p[0]        = k;
+                    p[1]        = -k * E;
+                }
+                else
+                    p[3]        = 1.0f / fabsf(p[0]); // transfer function
+
+                p          += stride;
+            }
+        }
+
+        /*
+         * Compute the normalized filter for four cascades pointed by bc, v8..v11 should
+         * contain cos_w, sin_w, cos_2w and sin_2w:
+         *   v0 = b0, v1 = b1, v2 = b2, v3 = a1, v4 = a2
+         */
+        #define MATCHED_NORM_X4 \
+            __ASM_EMIT("ldp             q0, q1, [%[bc], #0x00]")        /* v0   = t[0,x], v1 = b[0,x] */ \
+            __ASM_EMIT("ldp             q2, q3, [%[bc], #0x20]")        /* v2   = t[1,x], v3 = b[1,x] */ \
+            __ASM_EMIT("ldp             q4, q5, [%[bc], #0x40]")        /* v4   = t[2,x], v5 = b[2,x] */ \
+            __ASM_EMIT("ldp             q6, q7, [%[bc], #0x60]")        /* v6   = t[3,x], v7 = b[3,x] */ \
+            __ASM_EMIT("zip1            v16.4s, v0.4s, v4.4s")          /* v16  = t00 t20 t01 t21 */ \
+            __ASM_EMIT("zip2            v17.4s, v0.4s, v4.4s")          /* v17  = t02 t22 t03 t23 */ \
+            __ASM_EMIT("zip1            v18.4s, v2.4s, v6.4s")          /* v18  = t10 t30 t11 t31 */ \
+            __ASM_EMIT("zip2            v19.4s, v2.4s, v6.4s")          /* v19  = t12 t32 t13 t33 */ \
+            __ASM_EMIT("zip1            v0.4s, v16.4s, v18.4s")         /* v0   = t0 */ \
+            __ASM_EMIT("zip2            v2.4s, v16.4s, v18.4s")         /* v2   = t1 */ \
+            __ASM_EMIT("zip1            v4.4s, v17.4s, v19.4s")         /* v4   = t2 */ \
+            __ASM_EMIT("zip2            v6.4s, v17.4s, v19.4s")         /* v6   = t3 */ \
+            __ASM_EMIT("zip1            v16.4s, v1.4s, v5.4s")          /* v16  = b00 b20 b01 b21 */ \
+            __ASM_EMIT("zip2            v17.4s, v1.4s, v5.4s")          /* v17  = b02 b22 b03 b23 */ \
+            __ASM_EMIT("zip1            v18.4s, v3.4s, v7.4s")          /* v18  = b10 b30 b11 b31 */ \
+            __ASM_EMIT("zip2            v19.4s, v3.4s, v7.4s")          /* v19  = b12 b32 b13 b33 */ \
+            __ASM_EMIT("zip1            v1.4s, v16.4s, v18.4s")         /* v1   = b0 */ \
+            __ASM_EMIT("zip2            v3.4s, v16.4s, v18.4s")         /* v3   = b1 */ \
+            __ASM_EMIT("zip1            v5.4s, v17.4s, v19.4s")         /* v5   = b2 */ \
+            __ASM_EMIT("zip2            v7.4s, v17.4s, v19.4s")         /* v7   = b3 */ \
+            /* Normalize */ \
+            __ASM_EMIT("fmov            v14.4s, #1.0")                  /* v14  = 1 */ \
+            __ASM_EMIT("fdiv            v13.4s, v6.4s, v7.4s")          /* v13  = AN = t3/b3 */ \
+            __ASM_EMIT("fdiv            v14.4s, v14.4s, v1.4s")         /* v14  = N2 = 1/b0 */ \
+            __ASM_EMIT("fmul            v13.4s, v13.4s, v14.4s")        /* v13  = N1 = AN*N2 */ \
+            __ASM_EMIT("fneg            v14.4s, v14.4s")                /* v14  = -N2 */ \
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v13.4s")          /* v0   = b0 = t0*N1 */ \
+            __ASM_EMIT("fmul            v1.4s, v2.4s, v13.4s")          /* v1   = b1 = t1*N1 */ \
+            __ASM_EMIT("fmul            v2.4s, v4.4s, v13.4s")          /* v2   = b2 = t2*N1 */ \
+            __ASM_EMIT("fmul            v3.4s, v3.4s, v14.4s")          /* v3   = a1 = -b1*N2 */ \
+            __ASM_EMIT("fmul            v4.4s, v5.4s, v14.4s")          /* v4   = a2 = -b2*N2 */ \
+            __ASM_EMIT("add             %[bc], %[bc], #0x80")
+
+        static void matched_norm_x1(dsp::biquad_x1_t *bf, const dsp::f_cascade_t *bc, const float *w, size_t count)
+        {
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                // Transpose and store
+                __ASM_EMIT("eor             v5.16b, v5.16b, v5.16b")        // v5   = 0
+                __ASM_EMIT("zip1            v16.4s, v0.4s, v2.4s")
+                __ASM_EMIT("zip2            v17.4s, v0.4s, v2.4s")
+                __ASM_EMIT("zip1            v18.4s, v1.4s, v3.4s")
+                __ASM_EMIT("zip2            v19.4s, v1.4s, v3.4s")
+                __ASM_EMIT("zip1            v0.4s, v16.4s, v18.4s")         // v0   = b0[0] b1[0] b2[0] a1[0]
+                __ASM_EMIT("zip2            v1.4s, v16.4s, v18.4s")         // v1   = b0[1] b1[1] b2[1] a1[1]
+                __ASM_EMIT("zip1            v2.4s, v17.4s, v19.4s")         // v2   = b0[2] b1[2] b2[2] a1[2]
+                __ASM_EMIT("zip2            v3.4s, v17.4s, v19.4s")         // v3   = b0[3] b1[3] b2[3] a1[3]
+                __ASM_EMIT("zip1            v16.4s, v4.4s, v5.4s")          // v16  = a2[0] 0 a2[1] 0
+                __ASM_EMIT("zip2            v17.4s, v4.4s, v5.4s")          // v17  = a2[2] 0 a2[3] 0
+                __ASM_EMIT("zip1            v18.2d, v16.2d, v5.2d")         // v18  = a2[0] 0 0 0
+                __ASM_EMIT("zip2            v19.2d, v16.2d, v5.2d")         // v19  = a2[1] 0 0 0
+                __ASM_EMIT("zip1            v20.2d, v17.2d, v5.2d")         // v20  = a2[2] 0 0 0
+                __ASM_EMIT("zip2            v21.2d, v17.2d, v5.2d")         // v21  = a2[3] 0 0 0
+                __ASM_EMIT("stp             q0, q18, [%[bf], #0x00]")
+                __ASM_EMIT("stp             q1, q19, [%[bf], #0x20]")
+                __ASM_EMIT("stp             q2, q20, [%[bf], #0x40]")
+                __ASM_EMIT("stp             q3, q21, [%[bf], #0x60]")
+                // Repeat loop
+                __ASM_EMIT("add             %[bf], %[bf], #0x80")
+                __ASM_EMIT("subs            %[count], %[count], #1")
+                __ASM_EMIT("b.ne            1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v8", "v9", "v10", "v11",
+                  "v12", "v13", "v14", "v15",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21"
+            );
+        }
+
+        static void matched_norm_x2(dsp::biquad_x2_t *bf, const dsp::f_cascade_t *bc, const float *w, size_t count)
+        {
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                __ASM_EMIT("eor             v5.16b, v5.16b, v5.16b")        // v5   = 0
+                __ASM_EMIT("zip1            v16.2d, v0.2d, v1.2d")          // v16  = b0[0] b0[1] b1[0] b1[1]
+                __ASM_EMIT("zip2            v17.2d, v0.2d, v1.2d")          // v17  = b0[2] b0[3] b1[2] b1[3]
+                __ASM_EMIT("zip1            v18.2d, v2.2d, v3.2d")          // v18  = b2[0] b2[1] a1[0] a1[1]
+                __ASM_EMIT("zip2            v19.2d, v2.2d, v3.2d")          // v19  = b2[2] b2[3] a1[2] a1[3]
+                __ASM_EMIT("zip1            v20.2d, v4.2d, v5.2d")          // v20  = a2[0] a2[1] 0 0
+                __ASM_EMIT("zip2            v21.2d, v4.2d, v5.2d")          // v21  = a2[2] a2[3] 0 0
+                __ASM_EMIT("stp             q16, q18, [%[bf], #0x00]")
+                __ASM_EMIT("str             q20, [%[bf], #0x20]")
+                __ASM_EMIT("stp             q17, q19, [%[bf], #0x30]")
+                __ASM_EMIT("str             q21, [%[bf], #0x50]")
+                // Repeat loop
+                __ASM_EMIT("add             %[bf], %[bf], #0x60")
+                __ASM_EMIT("subs            %[count], %[count], #1")
+                __ASM_EMIT("b.ne            1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v8", "v9", "v10", "v11",
+                  "v12", "v13", "v14", "v15",
+                  "v16", "v17", "v18", "v19",
+                  "v20", "v21"
+            );
+        }
+
+        static void matched_norm_x4(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, const float *w, size_t count)
+        {
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                __ASM_EMIT("stp             q0, q1, [%[bf], #0x00]")
+                __ASM_EMIT("stp             q2, q3, [%[bf], #0x20]")
+                __ASM_EMIT("str             q4, [%[bf], #0x40]")
+                // Repeat loop
+                __ASM_EMIT("add             %[bf], %[bf], #0x50")
+                __ASM_EMIT("subs            %[count], %[count], #1")
+                __ASM_EMIT("b.ne            1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v8", "v9", "v10", "v11",
+                  "v12", "v13", "v14", "v15",
+                  "v16", "v17", "v18", "v19"
+            );
+        }
+
+        static void matched_norm_x8(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, const float *w, size_t count)
+        {
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                __ASM_EMIT("str             q0, [%[bf], #0x00]")
+                __ASM_EMIT("str             q1, [%[bf], #0x20]")
+                __ASM_EMIT("str             q2, [%[bf], #0x40]")
+                __ASM_EMIT("str             q3, [%[bf], #0x60]")
+                __ASM_EMIT("str             q4, [%[bf], #0x80]")
+                MATCHED_NORM_X4
+                __ASM_EMIT("str             q0, [%[bf], #0x10]")
+                __ASM_EMIT("str             q1, [%[bf], #0x30]")
+                __ASM_EMIT("str             q2, [%[bf], #0x50]")
+                __ASM_EMIT("str             q3, [%[bf], #0x70]")
+                __ASM_EMIT("str             q4, [%[bf], #0x90]")
+                // Repeat loop
+                __ASM_EMIT("add             %[bf], %[bf], #0xa0")
+                __ASM_EMIT("subs            %[count], %[count], #1")
+                __ASM_EMIT("b.ne            1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3",
+                  "v4", "v5", "v6", "v7",
+                  "v8", "v9", "v10", "v11",
+                  "v12", "v13", "v14", "v15",
+                  "v16", "v17", "v18", "v19"
+            );
+        }
+
+        #undef MATCHED_NORM_X4
+        #undef MATCHED_AMP_X4
+
+        void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Find roots for top and bottom polynoms
+            matched_solve(&ctx, bc->t, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
+            matched_solve(&ctx, bc->b, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
+            matched_flush(&ctx);
+
+            // Normalize filters, the tail is processed by padding to the full block
+            size_t blocks   = count >> 2;
+            if (blocks > 0)
+            {
+                matched_norm_x1(bf, bc, ctx.w, blocks);
+                bf             += blocks << 2;
+                bc             += blocks << 2;
+            }
+
+            count          &= 3;
+            if (count > 0)
+            {
+                dsp::f_cascade_t xc[4];
+                dsp::biquad_x1_t xf[4];
+
+                for (size_t i=0; i<4; ++i)
+                    xc[i]           = bc[lsp_min(i, count - 1)];
+                matched_norm_x1(xf, xc, ctx.w, 1);
+                for (size_t i=0; i<count; ++i)
+                    bf[i]           = xf[i];
+            }
+        }
+
+        void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Solve filters
+            for (size_t i=0; i<2; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*3];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 1, (2*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 1, (2*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters, the tail is processed by padding to the full block
+            size_t blocks   = count >> 1;
+            if (blocks > 0)
+            {
+                matched_norm_x2(bf, bc, ctx.w, blocks);
+                bf             += blocks << 1;
+                bc             += blocks << 2;
+            }
+
+            if (count & 1)
+            {
+                dsp::f_cascade_t xc[4];
+                dsp::biquad_x2_t xf[2];
+
+                xc[0]           = bc[0];
+                xc[1]           = bc[1];
+                xc[2]           = bc[1];
+                xc[3]           = bc[1];
+                matched_norm_x2(xf, xc, ctx.w, 1);
+                bf[0]           = xf[0];
+            }
+        }
+
+        void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Solve filters
+            for (size_t i=0; i<4; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*5];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 3, (4*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 3, (4*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters
+            if (count > 0)
+                matched_norm_x4(bf, bc, ctx.w, count);
+        }
+
+        void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Solve filters
+            for (size_t i=0; i<8; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*9];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 7, (8*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 7, (8*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters
+            if (count > 0)
+                matched_norm_x8(bf, bc, ctx.w, count);
+        }
     }
 }
 
+#undef MATCHED_BATCH
+
 #endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_FILTERS_TRANSFORM_H_ */
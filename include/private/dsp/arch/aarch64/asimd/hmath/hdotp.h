@@ -285,6 +285,78 @@ namespace lsp
 
             return res;
         }
+
+        float h_lerp_dotp(const float *x, const float *a, const float *b, float k, size_t count)
+        {
+            float res;
+            ARCH_AARCH64_ASM
+            (
+                __ASM_EMIT("eor         v16.16b, v16.16b, v16.16b")
+                __ASM_EMIT("eor         v17.16b, v17.16b, v17.16b")
+                __ASM_EMIT("subs        %[count], %[count], #8")
+                __ASM_EMIT("b.lt        2f")
+                /* 8x block */
+                __ASM_EMIT("1:")
+                __ASM_EMIT("ldp         q0, q1, [%[x], #0x00]")
+                __ASM_EMIT("ldp         q2, q3, [%[a], #0x00]")
+                __ASM_EMIT("ldp         q4, q5, [%[b], #0x00]")
+                __ASM_EMIT("fmla        v16.4s, v0.4s, v2.4s")
+                __ASM_EMIT("fmla        v17.4s, v0.4s, v4.4s")
+                __ASM_EMIT("fmla        v16.4s, v1.4s, v3.4s")
+                __ASM_EMIT("fmla        v17.4s, v1.4s, v5.4s")
+                __ASM_EMIT("subs        %[count], %[count], #8")
+                __ASM_EMIT("add         %[x], %[x], #0x20")
+                __ASM_EMIT("add         %[a], %[a], #0x20")
+                __ASM_EMIT("add         %[b], %[b], #0x20")
+                __ASM_EMIT("b.hs        1b")
+                /* 4x block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds        %[count], %[count], #4")
+                __ASM_EMIT("b.lt        4f")
+                __ASM_EMIT("ldr         q0, [%[x], #0x00]")
+                __ASM_EMIT("ldr         q2, [%[a], #0x00]")
+                __ASM_EMIT("ldr         q4, [%[b], #0x00]")
+                __ASM_EMIT("fmla        v16.4s, v0.4s, v2.4s")
+                __ASM_EMIT("fmla        v17.4s, v0.4s, v4.4s")
+                __ASM_EMIT("sub         %[count], %[count], #4")
+                __ASM_EMIT("add         %[x], %[x], #0x10")
+                __ASM_EMIT("add         %[a], %[a], #0x10")
+                __ASM_EMIT("add         %[b], %[b], #0x10")
+                /* 1x block */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("adds        %[count], %[count], #3")
+                __ASM_EMIT("b.lt        6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("ldr         s0, [%[x]]")
+                __ASM_EMIT("ldr         s2, [%[a]]")
+                __ASM_EMIT("ldr         s4, [%[b]]")
+                __ASM_EMIT("fmla        v16.4s, v0.4s, v2.4s")
+                __ASM_EMIT("fmla        v17.4s, v0.4s, v4.4s")
+                __ASM_EMIT("subs        %[count], %[count], #1")
+                __ASM_EMIT("add         %[x], %[x], #0x04")
+                __ASM_EMIT("add         %[a], %[a], #0x04")
+                __ASM_EMIT("add         %[b], %[b], #0x04")
+                __ASM_EMIT("b.ge        5b")
+                /* interpolate and sum */
+                __ASM_EMIT("6:")
+                __ASM_EMIT("ld1r        {v2.4s}, [%[k]]")                   // v2 = k
+                __ASM_EMIT("fsub        v17.4s, v17.4s, v16.4s")            // v17 = sb - sa
+                __ASM_EMIT("fmla        v16.4s, v17.4s, v2.4s")             // v16 = sa + (sb - sa)*k
+                __ASM_EMIT("ext         v17.16b, v16.16b, v16.16b, #8")
+                __ASM_EMIT("fadd        v16.4s, v16.4s, v17.4s")
+                __ASM_EMIT("ext         v17.16b, v16.16b, v16.16b, #4")
+                __ASM_EMIT("fadd        %[res].4s, v16.4s, v17.4s")
+                : [res] "=w" (res),
+                  [x] "+r" (x), [a] "+r" (a), [b] "+r" (b),
+                  [count] "+r" (count)
+                : [k] "r" (&k)
+                : "cc", "memory",
+                  "v0", "v1", "v2", "v3", "v4", "v5",
+                  "v16", "v17"
+            );
+
+            return res;
+        }
     }
 }
 
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_RFFT_H_
+#define PRIVATE_DSP_ARCH_AARCH64_ASIMD_RFFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+#include <private/dsp/arch/generic/fft/real_small.h>
+#include <private/dsp/arch/aarch64/asimd/fft/const.h>
+#include <private/dsp/arch/aarch64/asimd/fft/r_split.h>
+
+namespace lsp
+{
+    namespace asimd
+    {
+        /*
+         * The complex FFT of half size is computed by packed_direct_fft and packed_reverse_fft
+         * of the same instruction set, the split pass converts it into the spectrum of real FFT.
+         */
+        void real_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                generic::real_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            packed_direct_fft(dst, src, rank - 1);
+            generic::real_fft_split_dc(dst, rank);
+            real_split_direct(dst, rank);
+        }
+
+        void real_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                generic::real_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            generic::real_fft_join_dc(dst, src, rank);
+            real_split_reverse(dst, src, rank);
+            packed_reverse_fft(dst, dst, rank - 1);
+        }
+    } /* namespace asimd */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_AARCH64_ASIMD_RFFT_H_ */
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_ARM_NEON_D32_FFT_R_SPLIT_H_
+#define PRIVATE_DSP_ARCH_ARM_NEON_D32_FFT_R_SPLIT_H_
+
+#ifndef PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL */
+
+namespace lsp
+{
+    namespace neon_d32
+    {
+        static const float rfft_split_const[] __lsp_aligned16 =
+        {
+            LSP_DSP_VEC4(0.5f)
+        };
+
+        /* Load 4 harmonics from the head and 4 harmonics from the tail of the spectrum */
+        #define RFFT_SPLIT_LOAD(a, b) \
+            __ASM_EMIT("vld2.32     {d0-d3}, [%[" a "]]")           /* q0   = ar, q1 = ai */ \
+            __ASM_EMIT("vld2.32     {d4-d7}, [%[" b "]]")           /* q2   = br3 br2 br1 br0, q3 = bi3 bi2 bi1 bi0 */ \
+            __ASM_EMIT("vrev64.32   q2, q2") \
+            __ASM_EMIT("vrev64.32   q3, q3") \
+            __ASM_EMIT("vext.32     q2, q2, q2, #2")                /* q2   = br */ \
+            __ASM_EMIT("vext.32     q3, q3, q3, #2")                /* q3   = bi */
+
+        /* Store 4 harmonics to the head and 4 harmonics to the tail of the spectrum */
+        #define RFFT_SPLIT_STORE(a, b) \
+            __ASM_EMIT("vmul.f32    q0, q0, q11") \
+            __ASM_EMIT("vmul.f32    q1, q1, q11") \
+            __ASM_EMIT("vmul.f32    q2, q2, q11") \
+            __ASM_EMIT("vmul.f32    q3, q3, q11") \
+            __ASM_EMIT("vrev64.32   q2, q2") \
+            __ASM_EMIT("vrev64.32   q3, q3") \
+            __ASM_EMIT("vext.32     q2, q2, q2, #2") \
+            __ASM_EMIT("vext.32     q3, q3, q3, #2") \
+            __ASM_EMIT("vst2.32     {d0-d3}, [%[" a "]]!") \
+            __ASM_EMIT("vst2.32     {d4-d7}, [%[" b "]]") \
+            __ASM_EMIT("sub         %[" b "], #0x20")
+
+        /* Rotate twiddle factors and jump to the next iteration */
+        #define RFFT_SPLIT_ROTATE \
+            __ASM_EMIT("subs        %[blocks], #1") \
+            __ASM_EMIT("beq         2f") \
+            __ASM_EMIT("vmul.f32    q4, q12, q15")                  /* q4   = w_re*dw_im */ \
+            __ASM_EMIT("vmul.f32    q5, q13, q15")                  /* q5   = w_im*dw_im */ \
+            __ASM_EMIT("vmul.f32    q12, q12, q14")                 /* q12  = w_re*dw_re */ \
+            __ASM_EMIT("vmul.f32    q13, q13, q14")                 /* q13  = w_im*dw_re */ \
+            __ASM_EMIT("vsub.f32    q12, q12, q5")                  /* q12  = w_re' = w_re*dw_re - w_im*dw_im */ \
+            __ASM_EMIT("vadd.f32    q13, q13, q4")                  /* q13  = w_im' = w_im*dw_re + w_re*dw_im */ \
+            __ASM_EMIT("b           1b") \
+            __ASM_EMIT("2:")
+
+        /**
+         * Compute twiddle factors for the split pass from the FFT tables: initial angles
+         * (1..4)*pi/N and the rotation by 4*pi/N, N = 2^(rank-1), rank >= 4
+         */
+        static inline void real_split_twiddle(float *w, size_t rank)
+        {
+            const float *a      = &XFFT_A[(rank - 3) << 4];     // angles (0..7)*pi/N
+            const float *dw     = &XFFT_DW[(rank - 2) << 3];    // rotation by 4*pi/N
+
+            for (size_t i=0; i<4; ++i)
+            {
+                w[i]        = a[i + 1];
+                w[i + 4]    = a[i + 9];
+            }
+            for (size_t i=0; i<8; ++i)
+                w[i + 8]    = dw[i];
+        }
+
+        /**
+         * Split the spectrum of the complex FFT of half size into the spectrum of real FFT,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 4.
+         * X[k] = (Z[k] + Z*[N-k])/2 - j*W^k * (Z[k] - Z*[N-k])/2
+         */
+        static inline void real_split_direct(float *dst, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            float *a        = &dst[2];
+            float *b        = &dst[(items - 4) << 1];
+            float w[16] __lsp_aligned16;
+            real_split_twiddle(w, rank);
+            size_t blocks   = items >> 3;
+
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("vldm        %[w], {q12-q15}")               /* q12  = w_re, q13 = w_im, q14 = dw_re, q15 = dw_im */
+                __ASM_EMIT("vld1.32     {q11}, [%[half]]")              /* q11  = 0.5 */
+                __ASM_EMIT("1:")
+                RFFT_SPLIT_LOAD("a", "b")
+                __ASM_EMIT("vadd.f32    q4, q0, q2")                    /* q4   = s = ar + br */
+                __ASM_EMIT("vsub.f32    q5, q1, q3")                    /* q5   = d = ai - bi */
+                __ASM_EMIT("vadd.f32    q6, q1, q3")                    /* q6   = p = ai + bi */
+                __ASM_EMIT("vsub.f32    q7, q2, q0")                    /* q7   = q = br - ar */
+                __ASM_EMIT("vmul.f32    q8, q12, q6")                   /* q8   = w_re*p */
+                __ASM_EMIT("vmul.f32    q9, q12, q7")                   /* q9   = w_re*q */
+                __ASM_EMIT("vmla.f32    q8, q13, q7")                   /* q8   = t_re = w_re*p + w_im*q */
+                __ASM_EMIT("vmls.f32    q9, q13, q6")                   /* q9   = t_im = w_re*q - w_im*p */
+                __ASM_EMIT("vadd.f32    q0, q4, q8")                    /* q0   = s + t_re */
+                __ASM_EMIT("vadd.f32    q1, q9, q5")                    /* q1   = t_im + d */
+                __ASM_EMIT("vsub.f32    q2, q4, q8")                    /* q2   = s - t_re */
+                __ASM_EMIT("vsub.f32    q3, q9, q5")                    /* q3   = t_im - d */
+                RFFT_SPLIT_STORE("a", "b")
+                RFFT_SPLIT_ROTATE
+                : [a] "+r" (a), [b] "+r" (b),
+                  [blocks] "+r" (blocks)
+                : [w] "r" (w), [half] "r" (&rfft_split_const[0])
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3", "q4", "q5", "q6", "q7",
+                  "q8", "q9", "q11", "q12", "q13", "q14", "q15"
+            );
+        }
+
+        /**
+         * Join the spectrum of real FFT into the spectrum of the complex FFT of half size,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 4.
+         * Z[k] = (X[k] + X*[N-k])/2 + j*W^-k * (X[k] - X*[N-k])/2
+         */
+        static inline void real_split_reverse(float *dst, const float *src, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            const float *sa = &src[2];
+            const float *sb = &src[(items - 4) << 1];
+            float *da       = &dst[2];
+            float *db       = &dst[(items - 4) << 1];
+            float w[16] __lsp_aligned16;
+            real_split_twiddle(w, rank);
+            size_t blocks   = items >> 3;
+
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("vldm        %[w], {q12-q15}")               /* q12  = w_re, q13 = w_im, q14 = dw_re, q15 = dw_im */
+                __ASM_EMIT("vld1.32     {q11}, [%[half]]")              /* q11  = 0.5 */
+                __ASM_EMIT("1:")
+                RFFT_SPLIT_LOAD("sa", "sb")
+                __ASM_EMIT("add         %[sa], #0x20")
+                __ASM_EMIT("sub         %[sb], #0x20")
+                __ASM_EMIT("vadd.f32    q4, q0, q2")                    /* q4   = s = ar + br */
+                __ASM_EMIT("vsub.f32    q5, q1, q3")                    /* q5   = d = ai - bi */
+                __ASM_EMIT("vsub.f32    q6, q0, q2")                    /* q6   = p = ar - br */
+                __ASM_EMIT("vadd.f32    q7, q1, q3")                    /* q7   = q = ai + bi */
+                __ASM_EMIT("vmul.f32    q8, q12, q6")                   /* q8   = w_re*p */
+                __ASM_EMIT("vmul.f32    q9, q12, q7")                   /* q9   = w_re*q */
+                __ASM_EMIT("vmls.f32    q8, q13, q7")                   /* q8   = o_re = w_re*p - w_im*q */
+                __ASM_EMIT("vmla.f32    q9, q13, q6")                   /* q9   = o_im = w_re*q + w_im*p */
+                __ASM_EMIT("vsub.f32    q0, q4, q9")                    /* q0   = s - o_im */
+                __ASM_EMIT("vadd.f32    q1, q8, q5")                    /* q1   = o_re + d */
+                __ASM_EMIT("vadd.f32    q2, q4, q9")                    /* q2   = s + o_im */
+                __ASM_EMIT("vsub.f32    q3, q8, q5")                    /* q3   = o_re - d */
+                RFFT_SPLIT_STORE("da", "db")
+                RFFT_SPLIT_ROTATE
+                : [sa] "+r" (sa), [sb] "+r" (sb),
+                  [da] "+r" (da), [db] "+r" (db),
+                  [blocks] "+r" (blocks)
+                : [w] "r" (w), [half] "r" (&rfft_split_const[0])
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3", "q4", "q5", "q6", "q7",
+                  "q8", "q9", "q11", "q12", "q13", "q14", "q15"
+            );
+        }
+
+        #undef RFFT_SPLIT_LOAD
+        #undef RFFT_SPLIT_STORE
+        #undef RFFT_SPLIT_ROTATE
+    } /* namespace neon_d32 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_FFT_R_SPLIT_H_ */
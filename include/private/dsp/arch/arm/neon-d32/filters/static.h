@@ -417,6 +417,187 @@ namespace lsp
                   "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
             );
         }
+
+        /*
+         * Transpose 4x4 matrix stored in registers QA, QB, QC, QD,
+         * DA1, DB1, DC0 and DD0 are the corresponding halves of these registers
+         */
+        #define BIQUAD_MC_TRANSPOSE(QA, QB, QC, QD, DA1, DB1, DC0, DD0) \
+            __ASM_EMIT("vtrn.32     " QA ", " QB)                                   /* QA   = a0 b0 a2 b2, QB = a1 b1 a3 b3 */ \
+            __ASM_EMIT("vtrn.32     " QC ", " QD)                                   /* QC   = c0 d0 c2 d2, QD = c1 d1 c3 d3 */ \
+            __ASM_EMIT("vswp        " DA1 ", " DC0)                                 /* QA   = a0 b0 c0 d0, QC = a2 b2 c2 d2 */ \
+            __ASM_EMIT("vswp        " DB1 ", " DD0)                                 /* QB   = a1 b1 c1 d1, QD = a3 b3 c3 d3 */
+
+        /*
+         * Apply four biquad filters to the sample of four channels stored in register X,
+         * D0 and D1 contain the filter memory. After the processing D0 contains the output
+         * sample, D1 contains the updated d0 and X contains the updated d1 memory
+         */
+        #define BIQUAD_MC_FILTER(D0, D1, X) \
+            __ASM_EMIT("vmla.f32    " D0 ", q10, " X)                               /* D0   = s2 = d0 + b0*s */ \
+            __ASM_EMIT("vmla.f32    " D1 ", q11, " X)                               /* D1   = d1 + b1*s */ \
+            __ASM_EMIT("vmul.f32    " X ", q12, " X)                                /* X    = b2*s */ \
+            __ASM_EMIT("vmla.f32    " D1 ", q13, " D0)                              /* D1   = d0' = d1 + b1*s + a1*s2 */ \
+            __ASM_EMIT("vmla.f32    " X ", q14, " D0)                               /* X    = d1' = b2*s + a2*s2 */
+
+        #define BIQUAD_MC_LOAD(IDX, Q) \
+            __ASM_EMIT("ldr         %[p], [%[src], #" IDX "]") \
+            __ASM_EMIT("add         %[p], %[p], %[off]") \
+            __ASM_EMIT("vld1.32     {" Q "}, [%[p]]")
+
+        #define BIQUAD_MC_STORE(IDX, Q) \
+            __ASM_EMIT("ldr         %[p], [%[dst], #" IDX "]") \
+            __ASM_EMIT("add         %[p], %[p], %[off]") \
+            __ASM_EMIT("vst1.32     {" Q "}, [%[p]]")
+
+        #define BIQUAD_MC_LOAD1(IDX, D) \
+            __ASM_EMIT("ldr         %[p], [%[src], #" IDX "]") \
+            __ASM_EMIT("add         %[p], %[p], %[off]") \
+            __ASM_EMIT("vld1.32     {" D "}, [%[p]]")
+
+        #define BIQUAD_MC_STORE1(IDX, D) \
+            __ASM_EMIT("ldr         %[p], [%[dst], #" IDX "]") \
+            __ASM_EMIT("add         %[p], %[p], %[off]") \
+            __ASM_EMIT("vst1.32     {" D "}, [%[p]]")
+
+        /*
+         * Loop over cascades: the fp register points to the current cascade, the filter
+         * memory of the cascade is loaded into q8 and q9, the coefficients are loaded into
+         * q10-q14 before processing the block of samples
+         */
+        #define BIQUAD_MC_CASCADE_BEGIN(L) \
+            __ASM_EMIT("mov         %[fp], %[f]") \
+            __ASM_EMIT(L ":") \
+            __ASM_EMIT("vldr        d16, [%[fp], #0x00]") \
+            __ASM_EMIT("vldr        d17, [%[fp], #0x08]")                       /* q8   = d0 */ \
+            __ASM_EMIT("vldr        d18, [%[fp], #0x20]") \
+            __ASM_EMIT("vldr        d19, [%[fp], #0x28]")                       /* q9   = d1 */ \
+            __ASM_EMIT("add         %[p], %[fp], #" LSP_DSP_BIQUAD_XN_SOFF) \
+            __ASM_EMIT("vldr        d20, [%[p], #0x00]") \
+            __ASM_EMIT("vldr        d21, [%[p], #0x08]")                        /* q10  = b0 */ \
+            __ASM_EMIT("vldr        d22, [%[p], #0x20]") \
+            __ASM_EMIT("vldr        d23, [%[p], #0x28]")                        /* q11  = b1 */ \
+            __ASM_EMIT("vldr        d24, [%[p], #0x40]") \
+            __ASM_EMIT("vldr        d25, [%[p], #0x48]")                        /* q12  = b2 */ \
+            __ASM_EMIT("vldr        d26, [%[p], #0x60]") \
+            __ASM_EMIT("vldr        d27, [%[p], #0x68]")                        /* q13  = a1 */ \
+            __ASM_EMIT("vldr        d28, [%[p], #0x80]") \
+            __ASM_EMIT("vldr        d29, [%[p], #0x88]")                        /* q14  = a2 */
+
+        /*
+         * Store the updated filter memory of the cascade, D0L, D0H, D1L and D1H are
+         * the lower and the upper halves of registers that contain d0 and d1
+         */
+        #define BIQUAD_MC_CASCADE_STORE(D0L, D0H, D1L, D1H) \
+            __ASM_EMIT("vstr        " D0L ", [%[fp], #0x00]") \
+            __ASM_EMIT("vstr        " D0H ", [%[fp], #0x08]") \
+            __ASM_EMIT("vstr        " D1L ", [%[fp], #0x20]") \
+            __ASM_EMIT("vstr        " D1H ", [%[fp], #0x28]")
+
+        #define BIQUAD_MC_CASCADE_END(L) \
+            __ASM_EMIT("add         %[fp], %[fp], #0x100")                      /* fp   = next cascade */ \
+            __ASM_EMIT("cmp         %[fp], %[fe]") \
+            __ASM_EMIT("blo         " L "b")
+
+        /*
+         * Process four channels by the array of x8 filter banks, the f pointer is shifted
+         * to the lane of the first bank that corresponds to the first channel, the fe
+         * pointer is shifted in the same way and points to the end of the array
+         */
+        static inline void biquad_process_mc4(float * const *dst, const float * const *src, size_t count, float *f, const float *fe)
+        {
+            IF_ARCH_ARM(
+                size_t off;
+                const float *p;
+                float *fp;
+            );
+
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("mov         %[off], #0")
+
+                // 4x blocks: transpose samples, process by all cascades and transpose back
+                __ASM_EMIT("subs        %[count], #4")
+                __ASM_EMIT("blo         2f")
+                __ASM_EMIT("1:")
+                BIQUAD_MC_LOAD("0x00", "q0")                                    // q0   = a0 a1 a2 a3
+                BIQUAD_MC_LOAD("0x04", "q1")                                    // q1   = b0 b1 b2 b3
+                BIQUAD_MC_LOAD("0x08", "q2")                                    // q2   = c0 c1 c2 c3
+                BIQUAD_MC_LOAD("0x0c", "q3")                                    // q3   = d0 d1 d2 d3
+                BIQUAD_MC_TRANSPOSE("q0", "q1", "q2", "q3", "d1", "d3", "d4", "d6")
+                BIQUAD_MC_CASCADE_BEGIN("5")
+                BIQUAD_MC_FILTER("q8", "q9", "q0")                              // q8   = s2[0], q9 = d0, q0 = d1
+                BIQUAD_MC_FILTER("q9", "q0", "q1")                              // q9   = s2[1], q0 = d0, q1 = d1
+                BIQUAD_MC_FILTER("q0", "q1", "q2")                              // q0   = s2[2], q1 = d0, q2 = d1
+                BIQUAD_MC_FILTER("q1", "q2", "q3")                              // q1   = s2[3], q2 = d0, q3 = d1
+                BIQUAD_MC_CASCADE_STORE("d4", "d5", "d6", "d7")
+                __ASM_EMIT("vmov        q3, q1")                                // q3   = s2[3]
+                __ASM_EMIT("vmov        q2, q0")                                // q2   = s2[2]
+                __ASM_EMIT("vmov        q1, q9")                                // q1   = s2[1]
+                __ASM_EMIT("vmov        q0, q8")                                // q0   = s2[0]
+                BIQUAD_MC_CASCADE_END("5")
+                BIQUAD_MC_TRANSPOSE("q0", "q1", "q2", "q3", "d1", "d3", "d4", "d6")
+                BIQUAD_MC_STORE("0x00", "q0")
+                BIQUAD_MC_STORE("0x04", "q1")
+                BIQUAD_MC_STORE("0x08", "q2")
+                BIQUAD_MC_STORE("0x0c", "q3")
+                __ASM_EMIT("add         %[off], #0x10")
+                __ASM_EMIT("subs        %[count], #4")
+                __ASM_EMIT("bhs         1b")
+
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds        %[count], #4")
+                __ASM_EMIT("beq         4f")
+                __ASM_EMIT("3:")
+                BIQUAD_MC_LOAD1("0x00", "d0[0]")
+                BIQUAD_MC_LOAD1("0x04", "d0[1]")
+                BIQUAD_MC_LOAD1("0x08", "d1[0]")
+                BIQUAD_MC_LOAD1("0x0c", "d1[1]")                                // q0   = a b c d
+                BIQUAD_MC_CASCADE_BEGIN("6")
+                BIQUAD_MC_FILTER("q8", "q9", "q0")                              // q8   = s2, q9 = d0, q0 = d1
+                BIQUAD_MC_CASCADE_STORE("d18", "d19", "d0", "d1")
+                __ASM_EMIT("vmov        q0, q8")                                // q0   = s2
+                BIQUAD_MC_CASCADE_END("6")
+                BIQUAD_MC_STORE1("0x00", "d0[0]")
+                BIQUAD_MC_STORE1("0x04", "d0[1]")
+                BIQUAD_MC_STORE1("0x08", "d1[0]")
+                BIQUAD_MC_STORE1("0x0c", "d1[1]")
+                __ASM_EMIT("add         %[off], #0x04")
+                __ASM_EMIT("subs        %[count], #1")
+                __ASM_EMIT("bne         3b")
+                __ASM_EMIT("4:")
+
+                : [count] "+r" (count),
+                  [off] "=&r" (off), [p] "=&r" (p), [fp] "=&r" (fp)
+                : [dst] "r" (dst), [src] "r" (src),
+                  [f] "r" (f), [fe] "r" (fe)
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3",
+                  "q8", "q9", "q10", "q11",
+                  "q12", "q13", "q14"
+            );
+        }
+
+        void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc)
+        {
+            if (nc <= 0)
+                return;
+
+            // Channels are processed by groups of four, each channel in separate SIMD lane
+            biquad_process_mc4(&dst[0], &src[0], count, &f->d[0], &f[nc].d[0]);
+            biquad_process_mc4(&dst[4], &src[4], count, &f->d[4], &f[nc].d[4]);
+        }
+
+        #undef BIQUAD_MC_CASCADE_END
+        #undef BIQUAD_MC_CASCADE_STORE
+        #undef BIQUAD_MC_CASCADE_BEGIN
+        #undef BIQUAD_MC_STORE1
+        #undef BIQUAD_MC_LOAD1
+        #undef BIQUAD_MC_STORE
+        #undef BIQUAD_MC_LOAD
+        #undef BIQUAD_MC_FILTER
+        #undef BIQUAD_MC_TRANSPOSE
     }
 }
 
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_ARM_NEON_D32_FILTERS_SVF_H_
+#define PRIVATE_DSP_ARCH_ARM_NEON_D32_FILTERS_SVF_H_
+
+#ifndef PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL */
+
+namespace lsp
+{
+    namespace neon_d32
+    {
+        /*
+         * Transpose 4x4 matrix stored in registers QA, QB, QC, QD,
+         * DA1, DB1, DC0 and DD0 are the corresponding halves of these registers
+         */
+        #define SVF_MC_TRANSPOSE(QA, QB, QC, QD, DA1, DB1, DC0, DD0) \
+            __ASM_EMIT("vtrn.32     " QA ", " QB)                                   /* QA   = a0 b0 a2 b2, QB = a1 b1 a3 b3 */ \
+            __ASM_EMIT("vtrn.32     " QC ", " QD)                                   /* QC   = c0 d0 c2 d2, QD = c1 d1 c3 d3 */ \
+            __ASM_EMIT("vswp        " DA1 ", " DC0)                                 /* QA   = a0 b0 c0 d0, QC = a2 b2 c2 d2 */ \
+            __ASM_EMIT("vswp        " DB1 ", " DD0)                                 /* QB   = a1 b1 c1 d1, QD = a3 b3 c3 d3 */
+
+        /*
+         * Apply four state-variable filters to the sample of four channels stored in register X,
+         * q8 and q9 contain the filter memory ic1 and ic2, q10-q13 are used as temporary.
+         * The coefficients are loaded from the f pointer with the stride sz, so after the
+         * processing the f pointer is moved to the filter bank for the next sample
+         */
+        #define SVF_MC_FILTER(X) \
+            __ASM_EMIT("vld1.32     {q10}, [%[f]], %[sz]")                          /* q10  = g */ \
+            __ASM_EMIT("vld1.32     {q11}, [%[f]], %[sz]")                          /* q11  = k */ \
+            __ASM_EMIT("vmov.f32    q12, #1.0")                                     /* q12  = 1 */ \
+            __ASM_EMIT("vadd.f32    q11, q11, q10")                                 /* q11  = g + k */ \
+            __ASM_EMIT("vmla.f32    q12, q11, q10")                                 /* q12  = D = 1 + g*(g + k) */ \
+            __ASM_EMIT("vrecpe.f32  q11, q12")                                      /* q11  = R */ \
+            __ASM_EMIT("vrecps.f32  q13, q11, q12")                                 /* q13  = (2 - R*D) */ \
+            __ASM_EMIT("vmul.f32    q11, q13, q11")                                 /* q11  = R' = R*(2 - R*D) */ \
+            __ASM_EMIT("vrecps.f32  q13, q11, q12")                                 /* q13  = (2 - R'*D) */ \
+            __ASM_EMIT("vmul.f32    q11, q13, q11")                                 /* q11  = a = R'*(2 - R'*D) = 1/D */ \
+            __ASM_EMIT("vsub.f32    q12, " X ", q9")                                /* q12  = x - ic2 */ \
+            __ASM_EMIT("vmov        q13, q8")                                       /* q13  = ic1 */ \
+            __ASM_EMIT("vmla.f32    q13, q12, q10")                                 /* q13  = ic1 + g*(x - ic2) */ \
+            __ASM_EMIT("vmul.f32    q11, q13, q11")                                 /* q11  = v1 = a*(ic1 + g*(x - ic2)) */ \
+            __ASM_EMIT("vld1.32     {q12}, [%[f]], %[sz]")                          /* q12  = m0 */ \
+            __ASM_EMIT("vld1.32     {q13}, [%[f]], %[sz]")                          /* q13  = m1 */ \
+            __ASM_EMIT("vmul.f32    " X ", " X ", q12")                             /* X    = m0*x */ \
+            __ASM_EMIT("vmla.f32    " X ", q11, q13")                               /* X    = m0*x + m1*v1 */ \
+            __ASM_EMIT("vadd.f32    q12, q11, q11")                                 /* q12  = 2*v1 */ \
+            __ASM_EMIT("vmov        q13, q9")                                       /* q13  = ic2 */ \
+            __ASM_EMIT("vsub.f32    q8, q12, q8")                                   /* q8   = ic1' = 2*v1 - ic1 */ \
+            __ASM_EMIT("vmla.f32    q13, q11, q10")                                 /* q13  = v2 = ic2 + g*v1 */ \
+            __ASM_EMIT("vld1.32     {q12}, [%[f]], %[sz]")                          /* q12  = m2 */ \
+            __ASM_EMIT("vmla.f32    " X ", q13, q12")                               /* X    = y = m0*x + m1*v1 + m2*v2 */ \
+            __ASM_EMIT("vadd.f32    q12, q13, q13")                                 /* q12  = 2*v2 */ \
+            __ASM_EMIT("vsub.f32    q9, q12, q9")                                   /* q9   = ic2' = 2*v2 - ic2 */
+
+        #define SVF_MC_LOAD(IDX, Q) \
+            __ASM_EMIT("ldr         %[p], [%[src], #" IDX "]") \
+            __ASM_EMIT("add         %[p], %[p], %[off]") \
+            __ASM_EMIT("vld1.32     {" Q "}, [%[p]]")
+
+        #define SVF_MC_STORE(IDX, Q) \
+            __ASM_EMIT("ldr         %[p], [%[dst], #" IDX "]") \
+            __ASM_EMIT("add         %[p], %[p], %[off]") \
+            __ASM_EMIT("vst1.32     {" Q "}, [%[p]]")
+
+        /*
+         * Process four channels by the state-variable filter banks, the f pointer is shifted
+         * to the filter that corresponds to the first channel, sz is the distance in bytes
+         * between coefficients of the filter bank and between the ic1 and ic2 filter memory
+         */
+        static inline void svf_process_mc4(float * const *dst, const float * const *src, float *d, size_t count, const float *f, size_t sz)
+        {
+            IF_ARCH_ARM(
+                size_t off;
+                const float *p;
+            );
+
+            ARCH_ARM_ASM
+            (
+                // Load filter memory
+                __ASM_EMIT("mov         %[p], %[d]")
+                __ASM_EMIT("vld1.32     {q8}, [%[p]], %[sz]")                   // q8   = ic1
+                __ASM_EMIT("vld1.32     {q9}, [%[p]]")                          // q9   = ic2
+                __ASM_EMIT("mov         %[off], #0")
+
+                // 4x blocks: transpose samples, process and transpose back
+                __ASM_EMIT("subs        %[count], #4")
+                __ASM_EMIT("blo         2f")
+                __ASM_EMIT("1:")
+                SVF_MC_LOAD("0x00", "q0")                                       // q0   = a0 a1 a2 a3
+                SVF_MC_LOAD("0x04", "q1")                                       // q1   = b0 b1 b2 b3
+                SVF_MC_LOAD("0x08", "q2")                                       // q2   = c0 c1 c2 c3
+                SVF_MC_LOAD("0x0c", "q3")                                       // q3   = d0 d1 d2 d3
+                SVF_MC_TRANSPOSE("q0", "q1", "q2", "q3", "d1", "d3", "d4", "d6")
+                SVF_MC_FILTER("q0")
+                SVF_MC_FILTER("q1")
+                SVF_MC_FILTER("q2")
+                SVF_MC_FILTER("q3")
+                SVF_MC_TRANSPOSE("q0", "q1", "q2", "q3", "d1", "d3", "d4", "d6")
+                SVF_MC_STORE("0x00", "q0")
+                SVF_MC_STORE("0x04", "q1")
+                SVF_MC_STORE("0x08", "q2")
+                SVF_MC_STORE("0x0c", "q3")
+                __ASM_EMIT("add         %[off], #0x10")
+                __ASM_EMIT("subs        %[count], #4")
+                __ASM_EMIT("bhs         1b")
+
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds        %[count], #4")
+                __ASM_EMIT("beq         4f")
+                __ASM_EMIT("3:")
+                SVF_MC_LOAD("0x00", "d0[0]")
+                SVF_MC_LOAD("0x04", "d0[1]")
+                SVF_MC_LOAD("0x08", "d1[0]")
+                SVF_MC_LOAD("0x0c", "d1[1]")                                    // q0   = a b c d
+                SVF_MC_FILTER("q0")
+                SVF_MC_STORE("0x00", "d0[0]")
+                SVF_MC_STORE("0x04", "d0[1]")
+                SVF_MC_STORE("0x08", "d1[0]")
+                SVF_MC_STORE("0x0c", "d1[1]")
+                __ASM_EMIT("add         %[off], #0x04")
+                __ASM_EMIT("subs        %[count], #1")
+                __ASM_EMIT("bne         3b")
+
+                // Store the updated filter memory
+                __ASM_EMIT("4:")
+                __ASM_EMIT("mov         %[p], %[d]")
+                __ASM_EMIT("vst1.32     {q8}, [%[p]], %[sz]")
+                __ASM_EMIT("vst1.32     {q9}, [%[p]]")
+
+                : [count] "+r" (count), [f] "+r" (f),
+                  [off] "=&r" (off), [p] "=&r" (p)
+                : [dst] "r" (dst), [src] "r" (src),
+                  [d] "r" (d), [sz] "r" (sz)
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3",
+                  "q8", "q9", "q10", "q11",
+                  "q12", "q13"
+            );
+        }
+
+        void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f)
+        {
+            svf_process_mc4(dst, src, d, count, &f->g[0], sizeof(f->g));
+        }
+
+        void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f)
+        {
+            // Channels are processed by groups of four, each channel in separate SIMD lane
+            svf_process_mc4(&dst[0], &src[0], &d[0], count, &f->g[0], sizeof(f->g));
+            svf_process_mc4(&dst[4], &src[4], &d[4], count, &f->g[4], sizeof(f->g));
+        }
+
+        #undef SVF_MC_STORE
+        #undef SVF_MC_LOAD
+        #undef SVF_MC_FILTER
+        #undef SVF_MC_TRANSPOSE
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_FILTERS_SVF_H_ */
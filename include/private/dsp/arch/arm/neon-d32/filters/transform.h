@@ -26,6 +26,10 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL */
 
+#include <private/dsp/arch/arm/neon-d32/pmath/exp.h>
+
+#define MATCHED_BATCH           64          /* Number of second-order polynoms solved at once */
+
 //    if (count <= 0)
 //        return;
 //
@@ -535,7 +539,631 @@ namespace lsp
                   "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
             );
         }
+
+        IF_ARCH_ARM(
+            static const uint32_t MATCHED_CONST[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0x3c23d70a),   // 0.01
+                LSP_DSP_VEC4(0x3dcccccd),   // 0.1
+                LSP_DSP_VEC4(0x40800000),   // 4.0
+                LSP_DSP_VEC4(0x3e22f983),   // 1/(2*PI)
+                LSP_DSP_VEC4(0x3f000000),   // 0.5
+                LSP_DSP_VEC4(0x40c90fdb),   // 2*PI
+                LSP_DSP_VEC4(0x3fc90fdb),   // PI/2
+                LSP_DSP_VEC4(0xb2d7322b),   // -1/11!
+                LSP_DSP_VEC4(0x3638ef1d),   // 1/9!
+                LSP_DSP_VEC4(0xb9500d01),   // -1/7!
+                LSP_DSP_VEC4(0x3c088889),   // 1/5!
+                LSP_DSP_VEC4(0xbe2aaaab),   // -1/3!
+                LSP_DSP_VEC4(0x3f800000),   // 1.0
+                LSP_DSP_VEC4(0x3ea2f983),   // 1/PI
+                LSP_DSP_VEC4(0x40490fdb),   // PI
+                LSP_DSP_VEC4(0x39500d01),   // 1/7!
+                LSP_DSP_VEC4(0x3ab60b61),   // 1/6!
+                LSP_DSP_VEC4(0x3c088889),   // 1/5!
+                LSP_DSP_VEC4(0x3d2aaaab),   // 1/4!
+                LSP_DSP_VEC4(0x3e2aaaab)    // 1/3!
+            };
+        )
+
+        typedef struct matched_ctx_t
+        {
+            float           w[12] __lsp_aligned16;  // td*kf/2, td*kf/20 and temporary, 4 copies each
+            float          *vp[MATCHED_BATCH + 3];  // Batch of second-order polynoms
+            size_t          n;                      // Number of polynoms in the batch
+        } matched_ctx_t;
+
+        /*
+         * Compute X = sqrt(X) using two Newton-Raphson iterations for 1/sqrt(X), T1 and T2 are temporaries
+         */
+        #define MATCHED_SQRT(X, T1, T2) \
+            __ASM_EMIT("vrsqrte.f32     " T1 ", " X)                        /* T1   = r0 */ \
+            __ASM_EMIT("vmul.f32        " T2 ", " T1 ", " X)                /* T2   = X * r0 */ \
+            __ASM_EMIT("vrsqrts.f32     " T2 ", " T2 ", " T1)               /* T2   = (3 - X * r0 * r0) / 2 */ \
+            __ASM_EMIT("vmul.f32        " T1 ", " T1 ", " T2)               /* T1   = r1 = r0 * (3 - X * r0 * r0) / 2 */ \
+            __ASM_EMIT("vmul.f32        " T2 ", " T1 ", " X)                /* T2   = X * r1 */ \
+            __ASM_EMIT("vrsqrts.f32     " T2 ", " T2 ", " T1)               /* T2   = (3 - X * r1 * r1) / 2 */ \
+            __ASM_EMIT("vmul.f32        " T1 ", " T1 ", " T2)               /* T1   = r2 = 1/sqrt(X) */ \
+            __ASM_EMIT("vmul.f32        " T1 ", " T1 ", " X)                /* T1   = X/sqrt(X) = sqrt(X) */ \
+            __ASM_EMIT("vcgt.f32        " T2 ", " X ", #0")                 /* T2   = [X > 0] */ \
+            __ASM_EMIT("vand            " X ", " T1 ", " T2)                /* X    = sqrt(X) & [X > 0] */
+
+        /*
+         * Compute D = 1/X using two Newton-Raphson iterations, T is temporary
+         */
+        #define MATCHED_RCP(D, X, T) \
+            __ASM_EMIT("vrecpe.f32      " D ", " X)                         /* D    = r0 */ \
+            __ASM_EMIT("vrecps.f32      " T ", " D ", " X)                  /* T    = (2 - X * r0) */ \
+            __ASM_EMIT("vmul.f32        " D ", " D ", " T)                  /* D    = r1 = r0 * (2 - X * r0) */ \
+            __ASM_EMIT("vrecps.f32      " T ", " D ", " X)                  /* T    = (2 - X * r1) */ \
+            __ASM_EMIT("vmul.f32        " D ", " D ", " T)                  /* D    = r2 = 1/X */
+
+        /*
+         * Compute q0 = sqrt(Q) = sqrt(expm1(x)^2 + 4*E*sin(y)^2) for q0 = x, q4 = y and E = exp(x),
+         * q2, q4, q6, q8-q13 are clobbered. The expm1(x) is computed by the Taylor series for
+         * abs(x) < 0.5 to keep the precision when exp(x) is close to 1
+         */
+        #define MATCHED_AMP_X4(E) \
+            __ASM_EMIT("add             %[p], %[MC], #0xf0") \
+            __ASM_EMIT("vldm            %[p], {q8-q12}")                /* q8   = 1/7!, q9 = 1/6!, q10 = 1/5!, q11 = 1/4!, q12 = 1/3! */ \
+            __ASM_EMIT("vmul.f32        q6, q0, q8")                    /* q6   = x/7! */ \
+            __ASM_EMIT("vadd.f32        q6, q6, q9")                    /* q6   = 1/6! + x/7! */ \
+            __ASM_EMIT("vmul.f32        q6, q6, q0") \
+            __ASM_EMIT("vadd.f32        q6, q6, q10")                   /* q6   = 1/5! + x*(...) */ \
+            __ASM_EMIT("vmul.f32        q6, q6, q0") \
+            __ASM_EMIT("vadd.f32        q6, q6, q11")                   /* q6   = 1/4! + x*(...) */ \
+            __ASM_EMIT("vmul.f32        q6, q6, q0") \
+            __ASM_EMIT("vadd.f32        q6, q6, q12")                   /* q6   = 1/3! + x*(...) */ \
+            __ASM_EMIT("add             %[p], %[MC], #0x40") \
+            __ASM_EMIT("vld1.32         {q8}, [%[p]]")                  /* q8   = 0.5 */ \
+            __ASM_EMIT("add             %[p], %[MC], #0xc0") \
+            __ASM_EMIT("vldm            %[p], {q9-q11}")                /* q9   = 1.0, q10 = 1/PI, q11 = PI */ \
+            __ASM_EMIT("vmul.f32        q6, q6, q0") \
+            __ASM_EMIT("vadd.f32        q6, q6, q8")                    /* q6   = 1/2! + x*(...) */ \
+            __ASM_EMIT("vmul.f32        q6, q6, q0") \
+            __ASM_EMIT("vadd.f32        q6, q6, q9")                    /* q6   = 1 + x*(...) */ \
+            __ASM_EMIT("vmul.f32        q6, q6, q0")                    /* q6   = x*(1 + x*(...)) */ \
+            __ASM_EMIT("vabs.f32        q2, q0")                        /* q2   = abs(x) */ \
+            __ASM_EMIT("vsub.f32        q12, " E ", q9")                /* q12  = exp(x) - 1 */ \
+            __ASM_EMIT("vclt.f32        q2, q2, q8")                    /* q2   = [abs(x) < 0.5] */ \
+            __ASM_EMIT("vbif            q6, q12, q2")                   /* q6   = M = expm1(x) */ \
+            __ASM_EMIT("vmul.f32        q6, q6, q6")                    /* q6   = M*M */ \
+            /* sin(y)^2 = sin(y - PI*n)^2 */ \
+            __ASM_EMIT("vabs.f32        q4, q4")                        /* q4   = abs(y) */ \
+            __ASM_EMIT("vmul.f32        q0, q4, q10")                   /* q0   = abs(y)/PI */ \
+            __ASM_EMIT("vadd.f32        q0, q0, q8")                    /* q0   = abs(y)/PI + 0.5 */ \
+            __ASM_EMIT("vcvt.s32.f32    q0, q0") \
+            __ASM_EMIT("vcvt.f32.s32    q0, q0")                        /* q0   = n = int(abs(y)/PI + 0.5) */ \
+            __ASM_EMIT("vmul.f32        q0, q0, q11")                   /* q0   = PI*n */ \
+            __ASM_EMIT("vsub.f32        q0, q4, q0")                    /* q0   = abs(y) - PI*n */ \
+            __ASM_EMIT("add             %[p], %[MC], #0x70") \
+            __ASM_EMIT("vldm            %[p], {q8-q13}")                /* q8   = S5, q9 = S4, q10 = S3, q11 = S2, q12 = S1, q13 = 1.0 */ \
+            __ASM_EMIT("vmul.f32        q2, q0, q0")                    /* q2   = y2 = y*y */ \
+            __ASM_EMIT("vmul.f32        q4, q2, q8")                    /* q4   = S5*y2 */ \
+            __ASM_EMIT("vadd.f32        q4, q4, q9")                    /* q4   = S4 + S5*y2 */ \
+            __ASM_EMIT("vmul.f32        q4, q4, q2") \
+            __ASM_EMIT("vadd.f32        q4, q4, q10")                   /* q4   = S3 + y2*(S4 + S5*y2) */ \
+            __ASM_EMIT("vmul.f32        q4, q4, q2") \
+            __ASM_EMIT("vadd.f32        q4, q4, q11")                   /* q4   = S2 + y2*(S3 + y2*(S4 + S5*y2)) */ \
+            __ASM_EMIT("vmul.f32        q4, q4, q2") \
+            __ASM_EMIT("vadd.f32        q4, q4, q12")                   /* q4   = S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2))) */ \
+            __ASM_EMIT("vmul.f32        q4, q4, q2") \
+            __ASM_EMIT("vadd.f32        q4, q4, q13")                   /* q4   = 1 + y2*(S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2)))) */ \
+            __ASM_EMIT("vmul.f32        q4, q4, q0")                    /* q4   = sin(y) */ \
+            __ASM_EMIT("add             %[p], %[MC], #0x20") \
+            __ASM_EMIT("vld1.32         {q8}, [%[p]]")                  /* q8   = 4.0 */ \
+            __ASM_EMIT("vmul.f32        q4, q4, q4")                    /* q4   = sin(y)^2 */ \
+            __ASM_EMIT("vmul.f32        q2, " E ", q8")                 /* q2   = 4*exp(x) */ \
+            __ASM_EMIT("vmul.f32        q4, q4, q2")                    /* q4   = 4*exp(x)*sin(y)^2 */ \
+            __ASM_EMIT("vadd.f32        q0, q6, q4")                    /* q0   = Q = M*M + 4*exp(x)*sin(y)^2 */ \
+            MATCHED_SQRT("q0", "q2", "q4")                              /* q0   = sqrt(Q) */
+
+        /*
+         * Solve the batch of second-order polynoms, count should be multiple of 4:
+         *   p[0] = k, p[1] = -k*(exp(R0*T) + exp(R1*T)), p[2] = k*exp((R0+R1)*T) for real roots R0 and R1
+         *   p[0] = k, p[1] = -2*k*exp(R*T)*cos(K*T), p[2] = k*exp(2*R*T) for complex roots R+j*K and R-j*K
+         * Both cases are computed by the same formula
+         *   p[1] = -k*(exp(m - wr) + exp(m + wr))*cos(wc), p[2] = k*exp(m - wr)*exp(m + wr)
+         * where m = -R*T, wr = sqrt(D)*T/2 for D >= 0 and wc = sqrt(-D)*T/2 for D < 0
+         *
+         * The amplitude of the transformed polynom at the control frequency w is computed by roots:
+         *   A = abs(k) * sqrt(Q(m - wr, v - wc/2)) * sqrt(Q(m + wr, v + wc/2)), v = w/2
+         *   Q(x, y) = expm1(x)^2 + 4*exp(x)*sin(y)^2
+         * and p[3] receives the ratio of the continuous transfer function amplitude to A
+         */
+        static void matched_solve_x4(float * const *vp, size_t count, const float *w)
+        {
+            IF_ARCH_ARM(float *p);
+
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("vldm            %[LOG2E], {q15}")               // q15  = log2(e)
+                __ASM_EMIT("1:")
+                // Load polynoms and transpose
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x00]")
+                __ASM_EMIT("vld1.32         {q0}, [%[p]]")                  // q0   = p0[0] p1[0] p2[0] p3[0]
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x04]")
+                __ASM_EMIT("vld1.32         {q1}, [%[p]]")                  // q1   = p0[1] p1[1] p2[1] p3[1]
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x08]")
+                __ASM_EMIT("vld1.32         {q2}, [%[p]]")                  // q2   = p0[2] p1[2] p2[2] p3[2]
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x0c]")
+                __ASM_EMIT("vld1.32         {q3}, [%[p]]")                  // q3   = p0[3] p1[3] p2[3] p3[3]
+                __ASM_EMIT("vzip.32         q0, q2")
+                __ASM_EMIT("vzip.32         q1, q3")
+                __ASM_EMIT("vzip.32         q0, q1")                        // q0   = P0, q1 = P1
+                __ASM_EMIT("vzip.32         q2, q3")                        // q2   = P2
+                __ASM_EMIT("vldm            %[MC], {q8-q10}")               // q8   = 0.01, q9 = 0.1, q10 = 4.0
+                __ASM_EMIT("vld1.32         {q11}, [%[w]]")                 // q11  = H
+                // Transfer function
+                __ASM_EMIT("vmul.f32        q4, q2, q8")                    // q4   = P2*0.01
+                __ASM_EMIT("vmul.f32        q5, q1, q9")                    // q5   = C = P1*0.1
+                __ASM_EMIT("vsub.f32        q4, q0, q4")                    // q4   = B = P0 - P2*0.01
+                __ASM_EMIT("vmul.f32        q5, q5, q5")                    // q5   = C*C
+                __ASM_EMIT("vmul.f32        q4, q4, q4")                    // q4   = B*B
+                __ASM_EMIT("vadd.f32        q7, q4, q5")                    // q7   = B*B + C*C
+                MATCHED_SQRT("q7", "q4", "q5")                              // q7   = P3 = sqrt(B*B + C*C)
+                __ASM_EMIT("add             %[p], %[w], #0x20")
+                __ASM_EMIT("vst1.32         {q7}, [%[p]]")
+                // Roots
+                __ASM_EMIT("vmov            q3, q2")                        // q3   = K = P2
+                MATCHED_RCP("q4", "q2", "q5")                               // q4   = 1/P2
+                __ASM_EMIT("vmul.f32        q1, q1, q4")                    // q1   = X = P1/P2
+                __ASM_EMIT("vmul.f32        q0, q0, q4")                    // q0   = Y = P0/P2
+                __ASM_EMIT("vmul.f32        q4, q1, q1")                    // q4   = X*X
+                __ASM_EMIT("vmul.f32        q0, q0, q10")                   // q0   = 4*Y
+                __ASM_EMIT("vmul.f32        q1, q1, q11")                   // q1   = X*H
+                __ASM_EMIT("vsub.f32        q4, q4, q0")                    // q4   = D = X*X - 4*Y
+                __ASM_EMIT("vcge.f32        q2, q4, #0")                    // q2   = [D >= 0]
+                __ASM_EMIT("vabs.f32        q4, q4")                        // q4   = abs(D)
+                __ASM_EMIT("vneg.f32        q1, q1")                        // q1   = m = -X*H
+                MATCHED_SQRT("q4", "q5", "q6")                              // q4   = sqrt(abs(D))
+                __ASM_EMIT("vmul.f32        q4, q4, q11")                   // q4   = W = sqrt(abs(D))*H
+                __ASM_EMIT("vand            q5, q4, q2")                    // q5   = wr = W & [D >= 0]
+                __ASM_EMIT("vbic            q4, q4, q2")                    // q4   = wc = W & [D < 0]
+                __ASM_EMIT("vsub.f32        q0, q1, q5")                    // q0   = m - wr
+                __ASM_EMIT("vadd.f32        q5, q1, q5")                    // q5   = m + wr
+                __ASM_EMIT("vmov            q1, q4")                        // q1   = wc
+                __ASM_EMIT("vmov            q14, q0")                       // q14  = m - wr
+                // Exponents and amplitude of the transformed polynom
+                EXP_CORE_X4                                                 // q0   = E1 = exp(m - wr)
+                __ASM_EMIT("vmov            q7, q0")                        // q7   = E1
+                __ASM_EMIT("add             %[p], %[w], #0x10")
+                __ASM_EMIT("vld1.32         {q4}, [%[p]]")                  // q4   = v
+                __ASM_EMIT("add             %[p], %[MC], #0x40")
+                __ASM_EMIT("vld1.32         {q8}, [%[p]]")                  // q8   = 0.5
+                __ASM_EMIT("vmul.f32        q2, q1, q8")                    // q2   = wc/2
+                __ASM_EMIT("vmov            q0, q14")                       // q0   = m - wr
+                __ASM_EMIT("vsub.f32        q4, q4, q2")                    // q4   = v - wc/2
+                MATCHED_AMP_X4("q7")                                        // q0   = sqrt(Q(m - wr, v - wc/2))
+                __ASM_EMIT("vmov            q14, q0")                       // q14  = sqrt(Q1)
+                __ASM_EMIT("vmov            q0, q5")
+                EXP_CORE_X4                                                 // q0   = E2 = exp(m + wr)
+                __ASM_EMIT("vswp            q0, q5")                        // q0   = m + wr, q5 = E2
+                __ASM_EMIT("add             %[p], %[w], #0x10")
+                __ASM_EMIT("vld1.32         {q4}, [%[p]]")                  // q4   = v
+                __ASM_EMIT("add             %[p], %[MC], #0x40")
+                __ASM_EMIT("vld1.32         {q8}, [%[p]]")                  // q8   = 0.5
+                __ASM_EMIT("vmul.f32        q2, q1, q8")                    // q2   = wc/2
+                __ASM_EMIT("vadd.f32        q4, q4, q2")                    // q4   = v + wc/2
+                MATCHED_AMP_X4("q5")                                        // q0   = sqrt(Q(m + wr, v + wc/2))
+                __ASM_EMIT("vabs.f32        q2, q3")                        // q2   = abs(K)
+                __ASM_EMIT("vmul.f32        q0, q0, q14")                   // q0   = sqrt(Q1*Q2)
+                __ASM_EMIT("vmul.f32        q0, q0, q2")                    // q0   = A = abs(K)*sqrt(Q1*Q2)
+                MATCHED_RCP("q4", "q0", "q6")                               // q4   = 1/A
+                __ASM_EMIT("add             %[p], %[w], #0x20")
+                __ASM_EMIT("vld1.32         {q6}, [%[p]]")                  // q6   = P3
+                __ASM_EMIT("vadd.f32        q14, q7, q5")                   // q14  = E1+E2
+                __ASM_EMIT("vmul.f32        q5, q7, q5")                    // q5   = E1*E2
+                __ASM_EMIT("vmul.f32        q7, q6, q4")                    // q7   = P3' = P3/A
+                // Cosine: cos(wc) = sin(PI/2 - abs(wc - 2*PI*n))
+                __ASM_EMIT("add             %[p], %[MC], #0x30")
+                __ASM_EMIT("vldm            %[p]!, {q8-q13}")               // q8   = 1/(2*PI), q9 = 0.5, q10 = 2*PI, q11 = PI/2, q12 = S5, q13 = S4
+                __ASM_EMIT("vmul.f32        q0, q1, q8")                    // q0   = wc/(2*PI)
+                __ASM_EMIT("vadd.f32        q0, q0, q9")                    // q0   = wc/(2*PI) + 0.5
+                __ASM_EMIT("vcvt.s32.f32    q0, q0")
+                __ASM_EMIT("vcvt.f32.s32    q0, q0")                        // q0   = n = int(wc/(2*PI) + 0.5)
+                __ASM_EMIT("vmul.f32        q0, q0, q10")                   // q0   = 2*PI*n
+                __ASM_EMIT("vsub.f32        q1, q1, q0")                    // q1   = wc - 2*PI*n
+                __ASM_EMIT("vabs.f32        q1, q1")                        // q1   = abs(wc - 2*PI*n)
+                __ASM_EMIT("vsub.f32        q0, q11, q1")                   // q0   = y = PI/2 - abs(wc - 2*PI*n)
+                __ASM_EMIT("vmul.f32        q2, q0, q0")                    // q2   = y2 = y*y
+                __ASM_EMIT("vmul.f32        q4, q2, q12")                   // q4   = S5*y2
+                __ASM_EMIT("vldm            %[p], {q8-q11}")                // q8   = S3, q9 = S2, q10 = S1, q11 = 1.0
+                __ASM_EMIT("vadd.f32        q4, q4, q13")                   // q4   = S4 + S5*y2
+                __ASM_EMIT("vmul.f32        q4, q4, q2")
+                __ASM_EMIT("vadd.f32        q4, q4, q8")                    // q4   = S3 + y2*(S4 + S5*y2)
+                __ASM_EMIT("vmul.f32        q4, q4, q2")
+                __ASM_EMIT("vadd.f32        q4, q4, q9")                    // q4   = S2 + y2*(S3 + y2*(S4 + S5*y2))
+                __ASM_EMIT("vmul.f32        q4, q4, q2")
+                __ASM_EMIT("vadd.f32        q4, q4, q10")                   // q4   = S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2)))
+                __ASM_EMIT("vmul.f32        q4, q4, q2")
+                __ASM_EMIT("vadd.f32        q4, q4, q11")                   // q4   = 1 + y2*(S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2))))
+                __ASM_EMIT("vmul.f32        q4, q4, q0")                    // q4   = cos(wc)
+                // Transformed polynom
+                __ASM_EMIT("vmul.f32        q14, q14, q4")                  // q14  = (E1+E2)*cos(wc)
+                __ASM_EMIT("vmul.f32        q2, q5, q3")                    // q2   = P2' = K*E1*E2
+                __ASM_EMIT("vmul.f32        q1, q14, q3")                   // q1   = K*(E1+E2)*cos(wc)
+                __ASM_EMIT("vmov            q0, q3")                        // q0   = P0' = K
+                __ASM_EMIT("vneg.f32        q1, q1")                        // q1   = P1' = -K*(E1+E2)*cos(wc)
+                __ASM_EMIT("vmov            q3, q7")                        // q3   = P3
+                // Transpose back and store polynoms
+                __ASM_EMIT("vzip.32         q0, q2")
+                __ASM_EMIT("vzip.32         q1, q3")
+                __ASM_EMIT("vzip.32         q0, q1")                        // q0   = p[0], q1 = p[1]
+                __ASM_EMIT("vzip.32         q2, q3")                        // q2   = p[2], q3 = p[3]
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x00]")
+                __ASM_EMIT("vst1.32         {q0}, [%[p]]")
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x04]")
+                __ASM_EMIT("vst1.32         {q1}, [%[p]]")
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x08]")
+                __ASM_EMIT("vst1.32         {q2}, [%[p]]")
+                __ASM_EMIT("ldr             %[p], [%[vp], #0x0c]")
+                __ASM_EMIT("vst1.32         {q3}, [%[p]]")
+                // Repeat loop
+                __ASM_EMIT("add             %[vp], #0x10")
+                __ASM_EMIT("subs            %[count], #4")
+                __ASM_EMIT("bne             1b")
+
+                : [vp] "+r" (vp), [count] "+r" (count),
+                  [p] "=&r" (p)
+                : [w] "r" (w),
+                  [MC] "r" (&MATCHED_CONST[0]),
+                  [E2C] "r" (&EXP2_CONST[0]),
+                  [LOG2E] "r" (&EXP_LOG2E[0])
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3" , "q4", "q5", "q6", "q7",
+                  "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
+            );
+        }
+
+        static void matched_init(matched_ctx_t *ctx, float kf, float td)
+        {
+            float h         = 0.5f * kf * td;
+            float v         = 0.05f * kf * td;
+
+            for (size_t i=0; i<4; ++i)
+            {
+                ctx->w[i]       = h;
+                ctx->w[i+4]     = v;
+            }
+            ctx->n          = 0;
+        }
+
+        static void matched_flush(matched_ctx_t *ctx)
+        {
+            size_t n        = ctx->n;
+            if (n <= 0)
+                return;
+
+            // Pad the batch with the last polynom, it is loaded before the store
+            for ( ; n & 3; ++n)
+                ctx->vp[n]      = ctx->vp[n-1];
+
+            matched_solve_x4(ctx->vp, n, ctx->w);
+            ctx->n          = 0;
+        }
+
+        static void matched_solve(matched_ctx_t *ctx, float *p, float kf, float td, size_t count, size_t stride)
+        {
+            // The order of each polynom is tested individually
+            float s         = sinf(0.05f * kf * td);
+
+            while (count--)
+            {
+                if (p[2] != 0.0) // Test polynom for second-order
+                {
+                    // Second-order polynoms are collected into the batch
+                    ctx->vp[ctx->n++]   = p;
+                    if (ctx->n >= MATCHED_BATCH)
+                    {
+                        matched_solve_x4(ctx->vp, ctx->n, ctx->w);
+                        ctx->n              = 0;
+                    }
+                }
+                else if (p[1] != 0.0) // Test polynom for first order
+                {
+                    // First-order polynom:
+                    //   p(s) = p[0] + p[1]*(s/f)
+                    //
+                    // Transformed polynom:
+                    //   P[z] = p[1]/f - p[1]/f * exp(-f*p[0]*T/p[1]) * z^-1
+                    //
+                    // The p[3] receives the ratio of the continuous transfer function amplitude to
+                    // the amplitude of P[z] at the control frequency w computed by the root E:
+                    //   A = abs(p[1]/f) * sqrt(expm1(R*T)^2 + 4*E*sin(w/2)^2)
+                    float k     = p[1]/kf;
+                    float R     = -p[0]/k;
+                    float E     = expf(R*td);
+                    float M     = expm1f(R*td);
+                    float A     = fabsf(k) * sqrtf(M*M + 4.0f*E*s*s);
+
+                    p[3]        = sqrtf(p[0]*p[0] + p[1]*p[1]*0.01f) / A; // transfer function
+                    p[0]        = k;
+                    p[1]        = -k * E;
+                }
+                else
+                    p[3]        = 1.0f / fabsf(p[0]); // transfer function
+
+                p          += stride;
+            }
+        }
+
+        /*
+         * Compute the normalized filter for four cascades pointed by bc:
+         *   q0 = b0, q1 = b1, q2 = b2, q3 = a1, q4 = a2
+         */
+        #define MATCHED_NORM_X4 \
+            __ASM_EMIT("vldm            %[bc]!, {q0-q7}")               /* {q0, q2, q4, q6} = t[x,0] t[x,1] t[x,2] t[x,3], {q1, q3, q5, q7} = b[x,0] b[x,1] b[x,2] b[x,3] */ \
+            __ASM_EMIT("vzip.32         q0, q4") \
+            __ASM_EMIT("vzip.32         q2, q6") \
+            __ASM_EMIT("vzip.32         q1, q5") \
+            __ASM_EMIT("vzip.32         q3, q7") \
+            __ASM_EMIT("vzip.32         q0, q2")                        /* q0   = t0, q2 = t1 */ \
+            __ASM_EMIT("vzip.32         q4, q6")                        /* q4   = t2, q6 = t3 */ \
+            __ASM_EMIT("vzip.32         q1, q3")                        /* q1   = b0, q3 = b1 */ \
+            __ASM_EMIT("vzip.32         q5, q7")                        /* q5   = b2, q7 = b3 */ \
+            /* Normalize */ \
+            MATCHED_RCP("q8", "q7", "q15")                              /* q8   = 1/b3 */ \
+            __ASM_EMIT("vmul.f32        q14, q6, q8")                   /* q14  = AN = t3/b3 */ \
+            MATCHED_RCP("q8", "q1", "q15")                              /* q8   = N2 = 1/b0 */ \
+            __ASM_EMIT("vmul.f32        q14, q14, q8")                  /* q14  = N1 = AN*N2 */ \
+            __ASM_EMIT("vneg.f32        q8, q8")                        /* q8   = -N2 */ \
+            __ASM_EMIT("vmul.f32        q0, q0, q14")                   /* q0   = b0 = t0*N1 */ \
+            __ASM_EMIT("vmul.f32        q1, q2, q14")                   /* q1   = b1 = t1*N1 */ \
+            __ASM_EMIT("vmul.f32        q2, q4, q14")                   /* q2   = b2 = t2*N1 */ \
+            __ASM_EMIT("vmul.f32        q3, q3, q8")                    /* q3   = a1 = -b1*N2 */ \
+            __ASM_EMIT("vmul.f32        q4, q5, q8")                    /* q4   = a2 = -b2*N2 */
+
+        static void matched_norm_x1(dsp::biquad_x1_t *bf, const dsp::f_cascade_t *bc, const float *w, size_t count)
+        {
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                // Transpose and store
+                __ASM_EMIT("vmov            q8, q4")                        // q8   = a2
+                __ASM_EMIT("vmov            q6, q3")                        // q6   = a1
+                __ASM_EMIT("vmov            q4, q2")                        // q4   = b2
+                __ASM_EMIT("vmov            q2, q1")                        // q2   = b1
+                __ASM_EMIT("vzip.32         q0, q4")
+                __ASM_EMIT("vzip.32         q2, q6")
+                __ASM_EMIT("vzip.32         q0, q2")                        // q0   = b0[0] b1[0] b2[0] a1[0], q2 = b0[1] b1[1] b2[1] a1[1]
+                __ASM_EMIT("vzip.32         q4, q6")                        // q4   = b0[2] b1[2] b2[2] a1[2], q6 = b0[3] b1[3] b2[3] a1[3]
+                __ASM_EMIT("veor            q1, q1, q1")                    // q1   = 0
+                __ASM_EMIT("vzip.32         q8, q1")                        // d16  = a2[0] 0, d17 = a2[1] 0, d2 = a2[2] 0, d3 = a2[3] 0
+                __ASM_EMIT("vmov            d10, d2")
+                __ASM_EMIT("vmov            d14, d3")
+                __ASM_EMIT("vmov            d2, d16")
+                __ASM_EMIT("vmov            d6, d17")
+                __ASM_EMIT("veor            d3, d3, d3")                    // q1   = a2[0] 0 0 0
+                __ASM_EMIT("veor            d7, d7, d7")                    // q3   = a2[1] 0 0 0
+                __ASM_EMIT("veor            d11, d11, d11")                 // q5   = a2[2] 0 0 0
+                __ASM_EMIT("veor            d15, d15, d15")                 // q7   = a2[3] 0 0 0
+                __ASM_EMIT("vstm            %[bf]!, {q0-q7}")
+                // Repeat loop
+                __ASM_EMIT("subs            %[count], #1")
+                __ASM_EMIT("bne             1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w)
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3" , "q4", "q5", "q6", "q7",
+                  "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
+            );
+        }
+
+        static void matched_norm_x2(dsp::biquad_x2_t *bf, const dsp::f_cascade_t *bc, const float *w, size_t count)
+        {
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                __ASM_EMIT("veor            d10, d10, d10")                 // d10  = 0
+                __ASM_EMIT("vstr            d0, [%[bf], #0x00]")
+                __ASM_EMIT("vstr            d2, [%[bf], #0x08]")
+                __ASM_EMIT("vstr            d4, [%[bf], #0x10]")
+                __ASM_EMIT("vstr            d6, [%[bf], #0x18]")
+                __ASM_EMIT("vstr            d8, [%[bf], #0x20]")
+                __ASM_EMIT("vstr            d10, [%[bf], #0x28]")
+                __ASM_EMIT("vstr            d1, [%[bf], #0x30]")
+                __ASM_EMIT("vstr            d3, [%[bf], #0x38]")
+                __ASM_EMIT("vstr            d5, [%[bf], #0x40]")
+                __ASM_EMIT("vstr            d7, [%[bf], #0x48]")
+                __ASM_EMIT("vstr            d9, [%[bf], #0x50]")
+                __ASM_EMIT("vstr            d10, [%[bf], #0x58]")
+                // Repeat loop
+                __ASM_EMIT("add             %[bf], #0x60")
+                __ASM_EMIT("subs            %[count], #1")
+                __ASM_EMIT("bne             1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w)
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3" , "q4", "q5", "q6", "q7",
+                  "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
+            );
+        }
+
+        static void matched_norm_x4(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, const float *w, size_t count)
+        {
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                __ASM_EMIT("vstm            %[bf]!, {q0-q4}")
+                // Repeat loop
+                __ASM_EMIT("subs            %[count], #1")
+                __ASM_EMIT("bne             1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w)
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3" , "q4", "q5", "q6", "q7",
+                  "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
+            );
+        }
+
+        static void matched_norm_x8(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, const float *w, size_t count)
+        {
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                __ASM_EMIT("vstr            d0, [%[bf], #0x00]")
+                __ASM_EMIT("vstr            d1, [%[bf], #0x08]")
+                __ASM_EMIT("vstr            d2, [%[bf], #0x20]")
+                __ASM_EMIT("vstr            d3, [%[bf], #0x28]")
+                __ASM_EMIT("vstr            d4, [%[bf], #0x40]")
+                __ASM_EMIT("vstr            d5, [%[bf], #0x48]")
+                __ASM_EMIT("vstr            d6, [%[bf], #0x60]")
+                __ASM_EMIT("vstr            d7, [%[bf], #0x68]")
+                __ASM_EMIT("vstr            d8, [%[bf], #0x80]")
+                __ASM_EMIT("vstr            d9, [%[bf], #0x88]")
+                MATCHED_NORM_X4
+                __ASM_EMIT("vstr            d0, [%[bf], #0x10]")
+                __ASM_EMIT("vstr            d1, [%[bf], #0x18]")
+                __ASM_EMIT("vstr            d2, [%[bf], #0x30]")
+                __ASM_EMIT("vstr            d3, [%[bf], #0x38]")
+                __ASM_EMIT("vstr            d4, [%[bf], #0x50]")
+                __ASM_EMIT("vstr            d5, [%[bf], #0x58]")
+                __ASM_EMIT("vstr            d6, [%[bf], #0x70]")
+                __ASM_EMIT("vstr            d7, [%[bf], #0x78]")
+                __ASM_EMIT("vstr            d8, [%[bf], #0x90]")
+                __ASM_EMIT("vstr            d9, [%[bf], #0x98]")
+                // Repeat loop
+                __ASM_EMIT("add             %[bf], #0xa0")
+                __ASM_EMIT("subs            %[count], #1")
+                __ASM_EMIT("bne             1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w)
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3" , "q4", "q5", "q6", "q7",
+                  "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
+            );
+        }
+
+        #undef MATCHED_NORM_X4
+        #undef MATCHED_AMP_X4
+        #undef MATCHED_RCP
+        #undef MATCHED_SQRT
+
+        void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Find roots for top and bottom polynoms
+            matched_solve(&ctx, bc->t, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
+            matched_solve(&ctx, bc->b, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
+            matched_flush(&ctx);
+
+            // Normalize filters, the tail is processed by padding to the full block
+            size_t blocks   = count >> 2;
+            if (blocks > 0)
+            {
+                matched_norm_x1(bf, bc, ctx.w, blocks);
+                bf             += blocks << 2;
+                bc             += blocks << 2;
+            }
+
+            count          &= 3;
+            if (count > 0)
+            {
+                dsp::f_cascade_t xc[4];
+                dsp::biquad_x1_t xf[4];
+
+                for (size_t i=0; i<4; ++i)
+                    xc[i]           = bc[lsp_min(i, count - 1)];
+                matched_norm_x1(xf, xc, ctx.w, 1);
+                for (size_t i=0; i<count; ++i)
+                    bf[i]           = xf[i];
+            }
+        }
+
+        void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Solve filters
+            for (size_t i=0; i<2; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*3];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 1, (2*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 1, (2*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters, the tail is processed by padding to the full block
+            size_t blocks   = count >> 1;
+            if (blocks > 0)
+            {
+                matched_norm_x2(bf, bc, ctx.w, blocks);
+                bf             += blocks << 1;
+                bc             += blocks << 2;
+            }
+
+            if (count & 1)
+            {
+                dsp::f_cascade_t xc[4];
+                dsp::biquad_x2_t xf[2];
+
+                xc[0]           = bc[0];
+                xc[1]           = bc[1];
+                xc[2]           = bc[1];
+                xc[3]           = bc[1];
+                matched_norm_x2(xf, xc, ctx.w, 1);
+                bf[0]           = xf[0];
+            }
+        }
+
+        void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Solve filters
+            for (size_t i=0; i<4; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*5];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 3, (4*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 3, (4*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters
+            if (count > 0)
+                matched_norm_x4(bf, bc, ctx.w, count);
+        }
+
+        void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Solve filters
+            for (size_t i=0; i<8; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*9];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 7, (8*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 7, (8*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters
+            if (count > 0)
+                matched_norm_x8(bf, bc, ctx.w, count);
+        }
     }
 }
 
+#undef MATCHED_BATCH
+
 #endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_FILTERS_TRANSFORM_H_ */
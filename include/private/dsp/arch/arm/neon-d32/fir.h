@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_ARM_NEON_D32_FIR_H_
+#define PRIVATE_DSP_ARCH_ARM_NEON_D32_FIR_H_
+
+#ifndef PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL */
+
+namespace lsp
+{
+    namespace neon_d32
+    {
+        #define FIR_STORE_STRIDED(lo, hi) \
+            __ASM_EMIT("vst1.32     {" lo "[0]}, [%[dst]], %[stride]") \
+            __ASM_EMIT("vst1.32     {" lo "[1]}, [%[dst]], %[stride]") \
+            __ASM_EMIT("vst1.32     {" hi "[0]}, [%[dst]], %[stride]") \
+            __ASM_EMIT("vst1.32     {" hi "[1]}, [%[dst]], %[stride]")
+
+        void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            const float *t, *s;
+            const float *tend   = &taps[length];
+            size_t stride       = factor * sizeof(float);
+
+            for (size_t p=0; p<factor; ++p, taps += length, tend += length)
+            {
+                float *d        = &dst[p];
+                const float *x  = src;
+                size_t n        = count;
+
+                ARCH_ARM_ASM(
+                    /* 16x blocks */
+                    __ASM_EMIT("subs        %[count], #16")
+                    __ASM_EMIT("blo         2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("veor        q0, q0, q0")                /* q0 = s0 */
+                    __ASM_EMIT("veor        q1, q1, q1")                /* q1 = s1 */
+                    __ASM_EMIT("veor        q2, q2, q2")                /* q2 = s2 */
+                    __ASM_EMIT("veor        q3, q3, q3")                /* q3 = s3 */
+                    __ASM_EMIT("mov         %[t], %[taps]")
+                    __ASM_EMIT("mov         %[s], %[src]")
+                    __ASM_EMIT("11:")
+                    __ASM_EMIT("vld1.32     {d16[], d17[]}, [%[t]]!")   /* q8 = t */
+                    __ASM_EMIT("vldm        %[s], {q9-q12}")            /* q9 = x0, q10 = x1, q11 = x2, q12 = x3 */
+                    __ASM_EMIT("add         %[s], #0x04")
+                    __ASM_EMIT("vmla.f32    q0, q8, q9")                /* q0 = s0 + t*x0 */
+                    __ASM_EMIT("vmla.f32    q1, q8, q10")               /* q1 = s1 + t*x1 */
+                    __ASM_EMIT("vmla.f32    q2, q8, q11")               /* q2 = s2 + t*x2 */
+                    __ASM_EMIT("vmla.f32    q3, q8, q12")               /* q3 = s3 + t*x3 */
+                    __ASM_EMIT("cmp         %[t], %[tend]")
+                    __ASM_EMIT("blo         11b")
+                    FIR_STORE_STRIDED("d0", "d1")
+                    FIR_STORE_STRIDED("d2", "d3")
+                    FIR_STORE_STRIDED("d4", "d5")
+                    FIR_STORE_STRIDED("d6", "d7")
+                    __ASM_EMIT("add         %[src], #0x40")
+                    __ASM_EMIT("subs        %[count], #16")
+                    __ASM_EMIT("bhs         1b")
+                    __ASM_EMIT("2:")
+                    /* 4x blocks */
+                    __ASM_EMIT("adds        %[count], #12")
+                    __ASM_EMIT("blt         4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("veor        q0, q0, q0")                /* q0 = s0 */
+                    __ASM_EMIT("mov         %[t], %[taps]")
+                    __ASM_EMIT("mov         %[s], %[src]")
+                    __ASM_EMIT("31:")
+                    __ASM_EMIT("vld1.32     {d16[], d17[]}, [%[t]]!")   /* q8 = t */
+                    __ASM_EMIT("vldm        %[s], {q9}")                /* q9 = x0 */
+                    __ASM_EMIT("add         %[s], #0x04")
+                    __ASM_EMIT("vmla.f32    q0, q8, q9")                /* q0 = s0 + t*x0 */
+                    __ASM_EMIT("cmp         %[t], %[tend]")
+                    __ASM_EMIT("blo         31b")
+                    FIR_STORE_STRIDED("d0", "d1")
+                    __ASM_EMIT("add         %[src], #0x10")
+                    __ASM_EMIT("subs        %[count], #4")
+                    __ASM_EMIT("bge         3b")
+                    __ASM_EMIT("4:")
+                    /* 1x blocks */
+                    __ASM_EMIT("adds        %[count], #3")
+                    __ASM_EMIT("blt         6f")
+                    __ASM_EMIT("5:")
+                    __ASM_EMIT("veor        q0, q0, q0")                /* s0 = s */
+                    __ASM_EMIT("mov         %[t], %[taps]")
+                    __ASM_EMIT("mov         %[s], %[src]")
+                    __ASM_EMIT("51:")
+                    __ASM_EMIT("vldmia      %[t]!, {s16}")              /* s16 = t */
+                    __ASM_EMIT("vldmia      %[s]!, {s17}")              /* s17 = x */
+                    __ASM_EMIT("vmla.f32    s0, s16, s17")              /* s0 = s + t*x */
+                    __ASM_EMIT("cmp         %[t], %[tend]")
+                    __ASM_EMIT("blo         51b")
+                    __ASM_EMIT("vst1.32     {d0[0]}, [%[dst]], %[stride]")
+                    __ASM_EMIT("add         %[src], #0x04")
+                    __ASM_EMIT("subs        %[count], #1")
+                    __ASM_EMIT("bge         5b")
+                    __ASM_EMIT("6:")
+
+                    : [dst] "+r" (d), [src] "+r" (x), [count] "+r" (n),
+                      [t] "=&r" (t), [s] "=&r" (s)
+                    : [taps] "r" (taps), [tend] "r" (tend),
+                      [stride] "r" (stride)
+                    : "cc", "memory",
+                      "q0", "q1", "q2", "q3", "q4",
+                      "q8", "q9", "q10", "q11", "q12"
+                );
+            }
+        }
+
+        #undef FIR_STORE_STRIDED
+
+        void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            const float *tend   = &taps[length & ~size_t(0x03)];
+            const float *tfin   = &taps[length];
+
+            // 4x blocks: four dot products with the same taps
+            for ( ; count >= 4; count -= 4)
+            {
+                const float *t  = taps;
+                const float *s0 = src;
+                const float *s1 = &src[factor];
+                const float *s2 = &src[factor*2];
+                const float *s3 = &src[factor*3];
+
+                ARCH_ARM_ASM(
+                    __ASM_EMIT("veor        q0, q0, q0")                /* q0 = a0 */
+                    __ASM_EMIT("veor        q1, q1, q1")                /* q1 = a1 */
+                    __ASM_EMIT("veor        q2, q2, q2")                /* q2 = a2 */
+                    __ASM_EMIT("veor        q3, q3, q3")                /* q3 = a3 */
+                    /* 4x taps */
+                    __ASM_EMIT("cmp         %[t], %[tend]")
+                    __ASM_EMIT("bhs         2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("vld1.32     {q8}, [%[t]]!")             /* q8 = t */
+                    __ASM_EMIT("vld1.32     {q9}, [%[s0]]!")            /* q9 = x0 */
+                    __ASM_EMIT("vld1.32     {q10}, [%[s1]]!")           /* q10 = x1 */
+                    __ASM_EMIT("vld1.32     {q11}, [%[s2]]!")           /* q11 = x2 */
+                    __ASM_EMIT("vld1.32     {q12}, [%[s3]]!")           /* q12 = x3 */
+                    __ASM_EMIT("vmla.f32    q0, q8, q9")                /* q0 = a0 + t*x0 */
+                    __ASM_EMIT("vmla.f32    q1, q8, q10")               /* q1 = a1 + t*x1 */
+                    __ASM_EMIT("vmla.f32    q2, q8, q11")               /* q2 = a2 + t*x2 */
+                    __ASM_EMIT("vmla.f32    q3, q8, q12")               /* q3 = a3 + t*x3 */
+                    __ASM_EMIT("cmp         %[t], %[tend]")
+                    __ASM_EMIT("blo         1b")
+                    __ASM_EMIT("2:")
+                    /* 1x taps */
+                    __ASM_EMIT("cmp         %[t], %[tfin]")
+                    __ASM_EMIT("bhs         4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("vldmia      %[t]!, {s16}")              /* s16 = t */
+                    __ASM_EMIT("vldmia      %[s0]!, {s17}")             /* s17 = x0 */
+                    __ASM_EMIT("vldmia      %[s1]!, {s18}")             /* s18 = x1 */
+                    __ASM_EMIT("vldmia      %[s2]!, {s19}")             /* s19 = x2 */
+                    __ASM_EMIT("vldmia      %[s3]!, {s20}")             /* s20 = x3 */
+                    __ASM_EMIT("vmla.f32    s0, s16, s17")              /* s0 = a0 + t*x0 */
+                    __ASM_EMIT("vmla.f32    s4, s16, s18")              /* s4 = a1 + t*x1 */
+                    __ASM_EMIT("vmla.f32    s8, s16, s19")              /* s8 = a2 + t*x2 */
+                    __ASM_EMIT("vmla.f32    s12, s16, s20")             /* s12 = a3 + t*x3 */
+                    __ASM_EMIT("cmp         %[t], %[tfin]")
+                    __ASM_EMIT("blo         3b")
+                    __ASM_EMIT("4:")
+                    /* Horizontal sums */
+                    __ASM_EMIT("vadd.f32    d0, d0, d1")                /* d0 = a0[0]+a0[2] a0[1]+a0[3] */
+                    __ASM_EMIT("vadd.f32    d2, d2, d3")                /* d2 = a1[0]+a1[2] a1[1]+a1[3] */
+                    __ASM_EMIT("vadd.f32    d4, d4, d5")                /* d4 = a2[0]+a2[2] a2[1]+a2[3] */
+                    __ASM_EMIT("vadd.f32    d6, d6, d7")                /* d6 = a3[0]+a3[2] a3[1]+a3[3] */
+                    __ASM_EMIT("vpadd.f32   d0, d0, d2")                /* d0 = A0 A1 */
+                    __ASM_EMIT("vpadd.f32   d1, d4, d6")                /* d1 = A2 A3 */
+                    __ASM_EMIT("vst1.32     {q0}, [%[dst]]")
+
+                    : [t] "+r" (t),
+                      [s0] "+r" (s0), [s1] "+r" (s1),
+                      [s2] "+r" (s2), [s3] "+r" (s3)
+                    : [dst] "r" (dst),
+                      [tend] "r" (tend), [tfin] "r" (tfin)
+                    : "cc", "memory",
+                      "q0", "q1", "q2", "q3", "q4", "q5",
+                      "q8", "q9", "q10", "q11", "q12"
+                );
+
+                dst            += 4;
+                src            += factor * 4;
+            }
+
+            // 1x blocks
+            for ( ; count > 0; --count)
+            {
+                const float *t  = taps;
+                const float *s0 = src;
+
+                ARCH_ARM_ASM(
+                    __ASM_EMIT("veor        q0, q0, q0")                /* q0 = a0 */
+                    /* 4x taps */
+                    __ASM_EMIT("cmp         %[t], %[tend]")
+                    __ASM_EMIT("bhs         2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("vld1.32     {q8}, [%[t]]!")             /* q8 = t */
+                    __ASM_EMIT("vld1.32     {q9}, [%[s0]]!")            /* q9 = x */
+                    __ASM_EMIT("vmla.f32    q0, q8, q9")                /* q0 = a0 + t*x */
+                    __ASM_EMIT("cmp         %[t], %[tend]")
+                    __ASM_EMIT("blo         1b")
+                    __ASM_EMIT("2:")
+                    /* 1x taps */
+                    __ASM_EMIT("cmp         %[t], %[tfin]")
+                    __ASM_EMIT("bhs         4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("vldmia      %[t]!, {s16}")              /* s16 = t */
+                    __ASM_EMIT("vldmia      %[s0]!, {s17}")             /* s17 = x */
+                    __ASM_EMIT("vmla.f32    s0, s16, s17")              /* s0 = a0 + t*x */
+                    __ASM_EMIT("cmp         %[t], %[tfin]")
+                    __ASM_EMIT("blo         3b")
+                    __ASM_EMIT("4:")
+                    /* Horizontal sum */
+                    __ASM_EMIT("vadd.f32    d0, d0, d1")                /* d0 = a0+a2 a1+a3 */
+                    __ASM_EMIT("vpadd.f32   d0, d0, d0")                /* d0 = a0+a1+a2+a3 */
+                    __ASM_EMIT("vst1.32     {d0[0]}, [%[dst]]")
+
+                    : [t] "+r" (t), [s0] "+r" (s0)
+                    : [dst] "r" (dst),
+                      [tend] "r" (tend), [tfin] "r" (tfin)
+                    : "cc", "memory",
+                      "q0", "q4", "q8", "q9"
+                );
+
+                ++dst;
+                src            += factor;
+            }
+        }
+
+    } /* namespace neon_d32 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_ARM_NEON_D32_FIR_H_ */
@@ -240,6 +240,67 @@ namespace lsp
 
             return result;
         }
+
+        float h_lerp_dotp(const float *x, const float *a, const float *b, float k, size_t count)
+        {
+            IF_ARCH_ARM(float result);
+            ARCH_ARM_ASM
+            (
+                __ASM_EMIT("veor            q0, q0")
+                __ASM_EMIT("veor            q1, q1")
+                __ASM_EMIT("subs            %[count], #8")
+                __ASM_EMIT("blo             2f")
+                /* x8 Blocks */
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vldm            %[x]!, {q2-q3}")
+                __ASM_EMIT("vldm            %[a]!, {q4-q5}")
+                __ASM_EMIT("vldm            %[b]!, {q6-q7}")
+                __ASM_EMIT("vfma.f32        q0, q2, q4")
+                __ASM_EMIT("vfma.f32        q1, q2, q6")
+                __ASM_EMIT("vfma.f32        q0, q3, q5")
+                __ASM_EMIT("vfma.f32        q1, q3, q7")
+                __ASM_EMIT("subs            %[count], #8")
+                __ASM_EMIT("bhs             1b")
+                /* x4 Block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("adds            %[count], #4")
+                __ASM_EMIT("blt             4f")
+                __ASM_EMIT("vldm            %[x]!, {q2}")
+                __ASM_EMIT("vldm            %[a]!, {q4}")
+                __ASM_EMIT("vldm            %[b]!, {q6}")
+                __ASM_EMIT("vfma.f32        q0, q2, q4")
+                __ASM_EMIT("vfma.f32        q1, q2, q6")
+                __ASM_EMIT("sub             %[count], #4")
+                /* x1 Blocks */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("adds            %[count], #3")
+                __ASM_EMIT("blt             6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vld1.32         {d4[], d5[]}, [%[x]]!")
+                __ASM_EMIT("vld1.32         {d8[], d9[]}, [%[a]]!")
+                __ASM_EMIT("vld1.32         {d12[], d13[]}, [%[b]]!")
+                __ASM_EMIT("vfma.f32        s0, s8, s16")
+                __ASM_EMIT("vfma.f32        s4, s8, s24")
+                __ASM_EMIT("subs            %[count], #1")
+                __ASM_EMIT("bge             5b")
+                /* Interpolate and sum */
+                __ASM_EMIT("6:")
+                __ASM_EMIT("vld1.32         {d4[], d5[]}, [%[k]]")  // q2 = k
+                __ASM_EMIT("vsub.f32        q1, q1, q0")            // q1 = sb - sa
+                __ASM_EMIT("vfma.f32        q0, q1, q2")            // q0 = sa + (sb - sa)*k
+                __ASM_EMIT("vadd.f32        d0, d1")
+                __ASM_EMIT("vadd.f32        %[res], s0, s1")
+
+                : [res] "=t" (result),
+                  [x] "+r" (x), [a] "+r" (a), [b] "+r" (b),
+                  [count] "+r" (count)
+                : [k] "r" (&k)
+                : "cc", "memory",
+                  "q0", "q1", "q2", "q3", "q4", "q5", "q6", "q7"
+            );
+
+            return result;
+        }
     }
 }
 
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_BATCH_FFT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_BATCH_FFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        void batch_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            size_t stride, size_t rank, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                direct_fft(dst_re, dst_im, src_re, src_im, rank);
+                dst_re     += stride;
+                dst_im     += stride;
+                src_re     += stride;
+                src_im     += stride;
+            }
+        }
+
+        void batch_reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            size_t stride, size_t rank, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                reverse_fft(dst_re, dst_im, src_re, src_im, rank);
+                dst_re     += stride;
+                dst_im     += stride;
+                src_re     += stride;
+                src_im     += stride;
+            }
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_BATCH_FFT_H_ */
@@ -26,6 +26,10 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
 
+#define CONVOLVE_FFT_THRESHOLD      224     /* Crossover point of scalar direct and FFT convolution, see dsp.fft.convolve_fft performance test */
+#define CONVOLVE_FFT_MIN_RANK       3
+#define CONVOLVE_FFT_MAX_RANK       13
+
 namespace lsp
 {
     namespace generic
@@ -118,7 +122,113 @@ namespace lsp
                 k++;
             }
         }
+
+        size_t convolve_fft_threshold()
+        {
+            return CONVOLVE_FFT_THRESHOLD;
+        }
+
+        /*
+         * The FFT convolution is commutative, so the shorter of two signals is split
+         * into partitions of 2^(rank-1) samples and the longer one is processed by
+         * blocks of the same size like in the uniformly partitioned convolver.
+         * Output block k is the sum of products of input block k-p and partition p
+         * restored by the single reverse transform.
+         */
+        static size_t convolve_fft_rank(size_t length, size_t count)
+        {
+            size_t size     = lsp_min(length, count);
+            size_t rank     = CONVOLVE_FFT_MIN_RANK;
+            while ((rank < CONVOLVE_FFT_MAX_RANK) && ((size_t(1) << (rank - 1)) < size))
+                ++rank;
+            return rank;
+        }
+
+        size_t convolve_fft_size(size_t length, size_t count)
+        {
+            size_t rank     = convolve_fft_rank(length, count);
+            size_t half     = size_t(1) << (rank - 1);
+            size_t parts    = lsp_max((lsp_min(length, count) + half - 1) >> (rank - 1), size_t(1));
+
+            return ((parts << (rank + 2)) + half * 6) * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        static void convolve_fft_parse(float *dst, float *tmp, const float *src, size_t count, size_t rank)
+        {
+            size_t half     = size_t(1) << (rank - 1);
+            if (count < half)
+            {
+                dsp::copy(tmp, src, count);
+                dsp::fill_zero(&tmp[count], half - count);
+                src             = tmp;
+            }
+            dsp::fastconv_parse(dst, src, rank);
+        }
+
+        void convolve_fft(float *dst, const float *src, const float *conv, size_t length, size_t count, void *buf)
+        {
+            if ((length == 0) || (count == 0))
+                return;
+
+            // Use the shorter signal as the kernel
+            if (length > count)
+            {
+                const float *xptr   = src;
+                size_t xcount       = count;
+                src                 = conv;
+                conv                = xptr;
+                count               = length;
+                length              = xcount;
+            }
+
+            size_t rank     = convolve_fft_rank(length, count);
+            size_t half     = size_t(1) << (rank - 1);
+            size_t items    = size_t(1) << (rank + 1);
+            size_t parts    = (length + half - 1) >> (rank - 1);
+            size_t blocks   = (count + half - 1) >> (rank - 1);
+            size_t total    = length + count - 1;
+
+            float *sp       = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            float *fdl      = &sp[parts * items];
+            float *acc      = &fdl[parts * items];
+            float *tmp      = &acc[items];
+
+            // Compute fast convolution data of each partition
+            for (size_t i=0; i<parts; ++i)
+                convolve_fft_parse(&sp[i * items], tmp, &conv[i * half], lsp_min(length - i * half, half), rank);
+
+            for (size_t k=0, out=0; out < total; ++k, out += half)
+            {
+                // Put the spectrum of the input block to the delay line
+                if (k < blocks)
+                    convolve_fft_parse(&fdl[(k % parts) * items], tmp, &src[k * half], lsp_min(count - k * half, half), rank);
+
+                // Accumulate products of blocks and partitions
+                size_t first    = (k >= blocks) ? k - blocks + 1 : 0;
+                size_t last     = lsp_min(k + 1, parts);
+                dsp::fill_zero(acc, items);
+                for (size_t p=first; p<last; ++p)
+                    dsp::fastconv_fmadd(acc, &fdl[((k - p) % parts) * items], &sp[p * items], rank);
+
+                // Restore convolution and add to the output
+                dsp::fastconv_restore(tmp, acc, rank);
+                dsp::add2(&dst[out], tmp, lsp_min(total - out, half * 2));
+            }
+        }
+
+        void convolve_auto(float *dst, const float *src, const float *conv, size_t length, size_t count, void *buf)
+        {
+            if ((buf != NULL) && (lsp_min(length, count) >= dsp::convolve_fft_threshold()))
+                convolve_fft(dst, src, conv, length, count, buf);
+            else
+                dsp::convolve(dst, src, conv, length, count);
+        }
     } /* namespace generic */
 } /* namespace lsp */
 
+#undef CONVOLVE_FFT_THRESHOLD
+#undef CONVOLVE_FFT_MIN_RANK
+#undef CONVOLVE_FFT_MAX_RANK
+
 #endif /* PRIVATE_DSP_ARCH_GENERIC_CONVOLUTION_H_ */
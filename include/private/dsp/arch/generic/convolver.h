@@ -0,0 +1,766 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_CONVOLVER_H_
+#define PRIVATE_DSP_ARCH_GENERIC_CONVOLVER_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#define NU_STAGE_WAITING        (1 << 0)    /* The block is handed off but the job is not published yet */
+#define NU_STAGE_PUBLISHED      (1 << 1)    /* The job is published with the current set of working data */
+#define NU_STAGE_STALE          (1 << 2)    /* The job is left to the worker and should be dropped */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /*
+         * The block of B = 2^(rank-1) input samples is zero-padded to 2^rank samples
+         * by fastconv_parse, so the product with the fast convolution data of any
+         * impulse response partition of B samples gives the linear convolution
+         * of 2^rank samples. The block k of output is the sum of products of input
+         * block k-p and partition p, which is accumulated in the frequency domain
+         * and then restored by the single reverse transform. The second half of
+         * the restored data is the tail which is added to the next block.
+         */
+        size_t convolver_size(size_t rank, size_t length)
+        {
+            size_t half     = size_t(1) << (rank - 1);
+            size_t parts    = lsp_max((length + half - 1) >> (rank - 1), size_t(1));
+
+            return ((parts << (rank + 2)) + (size_t(9) << (rank - 1))) * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        void convolver_reset(dsp::convolver_t *conv)
+        {
+            size_t rank     = conv->rank;
+            dsp::fill_zero(conv->fdl, conv->partitions << (rank + 1));
+            dsp::fill_zero(conv->input, size_t(1) << (rank - 1));
+            dsp::fill_zero(conv->output, size_t(1) << rank);
+            conv->head      = 0;
+            conv->offset    = 0;
+        }
+
+        void convolver_init(dsp::convolver_t *conv, void *buf, const float *ir, size_t length, size_t rank)
+        {
+            float *ptr      = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            size_t half     = size_t(1) << (rank - 1);
+            size_t items    = size_t(1) << (rank + 1);
+            size_t parts    = lsp_max((length + half - 1) >> (rank - 1), size_t(1));
+
+            conv->spectrum  = ptr;
+            conv->fdl       = &ptr[parts * items];
+            conv->acc       = &ptr[parts * items * 2];
+            conv->tmp       = &conv->acc[items];
+            conv->output    = &conv->tmp[half * 2];
+            conv->input     = &conv->output[half * 2];
+            conv->rank      = rank;
+            conv->partitions= parts;
+
+            // Compute fast convolution data of each partition, the last partition
+            // is zero-padded in the input buffer
+            float *sp       = conv->spectrum;
+            for (size_t i=0; i<parts; ++i, sp += items)
+            {
+                size_t to_do    = lsp_min(length, half);
+                if (to_do < half)
+                {
+                    dsp::copy(conv->input, ir, to_do);
+                    dsp::fill_zero(&conv->input[to_do], half - to_do);
+                    dsp::fastconv_parse(sp, conv->input, rank);
+                }
+                else
+                    dsp::fastconv_parse(sp, ir, rank);
+
+                ir             += to_do;
+                length         -= to_do;
+            }
+
+            convolver_reset(conv);
+        }
+
+        static void convolver_block(dsp::convolver_t *conv)
+        {
+            size_t rank     = conv->rank;
+            size_t half     = size_t(1) << (rank - 1);
+            size_t items    = size_t(1) << (rank + 1);
+            size_t parts    = conv->partitions;
+            size_t head     = conv->head;
+
+            // Put the spectrum of the new block to the delay line
+            float *fdl      = &conv->fdl[head * items];
+            dsp::fastconv_parse(fdl, conv->input, rank);
+
+            // Accumulate products: partition p is multiplied by the block
+            // stored p positions before the head in the delay line
+            const float *sp = conv->spectrum;
+            dsp::fill_zero(conv->acc, items);
+            for (size_t i=0; i<=head; ++i, sp += items, fdl -= items)
+                dsp::fastconv_fmadd(conv->acc, fdl, sp, rank);
+            fdl             = &conv->fdl[(parts - 1) * items];
+            for (size_t i=head+1; i<parts; ++i, sp += items, fdl -= items)
+                dsp::fastconv_fmadd(conv->acc, fdl, sp, rank);
+
+            // Restore convolution and perform overlap-add
+            dsp::fastconv_restore(conv->tmp, conv->acc, rank);
+            dsp::add3(conv->output, &conv->output[half], conv->tmp, half);
+            dsp::copy(&conv->output[half], &conv->tmp[half], half);
+
+            conv->head      = (head + 1 < parts) ? head + 1 : 0;
+        }
+
+        void convolver_process(dsp::convolver_t *conv, float *dst, const float *src, size_t count)
+        {
+            size_t half     = size_t(1) << (conv->rank - 1);
+
+            while (count > 0)
+            {
+                // Process samples until the end of the block
+                size_t offset   = conv->offset;
+                size_t to_do    = lsp_min(count, half - offset);
+
+                dsp::copy(&conv->input[offset], src, to_do);
+                dsp::copy(dst, &conv->output[offset], to_do);
+
+                conv->offset   += to_do;
+                src            += to_do;
+                dst            += to_do;
+                count          -= to_do;
+
+                if (conv->offset >= half)
+                {
+                    convolver_block(conv);
+                    conv->offset    = 0;
+                }
+            }
+        }
+
+        /*
+         * The matrix convolver keeps the same delay line as the convolver for each
+         * input. The spectrum of the impulse response from input i to output o is stored
+         * at the index o * inputs + i, so the data for each output is contiguous.
+         */
+        size_t mconvolver_size(size_t rank, size_t length, size_t inputs, size_t outputs)
+        {
+            size_t half     = size_t(1) << (rank - 1);
+            size_t parts    = lsp_max((length + half - 1) >> (rank - 1), size_t(1));
+            size_t floats   = ((parts * inputs * (outputs + 1)) << (rank + 1)) +
+                ((inputs + outputs * 2 + 6) << (rank - 1));
+
+            return floats * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        void mconvolver_reset(dsp::mconvolver_t *conv)
+        {
+            size_t rank     = conv->rank;
+            dsp::fill_zero(conv->fdl, (conv->partitions * conv->inputs) << (rank + 1));
+            dsp::fill_zero(conv->input, conv->inputs << (rank - 1));
+            dsp::fill_zero(conv->output, conv->outputs << rank);
+            conv->head      = 0;
+            conv->offset    = 0;
+        }
+
+        void mconvolver_init(dsp::mconvolver_t *conv, void *buf,
+            const float * const *ir, size_t length, size_t rank, size_t inputs, size_t outputs)
+        {
+            float *ptr      = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            size_t half     = size_t(1) << (rank - 1);
+            size_t items    = size_t(1) << (rank + 1);
+            size_t parts    = lsp_max((length + half - 1) >> (rank - 1), size_t(1));
+            size_t ch_items = parts * items;
+
+            conv->spectrum  = ptr;
+            conv->fdl       = &ptr[ch_items * inputs * outputs];
+            conv->acc       = &conv->fdl[ch_items * inputs];
+            conv->tmp       = &conv->acc[items];
+            conv->output    = &conv->tmp[half * 2];
+            conv->input     = &conv->output[outputs * half * 2];
+            conv->rank      = rank;
+            conv->partitions= parts;
+            conv->inputs    = inputs;
+            conv->outputs   = outputs;
+
+            // Compute fast convolution data of each partition, the last partition
+            // is zero-padded in the temporary buffer
+            for (size_t o=0; o<outputs; ++o)
+                for (size_t i=0; i<inputs; ++i)
+                {
+                    float *sp       = &conv->spectrum[(o * inputs + i) * ch_items];
+                    const float *s  = ir[i * outputs + o];
+                    if (s == NULL)
+                    {
+                        dsp::fill_zero(sp, ch_items);
+                        continue;
+                    }
+
+                    for (size_t j=0, left=length; j<parts; ++j, sp += items)
+                    {
+                        size_t to_do    = lsp_min(left, half);
+                        if (to_do < half)
+                        {
+                            dsp::copy(conv->tmp, s, to_do);
+                            dsp::fill_zero(&conv->tmp[to_do], half - to_do);
+                            dsp::fastconv_parse(sp, conv->tmp, rank);
+                        }
+                        else
+                            dsp::fastconv_parse(sp, s, rank);
+
+                        s              += to_do;
+                        left           -= to_do;
+                    }
+                }
+
+            mconvolver_reset(conv);
+        }
+
+        static void mconvolver_block(dsp::mconvolver_t *conv)
+        {
+            size_t rank     = conv->rank;
+            size_t half     = size_t(1) << (rank - 1);
+            size_t items    = size_t(1) << (rank + 1);
+            size_t parts    = conv->partitions;
+            size_t head     = conv->head;
+            size_t ch_items = parts * items;
+
+            // Put the spectrum of the new block of each input to the delay line
+            for (size_t i=0; i<conv->inputs; ++i)
+                dsp::fastconv_parse(&conv->fdl[i * ch_items + head * items], &conv->input[i * half], rank);
+
+            // Accumulate products of all inputs for each output
+            const float *sp = conv->spectrum;
+            for (size_t o=0; o<conv->outputs; ++o)
+            {
+                dsp::fill_zero(conv->acc, items);
+                for (size_t i=0; i<conv->inputs; ++i)
+                {
+                    const float *fdl    = &conv->fdl[i * ch_items + head * items];
+                    for (size_t j=0; j<=head; ++j, sp += items, fdl -= items)
+                        dsp::fastconv_fmadd(conv->acc, fdl, sp, rank);
+                    fdl                 = &conv->fdl[i * ch_items + (parts - 1) * items];
+                    for (size_t j=head+1; j<parts; ++j, sp += items, fdl -= items)
+                        dsp::fastconv_fmadd(conv->acc, fdl, sp, rank);
+                }
+
+                // Restore convolution and perform overlap-add
+                float *out      = &conv->output[o * half * 2];
+                dsp::fastconv_restore(conv->tmp, conv->acc, rank);
+                dsp::add3(out, &out[half], conv->tmp, half);
+                dsp::copy(&out[half], &conv->tmp[half], half);
+            }
+
+            conv->head      = (head + 1 < parts) ? head + 1 : 0;
+        }
+
+        void mconvolver_process(dsp::mconvolver_t *conv, float * const *dst, const float * const *src, size_t count)
+        {
+            size_t half     = size_t(1) << (conv->rank - 1);
+
+            for (size_t done=0; done < count; )
+            {
+                // Process samples until the end of the block, inputs are stored
+                // before outputs are written to allow in-place processing
+                size_t offset   = conv->offset;
+                size_t to_do    = lsp_min(count - done, half - offset);
+
+                for (size_t i=0; i<conv->inputs; ++i)
+                    dsp::copy(&conv->input[i * half + offset], &src[i][done], to_do);
+                for (size_t o=0; o<conv->outputs; ++o)
+                    dsp::copy(&dst[o][done], &conv->output[o * half * 2 + offset], to_do);
+
+                conv->offset   += to_do;
+                done           += to_do;
+
+                if (conv->offset >= half)
+                {
+                    mconvolver_block(conv);
+                    conv->offset    = 0;
+                }
+            }
+        }
+
+        /*
+         * Non-uniform partitioning: the head of 2^(rank-1) = B samples is applied by
+         * the direct convolution, the stage of rank r has partitions of P = 2^(r-1)
+         * samples. The first stage has three partitions of B samples, next stages
+         * have two partitions each, so the stage of partition P starts at the offset
+         * 2P of the impulse response (except the first stage which starts at the offset B),
+         * the stage of max_rank takes all remaining partitions.
+         *
+         * The work on the block of P samples that ends at time t consists of
+         * partitions + 2 steps that are distributed between P/B boundaries of
+         * B-sample blocks starting at t. The last step is performed at the time
+         * t + P - B at most, and the result is required at the time t - P + offset,
+         * which is never earlier. Stages except the first one have the second set of
+         * working data for the background processing.
+         */
+        static size_t nu_convolver_layout(dsp::nu_convolver_stage_t *stages, size_t *floats,
+            size_t rank, size_t max_rank, size_t length)
+        {
+            size_t half     = size_t(1) << (rank - 1);
+            size_t offset   = half;
+            size_t total    = half * 3; // Direct convolution and its output
+            size_t max_size = half;
+            size_t n        = 0;
+
+            for (size_t r=rank; offset < length; ++r, ++n)
+            {
+                size_t size     = size_t(1) << (r - 1);
+                size_t parts    = (length - offset + size - 1) >> (r - 1);
+                if (r < max_rank)
+                    parts           = lsp_min(parts, (r == rank) ? size_t(3) : size_t(2));
+
+                if (stages != NULL)
+                {
+                    stages[n].rank          = r;
+                    stages[n].partitions    = parts;
+                    stages[n].offset        = offset;
+                }
+
+                total          += (parts << (r + 1)) +
+                    ((parts << (r + 1)) + (size_t(3) << r)) * ((n > 0) ? 2 : 1);
+                max_size        = size;
+                offset         += parts * size;
+            }
+
+            // Input and output ring buffers
+            *floats         = total + (max_size << 3);
+            return n;
+        }
+
+        size_t nu_convolver_size(size_t rank, size_t max_rank, size_t length)
+        {
+            size_t floats   = 0;
+            size_t n        = nu_convolver_layout(NULL, &floats, rank, max_rank, length);
+            size_t hdr      = (n * sizeof(dsp::nu_convolver_stage_t) + 0x3f) & ~size_t(0x3f);
+
+            return hdr + floats * sizeof(float) + 0x40; // Additional space for alignment
+        }
+
+        static inline bool nu_convolver_lock(dsp::nu_convolver_stage_t *st)
+        {
+            return atomic_cas(&st->lock, uint32_t(0), uint32_t(1));
+        }
+
+        static inline void nu_convolver_unlock(dsp::nu_convolver_stage_t *st)
+        {
+            atomic_store(&st->lock, uint32_t(0));
+        }
+
+        static void nu_convolver_publish(dsp::nu_convolver_stage_t *st)
+        {
+            st->job_head    = st->head;
+            st->job_block   = st->block;
+            st->job_set     = st->set;
+            atomic_store(&st->done, uint32_t(0));
+            atomic_store(&st->tasks, uint32_t(st->partitions + 2));
+        }
+
+        static void nu_convolver_drop(dsp::nu_convolver_stage_t *st)
+        {
+            atomic_store(&st->tasks, uint32_t(0));
+            atomic_store(&st->done, uint32_t(0));
+        }
+
+        static inline void nu_convolver_notify(dsp::nu_convolver_t *conv)
+        {
+            if (conv->notify != NULL)
+                conv->notify(conv->notify_arg);
+        }
+
+        void nu_convolver_reset(dsp::nu_convolver_t *conv)
+        {
+            size_t half     = size_t(1) << (conv->rank - 1);
+
+            for (size_t i=0; i<conv->nstages; ++i)
+            {
+                dsp::nu_convolver_stage_t *st = &conv->stages[i];
+                size_t state    = st->state & NU_STAGE_STALE;
+
+                // The worker may perform the task of the job right now: leave the job
+                // to the worker and clear another set of working data
+                bool locked     = nu_convolver_lock(st);
+                if (locked)
+                {
+                    nu_convolver_drop(st);
+                    state           = 0;
+                }
+                else if (st->state & NU_STAGE_PUBLISHED)
+                {
+                    st->set        ^= 1;
+                    state           = NU_STAGE_STALE;
+                }
+
+                dsp::fill_zero(st->data[st->set], (st->partitions << (st->rank + 1)) + (size_t(3) << st->rank));
+                st->head        = 0;
+                st->block       = 0;
+                st->state       = state;
+
+                if (locked)
+                    nu_convolver_unlock(st);
+            }
+
+            dsp::fill_zero(conv->dout, half * 2);
+            dsp::fill_zero(conv->input, conv->mask + 1);
+            dsp::fill_zero(conv->output, conv->mask + 1);
+            conv->position  = 0;
+        }
+
+        void nu_convolver_init(dsp::nu_convolver_t *conv, void *buf,
+            const float *ir, size_t length, size_t rank, size_t max_rank)
+        {
+            size_t floats   = 0;
+            size_t half     = size_t(1) << (rank - 1);
+            uint8_t *ptr    = reinterpret_cast<uint8_t *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            size_t n        = nu_convolver_layout(NULL, &floats, rank, max_rank, length);
+
+            conv->stages    = reinterpret_cast<dsp::nu_convolver_stage_t *>(ptr);
+            conv->nstages   = nu_convolver_layout(conv->stages, &floats, rank, max_rank, length);
+            ptr            += (n * sizeof(dsp::nu_convolver_stage_t) + 0x3f) & ~size_t(0x3f);
+
+            // Allocate stages
+            float *fptr     = reinterpret_cast<float *>(ptr);
+            size_t max_size = half;
+            for (size_t i=0; i<n; ++i)
+            {
+                dsp::nu_convolver_stage_t *st = &conv->stages[i];
+                size_t items    = size_t(1) << (st->rank + 1);
+                size_t set      = st->partitions * items + items + (items >> 1);
+
+                st->spectrum    = fptr;
+                st->data[0]     = &fptr[st->partitions * items];
+                st->data[1]     = (i > 0) ? &st->data[0][set] : NULL;
+                st->set         = 0;
+                st->state       = 0;
+                st->job_head    = 0;
+                st->job_block   = 0;
+                st->job_set     = 0;
+                st->lock        = 0;
+                st->tasks       = 0;
+                st->done        = 0;
+                fptr            = &st->data[0][(i > 0) ? set * 2 : set];
+                max_size        = items >> 2;
+            }
+
+            conv->direct    = fptr;
+            conv->dout      = &fptr[half];
+            conv->input     = &fptr[half * 3];
+            conv->output    = &conv->input[max_size * 4];
+            conv->notify    = NULL;
+            conv->notify_arg= NULL;
+            conv->rank      = rank;
+            conv->length    = lsp_min(length, half);
+            conv->mask      = max_size * 4 - 1;
+            conv->background= n;
+
+            // Direct convolution
+            dsp::copy(conv->direct, ir, conv->length);
+
+            // Compute fast convolution data of each partition, the last partition
+            // is zero-padded in the temporary buffer
+            for (size_t i=0; i<n; ++i)
+            {
+                dsp::nu_convolver_stage_t *st = &conv->stages[i];
+                size_t items    = size_t(1) << (st->rank + 1);
+                size_t size     = items >> 2;
+                const float *s  = &ir[st->offset];
+                size_t left     = length - st->offset;
+                float *sp       = st->spectrum;
+                float *tmp      = &st->data[0][(st->partitions + 1) * items];
+
+                for (size_t j=0; j<st->partitions; ++j, sp += items)
+                {
+                    size_t to_do    = lsp_min(left, size);
+                    if (to_do < size)
+                    {
+                        dsp::copy(tmp, s, to_do);
+                        dsp::fill_zero(&tmp[to_do], size - to_do);
+                        dsp::fastconv_parse(sp, tmp, st->rank);
+                    }
+                    else
+                        dsp::fastconv_parse(sp, s, st->rank);
+
+                    s              += to_do;
+                    left           -= to_do;
+                }
+            }
+
+            nu_convolver_reset(conv);
+        }
+
+        static void nu_convolver_task(dsp::nu_convolver_t *conv, dsp::nu_convolver_stage_t *st,
+            float *data, size_t head, size_t start, size_t task)
+        {
+            size_t items    = size_t(1) << (st->rank + 1);
+            size_t parts    = st->partitions;
+            float *acc      = &data[parts * items];
+
+            if (task == 0)
+            {
+                // Put the spectrum of the new block to the delay line
+                dsp::fastconv_parse(&data[head * items], &conv->input[start], st->rank);
+                dsp::fill_zero(acc, items);
+            }
+            else if (task <= parts)
+            {
+                // Partition p is multiplied by the block stored p positions before the head
+                size_t p        = task - 1;
+                size_t idx      = (head >= p) ? head - p : head + parts - p;
+                dsp::fastconv_fmadd(acc, &data[idx * items], &st->spectrum[p * items], st->rank);
+            }
+            else
+                dsp::fastconv_restore(&acc[items], acc, st->rank);
+        }
+
+        static void nu_convolver_commit(dsp::nu_convolver_t *conv, dsp::nu_convolver_stage_t *st,
+            const float *data, size_t start)
+        {
+            // Add restored convolution to the output
+            size_t size     = size_t(1) << (st->rank - 1);
+            size_t out      = (start + st->offset) & conv->mask;
+            const float *tmp= &data[(st->partitions + 1) << (st->rank + 1)];
+            dsp::add2(&conv->output[out], tmp, size);
+            dsp::add2(&conv->output[(out + size) & conv->mask], &tmp[size], size);
+        }
+
+        static void nu_convolver_step(dsp::nu_convolver_t *conv, dsp::nu_convolver_stage_t *st, size_t t)
+        {
+            size_t shift    = st->rank - conv->rank;
+            size_t slice    = (t >> (conv->rank - 1)) & ((size_t(1) << shift) - 1);
+            size_t size     = size_t(1) << (st->rank - 1);
+            size_t tasks    = st->partitions + 2;
+            size_t first    = (slice * tasks) >> shift;
+            size_t last     = ((slice + 1) * tasks) >> shift;
+            size_t start    = (t - size - (slice << (conv->rank - 1))) & conv->mask;
+            float *data     = st->data[st->set];
+
+            if (slice == 0)
+                st->head        = (st->head + 1 < st->partitions) ? st->head + 1 : 0;
+            for (size_t i=first; i<last; ++i)
+                nu_convolver_task(conv, st, data, st->head, start, i);
+            if (last >= tasks)
+                nu_convolver_commit(conv, st, data, start);
+        }
+
+        static void nu_convolver_job(dsp::nu_convolver_t *conv, dsp::nu_convolver_stage_t *st, size_t count)
+        {
+            // Perform tasks of the job in order, the lock should be held by the caller
+            size_t done     = atomic_load(&st->done);
+            float *data     = st->data[st->job_set];
+
+            for (count = lsp_min(count, size_t(atomic_load(&st->tasks))); done < count; ++done)
+            {
+                nu_convolver_task(conv, st, data, st->job_head, st->job_block, done);
+                atomic_store(&st->done, uint32_t(done + 1));
+            }
+        }
+
+        static size_t nu_convolver_run(dsp::nu_convolver_t *conv, dsp::nu_convolver_stage_t *st)
+        {
+            // Claim tasks one by one, so the real-time thread can take the rest of the job at any time
+            size_t done     = 0;
+            while (atomic_load(&st->done) < atomic_load(&st->tasks))
+            {
+                if (!nu_convolver_lock(st))
+                    break;
+
+                uint32_t first  = atomic_load(&st->done);
+                nu_convolver_job(conv, st, first + 1);
+                done           += atomic_load(&st->done) - first;
+
+                nu_convolver_unlock(st);
+            }
+
+            return done;
+        }
+
+        static void nu_convolver_sync(dsp::nu_convolver_t *conv, dsp::nu_convolver_stage_t *st, size_t t)
+        {
+            size_t shift    = st->rank - conv->rank;
+            size_t slice    = (t >> (conv->rank - 1)) & ((size_t(1) << shift) - 1);
+            size_t tasks    = st->partitions + 2;
+            size_t state    = st->state;
+
+            if (slice > 0)
+            {
+                // Perform tasks which are late for one block according to the schedule of
+                // other stages, the job is published if it has not been published yet
+                size_t count    = (slice * tasks) >> shift;
+                if (state & NU_STAGE_PUBLISHED)
+                {
+                    if (atomic_load(&st->done) >= count)
+                        return;
+                }
+                else if (!(state & NU_STAGE_WAITING))
+                    return;
+                if (!nu_convolver_lock(st))
+                    return;
+
+                if (state & NU_STAGE_WAITING)
+                {
+                    nu_convolver_publish(st);
+                    st->state       = NU_STAGE_PUBLISHED;
+                }
+                nu_convolver_job(conv, st, count);
+                bool left       = atomic_load(&st->done) < tasks;
+                nu_convolver_unlock(st);
+
+                if (left)
+                    nu_convolver_notify(conv);
+                return;
+            }
+
+            // The result of the previous block is required right now
+            bool locked     = nu_convolver_lock(st);
+            float *data     = st->data[st->set];
+            if ((locked) && (state & NU_STAGE_STALE))
+            {
+                nu_convolver_drop(st);
+                state          &= ~NU_STAGE_STALE;
+            }
+
+            if (state & NU_STAGE_PUBLISHED)
+            {
+                if (locked)
+                {
+                    nu_convolver_job(conv, st, tasks);
+                    nu_convolver_drop(st);
+                }
+                else if (atomic_load(&st->done) >= tasks)
+                {
+                    // The job is complete, so the data is not modified by the worker which holds
+                    // the lock, the job is dropped later
+                    state          |= NU_STAGE_STALE;
+                }
+                else
+                {
+                    // The worker performs the task right now: do not wait for it and perform
+                    // the job with another set of working data, the delay line is copied
+                    // except the block of the job which is written by the worker
+                    size_t items    = size_t(1) << (st->rank + 1);
+                    size_t next     = st->head + 1;
+                    float *dst      = st->data[st->set ^ 1];
+
+                    dsp::copy(dst, data, st->head * items);
+                    dsp::copy(&dst[next * items], &data[next * items], (st->partitions - next) * items);
+                    for (size_t i=0; i<tasks; ++i)
+                        nu_convolver_task(conv, st, dst, st->head, st->block, i);
+
+                    st->set        ^= 1;
+                    data            = dst;
+                    state          |= NU_STAGE_STALE;
+                }
+                nu_convolver_commit(conv, st, data, st->block);
+            }
+            else if (state & NU_STAGE_WAITING)
+            {
+                // The job has not been published, so the data is not used by workers
+                for (size_t i=0; i<tasks; ++i)
+                    nu_convolver_task(conv, st, data, st->head, st->block, i);
+                nu_convolver_commit(conv, st, data, st->block);
+            }
+            state          &= ~(NU_STAGE_PUBLISHED | NU_STAGE_WAITING);
+
+            // Hand off the next block, the job is published later if the lock is busy
+            st->head        = (st->head + 1 < st->partitions) ? st->head + 1 : 0;
+            st->block       = (t - (size_t(1) << (st->rank - 1))) & conv->mask;
+            if (locked)
+            {
+                nu_convolver_publish(st);
+                nu_convolver_unlock(st);
+                st->state       = state | NU_STAGE_PUBLISHED;
+                nu_convolver_notify(conv);
+            }
+            else
+                st->state       = state | NU_STAGE_WAITING;
+        }
+
+        void nu_convolver_set_background(dsp::nu_convolver_t *conv, size_t rank)
+        {
+            // The first stage has no time reserve for the background processing
+            size_t index    = lsp_min(conv->nstages, size_t(1));
+            while ((index < conv->nstages) && (conv->stages[index].rank < rank))
+                ++index;
+            conv->background    = index;
+        }
+
+        void nu_convolver_set_notify(dsp::nu_convolver_t *conv, void (*notify)(void *arg), void *arg)
+        {
+            conv->notify        = notify;
+            conv->notify_arg    = arg;
+        }
+
+        size_t nu_convolver_background(dsp::nu_convolver_t *conv)
+        {
+            // Stages which are not processed in background never have jobs
+            size_t done     = 0;
+            for (size_t i=0; i<conv->nstages; ++i)
+                done           += nu_convolver_run(conv, &conv->stages[i]);
+            return done;
+        }
+
+        void nu_convolver_process(dsp::nu_convolver_t *conv, float *dst, const float *src, size_t count)
+        {
+            size_t half     = size_t(1) << (conv->rank - 1);
+
+            while (count > 0)
+            {
+                // Process samples until the end of the block
+                size_t pos      = conv->position;
+                size_t off      = pos & (half - 1);
+                size_t to_do    = lsp_min(count, half - off);
+                float *in       = &conv->input[pos];
+
+                dsp::copy(in, src, to_do);
+                if (conv->length > 0)
+                    dsp::convolve(&conv->dout[off], in, conv->direct, conv->length, to_do);
+                dsp::add3(dst, &conv->output[pos], &conv->dout[off], to_do);
+                dsp::fill_zero(&conv->output[pos], to_do);
+
+                pos             = (pos + to_do) & conv->mask;
+                conv->position  = pos;
+                src            += to_do;
+                dst            += to_do;
+                count          -= to_do;
+
+                if (off + to_do >= half)
+                {
+                    dsp::copy(conv->dout, &conv->dout[half], half);
+                    dsp::fill_zero(&conv->dout[half], half);
+
+                    for (size_t i=0; i<conv->background; ++i)
+                        nu_convolver_step(conv, &conv->stages[i], pos);
+                    for (size_t i=conv->background; i<conv->nstages; ++i)
+                        nu_convolver_sync(conv, &conv->stages[i], pos);
+                }
+            }
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#undef NU_STAGE_WAITING
+#undef NU_STAGE_PUBLISHED
+#undef NU_STAGE_STALE
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_CONVOLVER_H_ */
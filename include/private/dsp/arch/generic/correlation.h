@@ -190,6 +190,198 @@ namespace lsp
             corr->b     = vb;
         }
 
+        void corr_lags_init(dsp::lag_correlation_t *corr, const float *a, const float *b, size_t count)
+        {
+            corr->a    += dsp::h_sqr_sum(a, count);
+            for (size_t i=0; i<corr->lags; ++i)
+            {
+                corr->v[i] += dsp::h_dotp(a, &b[i], count);
+                corr->b[i] += dsp::h_sqr_sum(&b[i], count);
+            }
+        }
+
+        void corr_lags_incr(dsp::lag_correlation_t *corr, float *dst,
+            const float *a_head, const float *b_head,
+            const float *a_tail, const float *b_tail,
+            size_t count)
+        {
+            // The sum(a*a) is the same for all lags
+            float xa    = corr->a;
+            for (size_t i=0; i<count; ++i)
+                xa         += a_head[i]*a_head[i] - a_tail[i]*a_tail[i];
+            corr->a     = xa;
+
+            for (size_t j=0; j<corr->lags; ++j)
+            {
+                float xv    = corr->v[j];
+                float xb    = corr->b[j];
+                const float *bh = &b_head[j];
+                const float *bt = &b_tail[j];
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    xv         += a_head[i]*bh[i] - a_tail[i]*bt[i];
+                    xb         += bh[i]*bh[i] - bt[i]*bt[i];
+                }
+
+                float B     = xa * xb;
+                dst[j]      = (B >= 1e-18f) ? xv / sqrtf(B) : 0.0f;
+                corr->v[j]  = xv;
+                corr->b[j]  = xb;
+            }
+        }
+
+        /*
+         * The cross-correlation is computed as the convolution of the first signal
+         * and the reversed second signal c = a * rev(b), so r[k] = c[k + b_count - 1].
+         * The convolution is computed by the circular convolution of N samples, the
+         * element c[n] gets aliased with c[n-N] and c[n+N] which are zero for the
+         * required range n_lo..n_hi when N > n_hi and N >= a_count + b_count - 1 - n_lo.
+         */
+        static size_t xcorr_rank(size_t a_count, size_t b_count, ssize_t min_lag, ssize_t max_lag, size_t *n_lo, size_t *n_hi)
+        {
+            ssize_t last    = a_count + b_count - 2;
+            ssize_t lo      = lsp_limit(min_lag + ssize_t(b_count) - 1, ssize_t(0), last);
+            ssize_t hi      = lsp_limit(max_lag + ssize_t(b_count) - 1, lo, last);
+            size_t size     = lsp_max(lsp_max(size_t(hi + 1), size_t(last + 1 - lo)), lsp_max(a_count, b_count));
+            size_t rank     = 3;
+            while ((size_t(1) << rank) < size)
+                ++rank;
+
+            *n_lo           = lo;
+            *n_hi           = hi;
+            return rank;
+        }
+
+        static float xcorr_peak(const float *v, size_t count)
+        {
+            // Refine the position of the maximum by the parabola passing through three points
+            size_t idx      = dsp::max_index(v, count);
+            if ((idx <= 0) || (idx + 1 >= count))
+                return idx;
+
+            float a         = v[idx-1];
+            float b         = v[idx];
+            float c         = v[idx+1];
+            float d         = a - 2.0f * b + c;
+
+            return (d < 0.0f) ? idx + 0.5f * (a - c) / d : idx;
+        }
+
+        size_t xcorr_size(size_t a_count, size_t b_count, ssize_t min_lag, ssize_t max_lag)
+        {
+            size_t n_lo, n_hi;
+            size_t rank     = xcorr_rank(a_count, b_count, min_lag, max_lag, &n_lo, &n_hi);
+
+            return ((size_t(3) << rank) + 4) * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        float xcorr(float *dst,
+            const float *a, size_t a_count,
+            const float *b, size_t b_count,
+            ssize_t min_lag, ssize_t max_lag,
+            void *buf)
+        {
+            if (max_lag < min_lag)
+                return 0.0f;
+
+            size_t count    = max_lag - min_lag + 1;
+            float norm      = (a_count > 0) && (b_count > 0) ?
+                dsp::h_sqr_sum(a, a_count) * dsp::h_sqr_sum(b, b_count) : 0.0f;
+            if ((norm <= 1e-36f) || (max_lag + ssize_t(b_count) <= 0) || (min_lag >= ssize_t(a_count)))
+            {
+                dsp::fill_zero(dst, count);
+                return min_lag;
+            }
+
+            size_t n_lo, n_hi;
+            size_t rank     = xcorr_rank(a_count, b_count, min_lag, max_lag, &n_lo, &n_hi);
+            size_t size     = size_t(1) << rank;
+            float *t        = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            float *sa       = &t[size];
+            float *sb       = &sa[size + 2];
+
+            // Compute the spectrum of convolution
+            dsp::copy(t, a, a_count);
+            dsp::fill_zero(&t[a_count], size - a_count);
+            dsp::real_direct_fft(sa, t, rank);
+            dsp::reverse2(t, b, b_count);
+            dsp::fill_zero(&t[b_count], size - b_count);
+            dsp::real_direct_fft(sb, t, rank);
+            dsp::pcomplex_mul3(sa, sa, sb, (size >> 1) + 1);
+            dsp::real_reverse_fft(t, sa, rank);
+
+            // Store normalized values, the lags outside of the signal range are zero
+            size_t head     = n_lo - (min_lag + ssize_t(b_count) - 1);
+            size_t items    = n_hi - n_lo + 1;
+            dsp::fill_zero(dst, head);
+            dsp::mul_k3(&dst[head], &t[n_lo], 1.0f / sqrtf(norm), items);
+            dsp::fill_zero(&dst[head + items], count - head - items);
+
+            return min_lag + xcorr_peak(dst, count);
+        }
+
+        /*
+         * The autocorrelation is computed by the reverse transform of the power
+         * spectrum. The element r[k] is aliased with r[k-N] which is zero when
+         * N >= count + k.
+         */
+        static size_t autocorr_rank(size_t count, size_t max_lag)
+        {
+            size_t size     = count + lsp_min(max_lag, count);
+            size_t rank     = 3;
+            while ((size_t(1) << rank) < size)
+                ++rank;
+            return rank;
+        }
+
+        size_t autocorr_size(size_t count, size_t max_lag)
+        {
+            size_t rank     = autocorr_rank(count, max_lag);
+            return ((size_t(2) << rank) + 2) * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        float autocorr(float *dst,
+            const float *src, size_t count,
+            size_t min_lag, size_t max_lag,
+            void *buf)
+        {
+            if (max_lag < min_lag)
+                return 0.0f;
+
+            size_t lags     = max_lag - min_lag + 1;
+            float norm      = (count > 0) ? dsp::h_sqr_sum(src, count) : 0.0f;
+            if ((norm <= 1e-18f) || (min_lag >= count))
+            {
+                dsp::fill_zero(dst, lags);
+                return min_lag;
+            }
+
+            size_t rank     = autocorr_rank(count, max_lag);
+            size_t size     = size_t(1) << rank;
+            size_t half     = (size >> 1) + 1;
+            float *t        = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            float *sp       = &t[size];
+
+            // Compute the power spectrum
+            dsp::copy(t, src, count);
+            dsp::fill_zero(&t[count], size - count);
+            dsp::real_direct_fft(sp, t, rank);
+            dsp::pcomplex_mod(t, sp, half);
+            dsp::sqr1(t, half);
+            dsp::pcomplex_r2c(sp, t, half);
+            dsp::real_reverse_fft(t, sp, rank);
+
+            // Store normalized values
+            size_t items    = lsp_min(count - min_lag, lags);
+            dsp::mul_k3(dst, &t[min_lag], 1.0f / norm, items);
+            dsp::fill_zero(&dst[items], lags - items);
+
+            return min_lag + xcorr_peak(dst, lags);
+        }
+
     } /* namespace generic */
 } /* namespace lsp */
 
@@ -1092,6 +1092,28 @@ namespace lsp
             // Do reverse FFT transformation
             fastconv_restore_internal(dst, tmp, rank);
         }
+
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank + 1);
+
+            // All complex numbers are stored in the following format:
+            // [r0 r1 r2 r3 i0 i1 i2 i3  r4 r5 r6 r7 i4 i5 i6 i7  ... ]
+            for (size_t i=0; i<items; i += 8)
+            {
+                for (size_t j=0; j<4; ++j)
+                {
+                    float re        = c1[j]*c2[j] - c1[j+4]*c2[j+4];
+                    float im        = c1[j]*c2[j+4] + c1[j+4]*c2[j];
+                    dst[j]         += re;
+                    dst[j+4]       += im;
+                }
+
+                dst        += 8;
+                c1         += 8;
+                c2         += 8;
+            }
+        }
     }
 }
 
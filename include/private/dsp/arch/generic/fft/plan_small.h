@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FFT_PLAN_SMALL_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FFT_PLAN_SMALL_H_
+
+#if !defined(PRIVATE_DSP_ARCH_X86_SSE_IMPL) && \
+    !defined(PRIVATE_DSP_ARCH_X86_AVX_IMPL)
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_*_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /**
+         * Perform FFT of rank less than 3
+         * @param dst_re real part of destination
+         * @param dst_im imaginary part of destination
+         * @param src_re real part of source
+         * @param src_im imaginary part of source
+         * @param stride distance between items
+         * @param rank rank of FFT
+         * @param dir -1 for direct FFT, +1 for reverse FFT
+         */
+        static inline void fft_plan_small(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+            size_t stride, size_t rank, float dir)
+        {
+            float re[4], im[4];
+            size_t count    = 1 << rank;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                size_t j        = (rank > 0) ? reverse_bits(uint32_t(i), rank) : 0;
+                re[j]           = src_re[i*stride];
+                im[j]           = src_im[i*stride];
+            }
+
+            // 2-point butterflies
+            for (size_t i=1; i<count; i += 2)
+            {
+                float t_re      = re[i];
+                float t_im      = im[i];
+                re[i]           = re[i-1] - t_re;
+                im[i]           = im[i-1] - t_im;
+                re[i-1]        += t_re;
+                im[i-1]        += t_im;
+            }
+
+            // 4-point butterflies, second pair is multiplied by exp(dir*i*pi/2)
+            if (rank == 2)
+            {
+                float c_re      = -dir * im[3];
+                float c_im      = dir * re[3];
+                float t_re      = re[2];
+                float t_im      = im[2];
+
+                re[2]           = re[0] - t_re;
+                im[2]           = im[0] - t_im;
+                re[0]          += t_re;
+                im[0]          += t_im;
+                re[3]           = re[1] - c_re;
+                im[3]           = im[1] - c_im;
+                re[1]          += c_re;
+                im[1]          += c_im;
+            }
+
+            float k         = (dir > 0.0f) ? 1.0f / count : 1.0f;
+            for (size_t i=0; i<count; ++i)
+            {
+                dst_re[i*stride]    = re[i] * k;
+                dst_im[i*stride]    = im[i] * k;
+            }
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FFT_PLAN_SMALL_H_ */
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FFT_REAL_SMALL_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FFT_REAL_SMALL_H_
+
+#if !defined(PRIVATE_DSP_ARCH_GENERIC_IMPL) && \
+    !defined(PRIVATE_DSP_ARCH_X86_SSE_IMPL) && \
+    !defined(PRIVATE_DSP_ARCH_X86_AVX_IMPL) && \
+    !defined(PRIVATE_DSP_ARCH_X86_AVX512_IMPL) && \
+    !defined(PRIVATE_DSP_ARCH_ARM_NEON_D32_IMPL) && \
+    !defined(PRIVATE_DSP_ARCH_AARCH64_ASIMD_IMPL)
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_*_IMPL */
+
+/*
+ * Scalar parts of the real-valued FFT shared between the generic and SIMD implementations:
+ * transforms of small ranks which are not worth vectorizing, processing of the DC and the
+ * Nyquist frequency and the scalar split/join pass for the tails of spectrum.
+ */
+namespace lsp
+{
+    namespace generic
+    {
+        /**
+         * Split the spectrum of the complex FFT of half size, processes harmonics 1..N/2
+         * and N-1..N/2 pairwise, N = 2^(rank-1), DC and Nyquist frequency should be already
+         * processed by real_fft_split_dc()
+         *
+         * @param dst spectrum to split
+         * @param w_re real parts of W^k = exp(-j*pi*k/N), the k-th element is used for the k-th harmonic
+         * @param w_im imaginary parts of W^k
+         * @param rank the rank of real FFT
+         */
+        static inline void real_split_direct_x1(float *dst, const float *w_re, const float *w_im, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            float *a        = &dst[2];
+            float *b        = &dst[(items - 1) << 1];
+
+            for (size_t k=1; k <= (items >> 1); ++k)
+            {
+                float s         = a[0] + b[0];
+                float d         = a[1] - b[1];
+                float p         = a[1] + b[1];
+                float q         = b[0] - a[0];
+
+                float t_re      = w_re[k] * p + w_im[k] * q;
+                float t_im      = w_re[k] * q - w_im[k] * p;
+
+                a[0]            = (s + t_re) * 0.5f;
+                a[1]            = (d + t_im) * 0.5f;
+                b[0]            = (s - t_re) * 0.5f;
+                b[1]            = (t_im - d) * 0.5f;
+
+                a              += 2;
+                b              -= 2;
+            }
+        }
+
+        /**
+         * Join the Hermitian-symmetric spectrum into the spectrum of the complex FFT of half size,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), DC and Nyquist
+         * frequency should be processed by real_fft_join_dc()
+         *
+         * @param dst destination spectrum
+         * @param src source spectrum
+         * @param w_re real parts of W^k = exp(-j*pi*k/N), the k-th element is used for the k-th harmonic
+         * @param w_im imaginary parts of W^k
+         * @param rank the rank of real FFT
+         */
+        static inline void real_split_reverse_x1(float *dst, const float *src, const float *w_re, const float *w_im, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            const float *sa = &src[2];
+            const float *sb = &src[(items - 1) << 1];
+            float *da       = &dst[2];
+            float *db       = &dst[(items - 1) << 1];
+
+            for (size_t k=1; k <= (items >> 1); ++k)
+            {
+                float s         = sa[0] + sb[0];
+                float d         = sa[1] - sb[1];
+                float p         = sa[0] - sb[0];
+                float q         = sa[1] + sb[1];
+
+                float o_re      = w_re[k] * p - w_im[k] * q;
+                float o_im      = w_re[k] * q + w_im[k] * p;
+
+                da[0]           = (s - o_im) * 0.5f;
+                da[1]           = (d + o_re) * 0.5f;
+                db[0]           = (s + o_im) * 0.5f;
+                db[1]           = (o_re - d) * 0.5f;
+
+                sa             += 2;
+                sb             -= 2;
+                da             += 2;
+                db             -= 2;
+            }
+        }
+
+        static inline void real_fft_split_dc(float *dst, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            float re        = dst[0];
+            float im        = dst[1];
+            dst[0]          = re + im;
+            dst[1]          = 0.0f;
+            dst[items*2]    = re - im;
+            dst[items*2+1]  = 0.0f;
+        }
+
+        static inline void real_fft_join_dc(float *dst, const float *src, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            float re        = src[0];
+            float im        = src[items*2];
+            dst[0]          = (re + im) * 0.5f;
+            dst[1]          = (re - im) * 0.5f;
+        }
+
+        static inline void real_fft4_direct(float *dst)
+        {
+            // 4-point complex FFT of the packed data, the order of output is natural
+            float e0_re     = dst[0] + dst[4];
+            float e0_im     = dst[1] + dst[5];
+            float e1_re     = dst[0] - dst[4];
+            float e1_im     = dst[1] - dst[5];
+            float o0_re     = dst[2] + dst[6];
+            float o0_im     = dst[3] + dst[7];
+            float o1_re     = dst[2] - dst[6];
+            float o1_im     = dst[3] - dst[7];
+
+            dst[0]          = e0_re + o0_re;
+            dst[1]          = e0_im + o0_im;
+            dst[2]          = e1_re + o1_im;
+            dst[3]          = e1_im - o1_re;
+            dst[4]          = e0_re - o0_re;
+            dst[5]          = e0_im - o0_im;
+            dst[6]          = e1_re - o1_im;
+            dst[7]          = e1_im + o1_re;
+        }
+
+        static inline void real_fft4_reverse(float *dst)
+        {
+            // 4-point complex reverse FFT of the packed data with normalization
+            float e0_re     = dst[0] + dst[4];
+            float e0_im     = dst[1] + dst[5];
+            float e1_re     = dst[0] - dst[4];
+            float e1_im     = dst[1] - dst[5];
+            float o0_re     = dst[2] + dst[6];
+            float o0_im     = dst[3] + dst[7];
+            float o1_re     = dst[2] - dst[6];
+            float o1_im     = dst[3] - dst[7];
+
+            dst[0]          = (e0_re + o0_re) * 0.25f;
+            dst[1]          = (e0_im + o0_im) * 0.25f;
+            dst[2]          = (e1_re - o1_im) * 0.25f;
+            dst[3]          = (e1_im + o1_re) * 0.25f;
+            dst[4]          = (e0_re - o0_re) * 0.25f;
+            dst[5]          = (e0_im - o0_im) * 0.25f;
+            dst[6]          = (e1_re + o1_im) * 0.25f;
+            dst[7]          = (e1_im - o1_re) * 0.25f;
+        }
+
+        /**
+         * Direct real FFT of rank 0..3
+         *
+         * @param dst complex half-spectrum, 2^rank + 2 floats
+         * @param src real signal, 2^rank floats
+         * @param rank the rank of FFT, should not be greater than 3
+         */
+        static inline void real_small_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank == 3)
+            {
+                // W^k = exp(-j*pi*k/4)
+                static const float w_re[] = { 1.0000000000000000f, 0.7071067811865476f, 0.0000000000000000f };
+                static const float w_im[] = { 0.0000000000000000f, 0.7071067811865475f, 1.0000000000000000f };
+
+                for (size_t i=0; i<8; ++i)
+                    dst[i]          = src[i];
+                real_fft4_direct(dst);
+                real_fft_split_dc(dst, rank);
+                real_split_direct_x1(dst, w_re, w_im, rank);
+            }
+            else if (rank == 2)
+            {
+                float s0        = src[0] + src[2];
+                float s1        = src[0] - src[2];
+                float s2        = src[1] + src[3];
+                float s3        = src[3] - src[1];
+
+                dst[0]          = s0 + s2;
+                dst[1]          = 0.0f;
+                dst[2]          = s1;
+                dst[3]          = s3;
+                dst[4]          = s0 - s2;
+                dst[5]          = 0.0f;
+            }
+            else if (rank == 1)
+            {
+                float s0        = src[0];
+                float s1        = src[1];
+                dst[0]          = s0 + s1;
+                dst[1]          = 0.0f;
+                dst[2]          = s0 - s1;
+                dst[3]          = 0.0f;
+            }
+            else
+            {
+                dst[0]          = src[0];
+                dst[1]          = 0.0f;
+            }
+        }
+
+        /**
+         * Reverse real FFT of rank 0..3
+         *
+         * @param dst real signal, 2^rank floats
+         * @param src complex half-spectrum, 2^rank + 2 floats
+         * @param rank the rank of FFT, should not be greater than 3
+         */
+        static inline void real_small_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank == 3)
+            {
+                // W^k = exp(-j*pi*k/4)
+                static const float w_re[] = { 1.0000000000000000f, 0.7071067811865476f, 0.0000000000000000f };
+                static const float w_im[] = { 0.0000000000000000f, 0.7071067811865475f, 1.0000000000000000f };
+
+                real_fft_join_dc(dst, src, rank);
+                real_split_reverse_x1(dst, src, w_re, w_im, rank);
+                real_fft4_reverse(dst);
+            }
+            else if (rank == 2)
+            {
+                float s0        = src[0] + src[4];
+                float s1        = src[0] - src[4];
+                float s2        = src[2] + src[2];
+                float s3        = src[3] + src[3];
+
+                dst[0]          = (s0 + s2) * 0.25f;
+                dst[1]          = (s1 - s3) * 0.25f;
+                dst[2]          = (s0 - s2) * 0.25f;
+                dst[3]          = (s1 + s3) * 0.25f;
+            }
+            else if (rank == 1)
+            {
+                float s0        = src[0];
+                float s1        = src[2];
+                dst[0]          = (s0 + s1) * 0.5f;
+                dst[1]          = (s0 - s1) * 0.5f;
+            }
+            else
+                dst[0]          = src[0];
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FFT_REAL_SMALL_H_ */
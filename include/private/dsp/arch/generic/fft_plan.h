@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FFT_PLAN_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FFT_PLAN_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /*
+         * The plan stores twiddle factors for butterfly stages of rank 4 and above, the stage
+         * of rank i consists of 2^i twiddle factors w[k] = exp(i*pi*k/2^i), grouped by 16 items:
+         * 16 cosines are followed by 16 sines. The table of the stage of rank 4 is always present
+         * because lower stages take their twiddle factors from it.
+         */
+        size_t fft_plan_size(size_t rank)
+        {
+            size_t count    = (rank > 4) ? (size_t(2) << rank) - 32 : 32;
+            return count * sizeof(float) + 0x40; // Additional space for alignment
+        }
+
+        void fft_plan_init(dsp::fft_plan_t *plan, void *buf, size_t rank)
+        {
+            float *tw       = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            plan->twiddle   = tw;
+            plan->rank      = rank;
+
+            size_t last     = (rank > 4) ? rank : 5;
+            for (size_t i=4; i<last; ++i)
+            {
+                size_t n        = size_t(1) << i;
+                double k        = M_PI / double(n);
+
+                for (size_t j=0; j<n; j += 16, tw += 32)
+                {
+                    for (size_t l=0; l<16; ++l)
+                    {
+                        double a        = k * double(j + l);
+                        tw[l]           = cos(a);
+                        tw[l + 16]      = sin(a);
+                    }
+                }
+            }
+        }
+
+        static void fft_plan_scramble(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t stride, size_t rank)
+        {
+            size_t count    = size_t(1) << rank;
+            if (rank == 0)
+            {
+                dst_re[0]       = src_re[0];
+                dst_im[0]       = src_im[0];
+                return;
+            }
+
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                for (size_t i=0; i<count; ++i)
+                {
+                    size_t j        = reverse_bits(uint32_t(i), rank);
+                    if (i >= j)
+                        continue;
+
+                    float re            = dst_re[i*stride];
+                    float im            = dst_im[i*stride];
+                    dst_re[i*stride]    = dst_re[j*stride];
+                    dst_im[i*stride]    = dst_im[j*stride];
+                    dst_re[j*stride]    = re;
+                    dst_im[j*stride]    = im;
+                }
+            }
+            else
+            {
+                for (size_t i=0; i<count; ++i)
+                {
+                    size_t j            = reverse_bits(uint32_t(i), rank);
+                    dst_re[i*stride]    = src_re[j*stride];
+                    dst_im[i*stride]    = src_im[j*stride];
+                }
+            }
+        }
+
+        /**
+         * Perform butterflies over the scrambled data
+         * @param plan FFT plan
+         * @param re real part of data
+         * @param im imaginary part of data
+         * @param stride distance between items
+         * @param dir -1 for direct FFT, +1 for reverse FFT
+         */
+        static void fft_plan_butterflies(const dsp::fft_plan_t *plan, float *re, float *im, size_t stride, float dir)
+        {
+            size_t rank         = plan->rank;
+            size_t count        = size_t(1) << rank;
+            const float *tw     = plan->twiddle;
+
+            // Stages of rank 0..3: take every (16 >> i)'th twiddle factor of the stage of rank 4
+            for (size_t i=0; (i < 4) && (i < rank); ++i)
+            {
+                size_t n            = size_t(1) << i;
+                size_t step         = 16 >> i;
+
+                for (size_t k=0; k<n; ++k)
+                {
+                    float w_re          = tw[k*step];
+                    float w_im          = dir * tw[k*step + 16];
+
+                    for (size_t a=k; a<count; a += (n << 1))
+                    {
+                        float *a_re         = &re[a*stride];
+                        float *a_im         = &im[a*stride];
+                        float *b_re         = &re[(a + n)*stride];
+                        float *b_im         = &im[(a + n)*stride];
+
+                        float c_re          = *b_re * w_re - *b_im * w_im;
+                        float c_im          = *b_re * w_im + *b_im * w_re;
+
+                        *b_re               = *a_re - c_re;
+                        *b_im               = *a_im - c_im;
+                        *a_re               = *a_re + c_re;
+                        *a_im               = *a_im + c_im;
+                    }
+                }
+            }
+
+            // Stages of rank 4 and above
+            for (size_t i=4; i < rank; ++i)
+            {
+                size_t n            = size_t(1) << i;
+
+                for (size_t b=0; b<count; b += (n << 1))
+                {
+                    const float *w      = tw;
+
+                    for (size_t k=0; k<n; k += 16, w += 32)
+                    {
+                        for (size_t l=0; l<16; ++l)
+                        {
+                            float w_re          = w[l];
+                            float w_im          = dir * w[l + 16];
+
+                            float *a_re         = &re[(b + k + l)*stride];
+                            float *a_im         = &im[(b + k + l)*stride];
+                            float *b_re         = &re[(b + k + l + n)*stride];
+                            float *b_im         = &im[(b + k + l + n)*stride];
+
+                            float c_re          = *b_re * w_re - *b_im * w_im;
+                            float c_im          = *b_re * w_im + *b_im * w_re;
+
+                            *b_re               = *a_re - c_re;
+                            *b_im               = *a_im - c_im;
+                            *a_re               = *a_re + c_re;
+                            *a_im               = *a_im + c_im;
+                        }
+                    }
+                }
+
+                tw                 += n << 1;
+            }
+        }
+
+        void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            fft_plan_scramble(dst_re, dst_im, src_re, src_im, 1, plan->rank);
+            fft_plan_butterflies(plan, dst_re, dst_im, 1, -1.0f);
+        }
+
+        void fft_plan_reverse(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            fft_plan_scramble(dst_re, dst_im, src_re, src_im, 1, plan->rank);
+            fft_plan_butterflies(plan, dst_re, dst_im, 1, 1.0f);
+
+            normalize_fft2(dst_re, dst_im, plan->rank);
+        }
+
+        void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            fft_plan_scramble(&dst[0], &dst[1], &src[0], &src[1], 2, plan->rank);
+            fft_plan_butterflies(plan, &dst[0], &dst[1], 2, -1.0f);
+        }
+
+        void fft_plan_packed_reverse(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            fft_plan_scramble(&dst[0], &dst[1], &src[0], &src[1], 2, plan->rank);
+            fft_plan_butterflies(plan, &dst[0], &dst[1], 2, 1.0f);
+
+            mul_k2(dst, 1.0f / float(size_t(1) << plan->rank), size_t(2) << plan->rank);
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FFT_PLAN_H_ */
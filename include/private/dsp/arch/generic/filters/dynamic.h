@@ -26,6 +26,8 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
 
+#include <private/dsp/arch/generic/filters/lerp.h>
+
 namespace lsp
 {
     namespace generic
@@ -401,6 +403,117 @@ namespace lsp
                 d          += 4;   // Shift memory pointer by 4 floats
             }
         }
+
+        /*
+         * Process the interpolated filter bank, the filter of each lane depends only on the
+         * index of the sample, so the lanes are applied one after another like a chain of
+         * dyn_biquad_process_x1 calls
+         */
+        static void dyn_lerp_process(float *dst, const float *src, float *d, size_t count,
+            size_t lanes, const float *w)
+        {
+            const float *step   = &w[DYN_LERP_ITEMS(lanes)];
+
+            for (size_t j=0; j<lanes; ++j)
+            {
+                const float *b      = &w[j];
+                const float *s      = &step[j];
+                float d0            = d[j];
+                float d1            = d[lanes + j];
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    const float k       = float(i);
+                    const float n       = 1.0f / (b[5*lanes] + s[5*lanes]*k);
+                    const float b0      = (b[0*lanes] + s[0*lanes]*k) * n;
+                    const float b1      = (b[1*lanes] + s[1*lanes]*k) * n;
+                    const float b2      = (b[2*lanes] + s[2*lanes]*k) * n;
+                    const float a1      = (b[3*lanes] + s[3*lanes]*k) * n;
+                    const float a2      = (b[4*lanes] + s[4*lanes]*k) * n;
+
+                    const float x       = src[i];
+                    const float s2      = b0*x + d0;
+                    const float p1      = b1*x + a1*s2;
+                    const float p2      = b2*x + a2*s2;
+
+                    d0                  = d1 + p1;
+                    d1                  = p2;
+                    dst[i]              = s2;
+                }
+
+                d[j]                = d0;
+                d[lanes + j]        = d1;
+                src                 = dst;
+            }
+        }
+
+        #define DYN_BIQUAD_LERP(N) \
+            if (count <= 0) \
+                return; \
+            \
+            float w[DYN_LERP_ITEMS(N) * 2]; \
+            dyn_lerp_biquad_init(w, reinterpret_cast<const float *>(f0), reinterpret_cast<const float *>(f1), \
+                N, N, count); \
+            dyn_lerp_process(dst, src, d, count, N, w);
+
+        #define DYN_CASCADE_LERP(N) \
+            if (count <= 0) \
+                return; \
+            \
+            float w[DYN_LERP_ITEMS(N) * 2]; \
+            dyn_lerp_cascade_init(w, c0, c1, kf, N, count); \
+            dyn_lerp_process(dst, src, d, count, N, w);
+
+        void dyn_biquad_lerp_x1(float *dst, const float *src, float *d, size_t count,
+            const dsp::biquad_x1_t *f0, const dsp::biquad_x1_t *f1)
+        {
+            DYN_BIQUAD_LERP(1);
+        }
+
+        void dyn_biquad_lerp_x2(float *dst, const float *src, float *d, size_t count,
+            const dsp::biquad_x2_t *f0, const dsp::biquad_x2_t *f1)
+        {
+            DYN_BIQUAD_LERP(2);
+        }
+
+        void dyn_biquad_lerp_x4(float *dst, const float *src, float *d, size_t count,
+            const dsp::biquad_x4_t *f0, const dsp::biquad_x4_t *f1)
+        {
+            DYN_BIQUAD_LERP(4);
+        }
+
+        void dyn_biquad_lerp_x8(float *dst, const float *src, float *d, size_t count,
+            const dsp::biquad_x8_t *f0, const dsp::biquad_x8_t *f1)
+        {
+            DYN_BIQUAD_LERP(8);
+        }
+
+        void dyn_cascade_lerp_x1(float *dst, const float *src, float *d, size_t count,
+            const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf)
+        {
+            DYN_CASCADE_LERP(1);
+        }
+
+        void dyn_cascade_lerp_x2(float *dst, const float *src, float *d, size_t count,
+            const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf)
+        {
+            DYN_CASCADE_LERP(2);
+        }
+
+        void dyn_cascade_lerp_x4(float *dst, const float *src, float *d, size_t count,
+            const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf)
+        {
+            DYN_CASCADE_LERP(4);
+        }
+
+        void dyn_cascade_lerp_x8(float *dst, const float *src, float *d, size_t count,
+            const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf)
+        {
+            DYN_CASCADE_LERP(8);
+        }
+
+        #undef DYN_BIQUAD_LERP
+        #undef DYN_CASCADE_LERP
     }
 }
 
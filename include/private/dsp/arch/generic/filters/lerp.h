@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FILTERS_LERP_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FILTERS_LERP_H_
+
+#if !defined(PRIVATE_DSP_ARCH_GENERIC_IMPL) && \
+    !defined(PRIVATE_DSP_ARCH_X86_SSE_IMPL) && \
+    !defined(PRIVATE_DSP_ARCH_X86_AVX_IMPL)
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_*_IMPL */
+
+/*
+ * Interpolation state of filter banks shared between the generic and SIMD implementations
+ * of dyn_biquad_lerp_*, dyn_cascade_lerp_* and svf_lerp_* functions.
+ *
+ * The state consists of two blocks, base and step, each block stores 6 rows of N floats,
+ * one float per lane: b0, b1, b2, a1, a2 and n. The step block starts at the offset of
+ * DYN_LERP_ITEMS(N) floats, the padding between blocks is zeroed. The filter of the lane
+ * for the sample k is computed as (b0, b1, b2, a1, a2) / n, each value is base + step * k.
+ * The bilinear transform is linear in the coefficients of the analog cascade except the
+ * final division by n, so the interpolation of the cascade takes one division per sample.
+ */
+#define DYN_LERP_ITEMS(lanes)       ((((lanes) * 6) + 3) & ~size_t(3))
+
+namespace lsp
+{
+    namespace generic
+    {
+        static inline void dyn_lerp_bilinear(float *v, const dsp::f_cascade_t *c, float kf, float kf2)
+        {
+            // Same as bilinear_transform_x1 without the normalization
+            const float T0  = c->t[0];
+            const float T1  = c->t[1]*kf;
+            const float T2  = c->t[2]*kf2;
+            const float B0  = c->b[0];
+            const float B1  = c->b[1]*kf;
+            const float B2  = c->b[2]*kf2;
+
+            v[0]            = T0 + T1 + T2;
+            v[1]            = 2.0f * (T0 - T2);
+            v[2]            = T0 - T1 + T2;
+            v[3]            = 2.0f * (B2 - B0);     // Sign negated
+            v[4]            = B1 - B2 - B0;         // Sign negated
+            v[5]            = B0 + B1 + B2;
+        }
+
+        static inline void dyn_lerp_pad(float *w, size_t lanes)
+        {
+            const size_t items  = DYN_LERP_ITEMS(lanes);
+            for (size_t i=lanes*6; i<items; ++i)
+            {
+                w[i]                = 0.0f;
+                w[i + items]        = 0.0f;
+            }
+        }
+
+        /**
+         * Initialize the interpolation state between two filter banks
+         * @param w interpolation state of 2 * DYN_LERP_ITEMS(lanes) floats
+         * @param f0 filter bank at the start of the block
+         * @param f1 filter bank at the end of the block
+         * @param lanes number of lanes to take from filter banks
+         * @param stride number of floats in the row of the filter bank
+         * @param count number of samples in the block, should be positive
+         */
+        static inline void dyn_lerp_biquad_init(float *w, const float *f0, const float *f1,
+            size_t lanes, size_t stride, size_t count)
+        {
+            const float delta   = 1.0f / float(count);
+            float *step         = &w[DYN_LERP_ITEMS(lanes)];
+
+            for (size_t r=0; r<5; ++r, f0 += stride, f1 += stride)
+            {
+                for (size_t j=0; j<lanes; ++j)
+                {
+                    w[r*lanes + j]      = f0[j];
+                    step[r*lanes + j]   = (f1[j] - f0[j]) * delta;
+                }
+            }
+            for (size_t j=0; j<lanes; ++j)
+            {
+                w[5*lanes + j]      = 1.0f;
+                step[5*lanes + j]   = 0.0f;
+            }
+
+            dyn_lerp_pad(w, lanes);
+        }
+
+        /**
+         * Initialize the interpolation state between two sets of analog filter cascades
+         * @param w interpolation state of 2 * DYN_LERP_ITEMS(lanes) floats
+         * @param c0 array of lanes analog filter cascades at the start of the block
+         * @param c1 array of lanes analog filter cascades at the end of the block
+         * @param kf frequency shift coefficient of the bilinear transform
+         * @param lanes number of lanes
+         * @param count number of samples in the block, should be positive
+         */
+        static inline void dyn_lerp_cascade_init(float *w, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1,
+            float kf, size_t lanes, size_t count)
+        {
+            const float delta   = 1.0f / float(count);
+            const float kf2     = kf * kf;
+            float *step         = &w[DYN_LERP_ITEMS(lanes)];
+            float v0[6], v1[6];
+
+            for (size_t j=0; j<lanes; ++j)
+            {
+                dyn_lerp_bilinear(v0, &c0[j], kf, kf2);
+                dyn_lerp_bilinear(v1, &c1[j], kf, kf2);
+
+                for (size_t r=0; r<6; ++r)
+                {
+                    w[r*lanes + j]      = v0[r];
+                    step[r*lanes + j]   = (v1[r] - v0[r]) * delta;
+                }
+            }
+
+            dyn_lerp_pad(w, lanes);
+        }
+
+        /**
+         * Initialize the interpolation state between two state-variable filter banks: 5 rows
+         * (g, k, m0, m1, m2) of lanes floats of the base followed by 5 rows of the step, the
+         * filter for the sample k is computed as base + step * k
+         * @param w interpolation state of 10 * lanes floats
+         * @param f0 filter bank at the start of the block
+         * @param f1 filter bank at the end of the block
+         * @param lanes number of lanes to take from filter banks
+         * @param stride number of floats in the row of the filter bank
+         * @param count number of samples in the block, should be positive
+         */
+        static inline void svf_lerp_init(float *w, const float *f0, const float *f1,
+            size_t lanes, size_t stride, size_t count)
+        {
+            const float delta   = 1.0f / float(count);
+            float *step         = &w[lanes * 5];
+
+            for (size_t r=0; r<5; ++r, f0 += stride, f1 += stride)
+            {
+                for (size_t j=0; j<lanes; ++j)
+                {
+                    w[r*lanes + j]      = f0[j];
+                    step[r*lanes + j]   = (f1[j] - f0[j]) * delta;
+                }
+            }
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FILTERS_LERP_H_ */
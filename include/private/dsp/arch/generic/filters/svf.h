@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FILTERS_SVF_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FILTERS_SVF_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#include <private/dsp/arch/generic/filters/lerp.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        void svf_process_x1(float *dst, const float *src, float *d, size_t count, const dsp::svf_x1_t *f)
+        {
+            float ic1   = d[0];
+            float ic2   = d[1];
+
+            for (size_t i=0; i<count; ++i, ++f)
+            {
+                float x     = src[i];
+                float v1    = (ic1 + f->g * (x - ic2)) / (1.0f + f->g * (f->g + f->k));
+                float v2    = ic2 + f->g * v1;
+
+                dst[i]      = f->m0 * x + f->m1 * v1 + f->m2 * v2;
+
+                ic1         = v1 + v1 - ic1;
+                ic2         = v2 + v2 - ic2;
+            }
+
+            d[0]        = ic1;
+            d[1]        = ic2;
+        }
+
+        #define SVF_PROCESS(N) \
+            float *ic1  = &d[0]; \
+            float *ic2  = &d[N]; \
+            \
+            for (size_t i=0; i<count; ++i, ++f) \
+            { \
+                for (size_t j=0; j<N; ++j) \
+                { \
+                    float x     = src[j][i]; \
+                    float v1    = (ic1[j] + f->g[j] * (x - ic2[j])) / (1.0f + f->g[j] * (f->g[j] + f->k[j])); \
+                    float v2    = ic2[j] + f->g[j] * v1; \
+                    \
+                    dst[j][i]   = f->m0[j] * x + f->m1[j] * v1 + f->m2[j] * v2; \
+                    \
+                    ic1[j]      = v1 + v1 - ic1[j]; \
+                    ic2[j]      = v2 + v2 - ic2[j]; \
+                } \
+            }
+
+        void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f)
+        {
+            SVF_PROCESS(4);
+        }
+
+        void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f)
+        {
+            SVF_PROCESS(8);
+        }
+
+        void svf_lerp_x1(float *dst, const float *src, float *d, size_t count,
+            const dsp::svf_x1_t *f0, const dsp::svf_x1_t *f1)
+        {
+            if (count <= 0)
+                return;
+
+            const float delta   = 1.0f / float(count);
+            const float dg      = (f1->g - f0->g) * delta;
+            const float dk      = (f1->k - f0->k) * delta;
+            const float dm0     = (f1->m0 - f0->m0) * delta;
+            const float dm1     = (f1->m1 - f0->m1) * delta;
+            const float dm2     = (f1->m2 - f0->m2) * delta;
+            float ic1           = d[0];
+            float ic2           = d[1];
+
+            for (size_t i=0; i<count; ++i)
+            {
+                const float t   = float(i);
+                float g         = f0->g + dg * t;
+                float k         = f0->k + dk * t;
+                float x         = src[i];
+                float v1        = (ic1 + g * (x - ic2)) / (1.0f + g * (g + k));
+                float v2        = ic2 + g * v1;
+
+                dst[i]          = (f0->m0 + dm0 * t) * x + (f0->m1 + dm1 * t) * v1 + (f0->m2 + dm2 * t) * v2;
+
+                ic1             = v1 + v1 - ic1;
+                ic2             = v2 + v2 - ic2;
+            }
+
+            d[0]            = ic1;
+            d[1]            = ic2;
+        }
+
+        /*
+         * The coefficients of each sample are computed from the interpolation
+         * state (see generic/filters/lerp.h): base + step * sample
+         */
+        #define SVF_LERP(N) \
+            if (count <= 0) \
+                return; \
+            \
+            float w[N * 10]; \
+            const float *b  = &w[0]; \
+            const float *s  = &w[N * 5]; \
+            float *ic1      = &d[0]; \
+            float *ic2      = &d[N]; \
+            svf_lerp_init(w, f0->g, f1->g, N, N, count); \
+            \
+            for (size_t i=0; i<count; ++i) \
+            { \
+                const float t   = float(i); \
+                for (size_t j=0; j<N; ++j) \
+                { \
+                    float g     = b[j] + s[j] * t; \
+                    float k     = b[N + j] + s[N + j] * t; \
+                    float x     = src[j][i]; \
+                    float v1    = (ic1[j] + g * (x - ic2[j])) / (1.0f + g * (g + k)); \
+                    float v2    = ic2[j] + g * v1; \
+                    \
+                    dst[j][i]   = (b[2*N + j] + s[2*N + j] * t) * x + \
+                                  (b[3*N + j] + s[3*N + j] * t) * v1 + \
+                                  (b[4*N + j] + s[4*N + j] * t) * v2; \
+                    \
+                    ic1[j]      = v1 + v1 - ic1[j]; \
+                    ic2[j]      = v2 + v2 - ic2[j]; \
+                } \
+            }
+
+        void svf_lerp_x4(float * const *dst, const float * const *src, float *d, size_t count,
+            const dsp::svf_x4_t *f0, const dsp::svf_x4_t *f1)
+        {
+            SVF_LERP(4);
+        }
+
+        void svf_lerp_x8(float * const *dst, const float * const *src, float *d, size_t count,
+            const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1)
+        {
+            SVF_LERP(8);
+        }
+
+        #undef SVF_PROCESS
+        #undef SVF_LERP
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FILTERS_SVF_H_ */
@@ -298,46 +298,27 @@ namespace lsp
 
         static void matched_solve(float *p, float kf, float td, size_t count, size_t stride)
         {
-            if (p[2] == 0.0) // Test polynom for second-order
+            // The discrete transfer function is evaluated at the control frequency w = 0.1*kf*td
+            // by the roots of the transformed polynom: for z = exp(j*w) and root r = E*exp(j*a)
+            //   |z - r|^2 = (exp(R*T) - 1)^2 + 4*E*sin((w - a)/2)^2, E = exp(R*T)
+            // which, opposite to the direct evaluation of the polynom at z, does not suffer from
+            // the cancellation when w is small. The p[3] receives the ratio of the continuous
+            // and the discrete transfer function amplitudes at the control frequency.
+            // The order of each polynom is tested individually.
+            float v         = 0.05f * kf * td;
+            float s         = sinf(v);
+            float a2        = 2.0f/(kf*kf);
+            float k, b, c, D, A;
+
+            while (count--)
             {
-                if (p[1] == 0.0) // Test polynom for first order
+                if (p[2] != 0.0) // Test polynom for second-order
                 {
-                    while (count--)
-                    {
-                        p[3]        = 1; // transfer function
-                        p          += stride;
-                    }
-                }
-                else
-                {
-                    // First-order polynom:
-                    //   p(s) = p[0] + p[1]*(s/f)
+                    // Second-order polynom:
+                    //   p(s) = p[0] + p[1]*(s/f) + p[2]*(s/f)^2 = p[2]/f^2 * (p[0]*f^2/p[2] + p[1]*f/p[2]*s + s^2)
                     //
-                    // Transformed polynom:
-                    //   P[z] = p[1]/f - p[1]/f * exp(-f*p[0]*T/p[1]) * z^-1
-                    while (count--)
-                    {
-                        float k     = p[1]/kf;
-                        float R     = -p[0]/k;
-                        p[3]        = sqrtf(p[0]*p[0] + p[1]*p[1]*0.01f); // transfer function
-                        p[0]        = k;
-                        p[1]        = -k * expf(R*td);
+                    // Calculate the roots of the second-order polynom equation a*x^2 + b*x + c = 0
 
-                        p          += stride;
-                    }
-                }
-            }
-            else
-            {
-                // Second-order polynom:
-                //   p(s) = p[0] + p[1]*(s/f) + p[2]*(s/f)^2 = p[2]/f^2 * (p[0]*f^2/p[2] + p[1]*f/p[2]*s + s^2)
-                //
-                // Calculate the roots of the second-order polynom equation a*x^2 + b*x + c = 0
-                float k, b, c, D;
-                float a2   = 2.0f/(kf*kf);
-
-                while (count--)
-                {
                     // Transfer function
                     b           = p[0] - p[2]*0.01f;
                     c           = p[1]*0.1f;
@@ -357,8 +338,14 @@ namespace lsp
                         D           = sqrtf(D);
                         float R0    = td*(-b - D)/a2;
                         float R1    = td*(-b + D)/a2;
+                        float E0    = expf(R0);
+                        float E1    = expf(R1);
+                        float M0    = expm1f(R0);
+                        float M1    = expm1f(R1);
+                        A           = fabsf(k) * sqrtf(M0*M0 + 4.0f*E0*s*s) * sqrtf(M1*M1 + 4.0f*E1*s*s);
+
                         p[0]        = k;
-                        p[1]        = -k * (expf(R0) + expf(R1));
+                        p[1]        = -k * (E0 + E1);
                         p[2]        = k * expf(R0+R1);
                     }
                     else
@@ -369,14 +356,41 @@ namespace lsp
                         D           = sqrtf(-D);
                         float R     = -(td*b) /a2;
                         float K     = D /a2;
+                        float E     = expf(R);
+                        float M     = expm1f(R);
+                        float s0    = sinf(v - 0.5f*K*td);
+                        float s1    = sinf(v + 0.5f*K*td);
+                        A           = fabsf(k) * sqrtf(M*M + 4.0f*E*s0*s0) * sqrtf(M*M + 4.0f*E*s1*s1);
+
                         p[0]        = k;
-                        p[1]        = -2.0 * k * expf(R) * cosf(K*td);
+                        p[1]        = -2.0 * k * E * cosf(K*td);
                         p[2]        = k * expf(R+R);
                     }
 
-                    // Update pointer
-                    p          += stride;
+                    p[3]       /= A;
                 }
+                else if (p[1] != 0.0) // Test polynom for first order
+                {
+                    // First-order polynom:
+                    //   p(s) = p[0] + p[1]*(s/f)
+                    //
+                    // Transformed polynom:
+                    //   P[z] = p[1]/f - p[1]/f * exp(-f*p[0]*T/p[1]) * z^-1
+                    k           = p[1]/kf;
+                    float R     = -p[0]/k;
+                    float E     = expf(R*td);
+                    float M     = expm1f(R*td);
+                    A           = fabsf(k) * sqrtf(M*M + 4.0f*E*s*s);
+
+                    p[3]        = sqrtf(p[0]*p[0] + p[1]*p[1]*0.01f) / A; // transfer function
+                    p[0]        = k;
+                    p[1]        = -k * E;
+                }
+                else
+                    p[3]        = 1.0f / fabsf(p[0]); // transfer function
+
+                // Update pointer
+                p          += stride;
             }
         }
 
@@ -386,16 +400,11 @@ namespace lsp
             matched_solve(bc->t, kf, td, count, sizeof(f_cascade_t)/sizeof(float));
             matched_solve(bc->b, kf, td, count, sizeof(f_cascade_t)/sizeof(float));
 
-            double w        = kf * td * 0.1;
-            float cos_w     = cos(w);
-            float sin_w     = sin(w);
-            float cos_2w    = cos_w*cos_w - sin_w*sin_w; // cos(2x) = cos(x)^2 - sin(x)^2
-            float sin_2w    = 2*sin_w*cos_w; // sin(2x) = 2 * cos(x) * sin(x)
-
             // We have to calculate the norming factor of the digital filter
             // To do this, we should get the amplitude of the discrete transfer function
             // at the control frequency and the amplitude of the continuous transfer function
-            // at the same frequency.
+            // at the same frequency. Their ratio has been already stored by matched_solve
+            // into the t[3] and b[3] fields.
             // As control frequency we take the f/10 value
             // For the discrete transfer function it will be PI*0.2*f / SR
             // For the normalized continuous transfer function it will be always 0.1
@@ -403,15 +412,6 @@ namespace lsp
             // Iterate each cascade
             while (count--)
             {
-                // Calculate the discrete transfer function part at specified frequency
-                float re    = bc->t[0]*cos_2w + bc->t[1]*cos_w + bc->t[2];
-                float im    = bc->t[0]*sin_2w + bc->t[1]*sin_w;
-                float at    = sqrtf(re*re + im*im);
-
-                re          = bc->b[0]*cos_2w + bc->b[1]*cos_w + bc->b[2];
-                im          = bc->b[0]*sin_2w + bc->b[1]*sin_w;
-                float ab    = sqrtf(re*re + im*im);
-
                 // Now calculate the convolution for the new polynom:
                 /*
                            T[0] + T[1]*z^-1 + T[2]*z^-2
@@ -419,7 +419,7 @@ namespace lsp
                            B[0] + B[1]*z^-1 + B[2]*z^-2
 
                  */
-                float AN    = (ab * bc->t[3]) / (at * bc->b[3]); // Normalizing factor for the amplitude to match the analog filter
+                float AN    = bc->t[3] / bc->b[3]; // Normalizing factor for the amplitude to match the analog filter
                 float N2    = 1.0 / bc->b[0];
                 float N1    = AN * N2;
 
@@ -441,12 +441,6 @@ namespace lsp
 
         void matched_transform_x2(biquad_x2_t *bf, f_cascade_t *bc, float kf, float td, size_t count)
         {
-            double w        = kf * td * 0.1;
-            float cos_w     = cos(w);
-            float sin_w     = sin(w);
-            float cos_2w    = cos_w*cos_w - sin_w*sin_w; // cos(2x) = cos(x)^2 - sin(x)^2
-            float sin_2w    = 2*sin_w*cos_w; // sin(2x) = 2 * cos(x) * sin(x)
-
             // Step 1. Solve filters
             for (size_t i=0; i<2; ++i)
             {
@@ -457,31 +451,14 @@ namespace lsp
                 matched_solve(xc->b, kf, td, count - 1, (2*sizeof(f_cascade_t))/sizeof(float));
             }
 
-            float re[2], im[2], at[2], ab[2], AN[2], N1[2], N2[2];
+            float AN[2], N1[2], N2[2];
 
             // Iterate each cascade pair
             while (count--)
             {
-                // Calculate the discrete transfer function part at specified frequency
-                re[0]       = bc[0].t[0]*cos_2w + bc[0].t[1]*cos_w + bc[0].t[2];
-                re[1]       = bc[1].t[0]*cos_2w + bc[1].t[1]*cos_w + bc[1].t[2];
-                im[0]       = bc[0].t[0]*sin_2w + bc[0].t[1]*sin_w;
-                im[1]       = bc[1].t[0]*sin_2w + bc[1].t[1]*sin_w;
-
-                at[0]       = sqrtf(re[0]*re[0] + im[0]*im[0]);
-                at[1]       = sqrtf(re[1]*re[1] + im[1]*im[1]);
-
-                re[0]       = bc[0].b[0]*cos_2w + bc[0].b[1]*cos_w + bc[0].b[2];
-                re[1]       = bc[1].b[0]*cos_2w + bc[1].b[1]*cos_w + bc[1].b[2];
-                im[0]       = bc[0].b[0]*sin_2w + bc[0].b[1]*sin_w;
-                im[1]       = bc[1].b[0]*sin_2w + bc[1].b[1]*sin_w;
-
-                ab[0]       = sqrtf(re[0]*re[0] + im[0]*im[0]);
-                ab[1]       = sqrtf(re[1]*re[1] + im[1]*im[1]);
-
                 // Now calculate the convolution for the new polynom:
-                AN[0]       = (ab[0] * bc[0].t[3]) / (at[0] * bc[0].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[1]       = (ab[1] * bc[1].t[3]) / (at[1] * bc[1].b[3]); // Normalizing factor for the amplitude to match the analog filter
+                AN[0]       = bc[0].t[3] / bc[0].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[1]       = bc[1].t[3] / bc[1].b[3]; // Normalizing factor for the amplitude to match the analog filter
 
                 N2[0]       = 1.0 / bc[0].b[0];
                 N2[1]       = 1.0 / bc[1].b[0];
@@ -513,12 +490,6 @@ namespace lsp
 
         void matched_transform_x4(biquad_x4_t *bf, f_cascade_t *bc, float kf, float td, size_t count)
         {
-            double w        = kf * td * 0.1;
-            float cos_w     = cos(w);
-            float sin_w     = sin(w);
-            float cos_2w    = cos_w*cos_w - sin_w*sin_w; // cos(2x) = cos(x)^2 - sin(x)^2
-            float sin_2w    = 2*sin_w*cos_w; // sin(2x) = 2 * cos(x) * sin(x)
-
             // Step 1. Solve filters
             for (size_t i=0; i<4; ++i)
             {
@@ -529,47 +500,16 @@ namespace lsp
                 matched_solve(xc->b, kf, td, count - 3, (4*sizeof(f_cascade_t))/sizeof(float));
             }
 
-            float re[4], im[4], at[4], ab[4], AN[4], N1[4], N2[4];
+            float AN[4], N1[4], N2[4];
 
             // Iterate each cascade pair
             while (count--)
             {
-                // Calculate the discrete transfer function part at specified frequency
-                re[0]       = bc[0].t[0]*cos_2w + bc[0].t[1]*cos_w + bc[0].t[2];
-                re[1]       = bc[1].t[0]*cos_2w + bc[1].t[1]*cos_w + bc[1].t[2];
-                re[2]       = bc[2].t[0]*cos_2w + bc[2].t[1]*cos_w + bc[2].t[2];
-                re[3]       = bc[3].t[0]*cos_2w + bc[3].t[1]*cos_w + bc[3].t[2];
-
-                im[0]       = bc[0].t[0]*sin_2w + bc[0].t[1]*sin_w;
-                im[1]       = bc[1].t[0]*sin_2w + bc[1].t[1]*sin_w;
-                im[2]       = bc[2].t[0]*sin_2w + bc[2].t[1]*sin_w;
-                im[3]       = bc[3].t[0]*sin_2w + bc[3].t[1]*sin_w;
-
-                at[0]       = sqrtf(re[0]*re[0] + im[0]*im[0]);
-                at[1]       = sqrtf(re[1]*re[1] + im[1]*im[1]);
-                at[2]       = sqrtf(re[2]*re[2] + im[2]*im[2]);
-                at[3]       = sqrtf(re[3]*re[3] + im[3]*im[3]);
-
-                re[0]       = bc[0].b[0]*cos_2w + bc[0].b[1]*cos_w + bc[0].b[2];
-                re[1]       = bc[1].b[0]*cos_2w + bc[1].b[1]*cos_w + bc[1].b[2];
-                re[2]       = bc[2].b[0]*cos_2w + bc[2].b[1]*cos_w + bc[2].b[2];
-                re[3]       = bc[3].b[0]*cos_2w + bc[3].b[1]*cos_w + bc[3].b[2];
-
-                im[0]       = bc[0].b[0]*sin_2w + bc[0].b[1]*sin_w;
-                im[1]       = bc[1].b[0]*sin_2w + bc[1].b[1]*sin_w;
-                im[2]       = bc[2].b[0]*sin_2w + bc[2].b[1]*sin_w;
-                im[3]       = bc[3].b[0]*sin_2w + bc[3].b[1]*sin_w;
-
-                ab[0]       = sqrtf(re[0]*re[0] + im[0]*im[0]);
-                ab[1]       = sqrtf(re[1]*re[1] + im[1]*im[1]);
-                ab[2]       = sqrtf(re[2]*re[2] + im[2]*im[2]);
-                ab[3]       = sqrtf(re[3]*re[3] + im[3]*im[3]);
-
                 // Now calculate the convolution for the new polynom:
-                AN[0]       = (ab[0] * bc[0].t[3]) / (at[0] * bc[0].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[1]       = (ab[1] * bc[1].t[3]) / (at[1] * bc[1].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[2]       = (ab[2] * bc[2].t[3]) / (at[2] * bc[2].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[3]       = (ab[3] * bc[3].t[3]) / (at[3] * bc[3].b[3]); // Normalizing factor for the amplitude to match the analog filter
+                AN[0]       = bc[0].t[3] / bc[0].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[1]       = bc[1].t[3] / bc[1].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[2]       = bc[2].t[3] / bc[2].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[3]       = bc[3].t[3] / bc[3].b[3]; // Normalizing factor for the amplitude to match the analog filter
 
                 N2[0]       = 1.0 / bc[0].b[0];
                 N2[1]       = 1.0 / bc[1].b[0];
@@ -615,12 +555,6 @@ namespace lsp
 
         void matched_transform_x8(biquad_x8_t *bf, f_cascade_t *bc, float kf, float td, size_t count)
         {
-            double w        = kf * td * 0.1;
-            float cos_w     = cos(w);
-            float sin_w     = sin(w);
-            float cos_2w    = cos_w*cos_w - sin_w*sin_w; // cos(2x) = cos(x)^2 - sin(x)^2
-            float sin_2w    = 2*sin_w*cos_w; // sin(2x) = 2 * cos(x) * sin(x)
-
             // Step 1. Solve filters
             for (size_t i=0; i<8; ++i)
             {
@@ -631,75 +565,20 @@ namespace lsp
                 matched_solve(xc->b, kf, td, count - 7, (8*sizeof(f_cascade_t))/sizeof(float));
             }
 
-            float re[8], im[8], at[8], ab[8], AN[8], N1[8], N2[8];
+            float AN[8], N1[8], N2[8];
 
             // Iterate each cascade pair
             while (count--)
             {
-                // Calculate the discrete transfer function part at specified frequency
-                re[0]       = bc[0].t[0]*cos_2w + bc[0].t[1]*cos_w + bc[0].t[2];
-                re[1]       = bc[1].t[0]*cos_2w + bc[1].t[1]*cos_w + bc[1].t[2];
-                re[2]       = bc[2].t[0]*cos_2w + bc[2].t[1]*cos_w + bc[2].t[2];
-                re[3]       = bc[3].t[0]*cos_2w + bc[3].t[1]*cos_w + bc[3].t[2];
-                re[4]       = bc[4].t[0]*cos_2w + bc[4].t[1]*cos_w + bc[4].t[2];
-                re[5]       = bc[5].t[0]*cos_2w + bc[5].t[1]*cos_w + bc[5].t[2];
-                re[6]       = bc[6].t[0]*cos_2w + bc[6].t[1]*cos_w + bc[6].t[2];
-                re[7]       = bc[7].t[0]*cos_2w + bc[7].t[1]*cos_w + bc[7].t[2];
-
-                im[0]       = bc[0].t[0]*sin_2w + bc[0].t[1]*sin_w;
-                im[1]       = bc[1].t[0]*sin_2w + bc[1].t[1]*sin_w;
-                im[2]       = bc[2].t[0]*sin_2w + bc[2].t[1]*sin_w;
-                im[3]       = bc[3].t[0]*sin_2w + bc[3].t[1]*sin_w;
-                im[4]       = bc[4].t[0]*sin_2w + bc[4].t[1]*sin_w;
-                im[5]       = bc[5].t[0]*sin_2w + bc[5].t[1]*sin_w;
-                im[6]       = bc[6].t[0]*sin_2w + bc[6].t[1]*sin_w;
-                im[7]       = bc[7].t[0]*sin_2w + bc[7].t[1]*sin_w;
-
-                at[0]       = sqrtf(re[0]*re[0] + im[0]*im[0]);
-                at[1]       = sqrtf(re[1]*re[1] + im[1]*im[1]);
-                at[2]       = sqrtf(re[2]*re[2] + im[2]*im[2]);
-                at[3]       = sqrtf(re[3]*re[3] + im[3]*im[3]);
-                at[4]       = sqrtf(re[4]*re[4] + im[4]*im[4]);
-                at[5]       = sqrtf(re[5]*re[5] + im[5]*im[5]);
-                at[6]       = sqrtf(re[6]*re[6] + im[6]*im[6]);
-                at[7]       = sqrtf(re[7]*re[7] + im[7]*im[7]);
-
-                re[0]       = bc[0].b[0]*cos_2w + bc[0].b[1]*cos_w + bc[0].b[2];
-                re[1]       = bc[1].b[0]*cos_2w + bc[1].b[1]*cos_w + bc[1].b[2];
-                re[2]       = bc[2].b[0]*cos_2w + bc[2].b[1]*cos_w + bc[2].b[2];
-                re[3]       = bc[3].b[0]*cos_2w + bc[3].b[1]*cos_w + bc[3].b[2];
-                re[4]       = bc[4].b[0]*cos_2w + bc[4].b[1]*cos_w + bc[4].b[2];
-                re[5]       = bc[5].b[0]*cos_2w + bc[5].b[1]*cos_w + bc[5].b[2];
-                re[6]       = bc[6].b[0]*cos_2w + bc[6].b[1]*cos_w + bc[6].b[2];
-                re[7]       = bc[7].b[0]*cos_2w + bc[7].b[1]*cos_w + bc[7].b[2];
-
-                im[0]       = bc[0].b[0]*sin_2w + bc[0].b[1]*sin_w;
-                im[1]       = bc[1].b[0]*sin_2w + bc[1].b[1]*sin_w;
-                im[2]       = bc[2].b[0]*sin_2w + bc[2].b[1]*sin_w;
-                im[3]       = bc[3].b[0]*sin_2w + bc[3].b[1]*sin_w;
-                im[4]       = bc[4].b[0]*sin_2w + bc[4].b[1]*sin_w;
-                im[5]       = bc[5].b[0]*sin_2w + bc[5].b[1]*sin_w;
-                im[6]       = bc[6].b[0]*sin_2w + bc[6].b[1]*sin_w;
-                im[7]       = bc[7].b[0]*sin_2w + bc[7].b[1]*sin_w;
-
-                ab[0]       = sqrtf(re[0]*re[0] + im[0]*im[0]);
-                ab[1]       = sqrtf(re[1]*re[1] + im[1]*im[1]);
-                ab[2]       = sqrtf(re[2]*re[2] + im[2]*im[2]);
-                ab[3]       = sqrtf(re[3]*re[3] + im[3]*im[3]);
-                ab[4]       = sqrtf(re[4]*re[4] + im[4]*im[4]);
-                ab[5]       = sqrtf(re[5]*re[5] + im[5]*im[5]);
-                ab[6]       = sqrtf(re[6]*re[6] + im[6]*im[6]);
-                ab[7]       = sqrtf(re[7]*re[7] + im[7]*im[7]);
-
                 // Now calculate the convolution for the new polynom:
-                AN[0]       = (ab[0] * bc[0].t[3]) / (at[0] * bc[0].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[1]       = (ab[1] * bc[1].t[3]) / (at[1] * bc[1].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[2]       = (ab[2] * bc[2].t[3]) / (at[2] * bc[2].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[3]       = (ab[3] * bc[3].t[3]) / (at[3] * bc[3].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[4]       = (ab[4] * bc[4].t[3]) / (at[4] * bc[4].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[5]       = (ab[5] * bc[5].t[3]) / (at[5] * bc[5].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[6]       = (ab[6] * bc[6].t[3]) / (at[6] * bc[6].b[3]); // Normalizing factor for the amplitude to match the analog filter
-                AN[7]       = (ab[7] * bc[7].t[3]) / (at[7] * bc[7].b[3]); // Normalizing factor for the amplitude to match the analog filter
+                AN[0]       = bc[0].t[3] / bc[0].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[1]       = bc[1].t[3] / bc[1].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[2]       = bc[2].t[3] / bc[2].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[3]       = bc[3].t[3] / bc[3].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[4]       = bc[4].t[3] / bc[4].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[5]       = bc[5].t[3] / bc[5].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[6]       = bc[6].t[3] / bc[6].b[3]; // Normalizing factor for the amplitude to match the analog filter
+                AN[7]       = bc[7].t[3] / bc[7].b[3]; // Normalizing factor for the amplitude to match the analog filter
 
                 N2[0]       = 1.0 / bc[0].b[0];
                 N2[1]       = 1.0 / bc[1].b[0];
@@ -0,0 +1,403 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FIR_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FIR_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#define FIR_BLOCK_SIZE      1024        /* Maximum number of samples processed at once */
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count)
+        {
+            // 4x blocks
+            for ( ; count >= 4; count -= 4)
+            {
+                float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+                for (size_t j=0; j<length; ++j)
+                {
+                    float t     = taps[j];
+                    s0         += t * src[j];
+                    s1         += t * src[j+1];
+                    s2         += t * src[j+2];
+                    s3         += t * src[j+3];
+                }
+
+                dst[0]      = s0;
+                dst[1]      = s1;
+                dst[2]      = s2;
+                dst[3]      = s3;
+                dst        += 4;
+                src        += 4;
+            }
+
+            // 1x blocks
+            for ( ; count > 0; --count)
+            {
+                float s     = 0.0f;
+                for (size_t j=0; j<length; ++j)
+                    s          += taps[j] * src[j];
+
+                *(dst++)    = s;
+                ++src;
+            }
+        }
+
+        void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+            const float *taps, size_t length, size_t count)
+        {
+            // 2x blocks
+            for ( ; count >= 2; count -= 2)
+            {
+                float a0 = 0.0f, a1 = 0.0f, b0 = 0.0f, b1 = 0.0f;
+                for (size_t j=0; j<length; ++j)
+                {
+                    float t     = taps[j];
+                    a0         += t * src1[j];
+                    a1         += t * src1[j+1];
+                    b0         += t * src2[j];
+                    b1         += t * src2[j+1];
+                }
+
+                dst1[0]     = a0;
+                dst1[1]     = a1;
+                dst2[0]     = b0;
+                dst2[1]     = b1;
+                dst1       += 2;
+                dst2       += 2;
+                src1       += 2;
+                src2       += 2;
+            }
+
+            // 1x block
+            if (count > 0)
+            {
+                float a0 = 0.0f, b0 = 0.0f;
+                for (size_t j=0; j<length; ++j)
+                {
+                    float t     = taps[j];
+                    a0         += t * src1[j];
+                    b0         += t * src2[j];
+                }
+
+                dst1[0]     = a0;
+                dst2[0]     = b0;
+            }
+        }
+
+        /*
+         * The history of each channel contains length-1 last input samples followed
+         * by the space for FIR_BLOCK_SIZE samples of the new input data. The new data
+         * is copied to the history before the processing, so the filter can be
+         * applied in place.
+         */
+        size_t fir_size(size_t length, size_t channels)
+        {
+            size_t stride   = (length + FIR_BLOCK_SIZE + 0x0e) & ~size_t(0x0f);
+            size_t ntaps    = (length + 0x0f) & ~size_t(0x0f);
+            return (ntaps + stride * channels) * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        void fir_reset(dsp::fir_t *fir)
+        {
+            dsp::fill_zero(fir->hist, fir->stride * fir->channels);
+        }
+
+        void fir_init(dsp::fir_t *fir, void *buf, const float *taps, size_t length, size_t channels)
+        {
+            float *ptr      = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+
+            fir->taps       = ptr;
+            fir->hist       = &ptr[(length + 0x0f) & ~size_t(0x0f)];
+            fir->length     = length;
+            fir->channels   = channels;
+            fir->stride     = (length + FIR_BLOCK_SIZE + 0x0e) & ~size_t(0x0f);
+
+            dsp::reverse2(fir->taps, taps, length);
+            fir_reset(fir);
+        }
+
+        void fir_process(dsp::fir_t *fir, float * const *dst, const float * const *src, size_t count)
+        {
+            const size_t tail   = fir->length - 1;
+            const size_t stride = fir->stride;
+
+            for (size_t offset=0; offset < count; )
+            {
+                size_t to_do    = lsp_min(count - offset, size_t(FIR_BLOCK_SIZE));
+                float *h        = fir->hist;
+                size_t i        = 0;
+
+                // Process pairs of channels
+                for ( ; (i + 2) <= fir->channels; i += 2, h += stride*2)
+                {
+                    float *h1       = h;
+                    float *h2       = &h[stride];
+                    dsp::copy(&h1[tail], &src[i][offset], to_do);
+                    dsp::copy(&h2[tail], &src[i+1][offset], to_do);
+                    dsp::fir_direct_x2(&dst[i][offset], &dst[i+1][offset], h1, h2, fir->taps, fir->length, to_do);
+                    dsp::move(h1, &h1[to_do], tail);
+                    dsp::move(h2, &h2[to_do], tail);
+                }
+
+                // Process the last channel
+                if (i < fir->channels)
+                {
+                    dsp::copy(&h[tail], &src[i][offset], to_do);
+                    dsp::fir_direct(&dst[i][offset], h, fir->taps, fir->length, to_do);
+                    dsp::move(h, &h[to_do], tail);
+                }
+
+                offset         += to_do;
+            }
+        }
+
+        void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            for (size_t p=0; p<factor; ++p, taps += length)
+            {
+                float *d        = &dst[p];
+                const float *s  = src;
+                size_t n        = count;
+
+                // 4x blocks
+                for ( ; n >= 4; n -= 4)
+                {
+                    float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+                    for (size_t j=0; j<length; ++j)
+                    {
+                        float t     = taps[j];
+                        s0         += t * s[j];
+                        s1         += t * s[j+1];
+                        s2         += t * s[j+2];
+                        s3         += t * s[j+3];
+                    }
+
+                    d[0]        = s0;
+                    d[factor]   = s1;
+                    d[factor*2] = s2;
+                    d[factor*3] = s3;
+                    d          += factor * 4;
+                    s          += 4;
+                }
+
+                // 1x blocks
+                for ( ; n > 0; --n)
+                {
+                    float v     = 0.0f;
+                    for (size_t j=0; j<length; ++j)
+                        v          += taps[j] * s[j];
+
+                    *d          = v;
+                    d          += factor;
+                    ++s;
+                }
+            }
+        }
+
+        void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            const float *s1 = &src[factor];
+            const float *s2 = &src[factor*2];
+            const float *s3 = &src[factor*3];
+
+            // 4x blocks
+            for ( ; count >= 4; count -= 4)
+            {
+                float v0 = 0.0f, v1 = 0.0f, v2 = 0.0f, v3 = 0.0f;
+                for (size_t j=0; j<length; ++j)
+                {
+                    float t     = taps[j];
+                    v0         += t * src[j];
+                    v1         += t * s1[j];
+                    v2         += t * s2[j];
+                    v3         += t * s3[j];
+                }
+
+                dst[0]      = v0;
+                dst[1]      = v1;
+                dst[2]      = v2;
+                dst[3]      = v3;
+                dst        += 4;
+                src        += factor * 4;
+                s1         += factor * 4;
+                s2         += factor * 4;
+                s3         += factor * 4;
+            }
+
+            // 1x blocks
+            for ( ; count > 0; --count)
+            {
+                float v     = 0.0f;
+                for (size_t j=0; j<length; ++j)
+                    v          += taps[j] * src[j];
+
+                *(dst++)    = v;
+                src        += factor;
+            }
+        }
+
+        /*
+         * The interpolator splits the prototype filter into factor phases of
+         * length/factor taps (rounded up). The history contains the last
+         * phase_length-1 input samples followed by the space for FIR_BLOCK_SIZE
+         * samples of the new input data.
+         */
+        size_t fir_interpolator_size(size_t length, size_t factor)
+        {
+            size_t plen     = (length + factor - 1) / factor;
+            size_t ntaps    = (plen * factor + 0x0f) & ~size_t(0x0f);
+            size_t nhist    = (plen + FIR_BLOCK_SIZE + 0x0e) & ~size_t(0x0f);
+            return (ntaps + nhist) * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        void fir_interpolator_reset(dsp::fir_interpolator_t *intp)
+        {
+            dsp::fill_zero(intp->hist, intp->length - 1);
+        }
+
+        void fir_interpolator_init(dsp::fir_interpolator_t *intp, void *buf, const float *taps, size_t length, size_t factor)
+        {
+            float *ptr      = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            size_t plen     = (length + factor - 1) / factor;
+
+            intp->taps      = ptr;
+            intp->hist      = &ptr[(plen * factor + 0x0f) & ~size_t(0x0f)];
+            intp->length    = plen;
+            intp->factor    = factor;
+
+            // Phase p takes each factor'th tap starting with p, in reverse order
+            for (size_t p=0; p<factor; ++p)
+            {
+                float *t        = &intp->taps[p * plen];
+                for (size_t j=0; j<plen; ++j)
+                {
+                    size_t k        = (plen - 1 - j) * factor + p;
+                    t[j]            = (k < length) ? taps[k] : 0.0f;
+                }
+            }
+
+            fir_interpolator_reset(intp);
+        }
+
+        void fir_interpolator_process(dsp::fir_interpolator_t *intp, float *dst, const float *src, size_t count)
+        {
+            const size_t tail   = intp->length - 1;
+            float *h            = intp->hist;
+
+            for (size_t offset=0; offset < count; )
+            {
+                size_t to_do    = lsp_min(count - offset, size_t(FIR_BLOCK_SIZE));
+
+                dsp::copy(&h[tail], &src[offset], to_do);
+                dsp::fir_interpolate(&dst[offset * intp->factor], h, intp->taps, intp->length, intp->factor, to_do);
+                dsp::move(h, &h[to_do], tail);
+
+                offset         += to_do;
+            }
+        }
+
+        /*
+         * The taps of the decimator are padded with zeros at the head to the multiple
+         * of 8 samples, so the SIMD kernels do not need to process the tail of taps.
+         * The padded length is also not less than the factor, so the history never
+         * needs to skip input samples. The history contains up to length-1 last input
+         * samples followed by the space for FIR_BLOCK_SIZE samples of the new input data.
+         */
+        static inline size_t fir_decimator_length(size_t length, size_t factor)
+        {
+            return (lsp_max(length, factor) + 0x07) & ~size_t(0x07);
+        }
+
+        size_t fir_decimator_size(size_t length, size_t factor)
+        {
+            size_t ntaps    = fir_decimator_length(length, factor);
+            size_t nhist    = (ntaps + FIR_BLOCK_SIZE + 0x0f) & ~size_t(0x0f);
+            return (((ntaps + 0x0f) & ~size_t(0x0f)) + nhist) * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        void fir_decimator_reset(dsp::fir_decimator_t *dec)
+        {
+            dec->fill       = dec->length - 1;
+            dsp::fill_zero(dec->hist, dec->fill);
+        }
+
+        void fir_decimator_init(dsp::fir_decimator_t *dec, void *buf, const float *taps, size_t length, size_t factor)
+        {
+            float *ptr      = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            size_t ntaps    = fir_decimator_length(length, factor);
+            size_t pad      = ntaps - length;
+
+            dec->taps       = ptr;
+            dec->hist       = &ptr[(ntaps + 0x0f) & ~size_t(0x0f)];
+            dec->length     = ntaps;
+            dec->factor     = factor;
+
+            dsp::fill_zero(dec->taps, pad);
+            dsp::reverse2(&dec->taps[pad], taps, length);
+            fir_decimator_reset(dec);
+        }
+
+        size_t fir_decimator_process(dsp::fir_decimator_t *dec, float *dst, const float *src, size_t count)
+        {
+            const size_t length = dec->length;
+            const size_t factor = dec->factor;
+            float *h            = dec->hist;
+            size_t produced     = 0;
+
+            for (size_t offset=0; offset < count; )
+            {
+                size_t to_do    = lsp_min(count - offset, size_t(FIR_BLOCK_SIZE));
+
+                dsp::copy(&h[dec->fill], &src[offset], to_do);
+                dec->fill      += to_do;
+
+                if (dec->fill >= length)
+                {
+                    size_t n        = (dec->fill - length) / factor + 1;
+                    size_t used     = n * factor;
+                    dsp::fir_decimate(&dst[produced], h, dec->taps, length, factor, n);
+                    dec->fill      -= used;
+                    dsp::move(h, &h[used], dec->fill);
+                    produced       += n;
+                }
+
+                offset         += to_do;
+            }
+
+            return produced;
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#undef FIR_BLOCK_SIZE
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FIR_H_ */
@@ -56,6 +56,18 @@ namespace lsp
             }
             return result;
         }
+
+        float h_lerp_dotp(const float *x, const float *a, const float *b, float k, size_t count)
+        {
+            float ra = 0, rb = 0;
+            while (count--)
+            {
+                float xv = *(x++);
+                ra     += xv * *(a++);
+                rb     += xv * *(b++);
+            }
+            return ra + (rb - ra) * k;
+        }
     }
 }
 
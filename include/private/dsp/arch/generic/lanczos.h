@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_LANCZOS_H_
+#define PRIVATE_DSP_ARCH_GENERIC_LANCZOS_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#define LANCZOS_KERNEL_PAD      16          /* Number of zeros around the kernel, one AVX-512 register */
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t lanczos_kernel_size(size_t times, size_t lobes)
+        {
+            times           = lsp_max(times, size_t(1));
+            lobes           = lsp_max(lobes, size_t(1));
+            return (2 * times * lobes + 2 * LANCZOS_KERNEL_PAD) * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        void lanczos_kernel_init(dsp::lanczos_kernel_t *kernel, void *buf, size_t times, size_t lobes)
+        {
+            float *ptr          = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+
+            times               = lsp_max(times, size_t(1));
+            lobes               = lsp_max(lobes, size_t(1));
+            const ssize_t leaf  = lobes * times;
+            const ssize_t dots  = leaf * 2;
+            float *dst          = &ptr[LANCZOS_KERNEL_PAD];
+
+            // Same as the program used for the tables in generic/resampling.h
+            for (ssize_t i=0; i<dots; ++i)
+            {
+                double xx       = double(i - leaf) / double(times);
+
+                if (i == leaf)
+                    dst[i]          = 1.0f;
+                else if (((i - leaf) % ssize_t(times)) == 0)
+                    dst[i]          = 0.0f;
+                else
+                {
+                    double px       = M_PI * xx;
+                    dst[i]          = float((double(lobes) * sin(px) * sin(px / double(lobes))) / (px * px));
+                }
+            }
+
+            dsp::fill_zero(ptr, LANCZOS_KERNEL_PAD);
+            dsp::fill_zero(&dst[dots], LANCZOS_KERNEL_PAD);
+
+            kernel->data        = dst;
+            kernel->times       = times;
+            kernel->lobes       = lobes;
+            kernel->length      = dots;
+        }
+
+        void lanczos_resample(float *dst, const float *src, const dsp::lanczos_kernel_t *kernel, size_t count)
+        {
+            const float *k      = kernel->data;
+            const size_t times  = kernel->times;
+            const size_t length = kernel->length;
+
+            for (size_t i=0; i<count; ++i, dst += times)
+                dsp::fmadd_k3(dst, k, src[i], length);
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#undef LANCZOS_KERNEL_PAD
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_LANCZOS_H_ */
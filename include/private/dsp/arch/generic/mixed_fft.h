@@ -0,0 +1,419 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_MIXED_FFT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_MIXED_FFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /*
+         * The mixed-radix FFT is performed by the Stockham algorithm that does not require
+         * the digit-reversal permutation. The stage of radix p with stride s splits the
+         * sequence of length n = p*m into p sequences:
+         *
+         *   y[q + s*(p*i + j)] = w^(i*j) * sum_k { x[q + s*(i + k*m)] * exp(-2*pi*I*j*k/p) }
+         *
+         * where i = 0..m-1, q = 0..s-1, j = 0..p-1 and w = exp(-2*pi*I/n). The first stage
+         * is of radix 8 when possible, so the stride of all further stages is a multiple of 8.
+         *
+         * The twiddle factors w^(i*j) of each stage are grouped by 8 values of i: for each
+         * j = 1..p-1 the group contains 8 cosines followed by 8 sines. The table of each stage
+         * is aligned to the cache line.
+         */
+        static size_t mixed_fft_factorize(uint8_t *radix, size_t size)
+        {
+            size_t stages = 0;
+            if (size == 0)
+                return 0;
+
+            if ((size & 0x07) == 0)
+            {
+                radix[stages++] = 8;
+                size          >>= 3;
+            }
+            for ( ; (size & 0x03) == 0; size >>= 2)
+                radix[stages++] = 4;
+            for ( ; (size & 0x01) == 0; size >>= 1)
+                radix[stages++] = 2;
+            for ( ; (size % 3) == 0; size /= 3)
+                radix[stages++] = 3;
+            for ( ; (size % 5) == 0; size /= 5)
+                radix[stages++] = 5;
+
+            return (size == 1) ? stages : 0;
+        }
+
+        static inline size_t mixed_fft_stage_size(size_t p, size_t m)
+        {
+            return ((m + 7) >> 3) * (p - 1) * 16;
+        }
+
+        size_t mixed_fft_plan_size(size_t size)
+        {
+            uint8_t radix[32];
+            size_t stages   = mixed_fft_factorize(radix, size);
+            if ((stages == 0) && (size != 1))
+                return 0;
+
+            size_t count    = 0;
+            for (size_t i=0, n=size; i<stages; n /= radix[i++])
+                count          += mixed_fft_stage_size(radix[i], n / radix[i]);
+
+            return count * sizeof(float) + 0x40; // Additional space for alignment
+        }
+
+        void mixed_fft_plan_init(dsp::mixed_fft_plan_t *plan, void *buf, size_t size)
+        {
+            float *tw       = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            plan->twiddle   = tw;
+            plan->size      = size;
+            plan->stages    = mixed_fft_factorize(plan->radix, size);
+
+            for (size_t i=0, n=size; i<plan->stages; n /= plan->radix[i++])
+            {
+                size_t p        = plan->radix[i];
+                size_t m        = n / p;
+                double k        = 2.0 * M_PI / double(n);
+
+                for (size_t l=0; l<m; l += 8)
+                {
+                    for (size_t j=1; j<p; ++j, tw += 16)
+                    {
+                        for (size_t e=0; e<8; ++e)
+                        {
+                            double a        = k * double(j * (l + e));
+                            tw[e]           = cos(a);
+                            tw[e + 8]       = sin(a);
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * Compute DFT of small size
+         * @param b_re real part of output
+         * @param b_im imaginary part of output
+         * @param a_re real part of input
+         * @param a_im imaginary part of input
+         * @param p the size of DFT: 2, 3, 4, 5 or 8
+         * @param d -1 for direct DFT, +1 for reverse DFT
+         */
+        static void mixed_fft_dft(float *b_re, float *b_im, const float *a_re, const float *a_im, size_t p, float d)
+        {
+            switch (p)
+            {
+                case 2:
+                    b_re[0]     = a_re[0] + a_re[1];
+                    b_im[0]     = a_im[0] + a_im[1];
+                    b_re[1]     = a_re[0] - a_re[1];
+                    b_im[1]     = a_im[0] - a_im[1];
+                    break;
+
+                case 3:
+                {
+                    const float k   = d * 0.866025403784438647f; // sin(2*pi/3)
+                    float t_re      = a_re[1] + a_re[2];
+                    float t_im      = a_im[1] + a_im[2];
+                    float u_re      = a_re[0] - 0.5f * t_re;
+                    float u_im      = a_im[0] - 0.5f * t_im;
+                    float v_re      = -k * (a_im[1] - a_im[2]);
+                    float v_im      = k * (a_re[1] - a_re[2]);
+
+                    b_re[0]     = a_re[0] + t_re;
+                    b_im[0]     = a_im[0] + t_im;
+                    b_re[1]     = u_re + v_re;
+                    b_im[1]     = u_im + v_im;
+                    b_re[2]     = u_re - v_re;
+                    b_im[2]     = u_im - v_im;
+                    break;
+                }
+
+                case 4:
+                {
+                    float t0_re     = a_re[0] + a_re[2];
+                    float t0_im     = a_im[0] + a_im[2];
+                    float t1_re     = a_re[0] - a_re[2];
+                    float t1_im     = a_im[0] - a_im[2];
+                    float t2_re     = a_re[1] + a_re[3];
+                    float t2_im     = a_im[1] + a_im[3];
+                    float t3_re     = -d * (a_im[1] - a_im[3]);
+                    float t3_im     = d * (a_re[1] - a_re[3]);
+
+                    b_re[0]     = t0_re + t2_re;
+                    b_im[0]     = t0_im + t2_im;
+                    b_re[1]     = t1_re + t3_re;
+                    b_im[1]     = t1_im + t3_im;
+                    b_re[2]     = t0_re - t2_re;
+                    b_im[2]     = t0_im - t2_im;
+                    b_re[3]     = t1_re - t3_re;
+                    b_im[3]     = t1_im - t3_im;
+                    break;
+                }
+
+                case 5:
+                {
+                    const float c1  = 0.309016994374947424f;        // cos(2*pi/5)
+                    const float c2  = -0.809016994374947424f;       // cos(4*pi/5)
+                    const float s1  = d * 0.951056516295153572f;    // sin(2*pi/5)
+                    const float s2  = d * 0.587785252292473129f;    // sin(4*pi/5)
+
+                    float t1_re     = a_re[1] + a_re[4];
+                    float t1_im     = a_im[1] + a_im[4];
+                    float t2_re     = a_re[2] + a_re[3];
+                    float t2_im     = a_im[2] + a_im[3];
+                    float t3_re     = a_re[1] - a_re[4];
+                    float t3_im     = a_im[1] - a_im[4];
+                    float t4_re     = a_re[2] - a_re[3];
+                    float t4_im     = a_im[2] - a_im[3];
+
+                    float u1_re     = a_re[0] + c1 * t1_re + c2 * t2_re;
+                    float u1_im     = a_im[0] + c1 * t1_im + c2 * t2_im;
+                    float u2_re     = a_re[0] + c2 * t1_re + c1 * t2_re;
+                    float u2_im     = a_im[0] + c2 * t1_im + c1 * t2_im;
+                    float v1_re     = -(s1 * t3_im + s2 * t4_im);
+                    float v1_im     = s1 * t3_re + s2 * t4_re;
+                    float v2_re     = -(s2 * t3_im - s1 * t4_im);
+                    float v2_im     = s2 * t3_re - s1 * t4_re;
+
+                    b_re[0]     = a_re[0] + t1_re + t2_re;
+                    b_im[0]     = a_im[0] + t1_im + t2_im;
+                    b_re[1]     = u1_re + v1_re;
+                    b_im[1]     = u1_im + v1_im;
+                    b_re[2]     = u2_re + v2_re;
+                    b_im[2]     = u2_im + v2_im;
+                    b_re[3]     = u2_re - v2_re;
+                    b_im[3]     = u2_im - v2_im;
+                    b_re[4]     = u1_re - v1_re;
+                    b_im[4]     = u1_im - v1_im;
+                    break;
+                }
+
+                case 8:
+                {
+                    const float r   = M_SQRT1_2;
+                    float u_re[4], u_im[4], v_re[4], v_im[4];
+
+                    // Radix-2 decimation in frequency, odd outputs are multiplied by exp(d*I*pi*k/4)
+                    for (size_t k=0; k<4; ++k)
+                    {
+                        u_re[k]         = a_re[k] + a_re[k+4];
+                        u_im[k]         = a_im[k] + a_im[k+4];
+                        v_re[k]         = a_re[k] - a_re[k+4];
+                        v_im[k]         = a_im[k] - a_im[k+4];
+                    }
+
+                    float t_re      = v_re[1];
+                    v_re[1]         = r * (t_re - d * v_im[1]);
+                    v_im[1]         = r * (v_im[1] + d * t_re);
+                    t_re            = v_re[2];
+                    v_re[2]         = -d * v_im[2];
+                    v_im[2]         = d * t_re;
+                    t_re            = v_re[3];
+                    v_re[3]         = -r * (t_re + d * v_im[3]);
+                    v_im[3]         = r * (d * t_re - v_im[3]);
+
+                    float e_re[4], e_im[4], o_re[4], o_im[4];
+                    mixed_fft_dft(e_re, e_im, u_re, u_im, 4, d);
+                    mixed_fft_dft(o_re, o_im, v_re, v_im, 4, d);
+
+                    for (size_t j=0; j<4; ++j)
+                    {
+                        b_re[j*2]       = e_re[j];
+                        b_im[j*2]       = e_im[j];
+                        b_re[j*2+1]     = o_re[j];
+                        b_im[j*2+1]     = o_im[j];
+                    }
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        /**
+         * Perform one stage of the mixed-radix FFT
+         * @param y_re real part of output
+         * @param y_im imaginary part of output
+         * @param x_re real part of input
+         * @param x_im imaginary part of input
+         * @param xs distance between input items: 1 for split data, 2 for packed data
+         * @param tw twiddle factors of the stage
+         * @param p radix of the stage
+         * @param s stride of the stage
+         * @param m number of sub-sequences
+         * @param d -1 for direct FFT, +1 for reverse FFT
+         */
+        static void mixed_fft_stage(float *y_re, float *y_im, const float *x_re, const float *x_im, size_t xs,
+            const float *tw, size_t p, size_t s, size_t m, float d)
+        {
+            float a_re[8], a_im[8], b_re[8], b_im[8];
+
+            for (size_t i=0; i<m; ++i)
+            {
+                const float *w      = &tw[(i >> 3) * (p - 1) * 16 + (i & 7)];
+
+                for (size_t q=0; q<s; ++q)
+                {
+                    for (size_t k=0; k<p; ++k)
+                    {
+                        size_t idx      = (q + s*(i + k*m)) * xs;
+                        a_re[k]         = x_re[idx];
+                        a_im[k]         = x_im[idx];
+                    }
+
+                    mixed_fft_dft(b_re, b_im, a_re, a_im, p, d);
+
+                    float *d_re     = &y_re[q + s*p*i];
+                    float *d_im     = &y_im[q + s*p*i];
+                    d_re[0]         = b_re[0];
+                    d_im[0]         = b_im[0];
+                    for (size_t j=1; j<p; ++j)
+                    {
+                        float w_re      = w[(j-1)*16];
+                        float w_im      = d * w[(j-1)*16 + 8];
+                        d_re[s*j]       = b_re[j]*w_re - b_im[j]*w_im;
+                        d_im[s*j]       = b_re[j]*w_im + b_im[j]*w_re;
+                    }
+                }
+            }
+        }
+
+        static void mixed_fft_split(const dsp::mixed_fft_plan_t *plan,
+            float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp, float d)
+        {
+            size_t size         = plan->size;
+            size_t stages       = plan->stages;
+            if (stages == 0)
+            {
+                dst_re[0]           = src_re[0];
+                dst_im[0]           = src_im[0];
+                return;
+            }
+
+            // The last stage should write the result to the destination buffer
+            float *b_re[2]      = { dst_re, tmp };
+            float *b_im[2]      = { dst_im, &tmp[size] };
+            if ((stages & 1) && ((dst_re == src_re) || (dst_im == src_im)))
+            {
+                copy(b_re[1], src_re, size);
+                copy(b_im[1], src_im, size);
+                src_re              = b_re[1];
+                src_im              = b_im[1];
+            }
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=0, s=1; i<stages; ++i)
+            {
+                size_t p            = plan->radix[i];
+                size_t m            = size / (s * p);
+                size_t o            = (stages - i - 1) & 1;
+
+                mixed_fft_stage(b_re[o], b_im[o], src_re, src_im, 1, tw, p, s, m, d);
+
+                src_re              = b_re[o];
+                src_im              = b_im[o];
+                tw                 += mixed_fft_stage_size(p, m);
+                s                  *= p;
+            }
+        }
+
+        static void mixed_fft_packed(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp, float d, float k)
+        {
+            size_t size         = plan->size;
+            size_t stages       = plan->stages;
+            if (stages == 0)
+            {
+                dst[0]              = src[0] * k;
+                dst[1]              = src[1] * k;
+                return;
+            }
+
+            // The last stage should write the result to the temporary buffer
+            float *b_re[2]      = { dst, tmp };
+            float *b_im[2]      = { &dst[size], &tmp[size] };
+            if ((!(stages & 1)) && (dst == src))
+            {
+                copy(tmp, src, size * 2);
+                src                 = tmp;
+            }
+
+            const float *tw     = plan->twiddle;
+            const float *s_re   = &src[0];
+            const float *s_im   = &src[1];
+            size_t xs           = 2;
+            for (size_t i=0, s=1; i<stages; ++i)
+            {
+                size_t p            = plan->radix[i];
+                size_t m            = size / (s * p);
+                size_t o            = (stages - i) & 1;
+
+                mixed_fft_stage(b_re[o], b_im[o], s_re, s_im, xs, tw, p, s, m, d);
+
+                s_re                = b_re[o];
+                s_im                = b_im[o];
+                xs                  = 1;
+                tw                 += mixed_fft_stage_size(p, m);
+                s                  *= p;
+            }
+
+            // Pack the result
+            for (size_t i=0; i<size; ++i)
+            {
+                dst[i*2]            = s_re[i] * k;
+                dst[i*2 + 1]        = s_im[i] * k;
+            }
+        }
+
+        void mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp)
+        {
+            mixed_fft_split(plan, dst_re, dst_im, src_re, src_im, tmp, -1.0f);
+        }
+
+        void mixed_reverse_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp)
+        {
+            mixed_fft_split(plan, dst_re, dst_im, src_re, src_im, tmp, 1.0f);
+
+            float k = 1.0f / plan->size;
+            mul_k2(dst_re, k, plan->size);
+            mul_k2(dst_im, k, plan->size);
+        }
+
+        void packed_mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp)
+        {
+            mixed_fft_packed(plan, dst, src, tmp, -1.0f, 1.0f);
+        }
+
+        void packed_mixed_reverse_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp)
+        {
+            mixed_fft_packed(plan, dst, src, tmp, 1.0f, 1.0f / plan->size);
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_MIXED_FFT_H_ */
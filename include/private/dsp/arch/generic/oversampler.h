@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_OVERSAMPLER_H_
+#define PRIVATE_DSP_ARCH_GENERIC_OVERSAMPLER_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#define OVERSAMPLER_CHUNK_SIZE      256         /* Number of input samples processed at once */
+#define OVERSAMPLER_MAX_ZCROSS      64          /* Maximum number of zero crossings of the sinc */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /*
+         * Both filters have 2*zcross*factor + 1 taps, so the delay of each filter
+         * is zcross*factor oversampled samples and the overall latency is exactly
+         * 2*zcross input samples. The chunk buffer is also used as the temporary
+         * storage for the prototype filter when initializing the oversampler.
+         */
+        static inline size_t oversampler_length(size_t factor, size_t zcross)
+        {
+            return zcross * factor * 2 + 1;
+        }
+
+        size_t oversampler_size(size_t factor, size_t zcross)
+        {
+            zcross          = lsp_limit(zcross, size_t(1), size_t(OVERSAMPLER_MAX_ZCROSS));
+            size_t length   = oversampler_length(factor, zcross);
+
+            return OVERSAMPLER_CHUNK_SIZE * factor * sizeof(float) + 0x40 +
+                fir_interpolator_size(length, factor) +
+                fir_decimator_size(length, factor);
+        }
+
+        void oversampler_reset(dsp::oversampler_t *os)
+        {
+            fir_interpolator_reset(&os->up);
+            fir_decimator_reset(&os->down);
+        }
+
+        void oversampler_init(dsp::oversampler_t *os, void *buf, size_t factor, size_t zcross)
+        {
+            zcross          = lsp_limit(zcross, size_t(1), size_t(OVERSAMPLER_MAX_ZCROSS));
+            size_t length   = oversampler_length(factor, zcross);
+            size_t center   = zcross * factor;
+            size_t chunk    = OVERSAMPLER_CHUNK_SIZE * factor;
+            float *ptr      = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            uint8_t *up     = reinterpret_cast<uint8_t *>(&ptr[chunk]);
+            uint8_t *down   = &up[fir_interpolator_size(length, factor)];
+
+            os->buf         = ptr;
+            os->factor      = factor;
+            os->latency     = zcross * 2;
+
+            // Design the prototype filter: sinc with zeros at input samples
+            // and the 4-term Blackman-Harris window
+            float *taps     = os->buf;
+            double sum      = 0.0;
+            for (size_t i=0; i<length; ++i)
+            {
+                double t        = M_PI * (double(i) - double(center)) / double(factor);
+                double w        = 2.0 * M_PI * double(i) / double(length - 1);
+                double v        = (i != center) ? sin(t) / t : 1.0;
+                v              *= 0.35875 - 0.48829 * cos(w) + 0.14128 * cos(2.0 * w) - 0.01168 * cos(3.0 * w);
+
+                taps[i]         = float(v);
+                sum            += v;
+            }
+
+            // The interpolator needs the DC gain equal to the factor, the decimator needs the unit gain
+            dsp::mul_k2(taps, double(factor) / sum, length);
+            fir_interpolator_init(&os->up, up, taps, length, factor);
+            dsp::mul_k2(taps, 1.0 / double(factor), length);
+            fir_decimator_init(&os->down, down, taps, length, factor);
+
+            dsp::fill_zero(os->buf, chunk);
+        }
+
+        void oversampler_process(dsp::oversampler_t *os, float *dst, const float *src, size_t count,
+            dsp::oversampler_callback_t callback, void *arg)
+        {
+            for (size_t offset=0; offset < count; )
+            {
+                size_t to_do    = lsp_min(count - offset, size_t(OVERSAMPLER_CHUNK_SIZE));
+                size_t os_count = to_do * os->factor;
+
+                // Each factor samples of the oversampled signal give exactly one output sample
+                fir_interpolator_process(&os->up, os->buf, &src[offset], to_do);
+                if (callback != NULL)
+                    callback(arg, os->buf, os_count);
+                fir_decimator_process(&os->down, &dst[offset], os->buf, os_count);
+
+                offset         += to_do;
+            }
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#undef OVERSAMPLER_CHUNK_SIZE
+#undef OVERSAMPLER_MAX_ZCROSS
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_OVERSAMPLER_H_ */
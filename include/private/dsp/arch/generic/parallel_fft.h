@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_PARALLEL_FFT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_PARALLEL_FFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#define PFFT_MIN_RANK           10          /* Minimum rank of FFT that is split into jobs */
+#define PFFT_MAX_JOBS           64          /* Maximum number of jobs in each pass */
+#define PFFT_BLOCK              16          /* Number of columns processed at once */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /*
+         * The parallel FFT of size N = N1 * N2 considers the signal as the matrix of N1 rows
+         * and N2 columns: x[n1, n2] = x[N2*n1 + n2]. The first pass computes the N1-point FFT
+         * of each column n2, multiplies the result by w^(n2*k1), w = exp(-2*pi*I/N) and stores
+         * it as the row n2 of the temporary matrix. The second pass computes the N2-point FFT
+         * of each column k1 of the temporary matrix and stores the result to X[k1 + N1*k2].
+         * Both passes transpose columns by blocks of PFFT_BLOCK items to keep the memory access
+         * sequential, and the short transforms are performed in-place by the direct_fft() and
+         * reverse_fft() functions. Blocks of each pass are evenly distributed between jobs, each
+         * job of the second pass uses its own part of the temporary buffer, so jobs of the same
+         * pass can be executed by different threads of the host in any order.
+         *
+         * The twiddle factor w^m, m = n2*k1 < N, is computed as the product of two tables:
+         * w^(m mod N1) and w^(N1 * (m div N1)), so the plan takes only N1 + N2 complex numbers.
+         * Tables store cosines followed by sines of the positive angle.
+         */
+        typedef struct parallel_fft_job_t
+        {
+            const dsp::parallel_fft_plan_t *plan;
+            float          *dst_re;
+            float          *dst_im;
+            const float    *src_re;
+            const float    *src_im;
+            float          *tmp;
+            float          *scratch;
+            size_t          first;
+            size_t          last;
+            float           dir;
+        } parallel_fft_job_t;
+
+        size_t parallel_fft_plan_size(size_t rank)
+        {
+            size_t rows     = rank >> 1;
+            size_t count    = (size_t(1) << rows) + (size_t(1) << (rank - rows));
+            return count * 2 * sizeof(float) + 0x40; // Additional space for alignment
+        }
+
+        void parallel_fft_plan_init(dsp::parallel_fft_plan_t *plan, void *buf, size_t rank, size_t jobs)
+        {
+            float *tw       = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            size_t rows     = rank >> 1;
+            size_t n1       = size_t(1) << rows;
+            size_t n2       = size_t(1) << (rank - rows);
+            double k        = 2.0 * M_PI / double(size_t(1) << rank);
+
+            plan->twiddle   = tw;
+            plan->rank      = rank;
+            plan->rows      = rows;
+
+            // Twiddle factors for the low and high parts of the power
+            for (size_t j=0; j<n1; ++j)
+            {
+                double a        = k * double(j);
+                tw[j]           = cos(a);
+                tw[j + n1]      = sin(a);
+            }
+            tw             += n1 * 2;
+            for (size_t j=0; j<n2; ++j)
+            {
+                double a        = k * double(j * n1);
+                tw[j]           = cos(a);
+                tw[j + n2]      = sin(a);
+            }
+
+            // Each job should process at least one block of each pass
+            if (rank < PFFT_MIN_RANK)
+            {
+                plan->jobs      = 1;
+                plan->tmp_size  = 0;
+                return;
+            }
+
+            jobs            = lsp_limit(jobs, size_t(1), size_t(PFFT_MAX_JOBS));
+            jobs            = lsp_min(jobs, n1 / PFFT_BLOCK);
+            plan->jobs      = jobs;
+            plan->tmp_size  = (n1 * n2 + jobs * PFFT_BLOCK * n2) * 2;
+        }
+
+        static void parallel_fft_rows(const parallel_fft_job_t *job)
+        {
+            const dsp::parallel_fft_plan_t *plan= job->plan;
+            size_t rows     = plan->rows;
+            size_t n1       = size_t(1) << rows;
+            size_t n2       = size_t(1) << (plan->rank - rows);
+            const float *lo_re  = plan->twiddle;
+            const float *lo_im  = &lo_re[n1];
+            const float *hi_re  = &lo_im[n1];
+            const float *hi_im  = &hi_re[n2];
+            float *t_re     = job->tmp;
+            float *t_im     = &t_re[n1 * n2];
+
+            for (size_t b=job->first; b<job->last; ++b)
+            {
+                size_t c        = b * PFFT_BLOCK;
+                float *r_re     = &t_re[c * n1];
+                float *r_im     = &t_im[c * n1];
+
+                // Transpose block of columns into rows
+                const float *s_re   = &job->src_re[c];
+                const float *s_im   = &job->src_im[c];
+                for (size_t i=0; i<n1; ++i, s_re += n2, s_im += n2)
+                {
+                    for (size_t j=0; j<PFFT_BLOCK; ++j)
+                    {
+                        r_re[j*n1 + i]      = s_re[j];
+                        r_im[j*n1 + i]      = s_im[j];
+                    }
+                }
+
+                // Transform rows and apply twiddle factors
+                for (size_t j=0; j<PFFT_BLOCK; ++j, r_re += n1, r_im += n1)
+                {
+                    if (job->dir < 0.0f)
+                        dsp::direct_fft(r_re, r_im, r_re, r_im, rows);
+                    else
+                        dsp::reverse_fft(r_re, r_im, r_re, r_im, rows);
+
+                    size_t step     = c + j;
+                    for (size_t i=1, m=step; i<n1; ++i, m += step)
+                    {
+                        size_t l        = m & (n1 - 1);
+                        size_t h        = m >> rows;
+                        float w_re      = lo_re[l]*hi_re[h] - lo_im[l]*hi_im[h];
+                        float w_im      = (lo_re[l]*hi_im[h] + lo_im[l]*hi_re[h]) * job->dir;
+                        float re        = r_re[i];
+                        float im        = r_im[i];
+                        r_re[i]         = re*w_re - im*w_im;
+                        r_im[i]         = re*w_im + im*w_re;
+                    }
+                }
+            }
+        }
+
+        static void parallel_fft_columns(const parallel_fft_job_t *job)
+        {
+            const dsp::parallel_fft_plan_t *plan= job->plan;
+            size_t rows     = plan->rows;
+            size_t cols     = plan->rank - rows;
+            size_t n1       = size_t(1) << rows;
+            size_t n2       = size_t(1) << cols;
+            const float *t_re   = job->tmp;
+            const float *t_im   = &t_re[n1 * n2];
+            float *x_re     = job->scratch;
+            float *x_im     = &x_re[n2 * PFFT_BLOCK];
+
+            for (size_t b=job->first; b<job->last; ++b)
+            {
+                size_t c        = b * PFFT_BLOCK;
+
+                // Transpose block of columns into rows
+                const float *s_re   = &t_re[c];
+                const float *s_im   = &t_im[c];
+                for (size_t i=0; i<n2; ++i, s_re += n1, s_im += n1)
+                {
+                    for (size_t j=0; j<PFFT_BLOCK; ++j)
+                    {
+                        x_re[j*n2 + i]      = s_re[j];
+                        x_im[j*n2 + i]      = s_im[j];
+                    }
+                }
+
+                // Transform rows
+                for (size_t j=0; j<PFFT_BLOCK; ++j)
+                {
+                    if (job->dir < 0.0f)
+                        dsp::direct_fft(&x_re[j*n2], &x_im[j*n2], &x_re[j*n2], &x_im[j*n2], cols);
+                    else
+                        dsp::reverse_fft(&x_re[j*n2], &x_im[j*n2], &x_re[j*n2], &x_im[j*n2], cols);
+                }
+
+                // Transpose rows back into columns of the result
+                float *d_re     = &job->dst_re[c];
+                float *d_im     = &job->dst_im[c];
+                for (size_t i=0; i<n2; ++i, d_re += n1, d_im += n1)
+                {
+                    for (size_t j=0; j<PFFT_BLOCK; ++j)
+                    {
+                        d_re[j]         = x_re[j*n2 + i];
+                        d_im[j]         = x_im[j*n2 + i];
+                    }
+                }
+            }
+        }
+
+        static void parallel_fft_pass(const dsp::parallel_fft_plan_t *plan,
+            float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp,
+            size_t pass, size_t job, float dir)
+        {
+            size_t rank     = plan->rank;
+            if (rank < PFFT_MIN_RANK)
+            {
+                // The whole transform is performed by the first job of the first pass
+                if ((pass > 0) || (job > 0))
+                    return;
+                if (dir < 0.0f)
+                    dsp::direct_fft(dst_re, dst_im, src_re, src_im, rank);
+                else
+                    dsp::reverse_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+            if ((pass > 1) || (job >= plan->jobs))
+                return;
+
+            size_t jobs     = plan->jobs;
+            size_t n1       = size_t(1) << plan->rows;
+            size_t n2       = size_t(1) << (rank - plan->rows);
+            size_t blocks   = ((pass > 0) ? n1 : n2) / PFFT_BLOCK;
+
+            parallel_fft_job_t j;
+            j.plan          = plan;
+            j.dst_re        = dst_re;
+            j.dst_im        = dst_im;
+            j.src_re        = src_re;
+            j.src_im        = src_im;
+            j.tmp           = tmp;
+            j.scratch       = &tmp[(n1 + job * PFFT_BLOCK) * n2 * 2];
+            j.first         = (blocks * job) / jobs;
+            j.last          = (blocks * (job + 1)) / jobs;
+            j.dir           = dir;
+
+            if (pass > 0)
+                parallel_fft_columns(&j);
+            else
+                parallel_fft_rows(&j);
+        }
+
+        static void parallel_fft(const dsp::parallel_fft_plan_t *plan,
+            float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp, float dir)
+        {
+            // The second pass may overwrite the source data, so it starts after the first one
+            for (size_t pass=0; pass<2; ++pass)
+                for (size_t job=0; job<plan->jobs; ++job)
+                    parallel_fft_pass(plan, dst_re, dst_im, src_re, src_im, tmp, pass, job, dir);
+        }
+
+        void parallel_direct_fft(const dsp::parallel_fft_plan_t *plan,
+            float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp)
+        {
+            parallel_fft(plan, dst_re, dst_im, src_re, src_im, tmp, -1.0f);
+        }
+
+        void parallel_reverse_fft(const dsp::parallel_fft_plan_t *plan,
+            float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp)
+        {
+            parallel_fft(plan, dst_re, dst_im, src_re, src_im, tmp, 1.0f);
+        }
+
+        void parallel_direct_fft_pass(const dsp::parallel_fft_plan_t *plan,
+            float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp,
+            size_t pass, size_t job)
+        {
+            parallel_fft_pass(plan, dst_re, dst_im, src_re, src_im, tmp, pass, job, -1.0f);
+        }
+
+        void parallel_reverse_fft_pass(const dsp::parallel_fft_plan_t *plan,
+            float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp,
+            size_t pass, size_t job)
+        {
+            parallel_fft_pass(plan, dst_re, dst_im, src_re, src_im, tmp, pass, job, 1.0f);
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#undef PFFT_BLOCK
+#undef PFFT_MAX_JOBS
+#undef PFFT_MIN_RANK
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_PARALLEL_FFT_H_ */
@@ -194,6 +194,15 @@ namespace lsp
             }
         }
 
+        void pcomplex_c2r_fmadd3(float *dst, const float *src, const float *k, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                dst[i]     += src[0] * k[i];
+                src        += 2;
+            }
+        }
+
         void pcomplex_mod(float *dst_mod, const float *src, size_t count)
         {
             while (count--)
@@ -348,6 +357,16 @@ namespace lsp
             }
         }
 
+        void pcomplex_r2c_mul3(float *dst, const float *src1, const float *src2, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                dst[0]      = src1[i] * src2[i];
+                dst[1]      = 0.0f;
+                dst        += 2;
+            }
+        }
+
         void pcomplex_corr(float *dst_corr, const float *src1, const float *src2, size_t count)
         {
             /*
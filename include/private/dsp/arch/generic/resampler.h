@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_RESAMPLER_H_
+#define PRIVATE_DSP_ARCH_GENERIC_RESAMPLER_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#define RESAMPLER_PHASES        256         /* Number of precomputed phases of the kernel */
+#define RESAMPLER_BLOCK_SIZE    1024        /* Maximum number of input samples processed at once */
+#define RESAMPLER_KAISER_BETA   8.6         /* Kaiser window parameter, gives about -90 dB of stopband attenuation */
+
+namespace lsp
+{
+    namespace generic
+    {
+        static double resampler_bessel_i0(double x)
+        {
+            // Power series of the modified Bessel function of the first kind
+            double q        = 0.25 * x * x;
+            double term     = 1.0;
+            double sum      = 1.0;
+
+            for (size_t k=1; term > sum * 1e-12; ++k)
+            {
+                term           *= q / double(k * k);
+                sum            += term;
+            }
+
+            return sum;
+        }
+
+        static double resampler_cutoff(double ratio, size_t zcross)
+        {
+            // Move the cutoff frequency down to put the whole transition band
+            // of the Kaiser-windowed sinc below the Nyquist frequency
+            double fc       = double(zcross) / (double(zcross) + 2.86);
+            return (ratio < 1.0) ? fc * ratio : fc;
+        }
+
+        static size_t resampler_half(double ratio, size_t zcross)
+        {
+            double fc       = resampler_cutoff(ratio, zcross);
+            size_t half     = size_t(ceil(double(zcross) / fc));
+            return (half + 3) & ~size_t(3);
+        }
+
+        size_t resampler_size(double ratio, size_t zcross)
+        {
+            zcross          = lsp_max(zcross, size_t(1));
+            size_t taps     = resampler_half(ratio, zcross) * 2;
+            return ((RESAMPLER_PHASES + 1) * taps + taps + RESAMPLER_BLOCK_SIZE) * sizeof(float) +
+                0x40; // Additional space for alignment
+        }
+
+        void resampler_reset(dsp::resampler_t *rs)
+        {
+            size_t half     = rs->taps >> 1;
+
+            dsp::fill_zero(rs->hist, rs->taps + RESAMPLER_BLOCK_SIZE);
+            rs->pos         = double(half - 1);
+            rs->fill        = half - 1;
+        }
+
+        void resampler_set_ratio(dsp::resampler_t *rs, double ratio)
+        {
+            rs->step        = 1.0 / ratio;
+        }
+
+        void resampler_init(dsp::resampler_t *rs, void *buf, double ratio, size_t zcross)
+        {
+            float *ptr      = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+
+            zcross          = lsp_max(zcross, size_t(1));
+            const double fc     = resampler_cutoff(ratio, zcross);
+            const size_t half   = resampler_half(ratio, zcross);
+            const size_t taps   = half * 2;
+            const double width  = double(zcross) / fc;
+            const double kw     = 1.0 / resampler_bessel_i0(RESAMPLER_KAISER_BETA);
+
+            rs->kernel      = ptr;
+            rs->hist        = &ptr[(RESAMPLER_PHASES + 1) * taps];
+            rs->taps        = taps;
+            rs->phases      = RESAMPLER_PHASES;
+
+            // Row p contains the kernel for the fractional position p/phases,
+            // the last row is used only for interpolation of the previous one
+            for (size_t p=0; p <= RESAMPLER_PHASES; ++p)
+            {
+                float *row      = &rs->kernel[p * taps];
+                double f        = double(p) / double(RESAMPLER_PHASES);
+                double sum      = 0.0;
+
+                for (size_t k=0; k<taps; ++k)
+                {
+                    double t        = f + double(half) - 1.0 - double(k);
+                    double r        = t / width;
+                    double x        = M_PI * fc * t;
+                    double v        = 0.0;
+
+                    if (fabs(r) < 1.0)
+                    {
+                        v               = (fabs(x) > 1e-9) ? fc * sin(x) / x : fc;
+                        v              *= resampler_bessel_i0(RESAMPLER_KAISER_BETA * sqrt(1.0 - r*r)) * kw;
+                    }
+
+                    row[k]          = float(v);
+                    sum            += v;
+                }
+
+                // Normalize the row to have the unit gain at DC
+                dsp::mul_k2(row, 1.0 / sum, taps);
+            }
+
+            resampler_set_ratio(rs, ratio);
+            resampler_reset(rs);
+        }
+
+        size_t resampler_process(dsp::resampler_t *rs, float *dst, const float *src, size_t count)
+        {
+            const size_t taps   = rs->taps;
+            const size_t half   = taps >> 1;
+            const size_t phases = rs->phases;
+            float *hist         = rs->hist;
+            size_t fill         = rs->fill;
+            double pos          = rs->pos;
+            size_t done         = 0;
+
+            while (count > 0)
+            {
+                size_t to_do    = lsp_min(count, size_t(RESAMPLER_BLOCK_SIZE));
+                dsp::copy(&hist[fill], src, to_do);
+                fill           += to_do;
+
+                // Emit all output samples that have enough input samples at the right side
+                for (size_t i = size_t(pos); (i + half) < fill; i = size_t(pos))
+                {
+                    double phi      = (pos - double(i)) * double(phases);
+                    size_t idx      = size_t(phi);
+                    const float *k  = &rs->kernel[idx * taps];
+
+                    dst[done++]     = dsp::h_lerp_dotp(&hist[i + 1 - half], k, &k[taps], float(phi - double(idx)), taps);
+                    pos            += rs->step;
+                }
+
+                // Drop input samples that are no more required
+                size_t drop     = lsp_min(size_t(pos) + 1 - half, fill);
+                dsp::move(hist, &hist[drop], fill - drop);
+                fill           -= drop;
+                pos            -= double(drop);
+
+                src            += to_do;
+                count          -= to_do;
+            }
+
+            rs->fill        = fill;
+            rs->pos         = pos;
+
+            return done;
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#undef RESAMPLER_PHASES
+#undef RESAMPLER_BLOCK_SIZE
+#undef RESAMPLER_KAISER_BETA
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_RESAMPLER_H_ */
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_RFFT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_RFFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#include <private/dsp/arch/generic/fft/real_small.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        void real_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                real_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            // Even samples are treated as real part and odd samples as imaginary part
+            // of the complex signal of half size: z[k] = x[2*k] + j*x[2*k+1]
+            packed_direct_fft(dst, src, rank - 1);
+
+            // Split the spectrum: X[k] = (Z[k] + Z*[N-k])/2 - j*W^k * (Z[k] - Z*[N-k])/2
+            size_t items    = size_t(1) << (rank - 1);
+            float *a        = &dst[2];
+            float *b        = &dst[(items - 1) << 1];
+            float c_re, c_im, w_re[4], w_im[4];
+            const float *iw_re  = &XFFT_A_RE[(rank - 3) << 2];
+            const float *iw_im  = &XFFT_A_IM[(rank - 3) << 2];
+            const float *dw     = &XFFT_DW[(rank - 3) << 1];
+
+            // Process the DC and the Nyquist frequency
+            real_fft_split_dc(dst, rank);
+
+            // Initial angles are shifted by one step since the DC is already processed
+            for (size_t i=0; i<4; ++i)
+            {
+                w_re[i]         = iw_re[i]*iw_re[1] - iw_im[i]*iw_im[1];
+                w_im[i]         = iw_re[i]*iw_im[1] + iw_im[i]*iw_re[1];
+            }
+
+            for (size_t k=1; k <= (items >> 1); )
+            {
+                for (size_t i=0; (i<4) && (k <= (items >> 1)); ++i, ++k)
+                {
+                    float s         = a[0] + b[0];
+                    float d         = a[1] - b[1];
+                    float p         = a[1] + b[1];
+                    float q         = b[0] - a[0];
+
+                    float t_re      = w_re[i] * p + w_im[i] * q;
+                    float t_im      = w_re[i] * q - w_im[i] * p;
+
+                    a[0]            = (s + t_re) * 0.5f;
+                    a[1]            = (d + t_im) * 0.5f;
+                    b[0]            = (s - t_re) * 0.5f;
+                    b[1]            = (t_im - d) * 0.5f;
+
+                    a              += 2;
+                    b              -= 2;
+                }
+
+                // Rotate w vector
+                for (size_t i=0; i<4; ++i)
+                {
+                    c_re            = w_re[i]*dw[0] - w_im[i]*dw[1];
+                    c_im            = w_re[i]*dw[1] + w_im[i]*dw[0];
+                    w_re[i]         = c_re;
+                    w_im[i]         = c_im;
+                }
+            }
+        }
+
+        void real_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                real_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            // Join the spectrum: Z[k] = (X[k] + X*[N-k])/2 + j*W^-k * (X[k] - X*[N-k])/2
+            size_t items    = size_t(1) << (rank - 1);
+            const float *sa = &src[2];
+            const float *sb = &src[(items - 1) << 1];
+            float *da       = &dst[2];
+            float *db       = &dst[(items - 1) << 1];
+            float c_re, c_im, w_re[4], w_im[4];
+            const float *iw_re  = &XFFT_A_RE[(rank - 3) << 2];
+            const float *iw_im  = &XFFT_A_IM[(rank - 3) << 2];
+            const float *dw     = &XFFT_DW[(rank - 3) << 1];
+
+            // Process the DC and the Nyquist frequency
+            real_fft_join_dc(dst, src, rank);
+
+            for (size_t i=0; i<4; ++i)
+            {
+                w_re[i]         = iw_re[i]*iw_re[1] - iw_im[i]*iw_im[1];
+                w_im[i]         = iw_re[i]*iw_im[1] + iw_im[i]*iw_re[1];
+            }
+
+            for (size_t k=1; k <= (items >> 1); )
+            {
+                for (size_t i=0; (i<4) && (k <= (items >> 1)); ++i, ++k)
+                {
+                    float s         = sa[0] + sb[0];
+                    float d         = sa[1] - sb[1];
+                    float p         = sa[0] - sb[0];
+                    float q         = sa[1] + sb[1];
+
+                    float o_re      = w_re[i] * p - w_im[i] * q;
+                    float o_im      = w_re[i] * q + w_im[i] * p;
+
+                    da[0]           = (s - o_im) * 0.5f;
+                    da[1]           = (d + o_re) * 0.5f;
+                    db[0]           = (s + o_im) * 0.5f;
+                    db[1]           = (o_re - d) * 0.5f;
+
+                    sa             += 2;
+                    sb             -= 2;
+                    da             += 2;
+                    db             -= 2;
+                }
+
+                // Rotate w vector
+                for (size_t i=0; i<4; ++i)
+                {
+                    c_re            = w_re[i]*dw[0] - w_im[i]*dw[1];
+                    c_im            = w_re[i]*dw[1] + w_im[i]*dw[0];
+                    w_re[i]         = c_re;
+                    w_im[i]         = c_im;
+                }
+            }
+
+            // Compute the complex reverse FFT of half size
+            packed_reverse_fft(dst, dst, rank - 1);
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_RFFT_H_ */
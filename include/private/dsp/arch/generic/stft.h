@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_STFT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_STFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /*
+         * Input and output ring buffers share the same position: the sample of the
+         * output buffer is emitted and cleared at the moment when the input sample at the
+         * same position is overwritten. At the end of each hop the head points to the oldest
+         * input sample, so the frame is the whole input ring buffer starting at the head,
+         * and the restored frame is added to the output buffer starting at the head.
+         * After that, first hop samples at the head are complete and are emitted during
+         * the next hop.
+         *
+         * For the analysis window w and the hop h the overlap-add of all frames gives
+         * the gain sum { w[i + k*h]^2 } at the position i of the frame, which depends
+         * only on (i mod h), so the synthesis window is w[i] divided by this sum.
+         */
+        size_t stft_size(size_t rank)
+        {
+            return (size_t(6) << rank) * sizeof(float) + 0x40; // Additional space for alignment
+        }
+
+        void stft_reset(dsp::stft_t *stft)
+        {
+            size_t n        = size_t(1) << stft->rank;
+            dsp::fill_zero(stft->input, n);
+            dsp::fill_zero(stft->output, n);
+            stft->head      = 0;
+            stft->offset    = 0;
+        }
+
+        void stft_init(dsp::stft_t *stft, void *buf, size_t rank, size_t hop, const float *window)
+        {
+            float *ptr      = reinterpret_cast<float *>((uintptr_t(buf) + 0x3f) & ~uintptr_t(0x3f));
+            size_t n        = size_t(1) << rank;
+
+            stft->window    = ptr;
+            stft->synth     = &ptr[n];
+            stft->input     = &ptr[n * 2];
+            stft->output    = &ptr[n * 3];
+            stft->spectrum  = &ptr[n * 4];
+            stft->rank      = rank;
+            stft->hop       = lsp_limit(hop, size_t(1), n);
+
+            // Analysis window
+            float *w        = stft->window;
+            if (window != NULL)
+                dsp::copy(w, window, n);
+            else
+            {
+                double k        = 2.0 * M_PI / n;
+                for (size_t i=0; i<n; ++i)
+                    w[i]            = 0.5 - 0.5 * cos(k * i);
+            }
+
+            // Synthesis window
+            hop             = stft->hop;
+            for (size_t i=0; i<hop; ++i)
+            {
+                float s         = 0.0f;
+                for (size_t j=i; j<n; j += hop)
+                    s              += w[j] * w[j];
+                s               = (s >= 1e-10f) ? 1.0f / s : 0.0f;
+                for (size_t j=i; j<n; j += hop)
+                    stft->synth[j]  = w[j] * s;
+            }
+
+            stft_reset(stft);
+        }
+
+        static void stft_frame(dsp::stft_t *stft, dsp::stft_callback_t callback, void *arg)
+        {
+            size_t rank     = stft->rank;
+            size_t head     = stft->head;
+            size_t tail     = (size_t(1) << rank) - head;
+            float *sp       = stft->spectrum;
+
+            // Apply analysis window to the ring buffer and perform FFT
+            dsp::pcomplex_r2c_mul3(sp, &stft->input[head], stft->window, tail);
+            dsp::pcomplex_r2c_mul3(&sp[tail * 2], stft->input, &stft->window[tail], head);
+            dsp::packed_direct_fft(sp, sp, rank);
+
+            if (callback != NULL)
+                callback(arg, sp, rank);
+
+            // Perform reverse FFT and apply synthesis window with overlap-add
+            dsp::packed_reverse_fft(sp, sp, rank);
+            dsp::pcomplex_c2r_fmadd3(&stft->output[head], sp, stft->synth, tail);
+            dsp::pcomplex_c2r_fmadd3(stft->output, &sp[tail * 2], &stft->synth[tail], head);
+        }
+
+        void stft_process(dsp::stft_t *stft, float *dst, const float *src, size_t count,
+            dsp::stft_callback_t callback, void *arg)
+        {
+            size_t mask     = (size_t(1) << stft->rank) - 1;
+
+            while (count > 0)
+            {
+                // Process samples until the end of the hop or the end of the ring buffer
+                size_t head     = stft->head;
+                size_t to_do    = lsp_min(count, lsp_min(stft->hop - stft->offset, mask + 1 - head));
+
+                dsp::copy(&stft->input[head], src, to_do);
+                dsp::copy(dst, &stft->output[head], to_do);
+                dsp::fill_zero(&stft->output[head], to_do);
+
+                stft->head      = (head + to_do) & mask;
+                stft->offset   += to_do;
+                src            += to_do;
+                dst            += to_do;
+                count          -= to_do;
+
+                if (stft->offset >= stft->hop)
+                {
+                    stft_frame(stft, callback, arg);
+                    stft->offset    = 0;
+                }
+            }
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_STFT_H_ */
@@ -0,0 +1,537 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_BATCH_FFT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_BATCH_FFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+/*
+ * The batched FFT of small rank processes 8 channels at once: the samples of
+ * 8 channels are transposed into the temporary buffer so that each ymm register
+ * holds the same sample of 8 channels. After that all butterflies are performed
+ * without any shuffles and each twiddle factor is loaded once for 8 channels.
+ * From rank 8 up the transposed buffer does not fit the cache and the kernel
+ * loses to the single-channel transforms, so each channel is transformed by
+ * dsp::direct_fft() or dsp::reverse_fft().
+ */
+#define BATCH_FFT_MIN_RANK      3
+#define BATCH_FFT_MAX_RANK      7
+
+namespace lsp
+{
+    namespace avx
+    {
+        /*
+         * Transpose 8x8 matrix stored in ymm0..ymm7 into ymm8..ymm15
+         */
+        #define BATCH_FFT_TRANSPOSE \
+            __ASM_EMIT("vunpcklps       %%ymm1, %%ymm0, %%ymm8")        /* ymm8  = a0 b0 a1 b1 a4 b4 a5 b5 */ \
+            __ASM_EMIT("vunpckhps       %%ymm1, %%ymm0, %%ymm9")        /* ymm9  = a2 b2 a3 b3 a6 b6 a7 b7 */ \
+            __ASM_EMIT("vunpcklps       %%ymm3, %%ymm2, %%ymm10")       /* ymm10 = c0 d0 c1 d1 c4 d4 c5 d5 */ \
+            __ASM_EMIT("vunpckhps       %%ymm3, %%ymm2, %%ymm11")       /* ymm11 = c2 d2 c3 d3 c6 d6 c7 d7 */ \
+            __ASM_EMIT("vunpcklps       %%ymm5, %%ymm4, %%ymm12")       /* ymm12 = e0 f0 e1 f1 e4 f4 e5 f5 */ \
+            __ASM_EMIT("vunpckhps       %%ymm5, %%ymm4, %%ymm13")       /* ymm13 = e2 f2 e3 f3 e6 f6 e7 f7 */ \
+            __ASM_EMIT("vunpcklps       %%ymm7, %%ymm6, %%ymm14")       /* ymm14 = g0 h0 g1 h1 g4 h4 g5 h5 */ \
+            __ASM_EMIT("vunpckhps       %%ymm7, %%ymm6, %%ymm15")       /* ymm15 = g2 h2 g3 h3 g6 h6 g7 h7 */ \
+            __ASM_EMIT("vshufps         $0x44, %%ymm10, %%ymm8, %%ymm0")    /* ymm0 = a0 b0 c0 d0 a4 b4 c4 d4 */ \
+            __ASM_EMIT("vshufps         $0xee, %%ymm10, %%ymm8, %%ymm1")    /* ymm1 = a1 b1 c1 d1 a5 b5 c5 d5 */ \
+            __ASM_EMIT("vshufps         $0x44, %%ymm11, %%ymm9, %%ymm2")    /* ymm2 = a2 b2 c2 d2 a6 b6 c6 d6 */ \
+            __ASM_EMIT("vshufps         $0xee, %%ymm11, %%ymm9, %%ymm3")    /* ymm3 = a3 b3 c3 d3 a7 b7 c7 d7 */ \
+            __ASM_EMIT("vshufps         $0x44, %%ymm14, %%ymm12, %%ymm4")   /* ymm4 = e0 f0 g0 h0 e4 f4 g4 h4 */ \
+            __ASM_EMIT("vshufps         $0xee, %%ymm14, %%ymm12, %%ymm5")   /* ymm5 = e1 f1 g1 h1 e5 f5 g5 h5 */ \
+            __ASM_EMIT("vshufps         $0x44, %%ymm15, %%ymm13, %%ymm6")   /* ymm6 = e2 f2 g2 h2 e6 f6 g6 h6 */ \
+            __ASM_EMIT("vshufps         $0xee, %%ymm15, %%ymm13, %%ymm7")   /* ymm7 = e3 f3 g3 h3 e7 f7 g7 h7 */ \
+            __ASM_EMIT("vperm2f128      $0x20, %%ymm4, %%ymm0, %%ymm8")     /* ymm8 = a0 b0 c0 d0 e0 f0 g0 h0 */ \
+            __ASM_EMIT("vperm2f128      $0x20, %%ymm5, %%ymm1, %%ymm9") \
+            __ASM_EMIT("vperm2f128      $0x20, %%ymm6, %%ymm2, %%ymm10") \
+            __ASM_EMIT("vperm2f128      $0x20, %%ymm7, %%ymm3, %%ymm11") \
+            __ASM_EMIT("vperm2f128      $0x31, %%ymm4, %%ymm0, %%ymm12")    /* ymm12 = a4 b4 c4 d4 e4 f4 g4 h4 */ \
+            __ASM_EMIT("vperm2f128      $0x31, %%ymm5, %%ymm1, %%ymm13") \
+            __ASM_EMIT("vperm2f128      $0x31, %%ymm6, %%ymm2, %%ymm14") \
+            __ASM_EMIT("vperm2f128      $0x31, %%ymm7, %%ymm3, %%ymm15")
+
+        #define BATCH_FFT_STORE_SCRAMBLED(OFF, REG) \
+            __ASM_EMIT("mov             " OFF "(%[off]), %[p]") \
+            __ASM_EMIT("vmovaps         " REG ", (%[dst], %[p])")
+
+        /*
+         * Radix-4 butterfly that performs the first two stages of FFT
+         */
+        #define BATCH_FFT_FIRST(OPA, OPB) \
+            ARCH_X86_64_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("vmovaps         0x00(%[re]), %%ymm0")           /* ymm0 = x0_re */ \
+                __ASM_EMIT("vmovaps         0x20(%[re]), %%ymm1")           /* ymm1 = x1_re */ \
+                __ASM_EMIT("vmovaps         0x40(%[re]), %%ymm2")           /* ymm2 = x2_re */ \
+                __ASM_EMIT("vmovaps         0x60(%[re]), %%ymm3")           /* ymm3 = x3_re */ \
+                __ASM_EMIT("vmovaps         0x00(%[im]), %%ymm4")           /* ymm4 = x0_im */ \
+                __ASM_EMIT("vmovaps         0x20(%[im]), %%ymm5")           /* ymm5 = x1_im */ \
+                __ASM_EMIT("vmovaps         0x40(%[im]), %%ymm6")           /* ymm6 = x2_im */ \
+                __ASM_EMIT("vmovaps         0x60(%[im]), %%ymm7")           /* ymm7 = x3_im */ \
+                __ASM_EMIT("vaddps          %%ymm1, %%ymm0, %%ymm8")        /* ymm8 = y0 = x0 + x1 */ \
+                __ASM_EMIT("vaddps          %%ymm5, %%ymm4, %%ymm9") \
+                __ASM_EMIT("vsubps          %%ymm1, %%ymm0, %%ymm0")        /* ymm0 = y1 = x0 - x1 */ \
+                __ASM_EMIT("vsubps          %%ymm5, %%ymm4, %%ymm4") \
+                __ASM_EMIT("vaddps          %%ymm3, %%ymm2, %%ymm10")       /* ymm10 = y2 = x2 + x3 */ \
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm6, %%ymm11") \
+                __ASM_EMIT("vsubps          %%ymm3, %%ymm2, %%ymm2")        /* ymm2 = y3 = x2 - x3 */ \
+                __ASM_EMIT("vsubps          %%ymm7, %%ymm6, %%ymm6") \
+                __ASM_EMIT("vaddps          %%ymm10, %%ymm8, %%ymm1")       /* ymm1 = z0 = y0 + y2 */ \
+                __ASM_EMIT("vaddps          %%ymm11, %%ymm9, %%ymm5") \
+                __ASM_EMIT("vsubps          %%ymm10, %%ymm8, %%ymm8")       /* ymm8 = z2 = y0 - y2 */ \
+                __ASM_EMIT("vsubps          %%ymm11, %%ymm9, %%ymm9") \
+                __ASM_EMIT(OPA "          %%ymm6, %%ymm0, %%ymm3")          /* ymm3 = z1 = y1 -+ i*y3 */ \
+                __ASM_EMIT(OPB "          %%ymm2, %%ymm4, %%ymm7") \
+                __ASM_EMIT(OPB "          %%ymm6, %%ymm0, %%ymm0")          /* ymm0 = z3 = y1 +- i*y3 */ \
+                __ASM_EMIT(OPA "          %%ymm2, %%ymm4, %%ymm4") \
+                __ASM_EMIT("vmovaps         %%ymm1, 0x00(%[re])") \
+                __ASM_EMIT("vmovaps         %%ymm3, 0x20(%[re])") \
+                __ASM_EMIT("vmovaps         %%ymm8, 0x40(%[re])") \
+                __ASM_EMIT("vmovaps         %%ymm0, 0x60(%[re])") \
+                __ASM_EMIT("vmovaps         %%ymm5, 0x00(%[im])") \
+                __ASM_EMIT("vmovaps         %%ymm7, 0x20(%[im])") \
+                __ASM_EMIT("vmovaps         %%ymm9, 0x40(%[im])") \
+                __ASM_EMIT("vmovaps         %%ymm4, 0x60(%[im])") \
+                __ASM_EMIT("add             $0x80, %[re]") \
+                __ASM_EMIT("add             $0x80, %[im]") \
+                __ASM_EMIT("dec             %[count]") \
+                __ASM_EMIT("jnz             1b") \
+                : [re] "+r" (re), [im] "+r" (im), [count] "+r" (count) \
+                : \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7", \
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11" \
+            );
+
+        /*
+         * Multiply complex vector (R, I) by the broadcasted twiddle factor (WR, WI)
+         */
+        #define BATCH_FFT_CMUL(R, I, WR, WI, T0, T1) \
+            __ASM_EMIT("vmulps          " WI ", " I ", " T0)                /* T0   = I*wi */ \
+            __ASM_EMIT("vmulps          " WI ", " R ", " T1)                /* T1   = R*wi */ \
+            __ASM_EMIT("vmulps          " WR ", " R ", " R)                 /* R    = R*wr */ \
+            __ASM_EMIT("vmulps          " WR ", " I ", " I)                 /* I    = I*wr */ \
+            __ASM_EMIT("vsubps          " T0 ", " R ", " R)                 /* R    = R*wr - I*wi */ \
+            __ASM_EMIT("vaddps          " T1 ", " I ", " I)                 /* I    = I*wr + R*wi */
+
+        /*
+         * Two radix-2 stages with butterfly sizes 2*half and 4*half fused into one pass
+         */
+        #define BATCH_FFT_BUTTERFLY4(OPA, OPB) \
+            ARCH_X86_64_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("mov             %[tw], %[pw1]") \
+                __ASM_EMIT("mov             %[tw], %[pw2]") \
+                __ASM_EMIT("mov             %[half], %[j]") \
+                __ASM_EMIT("2:") \
+                /* First stage */ \
+                __ASM_EMIT("vbroadcastss    0x00(%[pw1]), %%ymm12")         /* ymm12 = w1_re */ \
+                __ASM_EMIT("vbroadcastss    0x04(%[pw1]), %%ymm13")         /* ymm13 = w1_im */ \
+                __ASM_EMIT("vmovaps         (%[re], %[hb]), %%ymm2")        /* ymm2 = a1 */ \
+                __ASM_EMIT("vmovaps         (%[im], %[hb]), %%ymm3") \
+                BATCH_FFT_CMUL("%%ymm2", "%%ymm3", "%%ymm12", "%%ymm13", "%%ymm10", "%%ymm11") \
+                __ASM_EMIT("vmovaps         (%[re]), %%ymm0")               /* ymm0 = a0 */ \
+                __ASM_EMIT("vmovaps         (%[im]), %%ymm1") \
+                __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm4")        /* ymm4 = y0 = a0 + w1*a1 */ \
+                __ASM_EMIT("vaddps          %%ymm3, %%ymm1, %%ymm5") \
+                __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm0")        /* ymm0 = y1 = a0 - w1*a1 */ \
+                __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm1") \
+                __ASM_EMIT("vmovaps         (%[re], %[hb3]), %%ymm6")       /* ymm6 = a3 */ \
+                __ASM_EMIT("vmovaps         (%[im], %[hb3]), %%ymm7") \
+                BATCH_FFT_CMUL("%%ymm6", "%%ymm7", "%%ymm12", "%%ymm13", "%%ymm10", "%%ymm11") \
+                __ASM_EMIT("vmovaps         (%[re], %[hb], 2), %%ymm2")     /* ymm2 = a2 */ \
+                __ASM_EMIT("vmovaps         (%[im], %[hb], 2), %%ymm3") \
+                __ASM_EMIT("vaddps          %%ymm6, %%ymm2, %%ymm8")        /* ymm8 = y2 = a2 + w1*a3 */ \
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm3, %%ymm9") \
+                __ASM_EMIT("vsubps          %%ymm6, %%ymm2, %%ymm2")        /* ymm2 = y3 = a2 - w1*a3 */ \
+                __ASM_EMIT("vsubps          %%ymm7, %%ymm3, %%ymm3") \
+                /* Second stage */ \
+                __ASM_EMIT("vbroadcastss    0x00(%[pw2]), %%ymm12")         /* ymm12 = w2_re */ \
+                __ASM_EMIT("vbroadcastss    0x04(%[pw2]), %%ymm13")         /* ymm13 = w2_im */ \
+                BATCH_FFT_CMUL("%%ymm8", "%%ymm9", "%%ymm12", "%%ymm13", "%%ymm10", "%%ymm11") \
+                BATCH_FFT_CMUL("%%ymm2", "%%ymm3", "%%ymm12", "%%ymm13", "%%ymm10", "%%ymm11") \
+                __ASM_EMIT("vaddps          %%ymm8, %%ymm4, %%ymm10")       /* ymm10 = z0 = y0 + w2*y2 */ \
+                __ASM_EMIT("vaddps          %%ymm9, %%ymm5, %%ymm11") \
+                __ASM_EMIT("vsubps          %%ymm8, %%ymm4, %%ymm4")        /* ymm4 = z2 = y0 - w2*y2 */ \
+                __ASM_EMIT("vsubps          %%ymm9, %%ymm5, %%ymm5") \
+                __ASM_EMIT(OPA "          %%ymm3, %%ymm0, %%ymm6")          /* ymm6 = z1 = y1 -+ i*w2*y3 */ \
+                __ASM_EMIT(OPB "          %%ymm2, %%ymm1, %%ymm7") \
+                __ASM_EMIT(OPB "          %%ymm3, %%ymm0, %%ymm0")          /* ymm0 = z3 = y1 +- i*w2*y3 */ \
+                __ASM_EMIT(OPA "          %%ymm2, %%ymm1, %%ymm1") \
+                __ASM_EMIT("vmovaps         %%ymm10, (%[re])") \
+                __ASM_EMIT("vmovaps         %%ymm11, (%[im])") \
+                __ASM_EMIT("vmovaps         %%ymm6, (%[re], %[hb])") \
+                __ASM_EMIT("vmovaps         %%ymm7, (%[im], %[hb])") \
+                __ASM_EMIT("vmovaps         %%ymm4, (%[re], %[hb], 2)") \
+                __ASM_EMIT("vmovaps         %%ymm5, (%[im], %[hb], 2)") \
+                __ASM_EMIT("vmovaps         %%ymm0, (%[re], %[hb3])") \
+                __ASM_EMIT("vmovaps         %%ymm1, (%[im], %[hb3])") \
+                __ASM_EMIT("add             $0x20, %[re]") \
+                __ASM_EMIT("add             $0x20, %[im]") \
+                __ASM_EMIT("add             %[ts], %[pw1]") \
+                __ASM_EMIT("add             %[ts], %[pw1]") \
+                __ASM_EMIT("add             %[ts], %[pw2]") \
+                __ASM_EMIT("dec             %[j]") \
+                __ASM_EMIT("jnz             2b") \
+                __ASM_EMIT("add             %[hb3], %[re]") \
+                __ASM_EMIT("add             %[hb3], %[im]") \
+                __ASM_EMIT("dec             %[blocks]") \
+                __ASM_EMIT("jnz             1b") \
+                : [re] "+r" (re), [im] "+r" (im), [blocks] "+r" (blocks), \
+                  [pw1] "=&r" (pw1), [pw2] "=&r" (pw2), [j] "=&r" (j) \
+                : [tw] "r" (tw), [half] "r" (half), [hb] "r" (hb), [hb3] "r" (hb * 3), \
+                  [ts] "r" (ts) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7", \
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11", \
+                  "%xmm12", "%xmm13" \
+            );
+
+        IF_ARCH_X86_64(
+            /**
+             * Load 8x8 block of samples of 8 channels, transpose it and store
+             * the columns at the bit-reversed positions of the batch buffer
+             * @param dst batch buffer, should be aligned to 32 bytes
+             * @param src pointer to the samples of the first channel
+             * @param stride distance between channels in bytes
+             * @param off offsets of the columns in the batch buffer in bytes
+             */
+            static inline void x64_batch_fft_gather(float *dst, const float *src, size_t stride, const size_t *off)
+            {
+                size_t p;
+
+                ARCH_X86_64_ASM
+                (
+                    __ASM_EMIT("mov             %[src], %[p]")
+                    __ASM_EMIT("vmovups         (%[p]), %%ymm0")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         (%[p]), %%ymm1")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         (%[p]), %%ymm2")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         (%[p]), %%ymm3")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         (%[p]), %%ymm4")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         (%[p]), %%ymm5")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         (%[p]), %%ymm6")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         (%[p]), %%ymm7")
+                    BATCH_FFT_TRANSPOSE
+                    BATCH_FFT_STORE_SCRAMBLED("0x00", "%%ymm8")
+                    BATCH_FFT_STORE_SCRAMBLED("0x08", "%%ymm9")
+                    BATCH_FFT_STORE_SCRAMBLED("0x10", "%%ymm10")
+                    BATCH_FFT_STORE_SCRAMBLED("0x18", "%%ymm11")
+                    BATCH_FFT_STORE_SCRAMBLED("0x20", "%%ymm12")
+                    BATCH_FFT_STORE_SCRAMBLED("0x28", "%%ymm13")
+                    BATCH_FFT_STORE_SCRAMBLED("0x30", "%%ymm14")
+                    BATCH_FFT_STORE_SCRAMBLED("0x38", "%%ymm15")
+                    : [p] "=&r" (p)
+                    : [dst] "r" (dst), [src] "r" (src), [stride] "r" (stride), [off] "r" (off)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                      "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                      "%xmm12", "%xmm13", "%xmm14", "%xmm15"
+                );
+            }
+
+            /**
+             * Load 8 sequential items of the batch buffer, transpose them, apply
+             * the gain and store to the 8 channels
+             * @param dst pointer to the samples of the first channel
+             * @param src batch buffer, should be aligned to 32 bytes
+             * @param stride distance between channels in bytes
+             * @param k gain
+             */
+            static inline void x64_batch_fft_scatter(float *dst, const float *src, size_t stride, float k)
+            {
+                size_t p;
+
+                ARCH_X86_64_ASM
+                (
+                    __ASM_EMIT("vmovaps         0x00(%[src]), %%ymm0")
+                    __ASM_EMIT("vmovaps         0x20(%[src]), %%ymm1")
+                    __ASM_EMIT("vmovaps         0x40(%[src]), %%ymm2")
+                    __ASM_EMIT("vmovaps         0x60(%[src]), %%ymm3")
+                    __ASM_EMIT("vmovaps         0x80(%[src]), %%ymm4")
+                    __ASM_EMIT("vmovaps         0xa0(%[src]), %%ymm5")
+                    __ASM_EMIT("vmovaps         0xc0(%[src]), %%ymm6")
+                    __ASM_EMIT("vmovaps         0xe0(%[src]), %%ymm7")
+                    BATCH_FFT_TRANSPOSE
+                    __ASM_EMIT("vbroadcastss    %[k], %%ymm0")
+                    __ASM_EMIT("mov             %[dst], %[p]")
+                    __ASM_EMIT("vmulps          %%ymm0, %%ymm8, %%ymm8")
+                    __ASM_EMIT("vmulps          %%ymm0, %%ymm9, %%ymm9")
+                    __ASM_EMIT("vmulps          %%ymm0, %%ymm10, %%ymm10")
+                    __ASM_EMIT("vmulps          %%ymm0, %%ymm11, %%ymm11")
+                    __ASM_EMIT("vmulps          %%ymm0, %%ymm12, %%ymm12")
+                    __ASM_EMIT("vmulps          %%ymm0, %%ymm13, %%ymm13")
+                    __ASM_EMIT("vmulps          %%ymm0, %%ymm14, %%ymm14")
+                    __ASM_EMIT("vmulps          %%ymm0, %%ymm15, %%ymm15")
+                    __ASM_EMIT("vmovups         %%ymm8, (%[p])")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         %%ymm9, (%[p])")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         %%ymm10, (%[p])")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         %%ymm11, (%[p])")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         %%ymm12, (%[p])")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         %%ymm13, (%[p])")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         %%ymm14, (%[p])")
+                    __ASM_EMIT("add             %[stride], %[p]")
+                    __ASM_EMIT("vmovups         %%ymm15, (%[p])")
+                    : [p] "=&r" (p)
+                    : [dst] "r" (dst), [src] "r" (src), [stride] "r" (stride), [k] "m" (k)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                      "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                      "%xmm12", "%xmm13", "%xmm14", "%xmm15"
+                );
+            }
+
+            static inline void x64_batch_fft_first_direct(float *re, float *im, size_t count)
+            {
+                BATCH_FFT_FIRST("vaddps", "vsubps");
+            }
+
+            static inline void x64_batch_fft_first_reverse(float *re, float *im, size_t count)
+            {
+                BATCH_FFT_FIRST("vsubps", "vaddps");
+            }
+
+            /**
+             * Perform the radix-2 butterflies of the FFT stage
+             * @param re real part of the batch buffer
+             * @param im imaginary part of the batch buffer
+             * @param tw twiddle factors [re, im, re, im, ...]
+             * @param half half of the butterfly size in items
+             * @param blocks number of butterflies
+             */
+            static inline void x64_batch_fft_butterfly(float *re, float *im, const float *tw, size_t half, size_t blocks)
+            {
+                size_t pw, j;
+                size_t hb       = half * 8 * sizeof(float);
+                size_t ts       = blocks * 2 * sizeof(float);
+
+                ARCH_X86_64_ASM
+                (
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("mov             %[tw], %[pw]")
+                    __ASM_EMIT("mov             %[half], %[j]")
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("vbroadcastss    0x00(%[pw]), %%ymm6")           // ymm6 = w_re
+                    __ASM_EMIT("vbroadcastss    0x04(%[pw]), %%ymm7")           // ymm7 = w_im
+                    __ASM_EMIT("vmovaps         (%[re]), %%ymm0")               // ymm0 = a_re
+                    __ASM_EMIT("vmovaps         (%[re], %[hb]), %%ymm2")        // ymm2 = b_re
+                    __ASM_EMIT("vmovaps         (%[im]), %%ymm1")               // ymm1 = a_im
+                    __ASM_EMIT("vmovaps         (%[im], %[hb]), %%ymm3")        // ymm3 = b_im
+                    __ASM_EMIT("vmulps          %%ymm6, %%ymm2, %%ymm4")        // ymm4 = b_re*w_re
+                    __ASM_EMIT("vmulps          %%ymm7, %%ymm3, %%ymm5")        // ymm5 = b_im*w_im
+                    __ASM_EMIT("vmulps          %%ymm7, %%ymm2, %%ymm2")        // ymm2 = b_re*w_im
+                    __ASM_EMIT("vmulps          %%ymm6, %%ymm3, %%ymm3")        // ymm3 = b_im*w_re
+                    __ASM_EMIT("vsubps          %%ymm5, %%ymm4, %%ymm4")        // ymm4 = c_re = b_re*w_re - b_im*w_im
+                    __ASM_EMIT("vaddps          %%ymm3, %%ymm2, %%ymm5")        // ymm5 = c_im = b_re*w_im + b_im*w_re
+                    __ASM_EMIT("vsubps          %%ymm4, %%ymm0, %%ymm2")        // ymm2 = a_re - c_re
+                    __ASM_EMIT("vsubps          %%ymm5, %%ymm1, %%ymm3")        // ymm3 = a_im - c_im
+                    __ASM_EMIT("vaddps          %%ymm4, %%ymm0, %%ymm0")        // ymm0 = a_re + c_re
+                    __ASM_EMIT("vaddps          %%ymm5, %%ymm1, %%ymm1")        // ymm1 = a_im + c_im
+                    __ASM_EMIT("vmovaps         %%ymm0, (%[re])")
+                    __ASM_EMIT("vmovaps         %%ymm2, (%[re], %[hb])")
+                    __ASM_EMIT("vmovaps         %%ymm1, (%[im])")
+                    __ASM_EMIT("vmovaps         %%ymm3, (%[im], %[hb])")
+                    __ASM_EMIT("add             $0x20, %[re]")
+                    __ASM_EMIT("add             $0x20, %[im]")
+                    __ASM_EMIT("add             %[ts], %[pw]")
+                    __ASM_EMIT("dec             %[j]")
+                    __ASM_EMIT("jnz             2b")
+                    __ASM_EMIT("add             %[hb], %[re]")
+                    __ASM_EMIT("add             %[hb], %[im]")
+                    __ASM_EMIT("dec             %[blocks]")
+                    __ASM_EMIT("jnz             1b")
+                    : [re] "+r" (re), [im] "+r" (im), [blocks] "+r" (blocks),
+                      [pw] "=&r" (pw), [j] "=&r" (j)
+                    : [tw] "r" (tw), [half] "r" (half), [hb] "r" (hb), [ts] "r" (ts)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+            }
+
+            /**
+             * Perform two radix-2 stages of the FFT at once
+             * @param re real part of the batch buffer
+             * @param im imaginary part of the batch buffer
+             * @param tw twiddle factors [re, im, re, im, ...]
+             * @param half half of the butterfly size of the first stage in items
+             * @param blocks number of radix-4 butterflies
+             */
+            static inline void x64_batch_fft_butterfly4_direct(float *re, float *im, const float *tw, size_t half, size_t blocks)
+            {
+                size_t pw1, pw2, j;
+                size_t hb       = half * 8 * sizeof(float);
+                size_t ts       = blocks * 2 * sizeof(float);
+
+                BATCH_FFT_BUTTERFLY4("vaddps", "vsubps");
+            }
+
+            static inline void x64_batch_fft_butterfly4_reverse(float *re, float *im, const float *tw, size_t half, size_t blocks)
+            {
+                size_t pw1, pw2, j;
+                size_t hb       = half * 8 * sizeof(float);
+                size_t ts       = blocks * 2 * sizeof(float);
+
+                BATCH_FFT_BUTTERFLY4("vsubps", "vaddps");
+            }
+
+            static void x64_batch_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+                size_t stride, size_t rank, size_t count, float d)
+            {
+                size_t n        = size_t(1) << rank;
+                float k         = (d < 0.0f) ? 1.0f : 1.0f / n;
+                size_t sb       = stride * sizeof(float);
+                size_t groups   = ((rank >= BATCH_FFT_MIN_RANK) && (rank <= BATCH_FFT_MAX_RANK)) ? count >> 3 : 0;
+
+                if (groups > 0)
+                {
+                    float buf[(1 << BATCH_FFT_MAX_RANK) * 16] __lsp_aligned32;
+                    float tw[1 << BATCH_FFT_MAX_RANK];
+                    size_t off[8];
+
+                    size_t roff[8];
+                    for (size_t j=0; j<8; ++j)
+                        roff[j]         = (reverse_bits(uint32_t(j), 3) << (rank - 3)) * 8 * sizeof(float);
+
+                    float *b_re     = buf;
+                    float *b_im     = &buf[n * 8];
+
+                    // Compute twiddle factors exp(d*2*pi*I*j/n) shared by all channels and stages
+                    double a        = 2.0 * M_PI / n;
+                    double dw_re    = cos(a), dw_im = sin(a);
+                    double w_re     = 1.0, w_im = 0.0;
+                    for (size_t j=0; j < (n >> 1); ++j)
+                    {
+                        tw[j*2]         = w_re;
+                        tw[j*2 + 1]     = d * w_im;
+                        double t_re     = w_re * dw_re - w_im * dw_im;
+                        w_im            = w_re * dw_im + w_im * dw_re;
+                        w_re            = t_re;
+                    }
+
+                    for (size_t g=0; g<groups; ++g)
+                    {
+                        // Transpose channels and apply bit-reversal permutation
+                        for (size_t i=0; i<n; i += 8)
+                        {
+                            size_t r        = reverse_bits(uint32_t(i), rank) * 8 * sizeof(float);
+                            for (size_t j=0; j<8; ++j)
+                                off[j]          = r + roff[j];
+
+                            x64_batch_fft_gather(b_re, &src_re[i], sb, off);
+                            x64_batch_fft_gather(b_im, &src_im[i], sb, off);
+                        }
+
+                        // Perform butterflies
+                        if (d < 0.0f)
+                            x64_batch_fft_first_direct(b_re, b_im, n >> 2);
+                        else
+                            x64_batch_fft_first_reverse(b_re, b_im, n >> 2);
+                        size_t half     = 4;
+                        if (rank & 1)
+                        {
+                            x64_batch_fft_butterfly(b_re, b_im, tw, half, n / (half * 2));
+                            half          <<= 1;
+                        }
+                        for ( ; half < n; half <<= 2)
+                        {
+                            if (d < 0.0f)
+                                x64_batch_fft_butterfly4_direct(b_re, b_im, tw, half, n / (half * 4));
+                            else
+                                x64_batch_fft_butterfly4_reverse(b_re, b_im, tw, half, n / (half * 4));
+                        }
+
+                        // Transpose back
+                        for (size_t i=0; i<n; i += 8)
+                        {
+                            x64_batch_fft_scatter(&dst_re[i], &b_re[i * 8], sb, k);
+                            x64_batch_fft_scatter(&dst_im[i], &b_im[i * 8], sb, k);
+                        }
+
+                        src_re         += stride * 8;
+                        src_im         += stride * 8;
+                        dst_re         += stride * 8;
+                        dst_im         += stride * 8;
+                    }
+
+                    count          &= 7;
+                }
+
+                // Process the rest channels
+                for (size_t i=0; i<count; ++i)
+                {
+                    if (d < 0.0f)
+                        dsp::direct_fft(dst_re, dst_im, src_re, src_im, rank);
+                    else
+                        dsp::reverse_fft(dst_re, dst_im, src_re, src_im, rank);
+                    src_re         += stride;
+                    src_im         += stride;
+                    dst_re         += stride;
+                    dst_im         += stride;
+                }
+            }
+
+            void x64_batch_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+                size_t stride, size_t rank, size_t count)
+            {
+                x64_batch_fft(dst_re, dst_im, src_re, src_im, stride, rank, count, -1.0f);
+            }
+
+            void x64_batch_reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im,
+                size_t stride, size_t rank, size_t count)
+            {
+                x64_batch_fft(dst_re, dst_im, src_re, src_im, stride, rank, count, 1.0f);
+            }
+        )
+
+        #undef BATCH_FFT_BUTTERFLY4
+        #undef BATCH_FFT_CMUL
+        #undef BATCH_FFT_FIRST
+        #undef BATCH_FFT_STORE_SCRAMBLED
+        #undef BATCH_FFT_TRANSPOSE
+    } /* namespace avx */
+} /* namespace lsp */
+
+#undef BATCH_FFT_MAX_RANK
+#undef BATCH_FFT_MIN_RANK
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_BATCH_FFT_H_ */
@@ -428,6 +428,16 @@ namespace lsp
                   "%xmm4", "%xmm5", "%xmm6", "%xmm7"
             );
         }
+
+        size_t convolve_fft_threshold()
+        {
+            return 224; // Crossover point, see dsp.fft.convolve_fft performance test
+        }
+
+        size_t convolve_fft_threshold_fma3()
+        {
+            return 224; // Crossover point, see dsp.fft.convolve_fft performance test
+        }
     } /* namespace avx */
 } /* namespace lsp */
 
@@ -411,8 +411,80 @@ namespace lsp
             FASTCONV_APPLY_CORE(FMA_ON);
         }
 
+        #define FASTCONV_FMADD_CORE(FMA_SEL) \
+            size_t off; \
+            ARCH_X86_ASM( \
+                /* 2x blocks */ \
+                __ASM_EMIT("xor             %[off], %[off]") \
+                __ASM_EMIT("sub             $32, %[k]") \
+                __ASM_EMIT("jb              2f") \
+                __ASM_EMIT("1:") \
+                    __ASM_EMIT("vmovups         0x00(%[c1], %[off]), %%ymm0")                   /* ymm0 = r */ \
+                    __ASM_EMIT("vmovups         0x20(%[c1], %[off]), %%ymm1")                   /* ymm1 = i */ \
+                    __ASM_EMIT("vmovups         0x40(%[c1], %[off]), %%ymm4") \
+                    __ASM_EMIT("vmovups         0x60(%[c1], %[off]), %%ymm5") \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2], %[off]), %%ymm0, %%ymm2", "vmovups 0x00(%[dst], %[off]), %%ymm2"))     /* ymm2 = r*R */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x40(%[c2], %[off]), %%ymm4, %%ymm6", "vmovups 0x40(%[dst], %[off]), %%ymm6")) \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x20(%[c2], %[off]), %%ymm1, %%ymm3", "vmovups 0x20(%[dst], %[off]), %%ymm3"))     /* ymm3 = i*I */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x60(%[c2], %[off]), %%ymm5, %%ymm7", "vmovups 0x60(%[dst], %[off]), %%ymm7")) \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x20(%[c2], %[off]), %%ymm0, %%ymm0", "vfmadd231ps  0x00(%[c2], %[off]), %%ymm0, %%ymm2"))  /* ymm0 = r*I */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x60(%[c2], %[off]), %%ymm4, %%ymm4", "vfmadd231ps  0x40(%[c2], %[off]), %%ymm4, %%ymm6")) \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2], %[off]), %%ymm1, %%ymm1", "vfnmadd231ps 0x20(%[c2], %[off]), %%ymm1, %%ymm2"))  /* ymm1 = i*R */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x40(%[c2], %[off]), %%ymm5, %%ymm5", "vfnmadd231ps 0x60(%[c2], %[off]), %%ymm5, %%ymm6")) \
+                    __ASM_EMIT(FMA_SEL("vsubps  %%ymm3, %%ymm2, %%ymm2", "vfmadd231ps  0x20(%[c2], %[off]), %%ymm0, %%ymm3"))               /* ymm2 = r*R - i*I */ \
+                    __ASM_EMIT(FMA_SEL("vsubps  %%ymm7, %%ymm6, %%ymm6", "vfmadd231ps  0x60(%[c2], %[off]), %%ymm4, %%ymm7")) \
+                    __ASM_EMIT(FMA_SEL("vaddps  %%ymm0, %%ymm1, %%ymm3", "vfmadd231ps  0x00(%[c2], %[off]), %%ymm1, %%ymm3"))               /* ymm3 = r*I + i*R */ \
+                    __ASM_EMIT(FMA_SEL("vaddps  %%ymm4, %%ymm5, %%ymm7", "vfmadd231ps  0x40(%[c2], %[off]), %%ymm5, %%ymm7")) \
+                    __ASM_EMIT(FMA_SEL("vaddps  0x00(%[dst], %[off]), %%ymm2, %%ymm2", "")) \
+                    __ASM_EMIT(FMA_SEL("vaddps  0x20(%[dst], %[off]), %%ymm3, %%ymm3", "")) \
+                    __ASM_EMIT(FMA_SEL("vaddps  0x40(%[dst], %[off]), %%ymm6, %%ymm6", "")) \
+                    __ASM_EMIT(FMA_SEL("vaddps  0x60(%[dst], %[off]), %%ymm7, %%ymm7", "")) \
+                    __ASM_EMIT("vmovups         %%ymm2, 0x00(%[dst], %[off])") \
+                    __ASM_EMIT("vmovups         %%ymm3, 0x20(%[dst], %[off])") \
+                    __ASM_EMIT("vmovups         %%ymm6, 0x40(%[dst], %[off])") \
+                    __ASM_EMIT("vmovups         %%ymm7, 0x60(%[dst], %[off])") \
+                __ASM_EMIT("add             $0x80, %[off]") \
+                __ASM_EMIT("sub             $32, %[k]") \
+                __ASM_EMIT("jae             1b") \
+                /* 1x block */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT("add             $16, %[k]") \
+                __ASM_EMIT("jl              4f") \
+                    __ASM_EMIT("vmovups         0x00(%[c1], %[off]), %%ymm0")                   /* ymm0 = r */ \
+                    __ASM_EMIT("vmovups         0x20(%[c1], %[off]), %%ymm1")                   /* ymm1 = i */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2], %[off]), %%ymm0, %%ymm2", "vmovups 0x00(%[dst], %[off]), %%ymm2"))     /* ymm2 = r*R */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x20(%[c2], %[off]), %%ymm1, %%ymm3", "vmovups 0x20(%[dst], %[off]), %%ymm3"))     /* ymm3 = i*I */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x20(%[c2], %[off]), %%ymm0, %%ymm0", "vfmadd231ps  0x00(%[c2], %[off]), %%ymm0, %%ymm2"))  /* ymm0 = r*I */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2], %[off]), %%ymm1, %%ymm1", "vfnmadd231ps 0x20(%[c2], %[off]), %%ymm1, %%ymm2"))  /* ymm1 = i*R */ \
+                    __ASM_EMIT(FMA_SEL("vsubps  %%ymm3, %%ymm2, %%ymm2", "vfmadd231ps  0x20(%[c2], %[off]), %%ymm0, %%ymm3"))               /* ymm2 = r*R - i*I */ \
+                    __ASM_EMIT(FMA_SEL("vaddps  %%ymm0, %%ymm1, %%ymm3", "vfmadd231ps  0x00(%[c2], %[off]), %%ymm1, %%ymm3"))               /* ymm3 = r*I + i*R */ \
+                    __ASM_EMIT(FMA_SEL("vaddps  0x00(%[dst], %[off]), %%ymm2, %%ymm2", "")) \
+                    __ASM_EMIT(FMA_SEL("vaddps  0x20(%[dst], %[off]), %%ymm3, %%ymm3", "")) \
+                    __ASM_EMIT("vmovups         %%ymm2, 0x00(%[dst], %[off])") \
+                    __ASM_EMIT("vmovups         %%ymm3, 0x20(%[dst], %[off])") \
+                __ASM_EMIT("4:") \
+                : [off] "=&r" (off), [k] "+r" (items) \
+                : [dst] "r" (dst), [c1] "r" (c1), [c2] "r" (c2) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            )
+
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank + 1);
+            FASTCONV_FMADD_CORE(FMA_OFF);
+        }
+
+        void fastconv_fmadd_fma3(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank + 1);
+            FASTCONV_FMADD_CORE(FMA_ON);
+        }
+
     #undef FASTCONV_APPLY_PREPARE_CORE
     #undef FASTCONV_APPLY_CORE
+    #undef FASTCONV_FMADD_CORE
     #undef FMA_ON
     #undef FMA_OFF
     }
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FFT_R_SPLIT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FFT_R_SPLIT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        IF_ARCH_X86(
+            static const float rfft_split_const[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(0.5f)
+            };
+        )
+
+        /* Load 8 complex numbers a[0..7] and 8 complex numbers b[-1..-8] stored in reverse order,
+         * both are unpacked in the order of vshufps: 0 1 4 5 2 3 6 7
+         */
+        #define RFFT_SPLIT_LOAD \
+            __ASM_EMIT("vmovups         0x00(%[a]), %%ymm0")                /* ymm0 = a0 a1 a2 a3 */ \
+            __ASM_EMIT("vmovups         0x20(%[a]), %%ymm1")                /* ymm1 = a4 a5 a6 a7 */ \
+            __ASM_EMIT("vmovups         0x30(%[b]), %%xmm4")                /* xmm4 = b1 b0 */ \
+            __ASM_EMIT("vmovups         0x10(%[b]), %%xmm5")                /* xmm5 = b5 b4 */ \
+            __ASM_EMIT("vinsertf128     $1, 0x20(%[b]), %%ymm4, %%ymm4")    /* ymm4 = b1 b0 b3 b2 */ \
+            __ASM_EMIT("vinsertf128     $1, 0x00(%[b]), %%ymm5, %%ymm5")    /* ymm5 = b5 b4 b7 b6 */ \
+            __ASM_EMIT("vshufps         $0x88, %%ymm1, %%ymm0, %%ymm2")     /* ymm2 = ar */ \
+            __ASM_EMIT("vshufps         $0xdd, %%ymm1, %%ymm0, %%ymm3")     /* ymm3 = ai */ \
+            __ASM_EMIT("vshufps         $0x22, %%ymm5, %%ymm4, %%ymm0")     /* ymm0 = br */ \
+            __ASM_EMIT("vshufps         $0x77, %%ymm5, %%ymm4, %%ymm1")     /* ymm1 = bi */
+
+        /* Pack and store 8 complex numbers a[0..7] = ymm4:ymm5 and b[-1..-8] = ymm0:ymm1 */
+        #define RFFT_SPLIT_STORE(off) \
+            __ASM_EMIT("vunpcklps       %%ymm5, %%ymm4, %%ymm2")            /* ymm2 = a0 a1 a2 a3 */ \
+            __ASM_EMIT("vunpckhps       %%ymm5, %%ymm4, %%ymm3")            /* ymm3 = a4 a5 a6 a7 */ \
+            __ASM_EMIT("vunpcklps       %%ymm1, %%ymm0, %%ymm4")            /* ymm4 = b0 b1 b2 b3 */ \
+            __ASM_EMIT("vunpckhps       %%ymm1, %%ymm0, %%ymm5")            /* ymm5 = b4 b5 b6 b7 */ \
+            __ASM_EMIT("vshufps         $0x4e, %%ymm4, %%ymm4, %%ymm4")     /* ymm4 = b1 b0 b3 b2 */ \
+            __ASM_EMIT("vshufps         $0x4e, %%ymm5, %%ymm5, %%ymm5")     /* ymm5 = b5 b4 b7 b6 */ \
+            __ASM_EMIT("vmovups         %%ymm2, 0x00(%[a]" off ")") \
+            __ASM_EMIT("vmovups         %%ymm3, 0x20(%[a]" off ")") \
+            __ASM_EMIT("vmovups         %%xmm4, 0x30(%[b]" off ")") \
+            __ASM_EMIT("vextractf128    $1, %%ymm4, 0x20(%[b]" off ")") \
+            __ASM_EMIT("vmovups         %%xmm5, 0x10(%[b]" off ")") \
+            __ASM_EMIT("vextractf128    $1, %%ymm5, 0x00(%[b]" off ")")
+
+        /* Rotate the angle and repeat the loop */
+        #define RFFT_SPLIT_ROTATE(FMA_SEL) \
+            __ASM_EMIT("add             $0x40, %[a]") \
+            __ASM_EMIT("sub             $0x40, %[b]") \
+            __ASM_EMIT32("decl          %[blocks]") \
+            __ASM_EMIT64("decq          %[blocks]") \
+            __ASM_EMIT("jz              2f") \
+            __ASM_EMIT("vmulps          0x40(%[w]), %%ymm7, %%ymm2")        /* ymm2 = w_im * dw_re */ \
+            __ASM_EMIT("vmulps          0x60(%[w]), %%ymm6, %%ymm3")        /* ymm3 = w_re * dw_im */ \
+            __ASM_EMIT("vmulps          0x60(%[w]), %%ymm7, %%ymm7")        /* ymm7 = w_im * dw_im */ \
+            __ASM_EMIT(FMA_SEL("vmulps  0x40(%[w]), %%ymm6, %%ymm6", ""))   /* ymm6 = w_re * dw_re */ \
+            __ASM_EMIT(FMA_SEL("vsubps  %%ymm7, %%ymm6, %%ymm6", "vfmsub132ps 0x40(%[w]), %%ymm7, %%ymm6")) /* ymm6 = w_re' = w_re * dw_re - w_im * dw_im */ \
+            __ASM_EMIT("vaddps          %%ymm3, %%ymm2, %%ymm7")            /* ymm7 = w_im' = w_im * dw_re + w_re * dw_im */ \
+            __ASM_EMIT("jmp             1b") \
+            __ASM_EMIT("2:")
+
+        #define RFFT_SPLIT_DIRECT_BODY(FMA_SEL) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("vmovaps         0x00(%[w]), %%ymm6")                /* ymm6 = w_re */ \
+                __ASM_EMIT("vmovaps         0x20(%[w]), %%ymm7")                /* ymm7 = w_im */ \
+                __ASM_EMIT("1:") \
+                RFFT_SPLIT_LOAD \
+                /* Compute sums and differences */ \
+                __ASM_EMIT("vaddps          %%ymm0, %%ymm2, %%ymm4")            /* ymm4 = s = ar + br */ \
+                __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = q = br - ar */ \
+                __ASM_EMIT("vaddps          %%ymm1, %%ymm3, %%ymm2")            /* ymm2 = p = ai + bi */ \
+                __ASM_EMIT("vsubps          %%ymm1, %%ymm3, %%ymm3")            /* ymm3 = d = ai - bi */ \
+                /* Apply twiddle factors */ \
+                __ASM_EMIT("vmulps          %%ymm7, %%ymm0, %%ymm1")            /* ymm1 = w_im * q */ \
+                __ASM_EMIT("vmulps          %%ymm7, %%ymm2, %%ymm5")            /* ymm5 = w_im * p */ \
+                __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm2, %%ymm2", ""))       /* ymm2 = w_re * p */ \
+                __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm0, %%ymm0", ""))       /* ymm0 = w_re * q */ \
+                __ASM_EMIT(FMA_SEL("vaddps  %%ymm1, %%ymm2, %%ymm1", "vfmadd231ps %%ymm6, %%ymm2, %%ymm1")) /* ymm1 = t_re = w_re * p + w_im * q */ \
+                __ASM_EMIT(FMA_SEL("vsubps  %%ymm5, %%ymm0, %%ymm5", "vfmsub231ps %%ymm6, %%ymm0, %%ymm5")) /* ymm5 = t_im = w_re * q - w_im * p */ \
+                /* Compute the output */ \
+                __ASM_EMIT("vmovaps         %[X_HALF], %%ymm2")                 /* ymm2 = 0.5 */ \
+                __ASM_EMIT("vsubps          %%ymm1, %%ymm4, %%ymm0")            /* ymm0 = s - t_re */ \
+                __ASM_EMIT("vaddps          %%ymm1, %%ymm4, %%ymm4")            /* ymm4 = s + t_re */ \
+                __ASM_EMIT("vsubps          %%ymm3, %%ymm5, %%ymm1")            /* ymm1 = t_im - d */ \
+                __ASM_EMIT("vaddps          %%ymm3, %%ymm5, %%ymm5")            /* ymm5 = t_im + d */ \
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = xb_re = (s - t_re)/2 */ \
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm1, %%ymm1")            /* ymm1 = xb_im = (t_im - d)/2 */ \
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm4, %%ymm4")            /* ymm4 = xa_re = (s + t_re)/2 */ \
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm5, %%ymm5")            /* ymm5 = xa_im = (t_im + d)/2 */ \
+                RFFT_SPLIT_STORE("") \
+                RFFT_SPLIT_ROTATE(FMA_SEL) \
+                : [a] "+r" (a), [b] "+r" (b), [blocks] __ASM_ARG_RW(blocks) \
+                : [w] "r" (w), \
+                  [X_HALF] "m" (rfft_split_const) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        #define RFFT_SPLIT_REVERSE_BODY(FMA_SEL) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("vmovaps         0x00(%[w]), %%ymm6")                /* ymm6 = w_re */ \
+                __ASM_EMIT("vmovaps         0x20(%[w]), %%ymm7")                /* ymm7 = w_im */ \
+                __ASM_EMIT("1:") \
+                RFFT_SPLIT_LOAD \
+                /* Compute sums and differences */ \
+                __ASM_EMIT("vaddps          %%ymm0, %%ymm2, %%ymm4")            /* ymm4 = s = ar + br */ \
+                __ASM_EMIT("vsubps          %%ymm0, %%ymm2, %%ymm0")            /* ymm0 = p = ar - br */ \
+                __ASM_EMIT("vaddps          %%ymm1, %%ymm3, %%ymm2")            /* ymm2 = q = ai + bi */ \
+                __ASM_EMIT("vsubps          %%ymm1, %%ymm3, %%ymm3")            /* ymm3 = d = ai - bi */ \
+                /* Apply twiddle factors */ \
+                __ASM_EMIT("vmulps          %%ymm7, %%ymm2, %%ymm1")            /* ymm1 = w_im * q */ \
+                __ASM_EMIT("vmulps          %%ymm7, %%ymm0, %%ymm5")            /* ymm5 = w_im * p */ \
+                __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm0, %%ymm0", ""))       /* ymm0 = w_re * p */ \
+                __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm2, %%ymm2", ""))       /* ymm2 = w_re * q */ \
+                __ASM_EMIT(FMA_SEL("vsubps  %%ymm1, %%ymm0, %%ymm1", "vfmsub231ps %%ymm6, %%ymm0, %%ymm1")) /* ymm1 = o_re = w_re * p - w_im * q */ \
+                __ASM_EMIT(FMA_SEL("vaddps  %%ymm5, %%ymm2, %%ymm5", "vfmadd231ps %%ymm6, %%ymm2, %%ymm5")) /* ymm5 = o_im = w_re * q + w_im * p */ \
+                /* Compute the output */ \
+                __ASM_EMIT("vmovaps         %[X_HALF], %%ymm2")                 /* ymm2 = 0.5 */ \
+                __ASM_EMIT("vaddps          %%ymm5, %%ymm4, %%ymm0")            /* ymm0 = s + o_im */ \
+                __ASM_EMIT("vsubps          %%ymm5, %%ymm4, %%ymm4")            /* ymm4 = s - o_im */ \
+                __ASM_EMIT("vaddps          %%ymm3, %%ymm1, %%ymm5")            /* ymm5 = o_re + d */ \
+                __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm1")            /* ymm1 = o_re - d */ \
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = zb_re = (s + o_im)/2 */ \
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm1, %%ymm1")            /* ymm1 = zb_im = (o_re - d)/2 */ \
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm4, %%ymm4")            /* ymm4 = za_re = (s - o_im)/2 */ \
+                __ASM_EMIT("vmulps          %%ymm2, %%ymm5, %%ymm5")            /* ymm5 = za_im = (o_re + d)/2 */ \
+                RFFT_SPLIT_STORE(", %[delta]") \
+                RFFT_SPLIT_ROTATE(FMA_SEL) \
+                : [a] "+r" (a), [b] "+r" (b), [blocks] __ASM_ARG_RW(blocks) \
+                : [w] "r" (w), [delta] "r" (delta), \
+                  [X_HALF] "m" (rfft_split_const) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+    #define FMA_OFF(a, b)       a
+    #define FMA_ON(a, b)        b
+
+        /**
+         * Compute twiddle factors for the split pass from the FFT tables: initial angles
+         * (1..8)*pi/N stored in the order of 'vshufps'-unpacked complex numbers and the
+         * rotation by 8*pi/N, N = 2^(rank-1), rank >= 5
+         */
+        static inline void real_split_twiddle(float *w, size_t rank)
+        {
+            const float *a      = &FFT_A[(rank - 3) << 4];      // angles (0..7)*pi/N
+            const float *dw     = &FFT_DW[(rank - 3) << 4];     // rotation by 8*pi/N
+
+            w[0]    = a[1];     w[1]    = a[2];     w[2]    = a[5];     w[3]    = a[6];
+            w[4]    = a[3];     w[5]    = a[4];     w[6]    = a[7];
+            w[8]    = a[9];     w[9]    = a[10];    w[10]   = a[13];    w[11]   = a[14];
+            w[12]   = a[11];    w[13]   = a[12];    w[14]   = a[15];
+
+            // 8*pi/N = 2 * (4*pi/N)
+            w[7]    = a[4]*a[4] - a[12]*a[12];
+            w[15]   = 2.0f * a[4]*a[12];
+
+            for (size_t i=0; i<16; ++i)
+                w[i + 16]   = dw[i];
+        }
+
+        /**
+         * Split the spectrum of the complex FFT of half size into the spectrum of real FFT,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 5.
+         * X[k] = (Z[k] + Z*[N-k])/2 - j*W^k * (Z[k] - Z*[N-k])/2
+         */
+        static inline void real_split_direct(float *dst, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            float *a        = &dst[2];
+            float *b        = &dst[(items - 8) << 1];
+            float w[32] __lsp_aligned32;
+            real_split_twiddle(w, rank);
+            size_t blocks   = items >> 4;
+
+            RFFT_SPLIT_DIRECT_BODY(FMA_OFF);
+        }
+
+        static inline void real_split_direct_fma3(float *dst, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            float *a        = &dst[2];
+            float *b        = &dst[(items - 8) << 1];
+            float w[32] __lsp_aligned32;
+            real_split_twiddle(w, rank);
+            size_t blocks   = items >> 4;
+
+            RFFT_SPLIT_DIRECT_BODY(FMA_ON);
+        }
+
+        /**
+         * Join the Hermitian-symmetric spectrum into the spectrum of the complex FFT of half size,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 5.
+         * Z[k] = (X[k] + X*[N-k])/2 + j*W^-k * (X[k] - X*[N-k])/2
+         */
+        static inline void real_split_reverse(float *dst, const float *src, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            const float *a  = &src[2];
+            const float *b  = &src[(items - 8) << 1];
+            float w[32] __lsp_aligned32;
+            real_split_twiddle(w, rank);
+            ptrdiff_t delta = reinterpret_cast<uint8_t *>(dst) - reinterpret_cast<const uint8_t *>(src);
+            size_t blocks   = items >> 4;
+
+            RFFT_SPLIT_REVERSE_BODY(FMA_OFF);
+        }
+
+        static inline void real_split_reverse_fma3(float *dst, const float *src, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            const float *a  = &src[2];
+            const float *b  = &src[(items - 8) << 1];
+            float w[32] __lsp_aligned32;
+            real_split_twiddle(w, rank);
+            ptrdiff_t delta = reinterpret_cast<uint8_t *>(dst) - reinterpret_cast<const uint8_t *>(src);
+            size_t blocks   = items >> 4;
+
+            RFFT_SPLIT_REVERSE_BODY(FMA_ON);
+        }
+
+    #undef FMA_OFF
+    #undef FMA_ON
+
+    #undef RFFT_SPLIT_REVERSE_BODY
+    #undef RFFT_SPLIT_DIRECT_BODY
+    #undef RFFT_SPLIT_ROTATE
+    #undef RFFT_SPLIT_STORE
+    #undef RFFT_SPLIT_LOAD
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FFT_R_SPLIT_H_ */
@@ -0,0 +1,551 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FFT_PLAN_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FFT_PLAN_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+#include <private/dsp/arch/generic/fft/plan_small.h>
+#include <private/dsp/arch/x86/avx/fft/const.h>
+#include <private/dsp/arch/x86/avx/fft/butterfly.h>
+#include <private/dsp/arch/x86/avx/fft/p_butterfly.h>
+#include <private/dsp/arch/x86/avx/fft/normalize.h>
+#include <private/dsp/arch/x86/avx/fft/p_repack.h>
+
+// Scrambling functions for ranks that do not fit into 16-bit indices
+#define FFT_SCRAMBLE_SELF_DIRECT_NAME       scramble_self_direct32
+#define FFT_SCRAMBLE_SELF_REVERSE_NAME      scramble_self_reverse32
+#define FFT_SCRAMBLE_COPY_DIRECT_NAME       scramble_copy_direct32
+#define FFT_SCRAMBLE_COPY_REVERSE_NAME      scramble_copy_reverse32
+#define FFT_TYPE                            uint32_t
+#define FFT_FMA(a, b)                       a
+#include <private/dsp/arch/x86/avx/fft/scramble.h>
+
+#define FFT_SCRAMBLE_SELF_DIRECT_NAME       scramble_self_direct32_fma3
+#define FFT_SCRAMBLE_SELF_REVERSE_NAME      scramble_self_reverse32_fma3
+#define FFT_SCRAMBLE_COPY_DIRECT_NAME       scramble_copy_direct32_fma3
+#define FFT_SCRAMBLE_COPY_REVERSE_NAME      scramble_copy_reverse32_fma3
+#define FFT_TYPE                            uint32_t
+#define FFT_FMA(a, b)                       b
+#include <private/dsp/arch/x86/avx/fft/scramble.h>
+
+#define FFT_PSCRAMBLE_SELF_DIRECT_NAME      packed_scramble_self_direct32
+#define FFT_PSCRAMBLE_SELF_REVERSE_NAME     packed_scramble_self_reverse32
+#define FFT_PSCRAMBLE_COPY_DIRECT_NAME      packed_scramble_copy_direct32
+#define FFT_PSCRAMBLE_COPY_REVERSE_NAME     packed_scramble_copy_reverse32
+#define FFT_TYPE                            uint32_t
+#define FFT_FMA(a, b)                       a
+#include <private/dsp/arch/x86/avx/fft/p_scramble.h>
+
+#define FFT_PSCRAMBLE_SELF_DIRECT_NAME      packed_scramble_self_direct32_fma3
+#define FFT_PSCRAMBLE_SELF_REVERSE_NAME     packed_scramble_self_reverse32_fma3
+#define FFT_PSCRAMBLE_COPY_DIRECT_NAME      packed_scramble_copy_direct32_fma3
+#define FFT_PSCRAMBLE_COPY_REVERSE_NAME     packed_scramble_copy_reverse32_fma3
+#define FFT_TYPE                            uint32_t
+#define FFT_FMA(a, b)                       b
+#include <private/dsp/arch/x86/avx/fft/p_scramble.h>
+
+namespace lsp
+{
+    namespace avx
+    {
+        /*
+         * Butterflies of rank 4 and above load twiddle factors from the table of the FFT plan:
+         * 16 cosines followed by 16 sines for each 16 pairs of complex numbers, each group
+         * of 16 pairs is processed as two halves of 8 pairs.
+         */
+        #define FFT_PLAN_BUTTERFLY_HALF(a_re, a_im, b_re, b_im, w_re, w_im, add_b, add_a, FMA_SEL) \
+            __ASM_EMIT("vmovups         " a_re ", %%ymm0")                              /* ymm0 = a_re */ \
+            __ASM_EMIT("vmovups         " b_re ", %%ymm2")                              /* ymm2 = b_re */ \
+            __ASM_EMIT("vmovups         " a_im ", %%ymm1")                              /* ymm1 = a_im */ \
+            __ASM_EMIT("vmovups         " b_im ", %%ymm3")                              /* ymm3 = b_im */ \
+            /* Calculate complex multiplication */ \
+            __ASM_EMIT("vmulps          " w_im ", %%ymm2, %%ymm4")                      /* ymm4 = x_im * b_re */ \
+            __ASM_EMIT("vmulps          " w_im ", %%ymm3, %%ymm5")                      /* ymm5 = x_im * b_im */ \
+            __ASM_EMIT(FMA_SEL("vmulps  " w_re ", %%ymm2, %%ymm2", ""))                 /* ymm2 = x_re * b_re */ \
+            __ASM_EMIT(FMA_SEL("vmulps  " w_re ", %%ymm3, %%ymm3", ""))                 /* ymm3 = x_re * b_im */ \
+            __ASM_EMIT(FMA_SEL(add_b "  %%ymm5, %%ymm2, %%ymm5", add_b " " w_re ", %%ymm2, %%ymm5")) /* ymm5 = c_re = x_re * b_re +- x_im * b_im */ \
+            __ASM_EMIT(FMA_SEL(add_a "  %%ymm4, %%ymm3, %%ymm4", add_a " " w_re ", %%ymm3, %%ymm4")) /* ymm4 = c_im = x_re * b_im -+ x_im * b_re */ \
+            /* Perform butterfly */ \
+            __ASM_EMIT("vsubps          %%ymm5, %%ymm0, %%ymm2")                        /* ymm2 = a_re - c_re */ \
+            __ASM_EMIT("vsubps          %%ymm4, %%ymm1, %%ymm3")                        /* ymm3 = a_im - c_im */ \
+            __ASM_EMIT("vaddps          %%ymm5, %%ymm0, %%ymm0")                        /* ymm0 = a_re + c_re */ \
+            __ASM_EMIT("vaddps          %%ymm4, %%ymm1, %%ymm1")                        /* ymm1 = a_im + c_im */ \
+            /* Store values */ \
+            __ASM_EMIT("vmovups         %%ymm0, " a_re) \
+            __ASM_EMIT("vmovups         %%ymm2, " b_re) \
+            __ASM_EMIT("vmovups         %%ymm1, " a_im) \
+            __ASM_EMIT("vmovups         %%ymm3, " b_im)
+
+        #define FFT_PLAN_BUTTERFLY_BODY16(add_b, add_a, FMA_SEL) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("mov             %[shift], %[np]") \
+                /* Process pairs */ \
+                __ASM_EMIT("2:") \
+                    FFT_PLAN_BUTTERFLY_HALF("0x00(%[dst_re])", "0x00(%[dst_im])", "0x00(%[dst_re], %[shift])", "0x00(%[dst_im], %[shift])", \
+                        "0x00(%[tw])", "0x40(%[tw])", add_b, add_a, FMA_SEL) \
+                    FFT_PLAN_BUTTERFLY_HALF("0x20(%[dst_re])", "0x20(%[dst_im])", "0x20(%[dst_re], %[shift])", "0x20(%[dst_im], %[shift])", \
+                        "0x20(%[tw])", "0x60(%[tw])", add_b, add_a, FMA_SEL) \
+                    __ASM_EMIT("add             $0x40, %[dst_re]") \
+                    __ASM_EMIT("add             $0x40, %[dst_im]") \
+                    __ASM_EMIT("add             $0x80, %[tw]") \
+                    __ASM_EMIT("sub             $0x40, %[np]") \
+                __ASM_EMIT("jnz             2b") \
+                /* Move to the next block and rewind twiddle factors */ \
+                __ASM_EMIT("add             %[shift], %[dst_re]") \
+                __ASM_EMIT("add             %[shift], %[dst_im]") \
+                __ASM_EMIT("sub             %[shift], %[tw]") \
+                __ASM_EMIT("sub             %[shift], %[tw]") \
+                __ASM_EMIT32("decl          %[blocks]") \
+                __ASM_EMIT64("decq          %[blocks]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [dst_re] "+r" (dst_re), [dst_im] "+r" (dst_im), [tw] "+r" (tw), \
+                  [np] "=&r" (np), [blocks] X86_PGREG (blocks) \
+                : [shift] "r" (shift) \
+                : "cc", "memory",  \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5" \
+            );
+
+        #define FFT_PLAN_PBUTTERFLY_BODY16(add_b, add_a, FMA_SEL) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("mov             %[shift], %[np]") \
+                /* Process pairs */ \
+                __ASM_EMIT("2:") \
+                    FFT_PLAN_BUTTERFLY_HALF("0x00(%[dst])", "0x20(%[dst])", "0x00(%[dst], %[shift])", "0x20(%[dst], %[shift])", \
+                        "0x00(%[tw])", "0x40(%[tw])", add_b, add_a, FMA_SEL) \
+                    FFT_PLAN_BUTTERFLY_HALF("0x40(%[dst])", "0x60(%[dst])", "0x40(%[dst], %[shift])", "0x60(%[dst], %[shift])", \
+                        "0x20(%[tw])", "0x60(%[tw])", add_b, add_a, FMA_SEL) \
+                    __ASM_EMIT("add             $0x80, %[dst]") \
+                    __ASM_EMIT("add             $0x80, %[tw]") \
+                    __ASM_EMIT("sub             $0x80, %[np]") \
+                __ASM_EMIT("jnz             2b") \
+                /* Move to the next block and rewind twiddle factors */ \
+                __ASM_EMIT("add             %[shift], %[dst]") \
+                __ASM_EMIT("sub             %[shift], %[tw]") \
+                __ASM_EMIT32("decl          %[blocks]") \
+                __ASM_EMIT64("decq          %[blocks]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [dst] "+r" (dst), [tw] "+r" (tw), \
+                  [np] "=&r" (np), [blocks] X86_PGREG (blocks) \
+                : [shift] "r" (shift) \
+                : "cc", "memory",  \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5" \
+            );
+
+    #define FMA_OFF(a, b)       a
+    #define FMA_ON(a, b)        b
+
+        static inline void fft_plan_butterfly_direct16p(float *dst_re, float *dst_im, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(4) << rank;
+
+            FFT_PLAN_BUTTERFLY_BODY16("vaddps", "vsubps", FMA_OFF);
+        }
+
+        static inline void fft_plan_butterfly_reverse16p(float *dst_re, float *dst_im, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(4) << rank;
+
+            FFT_PLAN_BUTTERFLY_BODY16("vsubps", "vaddps", FMA_OFF);
+        }
+
+        static inline void fft_plan_butterfly_direct16p_fma3(float *dst_re, float *dst_im, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(4) << rank;
+
+            FFT_PLAN_BUTTERFLY_BODY16("vfmadd231ps", "vfmsub231ps", FMA_ON);
+        }
+
+        static inline void fft_plan_butterfly_reverse16p_fma3(float *dst_re, float *dst_im, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(4) << rank;
+
+            FFT_PLAN_BUTTERFLY_BODY16("vfmsub231ps", "vfmadd231ps", FMA_ON);
+        }
+
+        static inline void fft_plan_packed_butterfly_direct16p(float *dst, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(8) << rank;
+
+            FFT_PLAN_PBUTTERFLY_BODY16("vaddps", "vsubps", FMA_OFF);
+        }
+
+        static inline void fft_plan_packed_butterfly_reverse16p(float *dst, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(8) << rank;
+
+            FFT_PLAN_PBUTTERFLY_BODY16("vsubps", "vaddps", FMA_OFF);
+        }
+
+        static inline void fft_plan_packed_butterfly_direct16p_fma3(float *dst, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(8) << rank;
+
+            FFT_PLAN_PBUTTERFLY_BODY16("vfmadd231ps", "vfmsub231ps", FMA_ON);
+        }
+
+        static inline void fft_plan_packed_butterfly_reverse16p_fma3(float *dst, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(8) << rank;
+
+            FFT_PLAN_PBUTTERFLY_BODY16("vfmsub231ps", "vfmadd231ps", FMA_ON);
+        }
+
+    #undef FMA_OFF
+    #undef FMA_ON
+    #undef FFT_PLAN_BUTTERFLY_HALF
+    #undef FFT_PLAN_BUTTERFLY_BODY16
+    #undef FFT_PLAN_PBUTTERFLY_BODY16
+
+        void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(dst_re, dst_im, src_re, src_im, 1, rank, -1.0f);
+                return;
+            }
+
+            if ((dst_re == src_re) || (dst_im == src_im) || (rank < 4))
+            {
+                dsp::move(dst_re, src_re, size_t(1) << rank);
+                dsp::move(dst_im, src_im, size_t(1) << rank);
+                if (rank <= 8)
+                    scramble_self_direct8(dst_re, dst_im, rank);
+                else if (rank <= 16)
+                    scramble_self_direct16(dst_re, dst_im, rank);
+                else
+                    scramble_self_direct32(dst_re, dst_im, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    scramble_copy_direct8(dst_re, dst_im, src_re, src_im, rank-4);
+                else if (rank <= 20)
+                    scramble_copy_direct16(dst_re, dst_im, src_re, src_im, rank-4);
+                else
+                    scramble_copy_direct32(dst_re, dst_im, src_re, src_im, rank-4);
+            }
+
+            if (rank > 3)
+                butterfly_direct8p(dst_re, dst_im, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_butterfly_direct16p(dst_re, dst_im, tw, i, size_t(1) << (rank - i - 1));
+        }
+
+        void fft_plan_reverse(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(dst_re, dst_im, src_re, src_im, 1, rank, 1.0f);
+                return;
+            }
+
+            if ((dst_re == src_re) || (dst_im == src_im) || (rank < 4))
+            {
+                dsp::move(dst_re, src_re, size_t(1) << rank);
+                dsp::move(dst_im, src_im, size_t(1) << rank);
+                if (rank <= 8)
+                    scramble_self_reverse8(dst_re, dst_im, rank);
+                else if (rank <= 16)
+                    scramble_self_reverse16(dst_re, dst_im, rank);
+                else
+                    scramble_self_reverse32(dst_re, dst_im, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    scramble_copy_reverse8(dst_re, dst_im, src_re, src_im, rank-4);
+                else if (rank <= 20)
+                    scramble_copy_reverse16(dst_re, dst_im, src_re, src_im, rank-4);
+                else
+                    scramble_copy_reverse32(dst_re, dst_im, src_re, src_im, rank-4);
+            }
+
+            if (rank > 3)
+                butterfly_reverse8p(dst_re, dst_im, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_butterfly_reverse16p(dst_re, dst_im, tw, i, size_t(1) << (rank - i - 1));
+
+            normalize_fft2(dst_re, dst_im, rank);
+        }
+
+        void fft_plan_direct_fma3(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(dst_re, dst_im, src_re, src_im, 1, rank, -1.0f);
+                return;
+            }
+
+            if ((dst_re == src_re) || (dst_im == src_im) || (rank < 4))
+            {
+                dsp::move(dst_re, src_re, size_t(1) << rank);
+                dsp::move(dst_im, src_im, size_t(1) << rank);
+                if (rank <= 8)
+                    scramble_self_direct8_fma3(dst_re, dst_im, rank);
+                else if (rank <= 16)
+                    scramble_self_direct16_fma3(dst_re, dst_im, rank);
+                else
+                    scramble_self_direct32_fma3(dst_re, dst_im, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    scramble_copy_direct8_fma3(dst_re, dst_im, src_re, src_im, rank-4);
+                else if (rank <= 20)
+                    scramble_copy_direct16_fma3(dst_re, dst_im, src_re, src_im, rank-4);
+                else
+                    scramble_copy_direct32_fma3(dst_re, dst_im, src_re, src_im, rank-4);
+            }
+
+            if (rank > 3)
+                butterfly_direct8p_fma3(dst_re, dst_im, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_butterfly_direct16p_fma3(dst_re, dst_im, tw, i, size_t(1) << (rank - i - 1));
+        }
+
+        void fft_plan_reverse_fma3(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(dst_re, dst_im, src_re, src_im, 1, rank, 1.0f);
+                return;
+            }
+
+            if ((dst_re == src_re) || (dst_im == src_im) || (rank < 4))
+            {
+                dsp::move(dst_re, src_re, size_t(1) << rank);
+                dsp::move(dst_im, src_im, size_t(1) << rank);
+                if (rank <= 8)
+                    scramble_self_reverse8_fma3(dst_re, dst_im, rank);
+                else if (rank <= 16)
+                    scramble_self_reverse16_fma3(dst_re, dst_im, rank);
+                else
+                    scramble_self_reverse32_fma3(dst_re, dst_im, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    scramble_copy_reverse8_fma3(dst_re, dst_im, src_re, src_im, rank-4);
+                else if (rank <= 20)
+                    scramble_copy_reverse16_fma3(dst_re, dst_im, src_re, src_im, rank-4);
+                else
+                    scramble_copy_reverse32_fma3(dst_re, dst_im, src_re, src_im, rank-4);
+            }
+
+            if (rank > 3)
+                butterfly_reverse8p_fma3(dst_re, dst_im, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_butterfly_reverse16p_fma3(dst_re, dst_im, tw, i, size_t(1) << (rank - i - 1));
+
+            normalize_fft2(dst_re, dst_im, rank);
+        }
+
+        void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(&dst[0], &dst[1], &src[0], &src[1], 2, rank, -1.0f);
+                return;
+            }
+
+            if ((dst == src) || (rank < 4))
+            {
+                dsp::move(dst, src, size_t(2) << rank);
+                if (rank <= 8)
+                    packed_scramble_self_direct8(dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_direct16(dst, rank);
+                else
+                    packed_scramble_self_direct32(dst, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    packed_scramble_copy_direct8(dst, src, rank-4);
+                else if (rank <= 20)
+                    packed_scramble_copy_direct16(dst, src, rank-4);
+                else
+                    packed_scramble_copy_direct32(dst, src, rank-4);
+            }
+
+            if (rank > 3)
+                packed_butterfly_direct8p(dst, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_packed_butterfly_direct16p(dst, tw, i, size_t(1) << (rank - i - 1));
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void fft_plan_packed_reverse(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(&dst[0], &dst[1], &src[0], &src[1], 2, rank, 1.0f);
+                return;
+            }
+
+            if ((dst == src) || (rank < 4))
+            {
+                dsp::move(dst, src, size_t(2) << rank);
+                if (rank <= 8)
+                    packed_scramble_self_reverse8(dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_reverse16(dst, rank);
+                else
+                    packed_scramble_self_reverse32(dst, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    packed_scramble_copy_reverse8(dst, src, rank-4);
+                else if (rank <= 20)
+                    packed_scramble_copy_reverse16(dst, src, rank-4);
+                else
+                    packed_scramble_copy_reverse32(dst, src, rank-4);
+            }
+
+            if (rank > 3)
+                packed_butterfly_reverse8p(dst, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_packed_butterfly_reverse16p(dst, tw, i, size_t(1) << (rank - i - 1));
+
+            packed_fft_repack_normalize(dst, rank);
+        }
+
+        void fft_plan_packed_direct_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(&dst[0], &dst[1], &src[0], &src[1], 2, rank, -1.0f);
+                return;
+            }
+
+            if ((dst == src) || (rank < 4))
+            {
+                dsp::move(dst, src, size_t(2) << rank);
+                if (rank <= 8)
+                    packed_scramble_self_direct8_fma3(dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_direct16_fma3(dst, rank);
+                else
+                    packed_scramble_self_direct32_fma3(dst, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    packed_scramble_copy_direct8_fma3(dst, src, rank-4);
+                else if (rank <= 20)
+                    packed_scramble_copy_direct16_fma3(dst, src, rank-4);
+                else
+                    packed_scramble_copy_direct32_fma3(dst, src, rank-4);
+            }
+
+            if (rank > 3)
+                packed_butterfly_direct8p_fma3(dst, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_packed_butterfly_direct16p_fma3(dst, tw, i, size_t(1) << (rank - i - 1));
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void fft_plan_packed_reverse_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(&dst[0], &dst[1], &src[0], &src[1], 2, rank, 1.0f);
+                return;
+            }
+
+            if ((dst == src) || (rank < 4))
+            {
+                dsp::move(dst, src, size_t(2) << rank);
+                if (rank <= 8)
+                    packed_scramble_self_reverse8_fma3(dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_reverse16_fma3(dst, rank);
+                else
+                    packed_scramble_self_reverse32_fma3(dst, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    packed_scramble_copy_reverse8_fma3(dst, src, rank-4);
+                else if (rank <= 20)
+                    packed_scramble_copy_reverse16_fma3(dst, src, rank-4);
+                else
+                    packed_scramble_copy_reverse32_fma3(dst, src, rank-4);
+            }
+
+            if (rank > 3)
+                packed_butterfly_reverse8p_fma3(dst, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_packed_butterfly_reverse16p_fma3(dst, tw, i, size_t(1) << (rank - i - 1));
+
+            packed_fft_repack_normalize(dst, rank);
+        }
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FFT_PLAN_H_ */
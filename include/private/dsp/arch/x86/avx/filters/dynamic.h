@@ -26,6 +26,8 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
 
+#include <private/dsp/arch/generic/filters/lerp.h>
+
 namespace lsp
 {
     namespace avx
@@ -817,6 +819,219 @@ namespace lsp
                   "%xmm4", "%xmm5", "%xmm6", "%xmm7"
             );
         }
+        IF_ARCH_X86(
+            static const float dyn_lerp_const[] __lsp_aligned32 =
+            {
+                1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f
+            };
+        )
+
+        /*
+         * The filter for the current step is computed from the state of interpolation
+         * (see generic/filters/lerp.h), work buffer layout:
+         *   base 0x000, step 0x0c0, filter 0x180, k 0x220, max k 0x240
+         * The index of sample is clamped for lanes that are out of the pipeline, so the
+         * coefficients of idle lanes never leave the range of interpolation.
+         */
+        #define DYN_LERP_X8_ROW(base, step, dst) \
+            __ASM_EMIT("vmulps          " step "(%[w]), %%ymm0, %%ymm2") \
+            __ASM_EMIT("vaddps          " base "(%[w]), %%ymm2, %%ymm2") \
+            __ASM_EMIT("vmulps          %%ymm4, %%ymm2, %%ymm2") \
+            __ASM_EMIT("vmovaps         %%ymm2, " dst "(%[w])")
+
+        #define DYN_LERP_X8_FILTER \
+            __ASM_EMIT("vmovaps         0x220(%[w]), %%ymm0")                           /* ymm0 = k */ \
+            __ASM_EMIT("vxorps          %%ymm3, %%ymm3, %%ymm3")                        /* ymm3 = 0 */ \
+            __ASM_EMIT("vaddps          %[ONE], %%ymm0, %%ymm2")                        /* ymm2 = k + 1 */ \
+            __ASM_EMIT("vmaxps          %%ymm3, %%ymm0, %%ymm0") \
+            __ASM_EMIT("vmovaps         %%ymm2, 0x220(%[w])") \
+            __ASM_EMIT("vminps          0x240(%[w]), %%ymm0, %%ymm0")                   /* ymm0 = clamped k */ \
+            __ASM_EMIT("vmulps          0x160(%[w]), %%ymm0, %%ymm3") \
+            __ASM_EMIT("vmovaps         %[ONE], %%ymm4") \
+            __ASM_EMIT("vaddps          0x0a0(%[w]), %%ymm3, %%ymm3")                   /* ymm3 = n */ \
+            __ASM_EMIT("vdivps          %%ymm3, %%ymm4, %%ymm4")                        /* ymm4 = 1/n */ \
+            DYN_LERP_X8_ROW("0x000", "0x0c0", "0x180")                                  /* b0 */ \
+            DYN_LERP_X8_ROW("0x020", "0x0e0", "0x1a0")                                  /* b1 */ \
+            DYN_LERP_X8_ROW("0x040", "0x100", "0x1c0")                                  /* b2 */ \
+            DYN_LERP_X8_ROW("0x060", "0x120", "0x1e0")                                  /* a1 */ \
+            DYN_LERP_X8_ROW("0x080", "0x140", "0x200")                                  /* a2 */
+
+        static void dyn_lerp_process_x8(float *dst, const float *src, float *d, size_t count, float *w)
+        {
+            IF_ARCH_X86(size_t mask);
+
+            for (size_t j=0; j<8; ++j)
+            {
+                w[0x88 + j]     = -float(j);
+                w[0x90 + j]     = float(count - 1);
+            }
+
+            ARCH_X86_ASM
+            (
+                // Check count
+                __ASM_EMIT64("test          %[count], %[count]")
+                __ASM_EMIT32("cmpl          $0, %[count]")
+                __ASM_EMIT("jz              8f")
+
+                // Initialize mask
+                // ymm0=tmp, ymm1={s,s2[8]}, ymm2=p1[8], ymm3=p2[8], ymm6=d0[8], ymm7=d1[8], ymm5=mask[8]
+                __ASM_EMIT("mov             $1, %[mask]")
+                __ASM_EMIT("vmovaps         %[X_MASK], %%ymm5")                             // ymm5     = m
+                __ASM_EMIT("vxorps          %%ymm1, %%ymm1, %%ymm1")                        // ymm1     = 0
+
+                // Load delay buffer
+                __ASM_EMIT("vmovups         0x00(%[d]), %%ymm6")                            // ymm6     = d0
+                __ASM_EMIT("vmovups         0x20(%[d]), %%ymm7")                            // ymm7     = d1
+
+                // Process first 7 steps
+                __ASM_EMIT("1:")
+                DYN_LERP_X8_FILTER
+                __ASM_EMIT("vmovss          (%[src]), %%xmm0")                              // xmm0     = *src
+                __ASM_EMIT("add             $4, %[src]")                                    // src      ++
+                __ASM_EMIT("vblendps        $0x01, %%ymm0, %%ymm1, %%ymm1")                 // ymm1     = s
+                __ASM_EMIT("vmulps          0x1a0(%[w]), %%ymm1, %%ymm2")                   // ymm2     = s*a1
+                __ASM_EMIT("vmulps          0x1c0(%[w]), %%ymm1, %%ymm3")                   // ymm3     = s*a2
+                __ASM_EMIT("vmulps          0x180(%[w]), %%ymm1, %%ymm1")                   // ymm1     = s*a0
+                __ASM_EMIT("vaddps          %%ymm6, %%ymm1, %%ymm1")                        // ymm1     = s*a0+d0 = s2
+                __ASM_EMIT("vmulps          0x1e0(%[w]), %%ymm1, %%ymm4")                   // ymm4     = s2*b1
+                __ASM_EMIT("vmulps          0x200(%[w]), %%ymm1, %%ymm0")                   // ymm0     = s2*b2
+                __ASM_EMIT("vaddps          %%ymm4, %%ymm2, %%ymm2")                        // ymm2     = s*a1 + s2*b1 = p1
+                __ASM_EMIT("vaddps          %%ymm0, %%ymm3, %%ymm3")                        // ymm3     = s*a2 + s2*b2 = p2
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm2, %%ymm2")                        // ymm2     = p1 + d1
+
+                // Update delay only by mask
+                __ASM_EMIT("vpermilps       $0x93, %%ymm1, %%ymm1")                         // ymm1     = s2[3] s2[0] s2[1] s2[2] s2[7] s2[4] s2[5] s2[6]
+                __ASM_EMIT("vblendvps       %%ymm5, %%ymm2, %%ymm6, %%ymm6")                // ymm6     = (p1 + d1) & MASK | (d0 & ~MASK)
+                __ASM_EMIT("vperm2f128      $0x01, %%ymm1, %%ymm1, %%ymm0")                 // ymm0     = s2[7] s2[4] s2[5] s2[6] s2[3] s2[0] s2[1] s2[2]
+                __ASM_EMIT("vblendvps       %%ymm5, %%ymm3, %%ymm7, %%ymm7")                // ymm7     = (p2 & MASK) | (d1 & ~MASK)
+                __ASM_EMIT("vblendps        $0x11, %%ymm0, %%ymm1, %%ymm1")                 // ymm1     = s2[7] s2[0] s2[1] s2[2] s2[3] s2[4] s2[5] s2[6]
+
+                // Repeat loop
+                __ASM_EMIT64("dec           %[count]")
+                __ASM_EMIT32("decl          %[count]")
+                __ASM_EMIT("jz              4f")                                            // jump to completion
+                __ASM_EMIT("lea             0x01(,%[mask], 2), %[mask]")                    // mask     = (mask << 1) | 1
+                __ASM_EMIT("vpermilps       $0x93, %%ymm5, %%ymm5")                         // ymm5     =  m[3]  m[0]  m[1]  m[2]  m[7]  m[4]  m[5]  m[6]
+                __ASM_EMIT("vperm2f128      $0x01, %%ymm5, %%ymm5, %%ymm3")                 // ymm3     =  m[7]  m[4]  m[5]  m[6]  m[3]  m[0]  m[1]  m[2]
+                __ASM_EMIT("vblendps        $0x11, %%ymm3, %%ymm5, %%ymm5")                 // ymm5     =  m[7]  m[0]  m[1]  m[2]  m[3]  m[4]  m[5]  m[6]
+                __ASM_EMIT("vorps           %[X_MASK], %%ymm5, %%ymm5")                     // ymm5     =  m[0]  m[0]  m[1]  m[2]  m[3]  m[4]  m[5]  m[6]
+                __ASM_EMIT("cmp             $0xff, %[mask]")
+                __ASM_EMIT("jne             1b")
+
+                // 8x filter processing without mask
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("3:")
+                DYN_LERP_X8_FILTER
+                __ASM_EMIT("vmovss          (%[src]), %%xmm0")                              // xmm0     = *src
+                __ASM_EMIT("add             $4, %[src]")                                    // src      ++
+                __ASM_EMIT("vblendps        $0x01, %%ymm0, %%ymm1, %%ymm1")                 // ymm1     = s
+                __ASM_EMIT("vmulps          0x1a0(%[w]), %%ymm1, %%ymm2")                   // ymm2     = s*a1
+                __ASM_EMIT("vmulps          0x1c0(%[w]), %%ymm1, %%ymm3")                   // ymm3     = s*a2
+                __ASM_EMIT("vmulps          0x180(%[w]), %%ymm1, %%ymm1")                   // ymm1     = s*a0
+                __ASM_EMIT("vaddps          %%ymm6, %%ymm1, %%ymm1")                        // ymm1     = s*a0+d0 = s2
+                __ASM_EMIT("vmulps          0x1e0(%[w]), %%ymm1, %%ymm4")                   // ymm4     = s2*b1
+                __ASM_EMIT("vmulps          0x200(%[w]), %%ymm1, %%ymm0")                   // ymm0     = s2*b2
+                __ASM_EMIT("vaddps          %%ymm4, %%ymm2, %%ymm2")                        // ymm2     = s*a1 + s2*b1 = p1
+                __ASM_EMIT("vpermilps       $0x93, %%ymm1, %%ymm1")                         // ymm1     = s2[3] s2[0] s2[1] s2[2] s2[7] s2[4] s2[5] s2[6]
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm2, %%ymm6")                        // ymm6     = p1 + d1
+                __ASM_EMIT("vaddps          %%ymm0, %%ymm3, %%ymm7")                        // ymm7     = s*a2 + s2*b2 = p2
+                __ASM_EMIT("vperm2f128      $0x01, %%ymm1, %%ymm1, %%ymm0")                 // ymm0     = s2[7] s2[4] s2[5] s2[6] s2[3] s2[0] s2[1] s2[2]
+                __ASM_EMIT("vblendps        $0x11, %%ymm0, %%ymm1, %%ymm1")                 // ymm1     = s2[7] s2[0] s2[1] s2[2] s2[3] s2[4] s2[5] s2[6]
+                __ASM_EMIT("vmovss          %%xmm1, (%[dst])")                              // *dst     = s2[7]
+
+                // Repeat loop
+                __ASM_EMIT("add             $4, %[dst]")                                    // dst      ++
+                __ASM_EMIT64("dec           %[count]")
+                __ASM_EMIT32("decl          %[count]")
+                __ASM_EMIT("jnz             3b")
+
+                // Prepare last loop, shift mask
+                __ASM_EMIT("4:")
+                __ASM_EMIT("vxorps          %%ymm2, %%ymm2, %%ymm2")                        // ymm2     =  0
+                __ASM_EMIT("vpermilps       $0x93, %%ymm5, %%ymm5")                         // ymm5     =  m[3]  m[0]  m[1]  m[2]  m[7]  m[4]  m[5]  m[6]
+                __ASM_EMIT("vinsertf128     $0x01, %%xmm5, %%ymm2, %%ymm2")                 // ymm2     =  0     0     0     0     m[3]  m[0]  m[1]  m[2]
+                __ASM_EMIT("vblendps        $0x11, %%ymm2, %%ymm5, %%ymm5")                 // ymm5     =  0     m[0]  m[1]  m[2]  m[3]  m[4]  m[5]  m[6]
+                __ASM_EMIT("shl             $1, %[mask]")                                   // mask     = mask << 1
+
+                // Process steps
+                __ASM_EMIT("5:")
+                DYN_LERP_X8_FILTER
+                __ASM_EMIT("vmulps          0x1a0(%[w]), %%ymm1, %%ymm2")                   // ymm2     = s*a1
+                __ASM_EMIT("vmulps          0x1c0(%[w]), %%ymm1, %%ymm3")                   // ymm3     = s*a2
+                __ASM_EMIT("vmulps          0x180(%[w]), %%ymm1, %%ymm1")                   // ymm1     = s*a0
+                __ASM_EMIT("vaddps          %%ymm6, %%ymm1, %%ymm1")                        // ymm1     = s*a0+d0 = s2
+                __ASM_EMIT("vmulps          0x1e0(%[w]), %%ymm1, %%ymm4")                   // ymm4     = s2*b1
+                __ASM_EMIT("vmulps          0x200(%[w]), %%ymm1, %%ymm0")                   // ymm0     = s2*b2
+                __ASM_EMIT("vaddps          %%ymm4, %%ymm2, %%ymm2")                        // ymm2     = s*a1 + s2*b1 = p1
+                __ASM_EMIT("vaddps          %%ymm0, %%ymm3, %%ymm3")                        // ymm3     = s*a2 + s2*b2 = p2
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm2, %%ymm2")                        // ymm2     = p1 + d1
+
+                // Update delay only by mask
+                __ASM_EMIT("vblendvps       %%ymm5, %%ymm2, %%ymm6, %%ymm6")                // ymm6     = (p1 + d1) & MASK | (d0 & ~MASK)
+                __ASM_EMIT("vblendvps       %%ymm5, %%ymm3, %%ymm7, %%ymm7")                // ymm7     = (p2 & MASK) | (d1 & ~MASK)
+
+                // Rotate buffer and mask
+                __ASM_EMIT("vpermilps       $0x93, %%ymm1, %%ymm1")                         // ymm1     = s2[3] s2[0] s2[1] s2[2] s2[7] s2[4] s2[5] s2[6]
+                __ASM_EMIT("vpermilps       $0x93, %%ymm5, %%ymm5")                         // ymm5     =  m[3]  m[0]  m[1]  m[2]  m[7]  m[4]  m[5]  m[6]
+                __ASM_EMIT("vperm2f128      $0x01, %%ymm1, %%ymm1, %%ymm0")                 // ymm0     = s2[7] s2[4] s2[5] s2[6] s2[3] s2[0] s2[1] s2[2]
+                __ASM_EMIT("vxorps          %%ymm2, %%ymm2, %%ymm2")                        // ymm2     =  0
+                __ASM_EMIT("vblendps        $0x11, %%ymm0, %%ymm1, %%ymm1")                 // ymm1     = s2[7] s2[0] s2[1] s2[2] s2[3] s2[4] s2[5] s2[6]
+                __ASM_EMIT("vinsertf128     $0x01, %%xmm5, %%ymm2, %%ymm2")                 // ymm2     =  0     0     0     0     m[3]  m[0]  m[1]  m[2]
+                __ASM_EMIT("vblendps        $0x11, %%ymm2, %%ymm5, %%ymm5")                 // ymm5     =  0     m[0]  m[1]  m[2]  m[3]  m[4]  m[5]  m[6]
+                __ASM_EMIT("test            $0x80, %[mask]")
+                __ASM_EMIT("jz              6f")
+                __ASM_EMIT("vmovss          %%xmm1, (%[dst])")                              // *dst     = s2[7]
+                __ASM_EMIT("add             $4, %[dst]")                                    // dst      ++
+                __ASM_EMIT("6:")
+
+                // Repeat loop
+                __ASM_EMIT("shl             $1, %[mask]")                                   // mask     = mask << 1
+                __ASM_EMIT("and             $0xff, %[mask]")                                // mask     = (mask << 1) & 0xff
+                __ASM_EMIT("jnz             5b")                                            // check that mask is not zero
+
+                // Store delay buffer
+                __ASM_EMIT("vmovups         %%ymm6, 0x00(%[d])")                            // *d0      = %%ymm6
+                __ASM_EMIT("vmovups         %%ymm7, 0x20(%[d])")                            // *d1      = %%ymm7
+
+                // Exit label
+                __ASM_EMIT("8:")
+
+                : [dst] "+r" (dst), [src] "+r" (src),
+                  [mask] "=&r"(mask),
+                  [count] X86_PGREG (count)
+                : [d] "r" (d), [w] "r" (w),
+                  [X_MASK] "m" (dyn_biquad_x8_mask),
+                  [ONE] "m" (dyn_lerp_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef DYN_LERP_X8_FILTER
+        #undef DYN_LERP_X8_ROW
+
+        void dyn_biquad_lerp_x8(float *dst, const float *src, float *d, size_t count,
+            const dsp::biquad_x8_t *f0, const dsp::biquad_x8_t *f1)
+        {
+            if (count <= 0)
+                return;
+
+            float w[0x98] __lsp_aligned32;
+            generic::dyn_lerp_biquad_init(w, f0->b0, f1->b0, 8, 8, count);
+            dyn_lerp_process_x8(dst, src, d, count, w);
+        }
+
+        void dyn_cascade_lerp_x8(float *dst, const float *src, float *d, size_t count,
+            const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf)
+        {
+            if (count <= 0)
+                return;
+
+            float w[0x98] __lsp_aligned32;
+            generic::dyn_lerp_cascade_init(w, c0, c1, kf, 8, count);
+            dyn_lerp_process_x8(dst, src, d, count, w);
+        }
 
     } /* namespace avx */
 } /* namespace lsp */
@@ -778,6 +778,193 @@ namespace lsp
                   "%xmm4", "%xmm5", "%xmm6", "%xmm7"
             );
         }
+
+        /*
+         * Transpose 4x4 matrices stored in 128-bit lanes of registers A, B, C, D,
+         * the transposed matrices are stored in registers C, D, A, T0
+         */
+        #define BIQUAD_MC_TRANSPOSE(A, B, C, D, T0, T1) \
+            __ASM_EMIT("vunpcklps           " B ", " A ", " T0)                     /* T0   = a0 b0 a1 b1 */ \
+            __ASM_EMIT("vunpckhps           " B ", " A ", " T1)                     /* T1   = a2 b2 a3 b3 */ \
+            __ASM_EMIT("vunpcklps           " D ", " C ", " A)                      /* A    = c0 d0 c1 d1 */ \
+            __ASM_EMIT("vunpckhps           " D ", " C ", " B)                      /* B    = c2 d2 c3 d3 */ \
+            __ASM_EMIT("vshufps             $0x44, " A ", " T0 ", " C)              /* C    = a0 b0 c0 d0 */ \
+            __ASM_EMIT("vshufps             $0xee, " A ", " T0 ", " D)              /* D    = a1 b1 c1 d1 */ \
+            __ASM_EMIT("vshufps             $0x44, " B ", " T1 ", " A)              /* A    = a2 b2 c2 d2 */ \
+            __ASM_EMIT("vshufps             $0xee, " B ", " T1 ", " T0)             /* T0   = a3 b3 c3 d3 */
+
+        /*
+         * Apply eight biquad filters to the sample of eight channels stored in register X,
+         * ymm6 and ymm7 contain filter memory, the p register points to the cascade,
+         * T is the temporary register
+         */
+        #define BIQUAD_MC_FILTER(X, T) \
+            __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[p]), " X ", " T)            /* T    = b0*s */ \
+            __ASM_EMIT("vaddps              %%ymm6, " T ", " T)                                             /* T    = s2 = b0*s + d0 */ \
+            __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[p]), " X ", %%ymm6")        /* ymm6 = b1*s */ \
+            __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[p]), " X ", " X)            /* X    = b2*s */ \
+            __ASM_EMIT("vaddps              %%ymm7, %%ymm6, %%ymm6")                                        /* ymm6 = d1 + b1*s */ \
+            __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x60(%[p]), " T ", %%ymm7")        /* ymm7 = a1*s2 */ \
+            __ASM_EMIT("vaddps              %%ymm7, %%ymm6, %%ymm6")                                        /* ymm6 = d0' = d1 + b1*s + a1*s2 */ \
+            __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x80(%[p]), " T ", %%ymm7")        /* ymm7 = a2*s2 */ \
+            __ASM_EMIT("vaddps              " X ", %%ymm7, %%ymm7")                                         /* ymm7 = d1' = b2*s + a2*s2 */ \
+            __ASM_EMIT("vmovaps             " T ", " X)                                                     /* X    = s2 */
+
+        #define BIQUAD_MC_FILTER_FMA3(X, T) \
+            __ASM_EMIT("vmovaps             %%ymm6, " T)                                                    /* T    = d0 */ \
+            __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[p]), " X ", " T)            /* T    = s2 = d0 + b0*s */ \
+            __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[p]), " X ", %%ymm7")        /* ymm7 = d1 + b1*s */ \
+            __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[p]), " X ", " X)            /* X    = b2*s */ \
+            __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x60(%[p]), " T ", %%ymm7")        /* ymm7 = d0' = d1 + b1*s + a1*s2 */ \
+            __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x80(%[p]), " T ", " X)            /* X    = d1' = b2*s + a2*s2 */ \
+            __ASM_EMIT("vmovaps             %%ymm7, %%ymm6")                                                /* ymm6 = d0' */ \
+            __ASM_EMIT("vmovaps             " X ", %%ymm7")                                                 /* ymm7 = d1' */ \
+            __ASM_EMIT("vmovaps             " T ", " X)                                                     /* X    = s2 */
+
+        /*
+         * Loop over cascades: the p register points to the current cascade, the filter
+         * memory of the cascade is loaded into ymm6 and ymm7 before processing the block
+         * of samples and stored back after it
+         */
+        #define BIQUAD_MC_CASCADE_BEGIN(L) \
+            __ASM_EMIT("mov                 %[f], %[p]") \
+            __ASM_EMIT(L ":") \
+            __ASM_EMIT("vmovups             0x00(%[p]), %%ymm6")                    /* ymm6 = d0 */ \
+            __ASM_EMIT("vmovups             0x20(%[p]), %%ymm7")                    /* ymm7 = d1 */
+
+        #define BIQUAD_MC_CASCADE_END(L) \
+            __ASM_EMIT("vmovups             %%ymm6, 0x00(%[p])") \
+            __ASM_EMIT("vmovups             %%ymm7, 0x20(%[p])") \
+            __ASM_EMIT("add                 %[FS], %[p]")                           /* p    = next cascade */ \
+            __ASM_EMIT("cmp                 %[fe], %[p]") \
+            __ASM_EMIT("jb                  " L "b")
+
+        #define BIQUAD_MC_PTR(idx)      __IF_32_64(#idx "*4", #idx "*8")
+
+        #define BIQUAD_MC_LOAD(A, B, X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(A) "(%[src]), %[p]") \
+            __ASM_EMIT("vmovups             (%[p], %[off]), %%xmm" X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(B) "(%[src]), %[p]") \
+            __ASM_EMIT("vinsertf128         $1, (%[p], %[off]), %%ymm" X ", %%ymm" X)
+
+        #define BIQUAD_MC_STORE(A, B, X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(A) "(%[dst]), %[p]") \
+            __ASM_EMIT("vmovups             %%xmm" X ", (%[p], %[off])") \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(B) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractf128        $1, %%ymm" X ", (%[p], %[off])")
+
+        #define BIQUAD_MC_LOAD1(A, B, C, D, X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(A) "(%[src]), %[p]") \
+            __ASM_EMIT("vmovss              (%[p], %[off]), %%xmm" X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(B) "(%[src]), %[p]") \
+            __ASM_EMIT("vinsertps           $0x10, (%[p], %[off]), %%xmm" X ", %%xmm" X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(C) "(%[src]), %[p]") \
+            __ASM_EMIT("vinsertps           $0x20, (%[p], %[off]), %%xmm" X ", %%xmm" X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(D) "(%[src]), %[p]") \
+            __ASM_EMIT("vinsertps           $0x30, (%[p], %[off]), %%xmm" X ", %%xmm" X)
+
+        #define BIQUAD_MC_STORE1(A, B, C, D, X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(A) "(%[dst]), %[p]") \
+            __ASM_EMIT("vmovss              %%xmm" X ", (%[p], %[off])") \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(B) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractps          $1, %%xmm" X ", (%[p], %[off])") \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(C) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractps          $2, %%xmm" X ", (%[p], %[off])") \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(D) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractps          $3, %%xmm" X ", (%[p], %[off])")
+
+        /*
+         * Each channel is processed in separate SIMD lane, four samples of each
+         * channel are transposed into four registers that contain one sample of
+         * eight channels, processed by all cascades and transposed back.
+         */
+        #define BIQUAD_MC8_BODY(FILTER) \
+            if (nc <= 0) \
+                return; \
+            IF_ARCH_X86( \
+                size_t off; \
+                const float *p; \
+                const dsp::biquad_t *fe = &f[nc]; \
+            ); \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("xor                 %[off], %[off]") \
+                /* 4x blocks */ \
+                __ASM_EMIT32("subl                $4, %[count]") \
+                __ASM_EMIT64("sub                 $4, %[count]") \
+                __ASM_EMIT("jb                  2f") \
+                __ASM_EMIT("1:") \
+                BIQUAD_MC_LOAD(0, 4, "0")                                               /* ymm0 = a0 a1 a2 a3 e0 e1 e2 e3 */ \
+                BIQUAD_MC_LOAD(1, 5, "1")                                               /* ymm1 = b0 b1 b2 b3 f0 f1 f2 f3 */ \
+                BIQUAD_MC_LOAD(2, 6, "2")                                               /* ymm2 = c0 c1 c2 c3 g0 g1 g2 g3 */ \
+                BIQUAD_MC_LOAD(3, 7, "3")                                               /* ymm3 = d0 d1 d2 d3 h0 h1 h2 h3 */ \
+                BIQUAD_MC_TRANSPOSE("%%ymm0", "%%ymm1", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5") \
+                BIQUAD_MC_CASCADE_BEGIN("5") \
+                FILTER("%%ymm2", "%%ymm1")                                              /* ymm2 = a0 b0 c0 d0 e0 f0 g0 h0 */ \
+                FILTER("%%ymm3", "%%ymm1")                                              /* ymm3 = a1 b1 c1 d1 e1 f1 g1 h1 */ \
+                FILTER("%%ymm0", "%%ymm1")                                              /* ymm0 = a2 b2 c2 d2 e2 f2 g2 h2 */ \
+                FILTER("%%ymm4", "%%ymm1")                                              /* ymm4 = a3 b3 c3 d3 e3 f3 g3 h3 */ \
+                BIQUAD_MC_CASCADE_END("5") \
+                BIQUAD_MC_TRANSPOSE("%%ymm2", "%%ymm3", "%%ymm0", "%%ymm4", "%%ymm1", "%%ymm5") \
+                BIQUAD_MC_STORE(0, 4, "0") \
+                BIQUAD_MC_STORE(1, 5, "4") \
+                BIQUAD_MC_STORE(2, 6, "2") \
+                BIQUAD_MC_STORE(3, 7, "1") \
+                __ASM_EMIT("add                 $0x10, %[off]") \
+                __ASM_EMIT32("subl                $4, %[count]") \
+                __ASM_EMIT64("sub                 $4, %[count]") \
+                __ASM_EMIT("jae                 1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT32("addl                $4, %[count]") \
+                __ASM_EMIT64("add                 $4, %[count]") \
+                __ASM_EMIT("jz                  4f") \
+                __ASM_EMIT("3:") \
+                BIQUAD_MC_LOAD1(0, 1, 2, 3, "0")                                        /* xmm0 = a b c d */ \
+                BIQUAD_MC_LOAD1(4, 5, 6, 7, "1")                                        /* xmm1 = e f g h */ \
+                __ASM_EMIT("vinsertf128         $1, %%xmm1, %%ymm0, %%ymm0")            /* ymm0 = a b c d e f g h */ \
+                BIQUAD_MC_CASCADE_BEGIN("6") \
+                FILTER("%%ymm0", "%%ymm1") \
+                BIQUAD_MC_CASCADE_END("6") \
+                __ASM_EMIT("vextractf128        $1, %%ymm0, %%xmm1") \
+                BIQUAD_MC_STORE1(0, 1, 2, 3, "0") \
+                BIQUAD_MC_STORE1(4, 5, 6, 7, "1") \
+                __ASM_EMIT("add                 $0x04, %[off]") \
+                __ASM_EMIT32("decl                %[count]") \
+                __ASM_EMIT64("dec                 %[count]") \
+                __ASM_EMIT("jnz                 3b") \
+                __ASM_EMIT("4:") \
+                : [count] __ASM_ARG_RW(count), \
+                  [off] "=&r" (off), [p] "=&r" (p) \
+                : [dst] "r" (dst), [src] "r" (src), \
+                  [f] "r" (f), [fe] "m" (fe), \
+                  [FS] "i" (sizeof(dsp::biquad_t)) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc)
+        {
+            BIQUAD_MC8_BODY(BIQUAD_MC_FILTER);
+        }
+
+        void biquad_process_mc8_fma3(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc)
+        {
+            BIQUAD_MC8_BODY(BIQUAD_MC_FILTER_FMA3);
+        }
+
+        #undef BIQUAD_MC8_BODY
+        #undef BIQUAD_MC_STORE1
+        #undef BIQUAD_MC_LOAD1
+        #undef BIQUAD_MC_STORE
+        #undef BIQUAD_MC_LOAD
+        #undef BIQUAD_MC_PTR
+        #undef BIQUAD_MC_CASCADE_END
+        #undef BIQUAD_MC_CASCADE_BEGIN
+        #undef BIQUAD_MC_FILTER_FMA3
+        #undef BIQUAD_MC_FILTER
+        #undef BIQUAD_MC_TRANSPOSE
     }
 }
 
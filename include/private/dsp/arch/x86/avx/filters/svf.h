@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FILTERS_SVF_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FILTERS_SVF_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+#include <private/dsp/arch/generic/filters/lerp.h>
+
+namespace lsp
+{
+    namespace avx
+    {
+        IF_ARCH_X86(
+            static const float svf_const[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(1.0f)
+            };
+        );
+
+        /*
+         * Transpose 4x4 matrices stored in 128-bit lanes of registers A, B, C, D,
+         * the transposed matrices are stored in registers C, D, A, T0
+         */
+        #define SVF_MC_TRANSPOSE(A, B, C, D, T0, T1) \
+            __ASM_EMIT("vunpcklps           " B ", " A ", " T0)                     /* T0   = a0 b0 a1 b1 */ \
+            __ASM_EMIT("vunpckhps           " B ", " A ", " T1)                     /* T1   = a2 b2 a3 b3 */ \
+            __ASM_EMIT("vunpcklps           " D ", " C ", " A)                      /* A    = c0 d0 c1 d1 */ \
+            __ASM_EMIT("vunpckhps           " D ", " C ", " B)                      /* B    = c2 d2 c3 d3 */ \
+            __ASM_EMIT("vshufps             $0x44, " A ", " T0 ", " C)              /* C    = a0 b0 c0 d0 */ \
+            __ASM_EMIT("vshufps             $0xee, " A ", " T0 ", " D)              /* D    = a1 b1 c1 d1 */ \
+            __ASM_EMIT("vshufps             $0x44, " B ", " T1 ", " A)              /* A    = a2 b2 c2 d2 */ \
+            __ASM_EMIT("vshufps             $0xee, " B ", " T1 ", " T0)             /* T0   = a3 b3 c3 d3 */
+
+        /*
+         * Apply eight state-variable filters to the sample of eight channels stored in register X,
+         * ymm6 and ymm7 contain filter memory ic1 and ic2, T1 and T2 are temporary registers.
+         * After the processing the f pointer is moved to the filter bank for the next sample
+         */
+        #define SVF_MC_FILTER(X, T1, T2) \
+            __ASM_EMIT("vmovups             0x00(%[f]), " T1)                                       /* T1   = g */ \
+            __ASM_EMIT("vaddps              0x20(%[f]), " T1 ", " T1)                               /* T1   = g + k */ \
+            __ASM_EMIT("vmulps              0x00(%[f]), " T1 ", " T1)                               /* T1   = g*(g + k) */ \
+            __ASM_EMIT("vaddps              %[ONE], " T1 ", " T1)                                   /* T1   = 1 + g*(g + k) */ \
+            __ASM_EMIT("vmovaps             %[ONE], " T2)                                           /* T2   = 1 */ \
+            __ASM_EMIT("vdivps              " T1 ", " T2 ", " T2)                                   /* T2   = a = 1/(1 + g*(g + k)) */ \
+            __ASM_EMIT("vsubps              %%ymm7, " X ", " T1)                                    /* T1   = x - ic2 */ \
+            __ASM_EMIT("vmulps              0x00(%[f]), " T1 ", " T1)                               /* T1   = g*(x - ic2) */ \
+            __ASM_EMIT("vaddps              %%ymm6, " T1 ", " T1)                                   /* T1   = ic1 + g*(x - ic2) */ \
+            __ASM_EMIT("vmulps              " T2 ", " T1 ", " T1)                                   /* T1   = v1 = a*(ic1 + g*(x - ic2)) */ \
+            __ASM_EMIT("vmulps              0x40(%[f]), " X ", " X)                                 /* X    = m0*x */ \
+            __ASM_EMIT("vmulps              0x60(%[f]), " T1 ", " T2)                               /* T2   = m1*v1 */ \
+            __ASM_EMIT("vaddps              " T2 ", " X ", " X)                                     /* X    = m0*x + m1*v1 */ \
+            __ASM_EMIT("vaddps              " T1 ", " T1 ", " T2)                                   /* T2   = 2*v1 */ \
+            __ASM_EMIT("vsubps              %%ymm6, " T2 ", %%ymm6")                                /* ymm6 = ic1' = 2*v1 - ic1 */ \
+            __ASM_EMIT("vmulps              0x00(%[f]), " T1 ", " T1)                               /* T1   = g*v1 */ \
+            __ASM_EMIT("vaddps              %%ymm7, " T1 ", " T1)                                   /* T1   = v2 = ic2 + g*v1 */ \
+            __ASM_EMIT("vmulps              0x80(%[f]), " T1 ", " T2)                               /* T2   = m2*v2 */ \
+            __ASM_EMIT("vaddps              " T2 ", " X ", " X)                                     /* X    = y = m0*x + m1*v1 + m2*v2 */ \
+            __ASM_EMIT("vaddps              " T1 ", " T1 ", " T1)                                   /* T1   = 2*v2 */ \
+            __ASM_EMIT("vsubps              %%ymm7, " T1 ", %%ymm7")                                /* ymm7 = ic2' = 2*v2 - ic2 */ \
+            __ASM_EMIT("add                 $0xa0, %[f]")
+
+        #define SVF_MC_FILTER_FMA3(X, T1, T2) \
+            __ASM_EMIT("vmovups             0x00(%[f]), " T1)                                       /* T1   = g */ \
+            __ASM_EMIT("vmovaps             %[ONE], " T2)                                           /* T2   = 1 */ \
+            __ASM_EMIT("vaddps              0x20(%[f]), " T1 ", " T1)                               /* T1   = g + k */ \
+            __ASM_EMIT("vfmadd132ps         0x00(%[f]), " T2 ", " T1)                               /* T1   = 1 + g*(g + k) */ \
+            __ASM_EMIT("vdivps              " T1 ", " T2 ", " T2)                                   /* T2   = a = 1/(1 + g*(g + k)) */ \
+            __ASM_EMIT("vsubps              %%ymm7, " X ", " T1)                                    /* T1   = x - ic2 */ \
+            __ASM_EMIT("vfmadd132ps         0x00(%[f]), %%ymm6, " T1)                               /* T1   = ic1 + g*(x - ic2) */ \
+            __ASM_EMIT("vmulps              " T2 ", " T1 ", " T1)                                   /* T1   = v1 = a*(ic1 + g*(x - ic2)) */ \
+            __ASM_EMIT("vmulps              0x40(%[f]), " X ", " X)                                 /* X    = m0*x */ \
+            __ASM_EMIT("vfmadd231ps         0x60(%[f]), " T1 ", " X)                                /* X    = m0*x + m1*v1 */ \
+            __ASM_EMIT("vaddps              " T1 ", " T1 ", " T2)                                   /* T2   = 2*v1 */ \
+            __ASM_EMIT("vsubps              %%ymm6, " T2 ", %%ymm6")                                /* ymm6 = ic1' = 2*v1 - ic1 */ \
+            __ASM_EMIT("vfmadd132ps         0x00(%[f]), %%ymm7, " T1)                               /* T1   = v2 = ic2 + g*v1 */ \
+            __ASM_EMIT("vfmadd231ps         0x80(%[f]), " T1 ", " X)                                /* X    = y = m0*x + m1*v1 + m2*v2 */ \
+            __ASM_EMIT("vaddps              " T1 ", " T1 ", " T1)                                   /* T1   = 2*v2 */ \
+            __ASM_EMIT("vsubps              %%ymm7, " T1 ", %%ymm7")                                /* ymm7 = ic2' = 2*v2 - ic2 */ \
+            __ASM_EMIT("add                 $0xa0, %[f]")
+
+        #define SVF_MC_PTR(idx)         __IF_32_64(#idx "*4", #idx "*8")
+
+        #define SVF_MC_LOAD(A, B, X) \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(A) "(%[src]), %[p]") \
+            __ASM_EMIT("vmovups             (%[p], %[off]), %%xmm" X) \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(B) "(%[src]), %[p]") \
+            __ASM_EMIT("vinsertf128         $1, (%[p], %[off]), %%ymm" X ", %%ymm" X)
+
+        #define SVF_MC_STORE(A, B, X) \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(A) "(%[dst]), %[p]") \
+            __ASM_EMIT("vmovups             %%xmm" X ", (%[p], %[off])") \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(B) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractf128        $1, %%ymm" X ", (%[p], %[off])")
+
+        #define SVF_MC_LOAD1(A, B, C, D, X) \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(A) "(%[src]), %[p]") \
+            __ASM_EMIT("vmovss              (%[p], %[off]), %%xmm" X) \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(B) "(%[src]), %[p]") \
+            __ASM_EMIT("vinsertps           $0x10, (%[p], %[off]), %%xmm" X ", %%xmm" X) \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(C) "(%[src]), %[p]") \
+            __ASM_EMIT("vinsertps           $0x20, (%[p], %[off]), %%xmm" X ", %%xmm" X) \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(D) "(%[src]), %[p]") \
+            __ASM_EMIT("vinsertps           $0x30, (%[p], %[off]), %%xmm" X ", %%xmm" X)
+
+        #define SVF_MC_STORE1(A, B, C, D, X) \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(A) "(%[dst]), %[p]") \
+            __ASM_EMIT("vmovss              %%xmm" X ", (%[p], %[off])") \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(B) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractps          $1, %%xmm" X ", (%[p], %[off])") \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(C) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractps          $2, %%xmm" X ", (%[p], %[off])") \
+            __ASM_EMIT("mov                 " SVF_MC_PTR(D) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractps          $3, %%xmm" X ", (%[p], %[off])")
+
+        /*
+         * Interpolated filters keep the state of interpolation (see generic/filters/lerp.h)
+         * in the work buffer, the filter banks for the next samples are computed into the
+         * slots of the work buffer right before processing, work buffer layout:
+         *   0x000: base (g, k, m0, m1, m2)
+         *   0x0a0: step (g, k, m0, m1, m2)
+         *   0x140: index of the next sample
+         *   0x160: four slots of filter banks, 0xa0 bytes each
+         */
+        #define SVF_LERP_SLOT(S) \
+            __ASM_EMIT("vmulps              0x0a0(%[p]), %%ymm0, %%ymm1") \
+            __ASM_EMIT("vmulps              0x0c0(%[p]), %%ymm0, %%ymm2") \
+            __ASM_EMIT("vmulps              0x0e0(%[p]), %%ymm0, %%ymm3") \
+            __ASM_EMIT("vmulps              0x100(%[p]), %%ymm0, %%ymm4") \
+            __ASM_EMIT("vmulps              0x120(%[p]), %%ymm0, %%ymm5") \
+            __ASM_EMIT("vaddps              0x000(%[p]), %%ymm1, %%ymm1")                           /* ymm1 = g    = g0 + dg*k */ \
+            __ASM_EMIT("vaddps              0x020(%[p]), %%ymm2, %%ymm2")                           /* ymm2 = k    = k0 + dk*k */ \
+            __ASM_EMIT("vaddps              0x040(%[p]), %%ymm3, %%ymm3")                           /* ymm3 = m0   = m00 + dm0*k */ \
+            __ASM_EMIT("vaddps              0x060(%[p]), %%ymm4, %%ymm4")                           /* ymm4 = m1   = m10 + dm1*k */ \
+            __ASM_EMIT("vaddps              0x080(%[p]), %%ymm5, %%ymm5")                           /* ymm5 = m2   = m20 + dm2*k */ \
+            __ASM_EMIT("vmovaps             %%ymm1, " S "+0x00(%[p])") \
+            __ASM_EMIT("vmovaps             %%ymm2, " S "+0x20(%[p])") \
+            __ASM_EMIT("vmovaps             %%ymm3, " S "+0x40(%[p])") \
+            __ASM_EMIT("vmovaps             %%ymm4, " S "+0x60(%[p])") \
+            __ASM_EMIT("vmovaps             %%ymm5, " S "+0x80(%[p])") \
+            __ASM_EMIT("vaddps              %[ONE], %%ymm0, %%ymm0")                                /* ymm0 = k + 1 */
+
+        #define SVF_LERP_GEN4 \
+            __ASM_EMIT("mov                 %[w], %[p]") \
+            __ASM_EMIT("vmovaps             0x140(%[p]), %%ymm0")                                   /* ymm0 = k */ \
+            SVF_LERP_SLOT("0x160") \
+            SVF_LERP_SLOT("0x200") \
+            SVF_LERP_SLOT("0x2a0") \
+            SVF_LERP_SLOT("0x340") \
+            __ASM_EMIT("vmovaps             %%ymm0, 0x140(%[p])") \
+            __ASM_EMIT("lea                 0x160(%[p]), %[f]")
+
+        #define SVF_LERP_GEN1 \
+            __ASM_EMIT("mov                 %[w], %[p]") \
+            __ASM_EMIT("vmovaps             0x140(%[p]), %%ymm0")                                   /* ymm0 = k */ \
+            SVF_LERP_SLOT("0x160") \
+            __ASM_EMIT("vmovaps             %%ymm0, 0x140(%[p])") \
+            __ASM_EMIT("lea                 0x160(%[p]), %[f]")
+
+        #define SVF_PROCESS_GEN
+
+        /*
+         * Each channel is processed in separate SIMD lane, four samples of each
+         * channel are transposed into four registers that contain one sample of
+         * eight channels, processed and transposed back. GEN4 and GEN1 compute
+         * filter banks for the next four samples and for the next sample, W is
+         * the work buffer of interpolated filters.
+         */
+        #define SVF_MC8_BODY(FILTER, GEN4, GEN1, W) \
+            IF_ARCH_X86( \
+                size_t off; \
+                const float *p; \
+            ); \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("mov                 %[d], %[p]") \
+                __ASM_EMIT("vmovups             0x00(%[p]), %%ymm6")                    /* ymm6 = ic1 */ \
+                __ASM_EMIT("vmovups             0x20(%[p]), %%ymm7")                    /* ymm7 = ic2 */ \
+                __ASM_EMIT("xor                 %[off], %[off]") \
+                /* 4x blocks */ \
+                __ASM_EMIT32("subl                $4, %[count]") \
+                __ASM_EMIT64("sub                 $4, %[count]") \
+                __ASM_EMIT("jb                  2f") \
+                __ASM_EMIT("1:") \
+                GEN4 \
+                SVF_MC_LOAD(0, 4, "0")                                                  /* ymm0 = a0 a1 a2 a3 e0 e1 e2 e3 */ \
+                SVF_MC_LOAD(1, 5, "1")                                                  /* ymm1 = b0 b1 b2 b3 f0 f1 f2 f3 */ \
+                SVF_MC_LOAD(2, 6, "2")                                                  /* ymm2 = c0 c1 c2 c3 g0 g1 g2 g3 */ \
+                SVF_MC_LOAD(3, 7, "3")                                                  /* ymm3 = d0 d1 d2 d3 h0 h1 h2 h3 */ \
+                SVF_MC_TRANSPOSE("%%ymm0", "%%ymm1", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5") \
+                FILTER("%%ymm2", "%%ymm1", "%%ymm5")                                    /* ymm2 = a0 b0 c0 d0 e0 f0 g0 h0 */ \
+                FILTER("%%ymm3", "%%ymm1", "%%ymm5")                                    /* ymm3 = a1 b1 c1 d1 e1 f1 g1 h1 */ \
+                FILTER("%%ymm0", "%%ymm1", "%%ymm5")                                    /* ymm0 = a2 b2 c2 d2 e2 f2 g2 h2 */ \
+                FILTER("%%ymm4", "%%ymm1", "%%ymm5")                                    /* ymm4 = a3 b3 c3 d3 e3 f3 g3 h3 */ \
+                SVF_MC_TRANSPOSE("%%ymm2", "%%ymm3", "%%ymm0", "%%ymm4", "%%ymm1", "%%ymm5") \
+                SVF_MC_STORE(0, 4, "0") \
+                SVF_MC_STORE(1, 5, "4") \
+                SVF_MC_STORE(2, 6, "2") \
+                SVF_MC_STORE(3, 7, "1") \
+                __ASM_EMIT("add                 $0x10, %[off]") \
+                __ASM_EMIT32("subl                $4, %[count]") \
+                __ASM_EMIT64("sub                 $4, %[count]") \
+                __ASM_EMIT("jae                 1b") \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT32("addl                $4, %[count]") \
+                __ASM_EMIT64("add                 $4, %[count]") \
+                __ASM_EMIT("jz                  4f") \
+                __ASM_EMIT("3:") \
+                GEN1 \
+                SVF_MC_LOAD1(0, 1, 2, 3, "0")                                           /* xmm0 = a b c d */ \
+                SVF_MC_LOAD1(4, 5, 6, 7, "1")                                           /* xmm1 = e f g h */ \
+                __ASM_EMIT("vinsertf128         $1, %%xmm1, %%ymm0, %%ymm0")            /* ymm0 = a b c d e f g h */ \
+                FILTER("%%ymm0", "%%ymm1", "%%ymm5") \
+                __ASM_EMIT("vextractf128        $1, %%ymm0, %%xmm1") \
+                SVF_MC_STORE1(0, 1, 2, 3, "0") \
+                SVF_MC_STORE1(4, 5, 6, 7, "1") \
+                __ASM_EMIT("add                 $0x04, %[off]") \
+                __ASM_EMIT32("decl                %[count]") \
+                __ASM_EMIT64("dec                 %[count]") \
+                __ASM_EMIT("jnz                 3b") \
+                /* Store the updated filter memory */ \
+                __ASM_EMIT("4:") \
+                __ASM_EMIT("mov                 %[d], %[p]") \
+                __ASM_EMIT("vmovups             %%ymm6, 0x00(%[p])") \
+                __ASM_EMIT("vmovups             %%ymm7, 0x20(%[p])") \
+                : [count] __ASM_ARG_RW(count), [f] "+r" (f), \
+                  [off] "=&r" (off), [p] "=&r" (p) \
+                : [dst] "r" (dst), [src] "r" (src), \
+                  [d] "m" (d), [w] "m" (W), \
+                  [ONE] "m" (svf_const) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f)
+        {
+            SVF_MC8_BODY(SVF_MC_FILTER, SVF_PROCESS_GEN, SVF_PROCESS_GEN, f);
+        }
+
+        void svf_process_x8_fma3(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f)
+        {
+            SVF_MC8_BODY(SVF_MC_FILTER_FMA3, SVF_PROCESS_GEN, SVF_PROCESS_GEN, f);
+        }
+
+        #define SVF_LERP_BODY(FILTER) \
+            if (count <= 0) \
+                return; \
+            \
+            float buf[0xf8] __lsp_aligned32; \
+            float *w        = buf; \
+            generic::svf_lerp_init(w, f0->g, f1->g, 8, 8, count); \
+            for (size_t i=0x50; i<0x58; ++i) \
+                w[i]    = 0.0f; \
+            \
+            const float *f = w; \
+            SVF_MC8_BODY(FILTER, SVF_LERP_GEN4, SVF_LERP_GEN1, w);
+
+        void svf_lerp_x8(float * const *dst, const float * const *src, float *d, size_t count,
+            const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1)
+        {
+            SVF_LERP_BODY(SVF_MC_FILTER);
+        }
+
+        void svf_lerp_x8_fma3(float * const *dst, const float * const *src, float *d, size_t count,
+            const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1)
+        {
+            SVF_LERP_BODY(SVF_MC_FILTER_FMA3);
+        }
+
+        #undef SVF_LERP_BODY
+        #undef SVF_MC8_BODY
+        #undef SVF_PROCESS_GEN
+        #undef SVF_LERP_GEN1
+        #undef SVF_LERP_GEN4
+        #undef SVF_LERP_SLOT
+        #undef SVF_MC_STORE1
+        #undef SVF_MC_LOAD1
+        #undef SVF_MC_STORE
+        #undef SVF_MC_LOAD
+        #undef SVF_MC_PTR
+        #undef SVF_MC_FILTER_FMA3
+        #undef SVF_MC_FILTER
+        #undef SVF_MC_TRANSPOSE
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FILTERS_SVF_H_ */
@@ -0,0 +1,754 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FIR_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FIR_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        #define FMA_OFF(a, b)       a
+        #define FMA_ON(a, b)        b
+
+        #define FIR_DIRECT_CORE(SEL) \
+            /* 32x blocks */ \
+            __ASM_EMIT("sub             $32, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = s0 */ \
+            __ASM_EMIT("vxorps          %%ymm1, %%ymm1, %%ymm1")                    /* ymm1 = s1 */ \
+            __ASM_EMIT("vxorps          %%ymm2, %%ymm2, %%ymm2")                    /* ymm2 = s2 */ \
+            __ASM_EMIT("vxorps          %%ymm3, %%ymm3, %%ymm3")                    /* ymm3 = s3 */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("11:") \
+            __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%ymm4")             /* ymm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src], %[off]), %%ymm4, %%ymm5", "vfmadd231ps 0x00(%[src], %[off]), %%ymm4, %%ymm0"))  /* ymm0 = s0 + t*x0 */ \
+            __ASM_EMIT(SEL("vmulps      0x20(%[src], %[off]), %%ymm4, %%ymm6", "vfmadd231ps 0x20(%[src], %[off]), %%ymm4, %%ymm1"))  /* ymm1 = s1 + t*x1 */ \
+            __ASM_EMIT(SEL("vmulps      0x40(%[src], %[off]), %%ymm4, %%ymm7", "vfmadd231ps 0x40(%[src], %[off]), %%ymm4, %%ymm2"))  /* ymm2 = s2 + t*x2 */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm0, %%ymm0", "vfmadd231ps 0x60(%[src], %[off]), %%ymm4, %%ymm3"))               /* ymm3 = s3 + t*x3 */ \
+            __ASM_EMIT(SEL("vmulps      0x60(%[src], %[off]), %%ymm4, %%ymm5", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm6, %%ymm1, %%ymm1", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm7, %%ymm2, %%ymm2", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm3, %%ymm3", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              11b") \
+            __ASM_EMIT32("mov           %[dst], %[off]") \
+            __ASM_EMIT32("vmovups       %%ymm0, 0x00(%[off])") \
+            __ASM_EMIT32("vmovups       %%ymm1, 0x20(%[off])") \
+            __ASM_EMIT32("vmovups       %%ymm2, 0x40(%[off])") \
+            __ASM_EMIT32("vmovups       %%ymm3, 0x60(%[off])") \
+            __ASM_EMIT32("addl          $0x80, %[dst]") \
+            __ASM_EMIT64("vmovups       %%ymm0, 0x00(%[dst])") \
+            __ASM_EMIT64("vmovups       %%ymm1, 0x20(%[dst])") \
+            __ASM_EMIT64("vmovups       %%ymm2, 0x40(%[dst])") \
+            __ASM_EMIT64("vmovups       %%ymm3, 0x60(%[dst])") \
+            __ASM_EMIT64("add           $0x80, %[dst]") \
+            __ASM_EMIT("add             $0x80, %[src]") \
+            __ASM_EMIT("sub             $32, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            __ASM_EMIT("2:") \
+            /* 8x blocks */ \
+            __ASM_EMIT("add             $24, %[count]") \
+            __ASM_EMIT("jl              4f") \
+            __ASM_EMIT("3:") \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = s0 */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("31:") \
+            __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%ymm4")             /* ymm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src], %[off]), %%ymm4, %%ymm5", "vfmadd231ps 0x00(%[src], %[off]), %%ymm4, %%ymm0"))  /* ymm0 = s0 + t*x0 */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm0, %%ymm0", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              31b") \
+            __ASM_EMIT32("mov           %[dst], %[off]") \
+            __ASM_EMIT32("vmovups       %%ymm0, 0x00(%[off])") \
+            __ASM_EMIT32("addl          $0x20, %[dst]") \
+            __ASM_EMIT64("vmovups       %%ymm0, 0x00(%[dst])") \
+            __ASM_EMIT64("add           $0x20, %[dst]") \
+            __ASM_EMIT("add             $0x20, %[src]") \
+            __ASM_EMIT("sub             $8, %[count]") \
+            __ASM_EMIT("jge             3b") \
+            __ASM_EMIT("4:") \
+            /* 4x block */ \
+            __ASM_EMIT("add             $4, %[count]") \
+            __ASM_EMIT("jl              6f") \
+            __ASM_EMIT("vxorps          %%xmm0, %%xmm0, %%xmm0")                    /* xmm0 = s0 */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("51:") \
+            __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%xmm4")             /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src], %[off]), %%xmm4, %%xmm5", "vfmadd231ps 0x00(%[src], %[off]), %%xmm4, %%xmm0"))  /* xmm0 = s0 + t*x0 */ \
+            __ASM_EMIT(SEL("vaddps      %%xmm5, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              51b") \
+            __ASM_EMIT32("mov           %[dst], %[off]") \
+            __ASM_EMIT32("vmovups       %%xmm0, 0x00(%[off])") \
+            __ASM_EMIT32("addl          $0x10, %[dst]") \
+            __ASM_EMIT64("vmovups       %%xmm0, 0x00(%[dst])") \
+            __ASM_EMIT64("add           $0x10, %[dst]") \
+            __ASM_EMIT("add             $0x10, %[src]") \
+            __ASM_EMIT("sub             $4, %[count]") \
+            __ASM_EMIT("6:") \
+            /* 1x blocks */ \
+            __ASM_EMIT("add             $3, %[count]") \
+            __ASM_EMIT("jl              8f") \
+            __ASM_EMIT("7:") \
+            __ASM_EMIT("vxorps          %%xmm0, %%xmm0, %%xmm0")                    /* xmm0 = s */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("71:") \
+            __ASM_EMIT("vmovss          0x00(%[taps], %[off]), %%xmm4")             /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulss      0x00(%[src], %[off]), %%xmm4, %%xmm5", "vfmadd231ss 0x00(%[src], %[off]), %%xmm4, %%xmm0"))  /* xmm0 = s + t*x */ \
+            __ASM_EMIT(SEL("vaddss      %%xmm5, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              71b") \
+            __ASM_EMIT32("mov           %[dst], %[off]") \
+            __ASM_EMIT32("vmovss        %%xmm0, 0x00(%[off])") \
+            __ASM_EMIT32("addl          $0x04, %[dst]") \
+            __ASM_EMIT64("vmovss        %%xmm0, 0x00(%[dst])") \
+            __ASM_EMIT64("add           $0x04, %[dst]") \
+            __ASM_EMIT("add             $0x04, %[src]") \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jge             7b") \
+            __ASM_EMIT("8:")
+
+        #define FIR_DIRECT_X2_CORE(SEL) \
+            /* 16x blocks */ \
+            __ASM_EMIT("sub             $16, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = a0 */ \
+            __ASM_EMIT("vxorps          %%ymm1, %%ymm1, %%ymm1")                    /* ymm1 = a1 */ \
+            __ASM_EMIT("vxorps          %%ymm2, %%ymm2, %%ymm2")                    /* ymm2 = b0 */ \
+            __ASM_EMIT("vxorps          %%ymm3, %%ymm3, %%ymm3")                    /* ymm3 = b1 */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("11:") \
+            __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%ymm4")             /* ymm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src1], %[off]), %%ymm4, %%ymm5", "vfmadd231ps 0x00(%[src1], %[off]), %%ymm4, %%ymm0"))    /* ymm0 = a0 + t*x0 */ \
+            __ASM_EMIT(SEL("vmulps      0x20(%[src1], %[off]), %%ymm4, %%ymm6", "vfmadd231ps 0x20(%[src1], %[off]), %%ymm4, %%ymm1"))    /* ymm1 = a1 + t*x1 */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src2], %[off]), %%ymm4, %%ymm7", "vfmadd231ps 0x00(%[src2], %[off]), %%ymm4, %%ymm2"))    /* ymm2 = b0 + t*y0 */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm0, %%ymm0", "vfmadd231ps 0x20(%[src2], %[off]), %%ymm4, %%ymm3"))                   /* ymm3 = b1 + t*y1 */ \
+            __ASM_EMIT(SEL("vmulps      0x20(%[src2], %[off]), %%ymm4, %%ymm5", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm6, %%ymm1, %%ymm1", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm7, %%ymm2, %%ymm2", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm3, %%ymm3", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              11b") \
+            __ASM_EMIT32("mov           %[dst1], %[off]") \
+            __ASM_EMIT32("vmovups       %%ymm0, 0x00(%[off])") \
+            __ASM_EMIT32("vmovups       %%ymm1, 0x20(%[off])") \
+            __ASM_EMIT32("mov           %[dst2], %[off]") \
+            __ASM_EMIT32("vmovups       %%ymm2, 0x00(%[off])") \
+            __ASM_EMIT32("vmovups       %%ymm3, 0x20(%[off])") \
+            __ASM_EMIT32("addl          $0x40, %[dst1]") \
+            __ASM_EMIT32("addl          $0x40, %[dst2]") \
+            __ASM_EMIT64("vmovups       %%ymm0, 0x00(%[dst1])") \
+            __ASM_EMIT64("vmovups       %%ymm1, 0x20(%[dst1])") \
+            __ASM_EMIT64("vmovups       %%ymm2, 0x00(%[dst2])") \
+            __ASM_EMIT64("vmovups       %%ymm3, 0x20(%[dst2])") \
+            __ASM_EMIT64("add           $0x40, %[dst1]") \
+            __ASM_EMIT64("add           $0x40, %[dst2]") \
+            __ASM_EMIT("add             $0x40, %[src1]") \
+            __ASM_EMIT("add             $0x40, %[src2]") \
+            __ASM_EMIT("sub             $16, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            __ASM_EMIT("2:") \
+            /* 8x block */ \
+            __ASM_EMIT("add             $8, %[count]") \
+            __ASM_EMIT("jl              4f") \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = a0 */ \
+            __ASM_EMIT("vxorps          %%ymm2, %%ymm2, %%ymm2")                    /* ymm2 = b0 */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("31:") \
+            __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%ymm4")             /* ymm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src1], %[off]), %%ymm4, %%ymm5", "vfmadd231ps 0x00(%[src1], %[off]), %%ymm4, %%ymm0"))    /* ymm0 = a0 + t*x0 */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src2], %[off]), %%ymm4, %%ymm7", "vfmadd231ps 0x00(%[src2], %[off]), %%ymm4, %%ymm2"))    /* ymm2 = b0 + t*y0 */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm0, %%ymm0", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm7, %%ymm2, %%ymm2", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              31b") \
+            __ASM_EMIT32("mov           %[dst1], %[off]") \
+            __ASM_EMIT32("vmovups       %%ymm0, 0x00(%[off])") \
+            __ASM_EMIT32("mov           %[dst2], %[off]") \
+            __ASM_EMIT32("vmovups       %%ymm2, 0x00(%[off])") \
+            __ASM_EMIT32("addl          $0x20, %[dst1]") \
+            __ASM_EMIT32("addl          $0x20, %[dst2]") \
+            __ASM_EMIT64("vmovups       %%ymm0, 0x00(%[dst1])") \
+            __ASM_EMIT64("vmovups       %%ymm2, 0x00(%[dst2])") \
+            __ASM_EMIT64("add           $0x20, %[dst1]") \
+            __ASM_EMIT64("add           $0x20, %[dst2]") \
+            __ASM_EMIT("add             $0x20, %[src1]") \
+            __ASM_EMIT("add             $0x20, %[src2]") \
+            __ASM_EMIT("sub             $8, %[count]") \
+            __ASM_EMIT("4:") \
+            /* 4x block */ \
+            __ASM_EMIT("add             $4, %[count]") \
+            __ASM_EMIT("jl              6f") \
+            __ASM_EMIT("vxorps          %%xmm0, %%xmm0, %%xmm0")                    /* xmm0 = a0 */ \
+            __ASM_EMIT("vxorps          %%xmm2, %%xmm2, %%xmm2")                    /* xmm2 = b0 */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("51:") \
+            __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%xmm4")             /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src1], %[off]), %%xmm4, %%xmm5", "vfmadd231ps 0x00(%[src1], %[off]), %%xmm4, %%xmm0"))    /* xmm0 = a0 + t*x0 */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src2], %[off]), %%xmm4, %%xmm7", "vfmadd231ps 0x00(%[src2], %[off]), %%xmm4, %%xmm2"))    /* xmm2 = b0 + t*y0 */ \
+            __ASM_EMIT(SEL("vaddps      %%xmm5, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT(SEL("vaddps      %%xmm7, %%xmm2, %%xmm2", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              51b") \
+            __ASM_EMIT32("mov           %[dst1], %[off]") \
+            __ASM_EMIT32("vmovups       %%xmm0, 0x00(%[off])") \
+            __ASM_EMIT32("mov           %[dst2], %[off]") \
+            __ASM_EMIT32("vmovups       %%xmm2, 0x00(%[off])") \
+            __ASM_EMIT32("addl          $0x10, %[dst1]") \
+            __ASM_EMIT32("addl          $0x10, %[dst2]") \
+            __ASM_EMIT64("vmovups       %%xmm0, 0x00(%[dst1])") \
+            __ASM_EMIT64("vmovups       %%xmm2, 0x00(%[dst2])") \
+            __ASM_EMIT64("add           $0x10, %[dst1]") \
+            __ASM_EMIT64("add           $0x10, %[dst2]") \
+            __ASM_EMIT("add             $0x10, %[src1]") \
+            __ASM_EMIT("add             $0x10, %[src2]") \
+            __ASM_EMIT("sub             $4, %[count]") \
+            __ASM_EMIT("6:") \
+            /* 1x blocks */ \
+            __ASM_EMIT("add             $3, %[count]") \
+            __ASM_EMIT("jl              8f") \
+            __ASM_EMIT("7:") \
+            __ASM_EMIT("vxorps          %%xmm0, %%xmm0, %%xmm0")                    /* xmm0 = a */ \
+            __ASM_EMIT("vxorps          %%xmm2, %%xmm2, %%xmm2")                    /* xmm2 = b */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("71:") \
+            __ASM_EMIT("vmovss          0x00(%[taps], %[off]), %%xmm4")             /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulss      0x00(%[src1], %[off]), %%xmm4, %%xmm5", "vfmadd231ss 0x00(%[src1], %[off]), %%xmm4, %%xmm0"))    /* xmm0 = a + t*x */ \
+            __ASM_EMIT(SEL("vmulss      0x00(%[src2], %[off]), %%xmm4, %%xmm7", "vfmadd231ss 0x00(%[src2], %[off]), %%xmm4, %%xmm2"))    /* xmm2 = b + t*y */ \
+            __ASM_EMIT(SEL("vaddss      %%xmm5, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT(SEL("vaddss      %%xmm7, %%xmm2, %%xmm2", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              71b") \
+            __ASM_EMIT32("mov           %[dst1], %[off]") \
+            __ASM_EMIT32("vmovss        %%xmm0, 0x00(%[off])") \
+            __ASM_EMIT32("mov           %[dst2], %[off]") \
+            __ASM_EMIT32("vmovss        %%xmm2, 0x00(%[off])") \
+            __ASM_EMIT32("addl          $0x04, %[dst1]") \
+            __ASM_EMIT32("addl          $0x04, %[dst2]") \
+            __ASM_EMIT64("vmovss        %%xmm0, 0x00(%[dst1])") \
+            __ASM_EMIT64("vmovss        %%xmm2, 0x00(%[dst2])") \
+            __ASM_EMIT64("add           $0x04, %[dst1]") \
+            __ASM_EMIT64("add           $0x04, %[dst2]") \
+            __ASM_EMIT("add             $0x04, %[src1]") \
+            __ASM_EMIT("add             $0x04, %[src2]") \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jge             7b") \
+            __ASM_EMIT("8:")
+
+        #define FIR_STORE_STRIDED(x) \
+            __ASM_EMIT("vmovss          %%" x ", 0x00(%[off])") \
+            __ASM_EMIT("vshufps         $0x39, %%" x ", %%" x ", %%" x) \
+            __ASM_EMIT("add             %[stride], %[off]") \
+            __ASM_EMIT("vmovss          %%" x ", 0x00(%[off])") \
+            __ASM_EMIT("vshufps         $0x39, %%" x ", %%" x ", %%" x) \
+            __ASM_EMIT("add             %[stride], %[off]") \
+            __ASM_EMIT("vmovss          %%" x ", 0x00(%[off])") \
+            __ASM_EMIT("vshufps         $0x39, %%" x ", %%" x ", %%" x) \
+            __ASM_EMIT("add             %[stride], %[off]") \
+            __ASM_EMIT("vmovss          %%" x ", 0x00(%[off])") \
+            __ASM_EMIT("add             %[stride], %[off]")
+
+        #define FIR_STORE_STRIDED_Y(n) \
+            __ASM_EMIT("vextractf128    $1, %%ymm" n ", %%xmm5") \
+            FIR_STORE_STRIDED("xmm" n) \
+            FIR_STORE_STRIDED("xmm5")
+
+        #define FIR_INTERPOLATE_CORE(SEL) \
+            /* 32x blocks */ \
+            __ASM_EMIT("sub             $32, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = s0 */ \
+            __ASM_EMIT("vxorps          %%ymm1, %%ymm1, %%ymm1")                    /* ymm1 = s1 */ \
+            __ASM_EMIT("vxorps          %%ymm2, %%ymm2, %%ymm2")                    /* ymm2 = s2 */ \
+            __ASM_EMIT("vxorps          %%ymm3, %%ymm3, %%ymm3")                    /* ymm3 = s3 */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("11:") \
+            __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%ymm4")             /* ymm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src], %[off]), %%ymm4, %%ymm5", "vfmadd231ps 0x00(%[src], %[off]), %%ymm4, %%ymm0"))  /* ymm0 = s0 + t*x0 */ \
+            __ASM_EMIT(SEL("vmulps      0x20(%[src], %[off]), %%ymm4, %%ymm6", "vfmadd231ps 0x20(%[src], %[off]), %%ymm4, %%ymm1"))  /* ymm1 = s1 + t*x1 */ \
+            __ASM_EMIT(SEL("vmulps      0x40(%[src], %[off]), %%ymm4, %%ymm7", "vfmadd231ps 0x40(%[src], %[off]), %%ymm4, %%ymm2"))  /* ymm2 = s2 + t*x2 */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm0, %%ymm0", "vfmadd231ps 0x60(%[src], %[off]), %%ymm4, %%ymm3"))               /* ymm3 = s3 + t*x3 */ \
+            __ASM_EMIT(SEL("vmulps      0x60(%[src], %[off]), %%ymm4, %%ymm5", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm6, %%ymm1, %%ymm1", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm7, %%ymm2, %%ymm2", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm3, %%ymm3", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              11b") \
+            __ASM_EMIT("mov             %[dst], %[off]") \
+            FIR_STORE_STRIDED_Y("0") \
+            FIR_STORE_STRIDED_Y("1") \
+            FIR_STORE_STRIDED_Y("2") \
+            FIR_STORE_STRIDED_Y("3") \
+            __ASM_EMIT("mov             %[off], %[dst]") \
+            __ASM_EMIT("add             $0x80, %[src]") \
+            __ASM_EMIT("sub             $32, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            __ASM_EMIT("2:") \
+            /* 8x blocks */ \
+            __ASM_EMIT("add             $24, %[count]") \
+            __ASM_EMIT("jl              4f") \
+            __ASM_EMIT("3:") \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = s0 */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("31:") \
+            __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%ymm4")             /* ymm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src], %[off]), %%ymm4, %%ymm5", "vfmadd231ps 0x00(%[src], %[off]), %%ymm4, %%ymm0"))  /* ymm0 = s0 + t*x0 */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm0, %%ymm0", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              31b") \
+            __ASM_EMIT("mov             %[dst], %[off]") \
+            FIR_STORE_STRIDED_Y("0") \
+            __ASM_EMIT("mov             %[off], %[dst]") \
+            __ASM_EMIT("add             $0x20, %[src]") \
+            __ASM_EMIT("sub             $8, %[count]") \
+            __ASM_EMIT("jge             3b") \
+            __ASM_EMIT("4:") \
+            /* 4x block */ \
+            __ASM_EMIT("add             $4, %[count]") \
+            __ASM_EMIT("jl              6f") \
+            __ASM_EMIT("vxorps          %%xmm0, %%xmm0, %%xmm0")                    /* xmm0 = s0 */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("51:") \
+            __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%xmm4")             /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[src], %[off]), %%xmm4, %%xmm5", "vfmadd231ps 0x00(%[src], %[off]), %%xmm4, %%xmm0"))  /* xmm0 = s0 + t*x0 */ \
+            __ASM_EMIT(SEL("vaddps      %%xmm5, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              51b") \
+            __ASM_EMIT("mov             %[dst], %[off]") \
+            FIR_STORE_STRIDED("xmm0") \
+            __ASM_EMIT("mov             %[off], %[dst]") \
+            __ASM_EMIT("add             $0x10, %[src]") \
+            __ASM_EMIT("sub             $4, %[count]") \
+            __ASM_EMIT("6:") \
+            /* 1x blocks */ \
+            __ASM_EMIT("add             $3, %[count]") \
+            __ASM_EMIT("jl              8f") \
+            __ASM_EMIT("7:") \
+            __ASM_EMIT("vxorps          %%xmm0, %%xmm0, %%xmm0")                    /* xmm0 = s */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("71:") \
+            __ASM_EMIT("vmovss          0x00(%[taps], %[off]), %%xmm4")             /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulss      0x00(%[src], %[off]), %%xmm4, %%xmm5", "vfmadd231ss 0x00(%[src], %[off]), %%xmm4, %%xmm0"))  /* xmm0 = s + t*x */ \
+            __ASM_EMIT(SEL("vaddss      %%xmm5, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("cmp             %[tlen], %[off]") \
+            __ASM_EMIT("jb              71b") \
+            __ASM_EMIT("mov             %[dst], %[off]") \
+            __ASM_EMIT("vmovss          %%xmm0, 0x00(%[off])") \
+            __ASM_EMIT("add             %[stride], %[off]") \
+            __ASM_EMIT("mov             %[off], %[dst]") \
+            __ASM_EMIT("add             $0x04, %[src]") \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jge             7b") \
+            __ASM_EMIT("8:")
+
+        #define FIR_DECIMATE_X4_CORE(SEL) \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = a0 */ \
+            __ASM_EMIT("vxorps          %%ymm1, %%ymm1, %%ymm1")                    /* ymm1 = a1 */ \
+            __ASM_EMIT("vxorps          %%ymm2, %%ymm2, %%ymm2")                    /* ymm2 = a2 */ \
+            __ASM_EMIT("vxorps          %%ymm3, %%ymm3, %%ymm3")                    /* ymm3 = a3 */ \
+            /* 8x taps */ \
+            __ASM_EMIT("cmp             %[tend8], %[t]") \
+            __ASM_EMIT("jae             2f") \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("vmovups         0x00(%[t]), %%ymm4")                        /* ymm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s0]), %%ymm4, %%ymm5", "vfmadd231ps 0x00(%[s0]), %%ymm4, %%ymm0"))                    /* ymm0 = a0 + t*x0 */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s1]), %%ymm4, %%ymm6", "vfmadd231ps 0x00(%[s1]), %%ymm4, %%ymm1"))                    /* ymm1 = a1 + t*x1 */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm0, %%ymm0", "vfmadd231ps 0x00(%[s0], %[stride], 2), %%ymm4, %%ymm2"))          /* ymm2 = a2 + t*x2 */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm6, %%ymm1, %%ymm1", "vfmadd231ps 0x00(%[s1], %[stride], 2), %%ymm4, %%ymm3"))          /* ymm3 = a3 + t*x3 */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s0], %[stride], 2), %%ymm4, %%ymm5", "")) \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s1], %[stride], 2), %%ymm4, %%ymm6", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm2, %%ymm2", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm6, %%ymm3, %%ymm3", "")) \
+            __ASM_EMIT("add             $0x20, %[t]") \
+            __ASM_EMIT("add             $0x20, %[s0]") \
+            __ASM_EMIT("add             $0x20, %[s1]") \
+            __ASM_EMIT("cmp             %[tend8], %[t]") \
+            __ASM_EMIT("jb              1b") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("vextractf128    $1, %%ymm0, %%xmm4") \
+            __ASM_EMIT("vextractf128    $1, %%ymm1, %%xmm5") \
+            __ASM_EMIT("vextractf128    $1, %%ymm2, %%xmm6") \
+            __ASM_EMIT("vextractf128    $1, %%ymm3, %%xmm7") \
+            __ASM_EMIT("vaddps          %%xmm4, %%xmm0, %%xmm0") \
+            __ASM_EMIT("vaddps          %%xmm5, %%xmm1, %%xmm1") \
+            __ASM_EMIT("vaddps          %%xmm6, %%xmm2, %%xmm2") \
+            __ASM_EMIT("vaddps          %%xmm7, %%xmm3, %%xmm3") \
+            /* 4x taps */ \
+            __ASM_EMIT("cmp             %[tend4], %[t]") \
+            __ASM_EMIT("jae             4f") \
+            __ASM_EMIT("vmovups         0x00(%[t]), %%xmm4")                        /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s0]), %%xmm4, %%xmm5", "vfmadd231ps 0x00(%[s0]), %%xmm4, %%xmm0"))                    /* xmm0 = a0 + t*x0 */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s1]), %%xmm4, %%xmm6", "vfmadd231ps 0x00(%[s1]), %%xmm4, %%xmm1"))                    /* xmm1 = a1 + t*x1 */ \
+            __ASM_EMIT(SEL("vaddps      %%xmm5, %%xmm0, %%xmm0", "vfmadd231ps 0x00(%[s0], %[stride], 2), %%xmm4, %%xmm2"))          /* xmm2 = a2 + t*x2 */ \
+            __ASM_EMIT(SEL("vaddps      %%xmm6, %%xmm1, %%xmm1", "vfmadd231ps 0x00(%[s1], %[stride], 2), %%xmm4, %%xmm3"))          /* xmm3 = a3 + t*x3 */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s0], %[stride], 2), %%xmm4, %%xmm5", "")) \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s1], %[stride], 2), %%xmm4, %%xmm6", "")) \
+            __ASM_EMIT(SEL("vaddps      %%xmm5, %%xmm2, %%xmm2", "")) \
+            __ASM_EMIT(SEL("vaddps      %%xmm6, %%xmm3, %%xmm3", "")) \
+            __ASM_EMIT("add             $0x10, %[t]") \
+            __ASM_EMIT("add             $0x10, %[s0]") \
+            __ASM_EMIT("add             $0x10, %[s1]") \
+            __ASM_EMIT("4:") \
+            /* 1x taps */ \
+            __ASM_EMIT("cmp             %[tfin], %[t]") \
+            __ASM_EMIT("jae             6f") \
+            __ASM_EMIT("5:") \
+            __ASM_EMIT("vmovss          0x00(%[t]), %%xmm4")                        /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulss      0x00(%[s0]), %%xmm4, %%xmm5", "vfmadd231ss 0x00(%[s0]), %%xmm4, %%xmm0"))                    /* xmm0 = a0 + t*x0 */ \
+            __ASM_EMIT(SEL("vmulss      0x00(%[s1]), %%xmm4, %%xmm6", "vfmadd231ss 0x00(%[s1]), %%xmm4, %%xmm1"))                    /* xmm1 = a1 + t*x1 */ \
+            __ASM_EMIT(SEL("vaddss      %%xmm5, %%xmm0, %%xmm0", "vfmadd231ss 0x00(%[s0], %[stride], 2), %%xmm4, %%xmm2"))          /* xmm2 = a2 + t*x2 */ \
+            __ASM_EMIT(SEL("vaddss      %%xmm6, %%xmm1, %%xmm1", "vfmadd231ss 0x00(%[s1], %[stride], 2), %%xmm4, %%xmm3"))          /* xmm3 = a3 + t*x3 */ \
+            __ASM_EMIT(SEL("vmulss      0x00(%[s0], %[stride], 2), %%xmm4, %%xmm5", "")) \
+            __ASM_EMIT(SEL("vmulss      0x00(%[s1], %[stride], 2), %%xmm4, %%xmm6", "")) \
+            __ASM_EMIT(SEL("vaddss      %%xmm5, %%xmm2, %%xmm2", "")) \
+            __ASM_EMIT(SEL("vaddss      %%xmm6, %%xmm3, %%xmm3", "")) \
+            __ASM_EMIT("add             $0x04, %[t]") \
+            __ASM_EMIT("add             $0x04, %[s0]") \
+            __ASM_EMIT("add             $0x04, %[s1]") \
+            __ASM_EMIT("cmp             %[tfin], %[t]") \
+            __ASM_EMIT("jb              5b") \
+            __ASM_EMIT("6:") \
+            /* Horizontal sums */ \
+            __ASM_EMIT("vunpcklps       %%xmm1, %%xmm0, %%xmm4")                    /* xmm4 = a0[0] a1[0] a0[1] a1[1] */ \
+            __ASM_EMIT("vunpckhps       %%xmm1, %%xmm0, %%xmm5")                    /* xmm5 = a0[2] a1[2] a0[3] a1[3] */ \
+            __ASM_EMIT("vunpcklps       %%xmm3, %%xmm2, %%xmm6")                    /* xmm6 = a2[0] a3[0] a2[1] a3[1] */ \
+            __ASM_EMIT("vunpckhps       %%xmm3, %%xmm2, %%xmm7")                    /* xmm7 = a2[2] a3[2] a2[3] a3[3] */ \
+            __ASM_EMIT("vaddps          %%xmm5, %%xmm4, %%xmm0")                    /* xmm0 = p0 p1 p2 p3 */ \
+            __ASM_EMIT("vaddps          %%xmm7, %%xmm6, %%xmm2")                    /* xmm2 = q0 q1 q2 q3 */ \
+            __ASM_EMIT("vmovlhps        %%xmm2, %%xmm0, %%xmm4")                    /* xmm4 = p0 p1 q0 q1 */ \
+            __ASM_EMIT("vmovhlps        %%xmm0, %%xmm2, %%xmm5")                    /* xmm5 = p2 p3 q2 q3 */ \
+            __ASM_EMIT("vaddps          %%xmm5, %%xmm4, %%xmm0")                    /* xmm0 = p0+p2 p1+p3 q0+q2 q1+q3 */ \
+            __ASM_EMIT("mov             %[dst], %[t]") \
+            __ASM_EMIT("vmovups         %%xmm0, 0x00(%[t])")
+
+        #define FIR_DECIMATE_X1_CORE(SEL) \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = a0 */ \
+            __ASM_EMIT("vxorps          %%ymm1, %%ymm1, %%ymm1")                    /* ymm1 = a1 */ \
+            /* 8x taps */ \
+            __ASM_EMIT("cmp             %[tend8], %[t]") \
+            __ASM_EMIT("jae             2f") \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("vmovups         0x00(%[t]), %%ymm4")                        /* ymm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s0]), %%ymm4, %%ymm5", "vfmadd231ps 0x00(%[s0]), %%ymm4, %%ymm0"))                    /* ymm0 = a0 + t*x */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm0, %%ymm0", "")) \
+            __ASM_EMIT("add             $0x20, %[t]") \
+            __ASM_EMIT("add             $0x20, %[s0]") \
+            __ASM_EMIT("cmp             %[tend8], %[t]") \
+            __ASM_EMIT("jae             2f") \
+            __ASM_EMIT("vmovups         0x00(%[t]), %%ymm4")                        /* ymm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s0]), %%ymm4, %%ymm5", "vfmadd231ps 0x00(%[s0]), %%ymm4, %%ymm1"))                    /* ymm1 = a1 + t*x */ \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm1, %%ymm1", "")) \
+            __ASM_EMIT("add             $0x20, %[t]") \
+            __ASM_EMIT("add             $0x20, %[s0]") \
+            __ASM_EMIT("cmp             %[tend8], %[t]") \
+            __ASM_EMIT("jb              1b") \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("vaddps          %%ymm1, %%ymm0, %%ymm0")                    /* ymm0 = a0 + a1 */ \
+            __ASM_EMIT("vextractf128    $1, %%ymm0, %%xmm4") \
+            __ASM_EMIT("vaddps          %%xmm4, %%xmm0, %%xmm0") \
+            /* 4x taps */ \
+            __ASM_EMIT("cmp             %[tend4], %[t]") \
+            __ASM_EMIT("jae             4f") \
+            __ASM_EMIT("vmovups         0x00(%[t]), %%xmm4")                        /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulps      0x00(%[s0]), %%xmm4, %%xmm5", "vfmadd231ps 0x00(%[s0]), %%xmm4, %%xmm0"))                    /* xmm0 = a0 + t*x */ \
+            __ASM_EMIT(SEL("vaddps      %%xmm5, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT("add             $0x10, %[t]") \
+            __ASM_EMIT("add             $0x10, %[s0]") \
+            __ASM_EMIT("4:") \
+            /* 1x taps */ \
+            __ASM_EMIT("cmp             %[tfin], %[t]") \
+            __ASM_EMIT("jae             6f") \
+            __ASM_EMIT("5:") \
+            __ASM_EMIT("vmovss          0x00(%[t]), %%xmm4")                        /* xmm4 = t */ \
+            __ASM_EMIT(SEL("vmulss      0x00(%[s0]), %%xmm4, %%xmm5", "vfmadd231ss 0x00(%[s0]), %%xmm4, %%xmm0"))                    /* xmm0 = a0 + t*x */ \
+            __ASM_EMIT(SEL("vaddss      %%xmm5, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT("add             $0x04, %[t]") \
+            __ASM_EMIT("add             $0x04, %[s0]") \
+            __ASM_EMIT("cmp             %[tfin], %[t]") \
+            __ASM_EMIT("jb              5b") \
+            __ASM_EMIT("6:") \
+            /* Horizontal sum */ \
+            __ASM_EMIT("vmovhlps        %%xmm0, %%xmm0, %%xmm1")                    /* xmm1 = a2 a3 a2 a3 */ \
+            __ASM_EMIT("vaddps          %%xmm1, %%xmm0, %%xmm0")                    /* xmm0 = a0+a2 a1+a3 ? ? */ \
+            __ASM_EMIT("vmovshdup       %%xmm0, %%xmm1")                            /* xmm1 = a1+a3 a1+a3 ? ? */ \
+            __ASM_EMIT("vaddss          %%xmm1, %%xmm0, %%xmm0")                    /* xmm0 = a0+a1+a2+a3 */ \
+            __ASM_EMIT("mov             %[dst], %[t]") \
+            __ASM_EMIT("vmovss          %%xmm0, 0x00(%[t])")
+
+
+        void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+
+            ARCH_X86_ASM(
+                FIR_DIRECT_CORE(FMA_OFF)
+                : [dst] __IF_32("+m") __IF_64("+r") (dst),
+                  [src] "+r" (src), [count] "+r" (count),
+                  [off] "=&r" (off)
+                : [taps] "r" (taps), [tlen] X86_GREG (tlen)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void fir_direct_fma3(float *dst, const float *src, const float *taps, size_t length, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+
+            ARCH_X86_ASM(
+                FIR_DIRECT_CORE(FMA_ON)
+                : [dst] __IF_32("+m") __IF_64("+r") (dst),
+                  [src] "+r" (src), [count] "+r" (count),
+                  [off] "=&r" (off)
+                : [taps] "r" (taps), [tlen] X86_GREG (tlen)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+            const float *taps, size_t length, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+
+            ARCH_X86_ASM(
+                FIR_DIRECT_X2_CORE(FMA_OFF)
+                : [dst1] __IF_32("+m") __IF_64("+r") (dst1),
+                  [dst2] __IF_32("+m") __IF_64("+r") (dst2),
+                  [src1] "+r" (src1), [src2] "+r" (src2),
+                  [count] "+r" (count), [off] "=&r" (off)
+                : [taps] "r" (taps), [tlen] X86_GREG (tlen)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void fir_direct_x2_fma3(float *dst1, float *dst2, const float *src1, const float *src2,
+            const float *taps, size_t length, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+
+            ARCH_X86_ASM(
+                FIR_DIRECT_X2_CORE(FMA_ON)
+                : [dst1] __IF_32("+m") __IF_64("+r") (dst1),
+                  [dst2] __IF_32("+m") __IF_64("+r") (dst2),
+                  [src1] "+r" (src1), [src2] "+r" (src2),
+                  [count] "+r" (count), [off] "=&r" (off)
+                : [taps] "r" (taps), [tlen] X86_GREG (tlen)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+            size_t stride   = factor * sizeof(float);
+
+            for (size_t p=0; p<factor; ++p, taps += length)
+            {
+                float *d        = &dst[p];
+                const float *s  = src;
+                size_t n        = count;
+
+                ARCH_X86_ASM(
+                    FIR_INTERPOLATE_CORE(FMA_OFF)
+                    : [dst] __IF_32("+m") __IF_64("+r") (d),
+                      [src] "+r" (s), [count] "+r" (n),
+                      [off] "=&r" (off)
+                    : [taps] "r" (taps), [tlen] X86_GREG (tlen),
+                      [stride] X86_GREG (stride)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+            }
+        }
+
+        void fir_interpolate_fma3(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+            size_t stride   = factor * sizeof(float);
+
+            for (size_t p=0; p<factor; ++p, taps += length)
+            {
+                float *d        = &dst[p];
+                const float *s  = src;
+                size_t n        = count;
+
+                ARCH_X86_ASM(
+                    FIR_INTERPOLATE_CORE(FMA_ON)
+                    : [dst] __IF_32("+m") __IF_64("+r") (d),
+                      [src] "+r" (s), [count] "+r" (n),
+                      [off] "=&r" (off)
+                    : [taps] "r" (taps), [tlen] X86_GREG (tlen),
+                      [stride] X86_GREG (stride)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+            }
+        }
+
+        void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            size_t stride       = factor * sizeof(float);
+            const float *tend8  = &taps[length & ~size_t(0x07)];
+            const float *tend4  = &taps[length & ~size_t(0x03)];
+            const float *tfin   = &taps[length];
+
+            // 4x blocks: four dot products with the same taps
+            for ( ; count >= 4; count -= 4)
+            {
+                const float *t  = taps;
+                const float *s0 = src;
+                const float *s1 = &src[factor];
+
+                ARCH_X86_ASM(
+                    FIR_DECIMATE_X4_CORE(FMA_OFF)
+                    : [t] "+r" (t), [s0] "+r" (s0), [s1] "+r" (s1)
+                    : [dst] X86_GREG (dst), [stride] "r" (stride),
+                      [tend8] X86_GREG (tend8), [tend4] X86_GREG (tend4),
+                      [tfin] X86_GREG (tfin)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+
+                dst            += 4;
+                src            += factor * 4;
+            }
+
+            // 1x blocks
+            for ( ; count > 0; --count)
+            {
+                const float *t  = taps;
+                const float *s0 = src;
+
+                ARCH_X86_ASM(
+                    FIR_DECIMATE_X1_CORE(FMA_OFF)
+                    : [t] "+r" (t), [s0] "+r" (s0)
+                    : [dst] X86_GREG (dst),
+                      [tend8] X86_GREG (tend8), [tend4] X86_GREG (tend4),
+                      [tfin] X86_GREG (tfin)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm4", "%xmm5"
+                );
+
+                ++dst;
+                src            += factor;
+            }
+        }
+
+        void fir_decimate_fma3(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            size_t stride       = factor * sizeof(float);
+            const float *tend8  = &taps[length & ~size_t(0x07)];
+            const float *tend4  = &taps[length & ~size_t(0x03)];
+            const float *tfin   = &taps[length];
+
+            // 4x blocks: four dot products with the same taps
+            for ( ; count >= 4; count -= 4)
+            {
+                const float *t  = taps;
+                const float *s0 = src;
+                const float *s1 = &src[factor];
+
+                ARCH_X86_ASM(
+                    FIR_DECIMATE_X4_CORE(FMA_ON)
+                    : [t] "+r" (t), [s0] "+r" (s0), [s1] "+r" (s1)
+                    : [dst] X86_GREG (dst), [stride] "r" (stride),
+                      [tend8] X86_GREG (tend8), [tend4] X86_GREG (tend4),
+                      [tfin] X86_GREG (tfin)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+
+                dst            += 4;
+                src            += factor * 4;
+            }
+
+            // 1x blocks
+            for ( ; count > 0; --count)
+            {
+                const float *t  = taps;
+                const float *s0 = src;
+
+                ARCH_X86_ASM(
+                    FIR_DECIMATE_X1_CORE(FMA_ON)
+                    : [t] "+r" (t), [s0] "+r" (s0)
+                    : [dst] X86_GREG (dst),
+                      [tend8] X86_GREG (tend8), [tend4] X86_GREG (tend4),
+                      [tfin] X86_GREG (tfin)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm4", "%xmm5"
+                );
+
+                ++dst;
+                src            += factor;
+            }
+        }
+
+        #undef FIR_DIRECT_CORE
+        #undef FIR_DIRECT_X2_CORE
+        #undef FIR_INTERPOLATE_CORE
+        #undef FIR_DECIMATE_X4_CORE
+        #undef FIR_DECIMATE_X1_CORE
+        #undef FIR_STORE_STRIDED_Y
+        #undef FIR_STORE_STRIDED
+        #undef FMA_OFF
+        #undef FMA_ON
+
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FIR_H_ */
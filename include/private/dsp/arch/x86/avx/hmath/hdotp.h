@@ -340,6 +340,125 @@ namespace lsp
 
             return result;
         }
+
+        #define FMA_OFF(a, b)       a
+        #define FMA_ON(a, b)        b
+
+        #define H_LERP_DOTP_CORE(SEL) \
+            __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0") \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("vxorps          %%ymm1, %%ymm1, %%ymm1") \
+            __ASM_EMIT("sub             $16, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            /* x16 blocks */ \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("vmovups         0x00(%[x], %[off]), %%ymm2") \
+            __ASM_EMIT("vmovups         0x20(%[x], %[off]), %%ymm3") \
+            __ASM_EMIT(SEL("vmulps      0x00(%[a], %[off]), %%ymm2, %%ymm4", "vfmadd231ps 0x00(%[a], %[off]), %%ymm2, %%ymm0")) \
+            __ASM_EMIT(SEL("vmulps      0x20(%[a], %[off]), %%ymm3, %%ymm5", "vfmadd231ps 0x20(%[a], %[off]), %%ymm3, %%ymm0")) \
+            __ASM_EMIT(SEL("vmulps      0x00(%[b], %[off]), %%ymm2, %%ymm6", "vfmadd231ps 0x00(%[b], %[off]), %%ymm2, %%ymm1")) \
+            __ASM_EMIT(SEL("vmulps      0x20(%[b], %[off]), %%ymm3, %%ymm7", "vfmadd231ps 0x20(%[b], %[off]), %%ymm3, %%ymm1")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm4, %%ymm0, %%ymm0", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm6, %%ymm1, %%ymm1", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm5, %%ymm0, %%ymm0", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm7, %%ymm1, %%ymm1", "")) \
+            __ASM_EMIT("add             $0x40, %[off]") \
+            __ASM_EMIT("sub             $16, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            /* x8 block */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $8, %[count]") \
+            __ASM_EMIT("jl              4f") \
+            __ASM_EMIT("vmovups         0x00(%[x], %[off]), %%ymm2") \
+            __ASM_EMIT(SEL("vmulps      0x00(%[a], %[off]), %%ymm2, %%ymm4", "vfmadd231ps 0x00(%[a], %[off]), %%ymm2, %%ymm0")) \
+            __ASM_EMIT(SEL("vmulps      0x00(%[b], %[off]), %%ymm2, %%ymm6", "vfmadd231ps 0x00(%[b], %[off]), %%ymm2, %%ymm1")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm4, %%ymm0, %%ymm0", "")) \
+            __ASM_EMIT(SEL("vaddps      %%ymm6, %%ymm1, %%ymm1", "")) \
+            __ASM_EMIT("add             $0x20, %[off]") \
+            __ASM_EMIT("sub             $8, %[count]") \
+            /* x4 block */ \
+            __ASM_EMIT("4:") \
+            __ASM_EMIT("vextractf128    $0x01, %%ymm0, %%xmm4") \
+            __ASM_EMIT("vextractf128    $0x01, %%ymm1, %%xmm6") \
+            __ASM_EMIT("vaddps          %%xmm4, %%xmm0, %%xmm0") \
+            __ASM_EMIT("vaddps          %%xmm6, %%xmm1, %%xmm1") \
+            __ASM_EMIT("add             $4, %[count]") \
+            __ASM_EMIT("jl              6f") \
+            __ASM_EMIT("vmovups         0x00(%[x], %[off]), %%xmm2") \
+            __ASM_EMIT(SEL("vmulps      0x00(%[a], %[off]), %%xmm2, %%xmm4", "vfmadd231ps 0x00(%[a], %[off]), %%xmm2, %%xmm0")) \
+            __ASM_EMIT(SEL("vmulps      0x00(%[b], %[off]), %%xmm2, %%xmm6", "vfmadd231ps 0x00(%[b], %[off]), %%xmm2, %%xmm1")) \
+            __ASM_EMIT(SEL("vaddps      %%xmm4, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT(SEL("vaddps      %%xmm6, %%xmm1, %%xmm1", "")) \
+            __ASM_EMIT("add             $0x10, %[off]") \
+            __ASM_EMIT("sub             $4, %[count]") \
+            /* x1 blocks */ \
+            __ASM_EMIT("6:") \
+            __ASM_EMIT("add             $3, %[count]") \
+            __ASM_EMIT("jl              8f") \
+            __ASM_EMIT("7:") \
+            __ASM_EMIT("vmovss          0x00(%[x], %[off]), %%xmm2") \
+            __ASM_EMIT(SEL("vmulss      0x00(%[a], %[off]), %%xmm2, %%xmm4", "vfmadd231ss 0x00(%[a], %[off]), %%xmm2, %%xmm0")) \
+            __ASM_EMIT(SEL("vmulss      0x00(%[b], %[off]), %%xmm2, %%xmm6", "vfmadd231ss 0x00(%[b], %[off]), %%xmm2, %%xmm1")) \
+            __ASM_EMIT(SEL("vaddss      %%xmm4, %%xmm0, %%xmm0", "")) \
+            __ASM_EMIT(SEL("vaddss      %%xmm6, %%xmm1, %%xmm1", "")) \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jge             7b") \
+            /* interpolate and sum */ \
+            __ASM_EMIT("8:") \
+            __ASM_EMIT("vbroadcastss    %[k], %%xmm2")                              /* xmm2 = k */ \
+            __ASM_EMIT("vsubps          %%xmm0, %%xmm1, %%xmm1")                    /* xmm1 = sb - sa */ \
+            __ASM_EMIT(SEL("vmulps      %%xmm2, %%xmm1, %%xmm1", "vfmadd231ps %%xmm2, %%xmm1, %%xmm0")) \
+            __ASM_EMIT(SEL("vaddps      %%xmm1, %%xmm0, %%xmm0", ""))               /* xmm0 = sa + (sb - sa)*k */ \
+            __ASM_EMIT("vhaddps         %%xmm0, %%xmm0, %%xmm0") \
+            __ASM_EMIT("vhaddps         %%xmm0, %%xmm0, %%xmm0")
+
+        float h_lerp_dotp(const float *x, const float *a, const float *b, float k, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                H_LERP_DOTP_CORE(FMA_OFF)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  [res] "=Yz" (result)
+                : [x] "r" (x), [a] "r" (a), [b] "r" (b),
+                  [k] "m" (k)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        float h_lerp_dotp_fma3(const float *x, const float *a, const float *b, float k, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                H_LERP_DOTP_CORE(FMA_ON)
+                : [count] "+r" (count), [off] "=&r" (off),
+                  [res] "=Yz" (result)
+                : [x] "r" (x), [a] "r" (a), [b] "r" (b),
+                  [k] "m" (k)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+
+        #undef H_LERP_DOTP_CORE
+        #undef FMA_OFF
+        #undef FMA_ON
+
     }
 }
 
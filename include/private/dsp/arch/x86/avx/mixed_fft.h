@@ -0,0 +1,943 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_MIXED_FFT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_MIXED_FFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        IF_ARCH_X86_64(
+            static const float MIXED_FFT_C[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(0.5f),                         // 0x000: -cos(2*pi/3)
+                LSP_DSP_VEC8(0.866025403784438647f),        // 0x020: sin(2*pi/3)
+                LSP_DSP_VEC8(0.309016994374947424f),        // 0x040: cos(2*pi/5)
+                LSP_DSP_VEC8(-0.809016994374947424f),       // 0x060: cos(4*pi/5)
+                LSP_DSP_VEC8(0.951056516295153572f),        // 0x080: sin(2*pi/5)
+                LSP_DSP_VEC8(0.587785252292473129f),        // 0x0a0: sin(4*pi/5)
+                LSP_DSP_VEC8(0.707106781186547524f),        // 0x0c0: sqrt(1/2)
+                LSP_DSP_VEC8(-0.707106781186547524f),       // 0x0e0: -sqrt(1/2)
+                LSP_DSP_VEC8(-0.0f)                         // 0x100: sign
+            };
+        )
+
+        IF_ARCH_X86_64(
+            /**
+             * Compute DFT of small size
+             * @param b_re real part of output
+             * @param b_im imaginary part of output
+             * @param a_re real part of input
+             * @param a_im imaginary part of input
+             * @param p the size of DFT: 2, 3, 4, 5 or 8
+             * @param d -1 for direct DFT, +1 for reverse DFT
+             */
+            static void mixed_fft_dft(float *b_re, float *b_im, const float *a_re, const float *a_im, size_t p, float d)
+            {
+                switch (p)
+                {
+                    case 2:
+                        b_re[0]     = a_re[0] + a_re[1];
+                        b_im[0]     = a_im[0] + a_im[1];
+                        b_re[1]     = a_re[0] - a_re[1];
+                        b_im[1]     = a_im[0] - a_im[1];
+                        break;
+
+                    case 3:
+                    {
+                        const float k   = d * 0.866025403784438647f; // sin(2*pi/3)
+                        float t_re      = a_re[1] + a_re[2];
+                        float t_im      = a_im[1] + a_im[2];
+                        float u_re      = a_re[0] - 0.5f * t_re;
+                        float u_im      = a_im[0] - 0.5f * t_im;
+                        float v_re      = -k * (a_im[1] - a_im[2]);
+                        float v_im      = k * (a_re[1] - a_re[2]);
+
+                        b_re[0]     = a_re[0] + t_re;
+                        b_im[0]     = a_im[0] + t_im;
+                        b_re[1]     = u_re + v_re;
+                        b_im[1]     = u_im + v_im;
+                        b_re[2]     = u_re - v_re;
+                        b_im[2]     = u_im - v_im;
+                        break;
+                    }
+
+                    case 4:
+                    {
+                        float t0_re     = a_re[0] + a_re[2];
+                        float t0_im     = a_im[0] + a_im[2];
+                        float t1_re     = a_re[0] - a_re[2];
+                        float t1_im     = a_im[0] - a_im[2];
+                        float t2_re     = a_re[1] + a_re[3];
+                        float t2_im     = a_im[1] + a_im[3];
+                        float t3_re     = -d * (a_im[1] - a_im[3]);
+                        float t3_im     = d * (a_re[1] - a_re[3]);
+
+                        b_re[0]     = t0_re + t2_re;
+                        b_im[0]     = t0_im + t2_im;
+                        b_re[1]     = t1_re + t3_re;
+                        b_im[1]     = t1_im + t3_im;
+                        b_re[2]     = t0_re - t2_re;
+                        b_im[2]     = t0_im - t2_im;
+                        b_re[3]     = t1_re - t3_re;
+                        b_im[3]     = t1_im - t3_im;
+                        break;
+                    }
+
+                    case 5:
+                    {
+                        const float c1  = 0.309016994374947424f;        // cos(2*pi/5)
+                        const float c2  = -0.809016994374947424f;       // cos(4*pi/5)
+                        const float s1  = d * 0.951056516295153572f;    // sin(2*pi/5)
+                        const float s2  = d * 0.587785252292473129f;    // sin(4*pi/5)
+
+                        float t1_re     = a_re[1] + a_re[4];
+                        float t1_im     = a_im[1] + a_im[4];
+                        float t2_re     = a_re[2] + a_re[3];
+                        float t2_im     = a_im[2] + a_im[3];
+                        float t3_re     = a_re[1] - a_re[4];
+                        float t3_im     = a_im[1] - a_im[4];
+                        float t4_re     = a_re[2] - a_re[3];
+                        float t4_im     = a_im[2] - a_im[3];
+
+                        float u1_re     = a_re[0] + c1 * t1_re + c2 * t2_re;
+                        float u1_im     = a_im[0] + c1 * t1_im + c2 * t2_im;
+                        float u2_re     = a_re[0] + c2 * t1_re + c1 * t2_re;
+                        float u2_im     = a_im[0] + c2 * t1_im + c1 * t2_im;
+                        float v1_re     = -(s1 * t3_im + s2 * t4_im);
+                        float v1_im     = s1 * t3_re + s2 * t4_re;
+                        float v2_re     = -(s2 * t3_im - s1 * t4_im);
+                        float v2_im     = s2 * t3_re - s1 * t4_re;
+
+                        b_re[0]     = a_re[0] + t1_re + t2_re;
+                        b_im[0]     = a_im[0] + t1_im + t2_im;
+                        b_re[1]     = u1_re + v1_re;
+                        b_im[1]     = u1_im + v1_im;
+                        b_re[2]     = u2_re + v2_re;
+                        b_im[2]     = u2_im + v2_im;
+                        b_re[3]     = u2_re - v2_re;
+                        b_im[3]     = u2_im - v2_im;
+                        b_re[4]     = u1_re - v1_re;
+                        b_im[4]     = u1_im - v1_im;
+                        break;
+                    }
+
+                    case 8:
+                    {
+                        const float r   = M_SQRT1_2;
+                        float u_re[4], u_im[4], v_re[4], v_im[4];
+
+                        // Radix-2 decimation in frequency, odd outputs are multiplied by exp(d*I*pi*k/4)
+                        for (size_t k=0; k<4; ++k)
+                        {
+                            u_re[k]         = a_re[k] + a_re[k+4];
+                            u_im[k]         = a_im[k] + a_im[k+4];
+                            v_re[k]         = a_re[k] - a_re[k+4];
+                            v_im[k]         = a_im[k] - a_im[k+4];
+                        }
+
+                        float t_re      = v_re[1];
+                        v_re[1]         = r * (t_re - d * v_im[1]);
+                        v_im[1]         = r * (v_im[1] + d * t_re);
+                        t_re            = v_re[2];
+                        v_re[2]         = -d * v_im[2];
+                        v_im[2]         = d * t_re;
+                        t_re            = v_re[3];
+                        v_re[3]         = -r * (t_re + d * v_im[3]);
+                        v_im[3]         = r * (d * t_re - v_im[3]);
+
+                        float e_re[4], e_im[4], o_re[4], o_im[4];
+                        mixed_fft_dft(e_re, e_im, u_re, u_im, 4, d);
+                        mixed_fft_dft(o_re, o_im, v_re, v_im, 4, d);
+
+                        for (size_t j=0; j<4; ++j)
+                        {
+                            b_re[j*2]       = e_re[j];
+                            b_im[j*2]       = e_im[j];
+                            b_re[j*2+1]     = o_re[j];
+                            b_im[j*2+1]     = o_im[j];
+                        }
+                        break;
+                    }
+
+                    default:
+                        break;
+                }
+            }
+
+            /**
+             * Perform one stage of the mixed-radix FFT for sub-sequences i0..m-1 without SIMD
+             * @param y_re real part of output
+             * @param y_im imaginary part of output
+             * @param x_re real part of input
+             * @param x_im imaginary part of input
+             * @param xs distance between input items: 1 for split data, 2 for packed data
+             * @param tw twiddle factors of the stage
+             * @param p radix of the stage
+             * @param s stride of the stage
+             * @param m number of sub-sequences
+             * @param i0 first sub-sequence to process
+             * @param d -1 for direct FFT, +1 for reverse FFT
+             */
+            static void mixed_fft_scalar_stage(float *y_re, float *y_im, const float *x_re, const float *x_im, size_t xs,
+                const float *tw, size_t p, size_t s, size_t m, size_t i0, float d)
+            {
+                float a_re[8], a_im[8], b_re[8], b_im[8];
+
+                for (size_t i=i0; i<m; ++i)
+                {
+                    const float *w      = &tw[(i >> 3) * (p - 1) * 16 + (i & 7)];
+
+                    for (size_t q=0; q<s; ++q)
+                    {
+                        for (size_t k=0; k<p; ++k)
+                        {
+                            size_t idx      = (q + s*(i + k*m)) * xs;
+                            a_re[k]         = x_re[idx];
+                            a_im[k]         = x_im[idx];
+                        }
+
+                        mixed_fft_dft(b_re, b_im, a_re, a_im, p, d);
+
+                        float *d_re     = &y_re[q + s*p*i];
+                        float *d_im     = &y_im[q + s*p*i];
+                        d_re[0]         = b_re[0];
+                        d_im[0]         = b_im[0];
+                        for (size_t j=1; j<p; ++j)
+                        {
+                            float w_re      = w[(j-1)*16];
+                            float w_im      = d * w[(j-1)*16 + 8];
+                            d_re[s*j]       = b_re[j]*w_re - b_im[j]*w_im;
+                            d_im[s*j]       = b_re[j]*w_im + b_im[j]*w_re;
+                        }
+                    }
+                }
+            }
+        )
+
+        /*
+         * Multiply the complex vector (R, I) by the twiddle factor (c, s):
+         *   direct FFT:  (R, I) * (c - i*s)
+         *   reverse FFT: (R, I) * (c + i*s)
+         */
+        #define MFFT_TW(LD, WC, WS, R, I, T0, T1, T2, T3, OP_RE, OP_IM) \
+            __ASM_EMIT(LD "    " WC ", " T0)                                /* T0   = c */ \
+            __ASM_EMIT(LD "    " WS ", " T1)                                /* T1   = s */ \
+            __ASM_EMIT("vmulps          " T1 ", " R ", " T2)                /* T2   = R*s */ \
+            __ASM_EMIT("vmulps          " T1 ", " I ", " T3)                /* T3   = I*s */ \
+            __ASM_EMIT("vmulps          " T0 ", " R ", " R)                 /* R    = R*c */ \
+            __ASM_EMIT("vmulps          " T0 ", " I ", " I)                 /* I    = I*c */ \
+            __ASM_EMIT(OP_RE "          " T3 ", " R ", " R)                 /* R    = R*c +- I*s */ \
+            __ASM_EMIT(OP_IM "          " T2 ", " I ", " I)                 /* I    = I*c -+ R*s */
+
+        #define MFFT_QTW(WC, WS, R, I, T0, T1, T2, T3, OP_RE, OP_IM) \
+            MFFT_TW("vbroadcastss", WC "(%[tw])", WS "(%[tw])", R, I, T0, T1, T2, T3, OP_RE, OP_IM)
+
+        #define MFFT_LOAD2(IDX, R, I) \
+            __ASM_EMIT("vmovups         (%[x_re]" IDX "), " R) \
+            __ASM_EMIT("vmovups         (%[x_im]" IDX "), " I)
+
+        #define MFFT_STORE2(IDX, R, I) \
+            __ASM_EMIT("vmovups         " R ", (%[y_re]" IDX ")") \
+            __ASM_EMIT("vmovups         " I ", (%[y_im]" IDX ")")
+
+        #define MFFT_QLOOP_END \
+            __ASM_EMIT("add             $0x20, %[x_re]") \
+            __ASM_EMIT("add             $0x20, %[x_im]") \
+            __ASM_EMIT("add             $0x20, %[y_re]") \
+            __ASM_EMIT("add             $0x20, %[y_im]") \
+            __ASM_EMIT("dec             %[count]") \
+            __ASM_EMIT("jnz             1b")
+
+        /*
+         * Stages with stride multiple of 8: process 8 sequences in parallel,
+         * twiddle factors are the same for all of them.
+         */
+        #define MFFT_QRADIX2(OPA, OPB) \
+            ARCH_X86_64_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                MFFT_LOAD2("", "%%ymm0", "%%ymm1")                          /* ymm0 = a0 */ \
+                MFFT_LOAD2(", %[xk]", "%%ymm2", "%%ymm3")                   /* ymm2 = a1 */ \
+                __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm4")        /* ymm4 = b0 = a0 + a1 */ \
+                __ASM_EMIT("vaddps          %%ymm3, %%ymm1, %%ymm5") \
+                __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm0")        /* ymm0 = b1 = a0 - a1 */ \
+                __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm1") \
+                MFFT_STORE2("", "%%ymm4", "%%ymm5") \
+                MFFT_QTW("0x00", "0x20", "%%ymm0", "%%ymm1", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5", OPA, OPB) \
+                MFFT_STORE2(", %[yk]", "%%ymm0", "%%ymm1") \
+                MFFT_QLOOP_END \
+                : [x_re] "+r" (x_re), [x_im] "+r" (x_im), \
+                  [y_re] "+r" (y_re), [y_im] "+r" (y_im), \
+                  [count] "+r" (count) \
+                : [xk] "r" (xk), [yk] "r" (yk), [tw] "r" (w) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5" \
+            );
+
+        #define MFFT_QRADIX3(OPA, OPB) \
+            ARCH_X86_64_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                MFFT_LOAD2("", "%%ymm0", "%%ymm1")                          /* ymm0 = a0 */ \
+                MFFT_LOAD2(", %[xk]", "%%ymm2", "%%ymm3")                   /* ymm2 = a1 */ \
+                MFFT_LOAD2(", %[xk], 2", "%%ymm4", "%%ymm5")                /* ymm4 = a2 */ \
+                __ASM_EMIT("vaddps          %%ymm4, %%ymm2, %%ymm6")        /* ymm6 = t = a1 + a2 */ \
+                __ASM_EMIT("vaddps          %%ymm5, %%ymm3, %%ymm7") \
+                __ASM_EMIT("vsubps          %%ymm4, %%ymm2, %%ymm2")        /* ymm2 = w = a1 - a2 */ \
+                __ASM_EMIT("vsubps          %%ymm5, %%ymm3, %%ymm3") \
+                __ASM_EMIT("vaddps          %%ymm6, %%ymm0, %%ymm8")        /* ymm8 = b0 = a0 + t */ \
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm1, %%ymm9") \
+                __ASM_EMIT("vmulps          0x000(%[C]), %%ymm6, %%ymm6")   /* ymm6 = t/2 */ \
+                __ASM_EMIT("vmulps          0x000(%[C]), %%ymm7, %%ymm7") \
+                __ASM_EMIT("vsubps          %%ymm6, %%ymm0, %%ymm0")        /* ymm0 = u = a0 - t/2 */ \
+                __ASM_EMIT("vsubps          %%ymm7, %%ymm1, %%ymm1") \
+                __ASM_EMIT("vmulps          0x020(%[C]), %%ymm2, %%ymm2")   /* ymm2 = w*sin(2*pi/3) */ \
+                __ASM_EMIT("vmulps          0x020(%[C]), %%ymm3, %%ymm3") \
+                MFFT_STORE2("", "%%ymm8", "%%ymm9") \
+                __ASM_EMIT(OPA "          %%ymm3, %%ymm0, %%ymm4")          /* ymm4 = b1 */ \
+                __ASM_EMIT(OPB "          %%ymm2, %%ymm1, %%ymm5") \
+                __ASM_EMIT(OPB "          %%ymm3, %%ymm0, %%ymm0")          /* ymm0 = b2 */ \
+                __ASM_EMIT(OPA "          %%ymm2, %%ymm1, %%ymm1") \
+                MFFT_QTW("0x00", "0x20", "%%ymm4", "%%ymm5", "%%ymm6", "%%ymm7", "%%ymm8", "%%ymm9", OPA, OPB) \
+                MFFT_STORE2(", %[yk]", "%%ymm4", "%%ymm5") \
+                MFFT_QTW("0x40", "0x60", "%%ymm0", "%%ymm1", "%%ymm6", "%%ymm7", "%%ymm8", "%%ymm9", OPA, OPB) \
+                MFFT_STORE2(", %[yk], 2", "%%ymm0", "%%ymm1") \
+                MFFT_QLOOP_END \
+                : [x_re] "+r" (x_re), [x_im] "+r" (x_im), \
+                  [y_re] "+r" (y_re), [y_im] "+r" (y_im), \
+                  [count] "+r" (count) \
+                : [xk] "r" (xk), [yk] "r" (yk), [tw] "r" (w), \
+                  [C] "r" (MIXED_FFT_C) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7", \
+                  "%xmm8", "%xmm9" \
+            );
+
+        #define MFFT_QRADIX4(OPA, OPB) \
+            ARCH_X86_64_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                MFFT_LOAD2("", "%%ymm0", "%%ymm1")                          /* ymm0 = a0 */ \
+                MFFT_LOAD2(", %[xk]", "%%ymm2", "%%ymm3")                   /* ymm2 = a1 */ \
+                MFFT_LOAD2(", %[xk], 2", "%%ymm4", "%%ymm5")                /* ymm4 = a2 */ \
+                MFFT_LOAD2(", %[xk3]", "%%ymm6", "%%ymm7")                  /* ymm6 = a3 */ \
+                __ASM_EMIT("vaddps          %%ymm4, %%ymm0, %%ymm8")        /* ymm8 = t0 = a0 + a2 */ \
+                __ASM_EMIT("vaddps          %%ymm5, %%ymm1, %%ymm9") \
+                __ASM_EMIT("vsubps          %%ymm4, %%ymm0, %%ymm0")        /* ymm0 = t1 = a0 - a2 */ \
+                __ASM_EMIT("vsubps          %%ymm5, %%ymm1, %%ymm1") \
+                __ASM_EMIT("vaddps          %%ymm6, %%ymm2, %%ymm10")       /* ymm10 = t2 = a1 + a3 */ \
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm3, %%ymm11") \
+                __ASM_EMIT("vsubps          %%ymm6, %%ymm2, %%ymm2")        /* ymm2 = t3 = a1 - a3 */ \
+                __ASM_EMIT("vsubps          %%ymm7, %%ymm3, %%ymm3") \
+                __ASM_EMIT("vaddps          %%ymm10, %%ymm8, %%ymm12")      /* ymm12 = b0 = t0 + t2 */ \
+                __ASM_EMIT("vaddps          %%ymm11, %%ymm9, %%ymm13") \
+                __ASM_EMIT("vsubps          %%ymm10, %%ymm8, %%ymm8")       /* ymm8 = b2 = t0 - t2 */ \
+                __ASM_EMIT("vsubps          %%ymm11, %%ymm9, %%ymm9") \
+                __ASM_EMIT(OPA "          %%ymm3, %%ymm0, %%ymm10")         /* ymm10 = b1 = t1 -+ i*t3 */ \
+                __ASM_EMIT(OPB "          %%ymm2, %%ymm1, %%ymm11") \
+                __ASM_EMIT(OPB "          %%ymm3, %%ymm0, %%ymm0")          /* ymm0 = b3 = t1 +- i*t3 */ \
+                __ASM_EMIT(OPA "          %%ymm2, %%ymm1, %%ymm1") \
+                MFFT_STORE2("", "%%ymm12", "%%ymm13") \
+                MFFT_QTW("0x00", "0x20", "%%ymm10", "%%ymm11", "%%ymm12", "%%ymm13", "%%ymm14", "%%ymm15", OPA, OPB) \
+                MFFT_STORE2(", %[yk]", "%%ymm10", "%%ymm11") \
+                MFFT_QTW("0x40", "0x60", "%%ymm8", "%%ymm9", "%%ymm12", "%%ymm13", "%%ymm14", "%%ymm15", OPA, OPB) \
+                MFFT_STORE2(", %[yk], 2", "%%ymm8", "%%ymm9") \
+                MFFT_QTW("0x80", "0xa0", "%%ymm0", "%%ymm1", "%%ymm12", "%%ymm13", "%%ymm14", "%%ymm15", OPA, OPB) \
+                MFFT_STORE2(", %[yk3]", "%%ymm0", "%%ymm1") \
+                MFFT_QLOOP_END \
+                : [x_re] "+r" (x_re), [x_im] "+r" (x_im), \
+                  [y_re] "+r" (y_re), [y_im] "+r" (y_im), \
+                  [count] "+r" (count) \
+                : [xk] "r" (xk), [yk] "r" (yk), [xk3] "r" (xk * 3), [yk3] "r" (yk * 3), \
+                  [tw] "r" (w) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7", \
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11", \
+                  "%xmm12", "%xmm13", "%xmm14", "%xmm15" \
+            );
+
+        #define MFFT_QRADIX5(OPA, OPB) \
+            ARCH_X86_64_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                MFFT_LOAD2("", "%%ymm0", "%%ymm1")                          /* ymm0 = a0 */ \
+                MFFT_LOAD2(", %[xk]", "%%ymm2", "%%ymm3")                   /* ymm2 = a1 */ \
+                MFFT_LOAD2(", %[xk], 2", "%%ymm4", "%%ymm5")                /* ymm4 = a2 */ \
+                MFFT_LOAD2(", %[xk3]", "%%ymm6", "%%ymm7")                  /* ymm6 = a3 */ \
+                MFFT_LOAD2(", %[xk], 4", "%%ymm8", "%%ymm9")                /* ymm8 = a4 */ \
+                __ASM_EMIT("vaddps          %%ymm8, %%ymm2, %%ymm10")       /* ymm10 = t1 = a1 + a4 */ \
+                __ASM_EMIT("vaddps          %%ymm9, %%ymm3, %%ymm11") \
+                __ASM_EMIT("vsubps          %%ymm8, %%ymm2, %%ymm2")        /* ymm2 = t3 = a1 - a4 */ \
+                __ASM_EMIT("vsubps          %%ymm9, %%ymm3, %%ymm3") \
+                __ASM_EMIT("vaddps          %%ymm6, %%ymm4, %%ymm8")        /* ymm8 = t2 = a2 + a3 */ \
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm5, %%ymm9") \
+                __ASM_EMIT("vsubps          %%ymm6, %%ymm4, %%ymm4")        /* ymm4 = t4 = a2 - a3 */ \
+                __ASM_EMIT("vsubps          %%ymm7, %%ymm5, %%ymm5") \
+                __ASM_EMIT("vaddps          %%ymm10, %%ymm0, %%ymm12")      /* ymm12 = b0 = a0 + t1 + t2 */ \
+                __ASM_EMIT("vaddps          %%ymm11, %%ymm1, %%ymm13") \
+                __ASM_EMIT("vaddps          %%ymm8, %%ymm12, %%ymm12") \
+                __ASM_EMIT("vaddps          %%ymm9, %%ymm13, %%ymm13") \
+                MFFT_STORE2("", "%%ymm12", "%%ymm13") \
+                __ASM_EMIT("vmulps          0x040(%[C]), %%ymm10, %%ymm12") /* ymm12 = u1 = a0 + c1*t1 + c2*t2 */ \
+                __ASM_EMIT("vmulps          0x060(%[C]), %%ymm8, %%ymm6") \
+                __ASM_EMIT("vaddps          %%ymm6, %%ymm12, %%ymm12") \
+                __ASM_EMIT("vaddps          %%ymm0, %%ymm12, %%ymm12") \
+                __ASM_EMIT("vmulps          0x040(%[C]), %%ymm11, %%ymm13") \
+                __ASM_EMIT("vmulps          0x060(%[C]), %%ymm9, %%ymm7") \
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm13, %%ymm13") \
+                __ASM_EMIT("vaddps          %%ymm1, %%ymm13, %%ymm13") \
+                __ASM_EMIT("vmulps          0x060(%[C]), %%ymm10, %%ymm14") /* ymm14 = u2 = a0 + c2*t1 + c1*t2 */ \
+                __ASM_EMIT("vmulps          0x040(%[C]), %%ymm8, %%ymm6") \
+                __ASM_EMIT("vaddps          %%ymm6, %%ymm14, %%ymm14") \
+                __ASM_EMIT("vaddps          %%ymm0, %%ymm14, %%ymm14") \
+                __ASM_EMIT("vmulps          0x060(%[C]), %%ymm11, %%ymm15") \
+                __ASM_EMIT("vmulps          0x040(%[C]), %%ymm9, %%ymm7") \
+                __ASM_EMIT("vaddps          %%ymm7, %%ymm15, %%ymm15") \
+                __ASM_EMIT("vaddps          %%ymm1, %%ymm15, %%ymm15") \
+                __ASM_EMIT("vmulps          0x080(%[C]), %%ymm2, %%ymm6")   /* ymm6 = z1 = s1*t3 + s2*t4 */ \
+                __ASM_EMIT("vmulps          0x0a0(%[C]), %%ymm4, %%ymm8") \
+                __ASM_EMIT("vaddps          %%ymm8, %%ymm6, %%ymm6") \
+                __ASM_EMIT("vmulps          0x080(%[C]), %%ymm3, %%ymm7") \
+                __ASM_EMIT("vmulps          0x0a0(%[C]), %%ymm5, %%ymm9") \
+                __ASM_EMIT("vaddps          %%ymm9, %%ymm7, %%ymm7") \
+                __ASM_EMIT("vmulps          0x0a0(%[C]), %%ymm2, %%ymm8")   /* ymm8 = z2 = s2*t3 - s1*t4 */ \
+                __ASM_EMIT("vmulps          0x080(%[C]), %%ymm4, %%ymm10") \
+                __ASM_EMIT("vsubps          %%ymm10, %%ymm8, %%ymm8") \
+                __ASM_EMIT("vmulps          0x0a0(%[C]), %%ymm3, %%ymm9") \
+                __ASM_EMIT("vmulps          0x080(%[C]), %%ymm5, %%ymm10") \
+                __ASM_EMIT("vsubps          %%ymm10, %%ymm9, %%ymm9") \
+                __ASM_EMIT(OPA "          %%ymm7, %%ymm12, %%ymm0")         /* ymm0 = b1 = u1 -+ i*z1 */ \
+                __ASM_EMIT(OPB "          %%ymm6, %%ymm13, %%ymm1") \
+                __ASM_EMIT(OPB "          %%ymm7, %%ymm12, %%ymm12")        /* ymm12 = b4 = u1 +- i*z1 */ \
+                __ASM_EMIT(OPA "          %%ymm6, %%ymm13, %%ymm13") \
+                __ASM_EMIT(OPA "          %%ymm9, %%ymm14, %%ymm2")         /* ymm2 = b2 = u2 -+ i*z2 */ \
+                __ASM_EMIT(OPB "          %%ymm8, %%ymm15, %%ymm3") \
+                __ASM_EMIT(OPB "          %%ymm9, %%ymm14, %%ymm14")        /* ymm14 = b3 = u2 +- i*z2 */ \
+                __ASM_EMIT(OPA "          %%ymm8, %%ymm15, %%ymm15") \
+                MFFT_QTW("0x00", "0x20", "%%ymm0", "%%ymm1", "%%ymm4", "%%ymm5", "%%ymm6", "%%ymm7", OPA, OPB) \
+                MFFT_STORE2(", %[yk]", "%%ymm0", "%%ymm1") \
+                MFFT_QTW("0x40", "0x60", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5", "%%ymm6", "%%ymm7", OPA, OPB) \
+                MFFT_STORE2(", %[yk], 2", "%%ymm2", "%%ymm3") \
+                MFFT_QTW("0x80", "0xa0", "%%ymm14", "%%ymm15", "%%ymm4", "%%ymm5", "%%ymm6", "%%ymm7", OPA, OPB) \
+                MFFT_STORE2(", %[yk3]", "%%ymm14", "%%ymm15") \
+                MFFT_QTW("0xc0", "0xe0", "%%ymm12", "%%ymm13", "%%ymm4", "%%ymm5", "%%ymm6", "%%ymm7", OPA, OPB) \
+                MFFT_STORE2(", %[yk], 4", "%%ymm12", "%%ymm13") \
+                MFFT_QLOOP_END \
+                : [x_re] "+r" (x_re), [x_im] "+r" (x_im), \
+                  [y_re] "+r" (y_re), [y_im] "+r" (y_im), \
+                  [count] "+r" (count) \
+                : [xk] "r" (xk), [yk] "r" (yk), [xk3] "r" (xk * 3), [yk3] "r" (yk * 3), \
+                  [tw] "r" (w), [C] "r" (MIXED_FFT_C) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7", \
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11", \
+                  "%xmm12", "%xmm13", "%xmm14", "%xmm15" \
+            );
+
+        #define MFFT_R8LOAD_SPLIT(IDX, R, I, T0, T1) \
+            __ASM_EMIT("vmovups         (%[p_re]" IDX "), " R) \
+            __ASM_EMIT("vmovups         (%[p_im]" IDX "), " I)
+
+        #define MFFT_R8LOAD_PACKED(IDX, R, I, T0, T1) \
+            __ASM_EMIT("vmovups         0x00(%[p_re]" IDX "), " T0)         /* T0   = r0 i0 r1 i1 r2 i2 r3 i3 */ \
+            __ASM_EMIT("vmovups         0x20(%[p_re]" IDX "), " T1)         /* T1   = r4 i4 r5 i5 r6 i6 r7 i7 */ \
+            __ASM_EMIT("vperm2f128      $0x20, " T1 ", " T0 ", " R)         /* R    = r0 i0 r1 i1 r4 i4 r5 i5 */ \
+            __ASM_EMIT("vperm2f128      $0x31, " T1 ", " T0 ", " I)         /* I    = r2 i2 r3 i3 r6 i6 r7 i7 */ \
+            __ASM_EMIT("vshufps         $0x88, " I ", " R ", " T0)          /* T0   = r0 r1 r2 r3 r4 r5 r6 r7 */ \
+            __ASM_EMIT("vshufps         $0xdd, " I ", " R ", " I)           /* I    = i0 i1 i2 i3 i4 i5 i6 i7 */ \
+            __ASM_EMIT("vmovaps         " T0 ", " R)
+
+        /*
+         * Compute c[k] = a[k] OP a[k+4] for k = 0..3 into ymm8..ymm15
+         */
+        #define MFFT_R8_HALF(LOAD, OP) \
+            __ASM_EMIT("mov             %[x_re], %[p_re]") \
+            __ASM_EMIT("mov             %[x_im], %[p_im]") \
+            LOAD("", "%%ymm0", "%%ymm1", "%%ymm4", "%%ymm5") \
+            LOAD(", %[mb], 4", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5") \
+            __ASM_EMIT(OP "          %%ymm2, %%ymm0, %%ymm8") \
+            __ASM_EMIT(OP "          %%ymm3, %%ymm1, %%ymm9") \
+            __ASM_EMIT("add             %[mb], %[p_re]") \
+            __ASM_EMIT("add             %[mb], %[p_im]") \
+            LOAD("", "%%ymm0", "%%ymm1", "%%ymm4", "%%ymm5") \
+            LOAD(", %[mb], 4", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5") \
+            __ASM_EMIT(OP "          %%ymm2, %%ymm0, %%ymm10") \
+            __ASM_EMIT(OP "          %%ymm3, %%ymm1, %%ymm11") \
+            __ASM_EMIT("add             %[mb], %[p_re]") \
+            __ASM_EMIT("add             %[mb], %[p_im]") \
+            LOAD("", "%%ymm0", "%%ymm1", "%%ymm4", "%%ymm5") \
+            LOAD(", %[mb], 4", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5") \
+            __ASM_EMIT(OP "          %%ymm2, %%ymm0, %%ymm12") \
+            __ASM_EMIT(OP "          %%ymm3, %%ymm1, %%ymm13") \
+            __ASM_EMIT("add             %[mb], %[p_re]") \
+            __ASM_EMIT("add             %[mb], %[p_im]") \
+            LOAD("", "%%ymm0", "%%ymm1", "%%ymm4", "%%ymm5") \
+            LOAD(", %[mb], 4", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5") \
+            __ASM_EMIT(OP "          %%ymm2, %%ymm0, %%ymm14") \
+            __ASM_EMIT(OP "          %%ymm3, %%ymm1, %%ymm15")
+
+        /*
+         * DFT of size 4 of c[0..3] in ymm8..ymm15:
+         *   out0 -> ymm12, ymm13
+         *   out1 -> ymm14, ymm15
+         *   out2 -> ymm0, ymm1
+         *   out3 -> ymm8, ymm9
+         */
+        #define MFFT_R8_DFT4(OPA, OPB) \
+            __ASM_EMIT("vaddps          %%ymm12, %%ymm8, %%ymm0")           /* ymm0 = t0 = c0 + c2 */ \
+            __ASM_EMIT("vaddps          %%ymm13, %%ymm9, %%ymm1") \
+            __ASM_EMIT("vsubps          %%ymm12, %%ymm8, %%ymm8")           /* ymm8 = t1 = c0 - c2 */ \
+            __ASM_EMIT("vsubps          %%ymm13, %%ymm9, %%ymm9") \
+            __ASM_EMIT("vaddps          %%ymm14, %%ymm10, %%ymm2")          /* ymm2 = t2 = c1 + c3 */ \
+            __ASM_EMIT("vaddps          %%ymm15, %%ymm11, %%ymm3") \
+            __ASM_EMIT("vsubps          %%ymm14, %%ymm10, %%ymm10")         /* ymm10 = t3 = c1 - c3 */ \
+            __ASM_EMIT("vsubps          %%ymm15, %%ymm11, %%ymm11") \
+            __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm12")           /* ymm12 = out0 = t0 + t2 */ \
+            __ASM_EMIT("vaddps          %%ymm3, %%ymm1, %%ymm13") \
+            __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm0")            /* ymm0 = out2 = t0 - t2 */ \
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm1") \
+            __ASM_EMIT(OPA "          %%ymm11, %%ymm8, %%ymm14")            /* ymm14 = out1 = t1 -+ i*t3 */ \
+            __ASM_EMIT(OPB "          %%ymm10, %%ymm9, %%ymm15") \
+            __ASM_EMIT(OPB "          %%ymm11, %%ymm8, %%ymm8")             /* ymm8 = out3 = t1 +- i*t3 */ \
+            __ASM_EMIT(OPA "          %%ymm10, %%ymm9, %%ymm9")
+
+        /*
+         * Multiply c[k] by exp(-i*pi*k/4) for direct FFT
+         */
+        #define MFFT_R8_ROT_DIRECT \
+            __ASM_EMIT("vaddps          %%ymm11, %%ymm10, %%ymm0")          /* ymm0 = R1 + I1 */ \
+            __ASM_EMIT("vsubps          %%ymm10, %%ymm11, %%ymm11")         /* ymm11 = I1 - R1 */ \
+            __ASM_EMIT("vmulps          0x0c0(%[C]), %%ymm0, %%ymm10") \
+            __ASM_EMIT("vmulps          0x0c0(%[C]), %%ymm11, %%ymm11") \
+            __ASM_EMIT("vxorps          0x100(%[C]), %%ymm12, %%ymm0")      /* ymm0 = -R2 */ \
+            __ASM_EMIT("vmovaps         %%ymm13, %%ymm12") \
+            __ASM_EMIT("vmovaps         %%ymm0, %%ymm13") \
+            __ASM_EMIT("vsubps          %%ymm14, %%ymm15, %%ymm0")          /* ymm0 = I3 - R3 */ \
+            __ASM_EMIT("vaddps          %%ymm15, %%ymm14, %%ymm15")         /* ymm15 = R3 + I3 */ \
+            __ASM_EMIT("vmulps          0x0c0(%[C]), %%ymm0, %%ymm14") \
+            __ASM_EMIT("vmulps          0x0e0(%[C]), %%ymm15, %%ymm15")
+
+        /*
+         * Multiply c[k] by exp(i*pi*k/4) for reverse FFT
+         */
+        #define MFFT_R8_ROT_REVERSE \
+            __ASM_EMIT("vsubps          %%ymm11, %%ymm10, %%ymm0")          /* ymm0 = R1 - I1 */ \
+            __ASM_EMIT("vaddps          %%ymm10, %%ymm11, %%ymm11")         /* ymm11 = I1 + R1 */ \
+            __ASM_EMIT("vmulps          0x0c0(%[C]), %%ymm0, %%ymm10") \
+            __ASM_EMIT("vmulps          0x0c0(%[C]), %%ymm11, %%ymm11") \
+            __ASM_EMIT("vxorps          0x100(%[C]), %%ymm13, %%ymm0")      /* ymm0 = -I2 */ \
+            __ASM_EMIT("vmovaps         %%ymm12, %%ymm13") \
+            __ASM_EMIT("vmovaps         %%ymm0, %%ymm12") \
+            __ASM_EMIT("vaddps          %%ymm15, %%ymm14, %%ymm0")          /* ymm0 = R3 + I3 */ \
+            __ASM_EMIT("vsubps          %%ymm15, %%ymm14, %%ymm15")         /* ymm15 = R3 - I3 */ \
+            __ASM_EMIT("vmulps          0x0e0(%[C]), %%ymm0, %%ymm14") \
+            __ASM_EMIT("vmulps          0x0c0(%[C]), %%ymm15, %%ymm15")
+
+        #define MFFT_R8TW(WC, WS, R, I, OPA, OPB) \
+            MFFT_TW("vmovups", WC "(%[tw])", WS "(%[tw])", R, I, "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5", OPA, OPB)
+
+        #define MFFT_R8STORE(OFF, R, I) \
+            __ASM_EMIT("vmovaps         " R ", " OFF "(%[T])") \
+            __ASM_EMIT("vmovaps         " I ", " OFF " + 0x100(%[T])")
+
+        /*
+         * Radix-8 butterfly of the first stage for 8 sub-sequences i..i+7 at once, the
+         * result is stored as 8x8 matrix (rows are outputs, columns are sub-sequences)
+         */
+        #define MFFT_R8_BODY(LOAD, OPA, OPB, ROT) \
+            ARCH_X86_64_ASM \
+            ( \
+                /* Even outputs */ \
+                MFFT_R8_HALF(LOAD, "vaddps") \
+                MFFT_R8_DFT4(OPA, OPB) \
+                MFFT_R8STORE("0x000", "%%ymm12", "%%ymm13") \
+                MFFT_R8TW("0x040", "0x060", "%%ymm14", "%%ymm15", OPA, OPB) \
+                MFFT_R8STORE("0x040", "%%ymm14", "%%ymm15") \
+                MFFT_R8TW("0x0c0", "0x0e0", "%%ymm0", "%%ymm1", OPA, OPB) \
+                MFFT_R8STORE("0x080", "%%ymm0", "%%ymm1") \
+                MFFT_R8TW("0x140", "0x160", "%%ymm8", "%%ymm9", OPA, OPB) \
+                MFFT_R8STORE("0x0c0", "%%ymm8", "%%ymm9") \
+                /* Odd outputs */ \
+                MFFT_R8_HALF(LOAD, "vsubps") \
+                ROT \
+                MFFT_R8_DFT4(OPA, OPB) \
+                MFFT_R8TW("0x000", "0x020", "%%ymm12", "%%ymm13", OPA, OPB) \
+                MFFT_R8STORE("0x020", "%%ymm12", "%%ymm13") \
+                MFFT_R8TW("0x080", "0x0a0", "%%ymm14", "%%ymm15", OPA, OPB) \
+                MFFT_R8STORE("0x060", "%%ymm14", "%%ymm15") \
+                MFFT_R8TW("0x100", "0x120", "%%ymm0", "%%ymm1", OPA, OPB) \
+                MFFT_R8STORE("0x0a0", "%%ymm0", "%%ymm1") \
+                MFFT_R8TW("0x180", "0x1a0", "%%ymm8", "%%ymm9", OPA, OPB) \
+                MFFT_R8STORE("0x0e0", "%%ymm8", "%%ymm9") \
+                : [p_re] "=&r" (p_re), [p_im] "=&r" (p_im) \
+                : [x_re] "r" (x_re), [x_im] "r" (x_im), [mb] "r" (mb), \
+                  [tw] "r" (w), [T] "r" (T), [C] "r" (MIXED_FFT_C) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7", \
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11", \
+                  "%xmm12", "%xmm13", "%xmm14", "%xmm15" \
+            );
+
+        IF_ARCH_X86_64(
+            /**
+             * Transpose 8x8 matrix of floats
+             * @param dst destination matrix
+             * @param src source matrix, should be aligned to 32 bytes
+             */
+            static inline void x64_mixed_fft_transpose8(float *dst, const float *src)
+            {
+                ARCH_X86_64_ASM
+                (
+                    __ASM_EMIT("vmovaps         0x000(%[src]), %%ymm0")
+                    __ASM_EMIT("vmovaps         0x020(%[src]), %%ymm1")
+                    __ASM_EMIT("vmovaps         0x040(%[src]), %%ymm2")
+                    __ASM_EMIT("vmovaps         0x060(%[src]), %%ymm3")
+                    __ASM_EMIT("vmovaps         0x080(%[src]), %%ymm4")
+                    __ASM_EMIT("vmovaps         0x0a0(%[src]), %%ymm5")
+                    __ASM_EMIT("vmovaps         0x0c0(%[src]), %%ymm6")
+                    __ASM_EMIT("vmovaps         0x0e0(%[src]), %%ymm7")
+                    __ASM_EMIT("vunpcklps       %%ymm1, %%ymm0, %%ymm8")        // ymm8  = a0 b0 a1 b1 a4 b4 a5 b5
+                    __ASM_EMIT("vunpckhps       %%ymm1, %%ymm0, %%ymm9")        // ymm9  = a2 b2 a3 b3 a6 b6 a7 b7
+                    __ASM_EMIT("vunpcklps       %%ymm3, %%ymm2, %%ymm10")       // ymm10 = c0 d0 c1 d1 c4 d4 c5 d5
+                    __ASM_EMIT("vunpckhps       %%ymm3, %%ymm2, %%ymm11")       // ymm11 = c2 d2 c3 d3 c6 d6 c7 d7
+                    __ASM_EMIT("vunpcklps       %%ymm5, %%ymm4, %%ymm12")       // ymm12 = e0 f0 e1 f1 e4 f4 e5 f5
+                    __ASM_EMIT("vunpckhps       %%ymm5, %%ymm4, %%ymm13")       // ymm13 = e2 f2 e3 f3 e6 f6 e7 f7
+                    __ASM_EMIT("vunpcklps       %%ymm7, %%ymm6, %%ymm14")       // ymm14 = g0 h0 g1 h1 g4 h4 g5 h5
+                    __ASM_EMIT("vunpckhps       %%ymm7, %%ymm6, %%ymm15")       // ymm15 = g2 h2 g3 h3 g6 h6 g7 h7
+                    __ASM_EMIT("vshufps         $0x44, %%ymm10, %%ymm8, %%ymm0")    // ymm0 = a0 b0 c0 d0 a4 b4 c4 d4
+                    __ASM_EMIT("vshufps         $0xee, %%ymm10, %%ymm8, %%ymm1")    // ymm1 = a1 b1 c1 d1 a5 b5 c5 d5
+                    __ASM_EMIT("vshufps         $0x44, %%ymm11, %%ymm9, %%ymm2")    // ymm2 = a2 b2 c2 d2 a6 b6 c6 d6
+                    __ASM_EMIT("vshufps         $0xee, %%ymm11, %%ymm9, %%ymm3")    // ymm3 = a3 b3 c3 d3 a7 b7 c7 d7
+                    __ASM_EMIT("vshufps         $0x44, %%ymm14, %%ymm12, %%ymm4")   // ymm4 = e0 f0 g0 h0 e4 f4 g4 h4
+                    __ASM_EMIT("vshufps         $0xee, %%ymm14, %%ymm12, %%ymm5")   // ymm5 = e1 f1 g1 h1 e5 f5 g5 h5
+                    __ASM_EMIT("vshufps         $0x44, %%ymm15, %%ymm13, %%ymm6")   // ymm6 = e2 f2 g2 h2 e6 f6 g6 h6
+                    __ASM_EMIT("vshufps         $0xee, %%ymm15, %%ymm13, %%ymm7")   // ymm7 = e3 f3 g3 h3 e7 f7 g7 h7
+                    __ASM_EMIT("vperm2f128      $0x20, %%ymm4, %%ymm0, %%ymm8")     // ymm8 = a0 b0 c0 d0 e0 f0 g0 h0
+                    __ASM_EMIT("vperm2f128      $0x20, %%ymm5, %%ymm1, %%ymm9")
+                    __ASM_EMIT("vperm2f128      $0x20, %%ymm6, %%ymm2, %%ymm10")
+                    __ASM_EMIT("vperm2f128      $0x20, %%ymm7, %%ymm3, %%ymm11")
+                    __ASM_EMIT("vperm2f128      $0x31, %%ymm4, %%ymm0, %%ymm12")    // ymm12 = a4 b4 c4 d4 e4 f4 g4 h4
+                    __ASM_EMIT("vperm2f128      $0x31, %%ymm5, %%ymm1, %%ymm13")
+                    __ASM_EMIT("vperm2f128      $0x31, %%ymm6, %%ymm2, %%ymm14")
+                    __ASM_EMIT("vperm2f128      $0x31, %%ymm7, %%ymm3, %%ymm15")
+                    __ASM_EMIT("vmovups         %%ymm8, 0x000(%[dst])")
+                    __ASM_EMIT("vmovups         %%ymm9, 0x020(%[dst])")
+                    __ASM_EMIT("vmovups         %%ymm10, 0x040(%[dst])")
+                    __ASM_EMIT("vmovups         %%ymm11, 0x060(%[dst])")
+                    __ASM_EMIT("vmovups         %%ymm12, 0x080(%[dst])")
+                    __ASM_EMIT("vmovups         %%ymm13, 0x0a0(%[dst])")
+                    __ASM_EMIT("vmovups         %%ymm14, 0x0c0(%[dst])")
+                    __ASM_EMIT("vmovups         %%ymm15, 0x0e0(%[dst])")
+                    :
+                    : [dst] "r" (dst), [src] "r" (src)
+                    : "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                      "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                      "%xmm12", "%xmm13", "%xmm14", "%xmm15"
+                );
+            }
+
+            /**
+             * Interleave the real and imaginary parts and apply the gain
+             * @param dst destination packed complex array
+             * @param src_re real part of the source
+             * @param src_im imaginary part of the source
+             * @param k gain
+             * @param count number of complex items
+             */
+            static inline void x64_mixed_fft_pack(float *dst, const float *src_re, const float *src_im, float k, size_t count)
+            {
+                size_t blocks = count >> 3;
+                if (blocks > 0)
+                {
+                    ARCH_X86_64_ASM
+                    (
+                        __ASM_EMIT("vbroadcastss    %[k], %%ymm2")
+                        __ASM_EMIT("1:")
+                        __ASM_EMIT("vmulps          (%[src_re]), %%ymm2, %%ymm0")       // ymm0 = r0 r1 r2 r3 r4 r5 r6 r7
+                        __ASM_EMIT("vmulps          (%[src_im]), %%ymm2, %%ymm1")       // ymm1 = i0 i1 i2 i3 i4 i5 i6 i7
+                        __ASM_EMIT("vunpcklps       %%ymm1, %%ymm0, %%ymm3")            // ymm3 = r0 i0 r1 i1 r4 i4 r5 i5
+                        __ASM_EMIT("vunpckhps       %%ymm1, %%ymm0, %%ymm4")            // ymm4 = r2 i2 r3 i3 r6 i6 r7 i7
+                        __ASM_EMIT("vperm2f128      $0x20, %%ymm4, %%ymm3, %%ymm0")     // ymm0 = r0 i0 r1 i1 r2 i2 r3 i3
+                        __ASM_EMIT("vperm2f128      $0x31, %%ymm4, %%ymm3, %%ymm1")     // ymm1 = r4 i4 r5 i5 r6 i6 r7 i7
+                        __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+                        __ASM_EMIT("vmovups         %%ymm1, 0x20(%[dst])")
+                        __ASM_EMIT("add             $0x20, %[src_re]")
+                        __ASM_EMIT("add             $0x20, %[src_im]")
+                        __ASM_EMIT("add             $0x40, %[dst]")
+                        __ASM_EMIT("dec             %[blocks]")
+                        __ASM_EMIT("jnz             1b")
+                        : [dst] "+r" (dst), [src_re] "+r" (src_re), [src_im] "+r" (src_im),
+                          [blocks] "+r" (blocks)
+                        : [k] "m" (k)
+                        : "cc", "memory",
+                          "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                          "%xmm4"
+                    );
+                }
+
+                for (size_t i=0, n=count & 7; i<n; ++i)
+                {
+                    dst[i*2]            = src_re[i] * k;
+                    dst[i*2 + 1]        = src_im[i] * k;
+                }
+            }
+        )
+
+        #define MFFT_FIRST8_FUNC(NAME, LOAD, OPA, OPB, ROT, D) \
+            static void NAME(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t xs, \
+                const float *tw, size_t m) \
+            { \
+                float T[128] __lsp_aligned32; \
+                const float *p_re, *p_im; \
+                const float *w  = tw; \
+                size_t mb       = m * xs * sizeof(float); \
+                size_t i        = 0; \
+                \
+                for ( ; (i + 8) <= m; i += 8, w += 7*16) \
+                { \
+                    const float *x_re   = &src_re[i * xs]; \
+                    const float *x_im   = &src_im[i * xs]; \
+                    MFFT_R8_BODY(LOAD, OPA, OPB, ROT) \
+                    x64_mixed_fft_transpose8(&dst_re[i * 8], &T[0]); \
+                    x64_mixed_fft_transpose8(&dst_im[i * 8], &T[64]); \
+                } \
+                \
+                if (i < m) \
+                    mixed_fft_scalar_stage(dst_re, dst_im, src_re, src_im, xs, tw, 8, 1, m, i, D); \
+            }
+
+        #define MFFT_QSTAGE_FUNC(NAME, OPA, OPB) \
+            static void NAME(float *dst_re, float *dst_im, const float *src_re, const float *src_im, \
+                const float *tw, size_t p, size_t s, size_t m) \
+            { \
+                size_t xk       = s * m * sizeof(float); \
+                size_t yk       = s * sizeof(float); \
+                \
+                for (size_t i=0; i<m; ++i) \
+                { \
+                    const float *w      = &tw[(i >> 3) * (p - 1) * 16 + (i & 7)]; \
+                    const float *x_re   = &src_re[s * i]; \
+                    const float *x_im   = &src_im[s * i]; \
+                    float *y_re         = &dst_re[s * p * i]; \
+                    float *y_im         = &dst_im[s * p * i]; \
+                    size_t count        = s >> 3; \
+                    \
+                    switch (p) \
+                    { \
+                        case 2: MFFT_QRADIX2(OPA, OPB); break; \
+                        case 3: MFFT_QRADIX3(OPA, OPB); break; \
+                        case 4: MFFT_QRADIX4(OPA, OPB); break; \
+                        case 5: MFFT_QRADIX5(OPA, OPB); break; \
+                        default: break; \
+                    } \
+                } \
+            }
+
+        IF_ARCH_X86_64(
+            MFFT_FIRST8_FUNC(x64_mixed_fft_first8_direct, MFFT_R8LOAD_SPLIT, "vaddps", "vsubps", MFFT_R8_ROT_DIRECT, -1.0f)
+            MFFT_FIRST8_FUNC(x64_mixed_fft_first8_reverse, MFFT_R8LOAD_SPLIT, "vsubps", "vaddps", MFFT_R8_ROT_REVERSE, 1.0f)
+            MFFT_FIRST8_FUNC(x64_packed_mixed_fft_first8_direct, MFFT_R8LOAD_PACKED, "vaddps", "vsubps", MFFT_R8_ROT_DIRECT, -1.0f)
+            MFFT_FIRST8_FUNC(x64_packed_mixed_fft_first8_reverse, MFFT_R8LOAD_PACKED, "vsubps", "vaddps", MFFT_R8_ROT_REVERSE, 1.0f)
+            MFFT_QSTAGE_FUNC(x64_mixed_fft_qstage_direct, "vaddps", "vsubps")
+            MFFT_QSTAGE_FUNC(x64_mixed_fft_qstage_reverse, "vsubps", "vaddps")
+
+            static inline size_t x64_mixed_fft_stage_size(size_t p, size_t m)
+            {
+                return ((m + 7) >> 3) * (p - 1) * 16;
+            }
+
+            /**
+             * Perform one stage of the mixed-radix FFT choosing the best suitable kernel
+             */
+            static void x64_mixed_fft_stage(float *y_re, float *y_im, const float *x_re, const float *x_im, size_t xs,
+                const float *tw, size_t p, size_t s, size_t m, float d)
+            {
+                if ((p == 8) && (s == 1))
+                {
+                    if (xs == 1)
+                    {
+                        if (d < 0.0f)
+                            x64_mixed_fft_first8_direct(y_re, y_im, x_re, x_im, xs, tw, m);
+                        else
+                            x64_mixed_fft_first8_reverse(y_re, y_im, x_re, x_im, xs, tw, m);
+                    }
+                    else
+                    {
+                        if (d < 0.0f)
+                            x64_packed_mixed_fft_first8_direct(y_re, y_im, x_re, x_im, xs, tw, m);
+                        else
+                            x64_packed_mixed_fft_first8_reverse(y_re, y_im, x_re, x_im, xs, tw, m);
+                    }
+                }
+                else if ((xs == 1) && (p <= 5) && (!(s & 7)))
+                {
+                    if (d < 0.0f)
+                        x64_mixed_fft_qstage_direct(y_re, y_im, x_re, x_im, tw, p, s, m);
+                    else
+                        x64_mixed_fft_qstage_reverse(y_re, y_im, x_re, x_im, tw, p, s, m);
+                }
+                else
+                    mixed_fft_scalar_stage(y_re, y_im, x_re, x_im, xs, tw, p, s, m, 0, d);
+            }
+
+            static void x64_mixed_fft_split(const dsp::mixed_fft_plan_t *plan,
+                float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp, float d)
+            {
+                size_t size         = plan->size;
+                size_t stages       = plan->stages;
+                if (stages == 0)
+                {
+                    dst_re[0]           = src_re[0];
+                    dst_im[0]           = src_im[0];
+                    return;
+                }
+
+                // The last stage should write the result to the destination buffer
+                float *b_re[2]      = { dst_re, tmp };
+                float *b_im[2]      = { dst_im, &tmp[size] };
+                if ((stages & 1) && ((dst_re == src_re) || (dst_im == src_im)))
+                {
+                    avx::copy(b_re[1], src_re, size);
+                    avx::copy(b_im[1], src_im, size);
+                    src_re              = b_re[1];
+                    src_im              = b_im[1];
+                }
+
+                const float *tw     = plan->twiddle;
+                for (size_t i=0, s=1; i<stages; ++i)
+                {
+                    size_t p            = plan->radix[i];
+                    size_t m            = size / (s * p);
+                    size_t o            = (stages - i - 1) & 1;
+
+                    x64_mixed_fft_stage(b_re[o], b_im[o], src_re, src_im, 1, tw, p, s, m, d);
+
+                    src_re              = b_re[o];
+                    src_im              = b_im[o];
+                    tw                 += x64_mixed_fft_stage_size(p, m);
+                    s                  *= p;
+                }
+            }
+
+            static void x64_mixed_fft_packed(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp, float d, float k)
+            {
+                size_t size         = plan->size;
+                size_t stages       = plan->stages;
+                if (stages == 0)
+                {
+                    dst[0]              = src[0] * k;
+                    dst[1]              = src[1] * k;
+                    return;
+                }
+
+                // The last stage should write the result to the temporary buffer
+                float *b_re[2]      = { dst, tmp };
+                float *b_im[2]      = { &dst[size], &tmp[size] };
+                if ((!(stages & 1)) && (dst == src))
+                {
+                    avx::copy(tmp, src, size * 2);
+                    src                 = tmp;
+                }
+
+                const float *tw     = plan->twiddle;
+                const float *s_re   = &src[0];
+                const float *s_im   = &src[1];
+                size_t xs           = 2;
+                for (size_t i=0, s=1; i<stages; ++i)
+                {
+                    size_t p            = plan->radix[i];
+                    size_t m            = size / (s * p);
+                    size_t o            = (stages - i) & 1;
+
+                    x64_mixed_fft_stage(b_re[o], b_im[o], s_re, s_im, xs, tw, p, s, m, d);
+
+                    s_re                = b_re[o];
+                    s_im                = b_im[o];
+                    xs                  = 1;
+                    tw                 += x64_mixed_fft_stage_size(p, m);
+                    s                  *= p;
+                }
+
+                x64_mixed_fft_pack(dst, s_re, s_im, k, size);
+            }
+
+            void x64_mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp)
+            {
+                x64_mixed_fft_split(plan, dst_re, dst_im, src_re, src_im, tmp, -1.0f);
+            }
+
+            void x64_mixed_reverse_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp)
+            {
+                x64_mixed_fft_split(plan, dst_re, dst_im, src_re, src_im, tmp, 1.0f);
+
+                float k = 1.0f / plan->size;
+                avx::mul_k2(dst_re, k, plan->size);
+                avx::mul_k2(dst_im, k, plan->size);
+            }
+
+            void x64_packed_mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp)
+            {
+                x64_mixed_fft_packed(plan, dst, src, tmp, -1.0f, 1.0f);
+            }
+
+            void x64_packed_mixed_reverse_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp)
+            {
+                x64_mixed_fft_packed(plan, dst, src, tmp, 1.0f, 1.0f / plan->size);
+            }
+        )
+
+        #undef MFFT_QSTAGE_FUNC
+        #undef MFFT_FIRST8_FUNC
+        #undef MFFT_R8_BODY
+        #undef MFFT_R8STORE
+        #undef MFFT_R8TW
+        #undef MFFT_R8_ROT_REVERSE
+        #undef MFFT_R8_ROT_DIRECT
+        #undef MFFT_R8_DFT4
+        #undef MFFT_R8_HALF
+        #undef MFFT_R8LOAD_PACKED
+        #undef MFFT_R8LOAD_SPLIT
+        #undef MFFT_QRADIX5
+        #undef MFFT_QRADIX4
+        #undef MFFT_QRADIX3
+        #undef MFFT_QRADIX2
+        #undef MFFT_QLOOP_END
+        #undef MFFT_STORE2
+        #undef MFFT_LOAD2
+        #undef MFFT_QTW
+        #undef MFFT_TW
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_MIXED_FFT_H_ */
@@ -1531,6 +1531,168 @@ namespace lsp
             );
         }
 
+        void pcomplex_r2c_mul3(float *dst, const float *src1, const float *src2, size_t count)
+        {
+            IF_ARCH_X86(size_t off);
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor                     %[off], %[off]")
+                __ASM_EMIT("vxorps                  %%ymm6, %%ymm6, %%ymm6")
+                /* x16 blocks */
+                __ASM_EMIT("sub                     $16, %[count]")
+                __ASM_EMIT("jb                      2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups                 0x00(%[src1], %[off]), %%ymm0")             /* ymm0 = a0 a1 a2 a3 a4 a5 a6 a7 */
+                __ASM_EMIT("vmovups                 0x20(%[src1], %[off]), %%ymm1")
+                __ASM_EMIT("vmulps                  0x00(%[src2], %[off]), %%ymm0, %%ymm0")     /* ymm0 = s0 s1 s2 s3 s4 s5 s6 s7 */
+                __ASM_EMIT("vmulps                  0x20(%[src2], %[off]), %%ymm1, %%ymm1")
+                __ASM_EMIT("vunpcklps               %%ymm6, %%ymm0, %%ymm2")                    /* ymm2 = s0 0 s1 0 s4 0 s5 0 */
+                __ASM_EMIT("vunpckhps               %%ymm6, %%ymm0, %%ymm0")                    /* ymm0 = s2 0 s3 0 s6 0 s7 0 */
+                __ASM_EMIT("vunpcklps               %%ymm6, %%ymm1, %%ymm3")
+                __ASM_EMIT("vunpckhps               %%ymm6, %%ymm1, %%ymm1")
+                __ASM_EMIT("vperm2f128              $0x20, %%ymm0, %%ymm2, %%ymm4")             /* ymm4 = s0 0 s1 0 s2 0 s3 0 */
+                __ASM_EMIT("vperm2f128              $0x31, %%ymm0, %%ymm2, %%ymm0")             /* ymm0 = s4 0 s5 0 s6 0 s7 0 */
+                __ASM_EMIT("vperm2f128              $0x20, %%ymm1, %%ymm3, %%ymm5")
+                __ASM_EMIT("vperm2f128              $0x31, %%ymm1, %%ymm3, %%ymm1")
+                __ASM_EMIT("vmovups                 %%ymm4, 0x00(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%ymm0, 0x20(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%ymm5, 0x40(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%ymm1, 0x60(%[dst], %[off], 2)")
+                __ASM_EMIT("add                     $0x40, %[off]")
+                __ASM_EMIT("sub                     $16, %[count]")
+                __ASM_EMIT("jae                     1b")
+                /* x8 block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add                     $8, %[count]")
+                __ASM_EMIT("jl                      4f")
+                __ASM_EMIT("vmovups                 0x00(%[src1], %[off]), %%xmm0")             /* xmm0 = a0 a1 a2 a3 */
+                __ASM_EMIT("vmovups                 0x10(%[src1], %[off]), %%xmm1")
+                __ASM_EMIT("vmulps                  0x00(%[src2], %[off]), %%xmm0, %%xmm0")     /* xmm0 = s0 s1 s2 s3 */
+                __ASM_EMIT("vmulps                  0x10(%[src2], %[off]), %%xmm1, %%xmm1")
+                __ASM_EMIT("vunpcklps               %%xmm6, %%xmm0, %%xmm2")                    /* xmm2 = s0 0 s1 0 */
+                __ASM_EMIT("vunpckhps               %%xmm6, %%xmm0, %%xmm0")                    /* xmm0 = s2 0 s3 0 */
+                __ASM_EMIT("vunpcklps               %%xmm6, %%xmm1, %%xmm3")
+                __ASM_EMIT("vunpckhps               %%xmm6, %%xmm1, %%xmm1")
+                __ASM_EMIT("vmovups                 %%xmm2, 0x00(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%xmm0, 0x10(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%xmm3, 0x20(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%xmm1, 0x30(%[dst], %[off], 2)")
+                __ASM_EMIT("sub                     $8, %[count]")
+                __ASM_EMIT("add                     $0x20, %[off]")
+                /* x4 block */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add                     $4, %[count]")
+                __ASM_EMIT("jl                      6f")
+                __ASM_EMIT("vmovups                 0x00(%[src1], %[off]), %%xmm0")             /* xmm0 = a0 a1 a2 a3 */
+                __ASM_EMIT("vmulps                  0x00(%[src2], %[off]), %%xmm0, %%xmm0")     /* xmm0 = s0 s1 s2 s3 */
+                __ASM_EMIT("vunpcklps               %%xmm6, %%xmm0, %%xmm2")                    /* xmm2 = s0 0 s1 0 */
+                __ASM_EMIT("vunpckhps               %%xmm6, %%xmm0, %%xmm0")                    /* xmm0 = s2 0 s3 0 */
+                __ASM_EMIT("vmovups                 %%xmm2, 0x00(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%xmm0, 0x10(%[dst], %[off], 2)")
+                __ASM_EMIT("sub                     $4, %[count]")
+                __ASM_EMIT("add                     $0x10, %[off]")
+                /* x1 blocks */
+                __ASM_EMIT("6:")
+                __ASM_EMIT("add                     $3, %[count]")
+                __ASM_EMIT("jl                      8f")
+                __ASM_EMIT("7:")
+                __ASM_EMIT("vmovss                  0x00(%[src1], %[off]), %%xmm0")             /* xmm0 = a0 0 */
+                __ASM_EMIT("vmulss                  0x00(%[src2], %[off]), %%xmm0, %%xmm0")     /* xmm0 = s0 0 */
+                __ASM_EMIT("vmovlps                 %%xmm0, 0x00(%[dst], %[off], 2)")
+                __ASM_EMIT("add                     $0x04, %[off]")
+                __ASM_EMIT("dec                     %[count]")
+                __ASM_EMIT("jge                     7b")
+                __ASM_EMIT("8:")
+
+                : [count] "+r" (count), [off] "=&r" (off)
+                : [dst] "r" (dst), [src1] "r" (src1), [src2] "r" (src2)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6"
+            );
+        }
+
+        void pcomplex_c2r_fmadd3(float *dst, const float *src, const float *k, size_t count)
+        {
+            IF_ARCH_X86(size_t off);
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor                     %[off], %[off]")
+                /* x16 blocks */
+                __ASM_EMIT("sub                     $16, %[count]")
+                __ASM_EMIT("jb                      2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups                 0x00(%[src], %[off], 2), %%ymm0")           /* ymm0 = r0 i0 r1 i1 r2 i2 r3 i3 */
+                __ASM_EMIT("vmovups                 0x20(%[src], %[off], 2), %%ymm1")           /* ymm1 = r4 i4 r5 i5 r6 i6 r7 i7 */
+                __ASM_EMIT("vmovups                 0x40(%[src], %[off], 2), %%ymm2")
+                __ASM_EMIT("vmovups                 0x60(%[src], %[off], 2), %%ymm3")
+                __ASM_EMIT("vperm2f128              $0x20, %%ymm1, %%ymm0, %%ymm4")             /* ymm4 = r0 i0 r1 i1 r4 i4 r5 i5 */
+                __ASM_EMIT("vperm2f128              $0x31, %%ymm1, %%ymm0, %%ymm0")             /* ymm0 = r2 i2 r3 i3 r6 i6 r7 i7 */
+                __ASM_EMIT("vperm2f128              $0x20, %%ymm3, %%ymm2, %%ymm5")
+                __ASM_EMIT("vperm2f128              $0x31, %%ymm3, %%ymm2, %%ymm2")
+                __ASM_EMIT("vshufps                 $0x88, %%ymm0, %%ymm4, %%ymm0")             /* ymm0 = r0 r1 r2 r3 r4 r5 r6 r7 */
+                __ASM_EMIT("vshufps                 $0x88, %%ymm2, %%ymm5, %%ymm2")
+                __ASM_EMIT("vmulps                  0x00(%[k], %[off]), %%ymm0, %%ymm0")        /* ymm0 = r*k */
+                __ASM_EMIT("vmulps                  0x20(%[k], %[off]), %%ymm2, %%ymm2")
+                __ASM_EMIT("vaddps                  0x00(%[dst], %[off]), %%ymm0, %%ymm0")      /* ymm0 = d + r*k */
+                __ASM_EMIT("vaddps                  0x20(%[dst], %[off]), %%ymm2, %%ymm2")
+                __ASM_EMIT("vmovups                 %%ymm0, 0x00(%[dst], %[off])")
+                __ASM_EMIT("vmovups                 %%ymm2, 0x20(%[dst], %[off])")
+                __ASM_EMIT("add                     $0x40, %[off]")
+                __ASM_EMIT("sub                     $16, %[count]")
+                __ASM_EMIT("jae                     1b")
+                /* x8 block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add                     $8, %[count]")
+                __ASM_EMIT("jl                      4f")
+                __ASM_EMIT("vmovups                 0x00(%[src], %[off], 2), %%xmm0")           /* xmm0 = r0 i0 r1 i1 */
+                __ASM_EMIT("vmovups                 0x10(%[src], %[off], 2), %%xmm1")           /* xmm1 = r2 i2 r3 i3 */
+                __ASM_EMIT("vmovups                 0x20(%[src], %[off], 2), %%xmm2")
+                __ASM_EMIT("vmovups                 0x30(%[src], %[off], 2), %%xmm3")
+                __ASM_EMIT("vshufps                 $0x88, %%xmm1, %%xmm0, %%xmm0")             /* xmm0 = r0 r1 r2 r3 */
+                __ASM_EMIT("vshufps                 $0x88, %%xmm3, %%xmm2, %%xmm2")
+                __ASM_EMIT("vmulps                  0x00(%[k], %[off]), %%xmm0, %%xmm0")        /* xmm0 = r*k */
+                __ASM_EMIT("vmulps                  0x10(%[k], %[off]), %%xmm2, %%xmm2")
+                __ASM_EMIT("vaddps                  0x00(%[dst], %[off]), %%xmm0, %%xmm0")      /* xmm0 = d + r*k */
+                __ASM_EMIT("vaddps                  0x10(%[dst], %[off]), %%xmm2, %%xmm2")
+                __ASM_EMIT("vmovups                 %%xmm0, 0x00(%[dst], %[off])")
+                __ASM_EMIT("vmovups                 %%xmm2, 0x10(%[dst], %[off])")
+                __ASM_EMIT("sub                     $8, %[count]")
+                __ASM_EMIT("add                     $0x20, %[off]")
+                /* x4 block */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add                     $4, %[count]")
+                __ASM_EMIT("jl                      6f")
+                __ASM_EMIT("vmovups                 0x00(%[src], %[off], 2), %%xmm0")           /* xmm0 = r0 i0 r1 i1 */
+                __ASM_EMIT("vmovups                 0x10(%[src], %[off], 2), %%xmm1")           /* xmm1 = r2 i2 r3 i3 */
+                __ASM_EMIT("vshufps                 $0x88, %%xmm1, %%xmm0, %%xmm0")             /* xmm0 = r0 r1 r2 r3 */
+                __ASM_EMIT("vmulps                  0x00(%[k], %[off]), %%xmm0, %%xmm0")        /* xmm0 = r*k */
+                __ASM_EMIT("vaddps                  0x00(%[dst], %[off]), %%xmm0, %%xmm0")      /* xmm0 = d + r*k */
+                __ASM_EMIT("vmovups                 %%xmm0, 0x00(%[dst], %[off])")
+                __ASM_EMIT("sub                     $4, %[count]")
+                __ASM_EMIT("add                     $0x10, %[off]")
+                /* x1 blocks */
+                __ASM_EMIT("6:")
+                __ASM_EMIT("add                     $3, %[count]")
+                __ASM_EMIT("jl                      8f")
+                __ASM_EMIT("7:")
+                __ASM_EMIT("vmovss                  0x00(%[src], %[off], 2), %%xmm0")           /* xmm0 = r0 */
+                __ASM_EMIT("vmulss                  0x00(%[k], %[off]), %%xmm0, %%xmm0")        /* xmm0 = r0*k0 */
+                __ASM_EMIT("vaddss                  0x00(%[dst], %[off]), %%xmm0, %%xmm0")      /* xmm0 = d0 + r0*k0 */
+                __ASM_EMIT("vmovss                  %%xmm0, 0x00(%[dst], %[off])")
+                __ASM_EMIT("add                     $0x04, %[off]")
+                __ASM_EMIT("dec                     %[count]")
+                __ASM_EMIT("jge                     7b")
+                __ASM_EMIT("8:")
+
+                : [count] "+r" (count), [off] "=&r" (off)
+                : [dst] "r" (dst), [src] "r" (src), [k] "r" (k)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+        }
+
     } /* namespace avx */
 } /* namespace lsp */
 
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_RFFT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_RFFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+#include <private/dsp/arch/generic/fft/real_small.h>
+#include <private/dsp/arch/x86/avx/fft/const.h>
+#include <private/dsp/arch/x86/avx/fft/r_split.h>
+
+namespace lsp
+{
+    namespace avx
+    {
+        /*
+         * The complex FFT of half size is computed by packed_direct_fft and packed_reverse_fft
+         * of the same instruction set, the split pass converts it into the spectrum of real FFT.
+         */
+        static inline void real_split_direct_x1(float *dst, size_t rank)
+        {
+            const float *w  = &FFT_A[(rank - 3) << 4];
+            generic::real_split_direct_x1(dst, &w[0], &w[8], rank);
+        }
+
+        static inline void real_split_reverse_x1(float *dst, const float *src, size_t rank)
+        {
+            const float *w  = &FFT_A[(rank - 3) << 4];
+            generic::real_split_reverse_x1(dst, src, &w[0], &w[8], rank);
+        }
+
+        void real_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                generic::real_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            packed_direct_fft(dst, src, rank - 1);
+            generic::real_fft_split_dc(dst, rank);
+            if (rank < 5)
+                real_split_direct_x1(dst, rank);
+            else
+                real_split_direct(dst, rank);
+        }
+
+        void real_direct_fft_fma3(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                generic::real_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            packed_direct_fft_fma3(dst, src, rank - 1);
+            generic::real_fft_split_dc(dst, rank);
+            if (rank < 5)
+                real_split_direct_x1(dst, rank);
+            else
+                real_split_direct_fma3(dst, rank);
+        }
+
+        void real_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                generic::real_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            generic::real_fft_join_dc(dst, src, rank);
+            if (rank < 5)
+                real_split_reverse_x1(dst, src, rank);
+            else
+                real_split_reverse(dst, src, rank);
+            packed_reverse_fft(dst, dst, rank - 1);
+        }
+
+        void real_reverse_fft_fma3(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                generic::real_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            generic::real_fft_join_dc(dst, src, rank);
+            if (rank < 5)
+                real_split_reverse_x1(dst, src, rank);
+            else
+                real_split_reverse_fma3(dst, src, rank);
+            packed_reverse_fft_fma3(dst, dst, rank - 1);
+        }
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_RFFT_H_ */
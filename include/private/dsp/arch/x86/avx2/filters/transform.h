@@ -0,0 +1,773 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_FILTERS_TRANSFORM_H_
+#define PRIVATE_DSP_ARCH_X86_AVX2_FILTERS_TRANSFORM_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_IMPL */
+
+#include <private/dsp/arch/x86/avx2/pmath/exp.h>
+
+#define MATCHED_BATCH           64          /* Number of second-order polynoms solved at once */
+
+namespace lsp
+{
+    namespace avx2
+    {
+        IF_ARCH_X86(
+            static const uint32_t MATCHED_CONST[] __lsp_aligned32 =
+            {
+                LSP_DSP_VEC8(0x80000000),   // sign
+                LSP_DSP_VEC8(0x7fffffff),   // abs
+                LSP_DSP_VEC8(0x3c23d70a),   // 0.01
+                LSP_DSP_VEC8(0x3dcccccd),   // 0.1
+                LSP_DSP_VEC8(0x40800000),   // 4.0
+                LSP_DSP_VEC8(0x3e22f983),   // 1/(2*PI)
+                LSP_DSP_VEC8(0x3f000000),   // 0.5
+                LSP_DSP_VEC8(0x40c90fdb),   // 2*PI
+                LSP_DSP_VEC8(0x3fc90fdb),   // PI/2
+                LSP_DSP_VEC8(0xb2d7322b),   // -1/11!
+                LSP_DSP_VEC8(0x3638ef1d),   // 1/9!
+                LSP_DSP_VEC8(0xb9500d01),   // -1/7!
+                LSP_DSP_VEC8(0x3c088889),   // 1/5!
+                LSP_DSP_VEC8(0xbe2aaaab),   // -1/3!
+                LSP_DSP_VEC8(0x3f800000),   // 1.0
+                LSP_DSP_VEC8(0x3ea2f983),   // 1/PI
+                LSP_DSP_VEC8(0x40490fdb),   // PI
+                LSP_DSP_VEC8(0x39500d01),   // 1/7!
+                LSP_DSP_VEC8(0x3ab60b61),   // 1/6!
+                LSP_DSP_VEC8(0x3c088889),   // 1/5!
+                LSP_DSP_VEC8(0x3d2aaaab),   // 1/4!
+                LSP_DSP_VEC8(0x3e2aaaab)    // 1/3!
+            };
+        )
+
+        typedef void (* matched_solve_t)(float * const *vp, size_t count, const float *w);
+
+        typedef struct matched_ctx_t
+        {
+            float           w[88] __lsp_aligned32;  // td*kf/2, td*kf/20 and temporaries, 8 copies each
+            float          *vp[MATCHED_BATCH + 7];  // Batch of second-order polynoms
+            size_t          n;                      // Number of polynoms in the batch
+            matched_solve_t solve;                  // Batch solving routine
+        } matched_ctx_t;
+
+        /*
+         * Sine of ymm0 = y in range [-PI/2, PI/2], the result is stored in ymm3, ymm2 is clobbered
+         */
+        #define MATCHED_SIN_X8 \
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm0, %%ymm2")                /* ymm2 = y2 = y*y */ \
+            __ASM_EMIT("vmulps          0x120 + %[MC], %%ymm2, %%ymm3")         /* ymm3 = S5*y2 */ \
+            __ASM_EMIT("vaddps          0x140 + %[MC], %%ymm3, %%ymm3")         /* ymm3 = S4 + S5*y2 */ \
+            __ASM_EMIT("vmulps          %%ymm2, %%ymm3, %%ymm3") \
+            __ASM_EMIT("vaddps          0x160 + %[MC], %%ymm3, %%ymm3")         /* ymm3 = S3 + y2*(S4 + S5*y2) */ \
+            __ASM_EMIT("vmulps          %%ymm2, %%ymm3, %%ymm3") \
+            __ASM_EMIT("vaddps          0x180 + %[MC], %%ymm3, %%ymm3")         /* ymm3 = S2 + y2*(S3 + y2*(S4 + S5*y2)) */ \
+            __ASM_EMIT("vmulps          %%ymm2, %%ymm3, %%ymm3") \
+            __ASM_EMIT("vaddps          0x1a0 + %[MC], %%ymm3, %%ymm3")         /* ymm3 = S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2))) */ \
+            __ASM_EMIT("vmulps          %%ymm2, %%ymm3, %%ymm3") \
+            __ASM_EMIT("vaddps          0x1c0 + %[MC], %%ymm3, %%ymm3")         /* ymm3 = 1 + y2*(S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2)))) */ \
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm3, %%ymm3")                /* ymm3 = sin(y) */
+
+        /*
+         * Compute sqrt(Q) = sqrt(expm1(x)^2 + 4*exp(x)*sin(y)^2) for ymm0 = x, ymm1 = exp(x), ymm2 = y,
+         * the result is stored in ymm0, ymm1..ymm4 are clobbered. The expm1(x) is computed by the
+         * Taylor series for abs(x) < 0.5 to keep the precision when exp(x) is close to 1
+         */
+        #define MATCHED_AMP_X8 \
+            __ASM_EMIT("vandps          0x020 + %[MC], %%ymm0, %%ymm3")         /* ymm3 = abs(x) */ \
+            __ASM_EMIT("vmulps          0x220 + %[MC], %%ymm0, %%ymm4")         /* ymm4 = x/7! */ \
+            __ASM_EMIT("vcmpltps        0x0c0 + %[MC], %%ymm3, %%ymm3")         /* ymm3 = [abs(x) < 0.5] */ \
+            __ASM_EMIT("vaddps          0x240 + %[MC], %%ymm4, %%ymm4")         /* ymm4 = 1/6! + x/7! */ \
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm4, %%ymm4") \
+            __ASM_EMIT("vaddps          0x260 + %[MC], %%ymm4, %%ymm4")         /* ymm4 = 1/5! + x*(...) */ \
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm4, %%ymm4") \
+            __ASM_EMIT("vaddps          0x280 + %[MC], %%ymm4, %%ymm4")         /* ymm4 = 1/4! + x*(...) */ \
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm4, %%ymm4") \
+            __ASM_EMIT("vaddps          0x2a0 + %[MC], %%ymm4, %%ymm4")         /* ymm4 = 1/3! + x*(...) */ \
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm4, %%ymm4") \
+            __ASM_EMIT("vaddps          0x0c0 + %[MC], %%ymm4, %%ymm4")         /* ymm4 = 1/2! + x*(...) */ \
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm4, %%ymm4") \
+            __ASM_EMIT("vaddps          0x1c0 + %[MC], %%ymm4, %%ymm4")         /* ymm4 = 1 + x*(...) */ \
+            __ASM_EMIT("vmulps          %%ymm4, %%ymm0, %%ymm0")                /* ymm0 = x*(1 + x*(...)) */ \
+            __ASM_EMIT("vsubps          0x1c0 + %[MC], %%ymm1, %%ymm4")         /* ymm4 = exp(x) - 1 */ \
+            __ASM_EMIT("vblendvps       %%ymm3, %%ymm0, %%ymm4, %%ymm3")        /* ymm3 = M = expm1(x) */ \
+            __ASM_EMIT("vmulps          %%ymm3, %%ymm3, %%ymm3")                /* ymm3 = M*M */ \
+            __ASM_EMIT("vmulps          0x080 + %[MC], %%ymm1, %%ymm1")         /* ymm1 = 4*exp(x) */ \
+            __ASM_EMIT("vmovaps         %%ymm3, 0x140(%[w])") \
+            /* sin(y)^2 = sin(y - PI*n)^2 */ \
+            __ASM_EMIT("vandps          0x020 + %[MC], %%ymm2, %%ymm2")         /* ymm2 = abs(y) */ \
+            __ASM_EMIT("vmulps          0x1e0 + %[MC], %%ymm2, %%ymm0")         /* ymm0 = abs(y)/PI */ \
+            __ASM_EMIT("vaddps          0x0c0 + %[MC], %%ymm0, %%ymm0")         /* ymm0 = abs(y)/PI + 0.5 */ \
+            __ASM_EMIT("vcvttps2dq      %%ymm0, %%ymm0") \
+            __ASM_EMIT("vcvtdq2ps       %%ymm0, %%ymm0")                        /* ymm0 = n = int(abs(y)/PI + 0.5) */ \
+            __ASM_EMIT("vmulps          0x200 + %[MC], %%ymm0, %%ymm0")         /* ymm0 = PI*n */ \
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm2, %%ymm0")                /* ymm0 = abs(y) - PI*n */ \
+            MATCHED_SIN_X8                                                      /* ymm3 = sin(y) */ \
+            __ASM_EMIT("vmulps          %%ymm3, %%ymm3, %%ymm3")                /* ymm3 = sin(y)^2 */ \
+            __ASM_EMIT("vmulps          %%ymm3, %%ymm1, %%ymm1")                /* ymm1 = 4*exp(x)*sin(y)^2 */ \
+            __ASM_EMIT("vaddps          0x140(%[w]), %%ymm1, %%ymm1")           /* ymm1 = Q = M*M + 4*exp(x)*sin(y)^2 */ \
+            __ASM_EMIT("vsqrtps         %%ymm1, %%ymm0")                        /* ymm0 = sqrt(Q) */
+
+        /*
+         * Solve the batch of second-order polynoms, count should be multiple of 8:
+         *   p[0] = k, p[1] = -k*(exp(R0*T) + exp(R1*T)), p[2] = k*exp((R0+R1)*T) for real roots R0 and R1
+         *   p[0] = k, p[1] = -2*k*exp(R*T)*cos(K*T), p[2] = k*exp(2*R*T) for complex roots R+j*K and R-j*K
+         * Both cases are computed by the same formula
+         *   p[1] = -k*(exp(m - wr) + exp(m + wr))*cos(wc), p[2] = k*exp(m - wr)*exp(m + wr)
+         * where m = -R*T, wr = sqrt(D)*T/2 for D >= 0 and wc = sqrt(-D)*T/2 for D < 0
+         *
+         * The amplitude of the transformed polynom at the control frequency w is computed by roots:
+         *   A = abs(k) * sqrt(Q(m - wr, v - wc/2)) * sqrt(Q(m + wr, v + wc/2)), v = w/2
+         *   Q(x, y) = expm1(x)^2 + 4*exp(x)*sin(y)^2
+         * and p[3] receives the ratio of the continuous transfer function amplitude to A
+         */
+        #define MATCHED_SOLVE_X8(EXP_CORE) \
+            IF_ARCH_X86(float *p); \
+            \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                /* Load polynoms and transpose */ \
+                __ASM_EMIT("mov             " __IF_32_64("0x00", "0x00") "(%[vp]), %[p]") \
+                __ASM_EMIT("vmovups         0x00(%[p]), %%xmm0") \
+                __ASM_EMIT("mov             " __IF_32_64("0x10", "0x20") "(%[vp]), %[p]") \
+                __ASM_EMIT("vinsertf128     $1, 0x00(%[p]), %%ymm0, %%ymm0")        /* ymm0 = p0[0] p1[0] p2[0] ? p0[4] p1[4] p2[4] ? */ \
+                __ASM_EMIT("mov             " __IF_32_64("0x04", "0x08") "(%[vp]), %[p]") \
+                __ASM_EMIT("vmovups         0x00(%[p]), %%xmm1") \
+                __ASM_EMIT("mov             " __IF_32_64("0x14", "0x28") "(%[vp]), %[p]") \
+                __ASM_EMIT("vinsertf128     $1, 0x00(%[p]), %%ymm1, %%ymm1")        /* ymm1 = p0[1] p1[1] p2[1] ? p0[5] p1[5] p2[5] ? */ \
+                __ASM_EMIT("mov             " __IF_32_64("0x08", "0x10") "(%[vp]), %[p]") \
+                __ASM_EMIT("vmovups         0x00(%[p]), %%xmm2") \
+                __ASM_EMIT("mov             " __IF_32_64("0x18", "0x30") "(%[vp]), %[p]") \
+                __ASM_EMIT("vinsertf128     $1, 0x00(%[p]), %%ymm2, %%ymm2")        /* ymm2 = p0[2] p1[2] p2[2] ? p0[6] p1[6] p2[6] ? */ \
+                __ASM_EMIT("mov             " __IF_32_64("0x0c", "0x18") "(%[vp]), %[p]") \
+                __ASM_EMIT("vmovups         0x00(%[p]), %%xmm3") \
+                __ASM_EMIT("mov             " __IF_32_64("0x1c", "0x38") "(%[vp]), %[p]") \
+                __ASM_EMIT("vinsertf128     $1, 0x00(%[p]), %%ymm3, %%ymm3")        /* ymm3 = p0[3] p1[3] p2[3] ? p0[7] p1[7] p2[7] ? */ \
+                __ASM_EMIT("vunpcklps       %%ymm1, %%ymm0, %%ymm4")                /* ymm4 = p0[0] p0[1] p1[0] p1[1] */ \
+                __ASM_EMIT("vunpckhps       %%ymm1, %%ymm0, %%ymm5")                /* ymm5 = p2[0] p2[1] ? ? */ \
+                __ASM_EMIT("vunpcklps       %%ymm3, %%ymm2, %%ymm0")                /* ymm0 = p0[2] p0[3] p1[2] p1[3] */ \
+                __ASM_EMIT("vunpckhps       %%ymm3, %%ymm2, %%ymm1")                /* ymm1 = p2[2] p2[3] ? ? */ \
+                __ASM_EMIT("vunpcklpd       %%ymm0, %%ymm4, %%ymm2")                /* ymm2 = P0 */ \
+                __ASM_EMIT("vunpckhpd       %%ymm0, %%ymm4, %%ymm3")                /* ymm3 = P1 */ \
+                __ASM_EMIT("vunpcklpd       %%ymm1, %%ymm5, %%ymm4")                /* ymm4 = P2 */ \
+                /* Transfer function */ \
+                __ASM_EMIT("vmulps          0x040 + %[MC], %%ymm4, %%ymm7")         /* ymm7 = P2*0.01 */ \
+                __ASM_EMIT("vsubps          %%ymm7, %%ymm2, %%ymm1")                /* ymm1 = B = P0 - P2*0.01 */ \
+                __ASM_EMIT("vmulps          0x060 + %[MC], %%ymm3, %%ymm7")         /* ymm7 = C = P1*0.1 */ \
+                __ASM_EMIT("vmulps          %%ymm1, %%ymm1, %%ymm1")                /* ymm1 = B*B */ \
+                __ASM_EMIT("vmulps          %%ymm7, %%ymm7, %%ymm7")                /* ymm7 = C*C */ \
+                __ASM_EMIT("vaddps          %%ymm1, %%ymm7, %%ymm7")                /* ymm7 = B*B + C*C */ \
+                __ASM_EMIT("vsqrtps         %%ymm7, %%ymm7")                        /* ymm7 = P3 = sqrt(B*B + C*C) */ \
+                __ASM_EMIT("vmovaps         %%ymm4, 0x060(%[w])")                   /* K = P2 */ \
+                __ASM_EMIT("vmovaps         %%ymm7, 0x040(%[w])") \
+                /* Roots */ \
+                __ASM_EMIT("vdivps          %%ymm4, %%ymm3, %%ymm3")                /* ymm3 = X = P1/P2 */ \
+                __ASM_EMIT("vdivps          %%ymm4, %%ymm2, %%ymm2")                /* ymm2 = Y = P0/P2 */ \
+                __ASM_EMIT("vmulps          %%ymm3, %%ymm3, %%ymm1")                /* ymm1 = X*X */ \
+                __ASM_EMIT("vmulps          0x080 + %[MC], %%ymm2, %%ymm2")         /* ymm2 = 4*Y */ \
+                __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                /* ymm0 = 0 */ \
+                __ASM_EMIT("vsubps          %%ymm2, %%ymm1, %%ymm1")                /* ymm1 = D = X*X - 4*Y */ \
+                __ASM_EMIT("vcmpleps        %%ymm1, %%ymm0, %%ymm0")                /* ymm0 = [D >= 0] */ \
+                __ASM_EMIT("vandps          0x020 + %[MC], %%ymm1, %%ymm1")         /* ymm1 = abs(D) */ \
+                __ASM_EMIT("vmulps          0x000(%[w]), %%ymm3, %%ymm3")           /* ymm3 = X*H */ \
+                __ASM_EMIT("vsqrtps         %%ymm1, %%ymm1")                        /* ymm1 = sqrt(abs(D)) */ \
+                __ASM_EMIT("vxorps          0x000 + %[MC], %%ymm3, %%ymm3")         /* ymm3 = m = -X*H */ \
+                __ASM_EMIT("vmulps          0x000(%[w]), %%ymm1, %%ymm1")           /* ymm1 = W = sqrt(abs(D))*H */ \
+                __ASM_EMIT("vandps          %%ymm0, %%ymm1, %%ymm2")                /* ymm2 = wr = W & [D >= 0] */ \
+                __ASM_EMIT("vandnps         %%ymm1, %%ymm0, %%ymm4")                /* ymm4 = wc = W & [D < 0] */ \
+                __ASM_EMIT("vaddps          %%ymm2, %%ymm3, %%ymm5")                /* ymm5 = m + wr */ \
+                __ASM_EMIT("vsubps          %%ymm2, %%ymm3, %%ymm0")                /* ymm0 = m - wr */ \
+                __ASM_EMIT("vmovaps         %%ymm4, 0x0c0(%[w])") \
+                __ASM_EMIT("vmovaps         %%ymm0, 0x080(%[w])") \
+                __ASM_EMIT("vmovaps         %%ymm5, 0x0a0(%[w])") \
+                /* Exponents */ \
+                EXP_CORE                                                            /* ymm0 = E1 = exp(m - wr) */ \
+                __ASM_EMIT("vmovaps         %%ymm0, 0x0e0(%[w])") \
+                __ASM_EMIT("vmovaps         0x0a0(%[w]), %%ymm0") \
+                EXP_CORE                                                            /* ymm0 = E2 = exp(m + wr) */ \
+                __ASM_EMIT("vmovaps         %%ymm0, 0x100(%[w])") \
+                /* Amplitude of the transformed polynom */ \
+                __ASM_EMIT("vmovaps         0x0e0(%[w]), %%ymm1")                   /* ymm1 = E1 */ \
+                __ASM_EMIT("vmulps          0x0c0 + %[MC], %%ymm4, %%ymm4")         /* ymm4 = wc/2 */ \
+                __ASM_EMIT("vmovaps         0x020(%[w]), %%ymm2")                   /* ymm2 = v */ \
+                __ASM_EMIT("vsubps          %%ymm4, %%ymm2, %%ymm2")                /* ymm2 = v - wc/2 */ \
+                __ASM_EMIT("vmovaps         0x080(%[w]), %%ymm0")                   /* ymm0 = m - wr */ \
+                MATCHED_AMP_X8                                                      /* ymm0 = sqrt(Q(m - wr, v - wc/2)) */ \
+                __ASM_EMIT("vmovaps         %%ymm0, 0x120(%[w])") \
+                __ASM_EMIT("vmovaps         0x100(%[w]), %%ymm1")                   /* ymm1 = E2 */ \
+                __ASM_EMIT("vmovaps         0x0c0(%[w]), %%ymm4")                   /* ymm4 = wc */ \
+                __ASM_EMIT("vmulps          0x0c0 + %[MC], %%ymm4, %%ymm4")         /* ymm4 = wc/2 */ \
+                __ASM_EMIT("vaddps          0x020(%[w]), %%ymm4, %%ymm2")           /* ymm2 = v + wc/2 */ \
+                __ASM_EMIT("vmovaps         0x0a0(%[w]), %%ymm0")                   /* ymm0 = m + wr */ \
+                MATCHED_AMP_X8                                                      /* ymm0 = sqrt(Q(m + wr, v + wc/2)) */ \
+                __ASM_EMIT("vmovaps         0x060(%[w]), %%ymm6")                   /* ymm6 = K */ \
+                __ASM_EMIT("vmovaps         0x040(%[w]), %%ymm7")                   /* ymm7 = P3 */ \
+                __ASM_EMIT("vmulps          0x120(%[w]), %%ymm0, %%ymm0")           /* ymm0 = sqrt(Q1*Q2) */ \
+                __ASM_EMIT("vandps          0x020 + %[MC], %%ymm6, %%ymm1")         /* ymm1 = abs(K) */ \
+                __ASM_EMIT("vmulps          %%ymm1, %%ymm0, %%ymm0")                /* ymm0 = A = abs(K)*sqrt(Q1*Q2) */ \
+                __ASM_EMIT("vdivps          %%ymm0, %%ymm7, %%ymm7")                /* ymm7 = P3' = P3/A */ \
+                /* Cosine: cos(wc) = sin(PI/2 - abs(wc - 2*PI*n)) */ \
+                __ASM_EMIT("vmovaps         0x0c0(%[w]), %%ymm4")                   /* ymm4 = wc */ \
+                __ASM_EMIT("vmulps          0x0a0 + %[MC], %%ymm4, %%ymm0")         /* ymm0 = wc/(2*PI) */ \
+                __ASM_EMIT("vaddps          0x0c0 + %[MC], %%ymm0, %%ymm0")         /* ymm0 = wc/(2*PI) + 0.5 */ \
+                __ASM_EMIT("vcvttps2dq      %%ymm0, %%ymm0") \
+                __ASM_EMIT("vcvtdq2ps       %%ymm0, %%ymm0")                        /* ymm0 = n = int(wc/(2*PI) + 0.5) */ \
+                __ASM_EMIT("vmulps          0x0e0 + %[MC], %%ymm0, %%ymm0")         /* ymm0 = 2*PI*n */ \
+                __ASM_EMIT("vsubps          %%ymm0, %%ymm4, %%ymm4")                /* ymm4 = wc - 2*PI*n */ \
+                __ASM_EMIT("vandps          0x020 + %[MC], %%ymm4, %%ymm4")         /* ymm4 = abs(wc - 2*PI*n) */ \
+                __ASM_EMIT("vmovaps         0x100 + %[MC], %%ymm0")                 /* ymm0 = PI/2 */ \
+                __ASM_EMIT("vsubps          %%ymm4, %%ymm0, %%ymm0")                /* ymm0 = y = PI/2 - abs(wc - 2*PI*n) */ \
+                MATCHED_SIN_X8                                                      /* ymm3 = cos(wc) */ \
+                __ASM_EMIT("vmovaps         0x0e0(%[w]), %%ymm5")                   /* ymm5 = E1 */ \
+                __ASM_EMIT("vmovaps         0x100(%[w]), %%ymm0")                   /* ymm0 = E2 */ \
+                __ASM_EMIT("vmulps          %%ymm5, %%ymm0, %%ymm1")                /* ymm1 = E1*E2 */ \
+                __ASM_EMIT("vaddps          %%ymm0, %%ymm5, %%ymm5")                /* ymm5 = E1+E2 */ \
+                /* Transformed polynom */ \
+                __ASM_EMIT("vmulps          %%ymm3, %%ymm5, %%ymm5")                /* ymm5 = (E1+E2)*cos(wc) */ \
+                __ASM_EMIT("vmulps          %%ymm6, %%ymm1, %%ymm1")                /* ymm1 = P2' = K*E1*E2 */ \
+                __ASM_EMIT("vmulps          %%ymm6, %%ymm5, %%ymm5")                /* ymm5 = K*(E1+E2)*cos(wc) */ \
+                __ASM_EMIT("vxorps          0x000 + %[MC], %%ymm5, %%ymm5")         /* ymm5 = P1' = -K*(E1+E2)*cos(wc) */ \
+                /* Transpose back and store polynoms */ \
+                __ASM_EMIT("vunpcklps       %%ymm5, %%ymm6, %%ymm0")                /* ymm0 = p0[0] p1[0] p0[1] p1[1] */ \
+                __ASM_EMIT("vunpckhps       %%ymm5, %%ymm6, %%ymm2")                /* ymm2 = p0[2] p1[2] p0[3] p1[3] */ \
+                __ASM_EMIT("vunpcklps       %%ymm7, %%ymm1, %%ymm3")                /* ymm3 = p2[0] p3[0] p2[1] p3[1] */ \
+                __ASM_EMIT("vunpckhps       %%ymm7, %%ymm1, %%ymm4")                /* ymm4 = p2[2] p3[2] p2[3] p3[3] */ \
+                __ASM_EMIT("vunpcklpd       %%ymm3, %%ymm0, %%ymm1")                /* ymm1 = p0[0] p1[0] p2[0] p3[0] */ \
+                __ASM_EMIT("vunpckhpd       %%ymm3, %%ymm0, %%ymm5")                /* ymm5 = p0[1] p1[1] p2[1] p3[1] */ \
+                __ASM_EMIT("vunpcklpd       %%ymm4, %%ymm2, %%ymm6")                /* ymm6 = p0[2] p1[2] p2[2] p3[2] */ \
+                __ASM_EMIT("vunpckhpd       %%ymm4, %%ymm2, %%ymm7")                /* ymm7 = p0[3] p1[3] p2[3] p3[3] */ \
+                __ASM_EMIT("mov             " __IF_32_64("0x00", "0x00") "(%[vp]), %[p]") \
+                __ASM_EMIT("vmovups         %%xmm1, 0x00(%[p])") \
+                __ASM_EMIT("mov             " __IF_32_64("0x10", "0x20") "(%[vp]), %[p]") \
+                __ASM_EMIT("vextractf128    $1, %%ymm1, 0x00(%[p])") \
+                __ASM_EMIT("mov             " __IF_32_64("0x04", "0x08") "(%[vp]), %[p]") \
+                __ASM_EMIT("vmovups         %%xmm5, 0x00(%[p])") \
+                __ASM_EMIT("mov             " __IF_32_64("0x14", "0x28") "(%[vp]), %[p]") \
+                __ASM_EMIT("vextractf128    $1, %%ymm5, 0x00(%[p])") \
+                __ASM_EMIT("mov             " __IF_32_64("0x08", "0x10") "(%[vp]), %[p]") \
+                __ASM_EMIT("vmovups         %%xmm6, 0x00(%[p])") \
+                __ASM_EMIT("mov             " __IF_32_64("0x18", "0x30") "(%[vp]), %[p]") \
+                __ASM_EMIT("vextractf128    $1, %%ymm6, 0x00(%[p])") \
+                __ASM_EMIT("mov             " __IF_32_64("0x0c", "0x18") "(%[vp]), %[p]") \
+                __ASM_EMIT("vmovups         %%xmm7, 0x00(%[p])") \
+                __ASM_EMIT("mov             " __IF_32_64("0x1c", "0x38") "(%[vp]), %[p]") \
+                __ASM_EMIT("vextractf128    $1, %%ymm7, 0x00(%[p])") \
+                /* Repeat loop */ \
+                __ASM_EMIT("add             $" __IF_32_64("0x20", "0x40") ", %[vp]") \
+                __ASM_EMIT("sub             $8, %[count]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [vp] "+r" (vp), [count] "+r" (count), \
+                  [p] "=&r" (p) \
+                : [w] "r" (w), \
+                  [MC] "o" (MATCHED_CONST), \
+                  [E2C] "o" (EXP2_CONST), \
+                  [LOG2E] "m" (EXP_LOG2E) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        static void matched_solve_x8(float * const *vp, size_t count, const float *w)
+        {
+            MATCHED_SOLVE_X8(EXP_CORE_X8)
+        }
+
+        static void matched_solve_x8_fma3(float * const *vp, size_t count, const float *w)
+        {
+            MATCHED_SOLVE_X8(EXP_CORE_X8_FMA3)
+        }
+
+        #undef MATCHED_SOLVE_X8
+        #undef MATCHED_AMP_X8
+        #undef MATCHED_SIN_X8
+
+        static void matched_init(matched_ctx_t *ctx, float kf, float td, matched_solve_t solve)
+        {
+            float h         = 0.5f * kf * td;
+            float v         = 0.05f * kf * td;
+
+            for (size_t i=0; i<8; ++i)
+            {
+                ctx->w[i]       = h;
+                ctx->w[i+8]     = v;
+            }
+            ctx->n          = 0;
+            ctx->solve      = solve;
+        }
+
+        static void matched_flush(matched_ctx_t *ctx)
+        {
+            size_t n        = ctx->n;
+            if (n <= 0)
+                return;
+
+            // Pad the batch with the last polynom, it is loaded before the store
+            for ( ; n & 7; ++n)
+                ctx->vp[n]      = ctx->vp[n-1];
+
+            ctx->solve(ctx->vp, n, ctx->w);
+            ctx->n          = 0;
+        }
+
+        static void matched_solve(matched_ctx_t *ctx, float *p, float kf, float td, size_t count, size_t stride)
+        {
+            // The order of each polynom is tested individually
+            float s         = sinf(0.05f * kf * td);
+
+            while (count--)
+            {
+                if (p[2] != 0.0) // Test polynom for second-order
+                {
+                    // Second-order polynoms are collected into the batch
+                    ctx->vp[ctx->n++]   = p;
+                    if (ctx->n >= MATCHED_BATCH)
+                    {
+                        ctx->solve(ctx->vp, ctx->n, ctx->w);
+                        ctx->n              = 0;
+                    }
+                }
+                else if (p[1] != 0.0) // Test polynom for first order
+                {
+                    // First-order polynom:
+                    //   p(s) = p[0] + p[1]*(s/f)
+                    //
+                    // Transformed polynom:
+                    //   P[z] = p[1]/f - p[1]/f * exp(-f*p[0]*T/p[1]) * z^-1
+                    //
+                    // The p[3] receives the ratio of the continuous transfer function amplitude to
+                    // the amplitude of P[z] at the control frequency w computed by the root E:
+                    //   A = abs(p[1]/f) * sqrt(expm1(R*T)^2 + 4*E*sin(w/2)^2)
+                    float k     = p[1]/kf;
+                    float R     = -p[0]/k;
+                    float E     = expf(R*td);
+                    float M     = expm1f(R*td);
+                    float A     = fabsf(k) * sqrtf(M*M + 4.0f*E*s*s);
+
+                    p[3]        = sqrtf(p[0]*p[0] + p[1]*p[1]*0.01f) / A; // transfer function
+                    p[0]        = k;
+                    p[1]        = -k * E;
+                }
+                else
+                    p[3]        = 1.0f / fabsf(p[0]); // transfer function
+
+                p          += stride;
+            }
+        }
+
+        /*
+         * Transpose 4x4 matrices stored in ymm0..ymm3, the result is stored in ymm2..ymm5
+         */
+        #define MATCHED_TRANSPOSE \
+            __ASM_EMIT("vunpcklps       %%ymm1, %%ymm0, %%ymm4")                    /* ymm4 = a0 b0 a1 b1 */ \
+            __ASM_EMIT("vunpckhps       %%ymm1, %%ymm0, %%ymm5")                    /* ymm5 = a2 b2 a3 b3 */ \
+            __ASM_EMIT("vunpcklps       %%ymm3, %%ymm2, %%ymm0")                    /* ymm0 = c0 d0 c1 d1 */ \
+            __ASM_EMIT("vunpckhps       %%ymm3, %%ymm2, %%ymm1")                    /* ymm1 = c2 d2 c3 d3 */ \
+            __ASM_EMIT("vunpcklpd       %%ymm0, %%ymm4, %%ymm2")                    /* ymm2 = a0 b0 c0 d0 */ \
+            __ASM_EMIT("vunpckhpd       %%ymm0, %%ymm4, %%ymm3")                    /* ymm3 = a1 b1 c1 d1 */ \
+            __ASM_EMIT("vunpcklpd       %%ymm1, %%ymm5, %%ymm4")                    /* ymm4 = a2 b2 c2 d2 */ \
+            __ASM_EMIT("vunpckhpd       %%ymm1, %%ymm5, %%ymm5")                    /* ymm5 = a3 b3 c3 d3 */
+
+        /*
+         * Compute the normalized filter for eight cascades pointed by bc:
+         *   ymm0 = b0, ymm1 = b1, ymm2 = b2, ymm6 = a1, ymm7 = a2
+         */
+        #define MATCHED_NORM_X8 \
+            /* Load top part of cascades and transpose */ \
+            __ASM_EMIT("vmovups         0x00(%[bc]), %%xmm0") \
+            __ASM_EMIT("vmovups         0x20(%[bc]), %%xmm1") \
+            __ASM_EMIT("vmovups         0x40(%[bc]), %%xmm2") \
+            __ASM_EMIT("vmovups         0x60(%[bc]), %%xmm3") \
+            __ASM_EMIT("vinsertf128     $1, 0x80(%[bc]), %%ymm0, %%ymm0")           /* ymm0 = t0[0] t1[0] t2[0] t3[0] t0[4] t1[4] t2[4] t3[4] */ \
+            __ASM_EMIT("vinsertf128     $1, 0xa0(%[bc]), %%ymm1, %%ymm1")           /* ymm1 = t0[1] t1[1] t2[1] t3[1] t0[5] t1[5] t2[5] t3[5] */ \
+            __ASM_EMIT("vinsertf128     $1, 0xc0(%[bc]), %%ymm2, %%ymm2")           /* ymm2 = t0[2] t1[2] t2[2] t3[2] t0[6] t1[6] t2[6] t3[6] */ \
+            __ASM_EMIT("vinsertf128     $1, 0xe0(%[bc]), %%ymm3, %%ymm3")           /* ymm3 = t0[3] t1[3] t2[3] t3[3] t0[7] t1[7] t2[7] t3[7] */ \
+            MATCHED_TRANSPOSE                                                       /* ymm2 = t0, ymm3 = t1, ymm4 = t2, ymm5 = t3 */ \
+            __ASM_EMIT("vmovaps         %%ymm2, 0x040(%[w])") \
+            __ASM_EMIT("vmovaps         %%ymm3, 0x060(%[w])") \
+            __ASM_EMIT("vmovaps         %%ymm4, 0x080(%[w])") \
+            __ASM_EMIT("vmovaps         %%ymm5, 0x0a0(%[w])") \
+            /* Load bottom part of cascades and transpose */ \
+            __ASM_EMIT("vmovups         0x10(%[bc]), %%xmm0") \
+            __ASM_EMIT("vmovups         0x30(%[bc]), %%xmm1") \
+            __ASM_EMIT("vmovups         0x50(%[bc]), %%xmm2") \
+            __ASM_EMIT("vmovups         0x70(%[bc]), %%xmm3") \
+            __ASM_EMIT("vinsertf128     $1, 0x90(%[bc]), %%ymm0, %%ymm0")           /* ymm0 = b0[0] b1[0] b2[0] b3[0] b0[4] b1[4] b2[4] b3[4] */ \
+            __ASM_EMIT("vinsertf128     $1, 0xb0(%[bc]), %%ymm1, %%ymm1")           /* ymm1 = b0[1] b1[1] b2[1] b3[1] b0[5] b1[5] b2[5] b3[5] */ \
+            __ASM_EMIT("vinsertf128     $1, 0xd0(%[bc]), %%ymm2, %%ymm2")           /* ymm2 = b0[2] b1[2] b2[2] b3[2] b0[6] b1[6] b2[6] b3[6] */ \
+            __ASM_EMIT("vinsertf128     $1, 0xf0(%[bc]), %%ymm3, %%ymm3")           /* ymm3 = b0[3] b1[3] b2[3] b3[3] b0[7] b1[7] b2[7] b3[7] */ \
+            MATCHED_TRANSPOSE                                                       /* ymm2 = b0, ymm3 = b1, ymm4 = b2, ymm5 = b3 */ \
+            __ASM_EMIT("vmovaps         0x0a0(%[w]), %%ymm0")                       /* ymm0 = t3 */ \
+            __ASM_EMIT("vmovaps         0x1c0 + %[MC], %%ymm1")                     /* ymm1 = 1 */ \
+            __ASM_EMIT("vdivps          %%ymm5, %%ymm0, %%ymm0")                    /* ymm0 = AN = t3/b3 */ \
+            __ASM_EMIT("vdivps          %%ymm2, %%ymm1, %%ymm1")                    /* ymm1 = N2 = 1/b0 */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm0, %%ymm0")                    /* ymm0 = N1 = AN*N2 */ \
+            __ASM_EMIT("vxorps          0x000 + %[MC], %%ymm1, %%ymm1")             /* ymm1 = -N2 */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm3, %%ymm6")                    /* ymm6 = a1 = -b1*N2 */ \
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm4, %%ymm7")                    /* ymm7 = a2 = -b2*N2 */ \
+            __ASM_EMIT("vmulps          0x060(%[w]), %%ymm0, %%ymm1")               /* ymm1 = b1 = t1*N1 */ \
+            __ASM_EMIT("vmulps          0x080(%[w]), %%ymm0, %%ymm2")               /* ymm2 = b2 = t2*N1 */ \
+            __ASM_EMIT("vmulps          0x040(%[w]), %%ymm0, %%ymm0")               /* ymm0 = b0 = t0*N1 */
+
+        static void matched_norm_x1(dsp::biquad_x1_t *bf, const dsp::f_cascade_t *bc, float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X8
+                // Transpose and store
+                __ASM_EMIT("vunpcklps       %%ymm1, %%ymm0, %%ymm3")                // ymm3 = b0[0] b1[0] b0[1] b1[1]
+                __ASM_EMIT("vunpckhps       %%ymm1, %%ymm0, %%ymm4")                // ymm4 = b0[2] b1[2] b0[3] b1[3]
+                __ASM_EMIT("vunpcklps       %%ymm6, %%ymm2, %%ymm0")                // ymm0 = b2[0] a1[0] b2[1] a1[1]
+                __ASM_EMIT("vunpckhps       %%ymm6, %%ymm2, %%ymm1")                // ymm1 = b2[2] a1[2] b2[3] a1[3]
+                __ASM_EMIT("vunpcklpd       %%ymm0, %%ymm3, %%ymm2")                // ymm2 = b0[0] b1[0] b2[0] a1[0]
+                __ASM_EMIT("vunpckhpd       %%ymm0, %%ymm3, %%ymm5")                // ymm5 = b0[1] b1[1] b2[1] a1[1]
+                __ASM_EMIT("vunpcklpd       %%ymm1, %%ymm4, %%ymm6")                // ymm6 = b0[2] b1[2] b2[2] a1[2]
+                __ASM_EMIT("vunpckhpd       %%ymm1, %%ymm4, %%ymm3")                // ymm3 = b0[3] b1[3] b2[3] a1[3]
+                __ASM_EMIT("vmovups         %%xmm2, 0x00(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm5, 0x20(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm6, 0x40(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm3, 0x60(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm2, 0x80(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm5, 0xa0(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm6, 0xc0(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm3, 0xe0(%[bf])")
+                __ASM_EMIT("vxorps          %%ymm0, %%ymm0, %%ymm0")                // ymm0 = 0
+                __ASM_EMIT("vunpcklps       %%ymm0, %%ymm7, %%ymm1")                // ymm1 = a2[0] 0 a2[1] 0
+                __ASM_EMIT("vunpckhps       %%ymm0, %%ymm7, %%ymm2")                // ymm2 = a2[2] 0 a2[3] 0
+                __ASM_EMIT("vunpcklpd       %%ymm0, %%ymm1, %%ymm3")                // ymm3 = a2[0] 0 0 0
+                __ASM_EMIT("vunpckhpd       %%ymm0, %%ymm1, %%ymm4")                // ymm4 = a2[1] 0 0 0
+                __ASM_EMIT("vunpcklpd       %%ymm0, %%ymm2, %%ymm5")                // ymm5 = a2[2] 0 0 0
+                __ASM_EMIT("vunpckhpd       %%ymm0, %%ymm2, %%ymm6")                // ymm6 = a2[3] 0 0 0
+                __ASM_EMIT("vmovups         %%xmm3, 0x10(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm4, 0x30(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm5, 0x50(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm6, 0x70(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm3, 0x90(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm4, 0xb0(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm5, 0xd0(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm6, 0xf0(%[bf])")
+                // Repeat loop
+                __ASM_EMIT("add             $0x100, %[bc]")
+                __ASM_EMIT("add             $0x100, %[bf]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jnz             1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w),
+                  [MC] "o" (MATCHED_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        static void matched_norm_x2(dsp::biquad_x2_t *bf, const dsp::f_cascade_t *bc, float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X8
+                __ASM_EMIT("vxorps          %%xmm3, %%xmm3, %%xmm3")
+                __ASM_EMIT("vmovlps         %%xmm0, 0x00(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm1, 0x08(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm2, 0x10(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm6, 0x18(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm7, 0x20(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm3, 0x28(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm0, 0x30(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm1, 0x38(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm2, 0x40(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm6, 0x48(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm7, 0x50(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm3, 0x58(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm0, %%xmm0")
+                __ASM_EMIT("vextractf128    $1, %%ymm1, %%xmm1")
+                __ASM_EMIT("vextractf128    $1, %%ymm2, %%xmm2")
+                __ASM_EMIT("vextractf128    $1, %%ymm6, %%xmm6")
+                __ASM_EMIT("vextractf128    $1, %%ymm7, %%xmm7")
+                __ASM_EMIT("vmovlps         %%xmm0, 0x60(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm1, 0x68(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm2, 0x70(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm6, 0x78(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm7, 0x80(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm3, 0x88(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm0, 0x90(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm1, 0x98(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm2, 0xa0(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm6, 0xa8(%[bf])")
+                __ASM_EMIT("vmovhps         %%xmm7, 0xb0(%[bf])")
+                __ASM_EMIT("vmovlps         %%xmm3, 0xb8(%[bf])")
+                // Repeat loop
+                __ASM_EMIT("add             $0x100, %[bc]")
+                __ASM_EMIT("add             $0xc0, %[bf]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jnz             1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w),
+                  [MC] "o" (MATCHED_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        static void matched_norm_x4(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X8
+                __ASM_EMIT("vmovups         %%xmm0, 0x00(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm1, 0x10(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm2, 0x20(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm6, 0x30(%[bf])")
+                __ASM_EMIT("vmovups         %%xmm7, 0x40(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm0, 0x50(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm1, 0x60(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm2, 0x70(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm6, 0x80(%[bf])")
+                __ASM_EMIT("vextractf128    $1, %%ymm7, 0x90(%[bf])")
+                // Repeat loop
+                __ASM_EMIT("add             $0x100, %[bc]")
+                __ASM_EMIT("add             $0xa0, %[bf]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jnz             1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w),
+                  [MC] "o" (MATCHED_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        static void matched_norm_x8(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X8
+                __ASM_EMIT("vmovups         %%ymm0, 0x00(%[bf])")
+                __ASM_EMIT("vmovups         %%ymm1, 0x20(%[bf])")
+                __ASM_EMIT("vmovups         %%ymm2, 0x40(%[bf])")
+                __ASM_EMIT("vmovups         %%ymm6, 0x60(%[bf])")
+                __ASM_EMIT("vmovups         %%ymm7, 0x80(%[bf])")
+                // Repeat loop
+                __ASM_EMIT("add             $0x100, %[bc]")
+                __ASM_EMIT("add             $0xa0, %[bf]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jnz             1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w),
+                  [MC] "o" (MATCHED_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef MATCHED_NORM_X8
+        #undef MATCHED_TRANSPOSE
+
+        static void matched_run_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count, matched_solve_t solve)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td, solve);
+
+            // Find roots for top and bottom polynoms
+            matched_solve(&ctx, bc->t, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
+            matched_solve(&ctx, bc->b, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
+            matched_flush(&ctx);
+
+            // Normalize filters, the tail is processed by padding to the full block
+            size_t blocks   = count >> 3;
+            if (blocks > 0)
+            {
+                matched_norm_x1(bf, bc, ctx.w, blocks);
+                bf             += blocks << 3;
+                bc             += blocks << 3;
+            }
+
+            count          &= 7;
+            if (count > 0)
+            {
+                dsp::f_cascade_t xc[8];
+                dsp::biquad_x1_t xf[8];
+
+                for (size_t i=0; i<8; ++i)
+                    xc[i]           = bc[lsp_min(i, count - 1)];
+                matched_norm_x1(xf, xc, ctx.w, 1);
+                for (size_t i=0; i<count; ++i)
+                    bf[i]           = xf[i];
+            }
+        }
+
+        static void matched_run_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count, matched_solve_t solve)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td, solve);
+
+            // Solve filters
+            for (size_t i=0; i<2; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*3];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 1, (2*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 1, (2*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters, the tail is processed by padding to the full block
+            size_t blocks   = count >> 2;
+            if (blocks > 0)
+            {
+                matched_norm_x2(bf, bc, ctx.w, blocks);
+                bf             += blocks << 2;
+                bc             += blocks << 3;
+            }
+
+            count          &= 3;
+            if (count > 0)
+            {
+                dsp::f_cascade_t xc[8];
+                dsp::biquad_x2_t xf[4];
+
+                for (size_t i=0; i<8; ++i)
+                    xc[i]           = bc[lsp_min(i, count*2 - 1)];
+                matched_norm_x2(xf, xc, ctx.w, 1);
+                for (size_t i=0; i<count; ++i)
+                    bf[i]           = xf[i];
+            }
+        }
+
+        static void matched_run_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count, matched_solve_t solve)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td, solve);
+
+            // Solve filters
+            for (size_t i=0; i<4; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*5];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 3, (4*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 3, (4*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters, the tail is processed by padding to the full block
+            size_t blocks   = count >> 1;
+            if (blocks > 0)
+            {
+                matched_norm_x4(bf, bc, ctx.w, blocks);
+                bf             += blocks << 1;
+                bc             += blocks << 3;
+            }
+
+            if (count & 1)
+            {
+                dsp::f_cascade_t xc[8];
+                dsp::biquad_x4_t xf[2];
+
+                for (size_t i=0; i<8; ++i)
+                    xc[i]           = bc[lsp_min(i, size_t(3))];
+                matched_norm_x4(xf, xc, ctx.w, 1);
+                bf[0]           = xf[0];
+            }
+        }
+
+        static void matched_run_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count, matched_solve_t solve)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td, solve);
+
+            // Solve filters
+            for (size_t i=0; i<8; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*9];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 7, (8*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 7, (8*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters
+            if (count > 0)
+                matched_norm_x8(bf, bc, ctx.w, count);
+        }
+
+        void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_run_x1(bf, bc, kf, td, count, matched_solve_x8);
+        }
+
+        void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_run_x2(bf, bc, kf, td, count, matched_solve_x8);
+        }
+
+        void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_run_x4(bf, bc, kf, td, count, matched_solve_x8);
+        }
+
+        void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_run_x8(bf, bc, kf, td, count, matched_solve_x8);
+        }
+
+        void matched_transform_x1_fma3(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_run_x1(bf, bc, kf, td, count, matched_solve_x8_fma3);
+        }
+
+        void matched_transform_x2_fma3(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_run_x2(bf, bc, kf, td, count, matched_solve_x8_fma3);
+        }
+
+        void matched_transform_x4_fma3(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_run_x4(bf, bc, kf, td, count, matched_solve_x8_fma3);
+        }
+
+        void matched_transform_x8_fma3(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_run_x8(bf, bc, kf, td, count, matched_solve_x8_fma3);
+        }
+
+    } /* namespace avx2 */
+} /* namespace lsp */
+
+#undef MATCHED_BATCH
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_FILTERS_TRANSFORM_H_ */
@@ -0,0 +1,493 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_RESAMPLING_H_
+#define PRIVATE_DSP_ARCH_X86_AVX2_RESAMPLING_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_IMPL */
+
+#include <private/dsp/arch/x86/lanczos.h>
+
+namespace lsp
+{
+    namespace avx2
+    {
+        IF_ARCH_X86(
+            static x86::lanczos_bank_t lanczos_bank;
+
+            static const uint32_t downsample_idx[] __lsp_aligned32 =
+            {
+                0,  3,  6,  9, 12, 15, 18, 21,  // 3x
+                0,  4,  8, 12, 16, 20, 24, 28,  // 4x
+                0,  6, 12, 18, 24, 30, 36, 42,  // 6x
+                0,  8, 16, 24, 32, 40, 48, 56   // 8x
+            };
+        )
+
+        /**
+         * Fill the bank of kernels in advance, otherwise the first call of the kernel
+         * function fills it
+         */
+        void lanczos_init()
+        {
+            x86::lanczos_bank_init(&lanczos_bank);
+        }
+
+        /**
+         * Apply the kernel to six groups of 8 output samples located at dst + i*dstep, i = 0..5.
+         * All groups share the same kernel window, the input samples for each next group
+         * are shifted by 8 samples.
+         */
+        static inline void lanczos_apply_x6_fma3(float *dst, const float *src, const float *k,
+            size_t kstep, size_t dstep, size_t n)
+        {
+            float *d;
+
+            ARCH_X86_ASM(
+                __ASM_EMIT("mov             %[dst], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%ymm0")                    // ymm0 = a0
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%ymm1")                    // ymm1 = a1
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%ymm2")                    // ymm2 = a2
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%ymm3")                    // ymm3 = a3
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%ymm4")                    // ymm4 = a4
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%ymm5")                    // ymm5 = a5
+                __ASM_EMIT(".align          16")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         (%[k]), %%ymm7")                    // ymm7 = k
+                __ASM_EMIT("vbroadcastss    0x00(%[src]), %%ymm6")              // ymm6 = s0
+                __ASM_EMIT("vfmadd231ps     %%ymm7, %%ymm6, %%ymm0")            // ymm0 = a0 + k*s0
+                __ASM_EMIT("vbroadcastss    0x20(%[src]), %%ymm6")              // ymm6 = s8
+                __ASM_EMIT("vfmadd231ps     %%ymm7, %%ymm6, %%ymm1")            // ymm1 = a1 + k*s8
+                __ASM_EMIT("vbroadcastss    0x40(%[src]), %%ymm6")              // ymm6 = s16
+                __ASM_EMIT("vfmadd231ps     %%ymm7, %%ymm6, %%ymm2")            // ymm2 = a2 + k*s16
+                __ASM_EMIT("vbroadcastss    0x60(%[src]), %%ymm6")              // ymm6 = s24
+                __ASM_EMIT("vfmadd231ps     %%ymm7, %%ymm6, %%ymm3")            // ymm3 = a3 + k*s24
+                __ASM_EMIT("vbroadcastss    0x80(%[src]), %%ymm6")              // ymm6 = s32
+                __ASM_EMIT("vfmadd231ps     %%ymm7, %%ymm6, %%ymm4")            // ymm4 = a4 + k*s32
+                __ASM_EMIT("vbroadcastss    0xa0(%[src]), %%ymm6")              // ymm6 = s40
+                __ASM_EMIT("vfmadd231ps     %%ymm7, %%ymm6, %%ymm5")            // ymm5 = a5 + k*s40
+                __ASM_EMIT("add             $0x04, %[src]")
+                __ASM_EMIT("sub             %[kstep], %[k]")
+                __ASM_EMIT("dec             %[n]")
+                __ASM_EMIT("jnz             1b")
+                __ASM_EMIT("mov             %[dst], %[d]")
+                __ASM_EMIT("vmovups         %%ymm0, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%ymm1, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%ymm2, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%ymm3, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%ymm4, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%ymm5, (%[d])")
+
+                : [src] "+r" (src), [k] "+r" (k), [n] "+r" (n),
+                  [d] "=&r" (d)
+                : [dst] X86_GREG (dst),
+                  [kstep] X86_GREG (kstep), [dstep] X86_GREG (dstep)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        /**
+         * Apply the kernel to the single group of 8 output samples
+         */
+        static inline void lanczos_apply_x1_fma3(float *dst, const float *src, const float *k,
+            size_t kstep, size_t n)
+        {
+            ARCH_X86_ASM(
+                __ASM_EMIT("vmovups         (%[dst]), %%ymm0")                  // ymm0 = a0
+                __ASM_EMIT("vxorps          %%ymm1, %%ymm1, %%ymm1")            // ymm1 = a1
+                // 2x blocks
+                __ASM_EMIT("sub             $2, %[n]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vbroadcastss    0x00(%[src]), %%ymm2")              // ymm2 = s0
+                __ASM_EMIT("vbroadcastss    0x04(%[src]), %%ymm3")              // ymm3 = s1
+                __ASM_EMIT("vfmadd231ps     (%[k]), %%ymm2, %%ymm0")            // ymm0 = a0 + k0*s0
+                __ASM_EMIT("sub             %[kstep], %[k]")
+                __ASM_EMIT("vfmadd231ps     (%[k]), %%ymm3, %%ymm1")            // ymm1 = a1 + k1*s1
+                __ASM_EMIT("sub             %[kstep], %[k]")
+                __ASM_EMIT("add             $0x08, %[src]")
+                __ASM_EMIT("sub             $2, %[n]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                // 1x block
+                __ASM_EMIT("add             $1, %[n]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("vbroadcastss    0x00(%[src]), %%ymm2")              // ymm2 = s0
+                __ASM_EMIT("vfmadd231ps     (%[k]), %%ymm2, %%ymm0")            // ymm0 = a0 + k0*s0
+                __ASM_EMIT("4:")
+                __ASM_EMIT("vaddps          %%ymm1, %%ymm0, %%ymm0")            // ymm0 = a0 + a1
+                __ASM_EMIT("vmovups         %%ymm0, (%[dst])")
+
+                : [src] "+r" (src), [k] "+r" (k), [n] "+r" (n)
+                : [dst] "r" (dst),
+                  [kstep] X86_GREG (kstep)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3"
+            );
+        }
+
+        /**
+         * Output-driven Lanczos oversampling: instead of scattering the kernel for each input sample,
+         * each 8-sample block of the destination buffer is loaded once, accumulates all the input
+         * samples that affect it and is stored back. The zero padding around the kernel replaces
+         * the range checks for the samples that affect only a part of the block.
+         */
+        void lanczos_resample_fma3(float *dst, const float *src, const dsp::lanczos_kernel_t *lk, size_t count)
+        {
+            if (count == 0)
+                return;
+
+            const size_t times  = lk->times;
+            const size_t klen   = lk->length;
+            const float *kernel = lk->data;
+            const size_t end    = (count - 1) * times + klen;
+            const size_t gstep  = times * 8;
+
+            // The range [first, last) of input samples that affect the block [m0, m0 + 8),
+            // the first block of the next tile is affected by samples shifted by 6*8
+            ssize_t tfirst      = -ssize_t((klen - 1) / times);
+            ssize_t tlast       = (8 + times - 1) / times;
+
+            for (size_t base = 0; base < end; base += gstep * 6, tfirst += 6*8, tlast += 6*8)
+            {
+                ssize_t first       = tfirst;
+                ssize_t last        = tlast;
+
+                for (size_t m0 = base, mend = base + gstep; m0 < mend; m0 += 8)
+                {
+                    while ((first * ssize_t(times) + ssize_t(klen)) <= ssize_t(m0))
+                        ++first;
+                    while ((last * ssize_t(times)) < ssize_t(m0 + 8))
+                        ++last;
+
+                    if ((first >= 0) && (size_t(last + 5*8) <= count))
+                    {
+                        lanczos_apply_x6_fma3(&dst[m0], &src[first], &kernel[m0 - first * times],
+                            times * sizeof(float), gstep * sizeof(float), last - first);
+                        continue;
+                    }
+
+                    // Head or tail of the buffer, process blocks one by one
+                    for (size_t i=0, m=m0; (i < 6) && (m < end); ++i, m += gstep)
+                    {
+                        size_t lo       = lsp_max(first + ssize_t(i * 8), ssize_t(0));
+                        size_t hi       = lsp_min(size_t(last + i * 8), count);
+                        if ((m + 8) <= end)
+                        {
+                            lanczos_apply_x1_fma3(&dst[m], &src[lo], &kernel[m - lo * times],
+                                times * sizeof(float), hi - lo);
+                            continue;
+                        }
+
+                        // The last block crosses the end of the convolution tail, do not touch
+                        // the destination buffer after it
+                        float tmp[8] __lsp_aligned32;
+                        const size_t tail   = end - m;
+                        for (size_t j=0; j<tail; ++j)
+                            tmp[j]          = dst[m + j];
+                        lanczos_apply_x1_fma3(tmp, &src[lo], &kernel[m - lo * times],
+                            times * sizeof(float), hi - lo);
+                        for (size_t j=0; j<tail; ++j)
+                            dst[m + j]      = tmp[j];
+                    }
+                }
+            }
+        }
+
+        void lanczos_resample_2x2_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X2), count);
+        }
+
+        void lanczos_resample_2x3_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X3), count);
+        }
+
+        void lanczos_resample_2x4_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X4), count);
+        }
+
+        void lanczos_resample_2x16bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X16BIT), count);
+        }
+
+        void lanczos_resample_2x24bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X24BIT), count);
+        }
+
+        void lanczos_resample_3x2_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X2), count);
+        }
+
+        void lanczos_resample_3x3_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X3), count);
+        }
+
+        void lanczos_resample_3x4_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X4), count);
+        }
+
+        void lanczos_resample_3x16bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X16BIT), count);
+        }
+
+        void lanczos_resample_3x24bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X24BIT), count);
+        }
+
+        void lanczos_resample_4x2_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X2), count);
+        }
+
+        void lanczos_resample_4x3_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X3), count);
+        }
+
+        void lanczos_resample_4x4_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X4), count);
+        }
+
+        void lanczos_resample_4x16bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X16BIT), count);
+        }
+
+        void lanczos_resample_4x24bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X24BIT), count);
+        }
+
+        void lanczos_resample_6x2_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X2), count);
+        }
+
+        void lanczos_resample_6x3_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X3), count);
+        }
+
+        void lanczos_resample_6x4_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X4), count);
+        }
+
+        void lanczos_resample_6x16bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X16BIT), count);
+        }
+
+        void lanczos_resample_6x24bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X24BIT), count);
+        }
+
+        void lanczos_resample_8x2_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X2), count);
+        }
+
+        void lanczos_resample_8x3_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X3), count);
+        }
+
+        void lanczos_resample_8x4_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X4), count);
+        }
+
+        void lanczos_resample_8x16bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X16BIT), count);
+        }
+
+        void lanczos_resample_8x24bit_fma3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample_fma3(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X24BIT), count);
+        }
+
+        void downsample_2x(float *dst, const float *src, size_t count)
+        {
+            ARCH_X86_ASM(
+                // 32x blocks
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         0x000(%[src]), %%ymm0")                 // ymm0 = s0 ? s1 ? s2 ? s3 ?
+                __ASM_EMIT("vmovups         0x040(%[src]), %%ymm2")                 // ymm2 = s8 ? s9 ? s10 ? s11 ?
+                __ASM_EMIT("vmovups         0x080(%[src]), %%ymm4")                 // ymm4 = s16 ? s17 ? s18 ? s19 ?
+                __ASM_EMIT("vmovups         0x0c0(%[src]), %%ymm6")                 // ymm6 = s24 ? s25 ? s26 ? s27 ?
+                __ASM_EMIT("vshufps         $0x88, 0x020(%[src]), %%ymm0, %%ymm0")  // ymm0 = s0 s1 s4 s5 s2 s3 s6 s7
+                __ASM_EMIT("vshufps         $0x88, 0x060(%[src]), %%ymm2, %%ymm2")  // ymm2 = s8 s9 s12 s13 s10 s11 s14 s15
+                __ASM_EMIT("vshufps         $0x88, 0x0a0(%[src]), %%ymm4, %%ymm4")  // ymm4 = s16 s17 s20 s21 s18 s19 s22 s23
+                __ASM_EMIT("vshufps         $0x88, 0x0e0(%[src]), %%ymm6, %%ymm6")  // ymm6 = s24 s25 s28 s29 s26 s27 s30 s31
+                __ASM_EMIT("vpermpd         $0xd8, %%ymm0, %%ymm0")                 // ymm0 = s0 s1 s2 s3 s4 s5 s6 s7
+                __ASM_EMIT("vpermpd         $0xd8, %%ymm2, %%ymm2")                 // ymm2 = s8 s9 s10 s11 s12 s13 s14 s15
+                __ASM_EMIT("vpermpd         $0xd8, %%ymm4, %%ymm4")                 // ymm4 = s16 s17 s18 s19 s20 s21 s22 s23
+                __ASM_EMIT("vpermpd         $0xd8, %%ymm6, %%ymm6")                 // ymm6 = s24 s25 s26 s27 s28 s29 s30 s31
+                __ASM_EMIT("vmovups         %%ymm0, 0x000(%[dst])")
+                __ASM_EMIT("vmovups         %%ymm2, 0x020(%[dst])")
+                __ASM_EMIT("vmovups         %%ymm4, 0x040(%[dst])")
+                __ASM_EMIT("vmovups         %%ymm6, 0x060(%[dst])")
+                __ASM_EMIT("add             $0x100, %[src]")
+                __ASM_EMIT("add             $0x80, %[dst]")
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                // 8x blocks
+                __ASM_EMIT("add             $24, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vmovups         0x000(%[src]), %%ymm0")                 // ymm0 = s0 ? s1 ? s2 ? s3 ?
+                __ASM_EMIT("vshufps         $0x88, 0x020(%[src]), %%ymm0, %%ymm0")  // ymm0 = s0 s1 s4 s5 s2 s3 s6 s7
+                __ASM_EMIT("vpermpd         $0xd8, %%ymm0, %%ymm0")                 // ymm0 = s0 s1 s2 s3 s4 s5 s6 s7
+                __ASM_EMIT("vmovups         %%ymm0, 0x000(%[dst])")
+                __ASM_EMIT("add             $0x40, %[src]")
+                __ASM_EMIT("add             $0x20, %[dst]")
+                __ASM_EMIT("sub             $8, %[count]")
+                __ASM_EMIT("jge             3b")
+                __ASM_EMIT("4:")
+                // 1x blocks
+                __ASM_EMIT("add             $7, %[count]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vmovss          0x000(%[src]), %%xmm0")                 // xmm0 = s0
+                __ASM_EMIT("vmovss          %%xmm0, 0x000(%[dst])")
+                __ASM_EMIT("add             $0x08, %[src]")
+                __ASM_EMIT("add             $0x04, %[dst]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jge             5b")
+                __ASM_EMIT("6:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                :
+                : "cc", "memory",
+                  "%xmm0", "%xmm2", "%xmm4", "%xmm6"
+            );
+        }
+
+        /**
+         * Downsampling with the gather instruction, idx contains offsets of 8 input samples,
+         * step is the distance between two adjacent input samples in bytes
+         */
+        static inline void downsample_gather(float *dst, const float *src, size_t count,
+            const uint32_t *idx, size_t step)
+        {
+            ARCH_X86_ASM(
+                __ASM_EMIT("vmovdqu         (%[idx]), %%ymm7")                      // ymm7 = idx
+                // 16x blocks
+                __ASM_EMIT("sub             $16, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vpcmpeqd        %%ymm4, %%ymm4, %%ymm4")                // ymm4 = mask
+                __ASM_EMIT("vpcmpeqd        %%ymm5, %%ymm5, %%ymm5")                // ymm5 = mask
+                __ASM_EMIT("vgatherdps      %%ymm4, (%[src], %%ymm7, 4), %%ymm0")   // ymm0 = s0 s1 ... s7
+                __ASM_EMIT("add             %[step], %[src]")
+                __ASM_EMIT("vgatherdps      %%ymm5, (%[src], %%ymm7, 4), %%ymm1")   // ymm1 = s8 s9 ... s15
+                __ASM_EMIT("add             %[step], %[src]")
+                __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+                __ASM_EMIT("vmovups         %%ymm1, 0x20(%[dst])")
+                __ASM_EMIT("add             $0x40, %[dst]")
+                __ASM_EMIT("sub             $16, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                // 8x block
+                __ASM_EMIT("add             $8, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("vpcmpeqd        %%ymm4, %%ymm4, %%ymm4")                // ymm4 = mask
+                __ASM_EMIT("vgatherdps      %%ymm4, (%[src], %%ymm7, 4), %%ymm0")   // ymm0 = s0 s1 ... s7
+                __ASM_EMIT("add             %[step], %[src]")
+                __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+                __ASM_EMIT("add             $0x20, %[dst]")
+                __ASM_EMIT("sub             $8, %[count]")
+                __ASM_EMIT("4:")
+                // 1x blocks
+                __ASM_EMIT("add             $7, %[count]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vmovss          0x00(%[src]), %%xmm0")                  // xmm0 = s0
+                __ASM_EMIT("vmovss          %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("add             %[step1], %[src]")
+                __ASM_EMIT("add             $0x04, %[dst]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jge             5b")
+                __ASM_EMIT("6:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [idx] "r" (idx),
+                  [step] X86_GREG (step * 8), [step1] X86_GREG (step)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm4", "%xmm5",
+                  "%xmm7"
+            );
+        }
+
+        void downsample_3x(float *dst, const float *src, size_t count)
+        {
+            downsample_gather(dst, src, count, &downsample_idx[0], 3*sizeof(float));
+        }
+
+        void downsample_4x(float *dst, const float *src, size_t count)
+        {
+            downsample_gather(dst, src, count, &downsample_idx[8], 4*sizeof(float));
+        }
+
+        void downsample_6x(float *dst, const float *src, size_t count)
+        {
+            downsample_gather(dst, src, count, &downsample_idx[16], 6*sizeof(float));
+        }
+
+        void downsample_8x(float *dst, const float *src, size_t count)
+        {
+            downsample_gather(dst, src, count, &downsample_idx[24], 8*sizeof(float));
+        }
+
+    } /* namespace avx2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_RESAMPLING_H_ */
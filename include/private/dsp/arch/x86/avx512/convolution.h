@@ -276,6 +276,10 @@ namespace lsp
             );
         }
 
+        size_t convolve_fft_threshold()
+        {
+            return 512; // Crossover point, see dsp.fft.convolve_fft performance test
+        }
     } /* namespace avx512 */
 } /* namespace lsp */
 
@@ -501,6 +501,130 @@ namespace lsp
             );
         }
 
+        void corr_lags_incr(dsp::lag_correlation_t *corr, float *dst,
+            const float *a_head, const float *b_head,
+            const float *a_tail, const float *b_tail,
+            size_t count)
+        {
+            // The sum(a*a) is the same for all lags
+            float xa        = corr->a;
+            for (size_t i=0; i<count; ++i)
+                xa             += a_head[i]*a_head[i] - a_tail[i]*a_tail[i];
+            corr->a         = xa;
+
+            // Process lags by blocks of 16, the last block is masked
+            for (size_t j=0; j<corr->lags; j += 16)
+            {
+                size_t n        = lsp_min(corr->lags - j, size_t(16));
+                uint16_t mask   = uint16_t((uint32_t(1) << n) - 1);
+                float *v        = &corr->v[j];
+                float *b        = &corr->b[j];
+                float *d        = &dst[j];
+                const float *ah = a_head;
+                const float *at = a_tail;
+                const float *bh = &b_head[j];
+                const float *bt = &b_tail[j];
+                size_t left     = count;
+
+                ARCH_X86_ASM
+                (
+                    __ASM_EMIT("kmovw           %[mask], %%k1")
+                    __ASM_EMIT("vxorps          %%zmm0, %%zmm0, %%zmm0")                /* zmm0 = sum(ah*bh) */
+                    __ASM_EMIT("vxorps          %%zmm1, %%zmm1, %%zmm1")                /* zmm1 = sum(bh*bh) */
+                    __ASM_EMIT("vxorps          %%zmm2, %%zmm2, %%zmm2")                /* zmm2 = sum(at*bt) */
+                    __ASM_EMIT("vxorps          %%zmm3, %%zmm3, %%zmm3")                /* zmm3 = sum(bt*bt) */
+                    /* 2x blocks */
+                    __ASM_EMIT64("sub           $2, %[count]")
+                    __ASM_EMIT64("jb            2f")
+                    __ASM_EMIT64("vxorps        %%zmm8, %%zmm8, %%zmm8")                /* zmm8 = sum(ah*bh) */
+                    __ASM_EMIT64("vxorps        %%zmm9, %%zmm9, %%zmm9")                /* zmm9 = sum(bh*bh) */
+                    __ASM_EMIT64("vxorps        %%zmm10, %%zmm10, %%zmm10")             /* zmm10 = sum(at*bt) */
+                    __ASM_EMIT64("vxorps        %%zmm11, %%zmm11, %%zmm11")             /* zmm11 = sum(bt*bt) */
+                    __ASM_EMIT64("1:")
+                    __ASM_EMIT64("vbroadcastss  0x00(%[ah]), %%zmm4")                   /* zmm4 = ah0 */
+                    __ASM_EMIT64("vbroadcastss  0x00(%[at]), %%zmm5")                   /* zmm5 = at0 */
+                    __ASM_EMIT64("vmovups       0x00(%[bh]), %%zmm6 %{%%k1%}%{z%}")     /* zmm6 = bh0 */
+                    __ASM_EMIT64("vmovups       0x00(%[bt]), %%zmm7 %{%%k1%}%{z%}")     /* zmm7 = bt0 */
+                    __ASM_EMIT64("vbroadcastss  0x04(%[ah]), %%zmm12")                  /* zmm12 = ah1 */
+                    __ASM_EMIT64("vbroadcastss  0x04(%[at]), %%zmm13")                  /* zmm13 = at1 */
+                    __ASM_EMIT64("vmovups       0x04(%[bh]), %%zmm14 %{%%k1%}%{z%}")    /* zmm14 = bh1 */
+                    __ASM_EMIT64("vmovups       0x04(%[bt]), %%zmm15 %{%%k1%}%{z%}")    /* zmm15 = bt1 */
+                    __ASM_EMIT64("vfmadd231ps   %%zmm4, %%zmm6, %%zmm0")                /* zmm0 = sum(ah*bh) + ah0*bh0 */
+                    __ASM_EMIT64("vfmadd231ps   %%zmm6, %%zmm6, %%zmm1")                /* zmm1 = sum(bh*bh) + bh0*bh0 */
+                    __ASM_EMIT64("vfmadd231ps   %%zmm5, %%zmm7, %%zmm2")                /* zmm2 = sum(at*bt) + at0*bt0 */
+                    __ASM_EMIT64("vfmadd231ps   %%zmm7, %%zmm7, %%zmm3")                /* zmm3 = sum(bt*bt) + bt0*bt0 */
+                    __ASM_EMIT64("vfmadd231ps   %%zmm12, %%zmm14, %%zmm8")              /* zmm8 = sum(ah*bh) + ah1*bh1 */
+                    __ASM_EMIT64("vfmadd231ps   %%zmm14, %%zmm14, %%zmm9")              /* zmm9 = sum(bh*bh) + bh1*bh1 */
+                    __ASM_EMIT64("vfmadd231ps   %%zmm13, %%zmm15, %%zmm10")             /* zmm10 = sum(at*bt) + at1*bt1 */
+                    __ASM_EMIT64("vfmadd231ps   %%zmm15, %%zmm15, %%zmm11")             /* zmm11 = sum(bt*bt) + bt1*bt1 */
+                    __ASM_EMIT64("add           $0x08, %[ah]")
+                    __ASM_EMIT64("add           $0x08, %[at]")
+                    __ASM_EMIT64("add           $0x08, %[bh]")
+                    __ASM_EMIT64("add           $0x08, %[bt]")
+                    __ASM_EMIT64("sub           $2, %[count]")
+                    __ASM_EMIT64("jae           1b")
+                    __ASM_EMIT64("vaddps        %%zmm8, %%zmm0, %%zmm0")
+                    __ASM_EMIT64("vaddps        %%zmm9, %%zmm1, %%zmm1")
+                    __ASM_EMIT64("vaddps        %%zmm10, %%zmm2, %%zmm2")
+                    __ASM_EMIT64("vaddps        %%zmm11, %%zmm3, %%zmm3")
+                    __ASM_EMIT64("2:")
+                    /* 1x blocks */
+                    __ASM_EMIT64("add           $1, %[count]")
+                    __ASM_EMIT32("sub           $1, %[count]")
+                    __ASM_EMIT("jl              4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("vbroadcastss    0x00(%[ah]), %%zmm4")                   /* zmm4 = ah0 */
+                    __ASM_EMIT("vbroadcastss    0x00(%[at]), %%zmm5")                   /* zmm5 = at0 */
+                    __ASM_EMIT("vmovups         0x00(%[bh]), %%zmm6 %{%%k1%}%{z%}")     /* zmm6 = bh0 */
+                    __ASM_EMIT("vmovups         0x00(%[bt]), %%zmm7 %{%%k1%}%{z%}")     /* zmm7 = bt0 */
+                    __ASM_EMIT("vfmadd231ps     %%zmm4, %%zmm6, %%zmm0")                /* zmm0 = sum(ah*bh) + ah0*bh0 */
+                    __ASM_EMIT("vfmadd231ps     %%zmm6, %%zmm6, %%zmm1")                /* zmm1 = sum(bh*bh) + bh0*bh0 */
+                    __ASM_EMIT("vfmadd231ps     %%zmm5, %%zmm7, %%zmm2")                /* zmm2 = sum(at*bt) + at0*bt0 */
+                    __ASM_EMIT("vfmadd231ps     %%zmm7, %%zmm7, %%zmm3")                /* zmm3 = sum(bt*bt) + bt0*bt0 */
+                    __ASM_EMIT("add             $0x04, %[ah]")
+                    __ASM_EMIT("add             $0x04, %[at]")
+                    __ASM_EMIT("add             $0x04, %[bh]")
+                    __ASM_EMIT("add             $0x04, %[bt]")
+                    __ASM_EMIT("dec             %[count]")
+                    __ASM_EMIT("jge             3b")
+                    __ASM_EMIT("4:")
+                    /* Update state, the count register is used as pointer */
+                    __ASM_EMIT("vsubps          %%zmm2, %%zmm0, %%zmm0")                /* zmm0 = DV = sum(ah*bh) - sum(at*bt) */
+                    __ASM_EMIT("vsubps          %%zmm3, %%zmm1, %%zmm1")                /* zmm1 = DB = sum(bh*bh) - sum(bt*bt) */
+                    __ASM_EMIT("mov             %[v], %[count]")
+                    __ASM_EMIT("vaddps          0x00(%[count]), %%zmm0, %%zmm0 %{%%k1%}%{z%}")  /* zmm0 = xv = v + DV */
+                    __ASM_EMIT("vmovups         %%zmm0, 0x00(%[count]) %{%%k1%}")
+                    __ASM_EMIT("mov             %[b], %[count]")
+                    __ASM_EMIT("vaddps          0x00(%[count]), %%zmm1, %%zmm1 %{%%k1%}%{z%}")  /* zmm1 = xb = b + DB */
+                    __ASM_EMIT("vmovups         %%zmm1, 0x00(%[count]) %{%%k1%}")
+                    /* Compute normalized correlation */
+                    __ASM_EMIT("vbroadcastss    %[xa], %%zmm4")                         /* zmm4 = xa */
+                    __ASM_EMIT("vmulps          %%zmm4, %%zmm1, %%zmm1")                /* zmm1 = B = xa*xb */
+                    __ASM_EMIT("vsqrtps         %%zmm1, %%zmm5")                        /* zmm5 = sqrtf(B) */
+                    __ASM_EMIT("vcmpps          $5, %[CORR_CC], %%zmm1, %%k2 %{%%k1%}") /* k2   = B >= threshold */
+                    __ASM_EMIT("vdivps          %%zmm5, %%zmm0, %%zmm0")                /* zmm0 = xv/sqrtf(B) */
+                    __ASM_EMIT("mov             %[dst], %[count]")
+                    __ASM_EMIT("vmovaps         %%zmm0, %%zmm0 %{%%k2%}%{z%}")          /* zmm0 = (B >= threshold) ? xv/sqrtf(B) : 0 */
+                    __ASM_EMIT("vmovups         %%zmm0, 0x00(%[count]) %{%%k1%}")
+
+                    : [ah] "+r" (ah), [at] "+r" (at),
+                      [bh] "+r" (bh), [bt] "+r" (bt),
+                      [count] "+r" (left)
+                    : [v] "m" (v), [b] "m" (b), [dst] "m" (d),
+                      [xa] "m" (xa), [mask] "m" (mask),
+                      [CORR_CC] "o" (corr_const)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                      __IF_64(
+                          "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                          "%xmm12", "%xmm13", "%xmm14", "%xmm15",
+                      )
+                      "%k1", "%k2"
+                );
+            }
+        }
+
     } /* namespace avx512 */
 } /* namespace lsp */
 
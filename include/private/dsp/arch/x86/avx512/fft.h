@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FFT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+#include <private/dsp/arch/x86/avx512/fft/const.h>
+#include <private/dsp/arch/x86/avx512/fft/scramble.h>
+#include <private/dsp/arch/x86/avx512/fft/butterfly.h>
+#include <private/dsp/arch/x86/avx512/fft/normalize.h>
+
+namespace lsp
+{
+    namespace avx512
+    {
+        /**
+         * Perform FFT of rank less than 4 on the data stored in bit-reversed order
+         * @param re real part of data
+         * @param im imaginary part of data
+         * @param rank rank of FFT
+         * @param dir -1 for direct FFT, +1 for reverse FFT
+         */
+        static inline void small_fft_core(float *re, float *im, size_t rank, float dir)
+        {
+            size_t count = 1 << rank;
+
+            for (size_t n=1; n < count; n <<= 1)
+            {
+                size_t step = 16 / n; // The first row of FFT_A contains angles k*pi/16
+                for (size_t k=0; k<n; ++k)
+                {
+                    float w_re      = FFT_A[k*step];
+                    float w_im      = dir * FFT_A[16 + k*step];
+
+                    for (size_t a=k; a<count; a += (n << 1))
+                    {
+                        size_t b        = a + n;
+                        float c_re      = re[b]*w_re - im[b]*w_im;
+                        float c_im      = re[b]*w_im + im[b]*w_re;
+
+                        re[b]           = re[a] - c_re;
+                        im[b]           = im[a] - c_im;
+                        re[a]           = re[a] + c_re;
+                        im[a]           = im[a] + c_im;
+                    }
+                }
+            }
+        }
+
+        static inline void small_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank, float dir)
+        {
+            float re[8], im[8];
+            size_t count = 1 << rank;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                size_t j        = (rank > 0) ? reverse_bits(uint32_t(i), rank) : 0;
+                re[j]           = src_re[i];
+                im[j]           = src_im[i];
+            }
+
+            small_fft_core(re, im, rank, dir);
+
+            float k = (dir > 0.0f) ? 1.0f / count : 1.0f;
+            for (size_t i=0; i<count; ++i)
+            {
+                dst_re[i]       = re[i] * k;
+                dst_im[i]       = im[i] * k;
+            }
+        }
+
+        void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        {
+            // Check bounds
+            if (rank < 4)
+            {
+                small_fft(dst_re, dst_im, src_re, src_im, rank, -1.0f);
+                return;
+            }
+
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                dsp::move(dst_re, src_re, 1 << rank);
+                dsp::move(dst_im, src_im, 1 << rank);
+                scramble_self(dst_re, dst_im, rank, FFT_S_DIRECT);
+            }
+            else
+                scramble_copy(dst_re, dst_im, src_re, src_im, rank, FFT_S_DIRECT);
+
+            for (size_t i=4; i < rank; ++i)
+                butterfly_direct16p(dst_re, dst_im, i, 1 << (rank - i - 1));
+        }
+
+        void reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        {
+            // Check bounds
+            if (rank < 4)
+            {
+                small_fft(dst_re, dst_im, src_re, src_im, rank, 1.0f);
+                return;
+            }
+
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                dsp::move(dst_re, src_re, 1 << rank);
+                dsp::move(dst_im, src_im, 1 << rank);
+                scramble_self(dst_re, dst_im, rank, FFT_S_REVERSE);
+            }
+            else
+                scramble_copy(dst_re, dst_im, src_re, src_im, rank, FFT_S_REVERSE);
+
+            for (size_t i=4; i < rank; ++i)
+                butterfly_reverse16p(dst_re, dst_im, i, 1 << (rank - i - 1));
+
+            normalize_fft2(dst_re, dst_im, rank);
+        }
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FFT_H_ */
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FFT_BUTTERFLY_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FFT_BUTTERFLY_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+namespace lsp
+{
+    namespace avx512
+    {
+        #define FFT_BUTTERFLY_BODY16(add_b, add_a) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                /* Prepare angle */ \
+                __ASM_EMIT("vmovaps         0x00(%[fft_a]), %%zmm6")                        /* zmm6 = x_re */ \
+                __ASM_EMIT("vmovaps         0x40(%[fft_a]), %%zmm7")                        /* zmm7 = x_im */ \
+                __ASM_EMIT("mov             %[shift], %[np]") \
+                /* Process pairs */ \
+                __ASM_EMIT("2:") \
+                    __ASM_EMIT("vmovups         0x00(%[dst_re]), %%zmm0")                   /* zmm0 = a_re */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst_re], %[shift]), %%zmm2")         /* zmm2 = b_re */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst_im]), %%zmm1")                   /* zmm1 = a_im */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst_im], %[shift]), %%zmm3")         /* zmm3 = b_im */ \
+                    /* Calculate complex multiplication */ \
+                    __ASM_EMIT("vmulps          %%zmm7, %%zmm2, %%zmm4")                    /* zmm4 = x_im * b_re */ \
+                    __ASM_EMIT("vmulps          %%zmm7, %%zmm3, %%zmm5")                    /* zmm5 = x_im * b_im */ \
+                    __ASM_EMIT(add_b "     %%zmm6, %%zmm2, %%zmm5")                         /* zmm5 = c_re = x_re * b_re +- x_im * b_im */ \
+                    __ASM_EMIT(add_a "     %%zmm6, %%zmm3, %%zmm4")                         /* zmm4 = c_im = x_re * b_im -+ x_im * b_re */ \
+                    /* Perform butterfly */ \
+                    __ASM_EMIT("vsubps          %%zmm5, %%zmm0, %%zmm2")                    /* zmm2 = a_re - c_re */ \
+                    __ASM_EMIT("vsubps          %%zmm4, %%zmm1, %%zmm3")                    /* zmm3 = a_im - c_im */ \
+                    __ASM_EMIT("vaddps          %%zmm5, %%zmm0, %%zmm0")                    /* zmm0 = a_re + c_re */ \
+                    __ASM_EMIT("vaddps          %%zmm4, %%zmm1, %%zmm1")                    /* zmm1 = a_im + c_im */ \
+                    /* Store values */ \
+                    __ASM_EMIT("vmovups         %%zmm0, 0x00(%[dst_re])") \
+                    __ASM_EMIT("vmovups         %%zmm2, 0x00(%[dst_re], %[shift])") \
+                    __ASM_EMIT("vmovups         %%zmm1, 0x00(%[dst_im])") \
+                    __ASM_EMIT("vmovups         %%zmm3, 0x00(%[dst_im], %[shift])") \
+                    __ASM_EMIT("add             $0x40, %[dst_re]") \
+                    __ASM_EMIT("add             $0x40, %[dst_im]") \
+                    __ASM_EMIT("sub             $0x40, %[np]") \
+                    __ASM_EMIT("jz              3f") \
+                    /* Rotate angle */ \
+                    __ASM_EMIT("vmulps          0xc0(%[fft_a]), %%zmm6, %%zmm2")            /* zmm2 = w_im * x_re */ \
+                    __ASM_EMIT("vmulps          0xc0(%[fft_a]), %%zmm7, %%zmm3")            /* zmm3 = w_im * x_im */ \
+                    __ASM_EMIT("vfmsub132ps     0x80(%[fft_a]), %%zmm3, %%zmm6")            /* zmm6 = x_re' = w_re * x_re - w_im * x_im */ \
+                    __ASM_EMIT("vfmadd132ps     0x80(%[fft_a]), %%zmm2, %%zmm7")            /* zmm7 = x_im' = w_re * x_im + w_im * x_re */ \
+                __ASM_EMIT("jmp             2b") \
+                /* Move to the next block */ \
+                __ASM_EMIT("3:") \
+                __ASM_EMIT("add             %[shift], %[dst_re]") \
+                __ASM_EMIT("add             %[shift], %[dst_im]") \
+                __ASM_EMIT32("decl          %[blocks]") \
+                __ASM_EMIT64("decq          %[blocks]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [dst_re] "+r" (dst_re), [dst_im] "+r" (dst_im), \
+                  [np] "=&r" (np), [blocks] X86_PGREG (blocks) \
+                : [shift] "r" (shift), [fft_a] "r" (fft_a) \
+                : "cc", "memory",  \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"  \
+            );
+
+        #define FFT_PBUTTERFLY_BODY16(add_b, add_a) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                /* Prepare angle */ \
+                __ASM_EMIT("vmovaps         0x00(%[fft_a]), %%zmm6")                        /* zmm6 = x_re */ \
+                __ASM_EMIT("vmovaps         0x40(%[fft_a]), %%zmm7")                        /* zmm7 = x_im */ \
+                __ASM_EMIT("mov             %[shift], %[np]") \
+                /* Process pairs */ \
+                __ASM_EMIT("2:") \
+                    __ASM_EMIT("vmovups         0x00(%[dst]), %%zmm0")                      /* zmm0 = a_re */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst], %[shift]), %%zmm2")            /* zmm2 = b_re */ \
+                    __ASM_EMIT("vmovups         0x40(%[dst]), %%zmm1")                      /* zmm1 = a_im */ \
+                    __ASM_EMIT("vmovups         0x40(%[dst], %[shift]), %%zmm3")            /* zmm3 = b_im */ \
+                    /* Calculate complex multiplication */ \
+                    __ASM_EMIT("vmulps          %%zmm7, %%zmm2, %%zmm4")                    /* zmm4 = x_im * b_re */ \
+                    __ASM_EMIT("vmulps          %%zmm7, %%zmm3, %%zmm5")                    /* zmm5 = x_im * b_im */ \
+                    __ASM_EMIT(add_b "     %%zmm6, %%zmm2, %%zmm5")                         /* zmm5 = c_re = x_re * b_re +- x_im * b_im */ \
+                    __ASM_EMIT(add_a "     %%zmm6, %%zmm3, %%zmm4")                         /* zmm4 = c_im = x_re * b_im -+ x_im * b_re */ \
+                    /* Perform butterfly */ \
+                    __ASM_EMIT("vsubps          %%zmm5, %%zmm0, %%zmm2")                    /* zmm2 = a_re - c_re */ \
+                    __ASM_EMIT("vsubps          %%zmm4, %%zmm1, %%zmm3")                    /* zmm3 = a_im - c_im */ \
+                    __ASM_EMIT("vaddps          %%zmm5, %%zmm0, %%zmm0")                    /* zmm0 = a_re + c_re */ \
+                    __ASM_EMIT("vaddps          %%zmm4, %%zmm1, %%zmm1")                    /* zmm1 = a_im + c_im */ \
+                    /* Store values */ \
+                    __ASM_EMIT("vmovups         %%zmm0, 0x00(%[dst])") \
+                    __ASM_EMIT("vmovups         %%zmm2, 0x00(%[dst], %[shift])") \
+                    __ASM_EMIT("vmovups         %%zmm1, 0x40(%[dst])") \
+                    __ASM_EMIT("vmovups         %%zmm3, 0x40(%[dst], %[shift])") \
+                    __ASM_EMIT("add             $0x80, %[dst]") \
+                    __ASM_EMIT("sub             $0x80, %[np]") \
+                    __ASM_EMIT("jz              3f") \
+                    /* Rotate angle */ \
+                    __ASM_EMIT("vmulps          0xc0(%[fft_a]), %%zmm6, %%zmm2")            /* zmm2 = w_im * x_re */ \
+                    __ASM_EMIT("vmulps          0xc0(%[fft_a]), %%zmm7, %%zmm3")            /* zmm3 = w_im * x_im */ \
+                    __ASM_EMIT("vfmsub132ps     0x80(%[fft_a]), %%zmm3, %%zmm6")            /* zmm6 = x_re' = w_re * x_re - w_im * x_im */ \
+                    __ASM_EMIT("vfmadd132ps     0x80(%[fft_a]), %%zmm2, %%zmm7")            /* zmm7 = x_im' = w_re * x_im + w_im * x_re */ \
+                __ASM_EMIT("jmp             2b") \
+                /* Move to the next block */ \
+                __ASM_EMIT("3:") \
+                __ASM_EMIT("add             %[shift], %[dst]") \
+                __ASM_EMIT32("decl          %[blocks]") \
+                __ASM_EMIT64("decq          %[blocks]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [dst] "+r" (dst), \
+                  [np] "=&r" (np), [blocks] X86_PGREG (blocks) \
+                : [shift] "r" (shift), [fft_a] "r" (fft_a) \
+                : "cc", "memory",  \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"  \
+            );
+
+        static inline void butterfly_direct16p(float *dst_re, float *dst_im, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = 4 << rank;
+            const float *fft_a  = &FFT_A[(rank - 4) << 6];
+
+            FFT_BUTTERFLY_BODY16("vfmadd231ps", "vfmsub231ps");
+        }
+
+        static inline void butterfly_reverse16p(float *dst_re, float *dst_im, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = 4 << rank;
+            const float *fft_a  = &FFT_A[(rank - 4) << 6];
+
+            FFT_BUTTERFLY_BODY16("vfmsub231ps", "vfmadd231ps");
+        }
+
+        static inline void packed_butterfly_direct16p(float *dst, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = 8 << rank;
+            const float *fft_a  = &FFT_A[(rank - 4) << 6];
+
+            FFT_PBUTTERFLY_BODY16("vfmadd231ps", "vfmsub231ps");
+        }
+
+        static inline void packed_butterfly_reverse16p(float *dst, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = 8 << rank;
+            const float *fft_a  = &FFT_A[(rank - 4) << 6];
+
+            FFT_PBUTTERFLY_BODY16("vfmsub231ps", "vfmadd231ps");
+        }
+
+        #undef FFT_BUTTERFLY_BODY16
+        #undef FFT_PBUTTERFLY_BODY16
+
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FFT_BUTTERFLY_H_ */
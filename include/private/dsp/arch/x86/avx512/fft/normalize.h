@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FFT_NORMALIZE_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FFT_NORMALIZE_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+namespace lsp
+{
+    namespace avx512
+    {
+        #define FFT_NORMALIZE_CORE(DRE, DIM, SRE, SIM) \
+            __ASM_EMIT("vbroadcastss    %[k], %%zmm0")                          /* zmm0 = k */ \
+            __ASM_EMIT("vmovaps         %%zmm0, %%zmm1") \
+            /* x32 blocks */ \
+            __ASM_EMIT32("subl           $32, %[count]") \
+            __ASM_EMIT64("sub             $32, %[count]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("vmulps          0x00(%[" SRE "], %[off]), %%zmm0, %%zmm4") \
+            __ASM_EMIT("vmulps          0x40(%[" SRE "], %[off]), %%zmm1, %%zmm5") \
+            __ASM_EMIT("vmulps          0x00(%[" SIM "], %[off]), %%zmm0, %%zmm6") \
+            __ASM_EMIT("vmulps          0x40(%[" SIM "], %[off]), %%zmm1, %%zmm7") \
+            __ASM_EMIT("vmovups         %%zmm4, 0x00(%[" DRE "], %[off])") \
+            __ASM_EMIT("vmovups         %%zmm5, 0x40(%[" DRE "], %[off])") \
+            __ASM_EMIT("vmovups         %%zmm6, 0x00(%[" DIM "], %[off])") \
+            __ASM_EMIT("vmovups         %%zmm7, 0x40(%[" DIM "], %[off])") \
+            __ASM_EMIT("add             $0x80, %[off]") \
+            __ASM_EMIT32("subl           $32, %[count]") \
+            __ASM_EMIT64("sub             $32, %[count]") \
+            __ASM_EMIT("jae             1b") \
+            __ASM_EMIT("2:") \
+            /* x16 block */ \
+            __ASM_EMIT32("addl           $16, %[count]") \
+            __ASM_EMIT64("add             $16, %[count]") \
+            __ASM_EMIT("jl              4f") \
+            __ASM_EMIT("vmulps          0x00(%[" SRE "], %[off]), %%zmm0, %%zmm4") \
+            __ASM_EMIT("vmulps          0x00(%[" SIM "], %[off]), %%zmm1, %%zmm6") \
+            __ASM_EMIT("vmovups         %%zmm4, 0x00(%[" DRE "], %[off])") \
+            __ASM_EMIT("vmovups         %%zmm6, 0x00(%[" DIM "], %[off])") \
+            __ASM_EMIT("add             $0x40, %[off]") \
+            __ASM_EMIT32("subl           $16, %[count]") \
+            __ASM_EMIT64("sub             $16, %[count]") \
+            __ASM_EMIT("4:") \
+            /* x8 block */ \
+            __ASM_EMIT32("addl           $8, %[count]") \
+            __ASM_EMIT64("add             $8, %[count]") \
+            __ASM_EMIT("jl              6f") \
+            __ASM_EMIT("vmulps          0x00(%[" SRE "], %[off]), %%ymm0, %%ymm4") \
+            __ASM_EMIT("vmulps          0x00(%[" SIM "], %[off]), %%ymm1, %%ymm6") \
+            __ASM_EMIT("vmovups         %%ymm4, 0x00(%[" DRE "], %[off])") \
+            __ASM_EMIT("vmovups         %%ymm6, 0x00(%[" DIM "], %[off])") \
+            __ASM_EMIT("add             $0x20, %[off]") \
+            __ASM_EMIT32("subl           $8, %[count]") \
+            __ASM_EMIT64("sub             $8, %[count]") \
+            __ASM_EMIT("6:") \
+            /* x4 block */ \
+            __ASM_EMIT32("addl           $4, %[count]") \
+            __ASM_EMIT64("add             $4, %[count]") \
+            __ASM_EMIT("jl              8f") \
+            __ASM_EMIT("vmulps          0x00(%[" SRE "], %[off]), %%xmm0, %%xmm4") \
+            __ASM_EMIT("vmulps          0x00(%[" SIM "], %[off]), %%xmm1, %%xmm6") \
+            __ASM_EMIT("vmovups         %%xmm4, 0x00(%[" DRE "], %[off])") \
+            __ASM_EMIT("vmovups         %%xmm6, 0x00(%[" DIM "], %[off])") \
+            __ASM_EMIT("add             $0x10, %[off]") \
+            __ASM_EMIT32("subl           $4, %[count]") \
+            __ASM_EMIT64("sub             $4, %[count]") \
+            __ASM_EMIT("8:") \
+            /* x1 blocks */ \
+            __ASM_EMIT32("addl           $3, %[count]") \
+            __ASM_EMIT64("add             $3, %[count]") \
+            __ASM_EMIT("jl              10f") \
+            __ASM_EMIT("9:") \
+            __ASM_EMIT("vmulss          0x00(%[" SRE "], %[off]), %%xmm0, %%xmm4") \
+            __ASM_EMIT("vmulss          0x00(%[" SIM "], %[off]), %%xmm1, %%xmm6") \
+            __ASM_EMIT("vmovss          %%xmm4, 0x00(%[" DRE "], %[off])") \
+            __ASM_EMIT("vmovss          %%xmm6, 0x00(%[" DIM "], %[off])") \
+            __ASM_EMIT("add             $0x04, %[off]") \
+            __ASM_EMIT32("decl           %[count]") \
+            __ASM_EMIT64("dec             %[count]") \
+            __ASM_EMIT("jge             9b") \
+            __ASM_EMIT("10:")
+
+        void normalize_fft3(float *dre, float *dim, const float *re, const float *im, size_t rank)
+        {
+            IF_ARCH_X86(
+                float k = 1.0f/(1 << rank);
+                size_t count = 1 << rank, off = 0;
+            );
+            ARCH_X86_ASM(
+                FFT_NORMALIZE_CORE("d_re", "d_im", "s_re", "s_im")
+                : [off] "+r" (off),
+                  [count] X86_PGREG (count)
+                : [s_re] "r" (re), [s_im] "r" (im),
+                  [d_re] "r" (dre), [d_im] "r" (dim),
+                  [k] "m" (k)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void normalize_fft2(float *re, float *im, size_t rank)
+        {
+            IF_ARCH_X86(
+                float k = 1.0f/(1 << rank);
+                size_t count = 1 << rank, off = 0;
+            );
+            ARCH_X86_ASM(
+                FFT_NORMALIZE_CORE("d_re", "d_im", "d_re", "d_im")
+                : [off] "+r" (off), [count] "+r" (count)
+                : [d_re] "r" (re), [d_im] "r" (im),
+                  [k] "m" (k)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef FFT_NORMALIZE_CORE
+
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FFT_NORMALIZE_H_ */
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FFT_P_REPACK_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FFT_P_REPACK_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+namespace lsp
+{
+    namespace avx512
+    {
+        static inline void packed_fft_repack(float *dst, size_t rank)
+        {
+            size_t blocks = 1 << (rank - 4);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovdqa32       0xc0 + %[FFT_IDX], %%zmm2")
+                __ASM_EMIT("vmovdqa32       0x100 + %[FFT_IDX], %%zmm3")
+                __ASM_EMIT("vmovups         0x00(%[dst]), %%zmm0")              /* zmm0 = r0 r1 ... r15 */
+                __ASM_EMIT("vmovups         0x40(%[dst]), %%zmm1")              /* zmm1 = i0 i1 ... i15 */
+                __ASM_EMIT("vpermi2ps       %%zmm1, %%zmm0, %%zmm2")            /* zmm2 = r0 i0 r1 i1 ... r7 i7 */
+                __ASM_EMIT("vpermi2ps       %%zmm1, %%zmm0, %%zmm3")            /* zmm3 = r8 i8 r9 i9 ... r15 i15 */
+                __ASM_EMIT("vmovups         %%zmm2, 0x00(%[dst])")
+                __ASM_EMIT("vmovups         %%zmm3, 0x40(%[dst])")
+                __ASM_EMIT("add             $0x80, %[dst]")
+                __ASM_EMIT("dec             %[blocks]")
+                __ASM_EMIT("jnz             1b")
+
+                : [dst] "+r"(dst), [blocks] "+r" (blocks)
+                : [FFT_IDX] "o" (FFT_IDX)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3"
+            );
+        }
+
+        static inline void packed_fft_repack_normalize(float *dst, size_t rank)
+        {
+            size_t blocks = 1 << (rank - 4);
+            float norm = 1.0f / float(1 << rank);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vbroadcastss    %[norm], %%zmm4")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovdqa32       0xc0 + %[FFT_IDX], %%zmm2")
+                __ASM_EMIT("vmovdqa32       0x100 + %[FFT_IDX], %%zmm3")
+                __ASM_EMIT("vmulps          0x00(%[dst]), %%zmm4, %%zmm0")      /* zmm0 = r0 r1 ... r15 */
+                __ASM_EMIT("vmulps          0x40(%[dst]), %%zmm4, %%zmm1")      /* zmm1 = i0 i1 ... i15 */
+                __ASM_EMIT("vpermi2ps       %%zmm1, %%zmm0, %%zmm2")            /* zmm2 = r0 i0 r1 i1 ... r7 i7 */
+                __ASM_EMIT("vpermi2ps       %%zmm1, %%zmm0, %%zmm3")            /* zmm3 = r8 i8 r9 i9 ... r15 i15 */
+                __ASM_EMIT("vmovups         %%zmm2, 0x00(%[dst])")
+                __ASM_EMIT("vmovups         %%zmm3, 0x40(%[dst])")
+                __ASM_EMIT("add             $0x80, %[dst]")
+                __ASM_EMIT("dec             %[blocks]")
+                __ASM_EMIT("jnz             1b")
+
+                : [dst] "+r"(dst), [blocks] "+r" (blocks)
+                : [FFT_IDX] "o" (FFT_IDX),
+                  [norm] "m" (norm)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4"
+            );
+        }
+
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FFT_P_REPACK_H_ */
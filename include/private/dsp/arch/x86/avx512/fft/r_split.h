@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FFT_R_SPLIT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FFT_R_SPLIT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+namespace lsp
+{
+    namespace avx512
+    {
+        /* Load 16 complex numbers a[0..15] and 16 complex numbers b[-1..-16] stored in reverse order */
+        #define RFFT_SPLIT_LOAD \
+            __ASM_EMIT("vmovups         0x00(%[a]), %%zmm0") \
+            __ASM_EMIT("vmovups         0x00(%[b]), %%zmm2") \
+            __ASM_EMIT("vmovaps         %%zmm0, %%zmm1") \
+            __ASM_EMIT("vmovaps         %%zmm2, %%zmm3") \
+            __ASM_EMIT("vpermt2ps       0x40(%[a]), %%zmm8, %%zmm0")            /* zmm0 = ar */ \
+            __ASM_EMIT("vpermt2ps       0x40(%[a]), %%zmm9, %%zmm1")            /* zmm1 = ai */ \
+            __ASM_EMIT("vpermt2ps       0x40(%[b]), %%zmm12, %%zmm2")           /* zmm2 = br */ \
+            __ASM_EMIT("vpermt2ps       0x40(%[b]), %%zmm13, %%zmm3")           /* zmm3 = bi */
+
+        /* Rotate the twiddle factors */
+        #define RFFT_SPLIT_ROTATE \
+            __ASM_EMIT("vmulps          0xc0(%[w]), %%zmm6, %%zmm0")            /* zmm0 = w_re * dw_im */ \
+            __ASM_EMIT("vmulps          0xc0(%[w]), %%zmm7, %%zmm1")            /* zmm1 = w_im * dw_im */ \
+            __ASM_EMIT("vfmadd231ps     0x80(%[w]), %%zmm7, %%zmm0")            /* zmm0 = w_im' = w_re * dw_im + w_im * dw_re */ \
+            __ASM_EMIT("vfmsub132ps     0x80(%[w]), %%zmm1, %%zmm6")            /* zmm6 = w_re' = w_re * dw_re - w_im * dw_im */ \
+            __ASM_EMIT("vmovaps         %%zmm0, %%zmm7")
+
+        #define RFFT_SPLIT_PROLOGUE \
+            __ASM_EMIT("vmovaps         0x00(%[w]), %%zmm6")                    /* zmm6 = w_re */ \
+            __ASM_EMIT("vmovaps         0x40(%[w]), %%zmm7")                    /* zmm7 = w_im */ \
+            __ASM_EMIT("vmovaps         0x040(%[IDX]), %%zmm8")                 /* zmm8 = index of re */ \
+            __ASM_EMIT("vmovaps         0x080(%[IDX]), %%zmm9")                 /* zmm9 = index of im */ \
+            __ASM_EMIT("vmovaps         0x0c0(%[IDX]), %%zmm10")                /* zmm10 = index of lower half */ \
+            __ASM_EMIT("vmovaps         0x100(%[IDX]), %%zmm11")                /* zmm11 = index of upper half */ \
+            __ASM_EMIT("vmovaps         0x000(%[RIDX]), %%zmm12")               /* zmm12 = reverse index of re */ \
+            __ASM_EMIT("vmovaps         0x040(%[RIDX]), %%zmm13")               /* zmm13 = reverse index of im */ \
+            __ASM_EMIT("vmovaps         0x080(%[RIDX]), %%zmm14")               /* zmm14 = reverse index of lower half */ \
+            __ASM_EMIT("vmovaps         0x0c0(%[RIDX]), %%zmm15")               /* zmm15 = reverse index of upper half */
+
+    IF_ARCH_X86_64(
+        static const float rfft_split_const[] __lsp_aligned64 =
+        {
+            LSP_DSP_VEC16(0.5f)
+        };
+
+        /* Indices for unpacking and packing 16 complex numbers stored in reverse order */
+        static const uint32_t RFFT_IDX[] __lsp_aligned64 =
+        {
+            // real parts of packed complex numbers in reverse order
+            30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0,
+            // imaginary parts of packed complex numbers in reverse order
+            31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1,
+            // lower half of packed complex numbers in reverse order
+            15, 31, 14, 30, 13, 29, 12, 28, 11, 27, 10, 26, 9, 25, 8, 24,
+            // upper half of packed complex numbers in reverse order
+            7, 23, 6, 22, 5, 21, 4, 20, 3, 19, 2, 18, 1, 17, 0, 16
+        };
+
+        /**
+         * Compute twiddle factors for the split pass from the FFT tables: initial angles
+         * (1..16)*pi/N and the rotation by 16*pi/N, N = 2^(rank-1), rank >= 6
+         */
+        static inline void real_split_twiddle(float *w, size_t rank)
+        {
+            const float *a      = &FFT_A[(rank - 5) << 6];      // angles (0..15)*pi/N, rotation by 16*pi/N
+
+            for (size_t i=0; i<15; ++i)
+            {
+                w[i]        = a[i + 1];
+                w[i + 16]   = a[i + 17];
+            }
+
+            // 16*pi/N = 2 * (8*pi/N)
+            w[15]       = a[8]*a[8] - a[24]*a[24];
+            w[31]       = 2.0f * a[8]*a[24];
+
+            for (size_t i=32; i<64; ++i)
+                w[i]        = a[i];
+        }
+
+        /**
+         * Split the spectrum of the complex FFT of half size into the spectrum of real FFT,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 6.
+         * X[k] = (Z[k] + Z*[N-k])/2 - j*W^k * (Z[k] - Z*[N-k])/2
+         */
+        static inline void x64_real_split_direct(float *dst, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            float *a        = &dst[2];
+            float *b        = &dst[(items - 16) << 1];
+            float w[64] __lsp_aligned64;
+            size_t blocks   = items >> 5;
+            real_split_twiddle(w, rank);
+
+            ARCH_X86_64_ASM
+            (
+                RFFT_SPLIT_PROLOGUE
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("1:")
+                RFFT_SPLIT_LOAD
+                /* Compute sums and differences */
+                __ASM_EMIT("vaddps          %%zmm2, %%zmm0, %%zmm4")                /* zmm4 = s = ar + br */
+                __ASM_EMIT("vsubps          %%zmm0, %%zmm2, %%zmm2")                /* zmm2 = q = br - ar */
+                __ASM_EMIT("vaddps          %%zmm3, %%zmm1, %%zmm5")                /* zmm5 = p = ai + bi */
+                __ASM_EMIT("vsubps          %%zmm3, %%zmm1, %%zmm1")                /* zmm1 = d = ai - bi */
+                /* Apply twiddle factors */
+                __ASM_EMIT("vmulps          %%zmm6, %%zmm5, %%zmm0")                /* zmm0 = w_re*p */
+                __ASM_EMIT("vmulps          %%zmm6, %%zmm2, %%zmm3")                /* zmm3 = w_re*q */
+                __ASM_EMIT("vfmadd231ps     %%zmm7, %%zmm2, %%zmm0")                /* zmm0 = t_re = w_re*p + w_im*q */
+                __ASM_EMIT("vfnmadd231ps    %%zmm7, %%zmm5, %%zmm3")                /* zmm3 = t_im = w_re*q - w_im*p */
+                /* Compute the output */
+                __ASM_EMIT("vaddps          %%zmm0, %%zmm4, %%zmm2")                /* zmm2 = s + t_re */
+                __ASM_EMIT("vsubps          %%zmm0, %%zmm4, %%zmm4")                /* zmm4 = s - t_re */
+                __ASM_EMIT("vaddps          %%zmm1, %%zmm3, %%zmm5")                /* zmm5 = t_im + d */
+                __ASM_EMIT("vsubps          %%zmm1, %%zmm3, %%zmm3")                /* zmm3 = t_im - d */
+                __ASM_EMIT("vmulps          %[X_HALF], %%zmm2, %%zmm2")             /* zmm2 = xa_re = (s + t_re)/2 */
+                __ASM_EMIT("vmulps          %[X_HALF], %%zmm4, %%zmm4")             /* zmm4 = xb_re = (s - t_re)/2 */
+                __ASM_EMIT("vmulps          %[X_HALF], %%zmm5, %%zmm5")             /* zmm5 = xa_im = (t_im + d)/2 */
+                __ASM_EMIT("vmulps          %[X_HALF], %%zmm3, %%zmm3")             /* zmm3 = xb_im = (t_im - d)/2 */
+                /* Pack and store data */
+                __ASM_EMIT("vmovaps         %%zmm2, %%zmm0")
+                __ASM_EMIT("vmovaps         %%zmm4, %%zmm1")
+                __ASM_EMIT("vpermt2ps       %%zmm5, %%zmm10, %%zmm0")               /* zmm0 = a0 .. a7 */
+                __ASM_EMIT("vpermt2ps       %%zmm5, %%zmm11, %%zmm2")               /* zmm2 = a8 .. a15 */
+                __ASM_EMIT("vpermt2ps       %%zmm3, %%zmm14, %%zmm1")               /* zmm1 = b15 .. b8 */
+                __ASM_EMIT("vpermt2ps       %%zmm3, %%zmm15, %%zmm4")               /* zmm4 = b7 .. b0 */
+                __ASM_EMIT("vmovups         %%zmm0, 0x00(%[a])")
+                __ASM_EMIT("vmovups         %%zmm2, 0x40(%[a])")
+                __ASM_EMIT("vmovups         %%zmm1, 0x00(%[b])")
+                __ASM_EMIT("vmovups         %%zmm4, 0x40(%[b])")
+                __ASM_EMIT("add             $0x80, %[a]")
+                __ASM_EMIT("sub             $0x80, %[b]")
+                __ASM_EMIT("dec             %[blocks]")
+                __ASM_EMIT("jz              2f")
+                RFFT_SPLIT_ROTATE
+                __ASM_EMIT("jmp             1b")
+                __ASM_EMIT("2:")
+
+                : [a] "+r" (a), [b] "+r" (b), [blocks] "+r" (blocks)
+                : [w] "r" (w),
+                  [IDX] "r" (FFT_IDX), [RIDX] "r" (RFFT_IDX),
+                  [X_HALF] "m" (rfft_split_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                  "%xmm12", "%xmm13", "%xmm14", "%xmm15"
+            );
+        }
+
+        /**
+         * Join the Hermitian-symmetric spectrum into the spectrum of the complex FFT of half size,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 6.
+         * Z[k] = (X[k] + X*[N-k])/2 + j*W^-k * (X[k] - X*[N-k])/2
+         */
+        static inline void x64_real_split_reverse(float *dst, const float *src, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            const float *a  = &src[2];
+            const float *b  = &src[(items - 16) << 1];
+            ptrdiff_t delta = reinterpret_cast<uint8_t *>(dst) - reinterpret_cast<const uint8_t *>(src);
+            float w[64] __lsp_aligned64;
+            size_t blocks   = items >> 5;
+            real_split_twiddle(w, rank);
+
+            ARCH_X86_64_ASM
+            (
+                RFFT_SPLIT_PROLOGUE
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("1:")
+                RFFT_SPLIT_LOAD
+                /* Compute sums and differences */
+                __ASM_EMIT("vaddps          %%zmm2, %%zmm0, %%zmm4")                /* zmm4 = s = ar + br */
+                __ASM_EMIT("vsubps          %%zmm2, %%zmm0, %%zmm0")                /* zmm0 = p = ar - br */
+                __ASM_EMIT("vaddps          %%zmm3, %%zmm1, %%zmm5")                /* zmm5 = q = ai + bi */
+                __ASM_EMIT("vsubps          %%zmm3, %%zmm1, %%zmm1")                /* zmm1 = d = ai - bi */
+                /* Apply twiddle factors */
+                __ASM_EMIT("vmulps          %%zmm6, %%zmm0, %%zmm2")                /* zmm2 = w_re*p */
+                __ASM_EMIT("vmulps          %%zmm6, %%zmm5, %%zmm3")                /* zmm3 = w_re*q */
+                __ASM_EMIT("vfnmadd231ps    %%zmm7, %%zmm5, %%zmm2")                /* zmm2 = o_re = w_re*p - w_im*q */
+                __ASM_EMIT("vfmadd231ps     %%zmm7, %%zmm0, %%zmm3")                /* zmm3 = o_im = w_re*q + w_im*p */
+                /* Compute the output */
+                __ASM_EMIT("vsubps          %%zmm3, %%zmm4, %%zmm0")                /* zmm0 = s - o_im */
+                __ASM_EMIT("vaddps          %%zmm3, %%zmm4, %%zmm4")                /* zmm4 = s + o_im */
+                __ASM_EMIT("vaddps          %%zmm1, %%zmm2, %%zmm5")                /* zmm5 = o_re + d */
+                __ASM_EMIT("vsubps          %%zmm1, %%zmm2, %%zmm2")                /* zmm2 = o_re - d */
+                __ASM_EMIT("vmulps          %[X_HALF], %%zmm0, %%zmm0")             /* zmm0 = za_re = (s - o_im)/2 */
+                __ASM_EMIT("vmulps          %[X_HALF], %%zmm4, %%zmm4")             /* zmm4 = zb_re = (s + o_im)/2 */
+                __ASM_EMIT("vmulps          %[X_HALF], %%zmm5, %%zmm5")             /* zmm5 = za_im = (o_re + d)/2 */
+                __ASM_EMIT("vmulps          %[X_HALF], %%zmm2, %%zmm2")             /* zmm2 = zb_im = (o_re - d)/2 */
+                /* Pack and store data */
+                __ASM_EMIT("vmovaps         %%zmm0, %%zmm1")
+                __ASM_EMIT("vmovaps         %%zmm4, %%zmm3")
+                __ASM_EMIT("vpermt2ps       %%zmm5, %%zmm10, %%zmm1")               /* zmm1 = a0 .. a7 */
+                __ASM_EMIT("vpermt2ps       %%zmm5, %%zmm11, %%zmm0")               /* zmm0 = a8 .. a15 */
+                __ASM_EMIT("vpermt2ps       %%zmm2, %%zmm14, %%zmm3")               /* zmm3 = b15 .. b8 */
+                __ASM_EMIT("vpermt2ps       %%zmm2, %%zmm15, %%zmm4")               /* zmm4 = b7 .. b0 */
+                __ASM_EMIT("vmovups         %%zmm1, 0x00(%[a], %[delta])")
+                __ASM_EMIT("vmovups         %%zmm0, 0x40(%[a], %[delta])")
+                __ASM_EMIT("vmovups         %%zmm3, 0x00(%[b], %[delta])")
+                __ASM_EMIT("vmovups         %%zmm4, 0x40(%[b], %[delta])")
+                __ASM_EMIT("add             $0x80, %[a]")
+                __ASM_EMIT("sub             $0x80, %[b]")
+                __ASM_EMIT("dec             %[blocks]")
+                __ASM_EMIT("jz              2f")
+                RFFT_SPLIT_ROTATE
+                __ASM_EMIT("jmp             1b")
+                __ASM_EMIT("2:")
+
+                : [a] "+r" (a), [b] "+r" (b), [blocks] "+r" (blocks)
+                : [w] "r" (w), [delta] "r" (delta),
+                  [IDX] "r" (FFT_IDX), [RIDX] "r" (RFFT_IDX),
+                  [X_HALF] "m" (rfft_split_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                  "%xmm12", "%xmm13", "%xmm14", "%xmm15"
+            );
+        }
+    )
+
+        #undef RFFT_SPLIT_PROLOGUE
+        #undef RFFT_SPLIT_ROTATE
+        #undef RFFT_SPLIT_LOAD
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FFT_R_SPLIT_H_ */
@@ -0,0 +1,476 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FFT_SCRAMBLE_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FFT_SCRAMBLE_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+namespace lsp
+{
+    namespace avx512
+    {
+        /* Performs first four stages of FFT for 16 complex numbers stored in zmm0 (real)
+         * and zmm1 (imaginary) registers in bit-reversed order. The result is also stored in zmm0
+         * and zmm1. The FS parameter should point to the FFT_S_DIRECT or FFT_S_REVERSE table.
+         */
+        #define FFT_CORE16(FS) \
+            /* Stage 0: butterflies of adjacent lanes */ \
+            __ASM_EMIT("vpermilps       $0xb1, %%zmm0, %%zmm4")                         /* zmm4 = swap(re) */ \
+            __ASM_EMIT("vpermilps       $0xb1, %%zmm1, %%zmm5")                         /* zmm5 = swap(im) */ \
+            __ASM_EMIT("vfmadd231ps     0x000(%[" FS "]), %%zmm0, %%zmm4")              /* zmm4 = re*sgn + swap(re) */ \
+            __ASM_EMIT("vfmadd231ps     0x000(%[" FS "]), %%zmm1, %%zmm5")              /* zmm5 = im*sgn + swap(im) */ \
+            /* Stage 1: butterflies of lanes at distance 2 */ \
+            __ASM_EMIT("vmulps          0x080(%[" FS "]), %%zmm4, %%zmm2")              /* zmm2 = re*w_re */ \
+            __ASM_EMIT("vmulps          0x0c0(%[" FS "]), %%zmm4, %%zmm3")              /* zmm3 = re*w_im */ \
+            __ASM_EMIT("vfnmadd231ps    0x0c0(%[" FS "]), %%zmm5, %%zmm2")              /* zmm2 = x_re = re*w_re - im*w_im */ \
+            __ASM_EMIT("vfmadd231ps     0x080(%[" FS "]), %%zmm5, %%zmm3")              /* zmm3 = x_im = re*w_im + im*w_re */ \
+            __ASM_EMIT("vpermilps       $0x4e, %%zmm2, %%zmm0")                         /* zmm0 = swap(x_re) */ \
+            __ASM_EMIT("vpermilps       $0x4e, %%zmm3, %%zmm1")                         /* zmm1 = swap(x_im) */ \
+            __ASM_EMIT("vfmadd231ps     0x040(%[" FS "]), %%zmm2, %%zmm0")              /* zmm0 = x_re*sgn + swap(x_re) */ \
+            __ASM_EMIT("vfmadd231ps     0x040(%[" FS "]), %%zmm3, %%zmm1")              /* zmm1 = x_im*sgn + swap(x_im) */ \
+            /* Stage 2: butterflies of lanes at distance 4 */ \
+            __ASM_EMIT("vmulps          0x140(%[" FS "]), %%zmm0, %%zmm2") \
+            __ASM_EMIT("vmulps          0x180(%[" FS "]), %%zmm0, %%zmm3") \
+            __ASM_EMIT("vfnmadd231ps    0x180(%[" FS "]), %%zmm1, %%zmm2") \
+            __ASM_EMIT("vfmadd231ps     0x140(%[" FS "]), %%zmm1, %%zmm3") \
+            __ASM_EMIT("vshuff32x4      $0xb1, %%zmm2, %%zmm2, %%zmm4") \
+            __ASM_EMIT("vshuff32x4      $0xb1, %%zmm3, %%zmm3, %%zmm5") \
+            __ASM_EMIT("vfmadd231ps     0x100(%[" FS "]), %%zmm2, %%zmm4") \
+            __ASM_EMIT("vfmadd231ps     0x100(%[" FS "]), %%zmm3, %%zmm5") \
+            /* Stage 3: butterflies of lanes at distance 8 */ \
+            __ASM_EMIT("vmulps          0x200(%[" FS "]), %%zmm4, %%zmm2") \
+            __ASM_EMIT("vmulps          0x240(%[" FS "]), %%zmm4, %%zmm3") \
+            __ASM_EMIT("vfnmadd231ps    0x240(%[" FS "]), %%zmm5, %%zmm2") \
+            __ASM_EMIT("vfmadd231ps     0x200(%[" FS "]), %%zmm5, %%zmm3") \
+            __ASM_EMIT("vshuff32x4      $0x4e, %%zmm2, %%zmm2, %%zmm0") \
+            __ASM_EMIT("vshuff32x4      $0x4e, %%zmm3, %%zmm3, %%zmm1") \
+            __ASM_EMIT("vfmadd231ps     0x1c0(%[" FS "]), %%zmm2, %%zmm0") \
+            __ASM_EMIT("vfmadd231ps     0x1c0(%[" FS "]), %%zmm3, %%zmm1")
+
+        /* Transposes 4x4 matrices stored in each 128-bit lane of zmm0-zmm3 registers
+         * and stores the columns of 16x16 matrix into the temporary buffer. Columns are
+         * stored in bit-reversed order, OFF specifies the offset of the row group.
+         */
+        #define FFT_TILE_TRANSPOSE(OFF) \
+            __ASM_EMIT("vunpcklps       %%zmm1, %%zmm0, %%zmm4")                        /* zmm4 = a0 b0 a1 b1 */ \
+            __ASM_EMIT("vunpckhps       %%zmm1, %%zmm0, %%zmm5")                        /* zmm5 = a2 b2 a3 b3 */ \
+            __ASM_EMIT("vunpcklps       %%zmm3, %%zmm2, %%zmm6")                        /* zmm6 = c0 d0 c1 d1 */ \
+            __ASM_EMIT("vunpckhps       %%zmm3, %%zmm2, %%zmm7")                        /* zmm7 = c2 d2 c3 d3 */ \
+            __ASM_EMIT("vunpcklpd       %%zmm6, %%zmm4, %%zmm0")                        /* zmm0 = a0 b0 c0 d0 */ \
+            __ASM_EMIT("vunpckhpd       %%zmm6, %%zmm4, %%zmm1")                        /* zmm1 = a1 b1 c1 d1 */ \
+            __ASM_EMIT("vunpcklpd       %%zmm7, %%zmm5, %%zmm2")                        /* zmm2 = a2 b2 c2 d2 */ \
+            __ASM_EMIT("vunpckhpd       %%zmm7, %%zmm5, %%zmm3")                        /* zmm3 = a3 b3 c3 d3 */ \
+            __ASM_EMIT("vmovups         %%xmm0, 0x000 + " OFF "(%[tmp])")               /* column 0 */ \
+            __ASM_EMIT("vextractf32x4   $1, %%zmm0, 0x080 + " OFF "(%[tmp])")           /* column 4 */ \
+            __ASM_EMIT("vextractf32x4   $2, %%zmm0, 0x040 + " OFF "(%[tmp])")           /* column 8 */ \
+            __ASM_EMIT("vextractf32x4   $3, %%zmm0, 0x0c0 + " OFF "(%[tmp])")           /* column 12 */ \
+            __ASM_EMIT("vmovups         %%xmm1, 0x200 + " OFF "(%[tmp])")               /* column 1 */ \
+            __ASM_EMIT("vextractf32x4   $1, %%zmm1, 0x280 + " OFF "(%[tmp])")           /* column 5 */ \
+            __ASM_EMIT("vextractf32x4   $2, %%zmm1, 0x240 + " OFF "(%[tmp])")           /* column 9 */ \
+            __ASM_EMIT("vextractf32x4   $3, %%zmm1, 0x2c0 + " OFF "(%[tmp])")           /* column 13 */ \
+            __ASM_EMIT("vmovups         %%xmm2, 0x100 + " OFF "(%[tmp])")               /* column 2 */ \
+            __ASM_EMIT("vextractf32x4   $1, %%zmm2, 0x180 + " OFF "(%[tmp])")           /* column 6 */ \
+            __ASM_EMIT("vextractf32x4   $2, %%zmm2, 0x140 + " OFF "(%[tmp])")           /* column 10 */ \
+            __ASM_EMIT("vextractf32x4   $3, %%zmm2, 0x1c0 + " OFF "(%[tmp])")           /* column 14 */ \
+            __ASM_EMIT("vmovups         %%xmm3, 0x300 + " OFF "(%[tmp])")               /* column 3 */ \
+            __ASM_EMIT("vextractf32x4   $1, %%zmm3, 0x380 + " OFF "(%[tmp])")           /* column 7 */ \
+            __ASM_EMIT("vextractf32x4   $2, %%zmm3, 0x340 + " OFF "(%[tmp])")           /* column 11 */ \
+            __ASM_EMIT("vextractf32x4   $3, %%zmm3, 0x3c0 + " OFF "(%[tmp])")           /* column 15 */
+
+        /* Loads four rows with indices reverse(j), j = 4*g .. 4*g+3 starting at base address */
+        #define FFT_TILE_LOAD_ROWS \
+            __ASM_EMIT("vmovups         (%[base]), %%zmm0") \
+            __ASM_EMIT("vmovups         (%[base], %[stride], 8), %%zmm1") \
+            __ASM_EMIT("vmovups         (%[base], %[stride], 4), %%zmm2") \
+            __ASM_EMIT("lea             (%[base], %[stride], 8), %[t]") \
+            __ASM_EMIT("vmovups         (%[t], %[stride], 4), %%zmm3")
+
+        #define FFT_PTILE_LOAD_ROW(ADDR, DST) \
+            __ASM_EMIT("vmovups         0x00" ADDR ", %%zmm4") \
+            __ASM_EMIT("vmovaps         (%[idx]), %%" DST) \
+            __ASM_EMIT("vpermi2ps       0x40" ADDR ", %%zmm4, %%" DST)
+
+        #define FFT_PTILE_LOAD_ROWS \
+            FFT_PTILE_LOAD_ROW("(%[base])", "zmm0") \
+            FFT_PTILE_LOAD_ROW("(%[base], %[stride], 8)", "zmm1") \
+            FFT_PTILE_LOAD_ROW("(%[base], %[stride], 4)", "zmm2") \
+            __ASM_EMIT("lea             (%[base], %[stride], 8), %[t]") \
+            FFT_PTILE_LOAD_ROW("(%[t], %[stride], 4)", "zmm3")
+
+        #define FFT_TILE_LOAD(LOAD_ROWS) \
+            /* Rows 0..3 */ \
+            LOAD_ROWS \
+            FFT_TILE_TRANSPOSE("0x00") \
+            /* Rows 4..7 */ \
+            __ASM_EMIT("lea             (%[base], %[stride], 2), %[base]") \
+            LOAD_ROWS \
+            FFT_TILE_TRANSPOSE("0x10") \
+            /* Rows 8..11 */ \
+            __ASM_EMIT("sub             %[stride], %[base]") \
+            LOAD_ROWS \
+            FFT_TILE_TRANSPOSE("0x20") \
+            /* Rows 12..15 */ \
+            __ASM_EMIT("lea             (%[base], %[stride], 2), %[base]") \
+            LOAD_ROWS \
+            FFT_TILE_TRANSPOSE("0x30")
+
+        /**
+         * Load 16x16 tile of samples in bit-reversed order and transpose it into the temporary buffer
+         * @param tmp temporary buffer to store 256 transposed samples
+         * @param src pointer to the first sample of the tile
+         * @param stride distance between rows of the tile in bytes
+         */
+        static inline void scramble_tile_load(float *tmp, const float *src, size_t stride)
+        {
+            const float *t;
+
+            ARCH_X86_ASM
+            (
+                FFT_TILE_LOAD(FFT_TILE_LOAD_ROWS)
+                : [base] "+r" (src), [t] "=&r" (t)
+                : [tmp] "r" (tmp), [stride] "r" (stride)
+                : "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        /**
+         * Load 16x16 tile of complex numbers in bit-reversed order, extract real or
+         * imaginary parts and transpose them into the temporary buffer
+         * @param tmp temporary buffer to store 256 transposed values
+         * @param src pointer to the first complex number of the tile
+         * @param stride distance between rows of the tile in bytes
+         * @param idx the permutation index to extract real or imaginary parts
+         */
+        static inline void packed_scramble_tile_load(float *tmp, const float *src, size_t stride, const uint32_t *idx)
+        {
+            const float *t;
+
+            ARCH_X86_ASM
+            (
+                FFT_TILE_LOAD(FFT_PTILE_LOAD_ROWS)
+                : [base] "+r" (src), [t] "=&r" (t)
+                : [tmp] "r" (tmp), [stride] "r" (stride),
+                  [idx] "r" (idx)
+                : "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        /**
+         * Perform 16-point FFTs over the transposed tile and store the result
+         * @param dst_re destination for the real part of the first 16-point block
+         * @param dst_im destination for the imaginary part of the first 16-point block
+         * @param tmp temporary buffer with real (256 samples) and imaginary (256 samples) parts
+         * @param stride distance between the 16-point blocks in bytes
+         * @param fs pointer to the FFT_S_DIRECT or FFT_S_REVERSE table
+         */
+        static inline void scramble_tile_store(float *dst_re, float *dst_im, const float *tmp, size_t stride, const float *fs)
+        {
+            size_t count = 16;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         0x000(%[tmp]), %%zmm0")
+                __ASM_EMIT("vmovups         0x400(%[tmp]), %%zmm1")
+                FFT_CORE16("fs")
+                __ASM_EMIT("vmovups         %%zmm0, (%[dst_re])")
+                __ASM_EMIT("vmovups         %%zmm1, (%[dst_im])")
+                __ASM_EMIT("add             $0x40, %[tmp]")
+                __ASM_EMIT("add             %[stride], %[dst_re]")
+                __ASM_EMIT("add             %[stride], %[dst_im]")
+                __ASM_EMIT32("decl          %[count]")
+                __ASM_EMIT64("decq          %[count]")
+                __ASM_EMIT("jnz             1b")
+                : [dst_re] "+r" (dst_re), [dst_im] "+r" (dst_im),
+                  [tmp] "+r" (tmp), [count] X86_PGREG (count)
+                : [stride] "r" (stride), [fs] "r" (fs)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+        }
+
+        /**
+         * Perform 16-point FFTs over the sequence of contiguous 16-point blocks
+         * @param dst_re real part of data
+         * @param dst_im imaginary part of data
+         * @param count number of blocks
+         * @param fs pointer to the FFT_S_DIRECT or FFT_S_REVERSE table
+         */
+        static inline void scramble_blocks(float *dst_re, float *dst_im, size_t count, const float *fs)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         (%[dst_re]), %%zmm0")
+                __ASM_EMIT("vmovups         (%[dst_im]), %%zmm1")
+                FFT_CORE16("fs")
+                __ASM_EMIT("vmovups         %%zmm0, (%[dst_re])")
+                __ASM_EMIT("vmovups         %%zmm1, (%[dst_im])")
+                __ASM_EMIT("add             $0x40, %[dst_re]")
+                __ASM_EMIT("add             $0x40, %[dst_im]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jnz             1b")
+                : [dst_re] "+r" (dst_re), [dst_im] "+r" (dst_im),
+                  [count] "+r" (count)
+                : [fs] "r" (fs)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+        }
+
+        /**
+         * Convert contiguous packed complex numbers into blocks of 16 real and 16 imaginary
+         * parts and perform 16-point FFTs over them
+         * @param dst packed complex data
+         * @param count number of blocks
+         * @param fs pointer to the FFT_S_DIRECT or FFT_S_REVERSE table
+         */
+        static inline void packed_scramble_blocks(float *dst, size_t count, const float *fs)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         0x00(%[dst]), %%zmm4")                      /* zmm4 = r0 i0 r1 i1 ... r7 i7 */
+                __ASM_EMIT("vmovdqa32       0x40 + %[FFT_IDX], %%zmm0")
+                __ASM_EMIT("vmovdqa32       0x80 + %[FFT_IDX], %%zmm1")
+                __ASM_EMIT("vpermi2ps       0x40(%[dst]), %%zmm4, %%zmm0")              /* zmm0 = r0 r1 ... r15 */
+                __ASM_EMIT("vpermi2ps       0x40(%[dst]), %%zmm4, %%zmm1")              /* zmm1 = i0 i1 ... i15 */
+                FFT_CORE16("fs")
+                __ASM_EMIT("vmovups         %%zmm0, 0x00(%[dst])")
+                __ASM_EMIT("vmovups         %%zmm1, 0x40(%[dst])")
+                __ASM_EMIT("add             $0x80, %[dst]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jnz             1b")
+                : [dst] "+r" (dst), [count] "+r" (count)
+                : [fs] "r" (fs),
+                  [FFT_IDX] "o" (FFT_IDX)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+        }
+
+        #undef FFT_CORE16
+        #undef FFT_TILE_TRANSPOSE
+        #undef FFT_TILE_LOAD_ROWS
+        #undef FFT_PTILE_LOAD_ROW
+        #undef FFT_PTILE_LOAD_ROWS
+        #undef FFT_TILE_LOAD
+
+        /*
+         * The bit-reversal permutation is performed by 16x16 tiles: the tile is formed by rows
+         * of 16 consecutive samples located at bit-reversed positions, after transposition
+         * the columns of the tile become contiguous 16-point blocks ready for the in-register FFT.
+         * Tile m reads samples that are stored by the tile reverse_bits(m) and vice versa, so
+         * the in-place permutation is performed by swapping pairs of tiles.
+         */
+        static inline void scramble_copy(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank, const float *fs)
+        {
+            size_t count    = size_t(1) << rank;
+
+            // Small FFT: scramble the order of samples and perform 16-point FFTs
+            if (rank < 8)
+            {
+                for (size_t i=0; i<count; ++i)
+                {
+                    size_t j        = reverse_bits(uint32_t(i), rank);
+                    dst_re[i]       = src_re[j];
+                    dst_im[i]       = src_im[j];
+                }
+
+                scramble_blocks(dst_re, dst_im, count >> 4, fs);
+                return;
+            }
+
+            // Large FFT: process by tiles
+            float tmp[512] __lsp_aligned64;
+            size_t regs     = rank - 4;
+            size_t tiles    = size_t(1) << (regs - 4);
+            size_t stride   = sizeof(float) << regs;
+
+            for (size_t i=0; i<tiles; ++i)
+            {
+                size_t r        = reverse_bits(uint32_t(i), regs);
+                scramble_tile_load(&tmp[0], &src_re[r], stride);
+                scramble_tile_load(&tmp[256], &src_im[r], stride);
+                scramble_tile_store(&dst_re[i << 4], &dst_im[i << 4], tmp, stride, fs);
+            }
+        }
+
+        static inline void scramble_self(float *dst_re, float *dst_im, size_t rank, const float *fs)
+        {
+            size_t count    = size_t(1) << rank;
+
+            // Small FFT: scramble the order of samples and perform 16-point FFTs
+            if (rank < 8)
+            {
+                for (size_t i=1; i<(count-1); ++i)
+                {
+                    size_t j = reverse_bits(uint32_t(i), rank);
+                    if (i >= j)
+                        continue;
+
+                    float re        = dst_re[i];
+                    float im        = dst_im[i];
+                    dst_re[i]       = dst_re[j];
+                    dst_im[i]       = dst_im[j];
+                    dst_re[j]       = re;
+                    dst_im[j]       = im;
+                }
+
+                scramble_blocks(dst_re, dst_im, count >> 4, fs);
+                return;
+            }
+
+            // Large FFT: process by pairs of tiles
+            float tmp1[512] __lsp_aligned64;
+            float tmp2[512] __lsp_aligned64;
+            size_t regs     = rank - 4;
+            size_t tiles    = size_t(1) << (regs - 4);
+            size_t stride   = sizeof(float) << regs;
+
+            for (size_t i=0; i<tiles; ++i)
+            {
+                size_t j        = (regs > 4) ? reverse_bits(uint32_t(i), regs - 4) : 0;
+                if (i > j)
+                    continue;
+
+                size_t r1       = reverse_bits(uint32_t(i), regs);
+                scramble_tile_load(&tmp1[0], &dst_re[r1], stride);
+                scramble_tile_load(&tmp1[256], &dst_im[r1], stride);
+                if (i < j)
+                {
+                    size_t r2       = reverse_bits(uint32_t(j), regs);
+                    scramble_tile_load(&tmp2[0], &dst_re[r2], stride);
+                    scramble_tile_load(&tmp2[256], &dst_im[r2], stride);
+                    scramble_tile_store(&dst_re[j << 4], &dst_im[j << 4], tmp2, stride, fs);
+                }
+                scramble_tile_store(&dst_re[i << 4], &dst_im[i << 4], tmp1, stride, fs);
+            }
+        }
+
+        static inline void packed_scramble_copy(float *dst, const float *src, size_t rank, const float *fs)
+        {
+            size_t count    = size_t(1) << rank;
+
+            // Small FFT: scramble the order of complex numbers and perform 16-point FFTs
+            if (rank < 8)
+            {
+                // reverse(16*h + l) = (reverse(l) << (rank - 4)) | reverse(h)
+                const uint64_t *s   = reinterpret_cast<const uint64_t *>(src);
+                uint64_t *d         = reinterpret_cast<uint64_t *>(dst);
+                size_t shift        = rank - 4;
+                for (size_t h=0; h < (count >> 4); ++h, d += 16)
+                {
+                    const uint64_t *p   = &s[(shift > 0) ? reverse_bits(uint32_t(h), shift) : 0];
+                    for (size_t l=0; l<16; ++l)
+                        d[l]            = p[FFT_IDX[l] << shift];
+                }
+
+                packed_scramble_blocks(dst, count >> 4, fs);
+                return;
+            }
+
+            // Large FFT: process by tiles
+            float tmp[512] __lsp_aligned64;
+            size_t regs     = rank - 4;
+            size_t tiles    = size_t(1) << (regs - 4);
+            size_t stride   = (2 * sizeof(float)) << regs;
+
+            for (size_t i=0; i<tiles; ++i)
+            {
+                size_t r        = reverse_bits(uint32_t(i), regs);
+                packed_scramble_tile_load(&tmp[0], &src[r*2], stride, &FFT_IDX[16]);
+                packed_scramble_tile_load(&tmp[256], &src[r*2], stride, &FFT_IDX[32]);
+                scramble_tile_store(&dst[i << 5], &dst[(i << 5) + 16], tmp, stride, fs);
+            }
+        }
+
+        static inline void packed_scramble_self(float *dst, size_t rank, const float *fs)
+        {
+            size_t count    = size_t(1) << rank;
+
+            // Small FFT: scramble the order of complex numbers and perform 16-point FFTs
+            if (rank < 8)
+            {
+                // reverse(16*h + l) = (reverse(l) << (rank - 4)) | reverse(h)
+                uint64_t *d     = reinterpret_cast<uint64_t *>(dst);
+                size_t shift    = rank - 4;
+                for (size_t h=0; h < (count >> 4); ++h)
+                {
+                    size_t rh       = (shift > 0) ? reverse_bits(uint32_t(h), shift) : 0;
+                    for (size_t l=0; l<16; ++l)
+                    {
+                        size_t i        = (h << 4) | l;
+                        size_t j        = (FFT_IDX[l] << shift) | rh;
+                        if (i >= j)
+                            continue;
+
+                        uint64_t c      = d[i];
+                        d[i]            = d[j];
+                        d[j]            = c;
+                    }
+                }
+
+                packed_scramble_blocks(dst, count >> 4, fs);
+                return;
+            }
+
+            // Large FFT: process by pairs of tiles
+            float tmp1[512] __lsp_aligned64;
+            float tmp2[512] __lsp_aligned64;
+            size_t regs     = rank - 4;
+            size_t tiles    = size_t(1) << (regs - 4);
+            size_t stride   = (2 * sizeof(float)) << regs;
+
+            for (size_t i=0; i<tiles; ++i)
+            {
+                size_t j        = (regs > 4) ? reverse_bits(uint32_t(i), regs - 4) : 0;
+                if (i > j)
+                    continue;
+
+                size_t r1       = reverse_bits(uint32_t(i), regs);
+                packed_scramble_tile_load(&tmp1[0], &dst[r1*2], stride, &FFT_IDX[16]);
+                packed_scramble_tile_load(&tmp1[256], &dst[r1*2], stride, &FFT_IDX[32]);
+                if (i < j)
+                {
+                    size_t r2       = reverse_bits(uint32_t(j), regs);
+                    packed_scramble_tile_load(&tmp2[0], &dst[r2*2], stride, &FFT_IDX[16]);
+                    packed_scramble_tile_load(&tmp2[256], &dst[r2*2], stride, &FFT_IDX[32]);
+                    scramble_tile_store(&dst[j << 5], &dst[(j << 5) + 16], tmp2, stride, fs);
+                }
+                scramble_tile_store(&dst[i << 5], &dst[(i << 5) + 16], tmp1, stride, fs);
+            }
+        }
+
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FFT_SCRAMBLE_H_ */
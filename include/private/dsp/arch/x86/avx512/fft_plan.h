@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FFT_PLAN_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FFT_PLAN_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+#include <private/dsp/arch/x86/avx512/fft.h>
+#include <private/dsp/arch/x86/avx512/pfft.h>
+
+namespace lsp
+{
+    namespace avx512
+    {
+        /*
+         * Unlike the butterflies that rotate twiddle factors, these butterflies load
+         * twiddle factors from the table of the FFT plan: 16 cosines followed by 16 sines
+         * for each 16 pairs of complex numbers.
+         */
+        #define FFT_PLAN_BUTTERFLY_BODY16(add_b, add_a) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("mov             %[shift], %[np]") \
+                /* Process pairs */ \
+                __ASM_EMIT("2:") \
+                    __ASM_EMIT("vmovaps         0x00(%[tw]), %%zmm6")                       /* zmm6 = x_re */ \
+                    __ASM_EMIT("vmovaps         0x40(%[tw]), %%zmm7")                       /* zmm7 = x_im */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst_re]), %%zmm0")                   /* zmm0 = a_re */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst_re], %[shift]), %%zmm2")         /* zmm2 = b_re */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst_im]), %%zmm1")                   /* zmm1 = a_im */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst_im], %[shift]), %%zmm3")         /* zmm3 = b_im */ \
+                    /* Calculate complex multiplication */ \
+                    __ASM_EMIT("vmulps          %%zmm7, %%zmm2, %%zmm4")                    /* zmm4 = x_im * b_re */ \
+                    __ASM_EMIT("vmulps          %%zmm7, %%zmm3, %%zmm5")                    /* zmm5 = x_im * b_im */ \
+                    __ASM_EMIT(add_b "     %%zmm6, %%zmm2, %%zmm5")                         /* zmm5 = c_re = x_re * b_re +- x_im * b_im */ \
+                    __ASM_EMIT(add_a "     %%zmm6, %%zmm3, %%zmm4")                         /* zmm4 = c_im = x_re * b_im -+ x_im * b_re */ \
+                    /* Perform butterfly */ \
+                    __ASM_EMIT("vsubps          %%zmm5, %%zmm0, %%zmm2")                    /* zmm2 = a_re - c_re */ \
+                    __ASM_EMIT("vsubps          %%zmm4, %%zmm1, %%zmm3")                    /* zmm3 = a_im - c_im */ \
+                    __ASM_EMIT("vaddps          %%zmm5, %%zmm0, %%zmm0")                    /* zmm0 = a_re + c_re */ \
+                    __ASM_EMIT("vaddps          %%zmm4, %%zmm1, %%zmm1")                    /* zmm1 = a_im + c_im */ \
+                    /* Store values */ \
+                    __ASM_EMIT("vmovups         %%zmm0, 0x00(%[dst_re])") \
+                    __ASM_EMIT("vmovups         %%zmm2, 0x00(%[dst_re], %[shift])") \
+                    __ASM_EMIT("vmovups         %%zmm1, 0x00(%[dst_im])") \
+                    __ASM_EMIT("vmovups         %%zmm3, 0x00(%[dst_im], %[shift])") \
+                    __ASM_EMIT("add             $0x40, %[dst_re]") \
+                    __ASM_EMIT("add             $0x40, %[dst_im]") \
+                    __ASM_EMIT("add             $0x80, %[tw]") \
+                    __ASM_EMIT("sub             $0x40, %[np]") \
+                __ASM_EMIT("jnz             2b") \
+                /* Move to the next block and rewind twiddle factors */ \
+                __ASM_EMIT("add             %[shift], %[dst_re]") \
+                __ASM_EMIT("add             %[shift], %[dst_im]") \
+                __ASM_EMIT("sub             %[shift], %[tw]") \
+                __ASM_EMIT("sub             %[shift], %[tw]") \
+                __ASM_EMIT32("decl          %[blocks]") \
+                __ASM_EMIT64("decq          %[blocks]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [dst_re] "+r" (dst_re), [dst_im] "+r" (dst_im), [tw] "+r" (tw), \
+                  [np] "=&r" (np), [blocks] X86_PGREG (blocks) \
+                : [shift] "r" (shift) \
+                : "cc", "memory",  \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"  \
+            );
+
+        #define FFT_PLAN_PBUTTERFLY_BODY16(add_b, add_a) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("mov             %[shift], %[np]") \
+                /* Process pairs */ \
+                __ASM_EMIT("2:") \
+                    __ASM_EMIT("vmovaps         0x00(%[tw]), %%zmm6")                       /* zmm6 = x_re */ \
+                    __ASM_EMIT("vmovaps         0x40(%[tw]), %%zmm7")                       /* zmm7 = x_im */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst]), %%zmm0")                      /* zmm0 = a_re */ \
+                    __ASM_EMIT("vmovups         0x00(%[dst], %[shift]), %%zmm2")            /* zmm2 = b_re */ \
+                    __ASM_EMIT("vmovups         0x40(%[dst]), %%zmm1")                      /* zmm1 = a_im */ \
+                    __ASM_EMIT("vmovups         0x40(%[dst], %[shift]), %%zmm3")            /* zmm3 = b_im */ \
+                    /* Calculate complex multiplication */ \
+                    __ASM_EMIT("vmulps          %%zmm7, %%zmm2, %%zmm4")                    /* zmm4 = x_im * b_re */ \
+                    __ASM_EMIT("vmulps          %%zmm7, %%zmm3, %%zmm5")                    /* zmm5 = x_im * b_im */ \
+                    __ASM_EMIT(add_b "     %%zmm6, %%zmm2, %%zmm5")                         /* zmm5 = c_re = x_re * b_re +- x_im * b_im */ \
+                    __ASM_EMIT(add_a "     %%zmm6, %%zmm3, %%zmm4")                         /* zmm4 = c_im = x_re * b_im -+ x_im * b_re */ \
+                    /* Perform butterfly */ \
+                    __ASM_EMIT("vsubps          %%zmm5, %%zmm0, %%zmm2")                    /* zmm2 = a_re - c_re */ \
+                    __ASM_EMIT("vsubps          %%zmm4, %%zmm1, %%zmm3")                    /* zmm3 = a_im - c_im */ \
+                    __ASM_EMIT("vaddps          %%zmm5, %%zmm0, %%zmm0")                    /* zmm0 = a_re + c_re */ \
+                    __ASM_EMIT("vaddps          %%zmm4, %%zmm1, %%zmm1")                    /* zmm1 = a_im + c_im */ \
+                    /* Store values */ \
+                    __ASM_EMIT("vmovups         %%zmm0, 0x00(%[dst])") \
+                    __ASM_EMIT("vmovups         %%zmm2, 0x00(%[dst], %[shift])") \
+                    __ASM_EMIT("vmovups         %%zmm1, 0x40(%[dst])") \
+                    __ASM_EMIT("vmovups         %%zmm3, 0x40(%[dst], %[shift])") \
+                    __ASM_EMIT("add             $0x80, %[dst]") \
+                    __ASM_EMIT("add             $0x80, %[tw]") \
+                    __ASM_EMIT("sub             $0x80, %[np]") \
+                __ASM_EMIT("jnz             2b") \
+                /* Move to the next block and rewind twiddle factors */ \
+                __ASM_EMIT("add             %[shift], %[dst]") \
+                __ASM_EMIT("sub             %[shift], %[tw]") \
+                __ASM_EMIT32("decl          %[blocks]") \
+                __ASM_EMIT64("decq          %[blocks]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [dst] "+r" (dst), [tw] "+r" (tw), \
+                  [np] "=&r" (np), [blocks] X86_PGREG (blocks) \
+                : [shift] "r" (shift) \
+                : "cc", "memory",  \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"  \
+            );
+
+        static inline void fft_plan_butterfly_direct16p(float *dst_re, float *dst_im, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(4) << rank;
+
+            FFT_PLAN_BUTTERFLY_BODY16("vfmadd231ps", "vfmsub231ps");
+        }
+
+        static inline void fft_plan_butterfly_reverse16p(float *dst_re, float *dst_im, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(4) << rank;
+
+            FFT_PLAN_BUTTERFLY_BODY16("vfmsub231ps", "vfmadd231ps");
+        }
+
+        static inline void fft_plan_packed_butterfly_direct16p(float *dst, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(8) << rank;
+
+            FFT_PLAN_PBUTTERFLY_BODY16("vfmadd231ps", "vfmsub231ps");
+        }
+
+        static inline void fft_plan_packed_butterfly_reverse16p(float *dst, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(8) << rank;
+
+            FFT_PLAN_PBUTTERFLY_BODY16("vfmsub231ps", "vfmadd231ps");
+        }
+
+        #undef FFT_PLAN_BUTTERFLY_BODY16
+        #undef FFT_PLAN_PBUTTERFLY_BODY16
+
+        void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank < 4)
+            {
+                small_fft(dst_re, dst_im, src_re, src_im, rank, -1.0f);
+                return;
+            }
+
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                dsp::move(dst_re, src_re, size_t(1) << rank);
+                dsp::move(dst_im, src_im, size_t(1) << rank);
+                scramble_self(dst_re, dst_im, rank, FFT_S_DIRECT);
+            }
+            else
+                scramble_copy(dst_re, dst_im, src_re, src_im, rank, FFT_S_DIRECT);
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_butterfly_direct16p(dst_re, dst_im, tw, i, size_t(1) << (rank - i - 1));
+        }
+
+        void fft_plan_reverse(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank < 4)
+            {
+                small_fft(dst_re, dst_im, src_re, src_im, rank, 1.0f);
+                return;
+            }
+
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                dsp::move(dst_re, src_re, size_t(1) << rank);
+                dsp::move(dst_im, src_im, size_t(1) << rank);
+                scramble_self(dst_re, dst_im, rank, FFT_S_REVERSE);
+            }
+            else
+                scramble_copy(dst_re, dst_im, src_re, src_im, rank, FFT_S_REVERSE);
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_butterfly_reverse16p(dst_re, dst_im, tw, i, size_t(1) << (rank - i - 1));
+
+            normalize_fft2(dst_re, dst_im, rank);
+        }
+
+        void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank < 4)
+            {
+                packed_small_fft(dst, src, rank, -1.0f);
+                return;
+            }
+
+            if (dst == src)
+                packed_scramble_self(dst, rank, FFT_S_DIRECT);
+            else
+                packed_scramble_copy(dst, src, rank, FFT_S_DIRECT);
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_packed_butterfly_direct16p(dst, tw, i, size_t(1) << (rank - i - 1));
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void fft_plan_packed_reverse(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank < 4)
+            {
+                packed_small_fft(dst, src, rank, 1.0f);
+                return;
+            }
+
+            if (dst == src)
+                packed_scramble_self(dst, rank, FFT_S_REVERSE);
+            else
+                packed_scramble_copy(dst, src, rank, FFT_S_REVERSE);
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_packed_butterfly_reverse16p(dst, tw, i, size_t(1) << (rank - i - 1));
+
+            packed_fft_repack_normalize(dst, rank);
+        }
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FFT_PLAN_H_ */
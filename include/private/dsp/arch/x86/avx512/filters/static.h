@@ -0,0 +1,541 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_STATIC_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_STATIC_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+/*
+ * The filters are processed in the pipeline mode in the same way as in AVX implementation.
+ * AVX-512 allows to shift the pipeline by the single valignd instruction, to insert the new
+ * sample by the masked broadcast and to enable filters at the start and at the end of the
+ * pipeline by the mask register instead of blending.
+ */
+
+namespace lsp
+{
+    namespace avx512
+    {
+        void biquad_process_x4(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            IF_ARCH_X86(size_t mask);
+
+            ARCH_X86_ASM
+            (
+                // Check count
+                __ASM_EMIT("test                %[count], %[count]")
+                __ASM_EMIT("jz                  8f")
+
+                // Initialize mask
+                // xmm1={s,s2[4]}, xmm2=p1[4], xmm3=p2[4], xmm6=d0[4], xmm7=d1[4], k1=mask[4], k2=first lane
+                __ASM_EMIT("mov                 $1, %[mask]")
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = m
+                __ASM_EMIT("kmovw               %k[mask], %%k2")                                    // k2       = 1
+                __ASM_EMIT("vxorps              %%xmm1, %%xmm1, %%xmm1")                            // xmm1     = 0
+
+                // Load delay buffer
+                __ASM_EMIT("vmovups             0x00(%[f]), %%xmm6")                                // xmm6     = d0
+                __ASM_EMIT("vmovups             0x10(%[f]), %%xmm7")                                // xmm7     = d1
+
+                // Process first 3 steps
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vbroadcastss        (%[src]), %%xmm1 %{%%k2%}")                         // xmm1     = s
+                __ASM_EMIT("add                 $4, %[src]")                                        // src      ++
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x10(%[f]), %%xmm1, %%xmm2")   // xmm2     = b1*s
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[f]), %%xmm1, %%xmm3")   // xmm3     = b2*s
+                __ASM_EMIT("vfmadd132ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[f]), %%xmm6, %%xmm1")   // xmm1     = s' = b0*s + d0
+                __ASM_EMIT("vaddps              %%xmm7, %%xmm2, %%xmm2")                            // xmm2     = d1 + b1*s
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x30(%[f]), %%xmm1, %%xmm2")   // xmm2     = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[f]), %%xmm1, %%xmm3")   // xmm3     = d1' = b2*s + a2*s'
+                __ASM_EMIT("vmovaps             %%xmm2, %%xmm6 %{%%k1%}")                           // xmm6     = (d0' & MASK) | (d0 & ~MASK)
+                __ASM_EMIT("vmovaps             %%xmm3, %%xmm7 %{%%k1%}")                           // xmm7     = (d1' & MASK) | (d1 & ~MASK)
+                __ASM_EMIT("valignd             $3, %%xmm1, %%xmm1, %%xmm1")                        // xmm1     = s2[3] s2[0] ... s2[2]
+                __ASM_EMIT("dec                 %[count]")
+                __ASM_EMIT("jz                  4f")                                                // jump to completion
+                __ASM_EMIT("lea                 0x01(,%[mask], 2), %[mask]")                        // mask     = (mask << 1) | 1
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = mask
+                __ASM_EMIT("cmp                 $0x0f, %[mask]")
+                __ASM_EMIT("jne                 1b")
+
+                // 4x filter processing without mask
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vbroadcastss        (%[src]), %%xmm1 %{%%k2%}")                         // xmm1     = s
+                __ASM_EMIT("add                 $4, %[src]")                                        // src      ++
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x10(%[f]), %%xmm1, %%xmm2")   // xmm2     = b1*s
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[f]), %%xmm1, %%xmm3")   // xmm3     = b2*s
+                __ASM_EMIT("vfmadd132ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[f]), %%xmm6, %%xmm1")   // xmm1     = s' = b0*s + d0
+                __ASM_EMIT("vaddps              %%xmm7, %%xmm2, %%xmm6")                            // xmm6     = d1 + b1*s
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x30(%[f]), %%xmm1, %%xmm6")   // xmm6     = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[f]), %%xmm1, %%xmm3")   // xmm3     = d1' = b2*s + a2*s'
+                __ASM_EMIT("vmovaps             %%xmm3, %%xmm7")                                    // xmm7     = d1'
+                __ASM_EMIT("valignd             $3, %%xmm1, %%xmm1, %%xmm1")                        // xmm1     = s2[3] s2[0] ... s2[2]
+                __ASM_EMIT("vmovss              %%xmm1, (%[dst])")                                  // *dst     = s2[3]
+                __ASM_EMIT("add                 $4, %[dst]")                                        // dst      ++
+                __ASM_EMIT("dec                 %[count]")
+                __ASM_EMIT("jnz                 3b")
+
+                // Prepare last loop, shift mask
+                __ASM_EMIT("4:")
+                __ASM_EMIT("shl                 $1, %[mask]")                                       // mask     = mask << 1
+                __ASM_EMIT("and                 $0x0f, %[mask]")                                    // mask     = (mask << 1) & 0x0f
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = mask
+
+                // Process steps
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x10(%[f]), %%xmm1, %%xmm2")   // xmm2     = b1*s
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[f]), %%xmm1, %%xmm3")   // xmm3     = b2*s
+                __ASM_EMIT("vfmadd132ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[f]), %%xmm6, %%xmm1")   // xmm1     = s' = b0*s + d0
+                __ASM_EMIT("vaddps              %%xmm7, %%xmm2, %%xmm2")                            // xmm2     = d1 + b1*s
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x30(%[f]), %%xmm1, %%xmm2")   // xmm2     = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[f]), %%xmm1, %%xmm3")   // xmm3     = d1' = b2*s + a2*s'
+                __ASM_EMIT("vmovaps             %%xmm2, %%xmm6 %{%%k1%}")                           // xmm6     = (d0' & MASK) | (d0 & ~MASK)
+                __ASM_EMIT("vmovaps             %%xmm3, %%xmm7 %{%%k1%}")                           // xmm7     = (d1' & MASK) | (d1 & ~MASK)
+                __ASM_EMIT("valignd             $3, %%xmm1, %%xmm1, %%xmm1")                        // xmm1     = s2[3] s2[0] ... s2[2]
+                __ASM_EMIT("test                $0x08, %[mask]")
+                __ASM_EMIT("jz                  6f")
+                __ASM_EMIT("vmovss              %%xmm1, (%[dst])")                                  // *dst     = s2[3]
+                __ASM_EMIT("add                 $4, %[dst]")                                        // dst      ++
+                __ASM_EMIT("6:")
+
+                // Repeat loop
+                __ASM_EMIT("shl                 $1, %[mask]")                                       // mask     = mask << 1
+                __ASM_EMIT("and                 $0x0f, %[mask]")                                    // mask     = (mask << 1) & 0x0f
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = mask
+                __ASM_EMIT("jnz                 5b")                                                // check that mask is not zero
+
+                // Store delay buffer
+                __ASM_EMIT("vmovups             %%xmm6, 0x00(%[f])")                                // d0       = xmm6
+                __ASM_EMIT("vmovups             %%xmm7, 0x10(%[f])")                                // d1       = xmm7
+
+                // Exit label
+                __ASM_EMIT("8:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [mask] "=&r"(mask), [count] "+r" (count)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7",
+                  "%k1", "%k2"
+            );
+        }
+
+        void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            IF_ARCH_X86(size_t mask);
+
+            ARCH_X86_ASM
+            (
+                // Check count
+                __ASM_EMIT("test                %[count], %[count]")
+                __ASM_EMIT("jz                  8f")
+
+                // Initialize mask
+                // ymm1={s,s2[8]}, ymm2=p1[8], ymm3=p2[8], ymm6=d0[8], ymm7=d1[8], k1=mask[8], k2=first lane
+                __ASM_EMIT("mov                 $1, %[mask]")
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = m
+                __ASM_EMIT("kmovw               %k[mask], %%k2")                                    // k2       = 1
+                __ASM_EMIT("vxorps              %%ymm1, %%ymm1, %%ymm1")                            // ymm1     = 0
+
+                // Load delay buffer
+                __ASM_EMIT("vmovups             0x00(%[f]), %%ymm6")                                // ymm6     = d0
+                __ASM_EMIT("vmovups             0x20(%[f]), %%ymm7")                                // ymm7     = d1
+
+                // Process first 7 steps
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vbroadcastss        (%[src]), %%ymm1 %{%%k2%}")                         // ymm1     = s
+                __ASM_EMIT("add                 $4, %[src]")                                        // src      ++
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[f]), %%ymm1, %%ymm2")   // ymm2     = b1*s
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[f]), %%ymm1, %%ymm3")   // ymm3     = b2*s
+                __ASM_EMIT("vfmadd132ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[f]), %%ymm6, %%ymm1")   // ymm1     = s' = b0*s + d0
+                __ASM_EMIT("vaddps              %%ymm7, %%ymm2, %%ymm2")                            // ymm2     = d1 + b1*s
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x60(%[f]), %%ymm1, %%ymm2")   // ymm2     = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x80(%[f]), %%ymm1, %%ymm3")   // ymm3     = d1' = b2*s + a2*s'
+                __ASM_EMIT("vmovaps             %%ymm2, %%ymm6 %{%%k1%}")                           // ymm6     = (d0' & MASK) | (d0 & ~MASK)
+                __ASM_EMIT("vmovaps             %%ymm3, %%ymm7 %{%%k1%}")                           // ymm7     = (d1' & MASK) | (d1 & ~MASK)
+                __ASM_EMIT("valignd             $7, %%ymm1, %%ymm1, %%ymm1")                        // ymm1     = s2[7] s2[0] ... s2[6]
+                __ASM_EMIT("dec                 %[count]")
+                __ASM_EMIT("jz                  4f")                                                // jump to completion
+                __ASM_EMIT("lea                 0x01(,%[mask], 2), %[mask]")                        // mask     = (mask << 1) | 1
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = mask
+                __ASM_EMIT("cmp                 $0xff, %[mask]")
+                __ASM_EMIT("jne                 1b")
+
+                // 8x filter processing without mask
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vbroadcastss        (%[src]), %%ymm1 %{%%k2%}")                         // ymm1     = s
+                __ASM_EMIT("add                 $4, %[src]")                                        // src      ++
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[f]), %%ymm1, %%ymm2")   // ymm2     = b1*s
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[f]), %%ymm1, %%ymm3")   // ymm3     = b2*s
+                __ASM_EMIT("vfmadd132ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[f]), %%ymm6, %%ymm1")   // ymm1     = s' = b0*s + d0
+                __ASM_EMIT("vaddps              %%ymm7, %%ymm2, %%ymm6")                            // ymm6     = d1 + b1*s
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x60(%[f]), %%ymm1, %%ymm6")   // ymm6     = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x80(%[f]), %%ymm1, %%ymm3")   // ymm3     = d1' = b2*s + a2*s'
+                __ASM_EMIT("vmovaps             %%ymm3, %%ymm7")                                    // ymm7     = d1'
+                __ASM_EMIT("valignd             $7, %%ymm1, %%ymm1, %%ymm1")                        // ymm1     = s2[7] s2[0] ... s2[6]
+                __ASM_EMIT("vmovss              %%xmm1, (%[dst])")                                  // *dst     = s2[7]
+                __ASM_EMIT("add                 $4, %[dst]")                                        // dst      ++
+                __ASM_EMIT("dec                 %[count]")
+                __ASM_EMIT("jnz                 3b")
+
+                // Prepare last loop, shift mask
+                __ASM_EMIT("4:")
+                __ASM_EMIT("shl                 $1, %[mask]")                                       // mask     = mask << 1
+                __ASM_EMIT("and                 $0xff, %[mask]")                                    // mask     = (mask << 1) & 0xff
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = mask
+
+                // Process steps
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[f]), %%ymm1, %%ymm2")   // ymm2     = b1*s
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[f]), %%ymm1, %%ymm3")   // ymm3     = b2*s
+                __ASM_EMIT("vfmadd132ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[f]), %%ymm6, %%ymm1")   // ymm1     = s' = b0*s + d0
+                __ASM_EMIT("vaddps              %%ymm7, %%ymm2, %%ymm2")                            // ymm2     = d1 + b1*s
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x60(%[f]), %%ymm1, %%ymm2")   // ymm2     = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x80(%[f]), %%ymm1, %%ymm3")   // ymm3     = d1' = b2*s + a2*s'
+                __ASM_EMIT("vmovaps             %%ymm2, %%ymm6 %{%%k1%}")                           // ymm6     = (d0' & MASK) | (d0 & ~MASK)
+                __ASM_EMIT("vmovaps             %%ymm3, %%ymm7 %{%%k1%}")                           // ymm7     = (d1' & MASK) | (d1 & ~MASK)
+                __ASM_EMIT("valignd             $7, %%ymm1, %%ymm1, %%ymm1")                        // ymm1     = s2[7] s2[0] ... s2[6]
+                __ASM_EMIT("test                $0x80, %[mask]")
+                __ASM_EMIT("jz                  6f")
+                __ASM_EMIT("vmovss              %%xmm1, (%[dst])")                                  // *dst     = s2[7]
+                __ASM_EMIT("add                 $4, %[dst]")                                        // dst      ++
+                __ASM_EMIT("6:")
+
+                // Repeat loop
+                __ASM_EMIT("shl                 $1, %[mask]")                                       // mask     = mask << 1
+                __ASM_EMIT("and                 $0xff, %[mask]")                                    // mask     = (mask << 1) & 0xff
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = mask
+                __ASM_EMIT("jnz                 5b")                                                // check that mask is not zero
+
+                // Store delay buffer
+                __ASM_EMIT("vmovups             %%ymm6, 0x00(%[f])")                                // d0       = ymm6
+                __ASM_EMIT("vmovups             %%ymm7, 0x20(%[f])")                                // d1       = ymm7
+
+                // Exit label
+                __ASM_EMIT("8:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [mask] "=&r"(mask), [count] "+r" (count)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7",
+                  "%k1", "%k2"
+            );
+        }
+
+        void biquad_process_x16(float *dst, const float *src, size_t count, dsp::biquad16_t *f)
+        {
+            IF_ARCH_X86(size_t mask);
+
+            ARCH_X86_ASM
+            (
+                // Check count
+                __ASM_EMIT("test                %[count], %[count]")
+                __ASM_EMIT("jz                  8f")
+
+                // Initialize mask
+                // zmm1={s,s2[16]}, zmm2=p1[16], zmm3=p2[16], zmm6=d0[16], zmm7=d1[16], k1=mask[16], k2=first lane
+                __ASM_EMIT("mov                 $1, %[mask]")
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = m
+                __ASM_EMIT("kmovw               %k[mask], %%k2")                                    // k2       = 1
+                __ASM_EMIT("vxorps              %%zmm1, %%zmm1, %%zmm1")                            // zmm1     = 0
+
+                // Load delay buffer
+                __ASM_EMIT("vmovups             0x00(%[f]), %%zmm6")                                // zmm6     = d0
+                __ASM_EMIT("vmovups             0x40(%[f]), %%zmm7")                                // zmm7     = d1
+
+                // Process first 15 steps
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vbroadcastss        (%[src]), %%zmm1 %{%%k2%}")                         // zmm1     = s
+                __ASM_EMIT("add                 $4, %[src]")                                        // src      ++
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD16_XN_SOFF " + 0x40(%[f]), %%zmm1, %%zmm2")   // zmm2     = b1*s
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD16_XN_SOFF " + 0x80(%[f]), %%zmm1, %%zmm3")   // zmm3     = b2*s
+                __ASM_EMIT("vfmadd132ps         " LSP_DSP_BIQUAD16_XN_SOFF " + 0x00(%[f]), %%zmm6, %%zmm1")   // zmm1     = s' = b0*s + d0
+                __ASM_EMIT("vaddps              %%zmm7, %%zmm2, %%zmm2")                            // zmm2     = d1 + b1*s
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD16_XN_SOFF " + 0xc0(%[f]), %%zmm1, %%zmm2")   // zmm2     = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD16_XN_SOFF " + 0x100(%[f]), %%zmm1, %%zmm3")   // zmm3     = d1' = b2*s + a2*s'
+                __ASM_EMIT("vmovaps             %%zmm2, %%zmm6 %{%%k1%}")                           // zmm6     = (d0' & MASK) | (d0 & ~MASK)
+                __ASM_EMIT("vmovaps             %%zmm3, %%zmm7 %{%%k1%}")                           // zmm7     = (d1' & MASK) | (d1 & ~MASK)
+                __ASM_EMIT("valignd             $15, %%zmm1, %%zmm1, %%zmm1")                       // zmm1     = s2[15] s2[0] ... s2[14]
+                __ASM_EMIT("dec                 %[count]")
+                __ASM_EMIT("jz                  4f")                                                // jump to completion
+                __ASM_EMIT("lea                 0x01(,%[mask], 2), %[mask]")                        // mask     = (mask << 1) | 1
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = mask
+                __ASM_EMIT("cmp                 $0xffff, %[mask]")
+                __ASM_EMIT("jne                 1b")
+
+                // 16x filter processing without mask
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vbroadcastss        (%[src]), %%zmm1 %{%%k2%}")                         // zmm1     = s
+                __ASM_EMIT("add                 $4, %[src]")                                        // src      ++
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD16_XN_SOFF " + 0x40(%[f]), %%zmm1, %%zmm2")   // zmm2     = b1*s
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD16_XN_SOFF " + 0x80(%[f]), %%zmm1, %%zmm3")   // zmm3     = b2*s
+                __ASM_EMIT("vfmadd132ps         " LSP_DSP_BIQUAD16_XN_SOFF " + 0x00(%[f]), %%zmm6, %%zmm1")   // zmm1     = s' = b0*s + d0
+                __ASM_EMIT("vaddps              %%zmm7, %%zmm2, %%zmm6")                            // zmm6     = d1 + b1*s
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD16_XN_SOFF " + 0xc0(%[f]), %%zmm1, %%zmm6")   // zmm6     = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD16_XN_SOFF " + 0x100(%[f]), %%zmm1, %%zmm3")   // zmm3     = d1' = b2*s + a2*s'
+                __ASM_EMIT("vmovaps             %%zmm3, %%zmm7")                                    // zmm7     = d1'
+                __ASM_EMIT("valignd             $15, %%zmm1, %%zmm1, %%zmm1")                       // zmm1     = s2[15] s2[0] ... s2[14]
+                __ASM_EMIT("vmovss              %%xmm1, (%[dst])")                                  // *dst     = s2[15]
+                __ASM_EMIT("add                 $4, %[dst]")                                        // dst      ++
+                __ASM_EMIT("dec                 %[count]")
+                __ASM_EMIT("jnz                 3b")
+
+                // Prepare last loop, shift mask
+                __ASM_EMIT("4:")
+                __ASM_EMIT("shl                 $1, %[mask]")                                       // mask     = mask << 1
+                __ASM_EMIT("and                 $0xffff, %[mask]")                                  // mask     = (mask << 1) & 0xffff
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = mask
+
+                // Process steps
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD16_XN_SOFF " + 0x40(%[f]), %%zmm1, %%zmm2")   // zmm2     = b1*s
+                __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD16_XN_SOFF " + 0x80(%[f]), %%zmm1, %%zmm3")   // zmm3     = b2*s
+                __ASM_EMIT("vfmadd132ps         " LSP_DSP_BIQUAD16_XN_SOFF " + 0x00(%[f]), %%zmm6, %%zmm1")   // zmm1     = s' = b0*s + d0
+                __ASM_EMIT("vaddps              %%zmm7, %%zmm2, %%zmm2")                            // zmm2     = d1 + b1*s
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD16_XN_SOFF " + 0xc0(%[f]), %%zmm1, %%zmm2")   // zmm2     = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD16_XN_SOFF " + 0x100(%[f]), %%zmm1, %%zmm3")   // zmm3     = d1' = b2*s + a2*s'
+                __ASM_EMIT("vmovaps             %%zmm2, %%zmm6 %{%%k1%}")                           // zmm6     = (d0' & MASK) | (d0 & ~MASK)
+                __ASM_EMIT("vmovaps             %%zmm3, %%zmm7 %{%%k1%}")                           // zmm7     = (d1' & MASK) | (d1 & ~MASK)
+                __ASM_EMIT("valignd             $15, %%zmm1, %%zmm1, %%zmm1")                       // zmm1     = s2[15] s2[0] ... s2[14]
+                __ASM_EMIT("test                $0x8000, %[mask]")
+                __ASM_EMIT("jz                  6f")
+                __ASM_EMIT("vmovss              %%xmm1, (%[dst])")                                  // *dst     = s2[15]
+                __ASM_EMIT("add                 $4, %[dst]")                                        // dst      ++
+                __ASM_EMIT("6:")
+
+                // Repeat loop
+                __ASM_EMIT("shl                 $1, %[mask]")                                       // mask     = mask << 1
+                __ASM_EMIT("and                 $0xffff, %[mask]")                                  // mask     = (mask << 1) & 0xffff
+                __ASM_EMIT("kmovw               %k[mask], %%k1")                                    // k1       = mask
+                __ASM_EMIT("jnz                 5b")                                                // check that mask is not zero
+
+                // Store delay buffer
+                __ASM_EMIT("vmovups             %%zmm6, 0x00(%[f])")                                // d0       = zmm6
+                __ASM_EMIT("vmovups             %%zmm7, 0x40(%[f])")                                // d1       = zmm7
+
+                // Exit label
+                __ASM_EMIT("8:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [mask] "=&r"(mask), [count] "+r" (count)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7",
+                  "%k1", "%k2"
+            );
+        }
+
+        /*
+         * Transpose 4x4 matrices stored in 128-bit lanes of registers A, B, C, D,
+         * the transposed matrices are stored in registers C, D, A, T0
+         */
+        #define BIQUAD_MC_TRANSPOSE(A, B, C, D, T0, T1) \
+            __ASM_EMIT("vunpcklps           " B ", " A ", " T0)                     /* T0   = a0 b0 a1 b1 */ \
+            __ASM_EMIT("vunpckhps           " B ", " A ", " T1)                     /* T1   = a2 b2 a3 b3 */ \
+            __ASM_EMIT("vunpcklps           " D ", " C ", " A)                      /* A    = c0 d0 c1 d1 */ \
+            __ASM_EMIT("vunpckhps           " D ", " C ", " B)                      /* B    = c2 d2 c3 d3 */ \
+            __ASM_EMIT("vshufps             $0x44, " A ", " T0 ", " C)              /* C    = a0 b0 c0 d0 */ \
+            __ASM_EMIT("vshufps             $0xee, " A ", " T0 ", " D)              /* D    = a1 b1 c1 d1 */ \
+            __ASM_EMIT("vshufps             $0x44, " B ", " T1 ", " A)              /* A    = a2 b2 c2 d2 */ \
+            __ASM_EMIT("vshufps             $0xee, " B ", " T1 ", " T0)             /* T0   = a3 b3 c3 d3 */
+
+        /*
+         * Apply eight biquad filters to the sample of eight channels stored in register X,
+         * ymm6 and ymm7 contain filter memory, the p register points to the cascade,
+         * T is the temporary register
+         */
+        #define BIQUAD_MC_FILTER(X, T) \
+            __ASM_EMIT("vmovaps             %%ymm6, " T)                                                    /* T    = d0 */ \
+            __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[p]), " X ", " T)            /* T    = s2 = d0 + b0*s */ \
+            __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[p]), " X ", %%ymm7")        /* ymm7 = d1 + b1*s */ \
+            __ASM_EMIT("vmulps              " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[p]), " X ", " X)            /* X    = b2*s */ \
+            __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x60(%[p]), " T ", %%ymm7")        /* ymm7 = d0' = d1 + b1*s + a1*s2 */ \
+            __ASM_EMIT("vfmadd231ps         " LSP_DSP_BIQUAD_XN_SOFF " + 0x80(%[p]), " T ", " X)            /* X    = d1' = b2*s + a2*s2 */ \
+            __ASM_EMIT("vmovaps             %%ymm7, %%ymm6")                                                /* ymm6 = d0' */ \
+            __ASM_EMIT("vmovaps             " X ", %%ymm7")                                                 /* ymm7 = d1' */ \
+            __ASM_EMIT("vmovaps             " T ", " X)                                                     /* X    = s2 */
+
+        /*
+         * Loop over cascades: the p register points to the current cascade, the filter
+         * memory of the cascade is loaded into ymm6 and ymm7 before processing the block
+         * of samples and stored back after it
+         */
+        #define BIQUAD_MC_CASCADE_BEGIN(L) \
+            __ASM_EMIT("mov                 %[f], %[p]") \
+            __ASM_EMIT(L ":") \
+            __ASM_EMIT("vmovups             0x00(%[p]), %%ymm6")                    /* ymm6 = d0 */ \
+            __ASM_EMIT("vmovups             0x20(%[p]), %%ymm7")                    /* ymm7 = d1 */
+
+        #define BIQUAD_MC_CASCADE_END(L) \
+            __ASM_EMIT("vmovups             %%ymm6, 0x00(%[p])") \
+            __ASM_EMIT("vmovups             %%ymm7, 0x20(%[p])") \
+            __ASM_EMIT("add                 %[FS], %[p]")                           /* p    = next cascade */ \
+            __ASM_EMIT("cmp                 %[fe], %[p]") \
+            __ASM_EMIT("jb                  " L "b")
+
+        #define BIQUAD_MC_PTR(idx)      __IF_32_64(#idx "*4", #idx "*8")
+
+        #define BIQUAD_MC_LOAD(A, B, X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(A) "(%[src]), %[p]") \
+            __ASM_EMIT("vmovups             (%[p], %[off]), %%xmm" X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(B) "(%[src]), %[p]") \
+            __ASM_EMIT("vinsertf128         $1, (%[p], %[off]), %%ymm" X ", %%ymm" X)
+
+        #define BIQUAD_MC_STORE(A, B, X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(A) "(%[dst]), %[p]") \
+            __ASM_EMIT("vmovups             %%xmm" X ", (%[p], %[off])") \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(B) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractf128        $1, %%ymm" X ", (%[p], %[off])")
+
+        /*
+         * Masked versions of load and store, the k1 mask allows to process the tail
+         * of the buffer without access beyond it's end
+         */
+        #define BIQUAD_MC_LOAD_K1(A, B, X, T) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(A) "(%[src]), %[p]") \
+            __ASM_EMIT("vmovups             (%[p], %[off]), %%xmm" X " %{%%k1%}%{z%}") \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(B) "(%[src]), %[p]") \
+            __ASM_EMIT("vmovups             (%[p], %[off]), %%xmm" T " %{%%k1%}%{z%}") \
+            __ASM_EMIT("vinsertf128         $1, %%xmm" T ", %%ymm" X ", %%ymm" X)
+
+        #define BIQUAD_MC_STORE_K1(A, B, X) \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(A) "(%[dst]), %[p]") \
+            __ASM_EMIT("vmovups             %%xmm" X ", (%[p], %[off]) %{%%k1%}") \
+            __ASM_EMIT("mov                 " BIQUAD_MC_PTR(B) "(%[dst]), %[p]") \
+            __ASM_EMIT("vextractf32x4       $1, %%ymm" X ", (%[p], %[off]) %{%%k1%}")
+
+        /*
+         * Each channel is processed in separate SIMD lane, four samples of each
+         * channel are transposed into four registers that contain one sample of
+         * eight channels, processed by all cascades and transposed back. The tail
+         * is processed in the same way by using masked loads and stores.
+         */
+        void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc)
+        {
+            if (nc <= 0)
+                return;
+
+            IF_ARCH_X86(
+                size_t off;
+                const float *p;
+                const dsp::biquad_t *fe = &f[nc];
+                uint16_t tail   = (1 << (count & 3)) - 1;
+            );
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor                 %[off], %[off]")
+
+                // 4x blocks
+                __ASM_EMIT32("subl                $4, %[count]")
+                __ASM_EMIT64("sub                 $4, %[count]")
+                __ASM_EMIT("jb                  2f")
+                __ASM_EMIT("1:")
+                BIQUAD_MC_LOAD(0, 4, "0")                                               // ymm0 = a0 a1 a2 a3 e0 e1 e2 e3
+                BIQUAD_MC_LOAD(1, 5, "1")                                               // ymm1 = b0 b1 b2 b3 f0 f1 f2 f3
+                BIQUAD_MC_LOAD(2, 6, "2")                                               // ymm2 = c0 c1 c2 c3 g0 g1 g2 g3
+                BIQUAD_MC_LOAD(3, 7, "3")                                               // ymm3 = d0 d1 d2 d3 h0 h1 h2 h3
+                BIQUAD_MC_TRANSPOSE("%%ymm0", "%%ymm1", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5")
+                BIQUAD_MC_CASCADE_BEGIN("5")
+                BIQUAD_MC_FILTER("%%ymm2", "%%ymm1")                                    // ymm2 = a0 b0 c0 d0 e0 f0 g0 h0
+                BIQUAD_MC_FILTER("%%ymm3", "%%ymm1")                                    // ymm3 = a1 b1 c1 d1 e1 f1 g1 h1
+                BIQUAD_MC_FILTER("%%ymm0", "%%ymm1")                                    // ymm0 = a2 b2 c2 d2 e2 f2 g2 h2
+                BIQUAD_MC_FILTER("%%ymm4", "%%ymm1")                                    // ymm4 = a3 b3 c3 d3 e3 f3 g3 h3
+                BIQUAD_MC_CASCADE_END("5")
+                BIQUAD_MC_TRANSPOSE("%%ymm2", "%%ymm3", "%%ymm0", "%%ymm4", "%%ymm1", "%%ymm5")
+                BIQUAD_MC_STORE(0, 4, "0")
+                BIQUAD_MC_STORE(1, 5, "4")
+                BIQUAD_MC_STORE(2, 6, "2")
+                BIQUAD_MC_STORE(3, 7, "1")
+                __ASM_EMIT("add                 $0x10, %[off]")
+                __ASM_EMIT32("subl                $4, %[count]")
+                __ASM_EMIT64("sub                 $4, %[count]")
+                __ASM_EMIT("jae                 1b")
+
+                // Tail of 1..3 samples
+                __ASM_EMIT("2:")
+                __ASM_EMIT32("addl                $4, %[count]")
+                __ASM_EMIT64("add                 $4, %[count]")
+                __ASM_EMIT("jz                  4f")
+                __ASM_EMIT("kmovw               %[tail], %%k1")                         // k1   = (1 << count) - 1
+                BIQUAD_MC_LOAD_K1(0, 4, "0", "4")
+                BIQUAD_MC_LOAD_K1(1, 5, "1", "4")
+                BIQUAD_MC_LOAD_K1(2, 6, "2", "4")
+                BIQUAD_MC_LOAD_K1(3, 7, "3", "4")
+                BIQUAD_MC_TRANSPOSE("%%ymm0", "%%ymm1", "%%ymm2", "%%ymm3", "%%ymm4", "%%ymm5")
+                BIQUAD_MC_CASCADE_BEGIN("6")
+                BIQUAD_MC_FILTER("%%ymm2", "%%ymm1")
+                __ASM_EMIT32("cmpl                $1, %[count]")
+                __ASM_EMIT64("cmp                 $1, %[count]")
+                __ASM_EMIT("je                  3f")
+                BIQUAD_MC_FILTER("%%ymm3", "%%ymm1")
+                __ASM_EMIT32("cmpl                $2, %[count]")
+                __ASM_EMIT64("cmp                 $2, %[count]")
+                __ASM_EMIT("je                  3f")
+                BIQUAD_MC_FILTER("%%ymm0", "%%ymm1")
+                __ASM_EMIT("3:")
+                BIQUAD_MC_CASCADE_END("6")
+                BIQUAD_MC_TRANSPOSE("%%ymm2", "%%ymm3", "%%ymm0", "%%ymm4", "%%ymm1", "%%ymm5")
+                BIQUAD_MC_STORE_K1(0, 4, "0")
+                BIQUAD_MC_STORE_K1(1, 5, "4")
+                BIQUAD_MC_STORE_K1(2, 6, "2")
+                BIQUAD_MC_STORE_K1(3, 7, "1")
+
+                __ASM_EMIT("4:")
+
+                : [count] __ASM_ARG_RW(count),
+                  [off] "=&r" (off), [p] "=&r" (p)
+                : [dst] "r" (dst), [src] "r" (src),
+                  [f] "r" (f), [fe] "m" (fe),
+                  [FS] "i" (sizeof(dsp::biquad_t)),
+                  [tail] "m" (tail)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                  "%k1"
+            );
+        }
+
+        #undef BIQUAD_MC_STORE_K1
+        #undef BIQUAD_MC_LOAD_K1
+        #undef BIQUAD_MC_STORE
+        #undef BIQUAD_MC_LOAD
+        #undef BIQUAD_MC_PTR
+        #undef BIQUAD_MC_CASCADE_END
+        #undef BIQUAD_MC_CASCADE_BEGIN
+        #undef BIQUAD_MC_FILTER
+        #undef BIQUAD_MC_TRANSPOSE
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_STATIC_H_ */
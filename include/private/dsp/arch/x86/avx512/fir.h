@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FIR_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FIR_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+namespace lsp
+{
+    namespace avx512
+    {
+        void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+            uint16_t mask   = (uint32_t(1) << (count & 0x0f)) - 1;
+
+            ARCH_X86_ASM(
+                // 64x blocks
+                __ASM_EMIT("sub             $64, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vxorps          %%zmm0, %%zmm0, %%zmm0")                    // zmm0 = s0
+                __ASM_EMIT("vxorps          %%zmm1, %%zmm1, %%zmm1")                    // zmm1 = s1
+                __ASM_EMIT("vxorps          %%zmm2, %%zmm2, %%zmm2")                    // zmm2 = s2
+                __ASM_EMIT("vxorps          %%zmm3, %%zmm3, %%zmm3")                    // zmm3 = s3
+                __ASM_EMIT("xor             %[off], %[off]")
+                __ASM_EMIT("11:")
+                    __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%zmm4")         // zmm4 = t
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src], %[off]), %%zmm4, %%zmm0")  // zmm0 = s0 + t*x0
+                    __ASM_EMIT("vfmadd231ps     0x40(%[src], %[off]), %%zmm4, %%zmm1")  // zmm1 = s1 + t*x1
+                    __ASM_EMIT("vfmadd231ps     0x80(%[src], %[off]), %%zmm4, %%zmm2")  // zmm2 = s2 + t*x2
+                    __ASM_EMIT("vfmadd231ps     0xc0(%[src], %[off]), %%zmm4, %%zmm3")  // zmm3 = s3 + t*x3
+                    __ASM_EMIT("add             $0x04, %[off]")
+                    __ASM_EMIT("cmp             %[tlen], %[off]")
+                    __ASM_EMIT("jb              11b")
+                __ASM_EMIT32("mov           %[dst], %[off]")
+                __ASM_EMIT32("vmovups       %%zmm0, 0x00(%[off])")
+                __ASM_EMIT32("vmovups       %%zmm1, 0x40(%[off])")
+                __ASM_EMIT32("vmovups       %%zmm2, 0x80(%[off])")
+                __ASM_EMIT32("vmovups       %%zmm3, 0xc0(%[off])")
+                __ASM_EMIT32("addl          $0x100, %[dst]")
+                __ASM_EMIT64("vmovups       %%zmm0, 0x00(%[dst])")
+                __ASM_EMIT64("vmovups       %%zmm1, 0x40(%[dst])")
+                __ASM_EMIT64("vmovups       %%zmm2, 0x80(%[dst])")
+                __ASM_EMIT64("vmovups       %%zmm3, 0xc0(%[dst])")
+                __ASM_EMIT64("add           $0x100, %[dst]")
+                __ASM_EMIT("add             $0x100, %[src]")
+                __ASM_EMIT("sub             $64, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                // 16x blocks
+                __ASM_EMIT("add             $48, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vxorps          %%zmm0, %%zmm0, %%zmm0")                    // zmm0 = s0
+                __ASM_EMIT("vxorps          %%zmm1, %%zmm1, %%zmm1")                    // zmm1 = s1
+                __ASM_EMIT("xor             %[off], %[off]")
+                __ASM_EMIT("31:")
+                    __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%zmm4")         // zmm4 = t
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src], %[off]), %%zmm4, %%zmm0")  // zmm0 = s0 + t*x0
+                    __ASM_EMIT("add             $0x04, %[off]")
+                    __ASM_EMIT("cmp             %[tlen], %[off]")
+                    __ASM_EMIT("jae             32f")
+                    __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%zmm4")         // zmm4 = t
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src], %[off]), %%zmm4, %%zmm1")  // zmm1 = s1 + t*x0
+                    __ASM_EMIT("add             $0x04, %[off]")
+                    __ASM_EMIT("cmp             %[tlen], %[off]")
+                    __ASM_EMIT("jb              31b")
+                __ASM_EMIT("32:")
+                __ASM_EMIT("vaddps          %%zmm1, %%zmm0, %%zmm0")                    // zmm0 = s0 + s1
+                __ASM_EMIT32("mov           %[dst], %[off]")
+                __ASM_EMIT32("vmovups       %%zmm0, 0x00(%[off])")
+                __ASM_EMIT32("addl          $0x40, %[dst]")
+                __ASM_EMIT64("vmovups       %%zmm0, 0x00(%[dst])")
+                __ASM_EMIT64("add           $0x40, %[dst]")
+                __ASM_EMIT("add             $0x40, %[src]")
+                __ASM_EMIT("sub             $16, %[count]")
+                __ASM_EMIT("jge             3b")
+                __ASM_EMIT("4:")
+                // Tail, masked
+                __ASM_EMIT("add             $16, %[count]")
+                __ASM_EMIT("jle             6f")
+                __ASM_EMIT("kmovw           %[mask], %%k1")
+                __ASM_EMIT("vxorps          %%zmm0, %%zmm0, %%zmm0")                    // zmm0 = s0
+                __ASM_EMIT("xor             %[off], %[off]")
+                __ASM_EMIT("51:")
+                    __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%zmm4")         // zmm4 = t
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src], %[off]), %%zmm4, %%zmm0 %{%%k1%}") // zmm0 = s0 + t*x0
+                    __ASM_EMIT("add             $0x04, %[off]")
+                    __ASM_EMIT("cmp             %[tlen], %[off]")
+                    __ASM_EMIT("jb              51b")
+                __ASM_EMIT32("mov           %[dst], %[off]")
+                __ASM_EMIT32("vmovups       %%zmm0, 0x00(%[off]) %{%%k1%}")
+                __ASM_EMIT64("vmovups       %%zmm0, 0x00(%[dst]) %{%%k1%}")
+                __ASM_EMIT("6:")
+
+                : [dst] __IF_32("+m") __IF_64("+r") (dst),
+                  [src] "+r" (src), [count] "+r" (count),
+                  [off] "=&r" (off)
+                : [taps] "r" (taps), [tlen] X86_GREG (tlen),
+                  [mask] "m" (mask)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4",
+                  "%k1"
+            );
+        }
+
+        void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+            const float *taps, size_t length, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+            uint16_t mask   = (uint32_t(1) << (count & 0x0f)) - 1;
+
+            ARCH_X86_ASM(
+                // 32x blocks
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vxorps          %%zmm0, %%zmm0, %%zmm0")                    // zmm0 = a0
+                __ASM_EMIT("vxorps          %%zmm1, %%zmm1, %%zmm1")                    // zmm1 = a1
+                __ASM_EMIT("vxorps          %%zmm2, %%zmm2, %%zmm2")                    // zmm2 = b0
+                __ASM_EMIT("vxorps          %%zmm3, %%zmm3, %%zmm3")                    // zmm3 = b1
+                __ASM_EMIT("xor             %[off], %[off]")
+                __ASM_EMIT("11:")
+                    __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%zmm4")         // zmm4 = t
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src1], %[off]), %%zmm4, %%zmm0") // zmm0 = a0 + t*x0
+                    __ASM_EMIT("vfmadd231ps     0x40(%[src1], %[off]), %%zmm4, %%zmm1") // zmm1 = a1 + t*x1
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src2], %[off]), %%zmm4, %%zmm2") // zmm2 = b0 + t*y0
+                    __ASM_EMIT("vfmadd231ps     0x40(%[src2], %[off]), %%zmm4, %%zmm3") // zmm3 = b1 + t*y1
+                    __ASM_EMIT("add             $0x04, %[off]")
+                    __ASM_EMIT("cmp             %[tlen], %[off]")
+                    __ASM_EMIT("jb              11b")
+                __ASM_EMIT32("mov           %[dst1], %[off]")
+                __ASM_EMIT32("vmovups       %%zmm0, 0x00(%[off])")
+                __ASM_EMIT32("vmovups       %%zmm1, 0x40(%[off])")
+                __ASM_EMIT32("mov           %[dst2], %[off]")
+                __ASM_EMIT32("vmovups       %%zmm2, 0x00(%[off])")
+                __ASM_EMIT32("vmovups       %%zmm3, 0x40(%[off])")
+                __ASM_EMIT32("addl          $0x80, %[dst1]")
+                __ASM_EMIT32("addl          $0x80, %[dst2]")
+                __ASM_EMIT64("vmovups       %%zmm0, 0x00(%[dst1])")
+                __ASM_EMIT64("vmovups       %%zmm1, 0x40(%[dst1])")
+                __ASM_EMIT64("vmovups       %%zmm2, 0x00(%[dst2])")
+                __ASM_EMIT64("vmovups       %%zmm3, 0x40(%[dst2])")
+                __ASM_EMIT64("add           $0x80, %[dst1]")
+                __ASM_EMIT64("add           $0x80, %[dst2]")
+                __ASM_EMIT("add             $0x80, %[src1]")
+                __ASM_EMIT("add             $0x80, %[src2]")
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                // 16x block
+                __ASM_EMIT("add             $16, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("vxorps          %%zmm0, %%zmm0, %%zmm0")                    // zmm0 = a0
+                __ASM_EMIT("vxorps          %%zmm2, %%zmm2, %%zmm2")                    // zmm2 = b0
+                __ASM_EMIT("xor             %[off], %[off]")
+                __ASM_EMIT("31:")
+                    __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%zmm4")         // zmm4 = t
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src1], %[off]), %%zmm4, %%zmm0") // zmm0 = a0 + t*x0
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src2], %[off]), %%zmm4, %%zmm2") // zmm2 = b0 + t*y0
+                    __ASM_EMIT("add             $0x04, %[off]")
+                    __ASM_EMIT("cmp             %[tlen], %[off]")
+                    __ASM_EMIT("jb              31b")
+                __ASM_EMIT32("mov           %[dst1], %[off]")
+                __ASM_EMIT32("vmovups       %%zmm0, 0x00(%[off])")
+                __ASM_EMIT32("mov           %[dst2], %[off]")
+                __ASM_EMIT32("vmovups       %%zmm2, 0x00(%[off])")
+                __ASM_EMIT32("addl          $0x40, %[dst1]")
+                __ASM_EMIT32("addl          $0x40, %[dst2]")
+                __ASM_EMIT64("vmovups       %%zmm0, 0x00(%[dst1])")
+                __ASM_EMIT64("vmovups       %%zmm2, 0x00(%[dst2])")
+                __ASM_EMIT64("add           $0x40, %[dst1]")
+                __ASM_EMIT64("add           $0x40, %[dst2]")
+                __ASM_EMIT("add             $0x40, %[src1]")
+                __ASM_EMIT("add             $0x40, %[src2]")
+                __ASM_EMIT("sub             $16, %[count]")
+                __ASM_EMIT("4:")
+                // Tail, masked
+                __ASM_EMIT("add             $16, %[count]")
+                __ASM_EMIT("jle             6f")
+                __ASM_EMIT("kmovw           %[mask], %%k1")
+                __ASM_EMIT("vxorps          %%zmm0, %%zmm0, %%zmm0")                    // zmm0 = a0
+                __ASM_EMIT("vxorps          %%zmm2, %%zmm2, %%zmm2")                    // zmm2 = b0
+                __ASM_EMIT("xor             %[off], %[off]")
+                __ASM_EMIT("51:")
+                    __ASM_EMIT("vbroadcastss    0x00(%[taps], %[off]), %%zmm4")         // zmm4 = t
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src1], %[off]), %%zmm4, %%zmm0 %{%%k1%}")    // zmm0 = a0 + t*x0
+                    __ASM_EMIT("vfmadd231ps     0x00(%[src2], %[off]), %%zmm4, %%zmm2 %{%%k1%}")    // zmm2 = b0 + t*y0
+                    __ASM_EMIT("add             $0x04, %[off]")
+                    __ASM_EMIT("cmp             %[tlen], %[off]")
+                    __ASM_EMIT("jb              51b")
+                __ASM_EMIT32("mov           %[dst1], %[off]")
+                __ASM_EMIT32("vmovups       %%zmm0, 0x00(%[off]) %{%%k1%}")
+                __ASM_EMIT32("mov           %[dst2], %[off]")
+                __ASM_EMIT32("vmovups       %%zmm2, 0x00(%[off]) %{%%k1%}")
+                __ASM_EMIT64("vmovups       %%zmm0, 0x00(%[dst1]) %{%%k1%}")
+                __ASM_EMIT64("vmovups       %%zmm2, 0x00(%[dst2]) %{%%k1%}")
+                __ASM_EMIT("6:")
+
+                : [dst1] __IF_32("+m") __IF_64("+r") (dst1),
+                  [dst2] __IF_32("+m") __IF_64("+r") (dst2),
+                  [src1] "+r" (src1), [src2] "+r" (src2),
+                  [count] "+r" (count), [off] "=&r" (off)
+                : [taps] "r" (taps), [tlen] X86_GREG (tlen),
+                  [mask] "m" (mask)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4",
+                  "%k1"
+            );
+        }
+
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FIR_H_ */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_PFFT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_PFFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+#include <private/dsp/arch/x86/avx512/fft.h>
+#include <private/dsp/arch/x86/avx512/fft/p_repack.h>
+
+namespace lsp
+{
+    namespace avx512
+    {
+        static inline void packed_small_fft(float *dst, const float *src, size_t rank, float dir)
+        {
+            float re[8], im[8];
+            size_t count = 1 << rank;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                size_t j        = (rank > 0) ? reverse_bits(uint32_t(i), rank) : 0;
+                re[j]           = src[i*2];
+                im[j]           = src[i*2 + 1];
+            }
+
+            small_fft_core(re, im, rank, dir);
+
+            float k = (dir > 0.0f) ? 1.0f / count : 1.0f;
+            for (size_t i=0; i<count; ++i)
+            {
+                dst[i*2]        = re[i] * k;
+                dst[i*2 + 1]    = im[i] * k;
+            }
+        }
+
+        void packed_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            // Check bounds
+            if (rank < 4)
+            {
+                packed_small_fft(dst, src, rank, -1.0f);
+                return;
+            }
+
+            if (dst == src)
+                packed_scramble_self(dst, rank, FFT_S_DIRECT);
+            else
+                packed_scramble_copy(dst, src, rank, FFT_S_DIRECT);
+
+            for (size_t i=4; i < rank; ++i)
+                packed_butterfly_direct16p(dst, i, 1 << (rank - i - 1));
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void packed_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            // Check bounds
+            if (rank < 4)
+            {
+                packed_small_fft(dst, src, rank, 1.0f);
+                return;
+            }
+
+            if (dst == src)
+                packed_scramble_self(dst, rank, FFT_S_REVERSE);
+            else
+                packed_scramble_copy(dst, src, rank, FFT_S_REVERSE);
+
+            for (size_t i=4; i < rank; ++i)
+                packed_butterfly_reverse16p(dst, i, 1 << (rank - i - 1));
+
+            packed_fft_repack_normalize(dst, rank);
+        }
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_PFFT_H_ */
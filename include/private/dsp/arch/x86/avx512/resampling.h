@@ -0,0 +1,487 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_RESAMPLING_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_RESAMPLING_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+#include <private/dsp/arch/x86/lanczos.h>
+
+namespace lsp
+{
+    namespace avx512
+    {
+        IF_ARCH_X86(
+            static x86::lanczos_bank_t lanczos_bank;
+
+            static const uint32_t downsample_idx[] __lsp_aligned64 =
+            {
+                0,  2,  4,  6,  8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,      // 2x
+                0,  3,  6,  9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45,      // 3x
+                0,  4,  8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60,      // 4x
+                0,  6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 72, 78, 84, 90,      // 6x
+                0,  8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120    // 8x
+            };
+        )
+
+        /**
+         * Fill the bank of kernels in advance, otherwise the first call of the kernel
+         * function fills it
+         */
+        void lanczos_init()
+        {
+            x86::lanczos_bank_init(&lanczos_bank);
+        }
+
+        /**
+         * Apply the kernel to six groups of 16 output samples located at dst + i*dstep, i = 0..5.
+         * All groups share the same kernel window, the input samples for each next group
+         * are shifted by 16 samples.
+         */
+        static inline void lanczos_apply_x6(float *dst, const float *src, const float *k,
+            size_t kstep, size_t dstep, size_t n)
+        {
+            float *d;
+
+            ARCH_X86_ASM(
+                __ASM_EMIT("mov             %[dst], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%zmm0")                    // zmm0 = a0
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%zmm1")                    // zmm1 = a1
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%zmm2")                    // zmm2 = a2
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%zmm3")                    // zmm3 = a3
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%zmm4")                    // zmm4 = a4
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         (%[d]), %%zmm5")                    // zmm5 = a5
+                __ASM_EMIT(".align          16")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         (%[k]), %%zmm7")                    // zmm7 = k
+                __ASM_EMIT("vbroadcastss    0x000(%[src]), %%zmm6")             // zmm6 = s0
+                __ASM_EMIT("vfmadd231ps     %%zmm7, %%zmm6, %%zmm0")            // zmm0 = a0 + k*s0
+                __ASM_EMIT("vbroadcastss    0x040(%[src]), %%zmm6")             // zmm6 = s16
+                __ASM_EMIT("vfmadd231ps     %%zmm7, %%zmm6, %%zmm1")            // zmm1 = a1 + k*s16
+                __ASM_EMIT("vbroadcastss    0x080(%[src]), %%zmm6")             // zmm6 = s32
+                __ASM_EMIT("vfmadd231ps     %%zmm7, %%zmm6, %%zmm2")            // zmm2 = a2 + k*s32
+                __ASM_EMIT("vbroadcastss    0x0c0(%[src]), %%zmm6")             // zmm6 = s48
+                __ASM_EMIT("vfmadd231ps     %%zmm7, %%zmm6, %%zmm3")            // zmm3 = a3 + k*s48
+                __ASM_EMIT("vbroadcastss    0x100(%[src]), %%zmm6")             // zmm6 = s64
+                __ASM_EMIT("vfmadd231ps     %%zmm7, %%zmm6, %%zmm4")            // zmm4 = a4 + k*s64
+                __ASM_EMIT("vbroadcastss    0x140(%[src]), %%zmm6")             // zmm6 = s80
+                __ASM_EMIT("vfmadd231ps     %%zmm7, %%zmm6, %%zmm5")            // zmm5 = a5 + k*s80
+                __ASM_EMIT("add             $0x04, %[src]")
+                __ASM_EMIT("sub             %[kstep], %[k]")
+                __ASM_EMIT("dec             %[n]")
+                __ASM_EMIT("jnz             1b")
+                __ASM_EMIT("mov             %[dst], %[d]")
+                __ASM_EMIT("vmovups         %%zmm0, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%zmm1, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%zmm2, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%zmm3, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%zmm4, (%[d])")
+                __ASM_EMIT("add             %[dstep], %[d]")
+                __ASM_EMIT("vmovups         %%zmm5, (%[d])")
+
+                : [src] "+r" (src), [k] "+r" (k), [n] "+r" (n),
+                  [d] "=&r" (d)
+                : [dst] X86_GREG (dst),
+                  [kstep] X86_GREG (kstep), [dstep] X86_GREG (dstep)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        /**
+         * Apply the kernel to the single group of 16 output samples
+         */
+        static inline void lanczos_apply_x1(float *dst, const float *src, const float *k,
+            size_t kstep, size_t n)
+        {
+            ARCH_X86_ASM(
+                __ASM_EMIT("vmovups         (%[dst]), %%zmm0")                  // zmm0 = a0
+                __ASM_EMIT("vxorps          %%zmm1, %%zmm1, %%zmm1")            // zmm1 = a1
+                // 2x blocks
+                __ASM_EMIT("sub             $2, %[n]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vbroadcastss    0x00(%[src]), %%zmm2")              // zmm2 = s0
+                __ASM_EMIT("vbroadcastss    0x04(%[src]), %%zmm3")              // zmm3 = s1
+                __ASM_EMIT("vfmadd231ps     (%[k]), %%zmm2, %%zmm0")            // zmm0 = a0 + k0*s0
+                __ASM_EMIT("sub             %[kstep], %[k]")
+                __ASM_EMIT("vfmadd231ps     (%[k]), %%zmm3, %%zmm1")            // zmm1 = a1 + k1*s1
+                __ASM_EMIT("sub             %[kstep], %[k]")
+                __ASM_EMIT("add             $0x08, %[src]")
+                __ASM_EMIT("sub             $2, %[n]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                // 1x block
+                __ASM_EMIT("add             $1, %[n]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("vbroadcastss    0x00(%[src]), %%zmm2")              // zmm2 = s0
+                __ASM_EMIT("vfmadd231ps     (%[k]), %%zmm2, %%zmm0")            // zmm0 = a0 + k0*s0
+                __ASM_EMIT("4:")
+                __ASM_EMIT("vaddps          %%zmm1, %%zmm0, %%zmm0")            // zmm0 = a0 + a1
+                __ASM_EMIT("vmovups         %%zmm0, (%[dst])")
+
+                : [src] "+r" (src), [k] "+r" (k), [n] "+r" (n)
+                : [dst] "r" (dst),
+                  [kstep] X86_GREG (kstep)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3"
+            );
+        }
+
+        /**
+         * Output-driven Lanczos oversampling, see avx2::lanczos_resample_fma3 for details
+         */
+        void lanczos_resample(float *dst, const float *src, const dsp::lanczos_kernel_t *lk, size_t count)
+        {
+            if (count == 0)
+                return;
+
+            const size_t times  = lk->times;
+            const size_t klen   = lk->length;
+            const float *kernel = lk->data;
+            const size_t end    = (count - 1) * times + klen;
+            const size_t gstep  = times * 16;
+
+            // The range [first, last) of input samples that affect the block [m0, m0 + 16),
+            // the first block of the next tile is affected by samples shifted by 6*16
+            ssize_t tfirst      = -ssize_t((klen - 1) / times);
+            ssize_t tlast       = (16 + times - 1) / times;
+
+            for (size_t base = 0; base < end; base += gstep * 6, tfirst += 6*16, tlast += 6*16)
+            {
+                ssize_t first       = tfirst;
+                ssize_t last        = tlast;
+
+                for (size_t m0 = base, mend = base + gstep; m0 < mend; m0 += 16)
+                {
+                    while ((first * ssize_t(times) + ssize_t(klen)) <= ssize_t(m0))
+                        ++first;
+                    while ((last * ssize_t(times)) < ssize_t(m0 + 16))
+                        ++last;
+
+                    if ((first >= 0) && (size_t(last + 5*16) <= count))
+                    {
+                        lanczos_apply_x6(&dst[m0], &src[first], &kernel[m0 - first * times],
+                            times * sizeof(float), gstep * sizeof(float), last - first);
+                        continue;
+                    }
+
+                    // Head or tail of the buffer, process blocks one by one
+                    for (size_t i=0, m=m0; (i < 6) && (m < end); ++i, m += gstep)
+                    {
+                        size_t lo       = lsp_max(first + ssize_t(i * 16), ssize_t(0));
+                        size_t hi       = lsp_min(size_t(last + i * 16), count);
+                        if ((m + 16) <= end)
+                        {
+                            lanczos_apply_x1(&dst[m], &src[lo], &kernel[m - lo * times],
+                                times * sizeof(float), hi - lo);
+                            continue;
+                        }
+
+                        // The last block crosses the end of the convolution tail, do not touch
+                        // the destination buffer after it
+                        float tmp[16] __lsp_aligned64;
+                        const size_t tail   = end - m;
+                        for (size_t j=0; j<tail; ++j)
+                            tmp[j]          = dst[m + j];
+                        lanczos_apply_x1(tmp, &src[lo], &kernel[m - lo * times],
+                            times * sizeof(float), hi - lo);
+                        for (size_t j=0; j<tail; ++j)
+                            dst[m + j]      = tmp[j];
+                    }
+                }
+            }
+        }
+
+        void lanczos_resample_2x2(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X2), count);
+        }
+
+        void lanczos_resample_2x3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X3), count);
+        }
+
+        void lanczos_resample_2x4(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X4), count);
+        }
+
+        void lanczos_resample_2x16bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X16BIT), count);
+        }
+
+        void lanczos_resample_2x24bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_2X24BIT), count);
+        }
+
+        void lanczos_resample_3x2(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X2), count);
+        }
+
+        void lanczos_resample_3x3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X3), count);
+        }
+
+        void lanczos_resample_3x4(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X4), count);
+        }
+
+        void lanczos_resample_3x16bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X16BIT), count);
+        }
+
+        void lanczos_resample_3x24bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_3X24BIT), count);
+        }
+
+        void lanczos_resample_4x2(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X2), count);
+        }
+
+        void lanczos_resample_4x3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X3), count);
+        }
+
+        void lanczos_resample_4x4(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X4), count);
+        }
+
+        void lanczos_resample_4x16bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X16BIT), count);
+        }
+
+        void lanczos_resample_4x24bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_4X24BIT), count);
+        }
+
+        void lanczos_resample_6x2(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X2), count);
+        }
+
+        void lanczos_resample_6x3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X3), count);
+        }
+
+        void lanczos_resample_6x4(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X4), count);
+        }
+
+        void lanczos_resample_6x16bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X16BIT), count);
+        }
+
+        void lanczos_resample_6x24bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_6X24BIT), count);
+        }
+
+        void lanczos_resample_8x2(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X2), count);
+        }
+
+        void lanczos_resample_8x3(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X3), count);
+        }
+
+        void lanczos_resample_8x4(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X4), count);
+        }
+
+        void lanczos_resample_8x16bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X16BIT), count);
+        }
+
+        void lanczos_resample_8x24bit(float *dst, const float *src, size_t count)
+        {
+            lanczos_resample(dst, src, x86::lanczos_bank_kernel(&lanczos_bank, x86::LANCZOS_8X24BIT), count);
+        }
+
+        void downsample_2x(float *dst, const float *src, size_t count)
+        {
+            ARCH_X86_ASM(
+                __ASM_EMIT("vmovups         (%[idx]), %%zmm7")                      // zmm7 = idx
+                // 64x blocks
+                __ASM_EMIT("sub             $64, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         0x000(%[src]), %%zmm0")                 // zmm0 = s0 ? s1 ? ... s7 ?
+                __ASM_EMIT("vmovups         0x080(%[src]), %%zmm1")                 // zmm1 = s16 ? s17 ? ... s23 ?
+                __ASM_EMIT("vmovups         0x100(%[src]), %%zmm2")                 // zmm2 = s32 ? s33 ? ... s39 ?
+                __ASM_EMIT("vmovups         0x180(%[src]), %%zmm3")                 // zmm3 = s48 ? s49 ? ... s55 ?
+                __ASM_EMIT("vpermt2ps       0x040(%[src]), %%zmm7, %%zmm0")         // zmm0 = s0 s1 ... s15
+                __ASM_EMIT("vpermt2ps       0x0c0(%[src]), %%zmm7, %%zmm1")         // zmm1 = s16 s17 ... s31
+                __ASM_EMIT("vpermt2ps       0x140(%[src]), %%zmm7, %%zmm2")         // zmm2 = s32 s33 ... s47
+                __ASM_EMIT("vpermt2ps       0x1c0(%[src]), %%zmm7, %%zmm3")         // zmm3 = s48 s49 ... s63
+                __ASM_EMIT("vmovups         %%zmm0, 0x000(%[dst])")
+                __ASM_EMIT("vmovups         %%zmm1, 0x040(%[dst])")
+                __ASM_EMIT("vmovups         %%zmm2, 0x080(%[dst])")
+                __ASM_EMIT("vmovups         %%zmm3, 0x0c0(%[dst])")
+                __ASM_EMIT("add             $0x200, %[src]")
+                __ASM_EMIT("add             $0x100, %[dst]")
+                __ASM_EMIT("sub             $64, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                // 16x blocks
+                __ASM_EMIT("add             $48, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vmovups         0x000(%[src]), %%zmm0")                 // zmm0 = s0 ? s1 ? ... s7 ?
+                __ASM_EMIT("vpermt2ps       0x040(%[src]), %%zmm7, %%zmm0")         // zmm0 = s0 s1 ... s15
+                __ASM_EMIT("vmovups         %%zmm0, 0x000(%[dst])")
+                __ASM_EMIT("add             $0x80, %[src]")
+                __ASM_EMIT("add             $0x40, %[dst]")
+                __ASM_EMIT("sub             $16, %[count]")
+                __ASM_EMIT("jge             3b")
+                __ASM_EMIT("4:")
+                // 1x blocks
+                __ASM_EMIT("add             $15, %[count]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vmovss          0x000(%[src]), %%xmm0")                 // xmm0 = s0
+                __ASM_EMIT("vmovss          %%xmm0, 0x000(%[dst])")
+                __ASM_EMIT("add             $0x08, %[src]")
+                __ASM_EMIT("add             $0x04, %[dst]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jge             5b")
+                __ASM_EMIT("6:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [idx] "r" (downsample_idx)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm7"
+            );
+        }
+
+        /**
+         * Downsampling with the gather instruction, idx contains offsets of 16 input samples,
+         * step is the distance between two adjacent input samples in bytes
+         */
+        static inline void downsample_gather(float *dst, const float *src, size_t count,
+            const uint32_t *idx, size_t step)
+        {
+            uint16_t mask   = (uint32_t(1) << (count & 0x0f)) - 1;
+
+            ARCH_X86_ASM(
+                __ASM_EMIT("vmovdqu32       (%[idx]), %%zmm7")                      // zmm7 = idx
+                // 32x blocks
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("kxnorw          %%k1, %%k1, %%k1")                      // k1 = mask
+                __ASM_EMIT("kxnorw          %%k2, %%k2, %%k2")                      // k2 = mask
+                __ASM_EMIT("vgatherdps      (%[src], %%zmm7, 4), %%zmm0 %{%%k1%}")  // zmm0 = s0 s1 ... s15
+                __ASM_EMIT("add             %[step], %[src]")
+                __ASM_EMIT("vgatherdps      (%[src], %%zmm7, 4), %%zmm1 %{%%k2%}")  // zmm1 = s16 s17 ... s31
+                __ASM_EMIT("add             %[step], %[src]")
+                __ASM_EMIT("vmovups         %%zmm0, 0x00(%[dst])")
+                __ASM_EMIT("vmovups         %%zmm1, 0x40(%[dst])")
+                __ASM_EMIT("add             $0x80, %[dst]")
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                // 16x block
+                __ASM_EMIT("add             $16, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("kxnorw          %%k1, %%k1, %%k1")                      // k1 = mask
+                __ASM_EMIT("vgatherdps      (%[src], %%zmm7, 4), %%zmm0 %{%%k1%}")  // zmm0 = s0 s1 ... s15
+                __ASM_EMIT("add             %[step], %[src]")
+                __ASM_EMIT("vmovups         %%zmm0, 0x00(%[dst])")
+                __ASM_EMIT("add             $0x40, %[dst]")
+                __ASM_EMIT("sub             $16, %[count]")
+                __ASM_EMIT("4:")
+                // Tail, masked
+                __ASM_EMIT("add             $16, %[count]")
+                __ASM_EMIT("jle             6f")
+                __ASM_EMIT("kmovw           %[mask], %%k1")
+                __ASM_EMIT("kmovw           %%k1, %%k2")
+                __ASM_EMIT("vgatherdps      (%[src], %%zmm7, 4), %%zmm0 %{%%k1%}")  // zmm0 = s0 s1 ... s15
+                __ASM_EMIT("vmovups         %%zmm0, 0x00(%[dst]) %{%%k2%}")
+                __ASM_EMIT("6:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [idx] "r" (idx), [step] X86_GREG (step * 16),
+                  [mask] "m" (mask)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm7",
+                  "%k1", "%k2"
+            );
+        }
+
+        void downsample_3x(float *dst, const float *src, size_t count)
+        {
+            downsample_gather(dst, src, count, &downsample_idx[16], 3*sizeof(float));
+        }
+
+        void downsample_4x(float *dst, const float *src, size_t count)
+        {
+            downsample_gather(dst, src, count, &downsample_idx[32], 4*sizeof(float));
+        }
+
+        void downsample_6x(float *dst, const float *src, size_t count)
+        {
+            downsample_gather(dst, src, count, &downsample_idx[48], 6*sizeof(float));
+        }
+
+        void downsample_8x(float *dst, const float *src, size_t count)
+        {
+            downsample_gather(dst, src, count, &downsample_idx[64], 8*sizeof(float));
+        }
+
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_RESAMPLING_H_ */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_RFFT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_RFFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+#include <private/dsp/arch/generic/fft/real_small.h>
+#include <private/dsp/arch/x86/avx512/fft/const.h>
+#include <private/dsp/arch/x86/avx512/fft/r_split.h>
+
+namespace lsp
+{
+    namespace avx512
+    {
+    IF_ARCH_X86_64(
+        static inline void real_split_twiddle_x1(float *w_re, float *w_im, size_t rank)
+        {
+            size_t step     = size_t(1) << (5 - rank);
+            for (size_t k=0; k <= 8; ++k)
+            {
+                w_re[k]         = FFT_A[k*step];
+                w_im[k]         = FFT_A[16 + k*step];
+            }
+        }
+
+        void x64_real_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                generic::real_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            packed_direct_fft(dst, src, rank - 1);
+            generic::real_fft_split_dc(dst, rank);
+            if (rank < 6)
+            {
+                float w_re[9], w_im[9];
+                real_split_twiddle_x1(w_re, w_im, rank);
+                generic::real_split_direct_x1(dst, w_re, w_im, rank);
+            }
+            else
+                x64_real_split_direct(dst, rank);
+        }
+
+        void x64_real_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            if (rank <= 3)
+            {
+                generic::real_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            generic::real_fft_join_dc(dst, src, rank);
+            if (rank < 6)
+            {
+                float w_re[9], w_im[9];
+                real_split_twiddle_x1(w_re, w_im, rank);
+                generic::real_split_reverse_x1(dst, src, w_re, w_im, rank);
+            }
+            else
+                x64_real_split_reverse(dst, src, rank);
+            packed_reverse_fft(dst, dst, rank - 1);
+        }
+    )
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_RFFT_H_ */
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_LANCZOS_H_
+#define PRIVATE_DSP_ARCH_X86_LANCZOS_H_
+
+#if !defined(PRIVATE_DSP_ARCH_X86_AVX2_IMPL) && !defined(PRIVATE_DSP_ARCH_X86_AVX512_IMPL)
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX2_IMPL, PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+#include <lsp-plug.in/common/atomic.h>
+
+#define LANCZOS_KERNEL_PAD      16      /* Number of zeros around each kernel, one AVX-512 register */
+#define LANCZOS_BANK_SIZE       (2 * (2 + 3 + 4 + 10 + 62) * (2 + 3 + 4 + 6 + 8) + (LANCZOS_TOTAL + 1) * LANCZOS_KERNEL_PAD)
+
+namespace lsp
+{
+    namespace x86
+    {
+        /**
+         * Identifiers of Lanczos kernels stored in the bank
+         */
+        enum lanczos_kernel_id_t
+        {
+            LANCZOS_2X2,    LANCZOS_2X3,    LANCZOS_2X4,    LANCZOS_2X16BIT,    LANCZOS_2X24BIT,
+            LANCZOS_3X2,    LANCZOS_3X3,    LANCZOS_3X4,    LANCZOS_3X16BIT,    LANCZOS_3X24BIT,
+            LANCZOS_4X2,    LANCZOS_4X3,    LANCZOS_4X4,    LANCZOS_4X16BIT,    LANCZOS_4X24BIT,
+            LANCZOS_6X2,    LANCZOS_6X3,    LANCZOS_6X4,    LANCZOS_6X16BIT,    LANCZOS_6X24BIT,
+            LANCZOS_8X2,    LANCZOS_8X3,    LANCZOS_8X4,    LANCZOS_8X16BIT,    LANCZOS_8X24BIT,
+
+            LANCZOS_TOTAL
+        };
+
+        /**
+         * State of the bank initialization
+         */
+        enum lanczos_bank_state_t
+        {
+            LANCZOS_BANK_EMPTY,
+            LANCZOS_BANK_BUSY,
+            LANCZOS_BANK_READY
+        };
+
+        typedef struct lanczos_bank_t
+        {
+            dsp::lanczos_kernel_t   kernel[LANCZOS_TOTAL];
+            float                   data[LANCZOS_BANK_SIZE] __lsp_aligned64;
+            uint32_t                state;
+        } lanczos_bank_t;
+
+        /**
+         * Generate Lanczos kernel in the same way the tables of the generic implementation were computed
+         *
+         * @param dst destination buffer to store 2*lobes*times values
+         * @param times oversampling times
+         * @param lobes number of lobes
+         */
+        static void lanczos_kernel(float *dst, size_t times, size_t lobes)
+        {
+            const ssize_t leaf  = lobes * times;
+            const ssize_t dots  = leaf * 2;
+
+            for (ssize_t i=0; i<dots; ++i)
+            {
+                double xx       = double(i - leaf) / double(times);
+
+                if (i == leaf)
+                    dst[i]          = 1.0f;
+                else if (((i - leaf) % ssize_t(times)) == 0)
+                    dst[i]          = 0.0f;
+                else
+                {
+                    double px       = M_PI * xx;
+                    dst[i]          = float((double(lobes) * sin(px) * sin(px / double(lobes))) / (px * px));
+                }
+            }
+        }
+
+        static void lanczos_bank_fill(lanczos_bank_t *bank)
+        {
+            static const uint8_t times[]    = { 2, 3, 4, 6, 8 };
+            static const uint8_t lobes[]    = { 2, 3, 4, 10, 62 };
+
+            float *ptr                  = bank->data;
+            dsp::lanczos_kernel_t *k    = bank->kernel;
+
+            for (size_t i=0; i<sizeof(times)/sizeof(uint8_t); ++i)
+                for (size_t j=0; j<sizeof(lobes)/sizeof(uint8_t); ++j, ++k)
+                {
+                    for (size_t n=0; n<LANCZOS_KERNEL_PAD; ++n)
+                        *(ptr++)        = 0.0f;
+
+                    k->data         = ptr;
+                    k->times        = times[i];
+                    k->lobes        = lobes[j];
+                    k->length       = 2 * times[i] * lobes[j];
+                    lanczos_kernel(ptr, k->times, lobes[j]);
+                    ptr            += k->length;
+                }
+
+            for (size_t n=0; n<LANCZOS_KERNEL_PAD; ++n)
+                *(ptr++)        = 0.0f;
+        }
+
+        /**
+         * Initialize the bank once, the concurrent callers wait until the first one
+         * fills the bank. The bank should be zero-initialized static storage.
+         *
+         * @param bank bank to initialize
+         */
+        static void lanczos_bank_init(lanczos_bank_t *bank)
+        {
+            if (atomic_cas(&bank->state, uint32_t(LANCZOS_BANK_EMPTY), uint32_t(LANCZOS_BANK_BUSY)))
+            {
+                lanczos_bank_fill(bank);
+                atomic_store(&bank->state, uint32_t(LANCZOS_BANK_READY));
+                return;
+            }
+
+            while (atomic_load(&bank->state) != LANCZOS_BANK_READY)
+                ARCH_X86_ASM( __ASM_EMIT("pause") );
+        }
+
+        /**
+         * Get the kernel from the bank, initialize the bank on the first call if
+         * the kernel function has been called before the dispatcher filled it
+         *
+         * @param bank bank of kernels
+         * @param id identifier of the kernel
+         * @return pointer to the kernel
+         */
+        static inline const dsp::lanczos_kernel_t *lanczos_bank_kernel(lanczos_bank_t *bank, lanczos_kernel_id_t id)
+        {
+            if (atomic_load(&bank->state) != LANCZOS_BANK_READY)
+                lanczos_bank_init(bank);
+            return &bank->kernel[id];
+        }
+
+    } /* namespace x86 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_LANCZOS_H_ */
@@ -213,6 +213,11 @@ namespace lsp
                   "%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4", "%xmm5", "%xmm6", "%xmm7"
             );
         }
+
+        size_t convolve_fft_threshold()
+        {
+            return 224; // Crossover point, see dsp.fft.convolve_fft performance test
+        }
     } /* namespace sse */
 } /* namespace lsp */
 
@@ -131,6 +131,52 @@ namespace lsp
             );
 
         }
+
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank + 1);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+
+                // Load data
+                __ASM_EMIT("movups      0x00(%[c1]), %%xmm0")       /* xmm0 = r0 r1 r2 r3 */
+                __ASM_EMIT("movups      0x10(%[c1]), %%xmm1")       /* xmm1 = i0 i1 i2 i3 */
+                __ASM_EMIT("movups      0x00(%[c2]), %%xmm2")       /* xmm2 = rc0 rc1 rc2 rc3 */
+                __ASM_EMIT("movups      0x10(%[c2]), %%xmm3")       /* xmm3 = ic0 ic1 ic2 ic3 */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")            /* xmm4 = r */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")            /* xmm5 = i */
+                __ASM_EMIT("movups      0x00(%[dst]), %%xmm6")      /* xmm6 = dr */
+                __ASM_EMIT("movups      0x10(%[dst]), %%xmm7")      /* xmm7 = di */
+
+                // Do complex multiplication
+                __ASM_EMIT("mulps       %%xmm2, %%xmm0")            /* xmm0 = r*rc */
+                __ASM_EMIT("mulps       %%xmm3, %%xmm1")            /* xmm1 = i*ic */
+                __ASM_EMIT("mulps       %%xmm3, %%xmm4")            /* xmm4 = r*ic */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm5")            /* xmm5 = i*rc */
+                __ASM_EMIT("subps       %%xmm1, %%xmm0")            /* xmm0 = r*rc - i*ic */
+                __ASM_EMIT("addps       %%xmm5, %%xmm4")            /* xmm4 = r*ic + i*rc */
+
+                // Add to the destination
+                __ASM_EMIT("addps       %%xmm6, %%xmm0")            /* xmm0 = dr + r*rc - i*ic */
+                __ASM_EMIT("addps       %%xmm7, %%xmm4")            /* xmm4 = di + r*ic + i*rc */
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("movups      %%xmm4, 0x10(%[dst])")
+
+                __ASM_EMIT("add         $0x20, %[dst]")
+                __ASM_EMIT("add         $0x20, %[c1]")
+                __ASM_EMIT("add         $0x20, %[c2]")
+                __ASM_EMIT("sub         $8, %[k]")
+                __ASM_EMIT("jnz         1b")
+
+                : [dst] "+r" (dst), [k] "+r" (items), [c1] "+r" (c1), [c2] "+r" (c2)
+                :
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
     }
 }
 
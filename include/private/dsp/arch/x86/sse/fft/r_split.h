@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_FFT_R_SPLIT_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_FFT_R_SPLIT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+namespace lsp
+{
+    namespace sse
+    {
+        IF_ARCH_X86(
+            static const float rfft_split_const[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0.5f)
+            };
+        )
+
+        /**
+         * Compute twiddle factors for the split pass from the FFT tables: initial angles
+         * (1..4)*pi/N and the rotation by 4*pi/N, N = 2^(rank-1), rank >= 4
+         */
+        static inline void real_split_twiddle(float *w, size_t rank)
+        {
+            const float *a      = &XFFT_A[(rank - 3) << 3];     // angles (0..3)*pi/N
+            const float *dw     = &XFFT_W[(rank - 3) << 3];     // rotation by 4*pi/N
+
+            w[0]    = a[1];     w[1]    = a[2];     w[2]    = a[3];
+            w[4]    = a[5];     w[5]    = a[6];     w[6]    = a[7];
+
+            // 4*pi/N = 2 * (2*pi/N)
+            w[3]    = a[2]*a[2] - a[6]*a[6];
+            w[7]    = 2.0f * a[2]*a[6];
+
+            for (size_t i=0; i<8; ++i)
+                w[i + 8]    = dw[i];
+        }
+
+        /**
+         * Split the spectrum of the complex FFT of half size into the spectrum of real FFT,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 4.
+         * X[k] = (Z[k] + Z*[N-k])/2 - j*W^k * (Z[k] - Z*[N-k])/2
+         */
+        static inline void real_split_direct(float *dst, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            float *a        = &dst[2];
+            float *b        = &dst[(items - 4) << 1];
+            float w[16] __lsp_aligned16;
+            real_split_twiddle(w, rank);
+            size_t blocks   = items >> 3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movaps      0x00(%[w]), %%xmm6")            /* xmm6 = w_re */
+                __ASM_EMIT("movaps      0x10(%[w]), %%xmm7")            /* xmm7 = w_im */
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("1:")
+                /* Load and unpack data */
+                __ASM_EMIT("movups      0x00(%[a]), %%xmm0")            /* xmm0 = ar0 ai0 ar1 ai1 */
+                __ASM_EMIT("movups      0x10(%[a]), %%xmm1")            /* xmm1 = ar2 ai2 ar3 ai3 */
+                __ASM_EMIT("movups      0x00(%[b]), %%xmm3")            /* xmm3 = br3 bi3 br2 bi2 */
+                __ASM_EMIT("movups      0x10(%[b]), %%xmm4")            /* xmm4 = br1 bi1 br0 bi0 */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm2")                /* xmm2 = ar0 ai0 ar1 ai1 */
+                __ASM_EMIT("shufps      $0x88, %%xmm1, %%xmm0")         /* xmm0 = ar */
+                __ASM_EMIT("shufps      $0xdd, %%xmm1, %%xmm2")         /* xmm2 = ai */
+                __ASM_EMIT("movaps      %%xmm4, %%xmm1")                /* xmm1 = br1 bi1 br0 bi0 */
+                __ASM_EMIT("shufps      $0x22, %%xmm3, %%xmm1")         /* xmm1 = br */
+                __ASM_EMIT("shufps      $0x77, %%xmm3, %%xmm4")         /* xmm4 = bi */
+                /* Compute sums and differences */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm3")                /* xmm3 = ar */
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")                /* xmm0 = s = ar + br */
+                __ASM_EMIT("subps       %%xmm3, %%xmm1")                /* xmm1 = q = br - ar */
+                __ASM_EMIT("movaps      %%xmm2, %%xmm3")                /* xmm3 = ai */
+                __ASM_EMIT("addps       %%xmm4, %%xmm2")                /* xmm2 = p = ai + bi */
+                __ASM_EMIT("subps       %%xmm4, %%xmm3")                /* xmm3 = d = ai - bi */
+                /* Apply twiddle factors */
+                __ASM_EMIT("movaps      %%xmm2, %%xmm4")                /* xmm4 = p */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")                /* xmm5 = q */
+                __ASM_EMIT("mulps       %%xmm6, %%xmm2")                /* xmm2 = w_re*p */
+                __ASM_EMIT("mulps       %%xmm7, %%xmm1")                /* xmm1 = w_im*q */
+                __ASM_EMIT("mulps       %%xmm6, %%xmm5")                /* xmm5 = w_re*q */
+                __ASM_EMIT("mulps       %%xmm7, %%xmm4")                /* xmm4 = w_im*p */
+                __ASM_EMIT("addps       %%xmm1, %%xmm2")                /* xmm2 = t_re = w_re*p + w_im*q */
+                __ASM_EMIT("subps       %%xmm4, %%xmm5")                /* xmm5 = t_im = w_re*q - w_im*p */
+                /* Compute the output */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1")                /* xmm1 = s */
+                __ASM_EMIT("addps       %%xmm2, %%xmm0")                /* xmm0 = s + t_re */
+                __ASM_EMIT("subps       %%xmm2, %%xmm1")                /* xmm1 = s - t_re */
+                __ASM_EMIT("movaps      %%xmm5, %%xmm4")                /* xmm4 = t_im */
+                __ASM_EMIT("addps       %%xmm3, %%xmm5")                /* xmm5 = t_im + d */
+                __ASM_EMIT("subps       %%xmm3, %%xmm4")                /* xmm4 = t_im - d */
+                __ASM_EMIT("movaps      %[X_HALF], %%xmm2")             /* xmm2 = 0.5 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm0")                /* xmm0 = xa_re = (s + t_re)/2 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm5")                /* xmm5 = xa_im = (t_im + d)/2 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm1")                /* xmm1 = xb_re = (s - t_re)/2 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm4")                /* xmm4 = xb_im = (t_im - d)/2 */
+                /* Pack and store data */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm2")                /* xmm2 = xa_re */
+                __ASM_EMIT("unpcklps    %%xmm5, %%xmm0")                /* xmm0 = ar0 ai0 ar1 ai1 */
+                __ASM_EMIT("unpckhps    %%xmm5, %%xmm2")                /* xmm2 = ar2 ai2 ar3 ai3 */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm3")                /* xmm3 = xb_re */
+                __ASM_EMIT("unpcklps    %%xmm4, %%xmm1")                /* xmm1 = br0 bi0 br1 bi1 */
+                __ASM_EMIT("unpckhps    %%xmm4, %%xmm3")                /* xmm3 = br2 bi2 br3 bi3 */
+                __ASM_EMIT("shufps      $0x4e, %%xmm1, %%xmm1")         /* xmm1 = br1 bi1 br0 bi0 */
+                __ASM_EMIT("shufps      $0x4e, %%xmm3, %%xmm3")         /* xmm3 = br3 bi3 br2 bi2 */
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[a])")
+                __ASM_EMIT("movups      %%xmm2, 0x10(%[a])")
+                __ASM_EMIT("movups      %%xmm3, 0x00(%[b])")
+                __ASM_EMIT("movups      %%xmm1, 0x10(%[b])")
+                __ASM_EMIT("add         $0x20, %[a]")
+                __ASM_EMIT("sub         $0x20, %[b]")
+                __ASM_EMIT32("decl      %[blocks]")
+                __ASM_EMIT64("decq      %[blocks]")
+                __ASM_EMIT("jz          2f")
+                /* Rotate angle */
+                __ASM_EMIT("movaps      %%xmm6, %%xmm0")                /* xmm0 = w_re */
+                __ASM_EMIT("movaps      %%xmm7, %%xmm1")                /* xmm1 = w_im */
+                __ASM_EMIT("mulps       0x20(%[w]), %%xmm6")            /* xmm6 = w_re*dw_re */
+                __ASM_EMIT("mulps       0x30(%[w]), %%xmm7")            /* xmm7 = w_im*dw_im */
+                __ASM_EMIT("mulps       0x30(%[w]), %%xmm0")            /* xmm0 = w_re*dw_im */
+                __ASM_EMIT("mulps       0x20(%[w]), %%xmm1")            /* xmm1 = w_im*dw_re */
+                __ASM_EMIT("subps       %%xmm7, %%xmm6")                /* xmm6 = w_re' = w_re*dw_re - w_im*dw_im */
+                __ASM_EMIT("addps       %%xmm0, %%xmm1")                /* xmm1 = w_im' = w_re*dw_im + w_im*dw_re */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm7")                /* xmm7 = w_im' */
+                __ASM_EMIT("jmp         1b")
+                __ASM_EMIT("2:")
+
+                : [a] "+r" (a), [b] "+r" (b), [blocks] __ASM_ARG_RW(blocks)
+                : [w] "r" (w),
+                  [X_HALF] "m" (rfft_split_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        /**
+         * Join the Hermitian-symmetric spectrum into the spectrum of the complex FFT of half size,
+         * processes harmonics 1..N/2 and N-1..N/2 pairwise, N = 2^(rank-1), rank >= 4.
+         * Z[k] = (X[k] + X*[N-k])/2 + j*W^-k * (X[k] - X*[N-k])/2
+         */
+        static inline void real_split_reverse(float *dst, const float *src, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank - 1);
+            const float *a  = &src[2];
+            const float *b  = &src[(items - 4) << 1];
+            float w[16] __lsp_aligned16;
+            real_split_twiddle(w, rank);
+            ptrdiff_t delta = reinterpret_cast<uint8_t *>(dst) - reinterpret_cast<const uint8_t *>(src);
+            size_t blocks   = items >> 3;
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movaps      0x00(%[w]), %%xmm6")            /* xmm6 = w_re */
+                __ASM_EMIT("movaps      0x10(%[w]), %%xmm7")            /* xmm7 = w_im */
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("1:")
+                /* Load and unpack data */
+                __ASM_EMIT("movups      0x00(%[a]), %%xmm0")            /* xmm0 = ar0 ai0 ar1 ai1 */
+                __ASM_EMIT("movups      0x10(%[a]), %%xmm1")            /* xmm1 = ar2 ai2 ar3 ai3 */
+                __ASM_EMIT("movups      0x00(%[b]), %%xmm3")            /* xmm3 = br3 bi3 br2 bi2 */
+                __ASM_EMIT("movups      0x10(%[b]), %%xmm4")            /* xmm4 = br1 bi1 br0 bi0 */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm2")                /* xmm2 = ar0 ai0 ar1 ai1 */
+                __ASM_EMIT("shufps      $0x88, %%xmm1, %%xmm0")         /* xmm0 = ar */
+                __ASM_EMIT("shufps      $0xdd, %%xmm1, %%xmm2")         /* xmm2 = ai */
+                __ASM_EMIT("movaps      %%xmm4, %%xmm1")                /* xmm1 = br1 bi1 br0 bi0 */
+                __ASM_EMIT("shufps      $0x22, %%xmm3, %%xmm1")         /* xmm1 = br */
+                __ASM_EMIT("shufps      $0x77, %%xmm3, %%xmm4")         /* xmm4 = bi */
+                /* Compute sums and differences */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm3")                /* xmm3 = ar */
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")                /* xmm0 = s = ar + br */
+                __ASM_EMIT("subps       %%xmm1, %%xmm3")                /* xmm3 = p = ar - br */
+                __ASM_EMIT("movaps      %%xmm2, %%xmm1")                /* xmm1 = ai */
+                __ASM_EMIT("subps       %%xmm4, %%xmm2")                /* xmm2 = d = ai - bi */
+                __ASM_EMIT("addps       %%xmm4, %%xmm1")                /* xmm1 = q = ai + bi */
+                /* Apply twiddle factors */
+                __ASM_EMIT("movaps      %%xmm3, %%xmm4")                /* xmm4 = p */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")                /* xmm5 = q */
+                __ASM_EMIT("mulps       %%xmm6, %%xmm3")                /* xmm3 = w_re*p */
+                __ASM_EMIT("mulps       %%xmm7, %%xmm1")                /* xmm1 = w_im*q */
+                __ASM_EMIT("mulps       %%xmm6, %%xmm5")                /* xmm5 = w_re*q */
+                __ASM_EMIT("mulps       %%xmm7, %%xmm4")                /* xmm4 = w_im*p */
+                __ASM_EMIT("subps       %%xmm1, %%xmm3")                /* xmm3 = o_re = w_re*p - w_im*q */
+                __ASM_EMIT("addps       %%xmm4, %%xmm5")                /* xmm5 = o_im = w_re*q + w_im*p */
+                /* Compute the output */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1")                /* xmm1 = s */
+                __ASM_EMIT("subps       %%xmm5, %%xmm0")                /* xmm0 = s - o_im */
+                __ASM_EMIT("addps       %%xmm5, %%xmm1")                /* xmm1 = s + o_im */
+                __ASM_EMIT("movaps      %%xmm3, %%xmm5")                /* xmm5 = o_re */
+                __ASM_EMIT("movaps      %%xmm3, %%xmm4")                /* xmm4 = o_re */
+                __ASM_EMIT("addps       %%xmm2, %%xmm5")                /* xmm5 = o_re + d */
+                __ASM_EMIT("subps       %%xmm2, %%xmm4")                /* xmm4 = o_re - d */
+                __ASM_EMIT("movaps      %[X_HALF], %%xmm2")             /* xmm2 = 0.5 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm0")                /* xmm0 = za_re = (s - o_im)/2 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm5")                /* xmm5 = za_im = (o_re + d)/2 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm1")                /* xmm1 = zb_re = (s + o_im)/2 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm4")                /* xmm4 = zb_im = (o_re - d)/2 */
+                /* Pack and store data */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm2")                /* xmm2 = za_re */
+                __ASM_EMIT("unpcklps    %%xmm5, %%xmm0")                /* xmm0 = ar0 ai0 ar1 ai1 */
+                __ASM_EMIT("unpckhps    %%xmm5, %%xmm2")                /* xmm2 = ar2 ai2 ar3 ai3 */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm3")                /* xmm3 = zb_re */
+                __ASM_EMIT("unpcklps    %%xmm4, %%xmm1")                /* xmm1 = br0 bi0 br1 bi1 */
+                __ASM_EMIT("unpckhps    %%xmm4, %%xmm3")                /* xmm3 = br2 bi2 br3 bi3 */
+                __ASM_EMIT("shufps      $0x4e, %%xmm1, %%xmm1")         /* xmm1 = br1 bi1 br0 bi0 */
+                __ASM_EMIT("shufps      $0x4e, %%xmm3, %%xmm3")         /* xmm3 = br3 bi3 br2 bi2 */
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[a], %[delta])")
+                __ASM_EMIT("movups      %%xmm2, 0x10(%[a], %[delta])")
+                __ASM_EMIT("movups      %%xmm3, 0x00(%[b], %[delta])")
+                __ASM_EMIT("movups      %%xmm1, 0x10(%[b], %[delta])")
+                __ASM_EMIT("add         $0x20, %[a]")
+                __ASM_EMIT("sub         $0x20, %[b]")
+                __ASM_EMIT32("decl      %[blocks]")
+                __ASM_EMIT64("decq      %[blocks]")
+                __ASM_EMIT("jz          2f")
+                /* Rotate angle */
+                __ASM_EMIT("movaps      %%xmm6, %%xmm0")                /* xmm0 = w_re */
+                __ASM_EMIT("movaps      %%xmm7, %%xmm1")                /* xmm1 = w_im */
+                __ASM_EMIT("mulps       0x20(%[w]), %%xmm6")            /* xmm6 = w_re*dw_re */
+                __ASM_EMIT("mulps       0x30(%[w]), %%xmm7")            /* xmm7 = w_im*dw_im */
+                __ASM_EMIT("mulps       0x30(%[w]), %%xmm0")            /* xmm0 = w_re*dw_im */
+                __ASM_EMIT("mulps       0x20(%[w]), %%xmm1")            /* xmm1 = w_im*dw_re */
+                __ASM_EMIT("subps       %%xmm7, %%xmm6")                /* xmm6 = w_re' = w_re*dw_re - w_im*dw_im */
+                __ASM_EMIT("addps       %%xmm0, %%xmm1")                /* xmm1 = w_im' = w_re*dw_im + w_im*dw_re */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm7")                /* xmm7 = w_im' */
+                __ASM_EMIT("jmp         1b")
+                __ASM_EMIT("2:")
+
+                : [a] "+r" (a), [b] "+r" (b), [blocks] __ASM_ARG_RW(blocks)
+                : [w] "r" (w), [delta] "r" (delta),
+                  [X_HALF] "m" (rfft_split_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_FFT_R_SPLIT_H_ */
@@ -0,0 +1,385 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_FFT_PLAN_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_FFT_PLAN_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+#include <private/dsp/arch/generic/fft/plan_small.h>
+
+// Scrambling functions for ranks that do not fit into 16-bit indices
+#define FFT_SCRAMBLE_SELF_DIRECT_NAME   scramble_self_direct32
+#define FFT_SCRAMBLE_SELF_REVERSE_NAME  scramble_self_reverse32
+#define FFT_SCRAMBLE_COPY_DIRECT_NAME   scramble_copy_direct32
+#define FFT_SCRAMBLE_COPY_REVERSE_NAME  scramble_copy_reverse32
+#define FFT_TYPE                        uint32_t
+#include <private/dsp/arch/x86/sse/fft/scramble.h>
+
+#define FFT_SCRAMBLE_SELF_DIRECT_NAME   packed_scramble_self_direct32
+#define FFT_SCRAMBLE_SELF_REVERSE_NAME  packed_scramble_self_reverse32
+#define FFT_SCRAMBLE_COPY_DIRECT_NAME   packed_scramble_copy_direct32
+#define FFT_SCRAMBLE_COPY_REVERSE_NAME  packed_scramble_copy_reverse32
+#define FFT_TYPE                        uint32_t
+#include <private/dsp/arch/x86/sse/fft/p_scramble.h>
+
+namespace lsp
+{
+    namespace sse
+    {
+        /*
+         * Butterflies of rank 4 and above load twiddle factors from the table of the FFT plan:
+         * 16 cosines followed by 16 sines for each 16 pairs of complex numbers, each group
+         * of 16 pairs is processed as four quarters of 4 pairs.
+         */
+        #define FFT_PLAN_BUTTERFLY_QUARTER(a_re, a_im, b_re, b_im, w_re, w_im, add_b, add_a) \
+            __ASM_EMIT("movups          " b_re ", %%xmm2")                              /* xmm2 = b_re */ \
+            __ASM_EMIT("movups          " b_im ", %%xmm3")                              /* xmm3 = b_im */ \
+            __ASM_EMIT("movaps          %%xmm2, %%xmm4")                                /* xmm4 = b_re */ \
+            __ASM_EMIT("movaps          %%xmm3, %%xmm5")                                /* xmm5 = b_im */ \
+            /* Calculate complex multiplication */ \
+            __ASM_EMIT("mulps           " w_re ", %%xmm2")                              /* xmm2 = x_re * b_re */ \
+            __ASM_EMIT("mulps           " w_re ", %%xmm3")                              /* xmm3 = x_re * b_im */ \
+            __ASM_EMIT("mulps           " w_im ", %%xmm4")                              /* xmm4 = x_im * b_re */ \
+            __ASM_EMIT("mulps           " w_im ", %%xmm5")                              /* xmm5 = x_im * b_im */ \
+            __ASM_EMIT("movups          " a_re ", %%xmm0")                              /* xmm0 = a_re */ \
+            __ASM_EMIT("movups          " a_im ", %%xmm1")                              /* xmm1 = a_im */ \
+            __ASM_EMIT(add_b "          %%xmm5, %%xmm2")                                /* xmm2 = c_re = x_re * b_re +- x_im * b_im */ \
+            __ASM_EMIT(add_a "          %%xmm4, %%xmm3")                                /* xmm3 = c_im = x_re * b_im -+ x_im * b_re */ \
+            /* Perform butterfly */ \
+            __ASM_EMIT("movaps          %%xmm0, %%xmm4")                                /* xmm4 = a_re */ \
+            __ASM_EMIT("movaps          %%xmm1, %%xmm5")                                /* xmm5 = a_im */ \
+            __ASM_EMIT("subps           %%xmm2, %%xmm0")                                /* xmm0 = a_re - c_re */ \
+            __ASM_EMIT("subps           %%xmm3, %%xmm1")                                /* xmm1 = a_im - c_im */ \
+            __ASM_EMIT("addps           %%xmm4, %%xmm2")                                /* xmm2 = a_re + c_re */ \
+            __ASM_EMIT("addps           %%xmm5, %%xmm3")                                /* xmm3 = a_im + c_im */ \
+            /* Store values */ \
+            __ASM_EMIT("movups          %%xmm2, " a_re) \
+            __ASM_EMIT("movups          %%xmm0, " b_re) \
+            __ASM_EMIT("movups          %%xmm3, " a_im) \
+            __ASM_EMIT("movups          %%xmm1, " b_im)
+
+        #define FFT_PLAN_BUTTERFLY_BODY16(add_b, add_a) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("mov             %[shift], %[np]") \
+                /* Process pairs */ \
+                __ASM_EMIT("2:") \
+                    FFT_PLAN_BUTTERFLY_QUARTER("0x00(%[dst_re])", "0x00(%[dst_im])", "0x00(%[dst_re], %[shift])", "0x00(%[dst_im], %[shift])", \
+                        "0x00(%[tw])", "0x40(%[tw])", add_b, add_a) \
+                    FFT_PLAN_BUTTERFLY_QUARTER("0x10(%[dst_re])", "0x10(%[dst_im])", "0x10(%[dst_re], %[shift])", "0x10(%[dst_im], %[shift])", \
+                        "0x10(%[tw])", "0x50(%[tw])", add_b, add_a) \
+                    FFT_PLAN_BUTTERFLY_QUARTER("0x20(%[dst_re])", "0x20(%[dst_im])", "0x20(%[dst_re], %[shift])", "0x20(%[dst_im], %[shift])", \
+                        "0x20(%[tw])", "0x60(%[tw])", add_b, add_a) \
+                    FFT_PLAN_BUTTERFLY_QUARTER("0x30(%[dst_re])", "0x30(%[dst_im])", "0x30(%[dst_re], %[shift])", "0x30(%[dst_im], %[shift])", \
+                        "0x30(%[tw])", "0x70(%[tw])", add_b, add_a) \
+                    __ASM_EMIT("add             $0x40, %[dst_re]") \
+                    __ASM_EMIT("add             $0x40, %[dst_im]") \
+                    __ASM_EMIT("add             $0x80, %[tw]") \
+                    __ASM_EMIT("sub             $0x40, %[np]") \
+                __ASM_EMIT("jnz             2b") \
+                /* Move to the next block and rewind twiddle factors */ \
+                __ASM_EMIT("add             %[shift], %[dst_re]") \
+                __ASM_EMIT("add             %[shift], %[dst_im]") \
+                __ASM_EMIT("sub             %[shift], %[tw]") \
+                __ASM_EMIT("sub             %[shift], %[tw]") \
+                __ASM_EMIT32("decl          %[blocks]") \
+                __ASM_EMIT64("decq          %[blocks]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [dst_re] "+r" (dst_re), [dst_im] "+r" (dst_im), [tw] "+r" (tw), \
+                  [np] "=&r" (np), [blocks] X86_PGREG (blocks) \
+                : [shift] "r" (shift) \
+                : "cc", "memory",  \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5" \
+            );
+
+        #define FFT_PLAN_PBUTTERFLY_BODY16(add_b, add_a) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("mov             %[shift], %[np]") \
+                /* Process pairs */ \
+                __ASM_EMIT("2:") \
+                    FFT_PLAN_BUTTERFLY_QUARTER("0x00(%[dst])", "0x10(%[dst])", "0x00(%[dst], %[shift])", "0x10(%[dst], %[shift])", \
+                        "0x00(%[tw])", "0x40(%[tw])", add_b, add_a) \
+                    FFT_PLAN_BUTTERFLY_QUARTER("0x20(%[dst])", "0x30(%[dst])", "0x20(%[dst], %[shift])", "0x30(%[dst], %[shift])", \
+                        "0x10(%[tw])", "0x50(%[tw])", add_b, add_a) \
+                    FFT_PLAN_BUTTERFLY_QUARTER("0x40(%[dst])", "0x50(%[dst])", "0x40(%[dst], %[shift])", "0x50(%[dst], %[shift])", \
+                        "0x20(%[tw])", "0x60(%[tw])", add_b, add_a) \
+                    FFT_PLAN_BUTTERFLY_QUARTER("0x60(%[dst])", "0x70(%[dst])", "0x60(%[dst], %[shift])", "0x70(%[dst], %[shift])", \
+                        "0x30(%[tw])", "0x70(%[tw])", add_b, add_a) \
+                    __ASM_EMIT("add             $0x80, %[dst]") \
+                    __ASM_EMIT("add             $0x80, %[tw]") \
+                    __ASM_EMIT("sub             $0x80, %[np]") \
+                __ASM_EMIT("jnz             2b") \
+                /* Move to the next block and rewind twiddle factors */ \
+                __ASM_EMIT("add             %[shift], %[dst]") \
+                __ASM_EMIT("sub             %[shift], %[tw]") \
+                __ASM_EMIT32("decl          %[blocks]") \
+                __ASM_EMIT64("decq          %[blocks]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [dst] "+r" (dst), [tw] "+r" (tw), \
+                  [np] "=&r" (np), [blocks] X86_PGREG (blocks) \
+                : [shift] "r" (shift) \
+                : "cc", "memory",  \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5" \
+            );
+
+        static inline void fft_plan_butterfly_direct16p(float *dst_re, float *dst_im, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(4) << rank;
+
+            FFT_PLAN_BUTTERFLY_BODY16("addps", "subps");
+        }
+
+        static inline void fft_plan_butterfly_reverse16p(float *dst_re, float *dst_im, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(4) << rank;
+
+            FFT_PLAN_BUTTERFLY_BODY16("subps", "addps");
+        }
+
+        static inline void fft_plan_packed_butterfly_direct16p(float *dst, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(8) << rank;
+
+            FFT_PLAN_PBUTTERFLY_BODY16("addps", "subps");
+        }
+
+        static inline void fft_plan_packed_butterfly_reverse16p(float *dst, const float *tw, size_t rank, size_t blocks)
+        {
+            size_t np;
+            size_t shift        = size_t(8) << rank;
+
+            FFT_PLAN_PBUTTERFLY_BODY16("subps", "addps");
+        }
+
+    #undef FFT_PLAN_BUTTERFLY_QUARTER
+    #undef FFT_PLAN_BUTTERFLY_BODY16
+    #undef FFT_PLAN_PBUTTERFLY_BODY16
+
+        /*
+         * Transforms of rank 3 and butterflies of rank 2 and 3 take the twiddle factors
+         * from the static tables: they are exact and do not accumulate the rotation error.
+         */
+        static inline void fft_plan_scramble_direct(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        {
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                dsp::move(dst_re, src_re, size_t(1) << rank);
+                dsp::move(dst_im, src_im, size_t(1) << rank);
+                if (rank <= 8)
+                    scramble_self_direct8(dst_re, dst_im, dst_re, dst_im, rank);
+                else if (rank <= 16)
+                    scramble_self_direct16(dst_re, dst_im, dst_re, dst_im, rank);
+                else
+                    scramble_self_direct32(dst_re, dst_im, dst_re, dst_im, rank);
+            }
+            else
+            {
+                if (rank <= 11)
+                    scramble_copy_direct8(dst_re, dst_im, src_re, src_im, rank-3);
+                else if (rank <= 19)
+                    scramble_copy_direct16(dst_re, dst_im, src_re, src_im, rank-3);
+                else
+                    scramble_copy_direct32(dst_re, dst_im, src_re, src_im, rank-3);
+            }
+        }
+
+        static inline void fft_plan_scramble_reverse(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
+        {
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                dsp::move(dst_re, src_re, size_t(1) << rank);
+                dsp::move(dst_im, src_im, size_t(1) << rank);
+                if (rank <= 8)
+                    scramble_self_reverse8(dst_re, dst_im, dst_re, dst_im, rank);
+                else if (rank <= 16)
+                    scramble_self_reverse16(dst_re, dst_im, dst_re, dst_im, rank);
+                else
+                    scramble_self_reverse32(dst_re, dst_im, dst_re, dst_im, rank);
+            }
+            else
+            {
+                if (rank <= 11)
+                    scramble_copy_reverse8(dst_re, dst_im, src_re, src_im, rank-3);
+                else if (rank <= 19)
+                    scramble_copy_reverse16(dst_re, dst_im, src_re, src_im, rank-3);
+                else
+                    scramble_copy_reverse32(dst_re, dst_im, src_re, src_im, rank-3);
+            }
+        }
+
+        static inline void fft_plan_packed_scramble_direct(float *dst, const float *src, size_t rank)
+        {
+            if (dst == src)
+            {
+                if (rank <= 8)
+                    packed_scramble_self_direct8(dst, dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_direct16(dst, dst, rank);
+                else
+                    packed_scramble_self_direct32(dst, dst, rank);
+            }
+            else
+            {
+                if (rank <= 11)
+                    packed_scramble_copy_direct8(dst, src, rank-3);
+                else if (rank <= 19)
+                    packed_scramble_copy_direct16(dst, src, rank-3);
+                else
+                    packed_scramble_copy_direct32(dst, src, rank-3);
+            }
+        }
+
+        static inline void fft_plan_packed_scramble_reverse(float *dst, const float *src, size_t rank)
+        {
+            if (dst == src)
+            {
+                if (rank <= 8)
+                    packed_scramble_self_reverse8(dst, dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_reverse16(dst, dst, rank);
+                else
+                    packed_scramble_self_reverse32(dst, dst, rank);
+            }
+            else
+            {
+                if (rank <= 11)
+                    packed_scramble_copy_reverse8(dst, src, rank-3);
+                else if (rank <= 19)
+                    packed_scramble_copy_reverse16(dst, src, rank-3);
+                else
+                    packed_scramble_copy_reverse32(dst, src, rank-3);
+            }
+        }
+
+        void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(dst_re, dst_im, src_re, src_im, 1, rank, -1.0f);
+                return;
+            }
+            else if (rank == 3)
+            {
+                direct_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            fft_plan_scramble_direct(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_direct(dst_re, dst_im, 2, size_t(1) << (rank - 3));
+            butterfly_direct(dst_re, dst_im, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_butterfly_direct16p(dst_re, dst_im, tw, i, size_t(1) << (rank - i - 1));
+        }
+
+        void fft_plan_reverse(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(dst_re, dst_im, src_re, src_im, 1, rank, 1.0f);
+                return;
+            }
+            else if (rank == 3)
+            {
+                reverse_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            fft_plan_scramble_reverse(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_reverse(dst_re, dst_im, 2, size_t(1) << (rank - 3));
+            butterfly_reverse(dst_re, dst_im, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_butterfly_reverse16p(dst_re, dst_im, tw, i, size_t(1) << (rank - i - 1));
+
+            normalize_fft2(dst_re, dst_im, rank);
+        }
+
+        void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(&dst[0], &dst[1], &src[0], &src[1], 2, rank, -1.0f);
+                return;
+            }
+            else if (rank == 3)
+            {
+                packed_direct_fft(dst, src, rank);
+                return;
+            }
+
+            fft_plan_packed_scramble_direct(dst, src, rank);
+            packed_butterfly_direct(dst, 2, size_t(1) << (rank - 3));
+            packed_butterfly_direct(dst, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_packed_butterfly_direct16p(dst, tw, i, size_t(1) << (rank - i - 1));
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void fft_plan_packed_reverse(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank <= 2)
+            {
+                generic::fft_plan_small(&dst[0], &dst[1], &src[0], &src[1], 2, rank, 1.0f);
+                return;
+            }
+            else if (rank == 3)
+            {
+                packed_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            fft_plan_packed_scramble_reverse(dst, src, rank);
+            packed_butterfly_reverse(dst, 2, size_t(1) << (rank - 3));
+            packed_butterfly_reverse(dst, 3, size_t(1) << (rank - 4));
+
+            const float *tw     = plan->twiddle;
+            for (size_t i=4; i < rank; tw += size_t(2) << i, ++i)
+                fft_plan_packed_butterfly_reverse16p(dst, tw, i, size_t(1) << (rank - i - 1));
+
+            packed_fft_repack_normalize(dst, rank);
+        }
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_FFT_PLAN_H_ */
@@ -26,6 +26,8 @@
     #error "This header should not be included directly"
 #endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
 
+#include <private/dsp/arch/generic/filters/lerp.h>
+
 namespace lsp
 {
     namespace sse
@@ -707,6 +709,461 @@ namespace lsp
                   "%xmm4", "%xmm5", "%xmm6", "%xmm7"
             );
         }
+
+        IF_ARCH_X86(
+            static const float dyn_lerp_const[] __lsp_aligned16 =
+            {
+                1.0f, 1.0f, 1.0f, 1.0f
+            };
+        );
+
+        /*
+         * Interpolated filters keep the state of interpolation (see generic/filters/lerp.h)
+         * at the start of the work buffer w, the filter for the current step is computed into
+         * the same buffer and then applied by the code of dyn_biquad_process_x* functions.
+         * The index of sample is clamped for lanes that are out of the pipeline, so the
+         * coefficients of idle lanes never leave the range of interpolation.
+         *
+         * x1: base 0x00, step 0x20, filter 0x40
+         */
+        static void dyn_lerp_process_x1(float *dst, const float *src, float *d, size_t count, float *w)
+        {
+            IF_ARCH_X86(size_t off);
+
+            ARCH_X86_ASM
+            (
+                // Check count
+                __ASM_EMIT32("cmpl      $0, %[count]")
+                __ASM_EMIT64("test      %[count], %[count]")
+                __ASM_EMIT("jz          2f")
+
+                // Load permanent data
+                __ASM_EMIT("movss       0x00(%[d]), %%xmm6")                    // xmm6 = d0
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("movss       0x04(%[d]), %%xmm7")                    // xmm7 = d1
+                __ASM_EMIT("xorps       %%xmm5, %%xmm5")                        // xmm5 = k
+
+                // Start loop
+                __ASM_EMIT("1:")
+                // Compute the filter
+                __ASM_EMIT("movaps      0x20(%[w]), %%xmm2")                    // xmm2 = db0 db1 db2 da1
+                __ASM_EMIT("movaps      0x30(%[w]), %%xmm3")                    // xmm3 = da2 dn 0 0
+                __ASM_EMIT("mulps       %%xmm5, %%xmm2")
+                __ASM_EMIT("mulps       %%xmm5, %%xmm3")
+                __ASM_EMIT("addps       0x00(%[w]), %%xmm2")                    // xmm2 = b0 b1 b2 a1
+                __ASM_EMIT("addps       0x10(%[w]), %%xmm3")                    // xmm3 = a2 n 0 0
+                __ASM_EMIT("movaps      %[ONE], %%xmm4")                        // xmm4 = 1
+                __ASM_EMIT("movaps      %%xmm3, %%xmm0")
+                __ASM_EMIT("addps       %%xmm4, %%xmm5")                        // xmm5 = k + 1
+                __ASM_EMIT("shufps      $0x55, %%xmm0, %%xmm0")                 // xmm0 = n n n n
+                __ASM_EMIT("divps       %%xmm0, %%xmm4")                        // xmm4 = 1/n
+                __ASM_EMIT("mulps       %%xmm4, %%xmm2")
+                __ASM_EMIT("mulps       %%xmm4, %%xmm3")
+                __ASM_EMIT("movaps      %%xmm2, 0x40(%[w])")
+                __ASM_EMIT("movss       %%xmm3, 0x50(%[w])")
+                // Apply the filter
+                __ASM_EMIT("movss       (%[src], %[off], 4), %%xmm0")           // xmm0 = s ? ? ?
+                __ASM_EMIT("movss       0x40(%[w]), %%xmm1")                    // xmm1 = a0
+                __ASM_EMIT("movss       0x44(%[w]), %%xmm2")                    // xmm2 = a1
+                __ASM_EMIT("mulss       %%xmm0, %%xmm1")                        // xmm1 = a0*s
+                __ASM_EMIT("movss       0x4c(%[w]), %%xmm3")                    // xmm3 = b1
+                __ASM_EMIT("mulss       %%xmm0, %%xmm2")                        // xmm2 = a1*s
+                __ASM_EMIT("addss       %%xmm6, %%xmm1")                        // xmm1 = s' = a0*s + d0
+                __ASM_EMIT("mulss       0x48(%[w]), %%xmm0")                    // xmm0 = a2*s
+                __ASM_EMIT("movss       %%xmm1, (%[dst], %[off], 4)")           // *dst = s'
+                __ASM_EMIT("movaps      %%xmm7, %%xmm6")                        // xmm6 = d1
+                __ASM_EMIT("mulss       %%xmm1, %%xmm3")                        // xmm3 = b1*s'
+                __ASM_EMIT("add         $1, %[off]")
+                __ASM_EMIT("mulss       0x50(%[w]), %%xmm1")                    // xmm1 = b2*s'
+                __ASM_EMIT("addss       %%xmm3, %%xmm2")                        // xmm2 = a1*s + b1*s'
+                __ASM_EMIT("addss       %%xmm0, %%xmm1")                        // xmm3 = d1' = a2*s + b2*s'
+                __ASM_EMIT("cmp         %[count], %[off]")
+                __ASM_EMIT("addss       %%xmm2, %%xmm6")                        // xmm6 = d0' = d1 + a1*s + b1*s'
+                __ASM_EMIT("movaps      %%xmm1, %%xmm7")                        // xmm7 = d1'
+                __ASM_EMIT("jb          1b")
+
+                // Store the updated buffer state
+                __ASM_EMIT("movss       %%xmm6, 0x00(%[d])")
+                __ASM_EMIT("movss       %%xmm7, 0x04(%[d])")
+
+                // Exit label
+                __ASM_EMIT("2:")
+
+                : [off] "=&r"(off)
+                : [dst] "r" (dst), [src] "r" (src),
+                  [count] __ASM_ARG_RO (count),
+                  [d] "r" (d), [w] "r" (w),
+                  [ONE] "m" (dyn_lerp_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        /*
+         * The x2 bank is processed as two x1 banks one after another, the lanes of the
+         * x2 bank do not give enough work to hide the latency of division in one loop
+         */
+        static void dyn_lerp_process_x2(float *dst, const float *src, float *d, size_t count, float *w0, float *w1)
+        {
+            float dx[2];
+
+            for (size_t i=0; i<2; ++i)
+            {
+                dx[0]       = d[i];
+                dx[1]       = d[i+2];
+
+                dyn_lerp_process_x1(dst, src, dx, count, (i > 0) ? w1 : w0);
+
+                d[i]        = dx[0];
+                d[i+2]      = dx[1];
+                src         = dst;
+            }
+        }
+
+        /*
+         * x4: base 0x00, step 0x60, filter 0xc0, k 0x110, max k 0x120
+         */
+        #define DYN_LERP_X4_ROW(base, step, dst) \
+            __ASM_EMIT("movaps      " step "(%[w]), %%xmm3") \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm3") \
+            __ASM_EMIT("addps       " base "(%[w]), %%xmm3") \
+            __ASM_EMIT("mulps       %%xmm4, %%xmm3") \
+            __ASM_EMIT("movaps      %%xmm3, " dst "(%[w])")
+
+        #define DYN_LERP_X4_FILTER \
+            __ASM_EMIT("movaps      0x110(%[w]), %%xmm2")                           /* xmm2 = k */ \
+            __ASM_EMIT("xorps       %%xmm4, %%xmm4")                                /* xmm4 = 0 */ \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm3") \
+            __ASM_EMIT("maxps       %%xmm4, %%xmm2") \
+            __ASM_EMIT("addps       %[ONE], %%xmm3") \
+            __ASM_EMIT("minps       0x120(%[w]), %%xmm2")                           /* xmm2 = clamped k */ \
+            __ASM_EMIT("movaps      %%xmm3, 0x110(%[w])")                           /* k += 1 */ \
+            __ASM_EMIT("movaps      0xb0(%[w]), %%xmm3") \
+            __ASM_EMIT("movaps      %[ONE], %%xmm4") \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm3") \
+            __ASM_EMIT("addps       0x50(%[w]), %%xmm3")                            /* xmm3 = n */ \
+            __ASM_EMIT("divps       %%xmm3, %%xmm4")                                /* xmm4 = 1/n */ \
+            DYN_LERP_X4_ROW("0x00", "0x60", "0xc0")                                 /* b0 */ \
+            DYN_LERP_X4_ROW("0x10", "0x70", "0xd0")                                 /* b1 */ \
+            DYN_LERP_X4_ROW("0x20", "0x80", "0xe0")                                 /* b2 */ \
+            DYN_LERP_X4_ROW("0x30", "0x90", "0xf0")                                 /* a1 */ \
+            DYN_LERP_X4_ROW("0x40", "0xa0", "0x100")                                /* a2 */
+
+        static void dyn_lerp_process_x4(float *dst, const float *src, float *d, size_t count, float *w)
+        {
+            IF_ARCH_X86(
+                float   MASK[4] __lsp_aligned16;
+                size_t  mask;
+            );
+
+            w[0x44]     = 0.0f;
+            w[0x45]     = -1.0f;
+            w[0x46]     = -2.0f;
+            w[0x47]     = -3.0f;
+            w[0x48]     = float(count - 1);
+            w[0x49]     = w[0x48];
+            w[0x4a]     = w[0x48];
+            w[0x4b]     = w[0x48];
+
+            ARCH_X86_ASM
+            (
+                // Check count
+                __ASM_EMIT32("cmpl      $0, %[count]")
+                __ASM_EMIT64("test      %[count], %[count]")
+                __ASM_EMIT("jz          8f")
+
+                // Initialize mask
+                // xmm0=tmp, xmm1={s,s2[4]}, xmm2=p1[4], xmm3=p2[4], xmm6=d0[4], xmm7=d1[4]
+                __ASM_EMIT("mov         $1, %[mask]")
+                __ASM_EMIT("movaps      %[X_MASK], %%xmm0")
+                __ASM_EMIT("xorps       %%xmm1, %%xmm1")
+                __ASM_EMIT("movaps      %%xmm0, %[MASK]")
+
+                // Load delay buffer
+                __ASM_EMIT("movups      0x00(%[d]), %%xmm6")                        // xmm6     = d0
+                __ASM_EMIT("movups      0x10(%[d]), %%xmm7")                        // xmm7     = d1
+
+                // Process first 3 steps
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("1:")
+                DYN_LERP_X4_FILTER
+                __ASM_EMIT("movss       (%[src]), %%xmm0")                          // xmm0     = *src
+                __ASM_EMIT("add         $4, %[src]")                                // src      ++
+                __ASM_EMIT("movss       %%xmm0, %%xmm1")                            // xmm1     = s
+                __ASM_EMIT("movaps      %%xmm1, %%xmm2")                            // xmm2     = s
+                __ASM_EMIT("movaps      %%xmm1, %%xmm3")                            // xmm3     = s
+                __ASM_EMIT("mulps       0xc0(%[w]), %%xmm1")                        // xmm1     = s*a0
+                __ASM_EMIT("mulps       0xd0(%[w]), %%xmm2")                        // xmm2     = s*a1
+                __ASM_EMIT("addps       %%xmm6, %%xmm1")                            // xmm1     = s*a0+d0 = s2
+                __ASM_EMIT("mulps       0xe0(%[w]), %%xmm3")                        // xmm3     = s*a2
+                __ASM_EMIT("movaps      %%xmm1, %%xmm4")                            // xmm4     = s2
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")                            // xmm5     = s2
+                __ASM_EMIT("mulps       0xf0(%[w]), %%xmm4")                        // xmm4     = s2*b1
+                __ASM_EMIT("mulps       0x100(%[w]), %%xmm5")                       // xmm5     = s2*b2
+                __ASM_EMIT("addps       %%xmm4, %%xmm2")                            // xmm2     = s*a1 + s2*b1 = p1
+                __ASM_EMIT("addps       %%xmm5, %%xmm3")                            // xmm3     = s*a2 + s2*b2 = p2
+
+                // Shift buffer
+                __ASM_EMIT("shufps      $0x90, %%xmm1, %%xmm1")                     // xmm1     = s2[0] s2[0] s2[1] s2[2]
+
+                // Update delay only by mask
+                __ASM_EMIT("addps       %%xmm7, %%xmm2")                            // xmm2     = p1 + d1
+                __ASM_EMIT("movaps      %[MASK], %%xmm0")                           // xmm0     = MASK
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")                            // xmm4     = MASK
+                __ASM_EMIT("movaps      %%xmm0, %%xmm5")                            // xmm5     = MASK
+                __ASM_EMIT("andps       %%xmm4, %%xmm2")                            // xmm2     = (p1 + d1) & MASK
+                __ASM_EMIT("andps       %%xmm5, %%xmm3")                            // xmm3     = p2 & MASK
+                __ASM_EMIT("andnps      %%xmm6, %%xmm4")                            // xmm4     = d0 & ~MASK
+                __ASM_EMIT("andnps      %%xmm7, %%xmm5")                            // xmm5     = d1 & ~MASK
+                __ASM_EMIT("orps        %%xmm2, %%xmm4")                            // xmm4     = (p1 + d1) & MASK | (d0 & ~MASK)
+                __ASM_EMIT("orps        %%xmm3, %%xmm5")                            // xmm5     = (p2 & MASK) | (d1 & ~MASK)
+                __ASM_EMIT("movaps      %%xmm4, %%xmm6")                            // xmm6     = d0 & ~MASK
+                __ASM_EMIT("movaps      %%xmm5, %%xmm7")                            // xmm7     = d1 & ~MASK
+
+                // Repeat loop
+                __ASM_EMIT32("decl      %[count]")
+                __ASM_EMIT64("dec       %[count]")
+                __ASM_EMIT("jz          4f")                                        // jump to completion
+                __ASM_EMIT("lea         0x01(,%[mask], 2), %[mask]")                // mask     = (mask << 1) | 1
+                __ASM_EMIT("shufps      $0x90, %%xmm0, %%xmm0")                     // xmm0     = m[0] m[0] m[1] m[2]
+                __ASM_EMIT("movaps      %%xmm0, %[MASK]")                           // store mask
+                __ASM_EMIT("cmp         $0x0f, %[mask]")
+                __ASM_EMIT("jne         1b")
+
+                // 4x filter processing without mask
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("3:")
+                DYN_LERP_X4_FILTER
+                __ASM_EMIT("movss       (%[src]), %%xmm0")                          // xmm0     = *src
+                __ASM_EMIT("add         $4, %[src]")                                // src      ++
+                __ASM_EMIT("movss       %%xmm0, %%xmm1")                            // xmm1     = s
+                __ASM_EMIT("movaps      %%xmm1, %%xmm2")                            // xmm2     = s
+                __ASM_EMIT("movaps      %%xmm1, %%xmm3")                            // xmm3     = s
+                __ASM_EMIT("mulps       0xc0(%[w]), %%xmm1")                        // xmm1     = s*a0
+                __ASM_EMIT("mulps       0xd0(%[w]), %%xmm2")                        // xmm2     = s*a1
+                __ASM_EMIT("addps       %%xmm6, %%xmm1")                            // xmm1     = s*a0+d0 = s2
+                __ASM_EMIT("mulps       0xe0(%[w]), %%xmm3")                        // xmm3     = s*a2
+                __ASM_EMIT("movaps      %%xmm1, %%xmm4")                            // xmm4     = s2
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")                            // xmm5     = s2
+                __ASM_EMIT("mulps       0xf0(%[w]), %%xmm4")                        // xmm4     = s2*b1
+                __ASM_EMIT("mulps       0x100(%[w]), %%xmm5")                       // xmm5     = s2*b2
+                __ASM_EMIT("addps       %%xmm4, %%xmm2")                            // xmm2     = s*a1 + s2*b1 = p1
+                __ASM_EMIT("addps       %%xmm5, %%xmm3")                            // xmm3     = s*a2 + s2*b2 = p2
+                __ASM_EMIT("addps       %%xmm7, %%xmm2")                            // xmm2     = p1 + d1
+                __ASM_EMIT("movaps      %%xmm3, %%xmm7")                            // xmm7     = p2
+                __ASM_EMIT("movaps      %%xmm2, %%xmm6")                            // xmm6     = p1 + d1
+
+                // Shift buffer and repeat loop
+                __ASM_EMIT("shufps      $0x93, %%xmm1, %%xmm1")                     // xmm1     = s2[3] s2[0] s2[1] s2[2]
+                __ASM_EMIT("movss       %%xmm1, (%[dst])")                          // *dst     = s2[3]
+                __ASM_EMIT("add         $4, %[dst]")                                // dst      ++
+                __ASM_EMIT32("decl      %[count]")
+                __ASM_EMIT64("dec       %[count]")
+                __ASM_EMIT("jnz         3b")
+
+                // Prepare last loop
+                __ASM_EMIT("4:")
+                __ASM_EMIT("movaps      %[MASK], %%xmm0")                           // xmm0     = m[0] m[1] m[2] m[3]
+                __ASM_EMIT("xorps       %%xmm2, %%xmm2")                            // xmm2     = 0 0 0 0
+                __ASM_EMIT("shl         $1, %[mask]")                               // mask     = mask << 1
+                __ASM_EMIT("shufps      $0x90, %%xmm0, %%xmm0")                     // xmm0     = m[0] m[0] m[1] m[2]
+                __ASM_EMIT("and         $0x0f, %[mask]")                            // mask     = (mask << 1) & 0x0f
+                __ASM_EMIT("movss       %%xmm2, %%xmm0")                            // xmm0     = 0 m[0] m[1] m[2]
+
+                // Process steps
+                __ASM_EMIT(".align 16")
+                __ASM_EMIT("5:")
+                DYN_LERP_X4_FILTER
+                __ASM_EMIT("movaps      %%xmm1, %%xmm2")                            // xmm2     = s
+                __ASM_EMIT("movaps      %%xmm1, %%xmm3")                            // xmm3     = s
+                __ASM_EMIT("mulps       0xc0(%[w]), %%xmm1")                        // xmm1     = s*a0
+                __ASM_EMIT("mulps       0xd0(%[w]), %%xmm2")                        // xmm2     = s*a1
+                __ASM_EMIT("addps       %%xmm6, %%xmm1")                            // xmm1     = s*a0+d0 = s2
+                __ASM_EMIT("mulps       0xe0(%[w]), %%xmm3")                        // xmm3     = s*a2
+                __ASM_EMIT("movaps      %%xmm1, %%xmm4")                            // xmm4     = s2
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")                            // xmm5     = s2
+                __ASM_EMIT("mulps       0xf0(%[w]), %%xmm4")                        // xmm4     = s2*b1
+                __ASM_EMIT("mulps       0x100(%[w]), %%xmm5")                       // xmm5     = s2*b2
+                __ASM_EMIT("addps       %%xmm4, %%xmm2")                            // xmm2     = s*a1 + s2*b1 = p1
+                __ASM_EMIT("addps       %%xmm5, %%xmm3")                            // xmm3     = s*a2 + s2*b2 = p2
+
+                // Shift buffer and store
+                __ASM_EMIT("test        $0x8, %[mask]")
+                __ASM_EMIT("shufps      $0x93, %%xmm1, %%xmm1")                     // xmm1     = s2[3] s2[0] s2[1] s2[2]
+                __ASM_EMIT("jz          7f")
+                __ASM_EMIT("movss       %%xmm1, (%[dst])")                          // *dst     = s2[3]
+                __ASM_EMIT("add         $4, %[dst]")                                // dst      ++
+                __ASM_EMIT("7:")
+
+                // Update delay only by mask
+                __ASM_EMIT("addps       %%xmm7, %%xmm2")                            // xmm2     = p1 + d1
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")                            // xmm4     = MASK
+                __ASM_EMIT("movaps      %%xmm0, %%xmm5")                            // xmm5     = MASK
+                __ASM_EMIT("andps       %%xmm4, %%xmm2")                            // xmm2     = (p1 + d1) & MASK
+                __ASM_EMIT("andps       %%xmm5, %%xmm3")                            // xmm3     = p2 & MASK
+                __ASM_EMIT("andnps      %%xmm6, %%xmm4")                            // xmm4     = d0 & ~MASK
+                __ASM_EMIT("andnps      %%xmm7, %%xmm5")                            // xmm5     = d1 & ~MASK
+                __ASM_EMIT("orps        %%xmm2, %%xmm4")                            // xmm4     = (p1 + d1) & MASK | (d0 & ~MASK)
+                __ASM_EMIT("orps        %%xmm3, %%xmm5")                            // xmm5     = (p2 & MASK) | (d1 & ~MASK)
+                __ASM_EMIT("movaps      %%xmm4, %%xmm6")                            // xmm6     = d0 & ~MASK
+                __ASM_EMIT("movaps      %%xmm5, %%xmm7")                            // xmm7     = d1 & ~MASK
+
+                // Repeat loop
+                __ASM_EMIT("xorps       %%xmm2, %%xmm2")                            // xmm2     = 0 0 0 0
+                __ASM_EMIT("shl         $1, %[mask]")                               // mask     = mask << 1
+                __ASM_EMIT("shufps      $0x90, %%xmm0, %%xmm0")                     // xmm0     = m[0] m[0] m[1] m[2]
+                __ASM_EMIT("and         $0x0f, %[mask]")                            // mask     = (mask << 1) & 0x0f
+                __ASM_EMIT("movss       %%xmm2, %%xmm0")                            // xmm0     = 0 m[0] m[1] m[2]
+                __ASM_EMIT("jnz         5b")                                        // check that mask is not zero
+
+                // Store delay buffer
+                __ASM_EMIT("movups      %%xmm6, 0x00(%[d])")                        // xmm6     = d0
+                __ASM_EMIT("movups      %%xmm7, 0x10(%[d])")                        // xmm7     = d1
+
+                // Exit label
+                __ASM_EMIT("8:")
+
+                : [dst] "+r" (dst), [src] "+r" (src),
+                  [mask] "=&r"(mask),
+                  [count] X86_PGREG (count)
+                : [d] "r" (d), [w] "r" (w),
+                  [X_MASK] "m" (dyn_biquad_const),
+                  [ONE] "m" (dyn_lerp_const),
+                  [MASK] "m" (MASK)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef DYN_LERP_X4_FILTER
+        #undef DYN_LERP_X4_ROW
+
+        /*
+         * The x8 bank is processed as two x4 banks one after another, the same way as
+         * dyn_biquad_process_x8 does, the memory of each x4 bank is gathered from d
+         */
+        static void dyn_lerp_process_x8(float *dst, const float *src, float *d, size_t count, float *w0, float *w1)
+        {
+            float dx[8] __lsp_aligned16;
+
+            for (size_t i=0; i<2; ++i)
+            {
+                float *dp   = &d[i*4];
+                for (size_t j=0; j<4; ++j)
+                {
+                    dx[j]       = dp[j];
+                    dx[j+4]     = dp[j+8];
+                }
+
+                dyn_lerp_process_x4(dst, src, dx, count, (i > 0) ? w1 : w0);
+
+                for (size_t j=0; j<4; ++j)
+                {
+                    dp[j]       = dx[j];
+                    dp[j+8]     = dx[j+4];
+                }
+
+                src         = dst;
+            }
+        }
+
+        void dyn_biquad_lerp_x1(float *dst, const float *src, float *d, size_t count,
+            const dsp::biquad_x1_t *f0, const dsp::biquad_x1_t *f1)
+        {
+            if (count <= 0)
+                return;
+
+            float w[0x18] __lsp_aligned16;
+            generic::dyn_lerp_biquad_init(w, &f0->b0, &f1->b0, 1, 1, count);
+            dyn_lerp_process_x1(dst, src, d, count, w);
+        }
+
+        void dyn_biquad_lerp_x2(float *dst, const float *src, float *d, size_t count,
+            const dsp::biquad_x2_t *f0, const dsp::biquad_x2_t *f1)
+        {
+            if (count <= 0)
+                return;
+
+            float w0[0x18] __lsp_aligned16;
+            float w1[0x18] __lsp_aligned16;
+            generic::dyn_lerp_biquad_init(w0, &f0->b0[0], &f1->b0[0], 1, 2, count);
+            generic::dyn_lerp_biquad_init(w1, &f0->b0[1], &f1->b0[1], 1, 2, count);
+            dyn_lerp_process_x2(dst, src, d, count, w0, w1);
+        }
+
+        void dyn_biquad_lerp_x4(float *dst, const float *src, float *d, size_t count,
+            const dsp::biquad_x4_t *f0, const dsp::biquad_x4_t *f1)
+        {
+            if (count <= 0)
+                return;
+
+            float w[0x4c] __lsp_aligned16;
+            generic::dyn_lerp_biquad_init(w, f0->b0, f1->b0, 4, 4, count);
+            dyn_lerp_process_x4(dst, src, d, count, w);
+        }
+
+        void dyn_biquad_lerp_x8(float *dst, const float *src, float *d, size_t count,
+            const dsp::biquad_x8_t *f0, const dsp::biquad_x8_t *f1)
+        {
+            if (count <= 0)
+                return;
+
+            float w0[0x4c] __lsp_aligned16;
+            float w1[0x4c] __lsp_aligned16;
+            generic::dyn_lerp_biquad_init(w0, &f0->b0[0], &f1->b0[0], 4, 8, count);
+            generic::dyn_lerp_biquad_init(w1, &f0->b0[4], &f1->b0[4], 4, 8, count);
+            dyn_lerp_process_x8(dst, src, d, count, w0, w1);
+        }
+
+        void dyn_cascade_lerp_x1(float *dst, const float *src, float *d, size_t count,
+            const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf)
+        {
+            if (count <= 0)
+                return;
+
+            float w[0x18] __lsp_aligned16;
+            generic::dyn_lerp_cascade_init(w, c0, c1, kf, 1, count);
+            dyn_lerp_process_x1(dst, src, d, count, w);
+        }
+
+        void dyn_cascade_lerp_x2(float *dst, const float *src, float *d, size_t count,
+            const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf)
+        {
+            if (count <= 0)
+                return;
+
+            float w0[0x18] __lsp_aligned16;
+            float w1[0x18] __lsp_aligned16;
+            generic::dyn_lerp_cascade_init(w0, &c0[0], &c1[0], kf, 1, count);
+            generic::dyn_lerp_cascade_init(w1, &c0[1], &c1[1], kf, 1, count);
+            dyn_lerp_process_x2(dst, src, d, count, w0, w1);
+        }
+
+        void dyn_cascade_lerp_x4(float *dst, const float *src, float *d, size_t count,
+            const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf)
+        {
+            if (count <= 0)
+                return;
+
+            float w[0x4c] __lsp_aligned16;
+            generic::dyn_lerp_cascade_init(w, c0, c1, kf, 4, count);
+            dyn_lerp_process_x4(dst, src, d, count, w);
+        }
+
+        void dyn_cascade_lerp_x8(float *dst, const float *src, float *d, size_t count,
+            const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf)
+        {
+            if (count <= 0)
+                return;
+
+            float w0[0x4c] __lsp_aligned16;
+            float w1[0x4c] __lsp_aligned16;
+            generic::dyn_lerp_cascade_init(w0, &c0[0], &c1[0], kf, 4, count);
+            generic::dyn_lerp_cascade_init(w1, &c0[4], &c1[4], kf, 4, count);
+            dyn_lerp_process_x8(dst, src, d, count, w0, w1);
+        }
     } /* namespace sse */
 } /* namespace lsp */
 
@@ -673,6 +673,179 @@ namespace lsp
                   "%xmm4", "%xmm5", "%xmm6", "%xmm7"
             );
         }
+
+        /*
+         * Transpose 4x4 matrix stored in registers A, B, C, D,
+         * the transposed matrix is stored in registers A, C, T0, T1
+         */
+        #define BIQUAD_MC_TRANSPOSE(A, B, C, D, T0, T1) \
+            __ASM_EMIT("movaps      " A ", " T0)                                /* T0   = a0 a1 a2 a3 */ \
+            __ASM_EMIT("movaps      " C ", " T1)                                /* T1   = c0 c1 c2 c3 */ \
+            __ASM_EMIT("unpcklps    " B ", " A)                                 /* A    = a0 b0 a1 b1 */ \
+            __ASM_EMIT("unpcklps    " D ", " C)                                 /* C    = c0 d0 c1 d1 */ \
+            __ASM_EMIT("unpckhps    " B ", " T0)                                /* T0   = a2 b2 a3 b3 */ \
+            __ASM_EMIT("unpckhps    " D ", " T1)                                /* T1   = c2 d2 c3 d3 */ \
+            __ASM_EMIT("movaps      " A ", " B)                                 /* B    = a0 b0 a1 b1 */ \
+            __ASM_EMIT("movaps      " T0 ", " D)                                /* D    = a2 b2 a3 b3 */ \
+            __ASM_EMIT("movlhps     " C ", " A)                                 /* A    = a0 b0 c0 d0 */ \
+            __ASM_EMIT("movhlps     " B ", " C)                                 /* C    = a1 b1 c1 d1 */ \
+            __ASM_EMIT("movlhps     " T1 ", " T0)                               /* T0   = a2 b2 c2 d2 */ \
+            __ASM_EMIT("movhlps     " D ", " T1)                                /* T1   = a3 b3 c3 d3 */
+
+        /*
+         * Apply four biquad filters to the sample of four channels stored in register X,
+         * xmm6 and xmm7 contain filter memory, the p register points to the cascade,
+         * T is the temporary register
+         */
+        #define BIQUAD_MC_FILTER(X, T) \
+            __ASM_EMIT("movaps      " X ", " T)                                 /* T    = s */ \
+            __ASM_EMIT("mulps       " LSP_DSP_BIQUAD_XN_SOFF " + 0x00(%[p]), " T)   /* T    = b0*s */ \
+            __ASM_EMIT("addps       %%xmm6, " T)                                /* T    = s2 = b0*s + d0 */ \
+            __ASM_EMIT("movaps      " X ", %%xmm6")                             /* xmm6 = s */ \
+            __ASM_EMIT("mulps       " LSP_DSP_BIQUAD_XN_SOFF " + 0x20(%[p]), %%xmm6")   /* xmm6 = b1*s */ \
+            __ASM_EMIT("mulps       " LSP_DSP_BIQUAD_XN_SOFF " + 0x40(%[p]), " X)   /* X    = b2*s */ \
+            __ASM_EMIT("addps       %%xmm7, %%xmm6")                            /* xmm6 = d1 + b1*s */ \
+            __ASM_EMIT("movaps      " T ", %%xmm7")                             /* xmm7 = s2 */ \
+            __ASM_EMIT("mulps       " LSP_DSP_BIQUAD_XN_SOFF " + 0x60(%[p]), %%xmm7")   /* xmm7 = a1*s2 */ \
+            __ASM_EMIT("addps       %%xmm7, %%xmm6")                            /* xmm6 = d0' = d1 + b1*s + a1*s2 */ \
+            __ASM_EMIT("movaps      " T ", %%xmm7")                             /* xmm7 = s2 */ \
+            __ASM_EMIT("mulps       " LSP_DSP_BIQUAD_XN_SOFF " + 0x80(%[p]), %%xmm7")   /* xmm7 = a2*s2 */ \
+            __ASM_EMIT("addps       " X ", %%xmm7")                             /* xmm7 = d1' = b2*s + a2*s2 */ \
+            __ASM_EMIT("movaps      " T ", " X)                                 /* X    = s2 */
+
+        /*
+         * Loop over cascades: the p register points to the current cascade, the filter
+         * memory of the cascade is loaded into xmm6 and xmm7 before processing the block
+         * of samples and stored back after it
+         */
+        #define BIQUAD_MC_CASCADE_BEGIN(L) \
+            __ASM_EMIT("mov         %[f], %[p]") \
+            __ASM_EMIT(L ":") \
+            __ASM_EMIT("movaps      0x00(%[p]), %%xmm6")                        /* xmm6 = d0 */ \
+            __ASM_EMIT("movaps      0x20(%[p]), %%xmm7")                        /* xmm7 = d1 */
+
+        #define BIQUAD_MC_CASCADE_END(L) \
+            __ASM_EMIT("movaps      %%xmm6, 0x00(%[p])") \
+            __ASM_EMIT("movaps      %%xmm7, 0x20(%[p])") \
+            __ASM_EMIT("add         %[FS], %[p]")                               /* p    = next cascade */ \
+            __ASM_EMIT("cmp         %[fe], %[p]") \
+            __ASM_EMIT("jb          " L "b")
+
+        #define BIQUAD_MC_PTR(idx)      __IF_32_64(#idx "*4", #idx "*8")
+
+        /*
+         * Process four channels by the array of x8 filter banks, the f pointer is shifted
+         * to the lane of the first bank that corresponds to the first channel, the fe
+         * pointer is shifted in the same way and points to the end of the array
+         */
+        static inline void biquad_process_mc4(float * const *dst, const float * const *src, size_t count, float *f, const float *fe)
+        {
+            IF_ARCH_X86(
+                size_t off;
+                const float *p;
+            );
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor         %[off], %[off]")
+
+                // 4x blocks: transpose samples, process by all cascades and transpose back
+                __ASM_EMIT32("subl        $4, %[count]")
+                __ASM_EMIT64("sub         $4, %[count]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(0) "(%[src]), %[p]")
+                __ASM_EMIT("movups      (%[p], %[off]), %%xmm0")                    // xmm0 = a0 a1 a2 a3
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(1) "(%[src]), %[p]")
+                __ASM_EMIT("movups      (%[p], %[off]), %%xmm1")                    // xmm1 = b0 b1 b2 b3
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(2) "(%[src]), %[p]")
+                __ASM_EMIT("movups      (%[p], %[off]), %%xmm2")                    // xmm2 = c0 c1 c2 c3
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(3) "(%[src]), %[p]")
+                __ASM_EMIT("movups      (%[p], %[off]), %%xmm3")                    // xmm3 = d0 d1 d2 d3
+                BIQUAD_MC_TRANSPOSE("%%xmm0", "%%xmm1", "%%xmm2", "%%xmm3", "%%xmm4", "%%xmm5")
+                BIQUAD_MC_CASCADE_BEGIN("5")
+                BIQUAD_MC_FILTER("%%xmm0", "%%xmm1")
+                BIQUAD_MC_FILTER("%%xmm2", "%%xmm1")
+                BIQUAD_MC_FILTER("%%xmm4", "%%xmm1")
+                BIQUAD_MC_FILTER("%%xmm5", "%%xmm1")
+                BIQUAD_MC_CASCADE_END("5")
+                BIQUAD_MC_TRANSPOSE("%%xmm0", "%%xmm2", "%%xmm4", "%%xmm5", "%%xmm1", "%%xmm3")
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(0) "(%[dst]), %[p]")
+                __ASM_EMIT("movups      %%xmm0, (%[p], %[off])")
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(1) "(%[dst]), %[p]")
+                __ASM_EMIT("movups      %%xmm4, (%[p], %[off])")
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(2) "(%[dst]), %[p]")
+                __ASM_EMIT("movups      %%xmm1, (%[p], %[off])")
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(3) "(%[dst]), %[p]")
+                __ASM_EMIT("movups      %%xmm3, (%[p], %[off])")
+                __ASM_EMIT("add         $0x10, %[off]")
+                __ASM_EMIT32("subl        $4, %[count]")
+                __ASM_EMIT64("sub         $4, %[count]")
+                __ASM_EMIT("jae         1b")
+
+                // 1x blocks
+                __ASM_EMIT("2:")
+                __ASM_EMIT32("addl        $4, %[count]")
+                __ASM_EMIT64("add         $4, %[count]")
+                __ASM_EMIT("jz          4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(0) "(%[src]), %[p]")
+                __ASM_EMIT("movss       (%[p], %[off]), %%xmm0")                    // xmm0 = a
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(1) "(%[src]), %[p]")
+                __ASM_EMIT("movss       (%[p], %[off]), %%xmm1")                    // xmm1 = b
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(2) "(%[src]), %[p]")
+                __ASM_EMIT("movss       (%[p], %[off]), %%xmm2")                    // xmm2 = c
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(3) "(%[src]), %[p]")
+                __ASM_EMIT("movss       (%[p], %[off]), %%xmm3")                    // xmm3 = d
+                __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                            // xmm0 = a b 0 0
+                __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                            // xmm2 = c d 0 0
+                __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                            // xmm0 = a b c d
+                BIQUAD_MC_CASCADE_BEGIN("6")
+                BIQUAD_MC_FILTER("%%xmm0", "%%xmm1")
+                BIQUAD_MC_CASCADE_END("6")
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(0) "(%[dst]), %[p]")
+                __ASM_EMIT("movss       %%xmm0, (%[p], %[off])")
+                __ASM_EMIT("shufps      $0x39, %%xmm0, %%xmm0")                     // xmm0 = b c d a
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(1) "(%[dst]), %[p]")
+                __ASM_EMIT("movss       %%xmm0, (%[p], %[off])")
+                __ASM_EMIT("shufps      $0x39, %%xmm0, %%xmm0")                     // xmm0 = c d a b
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(2) "(%[dst]), %[p]")
+                __ASM_EMIT("movss       %%xmm0, (%[p], %[off])")
+                __ASM_EMIT("shufps      $0x39, %%xmm0, %%xmm0")                     // xmm0 = d a b c
+                __ASM_EMIT("mov         " BIQUAD_MC_PTR(3) "(%[dst]), %[p]")
+                __ASM_EMIT("movss       %%xmm0, (%[p], %[off])")
+                __ASM_EMIT("add         $0x04, %[off]")
+                __ASM_EMIT32("decl        %[count]")
+                __ASM_EMIT64("dec         %[count]")
+                __ASM_EMIT("jnz         3b")
+                __ASM_EMIT("4:")
+
+                : [count] __ASM_ARG_RW(count),
+                  [off] "=&r" (off), [p] "=&r" (p)
+                : [dst] "r" (dst), [src] "r" (src),
+                  [f] "r" (f), [fe] "m" (fe),
+                  [FS] "i" (sizeof(dsp::biquad_t))
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc)
+        {
+            if (nc <= 0)
+                return;
+
+            // Channels are processed by groups of four, each channel in separate SIMD lane
+            biquad_process_mc4(&dst[0], &src[0], count, &f->d[0], &f[nc].d[0]);
+            biquad_process_mc4(&dst[4], &src[4], count, &f->d[4], &f[nc].d[4]);
+        }
+
+        #undef BIQUAD_MC_TRANSPOSE
+        #undef BIQUAD_MC_FILTER
+        #undef BIQUAD_MC_CASCADE_BEGIN
+        #undef BIQUAD_MC_CASCADE_END
+        #undef BIQUAD_MC_PTR
     }
 }
 
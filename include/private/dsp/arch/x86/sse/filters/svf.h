@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_FILTERS_SVF_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_FILTERS_SVF_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+#include <private/dsp/arch/generic/filters/lerp.h>
+
+namespace lsp
+{
+    namespace sse
+    {
+        IF_ARCH_X86(
+            static const float svf_const[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(1.0f)
+            };
+        );
+
+        /*
+         * Transpose 4x4 matrix stored in registers A, B, C, D,
+         * the transposed matrix is stored in registers A, C, T0, T1
+         */
+        #define SVF_MC_TRANSPOSE(A, B, C, D, T0, T1) \
+            __ASM_EMIT("movaps      " A ", " T0)                                /* T0   = a0 a1 a2 a3 */ \
+            __ASM_EMIT("movaps      " C ", " T1)                                /* T1   = c0 c1 c2 c3 */ \
+            __ASM_EMIT("unpcklps    " B ", " A)                                 /* A    = a0 b0 a1 b1 */ \
+            __ASM_EMIT("unpcklps    " D ", " C)                                 /* C    = c0 d0 c1 d1 */ \
+            __ASM_EMIT("unpckhps    " B ", " T0)                                /* T0   = a2 b2 a3 b3 */ \
+            __ASM_EMIT("unpckhps    " D ", " T1)                                /* T1   = c2 d2 c3 d3 */ \
+            __ASM_EMIT("movaps      " A ", " B)                                 /* B    = a0 b0 a1 b1 */ \
+            __ASM_EMIT("movaps      " T0 ", " D)                                /* D    = a2 b2 a3 b3 */ \
+            __ASM_EMIT("movlhps     " C ", " A)                                 /* A    = a0 b0 c0 d0 */ \
+            __ASM_EMIT("movhlps     " B ", " C)                                 /* C    = a1 b1 c1 d1 */ \
+            __ASM_EMIT("movlhps     " T1 ", " T0)                               /* T0   = a2 b2 c2 d2 */ \
+            __ASM_EMIT("movhlps     " D ", " T1)                                /* T1   = a3 b3 c3 d3 */
+
+        /*
+         * Apply four state-variable filters to the sample of four channels stored in register X,
+         * xmm6 and xmm7 contain filter memory ic1 and ic2, xmm1 and xmm3 are used as temporary,
+         * SZ is the distance between coefficients of the filter bank. After the processing the
+         * f pointer is moved to the filter bank for the next sample
+         */
+        #define SVF_MC_FILTER(X, SZ) \
+            __ASM_EMIT("movaps      0*" SZ "(%[f]), %%xmm1")                    /* xmm1 = g */ \
+            __ASM_EMIT("addps       1*" SZ "(%[f]), %%xmm1")                    /* xmm1 = g + k */ \
+            __ASM_EMIT("mulps       0*" SZ "(%[f]), %%xmm1")                    /* xmm1 = g*(g + k) */ \
+            __ASM_EMIT("movaps      %[ONE], %%xmm3")                            /* xmm3 = 1 */ \
+            __ASM_EMIT("addps       %%xmm3, %%xmm1")                            /* xmm1 = 1 + g*(g + k) */ \
+            __ASM_EMIT("divps       %%xmm1, %%xmm3")                            /* xmm3 = a = 1/(1 + g*(g + k)) */ \
+            __ASM_EMIT("movaps      " X ", %%xmm1")                             /* xmm1 = x */ \
+            __ASM_EMIT("subps       %%xmm7, %%xmm1")                            /* xmm1 = x - ic2 */ \
+            __ASM_EMIT("mulps       0*" SZ "(%[f]), %%xmm1")                    /* xmm1 = g*(x - ic2) */ \
+            __ASM_EMIT("addps       %%xmm6, %%xmm1")                            /* xmm1 = ic1 + g*(x - ic2) */ \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm1")                            /* xmm1 = v1 = a*(ic1 + g*(x - ic2)) */ \
+            __ASM_EMIT("mulps       2*" SZ "(%[f]), " X)                        /* X    = m0*x */ \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3")                            /* xmm3 = v1 */ \
+            __ASM_EMIT("mulps       3*" SZ "(%[f]), %%xmm3")                    /* xmm3 = m1*v1 */ \
+            __ASM_EMIT("addps       %%xmm3, " X)                                /* X    = m0*x + m1*v1 */ \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3")                            /* xmm3 = v1 */ \
+            __ASM_EMIT("addps       %%xmm1, %%xmm3")                            /* xmm3 = 2*v1 */ \
+            __ASM_EMIT("subps       %%xmm6, %%xmm3")                            /* xmm3 = 2*v1 - ic1 */ \
+            __ASM_EMIT("movaps      %%xmm3, %%xmm6")                            /* xmm6 = ic1' = 2*v1 - ic1 */ \
+            __ASM_EMIT("mulps       0*" SZ "(%[f]), %%xmm1")                    /* xmm1 = g*v1 */ \
+            __ASM_EMIT("addps       %%xmm7, %%xmm1")                            /* xmm1 = v2 = ic2 + g*v1 */ \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3")                            /* xmm3 = v2 */ \
+            __ASM_EMIT("mulps       4*" SZ "(%[f]), %%xmm3")                    /* xmm3 = m2*v2 */ \
+            __ASM_EMIT("addps       %%xmm3, " X)                                /* X    = y = m0*x + m1*v1 + m2*v2 */ \
+            __ASM_EMIT("addps       %%xmm1, %%xmm1")                            /* xmm1 = 2*v2 */ \
+            __ASM_EMIT("subps       %%xmm7, %%xmm1")                            /* xmm1 = 2*v2 - ic2 */ \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm7")                            /* xmm7 = ic2' = 2*v2 - ic2 */ \
+            __ASM_EMIT("add         $(5*" SZ "), %[f]")
+
+        #define SVF_MC_PTR(idx)         __IF_32_64(#idx "*4", #idx "*8")
+
+        /*
+         * Interpolated filters keep the state of interpolation (see generic/filters/lerp.h)
+         * in the work buffer W, the filter banks for the next samples are computed into the
+         * slots of the work buffer right before processing, work buffer layout:
+         *   0x000: base (g, k, m0, m1, m2)
+         *   0x050: step (g, k, m0, m1, m2)
+         *   0x0a0: index of the next sample
+         *   0x0b0: four slots of filter banks, 0x50 bytes each
+         */
+        #define SVF_LERP_SLOT(S) \
+            __ASM_EMIT("movaps      0x050(%[p]), %%xmm1") \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm1") \
+            __ASM_EMIT("addps       0x000(%[p]), %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm1, " S "+0x00(%[p])")               /* g    = g0 + dg*k */ \
+            __ASM_EMIT("movaps      0x060(%[p]), %%xmm1") \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm1") \
+            __ASM_EMIT("addps       0x010(%[p]), %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm1, " S "+0x10(%[p])")               /* k    = k0 + dk*k */ \
+            __ASM_EMIT("movaps      0x070(%[p]), %%xmm1") \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm1") \
+            __ASM_EMIT("addps       0x020(%[p]), %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm1, " S "+0x20(%[p])")               /* m0   = m00 + dm0*k */ \
+            __ASM_EMIT("movaps      0x080(%[p]), %%xmm1") \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm1") \
+            __ASM_EMIT("addps       0x030(%[p]), %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm1, " S "+0x30(%[p])")               /* m1   = m10 + dm1*k */ \
+            __ASM_EMIT("movaps      0x090(%[p]), %%xmm1") \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm1") \
+            __ASM_EMIT("addps       0x040(%[p]), %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm1, " S "+0x40(%[p])")               /* m2   = m20 + dm2*k */ \
+            __ASM_EMIT("addps       %[ONE], %%xmm0")                        /* k    = k + 1 */
+
+        #define SVF_LERP_GEN4 \
+            __ASM_EMIT("mov         %[w], %[p]") \
+            __ASM_EMIT("movaps      0x0a0(%[p]), %%xmm0")                   /* xmm0 = k */ \
+            SVF_LERP_SLOT("0x0b0") \
+            SVF_LERP_SLOT("0x100") \
+            SVF_LERP_SLOT("0x150") \
+            SVF_LERP_SLOT("0x1a0") \
+            __ASM_EMIT("movaps      %%xmm0, 0x0a0(%[p])") \
+            __ASM_EMIT("lea         0x0b0(%[p]), %[f]")
+
+        #define SVF_LERP_GEN1 \
+            __ASM_EMIT("mov         %[w], %[p]") \
+            __ASM_EMIT("movaps      0x0a0(%[p]), %%xmm0")                   /* xmm0 = k */ \
+            SVF_LERP_SLOT("0x0b0") \
+            __ASM_EMIT("movaps      %%xmm0, 0x0a0(%[p])") \
+            __ASM_EMIT("lea         0x0b0(%[p]), %[f]")
+
+        #define SVF_PROCESS_GEN
+
+        /*
+         * Process four channels by the state-variable filter banks, SZ is the distance
+         * between coefficients of the filter bank and between the ic1 and ic2 filter memory,
+         * GEN4 and GEN1 compute filter banks for the next four samples and for the next sample,
+         * W is the work buffer of interpolated filters
+         */
+        #define SVF_MC4_PROCESS(SZ, GEN4, GEN1, W) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("mov         %[d], %[p]") \
+                __ASM_EMIT("movups      0x00(%[p]), %%xmm6")                    /* xmm6 = ic1 */ \
+                __ASM_EMIT("movups      " SZ "(%[p]), %%xmm7")                  /* xmm7 = ic2 */ \
+                __ASM_EMIT("xor         %[off], %[off]") \
+                \
+                /* 4x blocks: transpose samples, process and transpose back */ \
+                __ASM_EMIT32("subl        $4, %[count]") \
+                __ASM_EMIT64("sub         $4, %[count]") \
+                __ASM_EMIT("jb          2f") \
+                __ASM_EMIT("1:") \
+                GEN4 \
+                __ASM_EMIT("mov         " SVF_MC_PTR(0) "(%[src]), %[p]") \
+                __ASM_EMIT("movups      (%[p], %[off]), %%xmm0")                /* xmm0 = a0 a1 a2 a3 */ \
+                __ASM_EMIT("mov         " SVF_MC_PTR(1) "(%[src]), %[p]") \
+                __ASM_EMIT("movups      (%[p], %[off]), %%xmm1")                /* xmm1 = b0 b1 b2 b3 */ \
+                __ASM_EMIT("mov         " SVF_MC_PTR(2) "(%[src]), %[p]") \
+                __ASM_EMIT("movups      (%[p], %[off]), %%xmm2")                /* xmm2 = c0 c1 c2 c3 */ \
+                __ASM_EMIT("mov         " SVF_MC_PTR(3) "(%[src]), %[p]") \
+                __ASM_EMIT("movups      (%[p], %[off]), %%xmm3")                /* xmm3 = d0 d1 d2 d3 */ \
+                SVF_MC_TRANSPOSE("%%xmm0", "%%xmm1", "%%xmm2", "%%xmm3", "%%xmm4", "%%xmm5") \
+                SVF_MC_FILTER("%%xmm0", SZ) \
+                SVF_MC_FILTER("%%xmm2", SZ) \
+                SVF_MC_FILTER("%%xmm4", SZ) \
+                SVF_MC_FILTER("%%xmm5", SZ) \
+                SVF_MC_TRANSPOSE("%%xmm0", "%%xmm2", "%%xmm4", "%%xmm5", "%%xmm1", "%%xmm3") \
+                __ASM_EMIT("mov         " SVF_MC_PTR(0) "(%[dst]), %[p]") \
+                __ASM_EMIT("movups      %%xmm0, (%[p], %[off])") \
+                __ASM_EMIT("mov         " SVF_MC_PTR(1) "(%[dst]), %[p]") \
+                __ASM_EMIT("movups      %%xmm4, (%[p], %[off])") \
+                __ASM_EMIT("mov         " SVF_MC_PTR(2) "(%[dst]), %[p]") \
+                __ASM_EMIT("movups      %%xmm1, (%[p], %[off])") \
+                __ASM_EMIT("mov         " SVF_MC_PTR(3) "(%[dst]), %[p]") \
+                __ASM_EMIT("movups      %%xmm3, (%[p], %[off])") \
+                __ASM_EMIT("add         $0x10, %[off]") \
+                __ASM_EMIT32("subl        $4, %[count]") \
+                __ASM_EMIT64("sub         $4, %[count]") \
+                __ASM_EMIT("jae         1b") \
+                \
+                /* 1x blocks */ \
+                __ASM_EMIT("2:") \
+                __ASM_EMIT32("addl        $4, %[count]") \
+                __ASM_EMIT64("add         $4, %[count]") \
+                __ASM_EMIT("jz          4f") \
+                __ASM_EMIT("3:") \
+                GEN1 \
+                __ASM_EMIT("mov         " SVF_MC_PTR(0) "(%[src]), %[p]") \
+                __ASM_EMIT("movss       (%[p], %[off]), %%xmm0")                /* xmm0 = a */ \
+                __ASM_EMIT("mov         " SVF_MC_PTR(1) "(%[src]), %[p]") \
+                __ASM_EMIT("movss       (%[p], %[off]), %%xmm1")                /* xmm1 = b */ \
+                __ASM_EMIT("mov         " SVF_MC_PTR(2) "(%[src]), %[p]") \
+                __ASM_EMIT("movss       (%[p], %[off]), %%xmm2")                /* xmm2 = c */ \
+                __ASM_EMIT("mov         " SVF_MC_PTR(3) "(%[src]), %[p]") \
+                __ASM_EMIT("movss       (%[p], %[off]), %%xmm3")                /* xmm3 = d */ \
+                __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                        /* xmm0 = a b 0 0 */ \
+                __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                        /* xmm2 = c d 0 0 */ \
+                __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                        /* xmm0 = a b c d */ \
+                SVF_MC_FILTER("%%xmm0", SZ) \
+                __ASM_EMIT("mov         " SVF_MC_PTR(0) "(%[dst]), %[p]") \
+                __ASM_EMIT("movss       %%xmm0, (%[p], %[off])") \
+                __ASM_EMIT("shufps      $0x39, %%xmm0, %%xmm0")                 /* xmm0 = b c d a */ \
+                __ASM_EMIT("mov         " SVF_MC_PTR(1) "(%[dst]), %[p]") \
+                __ASM_EMIT("movss       %%xmm0, (%[p], %[off])") \
+                __ASM_EMIT("shufps      $0x39, %%xmm0, %%xmm0")                 /* xmm0 = c d a b */ \
+                __ASM_EMIT("mov         " SVF_MC_PTR(2) "(%[dst]), %[p]") \
+                __ASM_EMIT("movss       %%xmm0, (%[p], %[off])") \
+                __ASM_EMIT("shufps      $0x39, %%xmm0, %%xmm0")                 /* xmm0 = d a b c */ \
+                __ASM_EMIT("mov         " SVF_MC_PTR(3) "(%[dst]), %[p]") \
+                __ASM_EMIT("movss       %%xmm0, (%[p], %[off])") \
+                __ASM_EMIT("add         $0x04, %[off]") \
+                __ASM_EMIT32("decl        %[count]") \
+                __ASM_EMIT64("dec         %[count]") \
+                __ASM_EMIT("jnz         3b") \
+                \
+                /* Store the updated filter memory */ \
+                __ASM_EMIT("4:") \
+                __ASM_EMIT("mov         %[d], %[p]") \
+                __ASM_EMIT("movups      %%xmm6, 0x00(%[p])") \
+                __ASM_EMIT("movups      %%xmm7, " SZ "(%[p])") \
+                \
+                : [count] __ASM_ARG_RW(count), [f] "+r" (f), \
+                  [off] "=&r" (off), [p] "=&r" (p) \
+                : [dst] "r" (dst), [src] "r" (src), \
+                  [d] "m" (d), [w] "m" (W), \
+                  [ONE] "m" (svf_const) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        /*
+         * Process four channels by the half of the x8 filter bank, the f pointer is shifted
+         * to the first filter that corresponds to the first channel, the d pointer is shifted
+         * to the ic1 memory of the first channel
+         */
+        static inline void svf_process_mc4_x8(float * const *dst, const float * const *src, float *d, size_t count, const float *f)
+        {
+            IF_ARCH_X86(
+                size_t off;
+                const float *p;
+            );
+
+            SVF_MC4_PROCESS("0x20", SVF_PROCESS_GEN, SVF_PROCESS_GEN, f);
+        }
+
+        void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f)
+        {
+            IF_ARCH_X86(
+                size_t off;
+                const float *p;
+            );
+
+            SVF_MC4_PROCESS("0x10", SVF_PROCESS_GEN, SVF_PROCESS_GEN, f);
+        }
+
+        void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f)
+        {
+            // Channels are processed by groups of four, each channel in separate SIMD lane
+            svf_process_mc4_x8(&dst[0], &src[0], &d[0], count, &f->g[0]);
+            svf_process_mc4_x8(&dst[4], &src[4], &d[4], count, &f->g[4]);
+        }
+
+        /*
+         * Process four channels by the interpolated filter bank, the work buffer
+         * should contain the interpolation state of four lanes
+         */
+        static inline void svf_lerp_mc4(float * const *dst, const float * const *src, float *d, size_t count, float *w)
+        {
+            IF_ARCH_X86(
+                size_t off;
+                const float *p;
+                const float *f = w;
+            );
+
+            w[0x28]     = 0.0f;
+            w[0x29]     = 0.0f;
+            w[0x2a]     = 0.0f;
+            w[0x2b]     = 0.0f;
+
+            SVF_MC4_PROCESS("0x10", SVF_LERP_GEN4, SVF_LERP_GEN1, w);
+        }
+
+        void svf_lerp_x4(float * const *dst, const float * const *src, float *d, size_t count,
+            const dsp::svf_x4_t *f0, const dsp::svf_x4_t *f1)
+        {
+            if (count <= 0)
+                return;
+
+            float w[0x7c] __lsp_aligned16;
+            generic::svf_lerp_init(w, f0->g, f1->g, 4, 4, count);
+            svf_lerp_mc4(dst, src, d, count, w);
+        }
+
+        void svf_lerp_x8(float * const *dst, const float * const *src, float *d, size_t count,
+            const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1)
+        {
+            if (count <= 0)
+                return;
+
+            // Channels are processed by groups of four, each channel in separate SIMD lane,
+            // the filter memory of the group is gathered to keep ic1 and ic2 rows adjacent
+            float w[0x7c] __lsp_aligned16;
+            float dx[8];
+
+            for (size_t i=0; i<8; i += 4)
+            {
+                for (size_t j=0; j<4; ++j)
+                {
+                    dx[j]       = d[i + j];
+                    dx[j + 4]   = d[i + j + 8];
+                }
+
+                generic::svf_lerp_init(w, &f0->g[i], &f1->g[i], 4, 8, count);
+                svf_lerp_mc4(&dst[i], &src[i], dx, count, w);
+
+                for (size_t j=0; j<4; ++j)
+                {
+                    d[i + j]    = dx[j];
+                    d[i + j + 8]= dx[j + 4];
+                }
+            }
+        }
+
+        #undef SVF_MC_TRANSPOSE
+        #undef SVF_MC_FILTER
+        #undef SVF_MC_PTR
+        #undef SVF_MC4_PROCESS
+        #undef SVF_PROCESS_GEN
+        #undef SVF_LERP_GEN1
+        #undef SVF_LERP_GEN4
+        #undef SVF_LERP_SLOT
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_FILTERS_SVF_H_ */
@@ -144,8 +144,7 @@ namespace lsp
         IF_ARCH_X86(
             static const uint32_t f_transform_const[] __lsp_aligned16 =
             {
-                LSP_DSP_VEC4(0x3f800000),   // 1.0
-                LSP_DSP_VEC4(0x80000000)    // signbit
+                LSP_DSP_VEC4(0x3f800000)    // 1.0
             };
         );
 
@@ -608,369 +607,6 @@ namespace lsp
         #undef FIL_BILINEAR_X4_TOP
         #undef FIL_BILINEAR_X4_BOTTOM
         #undef FIL_TRANSPOSE
-
-
-        static void matched_solve(float *p, float kf, float td, size_t count, size_t stride)
-        {
-            if (p[2] == 0.0) // Test polynom for second-order
-            {
-                if (p[1] == 0.0) // Test polynom for first order
-                {
-                    while (count--)
-                    {
-                        p[3]        = 1; // transfer function
-                        p          += stride;
-                    }
-                }
-                else
-                {
-                    // First-order polynom:
-                    //   p(s) = p[0] + p[1]*(s/f)
-                    //
-                    // Transformed polynom:
-                    //   P[z] = p[1]/f - p[1]/f * exp(-f*p[0]*T/p[1]) * z^-1
-                    while (count--)
-                    {
-                        float k     = p[1]/kf;
-                        float R     = -p[0]/k;
-                        p[3]        = sqrtf(p[0]*p[0] + p[1]*p[1]*0.01f); // transfer function
-                        p[0]        = k;
-                        p[1]        = -k * expf(R*td);
-
-                        p          += stride;
-                    }
-                }
-            }
-            else
-            {
-                // Second-order polynom:
-                //   p(s) = p[0] + p[1]*(s/f) + p[2]*(s/f)^2 = p[2]/f^2 * (p[0]*f^2/p[2] + p[1]*f/p[2]*s + s^2)
-                //
-                // Calculate the roots of the second-order polynom equation a*x^2 + b*x + c = 0
-                float k, b, c, D;
-                float a2   = 2.0f/(kf*kf);
-
-                while (count--)
-                {
-                    // Transfer function
-                    b           = p[0] - p[2]*0.01f;
-                    c           = p[1]*0.1f;
-                    p[3]        = sqrt(b*b + c*c);
-
-                    // Calculate parameters
-                    k           = p[2];
-                    b           = p[1]/(kf*p[2]);
-                    c           = p[0]/p[2];
-                    D           = b*b - 2.0f*a2*c;
-
-                    if (D >= 0.0f)
-                    {
-                        // Has real roots R0 and R1
-                        // Transformed form is:
-                        //   P[z] = k*(1 - (exp(R0*T) + exp(R1*T))*z^-1 + exp((R0+R1)*T)*z^-2)
-                        D           = sqrtf(D);
-                        float R0    = td*(-b - D)/a2;
-                        float R1    = td*(-b + D)/a2;
-                        p[0]        = k;
-                        p[1]        = -k * (expf(R0) + expf(R1));
-                        p[2]        = k * expf(R0+R1);
-                    }
-                    else
-                    {
-                        // Has complex roots R+j*K and R-j*K
-                        // Transformed form is:
-                        //   P[z] = k*(1 - 2*exp(R*T)*cos(K*T)*z^-1 + exp(2*R*T)*z^-2)
-                        D           = sqrtf(-D);
-                        float R     = -(td*b) /a2;
-                        float K     = D /a2;
-                        p[0]        = k;
-                        p[1]        = -2.0 * k * expf(R) * cosf(K*td);
-                        p[2]        = k * expf(R+R);
-                    }
-
-                    // Update pointer
-                    p          += stride;
-                }
-            }
-        }
-
-        void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
-        {
-            // Find roots for top and bottom polynoms
-            matched_solve(bc->t, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
-            matched_solve(bc->b, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
-
-            double w        = kf * td * 0.1;
-            float cos_w     = cos(w);
-            float sin_w     = sin(w);
-        //    float cos_2w    = cos_w*cos_w - sin_w*sin_w; // cos(2x) = cos(x)^2 - sin(x)^2
-        //    float sin_2w    = 2*sin_w*cos_w; // sin(2x) = 2 * cos(x) * sin(x)
-
-            float COSW[4]  __lsp_aligned16;
-            float SINW[4]  __lsp_aligned16;
-            float COS2W[4] __lsp_aligned16;
-            float SIN2W[4] __lsp_aligned16;
-
-            float x2, x3, x4, x5, x6, x7;
-
-            ARCH_X86_ASM
-            (
-                // Prepare
-                // Calculate COSW, SINW, COS2W, SIN2W
-                __ASM_EMIT("shufps      $0x00, %[x0], %[x0]")   // x0 = cos_w
-                __ASM_EMIT("shufps      $0x00, %[x1], %[x1]")   // x1 = sin_w
-                __ASM_EMIT("movaps      %[x0], %[COSW]")
-                __ASM_EMIT("movaps      %[x1], %[SINW]")
-                __ASM_EMIT("movaps      %[x0], %[x2]")          // x2 = cos_w
-                __ASM_EMIT("mulps       %[x1], %[x2]")          // x2 = cos_w*sin_w
-                __ASM_EMIT("mulps       %[x0], %[x0]")          // x0 = cos_w*cos_w
-                __ASM_EMIT("mulps       %[x1], %[x1]")          // x1 = sin_w*sin_w
-                __ASM_EMIT("addps       %[x2], %[x2]")          // x2 = sin_2w = 2*cos_w*sin_w
-                __ASM_EMIT("subps       %[x1], %[x0]")          // x0 = cos_2s = cos_w*cos_w - sin_w*sin_w
-                __ASM_EMIT("movaps      %[x0], %[COS2W]")
-                __ASM_EMIT("movaps      %[x2], %[SIN2W]")
-
-                // Check block size
-                __ASM_EMIT("sub         $4, %[count]")
-                __ASM_EMIT("jb          2f")
-
-                // Load top part
-                __ASM_EMIT("1:")
-                __ASM_EMIT("movaps      0x00(%[bc]), %[x0]")    // x0 = t0[0] t0[1] t0[2] t0[3]
-                __ASM_EMIT("movaps      0x20(%[bc]), %[x1]")    // x1 = t1[0] t1[1] t1[2] t1[3]
-                __ASM_EMIT("movaps      0x40(%[bc]), %[x2]")    // x2 = t2[0] t2[1] t2[2] t2[3]
-                __ASM_EMIT("movaps      0x60(%[bc]), %[x3]")    // x3 = t3[0] t3[1] t3[2] t3[3]
-
-                // Transpose top part
-                __ASM_EMIT("movaps      %[x0], %[x4]")          // x4 = t0[0] t0[1] t0[2] t0[3]
-                __ASM_EMIT("movaps      %[x2], %[x5]")          // x5 = t2[0] t2[1] t2[2] t2[3]
-                __ASM_EMIT("unpcklps    %[x1], %[x0]")          // x0 = t0[0] t1[0] t0[1] t1[1]
-                __ASM_EMIT("unpcklps    %[x3], %[x2]")          // x2 = t2[0] t3[0] t2[1] t3[1]
-                __ASM_EMIT("unpckhps    %[x1], %[x4]")          // x4 = t0[2] t1[2] t0[3] t1[3]
-                __ASM_EMIT("unpckhps    %[x3], %[x5]")          // x5 = t2[2] t3[2] t2[3] t3[3]
-                __ASM_EMIT("movaps      %[x0], %[x1]")          // x1 = t0[0] t1[0] t0[1] t1[1]
-                __ASM_EMIT("movaps      %[x4], %[x3]")          // x3 = t0[2] t1[2] t0[3] t1[3]
-                __ASM_EMIT("movlhps     %[x2], %[x0]")          // x0 = t0[0] t1[0] t2[0] t3[0]
-                __ASM_EMIT("movhlps     %[x1], %[x2]")          // x2 = t0[1] t1[1] t2[1] t3[1]
-                __ASM_EMIT("movlhps     %[x5], %[x4]")          // x4 = t0[2] t1[2] t2[2] t3[2]
-                __ASM_EMIT("movhlps     %[x3], %[x5]")          // x5 = t0[3] t1[3] t2[3] t3[3]
-
-                // x0 = t[0], x2 = t[1], x4 = t[2], x5 = t[3]
-                __ASM_EMIT("movaps      %[x0], 0x00(%[bf])")
-                __ASM_EMIT("movaps      %[x2], 0x20(%[bf])")
-                __ASM_EMIT("movaps      %[x4], 0x40(%[bf])")
-
-                __ASM_EMIT("movaps      %[x0], %[x1]")          // x1 = t[0]
-                __ASM_EMIT("movaps      %[x2], %[x3]")          // x3 = t[1]
-                __ASM_EMIT("mulps       %[COS2W], %[x1]")       // x1 = t[0]*cos_2w
-                __ASM_EMIT("mulps       %[SIN2W], %[x0]")       // x0 = t[0]*sin_2w
-                __ASM_EMIT("mulps       %[COSW], %[x3]")        // x3 = t[1]*cos_w
-                __ASM_EMIT("mulps       %[SINW], %[x2]")        // x2 = t[1]*sin_w
-                __ASM_EMIT("addps       %[x1], %[x4]")          // x4 = t[0]*cos_2w + t[2]
-                __ASM_EMIT("addps       %[x0], %[x2]")          // x2 = im = t[0]*sin_2w + t[1]*sin_w
-                __ASM_EMIT("addps       %[x3], %[x4]")          // x4 = re = t[0]*cos_2w + t[1]*cos_w + t[2]
-                __ASM_EMIT("mulps       %[x2], %[x2]")          // x2 = im*im
-                __ASM_EMIT("mulps       %[x4], %[x4]")          // x4 = re*re
-                __ASM_EMIT("addps       %[x2], %[x4]")          // x4 = re*re + im*im
-                __ASM_EMIT("movaps      %[x5], %[x7]")          // x7 = t[3]
-                __ASM_EMIT("sqrtps      %[x4], %[x6]")          // x6 = at = sqrt(re*re + im*im)
-
-                // Load bottom part
-                __ASM_EMIT("movaps      0x10(%[bc]), %[x0]")    // x0 = t0[0] t0[1] t0[2] t0[3]
-                __ASM_EMIT("movaps      0x30(%[bc]), %[x1]")    // x1 = t1[0] t1[1] t1[2] t1[3]
-                __ASM_EMIT("movaps      0x50(%[bc]), %[x2]")    // x2 = t2[0] t2[1] t2[2] t2[3]
-                __ASM_EMIT("movaps      0x70(%[bc]), %[x3]")    // x3 = t3[0] t3[1] t3[2] t3[3]
-
-                // Transpose bottom part
-                __ASM_EMIT("movaps      %[x0], %[x4]")          // x4 = t0[0] t0[1] t0[2] t0[3]
-                __ASM_EMIT("movaps      %[x2], %[x5]")          // x5 = t2[0] t2[1] t2[2] t2[3]
-                __ASM_EMIT("unpcklps    %[x1], %[x0]")          // x0 = t0[0] t1[0] t0[1] t1[1]
-                __ASM_EMIT("unpcklps    %[x3], %[x2]")          // x2 = t2[0] t3[0] t2[1] t3[1]
-                __ASM_EMIT("unpckhps    %[x1], %[x4]")          // x4 = t0[2] t1[2] t0[3] t1[3]
-                __ASM_EMIT("unpckhps    %[x3], %[x5]")          // x5 = t2[2] t3[2] t2[3] t3[3]
-                __ASM_EMIT("movaps      %[x0], %[x1]")          // x1 = t0[0] t1[0] t0[1] t1[1]
-                __ASM_EMIT("movaps      %[x4], %[x3]")          // x3 = t0[2] t1[2] t0[3] t1[3]
-                __ASM_EMIT("movlhps     %[x2], %[x0]")          // x0 = t0[0] t1[0] t2[0] t3[0]
-                __ASM_EMIT("movhlps     %[x1], %[x2]")          // x2 = t0[1] t1[1] t2[1] t3[1]
-                __ASM_EMIT("movlhps     %[x5], %[x4]")          // x4 = t0[2] t1[2] t2[2] t3[2]
-                __ASM_EMIT("movhlps     %[x3], %[x5]")          // x5 = t0[3] t1[3] t2[3] t3[3]
-
-                // x0 = b[0], x2 = b[1], x4 = b[2], x5 = b[3]
-                __ASM_EMIT("movaps      %[x2], 0x10(%[bf])")
-                __ASM_EMIT("movaps      %[x4], 0x30(%[bf])")
-
-                __ASM_EMIT("mulps       %[x5], %[x6]")          // x6 = at * b[3]
-                __ASM_EMIT("movaps      %[x0], %[x1]")          // x1 = b[0]
-                __ASM_EMIT("movaps      %[x2], %[x3]")          // x3 = b[1]
-                __ASM_EMIT("movaps      %[x0], %[x5]")          // x5 = b[0]
-                __ASM_EMIT("mulps       %[COS2W], %[x1]")       // x1 = b[0]*cos_2w
-                __ASM_EMIT("mulps       %[SIN2W], %[x0]")       // x0 = b[0]*sin_2w
-                __ASM_EMIT("mulps       %[COSW], %[x3]")        // x3 = b[1]*cos_w
-                __ASM_EMIT("mulps       %[SINW], %[x2]")        // x2 = b[1]*sin_w
-                __ASM_EMIT("addps       %[x1], %[x4]")          // x4 = b[0]*cos_2w + b[2]
-                __ASM_EMIT("addps       %[x0], %[x2]")          // x2 = im = b[0]*sin_2w + b[1]*sin_w
-                __ASM_EMIT("addps       %[x3], %[x4]")          // x4 = re = b[0]*cos_2w + b[1]*cos_w + b[2]
-                __ASM_EMIT("mulps       %[x2], %[x2]")          // x2 = im*im
-                __ASM_EMIT("mulps       %[x4], %[x4]")          // x4 = re*re
-                __ASM_EMIT("movaps      0x00(%[CC]), %[x0]")    // x0 = 1
-                __ASM_EMIT("addps       %[x2], %[x4]")          // x4 = re*re + im*im
-                __ASM_EMIT("divps       %[x5], %[x0]")          // x0 = N2 = 1/b[0]
-                __ASM_EMIT("sqrtps      %[x4], %[x1]")          // x1 = ab = sqrt(re*re + im*im)
-                __ASM_EMIT("mulps       %[x7], %[x1]")          // x1 = ab * t[3]
-                __ASM_EMIT("divps       %[x6], %[x1]")          // x1 = AN = (ab * t[3]) / (at * b[3])
-                __ASM_EMIT("mulps       %[x0], %[x1]")          // x1 = N1 = AN * N2
-
-                // Update filters
-                // Top part
-                __ASM_EMIT("movaps      0x00(%[bf]), %[x2]")    // x2 = t[0]
-                __ASM_EMIT("movaps      0x20(%[bf]), %[x3]")    // x3 = t[1]
-                __ASM_EMIT("movaps      0x40(%[bf]), %[x4]")    // x4 = t[2]
-
-                __ASM_EMIT("mulps       %[x1], %[x2]")          // x2 = t[0] * N1 = a0[0] a0[1] a0[2] a0[3]
-                __ASM_EMIT("mulps       %[x1], %[x3]")          // x3 = t[1] * N1 = a1[0] a1[1] a1[2] a1[3]
-                __ASM_EMIT("movaps      %[x2], %[x5]")          // x5 = a0[0] a0[1] a0[2] a0[3]
-                __ASM_EMIT("mulps       %[x1], %[x4]")          // x4 = t[2] * N1 = a2[0] a2[1] a2[2] a2[3]
-                __ASM_EMIT("movaps      %[x2], %[x6]")          // x6 = a0[0] a0[1] a0[2] a0[3]
-                __ASM_EMIT("movaps      %[x3], %[x1]")          // x1 = a1[0] a1[1] a1[2] a1[3]
-                __ASM_EMIT("unpcklps    %[x4], %[x3]")          // x3 = a1[0] a2[0] a1[1] a2[1]
-                __ASM_EMIT("movaps      %[x2], %[x7]")          // x7 = a0[0] a0[1] a0[2] a0[3]
-                __ASM_EMIT("unpckhps    %[x4], %[x1]")          // x1 = a1[2] a2[2] a1[3] a2[3]
-                __ASM_EMIT("shufps      $0x40, %[x3], %[x2]")   // x2 = a0[0] a0[0] a1[0] a2[0]
-                __ASM_EMIT("shufps      $0x4a, %[x1], %[x5]")   // x5 = a0[2] a0[2] a1[2] a2[2]
-                __ASM_EMIT("shufps      $0xe5, %[x3], %[x6]")   // x6 = a0[1] a0[1] a1[1] a2[1]
-                __ASM_EMIT("shufps      $0xef, %[x1], %[x7]")   // x7 = a0[3] a0[3] a1[3] a2[3]
-
-                __ASM_EMIT("movaps      %[x2], 0x00(%[bf])")
-                __ASM_EMIT("movaps      %[x6], 0x20(%[bf])")
-                __ASM_EMIT("movaps      %[x5], 0x40(%[bf])")
-                __ASM_EMIT("movaps      %[x7], 0x60(%[bf])")
-
-                // Bottom part
-                __ASM_EMIT("xorps       0x10(%[CC]), %[x0]")    // x0 = -N2
-                __ASM_EMIT("movaps      0x10(%[bf]), %[x2]")    // x2 = b[1]
-                __ASM_EMIT("movaps      0x30(%[bf]), %[x3]")    // x3 = b[2]
-
-                __ASM_EMIT("mulps       %[x0], %[x2]")          // x2 = b[1] * N2 = b1[0] b1[1] b1[2] b1[3]
-                __ASM_EMIT("xorps       %[x4], %[x4]")          // x4 = 0 0 0 0
-                __ASM_EMIT("mulps       %[x0], %[x3]")          // x3 = b[2] * N2 = b2[0] b2[1] b2[2] b2[3]
-                __ASM_EMIT("movaps      %[x2], %[x1]")          // x1 = b1[0] b1[1] b1[2] b1[3]
-                __ASM_EMIT("xorps       %[x5], %[x5]")          // x5 = 0 0 0 0
-                __ASM_EMIT("unpcklps    %[x3], %[x2]")          // x2 = b1[0] b2[0] b1[1] b2[1]
-                __ASM_EMIT("unpckhps    %[x3], %[x1]")          // x1 = b1[2] b2[2] b1[3] b2[3]
-                __ASM_EMIT("movhlps     %[x2], %[x4]")          // x4 = b1[1] b2[1] 0 0
-                __ASM_EMIT("movhlps     %[x1], %[x5]")          // x5 = b1[3] b2[3] 0 0
-                __ASM_EMIT("shufps      $0xf4, %[x4], %[x2]")   // x2 = b1[0] b2[0] 0 0
-                __ASM_EMIT("shufps      $0xf4, %[x5], %[x1]")   // x1 = b1[2] b2[2] 0 0
-
-                __ASM_EMIT("movaps      %[x2], 0x10(%[bf])")
-                __ASM_EMIT("movaps      %[x4], 0x30(%[bf])")
-                __ASM_EMIT("movaps      %[x1], 0x50(%[bf])")
-                __ASM_EMIT("movaps      %[x5], 0x70(%[bf])")
-
-                // Repeat loop
-                __ASM_EMIT("add         $0x80, %[bc]")
-                __ASM_EMIT("add         $0x80, %[bf]")
-                __ASM_EMIT("sub         $4, %[count]")
-                __ASM_EMIT("jae         1b")
-
-                __ASM_EMIT("2:")
-                __ASM_EMIT("add         $4, %[count]")
-                __ASM_EMIT("jz          100f")
-
-                // Single-item loop
-                __ASM_EMIT("3:")
-                __ASM_EMIT("movss       0x00(%[bc]), %[x0]")    // x0 = t[0]
-                __ASM_EMIT("movss       0x04(%[bc]), %[x2]")    // x2 = t[1]
-                __ASM_EMIT("movss       0x08(%[bc]), %[x4]")    // x4 = t[2]
-                __ASM_EMIT("movss       0x0c(%[bc]), %[x5]")    // x5 = t[3]
-
-                // x0 = t[0], x2 = t[1], x4 = t[2], x5 = t[3]
-                __ASM_EMIT("movaps      %[x0], %[x1]")          // x1 = t[0]
-                __ASM_EMIT("movaps      %[x2], %[x3]")          // x3 = t[1]
-                __ASM_EMIT("mulss       %[COS2W], %[x1]")       // x1 = t[0]*cos_2w
-                __ASM_EMIT("mulss       %[SIN2W], %[x0]")       // x0 = t[0]*sin_2w
-                __ASM_EMIT("mulss       %[COSW], %[x3]")        // x3 = t[1]*cos_w
-                __ASM_EMIT("mulss       %[SINW], %[x2]")        // x2 = t[1]*sin_w
-                __ASM_EMIT("addss       %[x1], %[x4]")          // x4 = t[0]*cos_2w + t[2]
-                __ASM_EMIT("addss       %[x0], %[x2]")          // x2 = im = t[0]*sin_2w + t[1]*sin_w
-                __ASM_EMIT("addss       %[x3], %[x4]")          // x4 = re = t[0]*cos_2w + t[1]*cos_w + t[2]
-                __ASM_EMIT("mulss       %[x2], %[x2]")          // x2 = im*im
-                __ASM_EMIT("mulss       %[x4], %[x4]")          // x4 = re*re
-                __ASM_EMIT("addss       %[x2], %[x4]")          // x4 = re*re + im*im
-                __ASM_EMIT("movaps      %[x5], %[x7]")          // x7 = t[3]
-                __ASM_EMIT("sqrtss      %[x4], %[x6]")          // x6 = at = sqrt(re*re + im*im)
-
-                // Load bottom part
-                __ASM_EMIT("movss       0x10(%[bc]), %[x0]")    // x0 = b[0]
-                __ASM_EMIT("movss       0x14(%[bc]), %[x2]")    // x2 = b[1]
-                __ASM_EMIT("movss       0x18(%[bc]), %[x4]")    // x4 = b[2]
-                __ASM_EMIT("movss       0x1c(%[bc]), %[x5]")    // x5 = b[3]
-
-                // x0 = b[0], x2 = b[1], x4 = b[2], x5 = b[3]
-                __ASM_EMIT("mulss       %[x5], %[x6]")          // x6 = at * b[3]
-                __ASM_EMIT("movaps      %[x0], %[x1]")          // x1 = b[0]
-                __ASM_EMIT("movaps      %[x2], %[x3]")          // x3 = b[1]
-                __ASM_EMIT("movaps      %[x0], %[x5]")          // x5 = b[0]
-                __ASM_EMIT("mulss       %[COS2W], %[x1]")       // x1 = b[0]*cos_2w
-                __ASM_EMIT("mulss       %[SIN2W], %[x0]")       // x0 = b[0]*sin_2w
-                __ASM_EMIT("mulss       %[COSW], %[x3]")        // x3 = b[1]*cos_w
-                __ASM_EMIT("mulss       %[SINW], %[x2]")        // x2 = b[1]*sin_w
-                __ASM_EMIT("addss       %[x1], %[x4]")          // x4 = b[0]*cos_2w + b[2]
-                __ASM_EMIT("addss       %[x0], %[x2]")          // x2 = im = b[0]*sin_2w + b[1]*sin_w
-                __ASM_EMIT("addss       %[x3], %[x4]")          // x4 = re = b[0]*cos_2w + b[1]*cos_w + b[2]
-                __ASM_EMIT("mulss       %[x2], %[x2]")          // x2 = im*im
-                __ASM_EMIT("mulss       %[x4], %[x4]")          // x4 = re*re
-                __ASM_EMIT("movaps      0x00(%[CC]), %[x0]")    // x0 = 1
-                __ASM_EMIT("addss       %[x2], %[x4]")          // x4 = re*re + im*im
-                __ASM_EMIT("divss       %[x5], %[x0]")          // x0 = N2 = 1/b[0]
-                __ASM_EMIT("sqrtss      %[x4], %[x1]")          // x1 = ab = sqrt(re*re + im*im)
-                __ASM_EMIT("mulss       %[x7], %[x1]")          // x1 = ab * t[3]
-                __ASM_EMIT("divss       %[x6], %[x1]")          // x1 = AN = (ab * t[3]) / (at * b[3])
-                __ASM_EMIT("mulss       %[x0], %[x1]")          // x1 = N1 = AN * N2
-
-                // Update filters
-                // Top part
-                __ASM_EMIT("movss       0x00(%[bc]), %[x2]")    // x2 = t[0]
-                __ASM_EMIT("movss       0x04(%[bc]), %[x3]")    // x3 = t[1]
-                __ASM_EMIT("movss       0x08(%[bc]), %[x4]")    // x4 = t[2]
-
-                __ASM_EMIT("mulss       %[x1], %[x2]")          // x2 = t[0] * N1 = a0
-                __ASM_EMIT("mulss       %[x1], %[x3]")          // x3 = t[1] * N1 = a1
-                __ASM_EMIT("mulss       %[x1], %[x4]")          // x4 = t[2] * N1 = a2
-                __ASM_EMIT("unpcklps    %[x4], %[x3]")          // x3 = a1 a2 ? ?
-                __ASM_EMIT("shufps      $0x40, %[x3], %[x2]")   // x2 = a0 a0 a1 a2
-                __ASM_EMIT("movaps      %[x2], 0x00(%[bf])")
-
-                // Bottom part
-                __ASM_EMIT("xorps       0x10(%[CC]), %[x0]")    // x0 = -N2
-                __ASM_EMIT("movss       0x14(%[bc]), %[x2]")    // x2 = b[1]
-                __ASM_EMIT("movss       0x18(%[bc]), %[x3]")    // x3 = b[2]
-
-                __ASM_EMIT("mulss       %[x0], %[x2]")          // x2 = b[1] * N2 = b1
-                __ASM_EMIT("mulss       %[x0], %[x3]")          // x3 = b[2] * N2 = b2
-                __ASM_EMIT("unpcklps    %[x3], %[x2]")          // x2 = b1 b2 0 0
-                __ASM_EMIT("movaps      %[x2], 0x10(%[bf])")
-
-                // Repeat loop
-                __ASM_EMIT("add         $0x20, %[bc]")
-                __ASM_EMIT("add         $0x20, %[bf]")
-                __ASM_EMIT("dec         %[count]")
-                __ASM_EMIT("jnz         3b")
-
-                __ASM_EMIT("100:")
-                : [x0] "+x" (cos_w), [x1] "+x" (sin_w), [x2] "=&x" (x2), [x3] "=&x" (x3),
-                  [x4] "=&x" (x4), [x5] "=&x" (x5), [x6] "=&x" (x6), [x7] "=&x" (x7),
-                  [count] "+r" (count),
-                  [bc] "+r" (bc),
-                  [bf] "+r" (bf)
-                : [CC] "r" (f_transform_const),
-                  [COSW] "m" (COSW),
-                  [SINW] "m" (SINW),
-                  [COS2W] "m" (COS2W),
-                  [SIN2W] "m" (SIN2W)
-                : "cc", "memory"
-            );
-        }
     }
 }
 
@@ -0,0 +1,570 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_FIR_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_FIR_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+namespace lsp
+{
+    namespace sse
+    {
+        void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+
+            ARCH_X86_ASM(
+                // 16x blocks
+                __ASM_EMIT("sub         $16, %[count]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = s0
+                __ASM_EMIT("xorps       %%xmm1, %%xmm1")            // xmm1 = s1
+                __ASM_EMIT("xorps       %%xmm2, %%xmm2")            // xmm2 = s2
+                __ASM_EMIT("xorps       %%xmm3, %%xmm3")            // xmm3 = s3
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("11:")
+                    __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                    __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm5")      // xmm5 = x0
+                    __ASM_EMIT("movups      0x10(%[src], %[off]), %%xmm6")      // xmm6 = x1
+                    __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")             // xmm4 = t t t t
+                    __ASM_EMIT("movups      0x20(%[src], %[off]), %%xmm7")      // xmm7 = x2
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm6")                    // xmm6 = t*x1
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm7")                    // xmm7 = t*x2
+                    __ASM_EMIT("addps       %%xmm5, %%xmm0")                    // xmm0 = s0 + t*x0
+                    __ASM_EMIT("movups      0x30(%[src], %[off]), %%xmm5")      // xmm5 = x3
+                    __ASM_EMIT("addps       %%xmm6, %%xmm1")                    // xmm1 = s1 + t*x1
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x3
+                    __ASM_EMIT("addps       %%xmm7, %%xmm2")                    // xmm2 = s2 + t*x2
+                    __ASM_EMIT("add         $0x04, %[off]")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm3")                    // xmm3 = s3 + t*x3
+                    __ASM_EMIT("cmp         %[tlen], %[off]")
+                    __ASM_EMIT("jb          11b")
+                __ASM_EMIT32("mov         %[dst], %[off]")
+                __ASM_EMIT32("movups      %%xmm0, 0x00(%[off])")
+                __ASM_EMIT32("movups      %%xmm1, 0x10(%[off])")
+                __ASM_EMIT32("movups      %%xmm2, 0x20(%[off])")
+                __ASM_EMIT32("movups      %%xmm3, 0x30(%[off])")
+                __ASM_EMIT32("addl        $0x40, %[dst]")
+                __ASM_EMIT64("movups      %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT64("movups      %%xmm1, 0x10(%[dst])")
+                __ASM_EMIT64("movups      %%xmm2, 0x20(%[dst])")
+                __ASM_EMIT64("movups      %%xmm3, 0x30(%[dst])")
+                __ASM_EMIT64("add         $0x40, %[dst]")
+                __ASM_EMIT("add         $0x40, %[src]")
+                __ASM_EMIT("sub         $16, %[count]")
+                __ASM_EMIT("jae         1b")
+                __ASM_EMIT("2:")
+                // 4x blocks
+                __ASM_EMIT("add         $12, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = s0
+                __ASM_EMIT("xorps       %%xmm1, %%xmm1")            // xmm1 = s1
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("31:")
+                    __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                    __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm5")      // xmm5 = x0
+                    __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")             // xmm4 = t t t t
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                    __ASM_EMIT("add         $0x04, %[off]")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm0")                    // xmm0 = s0 + t*x0
+                    __ASM_EMIT("cmp         %[tlen], %[off]")
+                    __ASM_EMIT("jae         32f")
+                    __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                    __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm5")      // xmm5 = x0
+                    __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")             // xmm4 = t t t t
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                    __ASM_EMIT("add         $0x04, %[off]")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm1")                    // xmm1 = s1 + t*x0
+                    __ASM_EMIT("cmp         %[tlen], %[off]")
+                    __ASM_EMIT("jb          31b")
+                __ASM_EMIT("32:")
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")            // xmm0 = s0 + s1
+                __ASM_EMIT32("mov         %[dst], %[off]")
+                __ASM_EMIT32("movups      %%xmm0, 0x00(%[off])")
+                __ASM_EMIT32("addl        $0x10, %[dst]")
+                __ASM_EMIT64("movups      %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT64("add         $0x10, %[dst]")
+                __ASM_EMIT("add         $0x10, %[src]")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("jge         3b")
+                __ASM_EMIT("4:")
+                // 1x blocks
+                __ASM_EMIT("add         $3, %[count]")
+                __ASM_EMIT("jl          6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = s
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("51:")
+                    __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                    __ASM_EMIT("mulss       0x00(%[src], %[off]), %%xmm4")      // xmm4 = t*x
+                    __ASM_EMIT("add         $0x04, %[off]")
+                    __ASM_EMIT("addss       %%xmm4, %%xmm0")                    // xmm0 = s + t*x
+                    __ASM_EMIT("cmp         %[tlen], %[off]")
+                    __ASM_EMIT("jb          51b")
+                __ASM_EMIT32("mov         %[dst], %[off]")
+                __ASM_EMIT32("movss       %%xmm0, 0x00(%[off])")
+                __ASM_EMIT32("addl        $0x04, %[dst]")
+                __ASM_EMIT64("movss       %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT64("add         $0x04, %[dst]")
+                __ASM_EMIT("add         $0x04, %[src]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jge         5b")
+                __ASM_EMIT("6:")
+
+                : [dst] __IF_32("+m") __IF_64("+r") (dst),
+                  [src] "+r" (src), [count] "+r" (count),
+                  [off] "=&r" (off)
+                : [taps] "r" (taps), [tlen] X86_GREG (tlen)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+            const float *taps, size_t length, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+
+            ARCH_X86_ASM(
+                // 8x blocks
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = a0
+                __ASM_EMIT("xorps       %%xmm1, %%xmm1")            // xmm1 = a1
+                __ASM_EMIT("xorps       %%xmm2, %%xmm2")            // xmm2 = b0
+                __ASM_EMIT("xorps       %%xmm3, %%xmm3")            // xmm3 = b1
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("11:")
+                    __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                    __ASM_EMIT("movups      0x00(%[src1], %[off]), %%xmm5")     // xmm5 = x0
+                    __ASM_EMIT("movups      0x10(%[src1], %[off]), %%xmm6")     // xmm6 = x1
+                    __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")             // xmm4 = t t t t
+                    __ASM_EMIT("movups      0x00(%[src2], %[off]), %%xmm7")     // xmm7 = y0
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm6")                    // xmm6 = t*x1
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm7")                    // xmm7 = t*y0
+                    __ASM_EMIT("addps       %%xmm5, %%xmm0")                    // xmm0 = a0 + t*x0
+                    __ASM_EMIT("movups      0x10(%[src2], %[off]), %%xmm5")     // xmm5 = y1
+                    __ASM_EMIT("addps       %%xmm6, %%xmm1")                    // xmm1 = a1 + t*x1
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*y1
+                    __ASM_EMIT("addps       %%xmm7, %%xmm2")                    // xmm2 = b0 + t*y0
+                    __ASM_EMIT("add         $0x04, %[off]")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm3")                    // xmm3 = b1 + t*y1
+                    __ASM_EMIT("cmp         %[tlen], %[off]")
+                    __ASM_EMIT("jb          11b")
+                __ASM_EMIT32("mov         %[dst1], %[off]")
+                __ASM_EMIT32("movups      %%xmm0, 0x00(%[off])")
+                __ASM_EMIT32("movups      %%xmm1, 0x10(%[off])")
+                __ASM_EMIT32("mov         %[dst2], %[off]")
+                __ASM_EMIT32("movups      %%xmm2, 0x00(%[off])")
+                __ASM_EMIT32("movups      %%xmm3, 0x10(%[off])")
+                __ASM_EMIT32("addl        $0x20, %[dst1]")
+                __ASM_EMIT32("addl        $0x20, %[dst2]")
+                __ASM_EMIT64("movups      %%xmm0, 0x00(%[dst1])")
+                __ASM_EMIT64("movups      %%xmm1, 0x10(%[dst1])")
+                __ASM_EMIT64("movups      %%xmm2, 0x00(%[dst2])")
+                __ASM_EMIT64("movups      %%xmm3, 0x10(%[dst2])")
+                __ASM_EMIT64("add         $0x20, %[dst1]")
+                __ASM_EMIT64("add         $0x20, %[dst2]")
+                __ASM_EMIT("add         $0x20, %[src1]")
+                __ASM_EMIT("add         $0x20, %[src2]")
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jae         1b")
+                __ASM_EMIT("2:")
+                // 4x block
+                __ASM_EMIT("add         $4, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = a0
+                __ASM_EMIT("xorps       %%xmm2, %%xmm2")            // xmm2 = b0
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("31:")
+                    __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                    __ASM_EMIT("movups      0x00(%[src1], %[off]), %%xmm5")     // xmm5 = x0
+                    __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")             // xmm4 = t t t t
+                    __ASM_EMIT("movups      0x00(%[src2], %[off]), %%xmm7")     // xmm7 = y0
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm7")                    // xmm7 = t*y0
+                    __ASM_EMIT("add         $0x04, %[off]")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm0")                    // xmm0 = a0 + t*x0
+                    __ASM_EMIT("addps       %%xmm7, %%xmm2")                    // xmm2 = b0 + t*y0
+                    __ASM_EMIT("cmp         %[tlen], %[off]")
+                    __ASM_EMIT("jb          31b")
+                __ASM_EMIT32("mov         %[dst1], %[off]")
+                __ASM_EMIT32("movups      %%xmm0, 0x00(%[off])")
+                __ASM_EMIT32("mov         %[dst2], %[off]")
+                __ASM_EMIT32("movups      %%xmm2, 0x00(%[off])")
+                __ASM_EMIT32("addl        $0x10, %[dst1]")
+                __ASM_EMIT32("addl        $0x10, %[dst2]")
+                __ASM_EMIT64("movups      %%xmm0, 0x00(%[dst1])")
+                __ASM_EMIT64("movups      %%xmm2, 0x00(%[dst2])")
+                __ASM_EMIT64("add         $0x10, %[dst1]")
+                __ASM_EMIT64("add         $0x10, %[dst2]")
+                __ASM_EMIT("add         $0x10, %[src1]")
+                __ASM_EMIT("add         $0x10, %[src2]")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("4:")
+                // 1x blocks
+                __ASM_EMIT("add         $3, %[count]")
+                __ASM_EMIT("jl          6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = a
+                __ASM_EMIT("xorps       %%xmm2, %%xmm2")            // xmm2 = b
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("51:")
+                    __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                    __ASM_EMIT("movss       0x00(%[src1], %[off]), %%xmm5")     // xmm5 = x
+                    __ASM_EMIT("movss       0x00(%[src2], %[off]), %%xmm7")     // xmm7 = y
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm5")                    // xmm5 = t*x
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm7")                    // xmm7 = t*y
+                    __ASM_EMIT("add         $0x04, %[off]")
+                    __ASM_EMIT("addss       %%xmm5, %%xmm0")                    // xmm0 = a + t*x
+                    __ASM_EMIT("addss       %%xmm7, %%xmm2")                    // xmm2 = b + t*y
+                    __ASM_EMIT("cmp         %[tlen], %[off]")
+                    __ASM_EMIT("jb          51b")
+                __ASM_EMIT32("mov         %[dst1], %[off]")
+                __ASM_EMIT32("movss       %%xmm0, 0x00(%[off])")
+                __ASM_EMIT32("mov         %[dst2], %[off]")
+                __ASM_EMIT32("movss       %%xmm2, 0x00(%[off])")
+                __ASM_EMIT32("addl        $0x04, %[dst1]")
+                __ASM_EMIT32("addl        $0x04, %[dst2]")
+                __ASM_EMIT64("movss       %%xmm0, 0x00(%[dst1])")
+                __ASM_EMIT64("movss       %%xmm2, 0x00(%[dst2])")
+                __ASM_EMIT64("add         $0x04, %[dst1]")
+                __ASM_EMIT64("add         $0x04, %[dst2]")
+                __ASM_EMIT("add         $0x04, %[src1]")
+                __ASM_EMIT("add         $0x04, %[src2]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jge         5b")
+                __ASM_EMIT("6:")
+
+                : [dst1] __IF_32("+m") __IF_64("+r") (dst1),
+                  [dst2] __IF_32("+m") __IF_64("+r") (dst2),
+                  [src1] "+r" (src1), [src2] "+r" (src2),
+                  [count] "+r" (count), [off] "=&r" (off)
+                : [taps] "r" (taps), [tlen] X86_GREG (tlen)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+    #define FIR_STORE_STRIDED(x) \
+        __ASM_EMIT("movss       %%" x ", 0x00(%[off])") \
+        __ASM_EMIT("shufps      $0x39, %%" x ", %%" x) \
+        __ASM_EMIT("add         %[stride], %[off]") \
+        __ASM_EMIT("movss       %%" x ", 0x00(%[off])") \
+        __ASM_EMIT("shufps      $0x39, %%" x ", %%" x) \
+        __ASM_EMIT("add         %[stride], %[off]") \
+        __ASM_EMIT("movss       %%" x ", 0x00(%[off])") \
+        __ASM_EMIT("shufps      $0x39, %%" x ", %%" x) \
+        __ASM_EMIT("add         %[stride], %[off]") \
+        __ASM_EMIT("movss       %%" x ", 0x00(%[off])") \
+        __ASM_EMIT("add         %[stride], %[off]")
+
+        void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            size_t off;
+            size_t tlen     = length * sizeof(float);
+            size_t stride   = factor * sizeof(float);
+
+            for (size_t p=0; p<factor; ++p, taps += length)
+            {
+                float *d        = &dst[p];
+                const float *s  = src;
+                size_t n        = count;
+
+                ARCH_X86_ASM(
+                    // 16x blocks
+                    __ASM_EMIT("sub         $16, %[count]")
+                    __ASM_EMIT("jb          2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = s0
+                    __ASM_EMIT("xorps       %%xmm1, %%xmm1")            // xmm1 = s1
+                    __ASM_EMIT("xorps       %%xmm2, %%xmm2")            // xmm2 = s2
+                    __ASM_EMIT("xorps       %%xmm3, %%xmm3")            // xmm3 = s3
+                    __ASM_EMIT("xor         %[off], %[off]")
+                    __ASM_EMIT("11:")
+                        __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                        __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm5")      // xmm5 = x0
+                        __ASM_EMIT("movups      0x10(%[src], %[off]), %%xmm6")      // xmm6 = x1
+                        __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")             // xmm4 = t t t t
+                        __ASM_EMIT("movups      0x20(%[src], %[off]), %%xmm7")      // xmm7 = x2
+                        __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                        __ASM_EMIT("mulps       %%xmm4, %%xmm6")                    // xmm6 = t*x1
+                        __ASM_EMIT("mulps       %%xmm4, %%xmm7")                    // xmm7 = t*x2
+                        __ASM_EMIT("addps       %%xmm5, %%xmm0")                    // xmm0 = s0 + t*x0
+                        __ASM_EMIT("movups      0x30(%[src], %[off]), %%xmm5")      // xmm5 = x3
+                        __ASM_EMIT("addps       %%xmm6, %%xmm1")                    // xmm1 = s1 + t*x1
+                        __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x3
+                        __ASM_EMIT("addps       %%xmm7, %%xmm2")                    // xmm2 = s2 + t*x2
+                        __ASM_EMIT("add         $0x04, %[off]")
+                        __ASM_EMIT("addps       %%xmm5, %%xmm3")                    // xmm3 = s3 + t*x3
+                        __ASM_EMIT("cmp         %[tlen], %[off]")
+                        __ASM_EMIT("jb          11b")
+                    __ASM_EMIT("mov         %[dst], %[off]")
+                    FIR_STORE_STRIDED("xmm0")
+                    FIR_STORE_STRIDED("xmm1")
+                    FIR_STORE_STRIDED("xmm2")
+                    FIR_STORE_STRIDED("xmm3")
+                    __ASM_EMIT("mov         %[off], %[dst]")
+                    __ASM_EMIT("add         $0x40, %[src]")
+                    __ASM_EMIT("sub         $16, %[count]")
+                    __ASM_EMIT("jae         1b")
+                    __ASM_EMIT("2:")
+                    // 4x blocks
+                    __ASM_EMIT("add         $12, %[count]")
+                    __ASM_EMIT("jl          4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = s0
+                    __ASM_EMIT("xorps       %%xmm1, %%xmm1")            // xmm1 = s1
+                    __ASM_EMIT("xor         %[off], %[off]")
+                    __ASM_EMIT("31:")
+                        __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                        __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm5")      // xmm5 = x0
+                        __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")             // xmm4 = t t t t
+                        __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                        __ASM_EMIT("add         $0x04, %[off]")
+                        __ASM_EMIT("addps       %%xmm5, %%xmm0")                    // xmm0 = s0 + t*x0
+                        __ASM_EMIT("cmp         %[tlen], %[off]")
+                        __ASM_EMIT("jae         32f")
+                        __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                        __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm5")      // xmm5 = x0
+                        __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")             // xmm4 = t t t t
+                        __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                        __ASM_EMIT("add         $0x04, %[off]")
+                        __ASM_EMIT("addps       %%xmm5, %%xmm1")                    // xmm1 = s1 + t*x0
+                        __ASM_EMIT("cmp         %[tlen], %[off]")
+                        __ASM_EMIT("jb          31b")
+                    __ASM_EMIT("32:")
+                    __ASM_EMIT("addps       %%xmm1, %%xmm0")            // xmm0 = s0 + s1
+                    __ASM_EMIT("mov         %[dst], %[off]")
+                    FIR_STORE_STRIDED("xmm0")
+                    __ASM_EMIT("mov         %[off], %[dst]")
+                    __ASM_EMIT("add         $0x10, %[src]")
+                    __ASM_EMIT("sub         $4, %[count]")
+                    __ASM_EMIT("jge         3b")
+                    __ASM_EMIT("4:")
+                    // 1x blocks
+                    __ASM_EMIT("add         $3, %[count]")
+                    __ASM_EMIT("jl          6f")
+                    __ASM_EMIT("5:")
+                    __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = s
+                    __ASM_EMIT("xor         %[off], %[off]")
+                    __ASM_EMIT("51:")
+                        __ASM_EMIT("movss       0x00(%[taps], %[off]), %%xmm4")     // xmm4 = t
+                        __ASM_EMIT("mulss       0x00(%[src], %[off]), %%xmm4")      // xmm4 = t*x
+                        __ASM_EMIT("add         $0x04, %[off]")
+                        __ASM_EMIT("addss       %%xmm4, %%xmm0")                    // xmm0 = s + t*x
+                        __ASM_EMIT("cmp         %[tlen], %[off]")
+                        __ASM_EMIT("jb          51b")
+                    __ASM_EMIT("mov         %[dst], %[off]")
+                    __ASM_EMIT("movss       %%xmm0, 0x00(%[off])")
+                    __ASM_EMIT("add         %[stride], %[off]")
+                    __ASM_EMIT("mov         %[off], %[dst]")
+                    __ASM_EMIT("add         $0x04, %[src]")
+                    __ASM_EMIT("dec         %[count]")
+                    __ASM_EMIT("jge         5b")
+                    __ASM_EMIT("6:")
+
+                    : [dst] __IF_32("+m") __IF_64("+r") (d),
+                      [src] "+r" (s), [count] "+r" (n),
+                      [off] "=&r" (off)
+                    : [taps] "r" (taps), [tlen] X86_GREG (tlen),
+                      [stride] X86_GREG (stride)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+            }
+        }
+
+    #undef FIR_STORE_STRIDED
+
+        void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+        {
+            size_t stride       = factor * sizeof(float);
+            const float *tend   = &taps[length & ~size_t(0x03)];
+            const float *tfin   = &taps[length];
+
+            // 4x blocks: four dot products with the same taps
+            for ( ; count >= 4; count -= 4)
+            {
+                const float *t  = taps;
+                const float *s0 = src;
+                const float *s1 = &src[factor];
+
+                ARCH_X86_ASM(
+                    __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = a0
+                    __ASM_EMIT("xorps       %%xmm1, %%xmm1")            // xmm1 = a1
+                    __ASM_EMIT("xorps       %%xmm2, %%xmm2")            // xmm2 = a2
+                    __ASM_EMIT("xorps       %%xmm3, %%xmm3")            // xmm3 = a3
+                    // 4x taps
+                    __ASM_EMIT("cmp         %[tend], %[t]")
+                    __ASM_EMIT("jae         2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("movups      0x00(%[t]), %%xmm4")                // xmm4 = t
+                    __ASM_EMIT("movups      0x00(%[s0]), %%xmm5")               // xmm5 = x0
+                    __ASM_EMIT("movups      0x00(%[s1]), %%xmm6")               // xmm6 = x1
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm6")                    // xmm6 = t*x1
+                    __ASM_EMIT("addps       %%xmm5, %%xmm0")                    // xmm0 = a0 + t*x0
+                    __ASM_EMIT("addps       %%xmm6, %%xmm1")                    // xmm1 = a1 + t*x1
+                    __ASM_EMIT("movups      0x00(%[s0], %[stride], 2), %%xmm5") // xmm5 = x2
+                    __ASM_EMIT("movups      0x00(%[s1], %[stride], 2), %%xmm6") // xmm6 = x3
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x2
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm6")                    // xmm6 = t*x3
+                    __ASM_EMIT("addps       %%xmm5, %%xmm2")                    // xmm2 = a2 + t*x2
+                    __ASM_EMIT("addps       %%xmm6, %%xmm3")                    // xmm3 = a3 + t*x3
+                    __ASM_EMIT("add         $0x10, %[t]")
+                    __ASM_EMIT("add         $0x10, %[s0]")
+                    __ASM_EMIT("add         $0x10, %[s1]")
+                    __ASM_EMIT("cmp         %[tend], %[t]")
+                    __ASM_EMIT("jb          1b")
+                    __ASM_EMIT("2:")
+                    // 1x taps
+                    __ASM_EMIT("cmp         %[tfin], %[t]")
+                    __ASM_EMIT("jae         4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("movss       0x00(%[t]), %%xmm4")                // xmm4 = t
+                    __ASM_EMIT("movss       0x00(%[s0]), %%xmm5")               // xmm5 = x0
+                    __ASM_EMIT("movss       0x00(%[s1]), %%xmm6")               // xmm6 = x1
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm5")                    // xmm5 = t*x0
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm6")                    // xmm6 = t*x1
+                    __ASM_EMIT("addss       %%xmm5, %%xmm0")                    // xmm0 = a0 + t*x0
+                    __ASM_EMIT("addss       %%xmm6, %%xmm1")                    // xmm1 = a1 + t*x1
+                    __ASM_EMIT("movss       0x00(%[s0], %[stride], 2), %%xmm5") // xmm5 = x2
+                    __ASM_EMIT("movss       0x00(%[s1], %[stride], 2), %%xmm6") // xmm6 = x3
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm5")                    // xmm5 = t*x2
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm6")                    // xmm6 = t*x3
+                    __ASM_EMIT("addss       %%xmm5, %%xmm2")                    // xmm2 = a2 + t*x2
+                    __ASM_EMIT("addss       %%xmm6, %%xmm3")                    // xmm3 = a3 + t*x3
+                    __ASM_EMIT("add         $0x04, %[t]")
+                    __ASM_EMIT("add         $0x04, %[s0]")
+                    __ASM_EMIT("add         $0x04, %[s1]")
+                    __ASM_EMIT("cmp         %[tfin], %[t]")
+                    __ASM_EMIT("jb          3b")
+                    __ASM_EMIT("4:")
+                    // Horizontal sums
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+                    __ASM_EMIT("movaps      %%xmm2, %%xmm5")
+                    __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")            // xmm0 = a0[0] a1[0] a0[1] a1[1]
+                    __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")            // xmm2 = a2[0] a3[0] a2[1] a3[1]
+                    __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")            // xmm4 = a0[2] a1[2] a0[3] a1[3]
+                    __ASM_EMIT("unpckhps    %%xmm3, %%xmm5")            // xmm5 = a2[2] a3[2] a2[3] a3[3]
+                    __ASM_EMIT("addps       %%xmm4, %%xmm0")            // xmm0 = p0 p1 p2 p3
+                    __ASM_EMIT("addps       %%xmm5, %%xmm2")            // xmm2 = q0 q1 q2 q3
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+                    __ASM_EMIT("movlhps     %%xmm2, %%xmm0")            // xmm0 = p0 p1 q0 q1
+                    __ASM_EMIT("movhlps     %%xmm4, %%xmm2")            // xmm2 = p2 p3 q2 q3
+                    __ASM_EMIT("addps       %%xmm0, %%xmm2")            // xmm2 = p0+p2 p1+p3 q0+q2 q1+q3
+                    __ASM_EMIT("mov         %[dst], %[t]")
+                    __ASM_EMIT("movups      %%xmm2, 0x00(%[t])")
+
+                    : [t] "+r" (t), [s0] "+r" (s0), [s1] "+r" (s1)
+                    : [dst] X86_GREG (dst), [stride] "r" (stride),
+                      [tend] X86_GREG (tend), [tfin] X86_GREG (tfin)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6"
+                );
+
+                dst            += 4;
+                src            += factor * 4;
+            }
+
+            // 1x blocks
+            for ( ; count > 0; --count)
+            {
+                const float *t  = taps;
+                const float *s0 = src;
+
+                ARCH_X86_ASM(
+                    __ASM_EMIT("xorps       %%xmm0, %%xmm0")            // xmm0 = a0
+                    __ASM_EMIT("xorps       %%xmm1, %%xmm1")            // xmm1 = a1
+                    // 4x taps
+                    __ASM_EMIT("cmp         %[tend], %[t]")
+                    __ASM_EMIT("jae         2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("movups      0x00(%[t]), %%xmm4")                // xmm4 = t
+                    __ASM_EMIT("movups      0x00(%[s0]), %%xmm5")               // xmm5 = x
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x
+                    __ASM_EMIT("add         $0x10, %[t]")
+                    __ASM_EMIT("add         $0x10, %[s0]")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm0")                    // xmm0 = a0 + t*x
+                    __ASM_EMIT("cmp         %[tend], %[t]")
+                    __ASM_EMIT("jae         2f")
+                    __ASM_EMIT("movups      0x00(%[t]), %%xmm4")                // xmm4 = t
+                    __ASM_EMIT("movups      0x00(%[s0]), %%xmm5")               // xmm5 = x
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")                    // xmm5 = t*x
+                    __ASM_EMIT("add         $0x10, %[t]")
+                    __ASM_EMIT("add         $0x10, %[s0]")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm1")                    // xmm1 = a1 + t*x
+                    __ASM_EMIT("cmp         %[tend], %[t]")
+                    __ASM_EMIT("jb          1b")
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("addps       %%xmm1, %%xmm0")            // xmm0 = a0 + a1
+                    // 1x taps
+                    __ASM_EMIT("cmp         %[tfin], %[t]")
+                    __ASM_EMIT("jae         4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("movss       0x00(%[t]), %%xmm4")                // xmm4 = t
+                    __ASM_EMIT("mulss       0x00(%[s0]), %%xmm4")               // xmm4 = t*x
+                    __ASM_EMIT("add         $0x04, %[t]")
+                    __ASM_EMIT("add         $0x04, %[s0]")
+                    __ASM_EMIT("addss       %%xmm4, %%xmm0")                    // xmm0 = a0 + t*x
+                    __ASM_EMIT("cmp         %[tfin], %[t]")
+                    __ASM_EMIT("jb          3b")
+                    __ASM_EMIT("4:")
+                    // Horizontal sum
+                    __ASM_EMIT("movhlps     %%xmm0, %%xmm1")            // xmm1 = a2 a3 ? ?
+                    __ASM_EMIT("addps       %%xmm1, %%xmm0")            // xmm0 = a0+a2 a1+a3 ? ?
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+                    __ASM_EMIT("shufps      $0x55, %%xmm1, %%xmm1")     // xmm1 = a1+a3
+                    __ASM_EMIT("addss       %%xmm1, %%xmm0")            // xmm0 = a0+a1+a2+a3
+                    __ASM_EMIT("mov         %[dst], %[t]")
+                    __ASM_EMIT("movss       %%xmm0, 0x00(%[t])")
+
+                    : [t] "+r" (t), [s0] "+r" (s0)
+                    : [dst] X86_GREG (dst),
+                      [tend] X86_GREG (tend), [tfin] X86_GREG (tfin)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm4", "%xmm5"
+                );
+
+                ++dst;
+                src            += factor;
+            }
+        }
+
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_FIR_H_ */
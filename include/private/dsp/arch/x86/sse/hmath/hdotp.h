@@ -304,6 +304,91 @@ namespace lsp
 
             return result;
         }
+
+        float h_lerp_dotp(const float *x, const float *a, const float *b, float k, size_t count)
+        {
+            IF_ARCH_X86(
+                float result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xorps       %%xmm0, %%xmm0")
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("xorps       %%xmm1, %%xmm1")
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jb          2f")
+                /* x8 Blocks */
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      0x00(%[x], %[off]), %%xmm2")
+                __ASM_EMIT("movups      0x10(%[x], %[off]), %%xmm3")
+                __ASM_EMIT("movups      0x00(%[a], %[off]), %%xmm4")
+                __ASM_EMIT("movups      0x10(%[a], %[off]), %%xmm5")
+                __ASM_EMIT("movups      0x00(%[b], %[off]), %%xmm6")
+                __ASM_EMIT("movups      0x10(%[b], %[off]), %%xmm7")
+                __ASM_EMIT("mulps       %%xmm2, %%xmm4")
+                __ASM_EMIT("mulps       %%xmm3, %%xmm5")
+                __ASM_EMIT("mulps       %%xmm2, %%xmm6")
+                __ASM_EMIT("mulps       %%xmm3, %%xmm7")
+                __ASM_EMIT("addps       %%xmm4, %%xmm0")
+                __ASM_EMIT("addps       %%xmm6, %%xmm1")
+                __ASM_EMIT("addps       %%xmm5, %%xmm0")
+                __ASM_EMIT("addps       %%xmm7, %%xmm1")
+                __ASM_EMIT("add         $0x20, %[off]")
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jae         1b")
+                /* x4 Block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $4, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("movups      0x00(%[x], %[off]), %%xmm2")
+                __ASM_EMIT("movups      0x00(%[a], %[off]), %%xmm4")
+                __ASM_EMIT("movups      0x00(%[b], %[off]), %%xmm6")
+                __ASM_EMIT("mulps       %%xmm2, %%xmm4")
+                __ASM_EMIT("mulps       %%xmm2, %%xmm6")
+                __ASM_EMIT("addps       %%xmm4, %%xmm0")
+                __ASM_EMIT("addps       %%xmm6, %%xmm1")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("add         $0x10, %[off]")
+                /* x1 Blocks */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add         $3, %[count]")
+                __ASM_EMIT("jl          6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("movss       0x00(%[x], %[off]), %%xmm2")
+                __ASM_EMIT("movss       0x00(%[a], %[off]), %%xmm4")
+                __ASM_EMIT("movss       0x00(%[b], %[off]), %%xmm6")
+                __ASM_EMIT("mulss       %%xmm2, %%xmm4")
+                __ASM_EMIT("mulss       %%xmm2, %%xmm6")
+                __ASM_EMIT("addss       %%xmm4, %%xmm0")
+                __ASM_EMIT("addss       %%xmm6, %%xmm1")
+                __ASM_EMIT("add         $0x04, %[off]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jge         5b")
+                /* Interpolate and sum */
+                __ASM_EMIT("6:")
+                __ASM_EMIT("movss       %[k], %%xmm2")
+                __ASM_EMIT("subps       %%xmm0, %%xmm1")            // xmm1 = sb - sa
+                __ASM_EMIT("shufps      $0x00, %%xmm2, %%xmm2")     // xmm2 = k
+                __ASM_EMIT("mulps       %%xmm2, %%xmm1")            // xmm1 = (sb - sa) * k
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")            // xmm0 = sa + (sb - sa) * k
+                __ASM_EMIT("movhlps     %%xmm0, %%xmm1")
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")
+                __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")
+                __ASM_EMIT("movhlps     %%xmm0, %%xmm1")
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")
+
+                : [count] "+r" (count), [off] "=&r" (off),
+                  "=Yz" (result)
+                : [x] "r" (x), [a] "r" (a), [b] "r" (b),
+                  [k] "m" (k)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
     }
 }
 
@@ -1348,6 +1348,136 @@ namespace lsp
             );
         }
 
+        void pcomplex_r2c_mul3(float *dst, const float *src1, const float *src2, size_t count)
+        {
+            IF_ARCH_X86(size_t off);
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("xorps       %%xmm6, %%xmm6")
+                /* x8 blocks */
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      0x00(%[src1], %[off]), %%xmm0")     /* xmm0 = a0 a1 a2 a3 */
+                __ASM_EMIT("movups      0x10(%[src1], %[off]), %%xmm1")
+                __ASM_EMIT("movups      0x00(%[src2], %[off]), %%xmm2")     /* xmm2 = b0 b1 b2 b3 */
+                __ASM_EMIT("movups      0x10(%[src2], %[off]), %%xmm3")
+                __ASM_EMIT("mulps       %%xmm2, %%xmm0")                    /* xmm0 = s0 s1 s2 s3 */
+                __ASM_EMIT("mulps       %%xmm3, %%xmm1")
+                __ASM_EMIT("movaps      %%xmm0, %%xmm2")
+                __ASM_EMIT("movaps      %%xmm1, %%xmm3")
+                __ASM_EMIT("unpcklps    %%xmm6, %%xmm0")                    /* xmm0 = s0 0 s1 0 */
+                __ASM_EMIT("unpckhps    %%xmm6, %%xmm2")                    /* xmm2 = s2 0 s3 0 */
+                __ASM_EMIT("unpcklps    %%xmm6, %%xmm1")
+                __ASM_EMIT("unpckhps    %%xmm6, %%xmm3")
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[dst], %[off], 2)")
+                __ASM_EMIT("movups      %%xmm2, 0x10(%[dst], %[off], 2)")
+                __ASM_EMIT("movups      %%xmm1, 0x20(%[dst], %[off], 2)")
+                __ASM_EMIT("movups      %%xmm3, 0x30(%[dst], %[off], 2)")
+                __ASM_EMIT("add         $0x20, %[off]")
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jae         1b")
+                /* x4 block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $4, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("movups      0x00(%[src1], %[off]), %%xmm0")     /* xmm0 = a0 a1 a2 a3 */
+                __ASM_EMIT("movups      0x00(%[src2], %[off]), %%xmm2")     /* xmm2 = b0 b1 b2 b3 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm0")                    /* xmm0 = s0 s1 s2 s3 */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm2")
+                __ASM_EMIT("unpcklps    %%xmm6, %%xmm0")                    /* xmm0 = s0 0 s1 0 */
+                __ASM_EMIT("unpckhps    %%xmm6, %%xmm2")                    /* xmm2 = s2 0 s3 0 */
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[dst], %[off], 2)")
+                __ASM_EMIT("movups      %%xmm2, 0x10(%[dst], %[off], 2)")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("add         $0x10, %[off]")
+                /* x1 blocks */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add         $3, %[count]")
+                __ASM_EMIT("jl          6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("movss       0x00(%[src1], %[off]), %%xmm0")     /* xmm0 = a0 0 */
+                __ASM_EMIT("mulss       0x00(%[src2], %[off]), %%xmm0")     /* xmm0 = s0 0 */
+                __ASM_EMIT("movlps      %%xmm0, 0x00(%[dst], %[off], 2)")
+                __ASM_EMIT("add         $0x04, %[off]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jge         5b")
+                __ASM_EMIT("6:")
+
+                : [count] "+r" (count), [off] "=&r" (off)
+                : [dst] "r" (dst), [src1] "r" (src1), [src2] "r" (src2)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6"
+            );
+        }
+
+        void pcomplex_c2r_fmadd3(float *dst, const float *src, const float *k, size_t count)
+        {
+            IF_ARCH_X86(size_t off);
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor         %[off], %[off]")
+                /* x8 blocks */
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      0x00(%[src], %[off], 2), %%xmm0")   /* xmm0 = r0 i0 r1 i1 */
+                __ASM_EMIT("movups      0x10(%[src], %[off], 2), %%xmm1")   /* xmm1 = r2 i2 r3 i3 */
+                __ASM_EMIT("movups      0x20(%[src], %[off], 2), %%xmm2")
+                __ASM_EMIT("movups      0x30(%[src], %[off], 2), %%xmm3")
+                __ASM_EMIT("shufps      $0x88, %%xmm1, %%xmm0")             /* xmm0 = r0 r1 r2 r3 */
+                __ASM_EMIT("shufps      $0x88, %%xmm3, %%xmm2")
+                __ASM_EMIT("movups      0x00(%[k], %[off]), %%xmm4")        /* xmm4 = k0 k1 k2 k3 */
+                __ASM_EMIT("movups      0x10(%[k], %[off]), %%xmm5")
+                __ASM_EMIT("movups      0x00(%[dst], %[off]), %%xmm1")      /* xmm1 = d0 d1 d2 d3 */
+                __ASM_EMIT("movups      0x10(%[dst], %[off]), %%xmm3")
+                __ASM_EMIT("mulps       %%xmm4, %%xmm0")                    /* xmm0 = r*k */
+                __ASM_EMIT("mulps       %%xmm5, %%xmm2")
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")                    /* xmm0 = d + r*k */
+                __ASM_EMIT("addps       %%xmm3, %%xmm2")
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[dst], %[off])")
+                __ASM_EMIT("movups      %%xmm2, 0x10(%[dst], %[off])")
+                __ASM_EMIT("add         $0x20, %[off]")
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jae         1b")
+                /* x4 block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $4, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("movups      0x00(%[src], %[off], 2), %%xmm0")   /* xmm0 = r0 i0 r1 i1 */
+                __ASM_EMIT("movups      0x10(%[src], %[off], 2), %%xmm1")   /* xmm1 = r2 i2 r3 i3 */
+                __ASM_EMIT("movups      0x00(%[k], %[off]), %%xmm4")        /* xmm4 = k0 k1 k2 k3 */
+                __ASM_EMIT("movups      0x00(%[dst], %[off]), %%xmm5")      /* xmm5 = d0 d1 d2 d3 */
+                __ASM_EMIT("shufps      $0x88, %%xmm1, %%xmm0")             /* xmm0 = r0 r1 r2 r3 */
+                __ASM_EMIT("mulps       %%xmm4, %%xmm0")                    /* xmm0 = r*k */
+                __ASM_EMIT("addps       %%xmm5, %%xmm0")                    /* xmm0 = d + r*k */
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[dst], %[off])")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("add         $0x10, %[off]")
+                /* x1 blocks */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add         $3, %[count]")
+                __ASM_EMIT("jl          6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("movss       0x00(%[src], %[off], 2), %%xmm0")   /* xmm0 = r0 */
+                __ASM_EMIT("mulss       0x00(%[k], %[off]), %%xmm0")        /* xmm0 = r0*k0 */
+                __ASM_EMIT("addss       0x00(%[dst], %[off]), %%xmm0")      /* xmm0 = d0 + r0*k0 */
+                __ASM_EMIT("movss       %%xmm0, 0x00(%[dst], %[off])")
+                __ASM_EMIT("add         $0x04, %[off]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jge         5b")
+                __ASM_EMIT("6:")
+
+                : [count] "+r" (count), [off] "=&r" (off)
+                : [dst] "r" (dst), [src] "r" (src), [k] "r" (k)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+        }
+
     } /* namespace sse */
 } /* namespace lsp */
 
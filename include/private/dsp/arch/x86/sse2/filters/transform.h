@@ -0,0 +1,696 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_FILTERS_TRANSFORM_H_
+#define PRIVATE_DSP_ARCH_X86_SSE2_FILTERS_TRANSFORM_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_IMPL */
+
+#include <private/dsp/arch/x86/sse2/pmath/exp.h>
+
+#define MATCHED_BATCH           64          /* Number of second-order polynoms solved at once */
+
+namespace lsp
+{
+    namespace sse2
+    {
+        IF_ARCH_X86(
+            static const uint32_t MATCHED_CONST[] __lsp_aligned16 =
+            {
+                LSP_DSP_VEC4(0x80000000),   // sign
+                LSP_DSP_VEC4(0x7fffffff),   // abs
+                LSP_DSP_VEC4(0x3c23d70a),   // 0.01
+                LSP_DSP_VEC4(0x3dcccccd),   // 0.1
+                LSP_DSP_VEC4(0x40800000),   // 4.0
+                LSP_DSP_VEC4(0x3e22f983),   // 1/(2*PI)
+                LSP_DSP_VEC4(0x3f000000),   // 0.5
+                LSP_DSP_VEC4(0x40c90fdb),   // 2*PI
+                LSP_DSP_VEC4(0x3fc90fdb),   // PI/2
+                LSP_DSP_VEC4(0xb2d7322b),   // -1/11!
+                LSP_DSP_VEC4(0x3638ef1d),   // 1/9!
+                LSP_DSP_VEC4(0xb9500d01),   // -1/7!
+                LSP_DSP_VEC4(0x3c088889),   // 1/5!
+                LSP_DSP_VEC4(0xbe2aaaab),   // -1/3!
+                LSP_DSP_VEC4(0x3f800000),   // 1.0
+                LSP_DSP_VEC4(0x3ea2f983),   // 1/PI
+                LSP_DSP_VEC4(0x40490fdb),   // PI
+                LSP_DSP_VEC4(0x39500d01),   // 1/7!
+                LSP_DSP_VEC4(0x3ab60b61),   // 1/6!
+                LSP_DSP_VEC4(0x3c088889),   // 1/5!
+                LSP_DSP_VEC4(0x3d2aaaab),   // 1/4!
+                LSP_DSP_VEC4(0x3e2aaaab)    // 1/3!
+            };
+        )
+
+        typedef struct matched_ctx_t
+        {
+            float       w[44] __lsp_aligned16;      // td*kf/2, td*kf/20 and temporaries, 4 copies each
+            float      *vp[MATCHED_BATCH + 3];      // Batch of second-order polynoms
+            size_t      n;                          // Number of polynoms in the batch
+        } matched_ctx_t;
+
+        /*
+         * Sine of xmm0 = y in range [-PI/2, PI/2], the result is stored in xmm3, xmm2 is clobbered
+         */
+        #define MATCHED_SIN_X4 \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm2") \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm2")                    /* xmm2 = y2 = y*y */ \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm3") \
+            __ASM_EMIT("mulps       0x90 + %[MC], %%xmm3")              /* xmm3 = S5*y2 */ \
+            __ASM_EMIT("addps       0xa0 + %[MC], %%xmm3")              /* xmm3 = S4 + S5*y2 */ \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm3") \
+            __ASM_EMIT("addps       0xb0 + %[MC], %%xmm3")              /* xmm3 = S3 + y2*(S4 + S5*y2) */ \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm3") \
+            __ASM_EMIT("addps       0xc0 + %[MC], %%xmm3")              /* xmm3 = S2 + y2*(S3 + y2*(S4 + S5*y2)) */ \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm3") \
+            __ASM_EMIT("addps       0xd0 + %[MC], %%xmm3")              /* xmm3 = S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2))) */ \
+            __ASM_EMIT("mulps       %%xmm2, %%xmm3") \
+            __ASM_EMIT("addps       0xe0 + %[MC], %%xmm3")              /* xmm3 = 1 + y2*(S1 + y2*(S2 + y2*(S3 + y2*(S4 + S5*y2)))) */ \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm3")                    /* xmm3 = sin(y) */
+
+        /*
+         * Compute sqrt(Q) = sqrt(expm1(x)^2 + 4*exp(x)*sin(y)^2) for xmm0 = x, xmm1 = exp(x), xmm2 = y,
+         * the result is stored in xmm0, xmm1..xmm4 are clobbered. The expm1(x) is computed by the
+         * Taylor series for abs(x) < 0.5 to keep the precision when exp(x) is close to 1
+         */
+        #define MATCHED_AMP_X4 \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm3") \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4") \
+            __ASM_EMIT("andps       0x10 + %[MC], %%xmm3")              /* xmm3 = abs(x) */ \
+            __ASM_EMIT("mulps       0x110 + %[MC], %%xmm4")             /* xmm4 = x/7! */ \
+            __ASM_EMIT("cmpltps     0x60 + %[MC], %%xmm3")              /* xmm3 = [abs(x) < 0.5] */ \
+            __ASM_EMIT("addps       0x120 + %[MC], %%xmm4")             /* xmm4 = 1/6! + x/7! */ \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm4") \
+            __ASM_EMIT("addps       0x130 + %[MC], %%xmm4")             /* xmm4 = 1/5! + x*(...) */ \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm4") \
+            __ASM_EMIT("addps       0x140 + %[MC], %%xmm4")             /* xmm4 = 1/4! + x*(...) */ \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm4") \
+            __ASM_EMIT("addps       0x150 + %[MC], %%xmm4")             /* xmm4 = 1/3! + x*(...) */ \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm4") \
+            __ASM_EMIT("addps       0x60 + %[MC], %%xmm4")              /* xmm4 = 1/2! + x*(...) */ \
+            __ASM_EMIT("mulps       %%xmm0, %%xmm4") \
+            __ASM_EMIT("addps       0xe0 + %[MC], %%xmm4")              /* xmm4 = 1 + x*(...) */ \
+            __ASM_EMIT("mulps       %%xmm4, %%xmm0")                    /* xmm0 = x*(1 + x*(...)) */ \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm4") \
+            __ASM_EMIT("subps       0xe0 + %[MC], %%xmm4")              /* xmm4 = exp(x) - 1 */ \
+            __ASM_EMIT("andps       %%xmm3, %%xmm0") \
+            __ASM_EMIT("andnps      %%xmm4, %%xmm3") \
+            __ASM_EMIT("orps        %%xmm0, %%xmm3")                    /* xmm3 = M = expm1(x) */ \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm3")                    /* xmm3 = M*M */ \
+            __ASM_EMIT("mulps       0x40 + %[MC], %%xmm1")              /* xmm1 = 4*exp(x) */ \
+            __ASM_EMIT("movaps      %%xmm3, 0xa0(%[w])") \
+            /* sin(y)^2 = sin(y - PI*n)^2 */ \
+            __ASM_EMIT("andps       0x10 + %[MC], %%xmm2")              /* xmm2 = abs(y) */ \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm0") \
+            __ASM_EMIT("mulps       0xf0 + %[MC], %%xmm0")              /* xmm0 = abs(y)/PI */ \
+            __ASM_EMIT("addps       0x60 + %[MC], %%xmm0")              /* xmm0 = abs(y)/PI + 0.5 */ \
+            __ASM_EMIT("cvttps2dq   %%xmm0, %%xmm0") \
+            __ASM_EMIT("cvtdq2ps    %%xmm0, %%xmm0")                    /* xmm0 = n = int(abs(y)/PI + 0.5) */ \
+            __ASM_EMIT("mulps       0x100 + %[MC], %%xmm0")             /* xmm0 = PI*n */ \
+            __ASM_EMIT("subps       %%xmm0, %%xmm2")                    /* xmm2 = abs(y) - PI*n */ \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm0") \
+            MATCHED_SIN_X4                                              /* xmm3 = sin(y) */ \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm3")                    /* xmm3 = sin(y)^2 */ \
+            __ASM_EMIT("mulps       %%xmm3, %%xmm1")                    /* xmm1 = 4*exp(x)*sin(y)^2 */ \
+            __ASM_EMIT("addps       0xa0(%[w]), %%xmm1")              /* xmm1 = Q = M*M + 4*exp(x)*sin(y)^2 */ \
+            __ASM_EMIT("sqrtps      %%xmm1, %%xmm0")                    /* xmm0 = sqrt(Q) */
+
+        /*
+         * Solve the batch of second-order polynoms, count should be multiple of 4:
+         *   p[0] = k, p[1] = -k*(exp(R0*T) + exp(R1*T)), p[2] = k*exp((R0+R1)*T) for real roots R0 and R1
+         *   p[0] = k, p[1] = -2*k*exp(R*T)*cos(K*T), p[2] = k*exp(2*R*T) for complex roots R+j*K and R-j*K
+         * Both cases are computed by the same formula
+         *   p[1] = -k*(exp(m - wr) + exp(m + wr))*cos(wc), p[2] = k*exp(m - wr)*exp(m + wr)
+         * where m = -R*T, wr = sqrt(D)*T/2 for D >= 0 and wc = sqrt(-D)*T/2 for D < 0
+         *
+         * The amplitude of the transformed polynom at the control frequency w is computed by roots:
+         *   A = abs(k) * sqrt(Q(m - wr, v - wc/2)) * sqrt(Q(m + wr, v + wc/2)), v = w/2
+         *   Q(x, y) = expm1(x)^2 + 4*exp(x)*sin(y)^2
+         * and p[3] receives the ratio of the continuous transfer function amplitude to A
+         */
+        static void matched_solve_x4(float * const *vp, size_t count, const float *w)
+        {
+            IF_ARCH_X86(float *p);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                // Load polynoms and transpose
+                __ASM_EMIT("mov         " __IF_32_64("0x00", "0x00") "(%[vp]), %[p]")
+                __ASM_EMIT("movups      0x00(%[p]), %%xmm0")            // xmm0 = p0[0] p1[0] p2[0] ?
+                __ASM_EMIT("mov         " __IF_32_64("0x04", "0x08") "(%[vp]), %[p]")
+                __ASM_EMIT("movups      0x00(%[p]), %%xmm1")            // xmm1 = p0[1] p1[1] p2[1] ?
+                __ASM_EMIT("mov         " __IF_32_64("0x08", "0x10") "(%[vp]), %[p]")
+                __ASM_EMIT("movups      0x00(%[p]), %%xmm2")            // xmm2 = p0[2] p1[2] p2[2] ?
+                __ASM_EMIT("mov         " __IF_32_64("0x0c", "0x18") "(%[vp]), %[p]")
+                __ASM_EMIT("movups      0x00(%[p]), %%xmm3")            // xmm3 = p0[3] p1[3] p2[3] ?
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+                __ASM_EMIT("movaps      %%xmm2, %%xmm5")
+                __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                // xmm0 = p0[0] p0[1] p1[0] p1[1]
+                __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                // xmm2 = p0[2] p0[3] p1[2] p1[3]
+                __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")                // xmm4 = p2[0] p2[1] ? ?
+                __ASM_EMIT("unpckhps    %%xmm3, %%xmm5")                // xmm5 = p2[2] p2[3] ? ?
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+                __ASM_EMIT("movlhps     %%xmm5, %%xmm4")                // xmm4 = P2
+                __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                // xmm0 = P0
+                __ASM_EMIT("movhlps     %%xmm1, %%xmm2")                // xmm2 = P1
+                // Transfer function
+                __ASM_EMIT("movaps      %%xmm4, 0x30(%[w])")            // K = P2
+                __ASM_EMIT("movaps      %%xmm4, %%xmm7")
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+                __ASM_EMIT("mulps       0x20 + %[MC], %%xmm7")          // xmm7 = P2*0.01
+                __ASM_EMIT("subps       %%xmm7, %%xmm1")                // xmm1 = B = P0 - P2*0.01
+                __ASM_EMIT("movaps      %%xmm2, %%xmm7")
+                __ASM_EMIT("mulps       0x30 + %[MC], %%xmm7")          // xmm7 = C = P1*0.1
+                __ASM_EMIT("mulps       %%xmm1, %%xmm1")                // xmm1 = B*B
+                __ASM_EMIT("mulps       %%xmm7, %%xmm7")                // xmm7 = C*C
+                __ASM_EMIT("addps       %%xmm1, %%xmm7")                // xmm7 = B*B + C*C
+                __ASM_EMIT("sqrtps      %%xmm7, %%xmm7")                // xmm7 = P3 = sqrt(B*B + C*C)
+                __ASM_EMIT("movaps      %%xmm7, 0x20(%[w])")
+                // Roots
+                __ASM_EMIT("divps       %%xmm4, %%xmm2")                // xmm2 = X = P1/P2
+                __ASM_EMIT("divps       %%xmm4, %%xmm0")                // xmm0 = Y = P0/P2
+                __ASM_EMIT("movaps      %%xmm2, %%xmm1")
+                __ASM_EMIT("mulps       0x40 + %[MC], %%xmm0")          // xmm0 = 4*Y
+                __ASM_EMIT("mulps       %%xmm1, %%xmm1")                // xmm1 = X*X
+                __ASM_EMIT("xorps       %%xmm3, %%xmm3")                // xmm3 = 0
+                __ASM_EMIT("subps       %%xmm0, %%xmm1")                // xmm1 = D = X*X - 4*Y
+                __ASM_EMIT("cmpleps     %%xmm1, %%xmm3")                // xmm3 = [D >= 0]
+                __ASM_EMIT("andps       0x10 + %[MC], %%xmm1")          // xmm1 = abs(D)
+                __ASM_EMIT("mulps       0x00(%[w]), %%xmm2")            // xmm2 = X*H
+                __ASM_EMIT("sqrtps      %%xmm1, %%xmm1")                // xmm1 = sqrt(abs(D))
+                __ASM_EMIT("xorps       0x00 + %[MC], %%xmm2")          // xmm2 = m = -X*H
+                __ASM_EMIT("mulps       0x00(%[w]), %%xmm1")            // xmm1 = W = sqrt(abs(D))*H
+                __ASM_EMIT("movaps      %%xmm1, %%xmm0")
+                __ASM_EMIT("andps       %%xmm3, %%xmm0")                // xmm0 = wr = W & [D >= 0]
+                __ASM_EMIT("andnps      %%xmm1, %%xmm3")                // xmm3 = wc = W & [D < 0]
+                __ASM_EMIT("movaps      %%xmm2, %%xmm4")
+                __ASM_EMIT("subps       %%xmm0, %%xmm2")                // xmm2 = m - wr
+                __ASM_EMIT("addps       %%xmm0, %%xmm4")                // xmm4 = m + wr
+                __ASM_EMIT("movaps      %%xmm3, 0x60(%[w])")
+                __ASM_EMIT("movaps      %%xmm2, 0x40(%[w])")
+                __ASM_EMIT("movaps      %%xmm4, 0x50(%[w])")
+                // Exponents
+                __ASM_EMIT("movaps      %%xmm2, %%xmm0")
+                EXP_CORE_X8                                             // xmm0 = E1 = exp(m - wr), xmm4 = E2 = exp(m + wr)
+                __ASM_EMIT("movaps      %%xmm0, 0x70(%[w])")
+                __ASM_EMIT("movaps      %%xmm4, 0x80(%[w])")
+                // Amplitude of the transformed polynom
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1")                // xmm1 = E1
+                __ASM_EMIT("movaps      0x10(%[w]), %%xmm2")            // xmm2 = v
+                __ASM_EMIT("movaps      0x60(%[w]), %%xmm3")            // xmm3 = wc
+                __ASM_EMIT("mulps       0x60 + %[MC], %%xmm3")          // xmm3 = wc/2
+                __ASM_EMIT("subps       %%xmm3, %%xmm2")                // xmm2 = v - wc/2
+                __ASM_EMIT("movaps      0x40(%[w]), %%xmm0")            // xmm0 = m - wr
+                MATCHED_AMP_X4                                          // xmm0 = sqrt(Q(m - wr, v - wc/2))
+                __ASM_EMIT("movaps      %%xmm0, 0x90(%[w])")
+                __ASM_EMIT("movaps      0x80(%[w]), %%xmm1")            // xmm1 = E2
+                __ASM_EMIT("movaps      0x10(%[w]), %%xmm2")            // xmm2 = v
+                __ASM_EMIT("movaps      0x60(%[w]), %%xmm3")            // xmm3 = wc
+                __ASM_EMIT("mulps       0x60 + %[MC], %%xmm3")          // xmm3 = wc/2
+                __ASM_EMIT("addps       %%xmm3, %%xmm2")                // xmm2 = v + wc/2
+                __ASM_EMIT("movaps      0x50(%[w]), %%xmm0")            // xmm0 = m + wr
+                MATCHED_AMP_X4                                          // xmm0 = sqrt(Q(m + wr, v + wc/2))
+                __ASM_EMIT("movaps      0x30(%[w]), %%xmm6")            // xmm6 = K
+                __ASM_EMIT("movaps      0x20(%[w]), %%xmm7")            // xmm7 = P3
+                __ASM_EMIT("movaps      %%xmm6, %%xmm1")
+                __ASM_EMIT("mulps       0x90(%[w]), %%xmm0")            // xmm0 = sqrt(Q1*Q2)
+                __ASM_EMIT("andps       0x10 + %[MC], %%xmm1")          // xmm1 = abs(K)
+                __ASM_EMIT("mulps       %%xmm1, %%xmm0")                // xmm0 = A = abs(K)*sqrt(Q1*Q2)
+                __ASM_EMIT("divps       %%xmm0, %%xmm7")                // xmm7 = P3' = P3/A
+                // Cosine: cos(wc) = sin(PI/2 - abs(wc - 2*PI*n))
+                __ASM_EMIT("movaps      0x60(%[w]), %%xmm4")            // xmm4 = wc
+                __ASM_EMIT("movaps      %%xmm4, %%xmm0")
+                __ASM_EMIT("mulps       0x50 + %[MC], %%xmm0")          // xmm0 = wc/(2*PI)
+                __ASM_EMIT("addps       0x60 + %[MC], %%xmm0")          // xmm0 = wc/(2*PI) + 0.5
+                __ASM_EMIT("cvttps2dq   %%xmm0, %%xmm0")
+                __ASM_EMIT("cvtdq2ps    %%xmm0, %%xmm0")                // xmm0 = n = int(wc/(2*PI) + 0.5)
+                __ASM_EMIT("mulps       0x70 + %[MC], %%xmm0")          // xmm0 = 2*PI*n
+                __ASM_EMIT("subps       %%xmm0, %%xmm4")                // xmm4 = wc - 2*PI*n
+                __ASM_EMIT("movaps      0x80 + %[MC], %%xmm0")          // xmm0 = PI/2
+                __ASM_EMIT("andps       0x10 + %[MC], %%xmm4")          // xmm4 = abs(wc - 2*PI*n)
+                __ASM_EMIT("subps       %%xmm4, %%xmm0")                // xmm0 = y = PI/2 - abs(wc - 2*PI*n)
+                MATCHED_SIN_X4                                          // xmm3 = cos(wc)
+                // Transformed polynom
+                __ASM_EMIT("movaps      0x70(%[w]), %%xmm5")            // xmm5 = E1
+                __ASM_EMIT("movaps      0x80(%[w]), %%xmm0")            // xmm0 = E2
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+                __ASM_EMIT("mulps       %%xmm5, %%xmm1")                // xmm1 = E1*E2
+                __ASM_EMIT("addps       %%xmm0, %%xmm5")                // xmm5 = E1+E2
+                __ASM_EMIT("mulps       %%xmm3, %%xmm5")                // xmm5 = (E1+E2)*cos(wc)
+                __ASM_EMIT("mulps       %%xmm6, %%xmm1")                // xmm1 = P2' = K*E1*E2
+                __ASM_EMIT("mulps       %%xmm6, %%xmm5")                // xmm5 = K*(E1+E2)*cos(wc)
+                __ASM_EMIT("xorps       0x00 + %[MC], %%xmm5")          // xmm5 = P1' = -K*(E1+E2)*cos(wc)
+                // Transpose back and store polynoms
+                __ASM_EMIT("movaps      %%xmm6, %%xmm0")
+                __ASM_EMIT("movaps      %%xmm1, %%xmm2")
+                __ASM_EMIT("unpcklps    %%xmm5, %%xmm6")                // xmm6 = p0[0] p1[0] p0[1] p1[1]
+                __ASM_EMIT("unpcklps    %%xmm7, %%xmm1")                // xmm1 = p2[0] p3[0] p2[1] p3[1]
+                __ASM_EMIT("unpckhps    %%xmm5, %%xmm0")                // xmm0 = p0[2] p1[2] p0[3] p1[3]
+                __ASM_EMIT("unpckhps    %%xmm7, %%xmm2")                // xmm2 = p2[2] p3[2] p2[3] p3[3]
+                __ASM_EMIT("movaps      %%xmm6, %%xmm5")
+                __ASM_EMIT("movaps      %%xmm0, %%xmm7")
+                __ASM_EMIT("movlhps     %%xmm1, %%xmm6")                // xmm6 = p0[0] p1[0] p2[0] p3[0]
+                __ASM_EMIT("movhlps     %%xmm5, %%xmm1")                // xmm1 = p0[1] p1[1] p2[1] p3[1]
+                __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                // xmm0 = p0[2] p1[2] p2[2] p3[2]
+                __ASM_EMIT("movhlps     %%xmm7, %%xmm2")                // xmm2 = p0[3] p1[3] p2[3] p3[3]
+                __ASM_EMIT("mov         " __IF_32_64("0x00", "0x00") "(%[vp]), %[p]")
+                __ASM_EMIT("movups      %%xmm6, 0x00(%[p])")
+                __ASM_EMIT("mov         " __IF_32_64("0x04", "0x08") "(%[vp]), %[p]")
+                __ASM_EMIT("movups      %%xmm1, 0x00(%[p])")
+                __ASM_EMIT("mov         " __IF_32_64("0x08", "0x10") "(%[vp]), %[p]")
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[p])")
+                __ASM_EMIT("mov         " __IF_32_64("0x0c", "0x18") "(%[vp]), %[p]")
+                __ASM_EMIT("movups      %%xmm2, 0x00(%[p])")
+                // Repeat loop
+                __ASM_EMIT("add         $" __IF_32_64("0x10", "0x20") ", %[vp]")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("jnz         1b")
+
+                : [vp] "+r" (vp), [count] "+r" (count),
+                  [p] "=&r" (p)
+                : [w] "r" (w),
+                  [MC] "o" (MATCHED_CONST),
+                  [E2C] "o" (EXP2_CONST),
+                  [LOG2E] "m" (EXP_LOG2E)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        static void matched_init(matched_ctx_t *ctx, float kf, float td)
+        {
+            float h         = 0.5f * kf * td;
+            float v         = 0.05f * kf * td;
+
+            for (size_t i=0; i<4; ++i)
+            {
+                ctx->w[i]       = h;
+                ctx->w[i+4]     = v;
+            }
+            ctx->n          = 0;
+        }
+
+        static void matched_flush(matched_ctx_t *ctx)
+        {
+            size_t n        = ctx->n;
+            if (n <= 0)
+                return;
+
+            // Pad the batch with the last polynom, it is loaded before the store
+            for ( ; n & 3; ++n)
+                ctx->vp[n]      = ctx->vp[n-1];
+
+            matched_solve_x4(ctx->vp, n, ctx->w);
+            ctx->n          = 0;
+        }
+
+        static void matched_solve(matched_ctx_t *ctx, float *p, float kf, float td, size_t count, size_t stride)
+        {
+            // The order of each polynom is tested individually
+            float s         = sinf(0.05f * kf * td);
+
+            while (count--)
+            {
+                if (p[2] != 0.0) // Test polynom for second-order
+                {
+                    // Second-order polynoms are collected into the batch
+                    ctx->vp[ctx->n++]   = p;
+                    if (ctx->n >= MATCHED_BATCH)
+                    {
+                        matched_solve_x4(ctx->vp, ctx->n, ctx->w);
+                        ctx->n              = 0;
+                    }
+                }
+                else if (p[1] != 0.0) // Test polynom for first order
+                {
+                    // First-order polynom:
+                    //   p(s) = p[0] + p[1]*(s/f)
+                    //
+                    // Transformed polynom:
+                    //   P[z] = p[1]/f - p[1]/f * exp(-f*p[0]*T/p[1]) * z^-1
+                    //
+                    // The p[3] receives the ratio of the continuous transfer function amplitude to
+                    // the amplitude of P[z] at the control frequency w computed by the root E:
+                    //   A = abs(p[1]/f) * sqrt(expm1(R*T)^2 + 4*E*sin(w/2)^2)
+                    float k     = p[1]/kf;
+                    float R     = -p[0]/k;
+                    float E     = expf(R*td);
+                    float M     = expm1f(R*td);
+                    float A     = fabsf(k) * sqrtf(M*M + 4.0f*E*s*s);
+
+                    p[3]        = sqrtf(p[0]*p[0] + p[1]*p[1]*0.01f) / A; // transfer function
+                    p[0]        = k;
+                    p[1]        = -k * E;
+                }
+                else
+                    p[3]        = 1.0f / fabsf(p[0]); // transfer function
+
+                p          += stride;
+            }
+        }
+
+        /*
+         * Compute the normalized filter for four cascades pointed by bc:
+         *   xmm0 = b0, xmm1 = b1, xmm2 = b2, xmm6 = a1, xmm7 = a2
+         */
+        #define MATCHED_NORM_X4 \
+            /* Load top part of cascades and transpose */ \
+            __ASM_EMIT("movups      0x00(%[bc]), %%xmm0")               /* xmm0 = t0[0] t1[0] t2[0] t3[0] */ \
+            __ASM_EMIT("movups      0x20(%[bc]), %%xmm1")               /* xmm1 = t0[1] t1[1] t2[1] t3[1] */ \
+            __ASM_EMIT("movups      0x40(%[bc]), %%xmm2")               /* xmm2 = t0[2] t1[2] t2[2] t3[2] */ \
+            __ASM_EMIT("movups      0x60(%[bc]), %%xmm3")               /* xmm3 = t0[3] t1[3] t2[3] t3[3] */ \
+            MATCHED_TRANSPOSE                                           /* xmm0 = t0, xmm2 = t1, xmm4 = t2, xmm5 = t3 */ \
+            __ASM_EMIT("movaps      %%xmm0, 0x20(%[w])") \
+            __ASM_EMIT("movaps      %%xmm2, 0x30(%[w])") \
+            __ASM_EMIT("movaps      %%xmm4, 0x40(%[w])") \
+            __ASM_EMIT("movaps      %%xmm5, 0x50(%[w])") \
+            /* Load bottom part of cascades and transpose */ \
+            __ASM_EMIT("movups      0x10(%[bc]), %%xmm0")               /* xmm0 = b0[0] b1[0] b2[0] b3[0] */ \
+            __ASM_EMIT("movups      0x30(%[bc]), %%xmm1")               /* xmm1 = b0[1] b1[1] b2[1] b3[1] */ \
+            __ASM_EMIT("movups      0x50(%[bc]), %%xmm2")               /* xmm2 = b0[2] b1[2] b2[2] b3[2] */ \
+            __ASM_EMIT("movups      0x70(%[bc]), %%xmm3")               /* xmm3 = b0[3] b1[3] b2[3] b3[3] */ \
+            MATCHED_TRANSPOSE                                           /* xmm0 = b0, xmm2 = b1, xmm4 = b2, xmm5 = b3 */ \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm6")                    /* xmm6 = b1 */ \
+            __ASM_EMIT("movaps      %%xmm4, %%xmm7")                    /* xmm7 = b2 */ \
+            __ASM_EMIT("movaps      0x50(%[w]), %%xmm4")                /* xmm4 = t3 */ \
+            __ASM_EMIT("movaps      0xe0 + %[MC], %%xmm1")              /* xmm1 = 1 */ \
+            __ASM_EMIT("divps       %%xmm5, %%xmm4")                    /* xmm4 = AN = t3/b3 */ \
+            __ASM_EMIT("divps       %%xmm0, %%xmm1")                    /* xmm1 = N2 = 1/b0 */ \
+            __ASM_EMIT("mulps       %%xmm1, %%xmm4")                    /* xmm4 = N1 = AN*N2 */ \
+            __ASM_EMIT("xorps       0x00 + %[MC], %%xmm1")              /* xmm1 = -N2 */ \
+            __ASM_EMIT("mulps       %%xmm1, %%xmm6")                    /* xmm6 = a1 = -b1*N2 */ \
+            __ASM_EMIT("mulps       %%xmm1, %%xmm7")                    /* xmm7 = a2 = -b2*N2 */ \
+            __ASM_EMIT("movaps      0x20(%[w]), %%xmm0")                /* xmm0 = t0 */ \
+            __ASM_EMIT("movaps      0x30(%[w]), %%xmm1")                /* xmm1 = t1 */ \
+            __ASM_EMIT("movaps      0x40(%[w]), %%xmm2")                /* xmm2 = t2 */ \
+            __ASM_EMIT("mulps       %%xmm4, %%xmm0")                    /* xmm0 = b0 = t0*N1 */ \
+            __ASM_EMIT("mulps       %%xmm4, %%xmm1")                    /* xmm1 = b1 = t1*N1 */ \
+            __ASM_EMIT("mulps       %%xmm4, %%xmm2")                    /* xmm2 = b2 = t2*N1 */
+
+        /*
+         * Transpose 4x4 matrix stored in xmm0..xmm3, the result is stored in xmm0, xmm2, xmm4, xmm5
+         */
+        #define MATCHED_TRANSPOSE \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4") \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5") \
+            __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                    /* xmm0 = a0 b0 a1 b1 */ \
+            __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                    /* xmm2 = c0 d0 c1 d1 */ \
+            __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")                    /* xmm4 = a2 b2 a3 b3 */ \
+            __ASM_EMIT("unpckhps    %%xmm3, %%xmm5")                    /* xmm5 = c2 d2 c3 d3 */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm4, %%xmm3") \
+            __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                    /* xmm0 = a0 b0 c0 d0 */ \
+            __ASM_EMIT("movhlps     %%xmm1, %%xmm2")                    /* xmm2 = a1 b1 c1 d1 */ \
+            __ASM_EMIT("movlhps     %%xmm5, %%xmm4")                    /* xmm4 = a2 b2 c2 d2 */ \
+            __ASM_EMIT("movhlps     %%xmm3, %%xmm5")                    /* xmm5 = a3 b3 c3 d3 */
+
+        static void matched_norm_x1(dsp::biquad_x1_t *bf, const dsp::f_cascade_t *bc, float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                // Transpose and store
+                __ASM_EMIT("movaps      %%xmm0, %%xmm5")
+                __ASM_EMIT("movaps      %%xmm2, %%xmm4")
+                __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                // xmm0 = b0[0] b1[0] b0[1] b1[1]
+                __ASM_EMIT("unpcklps    %%xmm6, %%xmm2")                // xmm2 = b2[0] a1[0] b2[1] a1[1]
+                __ASM_EMIT("unpckhps    %%xmm1, %%xmm5")                // xmm5 = b0[2] b1[2] b0[3] b1[3]
+                __ASM_EMIT("unpckhps    %%xmm6, %%xmm4")                // xmm4 = b2[2] a1[2] b2[3] a1[3]
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+                __ASM_EMIT("movaps      %%xmm5, %%xmm3")
+                __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                // xmm0 = b0[0] b1[0] b2[0] a1[0]
+                __ASM_EMIT("movhlps     %%xmm1, %%xmm2")                // xmm2 = b0[1] b1[1] b2[1] a1[1]
+                __ASM_EMIT("movlhps     %%xmm4, %%xmm5")                // xmm5 = b0[2] b1[2] b2[2] a1[2]
+                __ASM_EMIT("movhlps     %%xmm3, %%xmm4")                // xmm4 = b0[3] b1[3] b2[3] a1[3]
+                __ASM_EMIT("xorps       %%xmm1, %%xmm1")                // xmm1 = 0 0 0 0
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[bf])")
+                __ASM_EMIT("movss       %%xmm7, %%xmm1")                // xmm1 = a2[0] 0 0 0
+                __ASM_EMIT("psrldq      $4, %%xmm7")
+                __ASM_EMIT("movups      %%xmm1, 0x10(%[bf])")
+                __ASM_EMIT("movups      %%xmm2, 0x20(%[bf])")
+                __ASM_EMIT("movss       %%xmm7, %%xmm1")                // xmm1 = a2[1] 0 0 0
+                __ASM_EMIT("psrldq      $4, %%xmm7")
+                __ASM_EMIT("movups      %%xmm1, 0x30(%[bf])")
+                __ASM_EMIT("movups      %%xmm5, 0x40(%[bf])")
+                __ASM_EMIT("movss       %%xmm7, %%xmm1")                // xmm1 = a2[2] 0 0 0
+                __ASM_EMIT("psrldq      $4, %%xmm7")
+                __ASM_EMIT("movups      %%xmm1, 0x50(%[bf])")
+                __ASM_EMIT("movups      %%xmm4, 0x60(%[bf])")
+                __ASM_EMIT("movss       %%xmm7, %%xmm1")                // xmm1 = a2[3] 0 0 0
+                __ASM_EMIT("movups      %%xmm1, 0x70(%[bf])")
+                // Repeat loop
+                __ASM_EMIT("add         $0x80, %[bc]")
+                __ASM_EMIT("add         $0x80, %[bf]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jnz         1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w),
+                  [MC] "o" (MATCHED_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        static void matched_norm_x2(dsp::biquad_x2_t *bf, const dsp::f_cascade_t *bc, float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                __ASM_EMIT("xorps       %%xmm3, %%xmm3")
+                __ASM_EMIT("movlps      %%xmm0, 0x00(%[bf])")
+                __ASM_EMIT("movlps      %%xmm1, 0x08(%[bf])")
+                __ASM_EMIT("movlps      %%xmm2, 0x10(%[bf])")
+                __ASM_EMIT("movlps      %%xmm6, 0x18(%[bf])")
+                __ASM_EMIT("movlps      %%xmm7, 0x20(%[bf])")
+                __ASM_EMIT("movlps      %%xmm3, 0x28(%[bf])")
+                __ASM_EMIT("movhps      %%xmm0, 0x30(%[bf])")
+                __ASM_EMIT("movhps      %%xmm1, 0x38(%[bf])")
+                __ASM_EMIT("movhps      %%xmm2, 0x40(%[bf])")
+                __ASM_EMIT("movhps      %%xmm6, 0x48(%[bf])")
+                __ASM_EMIT("movhps      %%xmm7, 0x50(%[bf])")
+                __ASM_EMIT("movlps      %%xmm3, 0x58(%[bf])")
+                // Repeat loop
+                __ASM_EMIT("add         $0x80, %[bc]")
+                __ASM_EMIT("add         $0x60, %[bf]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jnz         1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w),
+                  [MC] "o" (MATCHED_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        static void matched_norm_x4(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[bf])")
+                __ASM_EMIT("movups      %%xmm1, 0x10(%[bf])")
+                __ASM_EMIT("movups      %%xmm2, 0x20(%[bf])")
+                __ASM_EMIT("movups      %%xmm6, 0x30(%[bf])")
+                __ASM_EMIT("movups      %%xmm7, 0x40(%[bf])")
+                // Repeat loop
+                __ASM_EMIT("add         $0x80, %[bc]")
+                __ASM_EMIT("add         $0x50, %[bf]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jnz         1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w),
+                  [MC] "o" (MATCHED_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        static void matched_norm_x8(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                MATCHED_NORM_X4
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[bf])")
+                __ASM_EMIT("movups      %%xmm1, 0x20(%[bf])")
+                __ASM_EMIT("movups      %%xmm2, 0x40(%[bf])")
+                __ASM_EMIT("movups      %%xmm6, 0x60(%[bf])")
+                __ASM_EMIT("movups      %%xmm7, 0x80(%[bf])")
+                __ASM_EMIT("add         $0x80, %[bc]")
+                MATCHED_NORM_X4
+                __ASM_EMIT("movups      %%xmm0, 0x10(%[bf])")
+                __ASM_EMIT("movups      %%xmm1, 0x30(%[bf])")
+                __ASM_EMIT("movups      %%xmm2, 0x50(%[bf])")
+                __ASM_EMIT("movups      %%xmm6, 0x70(%[bf])")
+                __ASM_EMIT("movups      %%xmm7, 0x90(%[bf])")
+                // Repeat loop
+                __ASM_EMIT("add         $0x80, %[bc]")
+                __ASM_EMIT("add         $0xa0, %[bf]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jnz         1b")
+
+                : [bf] "+r" (bf), [bc] "+r" (bc), [count] "+r" (count)
+                : [w] "r" (w),
+                  [MC] "o" (MATCHED_CONST)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef MATCHED_TRANSPOSE
+        #undef MATCHED_NORM_X4
+        #undef MATCHED_AMP_X4
+        #undef MATCHED_SIN_X4
+
+        void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Find roots for top and bottom polynoms
+            matched_solve(&ctx, bc->t, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
+            matched_solve(&ctx, bc->b, kf, td, count, sizeof(dsp::f_cascade_t)/sizeof(float));
+            matched_flush(&ctx);
+
+            // Normalize filters, the tail is processed by padding to the full block
+            size_t blocks   = count >> 2;
+            if (blocks > 0)
+            {
+                matched_norm_x1(bf, bc, ctx.w, blocks);
+                bf             += blocks << 2;
+                bc             += blocks << 2;
+            }
+
+            count          &= 3;
+            if (count > 0)
+            {
+                dsp::f_cascade_t xc[4];
+                dsp::biquad_x1_t xf[4];
+
+                for (size_t i=0; i<4; ++i)
+                    xc[i]           = bc[lsp_min(i, count - 1)];
+                matched_norm_x1(xf, xc, ctx.w, 1);
+                for (size_t i=0; i<count; ++i)
+                    bf[i]           = xf[i];
+            }
+        }
+
+        void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Solve filters
+            for (size_t i=0; i<2; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*3];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 1, (2*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 1, (2*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters, the tail is processed by padding to the full block
+            size_t blocks   = count >> 1;
+            if (blocks > 0)
+            {
+                matched_norm_x2(bf, bc, ctx.w, blocks);
+                bf             += blocks << 1;
+                bc             += blocks << 2;
+            }
+
+            if (count & 1)
+            {
+                dsp::f_cascade_t xc[4];
+                dsp::biquad_x2_t xf[2];
+
+                xc[0]           = bc[0];
+                xc[1]           = bc[1];
+                xc[2]           = bc[1];
+                xc[3]           = bc[1];
+                matched_norm_x2(xf, xc, ctx.w, 1);
+                bf[0]           = xf[0];
+            }
+        }
+
+        void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Solve filters
+            for (size_t i=0; i<4; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*5];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 3, (4*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 3, (4*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters
+            if (count > 0)
+                matched_norm_x4(bf, bc, ctx.w, count);
+        }
+
+        void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count)
+        {
+            matched_ctx_t ctx;
+            matched_init(&ctx, kf, td);
+
+            // Solve filters
+            for (size_t i=0; i<8; ++i)
+            {
+                dsp::f_cascade_t *xc = &bc[i*9];
+
+                // Find roots for top and bottom polynoms
+                matched_solve(&ctx, xc->t, kf, td, count - 7, (8*sizeof(dsp::f_cascade_t))/sizeof(float));
+                matched_solve(&ctx, xc->b, kf, td, count - 7, (8*sizeof(dsp::f_cascade_t))/sizeof(float));
+            }
+            matched_flush(&ctx);
+
+            // Normalize filters
+            if (count > 0)
+                matched_norm_x8(bf, bc, ctx.w, count);
+        }
+
+    } /* namespace sse2 */
+} /* namespace lsp */
+
+#undef MATCHED_BATCH
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_FILTERS_TRANSFORM_H_ */
@@ -61,6 +61,7 @@
         #include <private/dsp/arch/aarch64/asimd/filters/static.h>
         #include <private/dsp/arch/aarch64/asimd/filters/transfer.h>
         #include <private/dsp/arch/aarch64/asimd/filters/transform.h>
+        #include <private/dsp/arch/aarch64/asimd/filters/svf.h>
         #include <private/dsp/arch/aarch64/asimd/float.h>
         #include <private/dsp/arch/aarch64/asimd/graphics/axis.h>
         #include <private/dsp/arch/aarch64/asimd/graphics/colors.h>
@@ -74,6 +75,7 @@
         #include <private/dsp/arch/aarch64/asimd/msmatrix.h>
         #include <private/dsp/arch/aarch64/asimd/pcomplex.h>
         #include <private/dsp/arch/aarch64/asimd/pfft.h>
+        #include <private/dsp/arch/aarch64/asimd/rfft.h>
         #include <private/dsp/arch/aarch64/asimd/pmath/abs_vv.h>
         #include <private/dsp/arch/aarch64/asimd/pmath/exp.h>
         #include <private/dsp/arch/aarch64/asimd/pmath/fmop_kx.h>
@@ -283,6 +285,7 @@
 
                 EXPORT1(h_dotp);
                 EXPORT1(h_abs_dotp);
+                EXPORT1(h_lerp_dotp);
                 EXPORT1(h_sqr_dotp);
 
                 EXPORT1(logb1);
@@ -379,6 +382,8 @@
 
                 EXPORT1(packed_direct_fft);
                 EXPORT1(packed_reverse_fft);
+                EXPORT1(real_direct_fft);
+                EXPORT1(real_reverse_fft);
 
                 EXPORT1(fastconv_parse);
                 EXPORT1(fastconv_restore);
@@ -389,12 +394,16 @@
                 EXPORT1(biquad_process_x2);
                 EXPORT1(biquad_process_x4);
                 EXPORT1(biquad_process_x8);
+                EXPORT1(biquad_process_mc8);
 
                 EXPORT1(dyn_biquad_process_x1);
                 EXPORT1(dyn_biquad_process_x2);
                 EXPORT1(dyn_biquad_process_x4);
                 EXPORT1(dyn_biquad_process_x8);
 
+                EXPORT1(svf_process_x4);
+                EXPORT1(svf_process_x8);
+
                 EXPORT1(filter_transfer_calc_ri);
                 EXPORT1(filter_transfer_apply_ri);
                 EXPORT1(filter_transfer_calc_pc);
@@ -409,6 +418,10 @@
                 EXPORT1(bilinear_transform_x2);
                 EXPORT1(bilinear_transform_x4);
                 EXPORT1(bilinear_transform_x8);
+                EXPORT1(matched_transform_x1);
+                EXPORT1(matched_transform_x2);
+                EXPORT1(matched_transform_x4);
+                EXPORT1(matched_transform_x8);
 
                 EXPORT1(lanczos_resample_2x2);
                 EXPORT1(lanczos_resample_2x3);
@@ -444,6 +457,7 @@
                 EXPORT1(convolve);
                 EXPORT1(corr_init);
                 EXPORT1(corr_incr);
+                EXPORT1(corr_lags_incr);
 
                 EXPORT1(abgr32_to_bgrff32);
                 EXPORT1(rgba32_to_bgra32);
@@ -54,11 +54,14 @@
         #include <private/dsp/arch/arm/neon-d32/copy.h>
         #include <private/dsp/arch/arm/neon-d32/dynamics.h>
         #include <private/dsp/arch/arm/neon-d32/fastconv.h>
+        #include <private/dsp/arch/arm/neon-d32/fir.h>
         #include <private/dsp/arch/arm/neon-d32/fft.h>
+        #include <private/dsp/arch/arm/neon-d32/rfft.h>
         #include <private/dsp/arch/arm/neon-d32/filters/dynamic.h>
         #include <private/dsp/arch/arm/neon-d32/filters/static.h>
         #include <private/dsp/arch/arm/neon-d32/filters/transfer.h>
         #include <private/dsp/arch/arm/neon-d32/filters/transform.h>
+        #include <private/dsp/arch/arm/neon-d32/filters/svf.h>
         #include <private/dsp/arch/arm/neon-d32/float.h>
         #include <private/dsp/arch/arm/neon-d32/graphics/axis.h>
         #include <private/dsp/arch/arm/neon-d32/graphics/colors.h>
@@ -146,6 +149,8 @@
                 EXPORT1(convolve);
                 EXPORT1(corr_init);
                 EXPORT1(corr_incr);
+                EXPORT1(fir_interpolate);
+                EXPORT1(fir_decimate);
 
                 EXPORT1(axis_apply_lin1);
                 EXPORT1(axis_apply_log1);
@@ -317,6 +322,7 @@
 
                 EXPORT1(h_dotp);
                 EXPORT1(h_abs_dotp);
+                EXPORT1(h_lerp_dotp);
                 EXPORT1(h_sqr_dotp);
 
                 EXPORT1(saturate);
@@ -381,12 +387,16 @@
                 EXPORT1(biquad_process_x2);
                 EXPORT1(biquad_process_x4);
                 EXPORT1(biquad_process_x8);
+                EXPORT1(biquad_process_mc8);
 
                 EXPORT1(dyn_biquad_process_x1);
                 EXPORT1(dyn_biquad_process_x2);
                 EXPORT1(dyn_biquad_process_x4);
                 EXPORT1(dyn_biquad_process_x8);
 
+                EXPORT1(svf_process_x4);
+                EXPORT1(svf_process_x8);
+
                 EXPORT1(filter_transfer_calc_ri);
                 EXPORT1(filter_transfer_apply_ri);
                 EXPORT1(filter_transfer_calc_pc);
@@ -396,6 +406,10 @@
                 EXPORT1(bilinear_transform_x2);
                 EXPORT1(bilinear_transform_x4);
                 EXPORT1(bilinear_transform_x8);
+                EXPORT1(matched_transform_x1);
+                EXPORT1(matched_transform_x2);
+                EXPORT1(matched_transform_x4);
+                EXPORT1(matched_transform_x8);
 
                 EXPORT1(direct_fft);
                 EXPORT1(reverse_fft);
@@ -403,6 +417,8 @@
                 EXPORT1(normalize_fft3);
                 EXPORT1(packed_direct_fft);
                 EXPORT1(packed_reverse_fft);
+                EXPORT1(real_direct_fft);
+                EXPORT1(real_reverse_fft);
 
                 EXPORT1(fastconv_parse);
                 EXPORT1(fastconv_restore);
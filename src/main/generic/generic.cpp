@@ -20,6 +20,7 @@
  */
 
 #include <private/dsp/exports.h>
+#include <lsp-plug.in/common/atomic.h>
 #include <lsp-plug.in/common/bits.h>
 #include <lsp-plug.in/dsp/dsp.h>
 #include <lsp-plug.in/stdlib/math.h>
@@ -66,11 +67,23 @@ namespace lsp
     #include <private/dsp/arch/generic/filters/dynamic.h>
     #include <private/dsp/arch/generic/filters/transform.h>
     #include <private/dsp/arch/generic/filters/transfer.h>
+    #include <private/dsp/arch/generic/filters/svf.h>
 
     #include <private/dsp/arch/generic/fft.h>
+    #include <private/dsp/arch/generic/rfft.h>
+    #include <private/dsp/arch/generic/fft_plan.h>
+    #include <private/dsp/arch/generic/mixed_fft.h>
+    #include <private/dsp/arch/generic/batch_fft.h>
+    #include <private/dsp/arch/generic/parallel_fft.h>
+    #include <private/dsp/arch/generic/stft.h>
     #include <private/dsp/arch/generic/fastconv.h>
+    #include <private/dsp/arch/generic/convolver.h>
+    #include <private/dsp/arch/generic/fir.h>
+    #include <private/dsp/arch/generic/resampler.h>
+    #include <private/dsp/arch/generic/oversampler.h>
     #include <private/dsp/arch/generic/float.h>
     #include <private/dsp/arch/generic/resampling.h>
+    #include <private/dsp/arch/generic/lanczos.h>
     #include <private/dsp/arch/generic/msmatrix.h>
     #include <private/dsp/arch/generic/smath.h>
     #include <private/dsp/arch/generic/mix.h>
@@ -255,6 +268,7 @@ namespace lsp
             EXPORT1(h_dotp);
             EXPORT1(h_sqr_dotp);
             EXPORT1(h_abs_dotp);
+            EXPORT1(h_lerp_dotp);
 
             EXPORT1(fmadd_k3);
             EXPORT1(fmsub_k3);
@@ -312,6 +326,32 @@ namespace lsp
             EXPORT1(packed_direct_fft);
             EXPORT1(reverse_fft);
             EXPORT1(packed_reverse_fft);
+            EXPORT1(real_direct_fft);
+            EXPORT1(real_reverse_fft);
+            EXPORT1(fft_plan_size);
+            EXPORT1(fft_plan_init);
+            EXPORT1(fft_plan_direct);
+            EXPORT1(fft_plan_reverse);
+            EXPORT1(fft_plan_packed_direct);
+            EXPORT1(fft_plan_packed_reverse);
+            EXPORT1(mixed_fft_plan_size);
+            EXPORT1(mixed_fft_plan_init);
+            EXPORT1(mixed_direct_fft);
+            EXPORT1(mixed_reverse_fft);
+            EXPORT1(packed_mixed_direct_fft);
+            EXPORT1(packed_mixed_reverse_fft);
+            EXPORT1(batch_direct_fft);
+            EXPORT1(batch_reverse_fft);
+            EXPORT1(parallel_fft_plan_size);
+            EXPORT1(parallel_fft_plan_init);
+            EXPORT1(parallel_direct_fft);
+            EXPORT1(parallel_reverse_fft);
+            EXPORT1(parallel_direct_fft_pass);
+            EXPORT1(parallel_reverse_fft_pass);
+            EXPORT1(stft_size);
+            EXPORT1(stft_init);
+            EXPORT1(stft_reset);
+            EXPORT1(stft_process);
             EXPORT1(normalize_fft3);
             EXPORT1(normalize_fft2);
             EXPORT1(center_fft);
@@ -322,6 +362,47 @@ namespace lsp
             EXPORT1(fastconv_parse_apply);
             EXPORT1(fastconv_restore);
             EXPORT1(fastconv_apply);
+            EXPORT1(fastconv_fmadd);
+            EXPORT1(convolver_size);
+            EXPORT1(convolver_init);
+            EXPORT1(convolver_reset);
+            EXPORT1(convolver_process);
+            EXPORT1(mconvolver_size);
+            EXPORT1(mconvolver_init);
+            EXPORT1(mconvolver_reset);
+            EXPORT1(mconvolver_process);
+            EXPORT1(nu_convolver_size);
+            EXPORT1(nu_convolver_init);
+            EXPORT1(nu_convolver_reset);
+            EXPORT1(nu_convolver_process);
+            EXPORT1(nu_convolver_set_background);
+            EXPORT1(nu_convolver_set_notify);
+            EXPORT1(nu_convolver_background);
+            EXPORT1(fir_direct);
+            EXPORT1(fir_direct_x2);
+            EXPORT1(fir_size);
+            EXPORT1(fir_init);
+            EXPORT1(fir_reset);
+            EXPORT1(fir_process);
+            EXPORT1(fir_interpolate);
+            EXPORT1(fir_decimate);
+            EXPORT1(fir_interpolator_size);
+            EXPORT1(fir_interpolator_init);
+            EXPORT1(fir_interpolator_reset);
+            EXPORT1(fir_interpolator_process);
+            EXPORT1(fir_decimator_size);
+            EXPORT1(fir_decimator_init);
+            EXPORT1(fir_decimator_reset);
+            EXPORT1(fir_decimator_process);
+            EXPORT1(resampler_size);
+            EXPORT1(resampler_init);
+            EXPORT1(resampler_set_ratio);
+            EXPORT1(resampler_reset);
+            EXPORT1(resampler_process);
+            EXPORT1(oversampler_size);
+            EXPORT1(oversampler_init);
+            EXPORT1(oversampler_reset);
+            EXPORT1(oversampler_process);
 
             EXPORT1(complex_mul2);
             EXPORT1(complex_mul3);
@@ -356,6 +437,7 @@ namespace lsp
             EXPORT1(pcomplex_c2r_mul2);
             EXPORT1(pcomplex_c2r_div2);
             EXPORT1(pcomplex_c2r_rdiv2);
+            EXPORT1(pcomplex_c2r_fmadd3);
 
             EXPORT1(pcomplex_r2c_add2);
             EXPORT1(pcomplex_r2c_sub2);
@@ -363,6 +445,7 @@ namespace lsp
             EXPORT1(pcomplex_r2c_mul2);
             EXPORT1(pcomplex_r2c_div2);
             EXPORT1(pcomplex_r2c_rdiv2);
+            EXPORT1(pcomplex_r2c_mul3);
 
             EXPORT1(lr_to_ms);
             EXPORT1(lr_to_mid);
@@ -375,11 +458,28 @@ namespace lsp
             EXPORT1(biquad_process_x2);
             EXPORT1(biquad_process_x4);
             EXPORT1(biquad_process_x8);
+            EXPORT1(biquad_process_x16);
+            EXPORT1(biquad_process_mc8);
 
             EXPORT1(dyn_biquad_process_x1);
             EXPORT1(dyn_biquad_process_x2);
             EXPORT1(dyn_biquad_process_x4);
             EXPORT1(dyn_biquad_process_x8);
+            EXPORT1(dyn_biquad_lerp_x1);
+            EXPORT1(dyn_biquad_lerp_x2);
+            EXPORT1(dyn_biquad_lerp_x4);
+            EXPORT1(dyn_biquad_lerp_x8);
+            EXPORT1(dyn_cascade_lerp_x1);
+            EXPORT1(dyn_cascade_lerp_x2);
+            EXPORT1(dyn_cascade_lerp_x4);
+            EXPORT1(dyn_cascade_lerp_x8);
+
+            EXPORT1(svf_process_x1);
+            EXPORT1(svf_process_x4);
+            EXPORT1(svf_process_x8);
+            EXPORT1(svf_lerp_x1);
+            EXPORT1(svf_lerp_x4);
+            EXPORT1(svf_lerp_x8);
 
             EXPORT1(filter_transfer_calc_ri);
             EXPORT1(filter_transfer_apply_ri);
@@ -454,6 +554,10 @@ namespace lsp
             EXPORT1(lanczos_resample_8x16bit);
             EXPORT1(lanczos_resample_8x24bit);
 
+            EXPORT1(lanczos_kernel_size);
+            EXPORT1(lanczos_kernel_init);
+            EXPORT1(lanczos_resample);
+
             EXPORT1(downsample_2x);
             EXPORT1(downsample_3x);
             EXPORT1(downsample_4x);
@@ -611,8 +715,18 @@ namespace lsp
             EXPORT1(unit_vector_p1pv);
 
             EXPORT1(convolve);
+            EXPORT1(convolve_fft_threshold);
+            EXPORT1(convolve_fft_size);
+            EXPORT1(convolve_fft);
+            EXPORT1(convolve_auto);
             EXPORT1(corr_init);
             EXPORT1(corr_incr);
+            EXPORT1(corr_lags_init);
+            EXPORT1(corr_lags_incr);
+            EXPORT1(xcorr_size);
+            EXPORT1(xcorr);
+            EXPORT1(autocorr_size);
+            EXPORT1(autocorr);
 
             EXPORT1(base64_enc);
             EXPORT1(base64_dec);
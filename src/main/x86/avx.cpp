@@ -60,17 +60,23 @@
 
         #include <private/dsp/arch/x86/avx/fft.h>
         #include <private/dsp/arch/x86/avx/pfft.h>
+        #include <private/dsp/arch/x86/avx/fft_plan.h>
+        #include <private/dsp/arch/x86/avx/mixed_fft.h>
+        #include <private/dsp/arch/x86/avx/batch_fft.h>
+        #include <private/dsp/arch/x86/avx/rfft.h>
         #include <private/dsp/arch/x86/avx/fastconv.h>
 
         #include <private/dsp/arch/x86/avx/filters/static.h>
         #include <private/dsp/arch/x86/avx/filters/dynamic.h>
         #include <private/dsp/arch/x86/avx/filters/transform.h>
         #include <private/dsp/arch/x86/avx/filters/transfer.h>
+        #include <private/dsp/arch/x86/avx/filters/svf.h>
 
         #include <private/dsp/arch/x86/avx/msmatrix.h>
         #include <private/dsp/arch/x86/avx/resampling.h>
         #include <private/dsp/arch/x86/avx/convolution.h>
         #include <private/dsp/arch/x86/avx/correlation.h>
+        #include <private/dsp/arch/x86/avx/fir.h>
 
         #include <private/dsp/arch/x86/avx/interpolation/linear.h>
 
@@ -299,17 +305,25 @@
                 CEXPORT1(favx, pcomplex_r2c_mul2);
                 CEXPORT1(favx, pcomplex_r2c_div2);
                 CEXPORT1(favx, pcomplex_r2c_rdiv2);
+                CEXPORT1(favx, pcomplex_r2c_mul3);
+                CEXPORT1(favx, pcomplex_c2r_fmadd3);
                 CEXPORT1(favx, pcomplex_corr);
 
                 CEXPORT1(favx, biquad_process_x1);
                 CEXPORT1(favx, biquad_process_x2);
                 CEXPORT1(favx, biquad_process_x4);
                 EXPORT2_X64(biquad_process_x8, x64_biquad_process_x8);
+                CEXPORT1(favx, biquad_process_mc8);
 
                 CEXPORT1(favx, dyn_biquad_process_x1);
                 CEXPORT1(favx, dyn_biquad_process_x2);
                 CEXPORT1(favx, dyn_biquad_process_x4);
                 EXPORT2_X64(dyn_biquad_process_x8, x64_dyn_biquad_process_x8);
+                CEXPORT1(favx, dyn_biquad_lerp_x8);
+                CEXPORT1(favx, dyn_cascade_lerp_x8);
+
+                CEXPORT1(favx, svf_process_x8);
+                CEXPORT1(favx, svf_lerp_x8);
 
                 CEXPORT1(favx, bilinear_transform_x1);
                 CEXPORT1(favx, bilinear_transform_x2);
@@ -323,6 +337,7 @@
                 CEXPORT1(favx, h_dotp);
                 CEXPORT1(favx, h_sqr_dotp);
                 CEXPORT1(favx, h_abs_dotp);
+                CEXPORT1(favx, h_lerp_dotp);
 
                 CEXPORT1(favx, mix2);
                 CEXPORT1(favx, mix_copy2);
@@ -361,11 +376,24 @@
 
                 CEXPORT1(favx, packed_direct_fft);
                 CEXPORT1(favx, packed_reverse_fft);
+                CEXPORT1(favx, real_direct_fft);
+                CEXPORT1(favx, real_reverse_fft);
+                CEXPORT1(favx, fft_plan_direct);
+                CEXPORT1(favx, fft_plan_reverse);
+                CEXPORT1(favx, fft_plan_packed_direct);
+                CEXPORT1(favx, fft_plan_packed_reverse);
+                CEXPORT2_X64(favx, mixed_direct_fft, x64_mixed_direct_fft);
+                CEXPORT2_X64(favx, mixed_reverse_fft, x64_mixed_reverse_fft);
+                CEXPORT2_X64(favx, packed_mixed_direct_fft, x64_packed_mixed_direct_fft);
+                CEXPORT2_X64(favx, packed_mixed_reverse_fft, x64_packed_mixed_reverse_fft);
+                CEXPORT2_X64(favx, batch_direct_fft, x64_batch_direct_fft);
+                CEXPORT2_X64(favx, batch_reverse_fft, x64_batch_reverse_fft);
 
                 CEXPORT1(favx, fastconv_parse);
                 CEXPORT1(favx, fastconv_restore);
                 CEXPORT1(favx, fastconv_apply);
                 CEXPORT1(favx, fastconv_parse_apply);
+                CEXPORT1(favx, fastconv_fmadd);
 
                 CEXPORT1(favx, filter_transfer_calc_ri);
                 CEXPORT1(favx, filter_transfer_apply_ri);
@@ -404,8 +432,13 @@
                 CEXPORT1(favx, downsample_8x);
 
                 CEXPORT1(favx, convolve);
+                CEXPORT1(favx, convolve_fft_threshold);
                 CEXPORT1(favx, corr_init);
                 CEXPORT1(favx, corr_incr);
+                CEXPORT1(favx, fir_direct);
+                CEXPORT1(favx, fir_direct_x2);
+                CEXPORT1(favx, fir_interpolate);
+                CEXPORT1(favx, fir_decimate);
 
                 CEXPORT1(favx, lin_inter_set);
                 CEXPORT1(favx, lin_inter_mul2);
@@ -487,11 +520,18 @@
                     CEXPORT2(favx, reverse_fft, reverse_fft_fma3);
                     CEXPORT2(favx, packed_direct_fft, packed_direct_fft_fma3);
                     CEXPORT2(favx, packed_reverse_fft, packed_reverse_fft_fma3);
+                    CEXPORT2(favx, real_direct_fft, real_direct_fft_fma3);
+                    CEXPORT2(favx, real_reverse_fft, real_reverse_fft_fma3);
+                    CEXPORT2(favx, fft_plan_direct, fft_plan_direct_fma3);
+                    CEXPORT2(favx, fft_plan_reverse, fft_plan_reverse_fma3);
+                    CEXPORT2(favx, fft_plan_packed_direct, fft_plan_packed_direct_fma3);
+                    CEXPORT2(favx, fft_plan_packed_reverse, fft_plan_packed_reverse_fma3);
 
                     CEXPORT2(favx, fastconv_parse, fastconv_parse_fma3);
                     CEXPORT2(favx, fastconv_restore, fastconv_restore_fma3);
                     CEXPORT2(favx, fastconv_apply, fastconv_apply_fma3);
                     CEXPORT2(favx, fastconv_parse_apply, fastconv_parse_apply_fma3);
+                    CEXPORT2(favx, fastconv_fmadd, fastconv_fmadd_fma3);
 
                     CEXPORT2(favx, filter_transfer_calc_ri, filter_transfer_calc_ri_fma3);
                     CEXPORT2(favx, filter_transfer_apply_ri, filter_transfer_apply_ri_fma3);
@@ -499,8 +539,15 @@
                     CEXPORT2(favx, filter_transfer_apply_pc, filter_transfer_apply_pc_fma3);
 
                     CEXPORT2(favx, convolve, convolve_fma3);
+                    CEXPORT2(favx, convolve_fft_threshold, convolve_fft_threshold_fma3);
                     CEXPORT2(favx, corr_init, corr_init_fma3);
                     CEXPORT2(favx, corr_incr, corr_incr_fma3);
+                    CEXPORT2(favx, fir_direct, fir_direct_fma3);
+                    CEXPORT2(favx, fir_direct_x2, fir_direct_x2_fma3);
+                    CEXPORT2(favx, fir_interpolate, fir_interpolate_fma3);
+                    CEXPORT2(favx, fir_decimate, fir_decimate_fma3);
+
+                    CEXPORT2(favx, h_lerp_dotp, h_lerp_dotp_fma3);
 
                     CEXPORT2(favx, axis_apply_lin1, axis_apply_lin1_fma3);
 
@@ -508,12 +555,16 @@
                     CEXPORT2(favx, biquad_process_x2, biquad_process_x2_fma3);
                     CEXPORT2(favx, biquad_process_x4, biquad_process_x4_fma3);
                     CEXPORT2(ffma, biquad_process_x8, biquad_process_x8_fma3);
+                    CEXPORT2(favx, biquad_process_mc8, biquad_process_mc8_fma3);
 
                     CEXPORT2(ffma, dyn_biquad_process_x1, dyn_biquad_process_x1_fma3);
                     CEXPORT2(favx, dyn_biquad_process_x2, dyn_biquad_process_x2_fma3);
                     CEXPORT2(favx, dyn_biquad_process_x4, dyn_biquad_process_x4_fma3);
                     CEXPORT2(ffma, dyn_biquad_process_x8, dyn_biquad_process_x8_fma3);
 
+                    CEXPORT2(favx, svf_process_x8, svf_process_x8_fma3);
+                    CEXPORT2(favx, svf_lerp_x8, svf_lerp_x8_fma3);
+
                     CEXPORT2(favx, depan_eqpow, depan_eqpow_fma3);
                 }
             }
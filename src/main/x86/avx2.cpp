@@ -45,12 +45,16 @@
 
         #include <private/dsp/arch/x86/avx2/float.h>
 
+        #include <private/dsp/arch/x86/avx2/filters/transform.h>
+
         #include <private/dsp/arch/x86/avx2/pmath/op_kx.h>
         #include <private/dsp/arch/x86/avx2/pmath/fmop_kx.h>
         #include <private/dsp/arch/x86/avx2/pmath/exp.h>
         #include <private/dsp/arch/x86/avx2/pmath/log.h>
         #include <private/dsp/arch/x86/avx2/pmath/pow.h>
 
+        #include <private/dsp/arch/x86/avx2/resampling.h>
+
         #include <private/dsp/arch/x86/avx2/fft/normalize.h>
 
         #include <private/dsp/arch/x86/avx2/search/iminmax.h>
@@ -161,6 +165,11 @@ namespace lsp
             CEXPORT2_X64(favx, exp1, x64_exp1);
             CEXPORT2_X64(favx, exp2, x64_exp2);
 
+            CEXPORT1(favx, matched_transform_x1);
+            CEXPORT1(favx, matched_transform_x2);
+            CEXPORT1(favx, matched_transform_x4);
+            CEXPORT1(favx, matched_transform_x8);
+
             EXPORT1(min_index);
             EXPORT1(max_index);
             EXPORT1(minmax_index);
@@ -195,6 +204,12 @@ namespace lsp
             CEXPORT2_X64(favx, eff_hsla_light, x64_eff_hsla_light);
             CEXPORT2_X64(favx, eff_hsla_alpha, x64_eff_hsla_alpha);
 
+            CEXPORT1(favx, downsample_2x);
+            CEXPORT1(favx, downsample_3x);
+            CEXPORT1(favx, downsample_4x);
+            CEXPORT1(favx, downsample_6x);
+            CEXPORT1(favx, downsample_8x);
+
             CEXPORT2(favx, hsla_to_rgba, hsla_to_rgba);
             CEXPORT2(favx, rgba_to_hsla, rgba_to_hsla);
 
@@ -244,6 +259,11 @@ namespace lsp
                 CEXPORT2(favx, fmmod_k4, fmmod_k4_fma3);
                 CEXPORT2(favx, fmrmod_k4, fmrmod_k4_fma3);
 
+                CEXPORT2(favx, matched_transform_x1, matched_transform_x1_fma3);
+                CEXPORT2(favx, matched_transform_x2, matched_transform_x2_fma3);
+                CEXPORT2(favx, matched_transform_x4, matched_transform_x4_fma3);
+                CEXPORT2(favx, matched_transform_x8, matched_transform_x8_fma3);
+
                 CEXPORT2(favx, exp1, exp1_fma3);
                 CEXPORT2(favx, exp2, exp2_fma3);
 
@@ -290,6 +310,43 @@ namespace lsp
                 CEXPORT2(favx, dexpander_x1_curve, dexpander_x1_curve_fma3);
                 CEXPORT2_X64(favx, dexpander_x1_gain, x64_dexpander_x1_gain_fma3);
                 CEXPORT2_X64(favx, dexpander_x1_curve, x64_dexpander_x1_curve_fma3);
+
+                lanczos_init();
+                CEXPORT2(favx, lanczos_resample_2x2, lanczos_resample_2x2_fma3);
+                CEXPORT2(favx, lanczos_resample_2x3, lanczos_resample_2x3_fma3);
+                CEXPORT2(favx, lanczos_resample_2x4, lanczos_resample_2x4_fma3);
+                CEXPORT2(favx, lanczos_resample_2x12bit, lanczos_resample_2x4_fma3);
+                CEXPORT2(favx, lanczos_resample_2x16bit, lanczos_resample_2x16bit_fma3);
+                CEXPORT2(favx, lanczos_resample_2x24bit, lanczos_resample_2x24bit_fma3);
+
+                CEXPORT2(favx, lanczos_resample_3x2, lanczos_resample_3x2_fma3);
+                CEXPORT2(favx, lanczos_resample_3x3, lanczos_resample_3x3_fma3);
+                CEXPORT2(favx, lanczos_resample_3x4, lanczos_resample_3x4_fma3);
+                CEXPORT2(favx, lanczos_resample_3x12bit, lanczos_resample_3x4_fma3);
+                CEXPORT2(favx, lanczos_resample_3x16bit, lanczos_resample_3x16bit_fma3);
+                CEXPORT2(favx, lanczos_resample_3x24bit, lanczos_resample_3x24bit_fma3);
+
+                // Hand-written AVX 4x2 and 4x3 kernels remain faster than the FMA3 skeleton
+                // by 15-35% (dsp.resampling.oversampling performance test), they stay selected
+                CEXPORT2(favx, lanczos_resample_4x4, lanczos_resample_4x4_fma3);
+                CEXPORT2(favx, lanczos_resample_4x12bit, lanczos_resample_4x4_fma3);
+                CEXPORT2(favx, lanczos_resample_4x16bit, lanczos_resample_4x16bit_fma3);
+                CEXPORT2(favx, lanczos_resample_4x24bit, lanczos_resample_4x24bit_fma3);
+
+                CEXPORT2(favx, lanczos_resample_6x2, lanczos_resample_6x2_fma3);
+                CEXPORT2(favx, lanczos_resample_6x3, lanczos_resample_6x3_fma3);
+                CEXPORT2(favx, lanczos_resample_6x4, lanczos_resample_6x4_fma3);
+                CEXPORT2(favx, lanczos_resample_6x12bit, lanczos_resample_6x4_fma3);
+                CEXPORT2(favx, lanczos_resample_6x16bit, lanczos_resample_6x16bit_fma3);
+                CEXPORT2(favx, lanczos_resample_6x24bit, lanczos_resample_6x24bit_fma3);
+
+                // Hand-written AVX 8x2 and 8x3 kernels are on par with the FMA3 skeleton
+                // (dsp.resampling.oversampling performance test), they stay selected
+                CEXPORT2(favx, lanczos_resample_8x4, lanczos_resample_8x4_fma3);
+                CEXPORT2(favx, lanczos_resample_8x12bit, lanczos_resample_8x4_fma3);
+                CEXPORT2(favx, lanczos_resample_8x16bit, lanczos_resample_8x16bit_fma3);
+                CEXPORT2(favx, lanczos_resample_8x24bit, lanczos_resample_8x24bit_fma3);
+                CEXPORT2(favx, lanczos_resample, lanczos_resample_fma3);
             }
         }
     } /* namespace avx2 */
@@ -45,15 +45,23 @@
         #include <private/dsp/arch/x86/avx512/convolution.h>
         #include <private/dsp/arch/x86/avx512/copy.h>
         #include <private/dsp/arch/x86/avx512/dynamics.h>
+        #include <private/dsp/arch/x86/avx512/fft.h>
+        #include <private/dsp/arch/x86/avx512/fft_plan.h>
+        #include <private/dsp/arch/x86/avx512/filters/static.h>
+        #include <private/dsp/arch/x86/avx512/filters/transform.h>
+        #include <private/dsp/arch/x86/avx512/fir.h>
         #include <private/dsp/arch/x86/avx512/float.h>
         #include <private/dsp/arch/x86/avx512/graphics/axis.h>
         #include <private/dsp/arch/x86/avx512/hmath.h>
         #include <private/dsp/arch/x86/avx512/msmatrix.h>
         #include <private/dsp/arch/x86/avx512/pcomplex.h>
+        #include <private/dsp/arch/x86/avx512/pfft.h>
+        #include <private/dsp/arch/x86/avx512/rfft.h>
         #include <private/dsp/arch/x86/avx512/pmath.h>
         #include <private/dsp/arch/x86/avx512/search.h>
         #include <private/dsp/arch/x86/avx512/mix.h>
         #include <private/dsp/arch/x86/avx512/pan.h>
+        #include <private/dsp/arch/x86/avx512/resampling.h>
 
         #include <private/dsp/arch/x86/avx512/correlation.h>
     #undef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
@@ -299,6 +307,20 @@
                 CEXPORT1(vl, ms_to_right);
 
                 CEXPORT1(vl, convolve);
+                CEXPORT1(vl, convolve_fft_threshold);
+
+                CEXPORT1(vl, direct_fft);
+                CEXPORT1(vl, reverse_fft);
+                CEXPORT1(vl, packed_direct_fft);
+                CEXPORT1(vl, packed_reverse_fft);
+                CEXPORT2_X64(vl, real_direct_fft, x64_real_direct_fft);
+                CEXPORT2_X64(vl, real_reverse_fft, x64_real_reverse_fft);
+                CEXPORT1(vl, fft_plan_direct);
+                CEXPORT1(vl, fft_plan_reverse);
+                CEXPORT1(vl, fft_plan_packed_direct);
+                CEXPORT1(vl, fft_plan_packed_reverse);
+                CEXPORT1(vl, normalize_fft2);
+                CEXPORT1(vl, normalize_fft3);
 
                 CEXPORT1(vl, axis_apply_lin1);
 
@@ -314,6 +336,66 @@
 
                 CEXPORT1(vl, corr_init);
                 CEXPORT1(vl, corr_incr);
+                CEXPORT1(vl, corr_lags_incr);
+                CEXPORT1(vl, fir_direct);
+                CEXPORT1(vl, fir_direct_x2);
+
+                // biquad_process_x1 and biquad_process_x2 stay on AVX+FMA3: all coefficients of one
+                // or two cascades fit into one XMM register and each sample depends on the result
+                // for the previous one, so wider registers and opmasks do not shorten the chain
+                CEXPORT1(vl, biquad_process_x4);
+                CEXPORT1(vl, biquad_process_x8);
+                CEXPORT1(vl, biquad_process_x16);
+                CEXPORT1(vl, biquad_process_mc8);
+
+                CEXPORT1(vl, matched_transform_x1);
+                CEXPORT1(vl, matched_transform_x2);
+                CEXPORT1(vl, matched_transform_x4);
+                CEXPORT1(vl, matched_transform_x8);
+
+                if (vl)
+                    lanczos_init();
+                CEXPORT1(vl, lanczos_resample_2x2);
+                CEXPORT1(vl, lanczos_resample_2x3);
+                CEXPORT1(vl, lanczos_resample_2x4);
+                CEXPORT2(vl, lanczos_resample_2x12bit, lanczos_resample_2x4);
+                CEXPORT1(vl, lanczos_resample_2x16bit);
+                CEXPORT1(vl, lanczos_resample_2x24bit);
+
+                CEXPORT1(vl, lanczos_resample_3x2);
+                CEXPORT1(vl, lanczos_resample_3x3);
+                CEXPORT1(vl, lanczos_resample_3x4);
+                CEXPORT2(vl, lanczos_resample_3x12bit, lanczos_resample_3x4);
+                CEXPORT1(vl, lanczos_resample_3x16bit);
+                CEXPORT1(vl, lanczos_resample_3x24bit);
+
+                // Hand-written AVX 4x2 kernel remains faster by 5-15%, it stays selected
+                CEXPORT1(vl, lanczos_resample_4x3);
+                CEXPORT1(vl, lanczos_resample_4x4);
+                CEXPORT2(vl, lanczos_resample_4x12bit, lanczos_resample_4x4);
+                CEXPORT1(vl, lanczos_resample_4x16bit);
+                CEXPORT1(vl, lanczos_resample_4x24bit);
+
+                CEXPORT1(vl, lanczos_resample_6x2);
+                CEXPORT1(vl, lanczos_resample_6x3);
+                CEXPORT1(vl, lanczos_resample_6x4);
+                CEXPORT2(vl, lanczos_resample_6x12bit, lanczos_resample_6x4);
+                CEXPORT1(vl, lanczos_resample_6x16bit);
+                CEXPORT1(vl, lanczos_resample_6x24bit);
+
+                CEXPORT1(vl, lanczos_resample_8x2);
+                CEXPORT1(vl, lanczos_resample_8x3);
+                CEXPORT1(vl, lanczos_resample_8x4);
+                CEXPORT2(vl, lanczos_resample_8x12bit, lanczos_resample_8x4);
+                CEXPORT1(vl, lanczos_resample_8x16bit);
+                CEXPORT1(vl, lanczos_resample_8x24bit);
+                CEXPORT1(vl, lanczos_resample);
+
+                CEXPORT1(vl, downsample_2x);
+                CEXPORT1(vl, downsample_3x);
+                CEXPORT1(vl, downsample_4x);
+                CEXPORT1(vl, downsample_6x);
+                CEXPORT1(vl, downsample_8x);
 
                 CEXPORT1(vl, depan_lin);
                 CEXPORT1(vl, depan_eqpow);
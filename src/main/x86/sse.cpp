@@ -58,6 +58,8 @@
         #include <private/dsp/arch/x86/sse/smath.h>
 
         #include <private/dsp/arch/x86/sse/fft.h>
+        #include <private/dsp/arch/x86/sse/fft_plan.h>
+        #include <private/dsp/arch/x86/sse/rfft.h>
         #include <private/dsp/arch/x86/sse/fastconv.h>
         #include <private/dsp/arch/x86/sse/graphics.h>
         #include <private/dsp/arch/x86/sse/msmatrix.h>
@@ -68,11 +70,13 @@
 
         #include <private/dsp/arch/x86/sse/convolution.h>
         #include <private/dsp/arch/x86/sse/correlation.h>
+        #include <private/dsp/arch/x86/sse/fir.h>
 
         #include <private/dsp/arch/x86/sse/filters/static.h>
         #include <private/dsp/arch/x86/sse/filters/dynamic.h>
         #include <private/dsp/arch/x86/sse/filters/transform.h>
         #include <private/dsp/arch/x86/sse/filters/transfer.h>
+        #include <private/dsp/arch/x86/sse/filters/svf.h>
 
         #include <private/dsp/arch/x86/sse/3dmath.h>
 
@@ -247,6 +251,7 @@
                 EXPORT1(h_dotp);
                 EXPORT1(h_sqr_dotp);
                 EXPORT1(h_abs_dotp);
+                EXPORT1(h_lerp_dotp);
 
                 EXPORT1(fmadd_k3);
                 EXPORT1(fmsub_k3);
@@ -298,6 +303,12 @@
                 EXPORT1(normalize_fft3);
                 EXPORT1(packed_direct_fft);
                 EXPORT1(packed_reverse_fft);
+                EXPORT1(real_direct_fft);
+                EXPORT1(real_reverse_fft);
+                EXPORT1(fft_plan_direct);
+                EXPORT1(fft_plan_reverse);
+                EXPORT1(fft_plan_packed_direct);
+                EXPORT1(fft_plan_packed_reverse);
         //            EXPORT1(center_fft);
         //            EXPORT1(combine_fft);
 
@@ -305,6 +316,7 @@
                 EXPORT1(fastconv_parse_apply);
                 EXPORT1(fastconv_restore);
                 EXPORT1(fastconv_apply);
+                EXPORT1(fastconv_fmadd);
 
                 EXPORT1(complex_mul2);
                 EXPORT1(complex_mul3);
@@ -335,6 +347,8 @@
                 EXPORT1(pcomplex_r2c_mul2);
                 EXPORT1(pcomplex_r2c_div2);
                 EXPORT1(pcomplex_r2c_rdiv2);
+                EXPORT1(pcomplex_r2c_mul3);
+                EXPORT1(pcomplex_c2r_fmadd3);
 
                 EXPORT1(lr_to_ms);
                 EXPORT1(lr_to_mid);
@@ -347,11 +361,25 @@
                 EXPORT1(biquad_process_x2);
                 EXPORT1(biquad_process_x4);
                 EXPORT1(biquad_process_x8);
+                EXPORT1(biquad_process_mc8);
 
                 EXPORT1(dyn_biquad_process_x1);
                 EXPORT1(dyn_biquad_process_x2);
                 EXPORT1(dyn_biquad_process_x4);
                 EXPORT1(dyn_biquad_process_x8);
+                EXPORT1(dyn_biquad_lerp_x1);
+                EXPORT1(dyn_biquad_lerp_x2);
+                EXPORT1(dyn_biquad_lerp_x4);
+                EXPORT1(dyn_biquad_lerp_x8);
+                EXPORT1(dyn_cascade_lerp_x1);
+                EXPORT1(dyn_cascade_lerp_x2);
+                EXPORT1(dyn_cascade_lerp_x4);
+                EXPORT1(dyn_cascade_lerp_x8);
+
+                EXPORT1(svf_process_x4);
+                EXPORT1(svf_process_x8);
+                EXPORT1(svf_lerp_x4);
+                EXPORT1(svf_lerp_x8);
 
                 EXPORT1(filter_transfer_calc_ri);
                 EXPORT1(filter_transfer_apply_ri);
@@ -505,8 +533,13 @@
                 EXPORT1(cull_triangle_raw);
 
                 EXPORT1(convolve);
+                EXPORT1(convolve_fft_threshold);
                 EXPORT1(corr_init);
                 EXPORT1(corr_incr);
+                EXPORT1(fir_direct);
+                EXPORT1(fir_direct_x2);
+                EXPORT1(fir_interpolate);
+                EXPORT1(fir_decimate);
 
                 EXPORT1(lin_inter_set);
                 EXPORT1(lin_inter_mul2);
@@ -46,6 +46,8 @@
 
         #include <private/dsp/arch/x86/sse2/float.h>
 
+        #include <private/dsp/arch/x86/sse2/filters/transform.h>
+
         #include <private/dsp/arch/x86/sse2/search/iminmax.h>
 
         #include <private/dsp/arch/x86/sse2/graphics/axis.h>
@@ -123,6 +125,11 @@
                 EXPORT1(powvx1);
                 EXPORT1(powvx2);
 
+                EXPORT1(matched_transform_x1);
+                EXPORT1(matched_transform_x2);
+                EXPORT1(matched_transform_x4);
+                EXPORT1(matched_transform_x8);
+
                 EXPORT1(min_index);
                 EXPORT1(max_index);
                 EXPORT1(minmax_index);
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        5
+#define MAX_RANK        9
+#define MAX_LAGS        256
+
+namespace lsp
+{
+    namespace generic
+    {
+        void corr_lags_incr(dsp::lag_correlation_t *corr, float *dst,
+            const float *a_head, const float *b_head,
+            const float *a_tail, const float *b_tail,
+            size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace avx512
+        {
+            void corr_lags_incr(dsp::lag_correlation_t *corr, float *dst,
+                const float *a_head, const float *b_head,
+                const float *a_tail, const float *b_tail,
+                size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void corr_lags_incr(dsp::lag_correlation_t *corr, float *dst,
+                const float *a_head, const float *b_head,
+                const float *a_tail, const float *b_tail,
+                size_t count);
+        }
+    )
+
+    typedef void (* corr_lags_incr_t)(dsp::lag_correlation_t *corr, float *dst,
+        const float *a_head, const float *b_head,
+        const float *a_tail, const float *b_tail,
+        size_t count);
+}
+
+PTEST_BEGIN("dsp", corr_lags_incr, 5, 1000)
+
+    void call(const char *label,
+        dsp::lag_correlation_t *corr, float *dst,
+        const float *a_head, const float *b_head,
+        const float *a_tail, const float *b_tail,
+        size_t count, corr_lags_incr_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d x %d", label, int(corr->lags), int(count));
+        printf("Testing %s lag correlation ...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(corr, dst, a_head, b_head, a_tail, b_tail, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = (1 << MAX_RANK) + MAX_LAGS;
+        uint8_t *data   = NULL;
+        float *a_head   = alloc_aligned<float>(data, buf_size * 4 + MAX_LAGS * 3, 64);
+        float *a_tail   = &a_head[buf_size];
+        float *b_head   = &a_tail[buf_size];
+        float *b_tail   = &b_head[buf_size];
+        float *v        = &b_tail[buf_size];
+        float *b        = &v[MAX_LAGS];
+        float *dst      = &b[MAX_LAGS];
+
+        for (size_t i=0; i < buf_size*4; ++i)
+            a_head[i]       = randf(-1.0f, 1.0f);
+
+        dsp::lag_correlation_t corr;
+        corr.v          = v;
+        corr.b          = b;
+
+        #define CALL(func, count) \
+            corr.a = 0.0f; \
+            dsp::fill_zero(v, MAX_LAGS * 2); \
+            call(#func, &corr, dst, a_head, b_head, a_tail, b_tail, count, func)
+
+        for (size_t lags=16; lags<=MAX_LAGS; lags <<= 2)
+        {
+            corr.lags       = lags;
+            for (size_t i=MIN_RANK; i<=MAX_RANK; ++i)
+            {
+                const size_t count = 1 << i;
+
+                CALL(generic::corr_lags_incr, count);
+                IF_ARCH_X86(CALL(avx512::corr_lags_incr, count));
+                IF_ARCH_AARCH64(CALL(asimd::corr_lags_incr, count));
+
+                PTEST_SEPARATOR;
+            }
+
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
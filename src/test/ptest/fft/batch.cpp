@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        4
+#define MAX_RANK        10
+#define CHANNELS        64
+
+namespace lsp
+{
+    namespace generic
+    {
+        void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+        void batch_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t stride, size_t rank, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace avx
+        {
+            void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void direct_fft_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+        }
+
+        namespace avx512
+        {
+            void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx
+        {
+            void x64_batch_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t stride, size_t rank, size_t count);
+        }
+    )
+
+    typedef void (* direct_fft_t) (float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+    typedef void (* batch_direct_fft_t) (float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t stride, size_t rank, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for batched FFT against the loop of single-channel FFT calls
+PTEST_BEGIN("dsp.fft", batch, 10, 1000)
+
+    void call(const char *label, float *fft_re, float *fft_im, const float *sig_re, const float *sig_im, size_t rank, direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        size_t stride = 1 << rank;
+        snprintf(buf, sizeof(buf), "%s x %d x %d", label, int(CHANNELS), int(stride));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<CHANNELS; ++i)
+                fft(&fft_re[i*stride], &fft_im[i*stride], &sig_re[i*stride], &sig_im[i*stride], rank);
+        )
+    }
+
+    void call(const char *label, float *fft_re, float *fft_im, const float *sig_re, const float *sig_im, size_t rank, batch_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        size_t stride = 1 << rank;
+        snprintf(buf, sizeof(buf), "%s x %d x %d", label, int(CHANNELS), int(stride));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            fft(fft_re, fft_im, sig_re, sig_im, stride, rank, CHANNELS);
+        )
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = CHANNELS << MAX_RANK;
+        uint8_t *data   = NULL;
+
+        float *sig_re   = alloc_aligned<float>(data, buf_size * 4, 64);
+        float *sig_im   = &sig_re[buf_size];
+        float *fft_re   = &sig_im[buf_size];
+        float *fft_im   = &fft_re[buf_size];
+
+        for (size_t i=0; i < buf_size; ++i)
+        {
+            sig_re[i]       = randf(0.0f, 1.0f);
+            sig_im[i]       = 0.0f;
+        }
+
+        #define CALL(func) \
+            call(#func, fft_re, fft_im, sig_re, sig_im, i, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            CALL(generic::direct_fft);
+            CALL(generic::batch_direct_fft);
+            IF_ARCH_X86(CALL(avx::direct_fft));
+            IF_ARCH_X86(CALL(avx::direct_fft_fma3));
+            IF_ARCH_X86(CALL(avx512::direct_fft));
+            IF_ARCH_X86_64(CALL(avx::x64_batch_direct_fft));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
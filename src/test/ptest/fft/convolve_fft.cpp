@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MAX_RANK        12
+
+namespace lsp
+{
+    namespace generic
+    {
+        void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count);
+        size_t convolve_fft_size(size_t length, size_t count);
+        void convolve_fft(float *dst, const float *src, const float *conv, size_t length, size_t count, void *buf);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count);
+        }
+
+        namespace avx
+        {
+            void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count);
+            void convolve_fma3(float *dst, const float *src, const float *conv, size_t length, size_t count);
+        }
+
+        namespace avx512
+        {
+            void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count);
+        }
+    )
+
+    typedef void (* convolve_t)(float *dst, const float *src, const float *conv, size_t length, size_t count);
+}
+
+// Sizes of the problem, the ones right above the power of two are penalized by
+// the rank of FFT and should be checked too
+static const size_t sizes[] =
+{
+    64, 96, 128, 160, 192, 224, 256, 320, 384, 448, 512, 768, 1024, 2048
+};
+
+//-----------------------------------------------------------------------------
+// Performance test for FFT convolution, allows to find the crossover point
+// between direct and FFT convolution for the current CPU which is returned
+// by convolve_fft_threshold() function. The FFT convolution uses the fast
+// convolution functions selected for the current CPU, so the crossover point
+// of the direct convolution function of each ISA should be taken from the
+// CPU that supports this ISA as the best one. The threshold is the first
+// size where the FFT convolution wins both for the square problem and the
+// problem with long input signal on average.
+PTEST_BEGIN("dsp.fft", convolve_fft, 5, 1000)
+
+    void call_direct(const char *label, float *out, const float *in, const float *conv, size_t length, size_t count, convolve_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s %d x %d", label, int(count), int(length));
+        printf("Testing %s convolution ...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(out, in, conv, length, count);
+        );
+    }
+
+    void call_all(float *out, const float *in, const float *conv, size_t length, size_t count, void *tmp)
+    {
+        call_direct("generic::convolve", out, in, conv, length, count, generic::convolve);
+        IF_ARCH_X86(call_direct("sse::convolve", out, in, conv, length, count, sse::convolve));
+        IF_ARCH_X86(call_direct("avx::convolve", out, in, conv, length, count, avx::convolve));
+        IF_ARCH_X86(call_direct("avx::convolve_fma3", out, in, conv, length, count, avx::convolve_fma3));
+        IF_ARCH_X86(call_direct("avx512::convolve", out, in, conv, length, count, avx512::convolve));
+        IF_ARCH_ARM(call_direct("neon_d32::convolve", out, in, conv, length, count, neon_d32::convolve));
+        IF_ARCH_AARCH64(call_direct("asimd::convolve", out, in, conv, length, count, asimd::convolve));
+        call_fft(out, in, conv, length, count, tmp);
+    }
+
+    void call_fft(float *out, const float *in, const float *conv, size_t length, size_t count, void *tmp)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "generic::convolve_fft %d x %d", int(count), int(length));
+        printf("Testing %s convolution ...\n", buf);
+
+        PTEST_LOOP(buf,
+            generic::convolve_fft(out, in, conv, length, count, tmp);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *out      = alloc_aligned<float>(data, buf_size * 4, 64);
+        float *in       = &out[buf_size*2];
+        float *conv     = &in[buf_size];
+        uint8_t *tmp    = new uint8_t[generic::convolve_fft_size(buf_size, buf_size)];
+
+        for (size_t i=0; i < buf_size*4; ++i)
+            out[i]          = randf(-1.0f, 1.0f);
+
+        printf("Current FFT convolution threshold: %d\n", int(dsp::convolve_fft_threshold()));
+
+        // The size of the problem is the minimum of length and count
+        for (size_t i=0; i<sizeof(sizes)/sizeof(size_t); ++i)
+        {
+            size_t n = sizes[i];
+
+            call_all(out, in, conv, n, n, tmp);
+            PTEST_SEPARATOR;
+
+            if (n < buf_size)
+                call_all(out, in, conv, n, buf_size, tmp);
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+        delete [] tmp;
+    }
+
+PTEST_END
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 6
+#define MAX_RANK 16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
+        }
+
+        namespace avx
+        {
+            void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
+            void fastconv_fmadd_fma3(float *dst, const float *c1, const float *c2, size_t rank);
+        }
+    )
+
+    typedef void (* fastconv_fmadd_t)(float *dst, const float *c1, const float *c2, size_t rank);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for multiply-add of fast convolution data
+PTEST_BEGIN("dsp.fft", fastconv_fmadd, 5, 1000)
+
+    void call(const char *label, float *dst, const float *c1, const float *c2, size_t rank, fastconv_fmadd_t op)
+    {
+        if (!PTEST_SUPPORTED(op))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << rank));
+        printf("Testing %s samples (rank = %d)...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            op(dst, c1, c2, rank);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 2 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *dst      = alloc_aligned<float>(data, buf_size*3, 64);
+        float *c1       = &dst[buf_size];
+        float *c2       = &c1[buf_size];
+
+        randomize_sign(dst, buf_size*3);
+
+        #define CALL(func) \
+            call(#func, dst, c1, c2, rank, func)
+
+        for (size_t rank=MIN_RANK; rank <= MAX_RANK; ++rank)
+        {
+            CALL(generic::fastconv_fmadd);
+            IF_ARCH_X86(CALL(sse::fastconv_fmadd));
+            IF_ARCH_X86(CALL(avx::fastconv_fmadd));
+            IF_ARCH_X86(CALL(avx::fastconv_fmadd_fma3));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
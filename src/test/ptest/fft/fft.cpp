@@ -34,6 +34,7 @@ namespace lsp
     {
         void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
         void packed_direct_fft(float *dst, const float *src, size_t rank);
+        void real_direct_fft(float *dst, const float *src, size_t rank);
     }
 
     IF_ARCH_X86(
@@ -41,6 +42,7 @@ namespace lsp
         {
             void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
             void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void real_direct_fft(float *dst, const float *src, size_t rank);
         }
 
         namespace avx
@@ -50,6 +52,22 @@ namespace lsp
 
             void packed_direct_fft(float *dst, const float *src, size_t rank);
             void packed_direct_fft_fma3(float *dst, const float *src, size_t rank);
+
+            void real_direct_fft(float *dst, const float *src, size_t rank);
+            void real_direct_fft_fma3(float *dst, const float *src, size_t rank);
+        }
+
+        namespace avx512
+        {
+            void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx512
+        {
+            void x64_real_direct_fft(float *dst, const float *src, size_t rank);
         }
     )
 
@@ -58,6 +76,7 @@ namespace lsp
         {
             void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
             void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void real_direct_fft(float *dst, const float *src, size_t rank);
         }
     )
 
@@ -66,6 +85,7 @@ namespace lsp
         {
             void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
             void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void real_direct_fft(float *dst, const float *src, size_t rank);
         }
     )
 
@@ -134,6 +154,7 @@ PTEST_BEGIN("dsp.fft", fft, 10, 1000)
             IF_ARCH_X86(CALL1(sse::direct_fft));
             IF_ARCH_X86(CALL1(avx::direct_fft));
             IF_ARCH_X86(CALL1(avx::direct_fft_fma3));
+            IF_ARCH_X86(CALL1(avx512::direct_fft));
             IF_ARCH_ARM(CALL1(neon_d32::direct_fft));
             IF_ARCH_AARCH64(CALL1(asimd::direct_fft));
 
@@ -141,8 +162,17 @@ PTEST_BEGIN("dsp.fft", fft, 10, 1000)
             IF_ARCH_X86(CALL2(sse::packed_direct_fft));
             IF_ARCH_X86(CALL2(avx::packed_direct_fft));
             IF_ARCH_X86(CALL2(avx::packed_direct_fft_fma3));
+            IF_ARCH_X86(CALL2(avx512::packed_direct_fft));
             IF_ARCH_ARM(CALL2(neon_d32::packed_direct_fft));
             IF_ARCH_AARCH64(CALL2(asimd::packed_direct_fft));
+
+            CALL2(generic::real_direct_fft);
+            IF_ARCH_X86(CALL2(sse::real_direct_fft));
+            IF_ARCH_X86(CALL2(avx::real_direct_fft));
+            IF_ARCH_X86(CALL2(avx::real_direct_fft_fma3));
+            IF_ARCH_X86_64(CALL2(avx512::x64_real_direct_fft));
+            IF_ARCH_ARM(CALL2(neon_d32::real_direct_fft));
+            IF_ARCH_AARCH64(CALL2(asimd::real_direct_fft));
             PTEST_SEPARATOR;
         }
 
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        8
+#define MAX_RANK        12
+#define IR_LENGTH       (1 << 15)
+#define BUF_SIZE        1024
+#define CHANNELS        4
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t convolver_size(size_t rank, size_t length);
+        void convolver_init(dsp::convolver_t *conv, void *buf, const float *ir, size_t length, size_t rank);
+        void convolver_process(dsp::convolver_t *conv, float *dst, const float *src, size_t count);
+
+        size_t mconvolver_size(size_t rank, size_t length, size_t inputs, size_t outputs);
+        void mconvolver_init(dsp::mconvolver_t *conv, void *buf,
+            const float * const *ir, size_t length, size_t rank, size_t inputs, size_t outputs);
+        void mconvolver_process(dsp::mconvolver_t *conv, float * const *dst, const float * const *src, size_t count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for matrix convolver
+PTEST_BEGIN("dsp.fft", mconvolver, 10, 100)
+
+    void call_pairs(float * const *dst, const float * const *src, const float * const *ir,
+        float *tmp, size_t rank, size_t channels)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "generic::convolver_process %dx%d rank=%d x %d",
+            int(channels), int(channels), int(rank), int(BUF_SIZE));
+        printf("Testing %s samples, IR length = %d...\n", buf, int(IR_LENGTH));
+
+        size_t n        = channels * channels;
+        size_t csize    = generic::convolver_size(rank, IR_LENGTH);
+        dsp::convolver_t *conv = new dsp::convolver_t[n];
+        uint8_t *cbuf   = new uint8_t[csize * n];
+        for (size_t i=0; i<n; ++i)
+            generic::convolver_init(&conv[i], &cbuf[i * csize], ir[i], IR_LENGTH, rank);
+
+        PTEST_LOOP(buf,
+            for (size_t o=0; o<channels; ++o)
+            {
+                dsp::fill_zero(dst[o], BUF_SIZE);
+                for (size_t i=0; i<channels; ++i)
+                {
+                    generic::convolver_process(&conv[i * channels + o], tmp, src[i], BUF_SIZE);
+                    dsp::add2(dst[o], tmp, BUF_SIZE);
+                }
+            }
+        );
+
+        delete [] cbuf;
+        delete [] conv;
+    }
+
+    void call_matrix(float * const *dst, const float * const *src, const float * const *ir,
+        size_t rank, size_t channels)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "generic::mconvolver_process %dx%d rank=%d x %d",
+            int(channels), int(channels), int(rank), int(BUF_SIZE));
+        printf("Testing %s samples, IR length = %d...\n", buf, int(IR_LENGTH));
+
+        dsp::mconvolver_t conv;
+        uint8_t *cbuf   = new uint8_t[generic::mconvolver_size(rank, IR_LENGTH, channels, channels)];
+        generic::mconvolver_init(&conv, cbuf, ir, IR_LENGTH, rank, channels, channels);
+
+        PTEST_LOOP(buf,
+            generic::mconvolver_process(&conv, dst, src, BUF_SIZE);
+        );
+
+        delete [] cbuf;
+    }
+
+    PTEST_MAIN
+    {
+        size_t n        = CHANNELS * CHANNELS;
+        uint8_t *data   = NULL;
+        float *ptr      = alloc_aligned<float>(data, IR_LENGTH * n + BUF_SIZE * (CHANNELS * 2 + 1), 64);
+        const float *ir[CHANNELS * CHANNELS];
+        const float *src[CHANNELS];
+        float *dst[CHANNELS];
+
+        randomize_sign(ptr, IR_LENGTH * n + BUF_SIZE * CHANNELS);
+        for (size_t i=0; i<n; ++i, ptr += IR_LENGTH)
+            ir[i]           = ptr;
+        for (size_t i=0; i<CHANNELS; ++i, ptr += BUF_SIZE)
+            src[i]          = ptr;
+        for (size_t i=0; i<CHANNELS; ++i, ptr += BUF_SIZE)
+            dst[i]          = ptr;
+
+        for (size_t channels=2; channels <= CHANNELS; channels *= 2)
+        {
+            for (size_t rank=MIN_RANK; rank <= MAX_RANK; ++rank)
+            {
+                call_pairs(dst, src, ir, ptr, rank, channels);
+                call_matrix(dst, src, ir, rank, channels);
+                PTEST_SEPARATOR;
+            }
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MAX_SIZE        (1 << 16)
+
+namespace lsp
+{
+    namespace generic
+    {
+        void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+
+        size_t mixed_fft_plan_size(size_t size);
+        void mixed_fft_plan_init(dsp::mixed_fft_plan_t *plan, void *buf, size_t size);
+        void mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+        void packed_mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp);
+    }
+
+    IF_ARCH_X86(
+        namespace avx
+        {
+            void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx
+        {
+            void x64_mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+            void x64_packed_mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp);
+        }
+    )
+
+    typedef void (* direct_fft_t) (float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+    typedef void (* mixed_direct_fft_t) (const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+    typedef void (* packed_mixed_direct_fft_t) (const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for mixed-radix FFT against the nearest power-of-two FFT
+PTEST_BEGIN("dsp.fft", mixed, 10, 1000)
+
+    void call(const char *label, float *fft_re, float *fft_im, const float *sig_re, const float *sig_im, size_t rank, direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            fft(fft_re, fft_im, sig_re, sig_im, rank);
+        )
+    }
+
+    void call(const char *label, const dsp::mixed_fft_plan_t *plan, float *fft_re, float *fft_im,
+        const float *sig_re, const float *sig_im, float *tmp, mixed_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(plan->size));
+        printf("Testing %s samples ...\n", buf);
+
+        PTEST_LOOP(buf,
+            fft(plan, fft_re, fft_im, sig_re, sig_im, tmp);
+        )
+    }
+
+    void call(const char *label, const dsp::mixed_fft_plan_t *plan, float *dst, const float *src,
+        float *tmp, packed_mixed_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(plan->size));
+        printf("Testing %s samples ...\n", buf);
+
+        PTEST_LOOP(buf,
+            fft(plan, dst, src, tmp);
+        )
+    }
+
+    PTEST_MAIN
+    {
+        static const size_t sizes[] = { 480, 960, 1920, 3840, 7680, 15360, 30720, 61440 };
+
+        uint8_t *data   = NULL;
+        uint8_t *pdata  = NULL;
+
+        float *sig_re   = alloc_aligned<float>(data, MAX_SIZE * 6, 64);
+        float *sig_im   = &sig_re[MAX_SIZE];
+        float *fft_re   = &sig_im[MAX_SIZE];
+        float *fft_im   = &fft_re[MAX_SIZE];
+        float *tmp      = &fft_im[MAX_SIZE];
+        uint8_t *pbuf   = alloc_aligned<uint8_t>(pdata, generic::mixed_fft_plan_size(sizes[7]), 64);
+
+        for (size_t i=0; i < MAX_SIZE; ++i)
+        {
+            sig_re[i]       = randf(0.0f, 1.0f);
+            sig_im[i]       = 0.0f;
+        }
+
+        #define CALL1(func) \
+            call(#func, fft_re, fft_im, sig_re, sig_im, rank, func)
+        #define CALL2(func) \
+            call(#func, &plan, fft_re, fft_im, sig_re, sig_im, tmp, func)
+        #define CALL3(func) \
+            call(#func, &plan, fft_re, sig_re, tmp, func)
+
+        for (size_t i=0; i < sizeof(sizes)/sizeof(sizes[0]); ++i)
+        {
+            dsp::mixed_fft_plan_t plan;
+            generic::mixed_fft_plan_init(&plan, pbuf, sizes[i]);
+
+            size_t rank = 0;
+            while ((size_t(1) << rank) < sizes[i])
+                ++rank;
+
+            CALL1(generic::direct_fft);
+            IF_ARCH_X86(CALL1(avx::direct_fft));
+
+            CALL2(generic::mixed_direct_fft);
+            IF_ARCH_X86_64(CALL2(avx::x64_mixed_direct_fft));
+
+            CALL3(generic::packed_mixed_direct_fft);
+            IF_ARCH_X86_64(CALL3(avx::x64_packed_mixed_direct_fft));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+        free_aligned(pdata);
+    }
+PTEST_END
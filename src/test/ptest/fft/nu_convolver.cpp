@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define RANK            7
+#define MIN_MAX_RANK    9
+#define MAX_MAX_RANK    15
+#define IR_LENGTH       441000
+#define BUF_SIZE        64
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t convolver_size(size_t rank, size_t length);
+        void convolver_init(dsp::convolver_t *conv, void *buf, const float *ir, size_t length, size_t rank);
+        void convolver_process(dsp::convolver_t *conv, float *dst, const float *src, size_t count);
+
+        size_t nu_convolver_size(size_t rank, size_t max_rank, size_t length);
+        void nu_convolver_init(dsp::nu_convolver_t *conv, void *buf, const float *ir, size_t length, size_t rank, size_t max_rank);
+        void nu_convolver_process(dsp::nu_convolver_t *conv, float *dst, const float *src, size_t count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for non-uniformly partitioned convolver
+PTEST_BEGIN("dsp.fft", nu_convolver, 10, 1000)
+
+    void call_uniform(const char *label, float *dst, const float *src, const float *ir)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s rank=%d x %d", label, int(RANK), int(BUF_SIZE));
+        printf("Testing %s samples, IR length = %d...\n", buf, int(IR_LENGTH));
+
+        dsp::convolver_t conv;
+        uint8_t *cbuf   = new uint8_t[generic::convolver_size(RANK, IR_LENGTH)];
+        generic::convolver_init(&conv, cbuf, ir, IR_LENGTH, RANK);
+
+        PTEST_LOOP(buf,
+            generic::convolver_process(&conv, dst, src, BUF_SIZE);
+        );
+
+        delete [] cbuf;
+    }
+
+    void call(const char *label, float *dst, const float *src, const float *ir, size_t max_rank)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s rank=%d..%d x %d", label, int(RANK), int(max_rank), int(BUF_SIZE));
+        printf("Testing %s samples, IR length = %d...\n", buf, int(IR_LENGTH));
+
+        dsp::nu_convolver_t conv;
+        uint8_t *cbuf   = new uint8_t[generic::nu_convolver_size(RANK, max_rank, IR_LENGTH)];
+        generic::nu_convolver_init(&conv, cbuf, ir, IR_LENGTH, RANK, max_rank);
+
+        PTEST_LOOP(buf,
+            generic::nu_convolver_process(&conv, dst, src, BUF_SIZE);
+        );
+
+        delete [] cbuf;
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *ir       = alloc_aligned<float>(data, IR_LENGTH + BUF_SIZE*2, 64);
+        float *src      = &ir[IR_LENGTH];
+        float *dst      = &src[BUF_SIZE];
+
+        randomize_sign(ir, IR_LENGTH + BUF_SIZE*2);
+
+        call_uniform("generic::convolver_process", dst, src, ir);
+        for (size_t max_rank=MIN_MAX_RANK; max_rank <= MAX_MAX_RANK; max_rank += 2)
+            call("generic::nu_convolver_process", dst, src, ir, max_rank);
+
+        free_aligned(data);
+    }
+PTEST_END
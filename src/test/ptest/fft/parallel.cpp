@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <pthread.h>
+
+#define MIN_RANK        16
+#define MAX_RANK        22
+#define MAX_THREADS     8
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t fft_plan_size(size_t rank);
+        void fft_plan_init(dsp::fft_plan_t *plan, void *buf, size_t rank);
+        void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+
+        size_t parallel_fft_plan_size(size_t rank);
+        void parallel_fft_plan_init(dsp::parallel_fft_plan_t *plan, void *buf, size_t rank, size_t jobs);
+        void parallel_direct_fft(const dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+        void parallel_direct_fft_pass(const dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp, size_t pass, size_t job);
+    }
+
+    IF_ARCH_X86(
+        namespace avx
+        {
+            void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+        }
+
+        namespace avx512
+        {
+            void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+        }
+    )
+
+    typedef void (* plan_direct_fft_t) (const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+    typedef void (* parallel_direct_fft_t) (const dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+    typedef void (* parallel_direct_fft_pass_t) (const dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp, size_t pass, size_t job);
+
+    /**
+     * Persistent pool of threads of the host that executes jobs of the parallel FFT,
+     * the caller's thread executes the job 0 of each pass
+     */
+    typedef struct pfft_pool_t
+    {
+        pthread_t                       tid[MAX_THREADS];
+        pthread_barrier_t               barrier;
+        const dsp::parallel_fft_plan_t *plan;
+        float                          *dst_re;
+        float                          *dst_im;
+        const float                    *src_re;
+        const float                    *src_im;
+        float                          *tmp;
+        parallel_direct_fft_pass_t      func;
+        size_t                          threads;
+        size_t                          next;
+        bool                            stop;
+    } pfft_pool_t;
+
+    static void pfft_pool_run(pfft_pool_t *pool, size_t job)
+    {
+        for (size_t pass=0; pass<2; ++pass)
+        {
+            pool->func(pool->plan, pool->dst_re, pool->dst_im, pool->src_re, pool->src_im, pool->tmp, pass, job);
+            pthread_barrier_wait(&pool->barrier);
+        }
+    }
+
+    static void *pfft_pool_thread(void *arg)
+    {
+        pfft_pool_t *pool   = static_cast<pfft_pool_t *>(arg);
+        size_t job          = __atomic_add_fetch(&pool->next, 1, __ATOMIC_SEQ_CST);
+
+        while (true)
+        {
+            pthread_barrier_wait(&pool->barrier);
+            if (pool->stop)
+                break;
+            pfft_pool_run(pool, job);
+        }
+
+        return NULL;
+    }
+
+    static bool pfft_pool_start(pfft_pool_t *pool, size_t threads)
+    {
+        pool->threads   = threads;
+        pool->next      = 0;
+        pool->stop      = false;
+        if (pthread_barrier_init(&pool->barrier, NULL, threads) != 0)
+            return false;
+
+        for (size_t i=1; i<threads; ++i)
+        {
+            if (pthread_create(&pool->tid[i], NULL, pfft_pool_thread, pool) != 0)
+            {
+                // Barrier can not be passed without all threads
+                fprintf(stderr, "Could not start thread\n");
+                abort();
+            }
+        }
+
+        return true;
+    }
+
+    static void pfft_pool_stop(pfft_pool_t *pool)
+    {
+        pool->stop      = true;
+        pthread_barrier_wait(&pool->barrier);
+        for (size_t i=1; i<pool->threads; ++i)
+            pthread_join(pool->tid[i], NULL);
+        pthread_barrier_destroy(&pool->barrier);
+    }
+
+    static void pfft_pool_direct_fft(pfft_pool_t *pool, const dsp::parallel_fft_plan_t *plan,
+        float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp)
+    {
+        pool->plan      = plan;
+        pool->dst_re    = dst_re;
+        pool->dst_im    = dst_im;
+        pool->src_re    = src_re;
+        pool->src_im    = src_im;
+        pool->tmp       = tmp;
+        pthread_barrier_wait(&pool->barrier);
+        pfft_pool_run(pool, 0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for parallel FFT against the single-threaded FFT plan
+PTEST_BEGIN("dsp.fft", parallel, 10, 100)
+
+    void call(const char *label, const dsp::fft_plan_t *plan, float *fft_re, float *fft_im,
+        const float *sig_re, const float *sig_im, plan_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << plan->rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(plan->rank));
+
+        PTEST_LOOP(buf,
+            fft(plan, fft_re, fft_im, sig_re, sig_im);
+        )
+    }
+
+    void call(const char *label, const dsp::parallel_fft_plan_t *plan, float *fft_re, float *fft_im,
+        const float *sig_re, const float *sig_im, float *tmp, parallel_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << plan->rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(plan->rank));
+
+        PTEST_LOOP(buf,
+            fft(plan, fft_re, fft_im, sig_re, sig_im, tmp);
+        )
+    }
+
+    void call(const char *label, const dsp::parallel_fft_plan_t *plan, float *fft_re, float *fft_im,
+        const float *sig_re, const float *sig_im, float *tmp, parallel_direct_fft_pass_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d / %d", label, int(1 << plan->rank), int(plan->jobs));
+        printf("Testing %s samples / threads (rank = %d) ...\n", buf, int(plan->rank));
+
+        pfft_pool_t pool;
+        pool.func       = fft;
+        if (!pfft_pool_start(&pool, plan->jobs))
+            return;
+
+        PTEST_LOOP(buf,
+            pfft_pool_direct_fft(&pool, plan, fft_re, fft_im, sig_re, sig_im, tmp);
+        )
+
+        pfft_pool_stop(&pool);
+    }
+
+    PTEST_MAIN
+    {
+        static const size_t threads[] = { 1, 2, 4, MAX_THREADS };
+        const size_t count  = 1 << MAX_RANK;
+
+        uint8_t *data   = NULL;
+        uint8_t *pdata  = NULL;
+        uint8_t *qdata  = NULL;
+
+        dsp::parallel_fft_plan_t pplan;
+        uint8_t *pbuf   = alloc_aligned<uint8_t>(pdata, generic::fft_plan_size(MAX_RANK), 64);
+        uint8_t *qbuf   = alloc_aligned<uint8_t>(qdata, generic::parallel_fft_plan_size(MAX_RANK), 64);
+        generic::parallel_fft_plan_init(&pplan, qbuf, MAX_RANK, MAX_THREADS);
+
+        float *sig_re   = alloc_aligned<float>(data, count * 4 + pplan.tmp_size, 64);
+        float *sig_im   = &sig_re[count];
+        float *fft_re   = &sig_im[count];
+        float *fft_im   = &fft_re[count];
+        float *tmp      = &fft_im[count];
+
+        for (size_t i=0; i < count; ++i)
+        {
+            sig_re[i]       = randf(0.0f, 1.0f);
+            sig_im[i]       = 0.0f;
+        }
+
+        #define CALL1(func) \
+            call(#func, &plan, fft_re, fft_im, sig_re, sig_im, func)
+        #define CALL2(func) \
+            call(#func, &pplan, fft_re, fft_im, sig_re, sig_im, tmp, func)
+
+        for (size_t rank=MIN_RANK; rank <= MAX_RANK; rank += 2)
+        {
+            dsp::fft_plan_t plan;
+            generic::fft_plan_init(&plan, pbuf, rank);
+
+            CALL1(generic::fft_plan_direct);
+            IF_ARCH_X86(CALL1(avx::fft_plan_direct));
+            IF_ARCH_X86(CALL1(avx512::fft_plan_direct));
+
+            generic::parallel_fft_plan_init(&pplan, qbuf, rank, 1);
+            CALL2(generic::parallel_direct_fft);
+            for (size_t i=0; i < sizeof(threads)/sizeof(threads[0]); ++i)
+            {
+                generic::parallel_fft_plan_init(&pplan, qbuf, rank, threads[i]);
+                CALL2(generic::parallel_direct_fft_pass);
+            }
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+        free_aligned(pdata);
+        free_aligned(qdata);
+    }
+PTEST_END
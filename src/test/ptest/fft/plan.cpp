@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 12
+#define MAX_RANK 20
+
+namespace lsp
+{
+    namespace generic
+    {
+        void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+
+        size_t fft_plan_size(size_t rank);
+        void fft_plan_init(dsp::fft_plan_t *plan, void *buf, size_t rank);
+        void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+        void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+
+            void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+
+        namespace avx
+        {
+            void direct_fft_fma3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+
+            void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_direct_fma3(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void fft_plan_packed_direct_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+
+        namespace avx512
+        {
+            void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+
+            void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+    )
+
+    typedef void (* direct_fft_t) (float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+    typedef void (* plan_direct_fft_t) (const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+    typedef void (* plan_packed_direct_fft_t) (const dsp::fft_plan_t *plan, float *dst, const float *src);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for FFT with the plan against FFT with static tables
+PTEST_BEGIN("dsp.fft", plan, 10, 100)
+
+    void call(const char *label, float *fft_re, float *fft_im, const float *sig_re, const float *sig_im, size_t rank, direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            fft(fft_re, fft_im, sig_re, sig_im, rank);
+        )
+    }
+
+    void call(const char *label, const dsp::fft_plan_t *plan, float *fft_re, float *fft_im, const float *sig_re, const float *sig_im, plan_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << plan->rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(plan->rank));
+
+        PTEST_LOOP(buf,
+            fft(plan, fft_re, fft_im, sig_re, sig_im);
+        )
+    }
+
+    void call(const char *label, const dsp::fft_plan_t *plan, float *dst, const float *src, plan_packed_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << plan->rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(plan->rank));
+
+        PTEST_LOOP(buf,
+            fft(plan, dst, src);
+        )
+    }
+
+    PTEST_MAIN
+    {
+        size_t fft_size = 1 << MAX_RANK;
+
+        uint8_t *data   = NULL;
+        uint8_t *pdata  = NULL;
+
+        float *sig_re   = alloc_aligned<float>(data, fft_size * 4, 64);
+        float *sig_im   = &sig_re[fft_size];
+        float *fft_re   = &sig_im[fft_size];
+        float *fft_im   = &fft_re[fft_size];
+        uint8_t *pbuf   = alloc_aligned<uint8_t>(pdata, generic::fft_plan_size(MAX_RANK), 64);
+
+        for (size_t i=0; i < (1 << MAX_RANK); ++i)
+        {
+            sig_re[i]       = randf(0.0f, 1.0f);
+            sig_im[i]       = 0.0f;
+        }
+
+        #define CALL1(func) \
+            call(#func, fft_re, fft_im, sig_re, sig_im, i, func)
+        #define CALL2(func) \
+            call(#func, &plan, fft_re, fft_im, sig_re, sig_im, func)
+        #define CALL3(func) \
+            call(#func, &plan, fft_re, sig_re, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            dsp::fft_plan_t plan;
+            generic::fft_plan_init(&plan, pbuf, i);
+
+            if (i <= 18)
+            {
+                CALL1(generic::direct_fft);
+                IF_ARCH_X86(CALL1(sse::direct_fft));
+                IF_ARCH_X86(CALL1(avx::direct_fft_fma3));
+                IF_ARCH_X86(CALL1(avx512::direct_fft));
+            }
+
+            CALL2(generic::fft_plan_direct);
+            IF_ARCH_X86(CALL2(sse::fft_plan_direct));
+            IF_ARCH_X86(CALL2(avx::fft_plan_direct));
+            IF_ARCH_X86(CALL2(avx::fft_plan_direct_fma3));
+            IF_ARCH_X86(CALL2(avx512::fft_plan_direct));
+
+            CALL3(generic::fft_plan_packed_direct);
+            IF_ARCH_X86(CALL3(sse::fft_plan_packed_direct));
+            IF_ARCH_X86(CALL3(avx::fft_plan_packed_direct));
+            IF_ARCH_X86(CALL3(avx::fft_plan_packed_direct_fma3));
+            IF_ARCH_X86(CALL3(avx512::fft_plan_packed_direct));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+        free_aligned(pdata);
+    }
+PTEST_END
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define FTEST_BUF_SIZE 0x200
+
+namespace lsp
+{
+    namespace generic
+    {
+        void dyn_cascade_lerp_x1(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        void dyn_cascade_lerp_x2(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        void dyn_cascade_lerp_x4(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        void dyn_cascade_lerp_x8(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void dyn_cascade_lerp_x1(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+            void dyn_cascade_lerp_x2(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+            void dyn_cascade_lerp_x4(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+            void dyn_cascade_lerp_x8(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        }
+
+        namespace avx
+        {
+            void dyn_cascade_lerp_x8(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        }
+    )
+
+    typedef void (* dyn_cascade_lerp_t)(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for dynamic filters with interpolated coefficients
+PTEST_BEGIN("dsp.filters", dynlerp, 10, 1000)
+
+    void init_cascades(dsp::f_cascade_t *c0, dsp::f_cascade_t *c1, size_t lanes)
+    {
+        for (size_t j=0; j<lanes; ++j)
+        {
+            c0[j].t[0]  = 1.0f;
+            c0[j].t[1]  = 0.5f;
+            c0[j].t[2]  = 0.2f;
+            c0[j].t[3]  = 0.0f;
+            c0[j].b[0]  = 1.0f;
+            c0[j].b[1]  = 1.4f;
+            c0[j].b[2]  = 1.0f;
+            c0[j].b[3]  = 0.0f;
+
+            c1[j]       = c0[j];
+            c1[j].t[2]  = 0.8f;
+            c1[j].b[1]  = 0.7f;
+        }
+    }
+
+    // Generate the per-sample array of filters by the bilinear transform and apply it
+    template <class bank_t>
+        void precomputed(const char *text, float *out, const float *in, size_t count, size_t lanes,
+            void (* transform)(bank_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count),
+            void (* process)(float *dst, const float *src, float *d, size_t count, const bank_t *f))
+    {
+        printf("Testing %s on input buffer of %d samples ...\n", text, int(count));
+
+        float d[LSP_DSP_BIQUAD_D_ITEMS] __lsp_aligned64;
+        dsp::f_cascade_t c0[8], c1[8];
+        const size_t rows   = count + lanes - 1;
+        dsp::fill_zero(d, LSP_DSP_BIQUAD_D_ITEMS);
+        init_cascades(c0, c1, lanes);
+
+        uint8_t *p1 = NULL, *p2 = NULL;
+        dsp::f_cascade_t *c = alloc_aligned<dsp::f_cascade_t>(p1, rows * lanes, 64);
+        bank_t *f           = alloc_aligned<bank_t>(p2, rows, 64);
+        const float delta   = 1.0f / float(count);
+
+        PTEST_LOOP(text,
+            for (size_t i=0; i<rows; ++i)
+            {
+                for (size_t j=0; j<lanes; ++j)
+                {
+                    float k         = float(lsp_min(i, count - 1)) * delta;
+                    dsp::f_cascade_t *x = &c[i*lanes + j];
+                    for (size_t r=0; r<4; ++r)
+                    {
+                        x->t[r]         = c0[j].t[r] + (c1[j].t[r] - c0[j].t[r]) * k;
+                        x->b[r]         = c0[j].b[r] + (c1[j].b[r] - c0[j].b[r]) * k;
+                    }
+                }
+            }
+            transform(f, c, 1.5f, rows);
+            process(out, in, d, count, f);
+        );
+
+        free_aligned(p1);
+        free_aligned(p2);
+    }
+
+    void fused(const char *text, float *out, const float *in, size_t count, size_t lanes, dyn_cascade_lerp_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        printf("Testing %s on input buffer of %d samples ...\n", text, int(count));
+
+        float d[LSP_DSP_BIQUAD_D_ITEMS] __lsp_aligned64;
+        dsp::f_cascade_t c0[8], c1[8];
+        dsp::fill_zero(d, LSP_DSP_BIQUAD_D_ITEMS);
+        init_cascades(c0, c1, lanes);
+
+        PTEST_LOOP(text,
+            process(out, in, d, count, c0, c1, 1.5f);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *out          = alloc_aligned<float>(data, FTEST_BUF_SIZE * 2, 64);
+        float *in           = &out[FTEST_BUF_SIZE];
+
+        for (size_t i=0; i<FTEST_BUF_SIZE; ++i)
+        {
+            in[i]               = (i & 1) ? 1.0f : -1.0f;
+            out[i]              = 0.0f;
+        }
+
+        precomputed("bilinear_transform_x1 + dyn_biquad_process_x1", out, in, FTEST_BUF_SIZE, 1, dsp::bilinear_transform_x1, dsp::dyn_biquad_process_x1);
+        fused("generic::dyn_cascade_lerp_x1", out, in, FTEST_BUF_SIZE, 1, generic::dyn_cascade_lerp_x1);
+        IF_ARCH_X86(fused("sse::dyn_cascade_lerp_x1", out, in, FTEST_BUF_SIZE, 1, sse::dyn_cascade_lerp_x1));
+        PTEST_SEPARATOR;
+
+        precomputed("bilinear_transform_x2 + dyn_biquad_process_x2", out, in, FTEST_BUF_SIZE, 2, dsp::bilinear_transform_x2, dsp::dyn_biquad_process_x2);
+        fused("generic::dyn_cascade_lerp_x2", out, in, FTEST_BUF_SIZE, 2, generic::dyn_cascade_lerp_x2);
+        IF_ARCH_X86(fused("sse::dyn_cascade_lerp_x2", out, in, FTEST_BUF_SIZE, 2, sse::dyn_cascade_lerp_x2));
+        PTEST_SEPARATOR;
+
+        precomputed("bilinear_transform_x4 + dyn_biquad_process_x4", out, in, FTEST_BUF_SIZE, 4, dsp::bilinear_transform_x4, dsp::dyn_biquad_process_x4);
+        fused("generic::dyn_cascade_lerp_x4", out, in, FTEST_BUF_SIZE, 4, generic::dyn_cascade_lerp_x4);
+        IF_ARCH_X86(fused("sse::dyn_cascade_lerp_x4", out, in, FTEST_BUF_SIZE, 4, sse::dyn_cascade_lerp_x4));
+        PTEST_SEPARATOR;
+
+        precomputed("bilinear_transform_x8 + dyn_biquad_process_x8", out, in, FTEST_BUF_SIZE, 8, dsp::bilinear_transform_x8, dsp::dyn_biquad_process_x8);
+        fused("generic::dyn_cascade_lerp_x8", out, in, FTEST_BUF_SIZE, 8, generic::dyn_cascade_lerp_x8);
+        IF_ARCH_X86(fused("sse::dyn_cascade_lerp_x8", out, in, FTEST_BUF_SIZE, 8, sse::dyn_cascade_lerp_x8));
+        IF_ARCH_X86(fused("avx::dyn_cascade_lerp_x8", out, in, FTEST_BUF_SIZE, 8, avx::dyn_cascade_lerp_x8));
+        PTEST_SEPARATOR;
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define CHANNELS        8
+#define CASCADES        4
+#define FTEST_BUF_SIZE  0x200
+
+namespace lsp
+{
+    namespace generic
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+
+        namespace avx
+        {
+            void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_x1_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+            void biquad_process_mc8_fma3(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+
+        namespace avx512
+        {
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+    )
+
+    typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    typedef void (* biquad_process_mc_t)(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+
+    static dsp::biquad_x1_t bq_normal = {
+        1.0, 2.0, 1.0,
+        -2.0, -1.0,
+        0.0, 0.0, 0.0
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for multichannel biquad processing
+PTEST_BEGIN("dsp.filters", mc, 10, 1000)
+
+    void process_x1(const char *text, float * const *out, const float * const *in, size_t count, size_t nc, biquad_process_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x%d", text, int(nc));
+        printf("Testing %s filters on %d channels of %d samples ...\n", buf, CHANNELS, int(count));
+
+        dsp::biquad_t f[CHANNELS * CASCADES] __lsp_aligned64;
+        for (size_t i=0; i<CHANNELS * CASCADES; ++i)
+        {
+            f[i].x1     = bq_normal;
+            dsp::fill_zero(f[i].d, LSP_DSP_BIQUAD_D_ITEMS);
+        }
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<CHANNELS; ++i)
+            {
+                process(out[i], in[i], count, &f[i * CASCADES]);
+                for (size_t j=1; j<nc; ++j)
+                    process(out[i], out[i], count, &f[i * CASCADES + j]);
+            }
+        );
+    }
+
+    void process_mc8(const char *text, float * const *out, const float * const *in, size_t count, size_t nc, biquad_process_mc_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x%d", text, int(nc));
+        printf("Testing %s filters on %d channels of %d samples ...\n", buf, CHANNELS, int(count));
+
+        dsp::biquad_t f[CASCADES] __lsp_aligned64;
+        for (size_t j=0; j<CASCADES; ++j)
+        {
+            for (size_t i=0; i<CHANNELS; ++i)
+            {
+                f[j].x8.b0[i]   = bq_normal.b0;
+                f[j].x8.b1[i]   = bq_normal.b1;
+                f[j].x8.b2[i]   = bq_normal.b2;
+                f[j].x8.a1[i]   = bq_normal.a1;
+                f[j].x8.a2[i]   = bq_normal.a2;
+            }
+            dsp::fill_zero(f[j].d, LSP_DSP_BIQUAD_D_ITEMS);
+        }
+
+        PTEST_LOOP(buf,
+            process(out, in, count, f, nc);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *buf          = alloc_aligned<float>(data, FTEST_BUF_SIZE * CHANNELS * 2, 64);
+        float *out[CHANNELS];
+        const float *in[CHANNELS];
+
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            out[i]              = &buf[i * FTEST_BUF_SIZE];
+            in[i]               = &buf[(i + CHANNELS) * FTEST_BUF_SIZE];
+        }
+        for (size_t i=0; i<FTEST_BUF_SIZE * CHANNELS * 2; ++i)
+            buf[i]              = (i & 1) ? 1.0f : -1.0f;
+
+        for (size_t nc=1; nc<=CASCADES; nc <<= 2)
+        {
+            process_x1("generic::biquad_process_x1", out, in, FTEST_BUF_SIZE, nc, generic::biquad_process_x1);
+            IF_ARCH_X86(process_x1("sse::biquad_process_x1", out, in, FTEST_BUF_SIZE, nc, sse::biquad_process_x1));
+            IF_ARCH_X86(process_x1("avx::biquad_process_x1", out, in, FTEST_BUF_SIZE, nc, avx::biquad_process_x1));
+            IF_ARCH_X86(process_x1("avx::biquad_process_x1_fma3", out, in, FTEST_BUF_SIZE, nc, avx::biquad_process_x1_fma3));
+            IF_ARCH_ARM(process_x1("neon_d32::biquad_process_x1", out, in, FTEST_BUF_SIZE, nc, neon_d32::biquad_process_x1));
+            IF_ARCH_AARCH64(process_x1("asimd::biquad_process_x1", out, in, FTEST_BUF_SIZE, nc, asimd::biquad_process_x1));
+            PTEST_SEPARATOR;
+
+            process_mc8("generic::biquad_process_mc8", out, in, FTEST_BUF_SIZE, nc, generic::biquad_process_mc8);
+            IF_ARCH_X86(process_mc8("sse::biquad_process_mc8", out, in, FTEST_BUF_SIZE, nc, sse::biquad_process_mc8));
+            IF_ARCH_X86(process_mc8("avx::biquad_process_mc8", out, in, FTEST_BUF_SIZE, nc, avx::biquad_process_mc8));
+            IF_ARCH_X86(process_mc8("avx::biquad_process_mc8_fma3", out, in, FTEST_BUF_SIZE, nc, avx::biquad_process_mc8_fma3));
+            IF_ARCH_X86(process_mc8("avx512::biquad_process_mc8", out, in, FTEST_BUF_SIZE, nc, avx512::biquad_process_mc8));
+            IF_ARCH_ARM(process_mc8("neon_d32::biquad_process_mc8", out, in, FTEST_BUF_SIZE, nc, neon_d32::biquad_process_mc8));
+            IF_ARCH_AARCH64(process_mc8("asimd::biquad_process_mc8", out, in, FTEST_BUF_SIZE, nc, asimd::biquad_process_mc8));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -26,44 +26,94 @@
 #include <lsp-plug.in/test-fw/ptest.h>
 
 #define PERF_BUF_SIZE   0x200
-#define KF              100.0f
-#define TD              (2*M_PI/48000.0)
+#define KF              (2*M_PI*1000.0f)
+#define TD              (1.0f/48000.0f)
 
 namespace lsp
 {
     namespace generic
     {
         void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
     }
 
     IF_ARCH_X86(
-        namespace sse
+        namespace sse2
         {
             void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        }
+
+        namespace avx2
+        {
+            void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+
+            void matched_transform_x1_fma3(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2_fma3(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4_fma3(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8_fma3(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        }
+
+        namespace avx512
+        {
+            void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
         }
     )
 
     typedef void (* matched_transform_x1_t)(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+    typedef void (* matched_transform_x2_t)(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+    typedef void (* matched_transform_x4_t)(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+    typedef void (* matched_transform_x8_t)(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
 
     static const dsp::f_cascade_t test_c =
     {
-        { 1, 2, 1, 0  },
-        { 1, -2, 1, 0 }
+        { 1, 2, 1, 1  },
+        { 1, 1, 1, 1  }
     };
 }
 
 //-----------------------------------------------------------------------------
-// Performance test for bilinear transform
+// Performance test for matched transform
 PTEST_BEGIN("dsp.filters", mt, 10, 10000)
 
-    void call_x1(const char * label, size_t count, matched_transform_x1_t func)
+    void call(const char * label, size_t count, matched_transform_x1_t func)
     {
         printf("Testing %s matched transform on buffer size %d ...\n", label, int(count));
 
-        void *p1 = NULL, *p2 = NULL;
-        dsp::biquad_x1_t *dst = alloc_aligned<dsp::biquad_x1_t>(p1, count, 32);
-        dsp::f_cascade_t *src = alloc_aligned<dsp::f_cascade_t>(p2, count, 32);
-        dsp::f_cascade_t *tmp = alloc_aligned<dsp::f_cascade_t>(p2, count, 32);
+        void *p1 = NULL, *p2 = NULL, *p3 = NULL;
+        dsp::biquad_x1_t *dst = alloc_aligned<dsp::biquad_x1_t>(p1, count, 64);
+        dsp::f_cascade_t *src = alloc_aligned<dsp::f_cascade_t>(p2, count, 64);
+        dsp::f_cascade_t *tmp = alloc_aligned<dsp::f_cascade_t>(p3, count, 64);
 
         for (size_t i=0; i<count; ++i)
             src[i]  = test_c;
@@ -71,32 +121,151 @@ PTEST_BEGIN("dsp.filters", mt, 10, 10000)
         size_t to_copy = count * (sizeof(dsp::f_cascade_t) / sizeof(float));
 
         PTEST_LOOP(label,
-                dsp::copy(tmp->t, src->t, to_copy);
-                generic::matched_transform_x1(dst, tmp, KF, TD, count);
-                dsp::copy(tmp->t, src->t, to_copy);
-                generic::matched_transform_x1(dst, tmp, KF, TD, count);
-                dsp::copy(tmp->t, src->t, to_copy);
-                generic::matched_transform_x1(dst, tmp, KF, TD, count);
-                dsp::copy(tmp->t, src->t, to_copy);
-                generic::matched_transform_x1(dst, tmp, KF, TD, count);
-                dsp::copy(tmp->t, src->t, to_copy);
-                generic::matched_transform_x1(dst, tmp, KF, TD, count);
-                dsp::copy(tmp->t, src->t, to_copy);
-                generic::matched_transform_x1(dst, tmp, KF, TD, count);
-                dsp::copy(tmp->t, src->t, to_copy);
-                generic::matched_transform_x1(dst, tmp, KF, TD, count);
-                dsp::copy(tmp->t, src->t, to_copy);
-                generic::matched_transform_x1(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+        );
+
+        free_aligned(p1);
+        free_aligned(p2);
+        free_aligned(p3);
+    }
+
+    void call(const char * label, size_t count, matched_transform_x2_t func)
+    {
+        printf("Testing %s matched transform on buffer size %d ...\n", label, int(count));
+
+        count++;
+        void *p1 = NULL, *p2 = NULL, *p3 = NULL;
+        dsp::biquad_x2_t *dst = alloc_aligned<dsp::biquad_x2_t>(p1, count, 64);
+        dsp::f_cascade_t *src = alloc_aligned<dsp::f_cascade_t>(p2, count*2, 64);
+        dsp::f_cascade_t *tmp = alloc_aligned<dsp::f_cascade_t>(p3, count*2, 64);
+
+        for (size_t i=0; i<count*2; ++i)
+            src[i]  = test_c;
+
+        size_t to_copy = count*2 * (sizeof(dsp::f_cascade_t) / sizeof(float));
+
+        PTEST_LOOP(label,
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+        );
+
+        free_aligned(p1);
+        free_aligned(p2);
+        free_aligned(p3);
+    }
+
+    void call(const char * label, size_t count, matched_transform_x4_t func)
+    {
+        printf("Testing %s matched transform on buffer size %d ...\n", label, int(count));
+
+        count += 3;
+        void *p1 = NULL, *p2 = NULL, *p3 = NULL;
+        dsp::biquad_x4_t *dst = alloc_aligned<dsp::biquad_x4_t>(p1, count, 64);
+        dsp::f_cascade_t *src = alloc_aligned<dsp::f_cascade_t>(p2, count*4, 64);
+        dsp::f_cascade_t *tmp = alloc_aligned<dsp::f_cascade_t>(p3, count*4, 64);
+
+        for (size_t i=0; i<count*4; ++i)
+            src[i]  = test_c;
+
+        size_t to_copy = count*4 * (sizeof(dsp::f_cascade_t) / sizeof(float));
+
+        PTEST_LOOP(label,
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
+        );
+
+        free_aligned(p1);
+        free_aligned(p2);
+        free_aligned(p3);
+    }
+
+    void call(const char * label, size_t count, matched_transform_x8_t func)
+    {
+        printf("Testing %s matched transform on buffer size %d ...\n", label, int(count));
+
+        count += 7;
+        void *p1 = NULL, *p2 = NULL, *p3 = NULL;
+        dsp::biquad_x8_t *dst = alloc_aligned<dsp::biquad_x8_t>(p1, count, 64);
+        dsp::f_cascade_t *src = alloc_aligned<dsp::f_cascade_t>(p2, count*8, 64);
+        dsp::f_cascade_t *tmp = alloc_aligned<dsp::f_cascade_t>(p3, count*8, 64);
+
+        for (size_t i=0; i<count*8; ++i)
+            src[i]  = test_c;
+
+        size_t to_copy = count*8 * (sizeof(dsp::f_cascade_t) / sizeof(float));
+
+        PTEST_LOOP(label,
+            dsp::copy(tmp->t, src->t, to_copy);
+            func(dst, tmp, KF, TD, count);
         );
 
         free_aligned(p1);
         free_aligned(p2);
+        free_aligned(p3);
     }
 
     PTEST_MAIN
     {
-        call_x1("8 matched x1 generic", PERF_BUF_SIZE, generic::matched_transform_x1);
-        IF_ARCH_X86(call_x1("8 matched x1 sse", PERF_BUF_SIZE, sse::matched_transform_x1));
+        #define CALL(func) \
+            call(#func, PERF_BUF_SIZE, func)
+
+        CALL(generic::matched_transform_x1);
+        IF_ARCH_X86(CALL(sse2::matched_transform_x1));
+        IF_ARCH_X86(CALL(avx2::matched_transform_x1));
+        IF_ARCH_X86(CALL(avx2::matched_transform_x1_fma3));
+        IF_ARCH_X86(CALL(avx512::matched_transform_x1));
+        IF_ARCH_ARM(CALL(neon_d32::matched_transform_x1));
+        IF_ARCH_AARCH64(CALL(asimd::matched_transform_x1));
+        PTEST_SEPARATOR;
+
+        CALL(generic::matched_transform_x2);
+        IF_ARCH_X86(CALL(sse2::matched_transform_x2));
+        IF_ARCH_X86(CALL(avx2::matched_transform_x2));
+        IF_ARCH_X86(CALL(avx2::matched_transform_x2_fma3));
+        IF_ARCH_X86(CALL(avx512::matched_transform_x2));
+        IF_ARCH_ARM(CALL(neon_d32::matched_transform_x2));
+        IF_ARCH_AARCH64(CALL(asimd::matched_transform_x2));
+        PTEST_SEPARATOR;
+
+        CALL(generic::matched_transform_x4);
+        IF_ARCH_X86(CALL(sse2::matched_transform_x4));
+        IF_ARCH_X86(CALL(avx2::matched_transform_x4));
+        IF_ARCH_X86(CALL(avx2::matched_transform_x4_fma3));
+        IF_ARCH_X86(CALL(avx512::matched_transform_x4));
+        IF_ARCH_ARM(CALL(neon_d32::matched_transform_x4));
+        IF_ARCH_AARCH64(CALL(asimd::matched_transform_x4));
+        PTEST_SEPARATOR;
+
+        CALL(generic::matched_transform_x8);
+        IF_ARCH_X86(CALL(sse2::matched_transform_x8));
+        IF_ARCH_X86(CALL(avx2::matched_transform_x8));
+        IF_ARCH_X86(CALL(avx2::matched_transform_x8_fma3));
+        IF_ARCH_X86(CALL(avx512::matched_transform_x8));
+        IF_ARCH_ARM(CALL(neon_d32::matched_transform_x8));
+        IF_ARCH_AARCH64(CALL(asimd::matched_transform_x8));
         PTEST_SEPARATOR;
     }
 
@@ -33,6 +33,7 @@ namespace lsp
         void biquad_process_x2(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         void biquad_process_x4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_x16(float *dst, const float *src, size_t count, dsp::biquad16_t *f);
     }
 
     IF_ARCH_X86(
@@ -63,6 +64,13 @@ namespace lsp
             void x64_biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
             void biquad_process_x8_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         }
+
+        namespace avx512
+        {
+            void biquad_process_x4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_x16(float *dst, const float *src, size_t count, dsp::biquad16_t *f);
+        }
     )
 
     IF_ARCH_ARM(
@@ -86,6 +94,7 @@ namespace lsp
     )
 
     typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    typedef void (* biquad_process16_t)(float *dst, const float *src, size_t count, dsp::biquad16_t *f);
 
     static dsp::biquad_x1_t bq_normal = {
         1.0, 2.0, 1.0,
@@ -203,6 +212,60 @@ PTEST_BEGIN("dsp.filters", static, 10, 1000)
         );
     }
 
+    void process_2x8(const char *text, float *out, const float *in, size_t count, biquad_process_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+        printf("Testing %s static filters on input buffer of %d samples ...\n", text, int(count));
+
+        dsp::biquad_t f[2] __lsp_aligned64;
+        // Filters x 8 x 2
+        for (size_t j=0; j<2; ++j)
+        {
+            for (size_t i=0; i<8; ++i)
+            {
+                f[j].x8.b0[i]   = bq_normal.b0;
+                f[j].x8.b1[i]   = bq_normal.b1;
+                f[j].x8.b2[i]   = bq_normal.b2;
+                f[j].x8.a1[i]   = bq_normal.a1;
+                f[j].x8.a2[i]   = bq_normal.a2;
+            }
+
+            for (size_t i=0; i<16; ++i)
+                f[j].d[i]       = 0.0f;
+        }
+
+        PTEST_LOOP(text,
+            process(out, in, count, &f[0]);
+            process(out, out, count, &f[1]);
+        );
+    }
+
+    void process_1x16(const char *text, float *out, const float *in, size_t count, biquad_process16_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+        printf("Testing %s static filters on input buffer of %d samples ...\n", text, int(count));
+
+        dsp::biquad16_t f __lsp_aligned64;
+        // Filters x 16
+        for (size_t i=0; i<16; ++i)
+        {
+            f.x16.b0[i]    = bq_normal.b0;
+            f.x16.b1[i]    = bq_normal.b1;
+            f.x16.b2[i]    = bq_normal.b2;
+            f.x16.a1[i]    = bq_normal.a1;
+            f.x16.a2[i]    = bq_normal.a2;
+        }
+
+        for (size_t i=0; i<LSP_DSP_BIQUAD16_D_ITEMS; ++i)
+            f.d[i]          = 0.0f;
+
+        PTEST_LOOP(text,
+            process(out, in, count, &f);
+        );
+    }
+
     PTEST_MAIN
     {
         float *out          = new float[FTEST_BUF_SIZE];
@@ -234,6 +297,7 @@ PTEST_BEGIN("dsp.filters", static, 10, 1000)
         IF_ARCH_X86(process_2x4("sse::biquad_process_x4 x2", out, in, FTEST_BUF_SIZE, sse::biquad_process_x4));
         IF_ARCH_X86(process_2x4("avx::biquad_process_x4 x2", out, in, FTEST_BUF_SIZE, avx::biquad_process_x4));
         IF_ARCH_X86(process_2x4("avx::biquad_process_x4_fma3 x2", out, in, FTEST_BUF_SIZE, avx::biquad_process_x4_fma3));
+        IF_ARCH_X86(process_2x4("avx512::biquad_process_x4 x2", out, in, FTEST_BUF_SIZE, avx512::biquad_process_x4));
         IF_ARCH_ARM(process_2x4("neon_d32::biquad_process_x4 x2", out, in, FTEST_BUF_SIZE, neon_d32::biquad_process_x4));
         IF_ARCH_AARCH64(process_2x4("asimd::biquad_process_x4 x2", out, in, FTEST_BUF_SIZE, asimd::biquad_process_x4));
         PTEST_SEPARATOR;
@@ -243,10 +307,20 @@ PTEST_BEGIN("dsp.filters", static, 10, 1000)
         IF_ARCH_X86(process_1x8("sse3::x64_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, sse3::x64_biquad_process_x8));
         IF_ARCH_X86(process_1x8("avx::x64_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, avx::x64_biquad_process_x8));
         IF_ARCH_X86(process_1x8("avx::biquad_process_x8_fma3 x1", out, in, FTEST_BUF_SIZE, avx::biquad_process_x8_fma3));
+        IF_ARCH_X86(process_1x8("avx512::biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, avx512::biquad_process_x8));
         IF_ARCH_ARM(process_1x8("neon_d32::biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, neon_d32::biquad_process_x8));
         IF_ARCH_AARCH64(process_1x8("asimd::biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, asimd::biquad_process_x8));
         PTEST_SEPARATOR;
 
+        process_2x8("generic::biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, generic::biquad_process_x8);
+        process_1x16("generic::biquad_process_x16 x1", out, in, FTEST_BUF_SIZE, generic::biquad_process_x16);
+        IF_ARCH_X86(process_2x8("avx::biquad_process_x8_fma3 x2", out, in, FTEST_BUF_SIZE, avx::biquad_process_x8_fma3));
+        IF_ARCH_X86(process_2x8("avx512::biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, avx512::biquad_process_x8));
+        IF_ARCH_X86(process_1x16("avx512::biquad_process_x16 x1", out, in, FTEST_BUF_SIZE, avx512::biquad_process_x16));
+        IF_ARCH_ARM(process_2x8("neon_d32::biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, neon_d32::biquad_process_x8));
+        IF_ARCH_AARCH64(process_2x8("asimd::biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, asimd::biquad_process_x8));
+        PTEST_SEPARATOR;
+
         delete [] out;
         delete [] in;
     }
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define CHANNELS        8
+#define FTEST_BUF_SIZE  0x200
+
+namespace lsp
+{
+    namespace generic
+    {
+        void svf_process_x1(float *dst, const float *src, float *d, size_t count, const dsp::svf_x1_t *f);
+        void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f);
+        void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+        void svf_lerp_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f0, const dsp::svf_x4_t *f1);
+        void svf_lerp_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f);
+            void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+            void svf_lerp_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f0, const dsp::svf_x4_t *f1);
+            void svf_lerp_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1);
+        }
+
+        namespace avx
+        {
+            void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+            void svf_process_x8_fma3(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+            void svf_lerp_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1);
+            void svf_lerp_x8_fma3(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f);
+            void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f);
+            void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+        }
+    )
+
+    typedef void (* svf_process_x1_t)(float *dst, const float *src, float *d, size_t count, const dsp::svf_x1_t *f);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for state-variable filters
+PTEST_BEGIN("dsp.filters", svf, 10, 1000)
+
+    // Fill the bank with the lowpass filter which cutoff frequency is swept over the buffer
+    template <class bank_t>
+        void init_bank(bank_t *f, size_t count, size_t lanes)
+        {
+            float *v        = reinterpret_cast<float *>(f);
+            for (size_t i=0; i<count; ++i, v += lanes * 5)
+            {
+                for (size_t j=0; j<lanes; ++j)
+                {
+                    v[j]                = tanf(M_PI * (0.01f + 0.2f * float(i) / float(count)));
+                    v[j + lanes]        = 0.7f;
+                    v[j + lanes * 2]    = 0.0f;
+                    v[j + lanes * 3]    = 0.0f;
+                    v[j + lanes * 4]    = 1.0f;
+                }
+            }
+        }
+
+    void process_x1(const char *text, float * const *out, const float * const *in, size_t count, svf_process_x1_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        printf("Testing %s filters on %d channels of %d samples ...\n", text, CHANNELS, int(count));
+
+        uint8_t *p          = NULL;
+        dsp::svf_x1_t *f    = alloc_aligned<dsp::svf_x1_t>(p, count, 64);
+        float d[CHANNELS * 2] __lsp_aligned64;
+        dsp::fill_zero(d, CHANNELS * 2);
+        for (size_t i=0; i<count; ++i)
+        {
+            f[i].g      = tanf(M_PI * (0.01f + 0.2f * float(i) / float(count)));
+            f[i].k      = 0.7f;
+            f[i].m0     = 0.0f;
+            f[i].m1     = 0.0f;
+            f[i].m2     = 1.0f;
+            f[i].p0     = 0.0f;
+            f[i].p1     = 0.0f;
+            f[i].p2     = 0.0f;
+        }
+
+        PTEST_LOOP(text,
+            for (size_t i=0; i<CHANNELS; ++i)
+                process(out[i], in[i], &d[i*2], count, f);
+        );
+
+        free_aligned(p);
+    }
+
+    template <class bank_t>
+        void process_xn(const char *text, float * const *out, const float * const *in, size_t count, size_t lanes,
+            void (* process)(float * const *dst, const float * const *src, float *d, size_t count, const bank_t *f))
+        {
+            if (!PTEST_SUPPORTED(process))
+                return;
+
+            printf("Testing %s filters on %d channels of %d samples ...\n", text, CHANNELS, int(count));
+
+            uint8_t *p          = NULL;
+            bank_t *f           = alloc_aligned<bank_t>(p, count, 64);
+            float d[CHANNELS * 2] __lsp_aligned64;
+            dsp::fill_zero(d, CHANNELS * 2);
+            init_bank(f, count, lanes);
+
+            PTEST_LOOP(text,
+                for (size_t i=0; i<CHANNELS; i += lanes)
+                    process(&out[i], &in[i], &d[i*2], count, f);
+            );
+
+            free_aligned(p);
+        }
+
+    template <class bank_t>
+        void lerp_xn(const char *text, float * const *out, const float * const *in, size_t count, size_t lanes,
+            void (* process)(float * const *dst, const float * const *src, float *d, size_t count, const bank_t *f0, const bank_t *f1))
+        {
+            if (!PTEST_SUPPORTED(process))
+                return;
+
+            printf("Testing %s filters on %d channels of %d samples ...\n", text, CHANNELS, int(count));
+
+            bank_t f[2] __lsp_aligned64;
+            float d[CHANNELS * 2] __lsp_aligned64;
+            dsp::fill_zero(d, CHANNELS * 2);
+            init_bank(f, 2, lanes);
+
+            PTEST_LOOP(text,
+                for (size_t i=0; i<CHANNELS; i += lanes)
+                    process(&out[i], &in[i], &d[i*2], count, &f[0], &f[1]);
+            );
+        }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *buf          = alloc_aligned<float>(data, FTEST_BUF_SIZE * CHANNELS * 2, 64);
+        float *out[CHANNELS];
+        const float *in[CHANNELS];
+
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            out[i]              = &buf[i * FTEST_BUF_SIZE];
+            in[i]               = &buf[(i + CHANNELS) * FTEST_BUF_SIZE];
+        }
+        for (size_t i=0; i<FTEST_BUF_SIZE * CHANNELS * 2; ++i)
+            buf[i]              = (i & 1) ? 1.0f : -1.0f;
+
+        process_x1("generic::svf_process_x1 x8", out, in, FTEST_BUF_SIZE, generic::svf_process_x1);
+        PTEST_SEPARATOR;
+
+        process_xn("generic::svf_process_x4 x2", out, in, FTEST_BUF_SIZE, 4, generic::svf_process_x4);
+        IF_ARCH_X86(process_xn("sse::svf_process_x4 x2", out, in, FTEST_BUF_SIZE, 4, sse::svf_process_x4));
+        IF_ARCH_ARM(process_xn("neon_d32::svf_process_x4 x2", out, in, FTEST_BUF_SIZE, 4, neon_d32::svf_process_x4));
+        IF_ARCH_AARCH64(process_xn("asimd::svf_process_x4 x2", out, in, FTEST_BUF_SIZE, 4, asimd::svf_process_x4));
+        lerp_xn("generic::svf_lerp_x4 x2", out, in, FTEST_BUF_SIZE, 4, generic::svf_lerp_x4);
+        IF_ARCH_X86(lerp_xn("sse::svf_lerp_x4 x2", out, in, FTEST_BUF_SIZE, 4, sse::svf_lerp_x4));
+        PTEST_SEPARATOR;
+
+        process_xn("generic::svf_process_x8", out, in, FTEST_BUF_SIZE, 8, generic::svf_process_x8);
+        IF_ARCH_X86(process_xn("sse::svf_process_x8", out, in, FTEST_BUF_SIZE, 8, sse::svf_process_x8));
+        IF_ARCH_X86(process_xn("avx::svf_process_x8", out, in, FTEST_BUF_SIZE, 8, avx::svf_process_x8));
+        IF_ARCH_X86(process_xn("avx::svf_process_x8_fma3", out, in, FTEST_BUF_SIZE, 8, avx::svf_process_x8_fma3));
+        IF_ARCH_ARM(process_xn("neon_d32::svf_process_x8", out, in, FTEST_BUF_SIZE, 8, neon_d32::svf_process_x8));
+        IF_ARCH_AARCH64(process_xn("asimd::svf_process_x8", out, in, FTEST_BUF_SIZE, 8, asimd::svf_process_x8));
+        lerp_xn("generic::svf_lerp_x8", out, in, FTEST_BUF_SIZE, 8, generic::svf_lerp_x8);
+        IF_ARCH_X86(lerp_xn("sse::svf_lerp_x8", out, in, FTEST_BUF_SIZE, 8, sse::svf_lerp_x8));
+        IF_ARCH_X86(lerp_xn("avx::svf_lerp_x8", out, in, FTEST_BUF_SIZE, 8, avx::svf_lerp_x8));
+        IF_ARCH_X86(lerp_xn("avx::svf_lerp_x8_fma3", out, in, FTEST_BUF_SIZE, 8, avx::svf_lerp_x8_fma3));
+        PTEST_SEPARATOR;
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_LENGTH      8
+#define MAX_LENGTH      128
+#define BUF_SIZE        1024
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count);
+        void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+            const float *taps, size_t length, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count);
+            void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+                const float *taps, size_t length, size_t count);
+        }
+
+        namespace avx
+        {
+            void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count);
+            void fir_direct_fma3(float *dst, const float *src, const float *taps, size_t length, size_t count);
+            void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+                const float *taps, size_t length, size_t count);
+            void fir_direct_x2_fma3(float *dst1, float *dst2, const float *src1, const float *src2,
+                const float *taps, size_t length, size_t count);
+        }
+
+        namespace avx512
+        {
+            void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count);
+            void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+                const float *taps, size_t length, size_t count);
+        }
+    )
+
+    typedef void (* fir_direct_t)(float *dst, const float *src, const float *taps, size_t length, size_t count);
+    typedef void (* fir_direct_x2_t)(float *dst1, float *dst2, const float *src1, const float *src2,
+        const float *taps, size_t length, size_t count);
+}
+
+PTEST_BEGIN("dsp.fir", direct, 5, 1000)
+
+    void call(const char *label, float *dst, const float *src, const float *taps, size_t length, fir_direct_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(length));
+        printf("Testing %s FIR filter ...\n", buf);
+
+        // Process two channels to make the result comparable with the x2 function
+        PTEST_LOOP(buf,
+            func(dst, src, taps, length, BUF_SIZE);
+            func(&dst[BUF_SIZE], &src[BUF_SIZE + MAX_LENGTH], taps, length, BUF_SIZE);
+        );
+    }
+
+    void call(const char *label, float *dst, const float *src, const float *taps, size_t length, fir_direct_x2_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(length));
+        printf("Testing %s FIR filter ...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, &dst[BUF_SIZE], src, &src[BUF_SIZE + MAX_LENGTH], taps, length, BUF_SIZE);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *src      = alloc_aligned<float>(data, (BUF_SIZE + MAX_LENGTH) * 2 + BUF_SIZE * 2 + MAX_LENGTH, 64);
+        float *dst      = &src[(BUF_SIZE + MAX_LENGTH) * 2];
+        float *taps     = &dst[BUF_SIZE * 2];
+
+        for (size_t i=0; i < (BUF_SIZE + MAX_LENGTH) * 2; ++i)
+            src[i]          = randf(-1.0f, 1.0f);
+        for (size_t i=0; i < MAX_LENGTH; ++i)
+            taps[i]         = randf(-1.0f, 1.0f);
+
+        #define CALL(func, length) \
+            call(#func, dst, src, taps, length, func)
+
+        for (size_t length=MIN_LENGTH; length <= MAX_LENGTH; length <<= 1)
+        {
+            CALL(generic::fir_direct, length);
+            IF_ARCH_X86(CALL(sse::fir_direct, length));
+            IF_ARCH_X86(CALL(avx::fir_direct, length));
+            IF_ARCH_X86(CALL(avx::fir_direct_fma3, length));
+            IF_ARCH_X86(CALL(avx512::fir_direct, length));
+            PTEST_SEPARATOR;
+
+            CALL(generic::fir_direct_x2, length);
+            IF_ARCH_X86(CALL(sse::fir_direct_x2, length));
+            IF_ARCH_X86(CALL(avx::fir_direct_x2, length));
+            IF_ARCH_X86(CALL(avx::fir_direct_x2_fma3, length));
+            IF_ARCH_X86(CALL(avx512::fir_direct_x2, length));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
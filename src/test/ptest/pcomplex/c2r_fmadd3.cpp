@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 6
+#define MAX_RANK 16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void pcomplex_c2r_fmadd3(float *dst, const float *src, const float *k, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void pcomplex_c2r_fmadd3(float *dst, const float *src, const float *k, size_t count);
+            }
+
+        namespace avx
+        {
+            void pcomplex_c2r_fmadd3(float *dst, const float *src, const float *k, size_t count);
+            }
+    )
+
+    typedef void (* pcomplex_c2r_op3_t)(float *dst, const float *src, const float *k, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for multiply-add of the real part of packed complex data
+PTEST_BEGIN("dsp.pcomplex", c2r_fmadd3, 5, 1000)
+
+    void call(const char *label, float *dst, const float *src, const float *k, size_t count, pcomplex_c2r_op3_t op)
+    {
+        if (!PTEST_SUPPORTED(op))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        PTEST_LOOP(buf,
+            op(dst, src, k, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *out      = alloc_aligned<float>(data, buf_size*5, 64);
+        float *in       = &out[buf_size*2];
+        float *k        = &in[buf_size*2];
+
+        randomize_sign(out, buf_size*5);
+
+        #define CALL(func) \
+            call(#func, k, in, out, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            size_t count = 1 << i;
+
+            CALL(generic::pcomplex_c2r_fmadd3);
+            IF_ARCH_X86(CALL(sse::pcomplex_c2r_fmadd3));
+            IF_ARCH_X86(CALL(avx::pcomplex_c2r_fmadd3));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -53,6 +53,24 @@ namespace lsp
             void downsample_6x(float *dst, const float *src, size_t count);
             void downsample_8x(float *dst, const float *src, size_t count);
         }
+
+        namespace avx2
+        {
+            void downsample_2x(float *dst, const float *src, size_t count);
+            void downsample_3x(float *dst, const float *src, size_t count);
+            void downsample_4x(float *dst, const float *src, size_t count);
+            void downsample_6x(float *dst, const float *src, size_t count);
+            void downsample_8x(float *dst, const float *src, size_t count);
+        }
+
+        namespace avx512
+        {
+            void downsample_2x(float *dst, const float *src, size_t count);
+            void downsample_3x(float *dst, const float *src, size_t count);
+            void downsample_4x(float *dst, const float *src, size_t count);
+            void downsample_6x(float *dst, const float *src, size_t count);
+            void downsample_8x(float *dst, const float *src, size_t count);
+        }
     )
 
     IF_ARCH_ARM(
@@ -112,6 +130,8 @@ PTEST_BEGIN("dsp.resampling", downsampling, 5, 1000)
         CALL(generic::downsample_2x, 2);
         IF_ARCH_X86(CALL(sse::downsample_2x, 2));
         IF_ARCH_X86(CALL(avx::downsample_2x, 2));
+        IF_ARCH_X86(CALL(avx2::downsample_2x, 2));
+        IF_ARCH_X86(CALL(avx512::downsample_2x, 2));
         IF_ARCH_ARM(CALL(neon_d32::downsample_2x, 2));
         IF_ARCH_AARCH64(CALL(asimd::downsample_2x, 2));
         PTEST_SEPARATOR;
@@ -119,6 +139,8 @@ PTEST_BEGIN("dsp.resampling", downsampling, 5, 1000)
         CALL(generic::downsample_3x, 3);
         IF_ARCH_X86(CALL(sse::downsample_3x, 3));
         IF_ARCH_X86(CALL(avx::downsample_3x, 3));
+        IF_ARCH_X86(CALL(avx2::downsample_3x, 3));
+        IF_ARCH_X86(CALL(avx512::downsample_3x, 3));
         IF_ARCH_ARM(CALL(neon_d32::downsample_3x, 3));
         IF_ARCH_AARCH64(CALL(asimd::downsample_3x, 3));
         PTEST_SEPARATOR;
@@ -126,6 +148,8 @@ PTEST_BEGIN("dsp.resampling", downsampling, 5, 1000)
         CALL(generic::downsample_4x, 4);
         IF_ARCH_X86(CALL(sse::downsample_4x, 4));
         IF_ARCH_X86(CALL(avx::downsample_4x, 4));
+        IF_ARCH_X86(CALL(avx2::downsample_4x, 4));
+        IF_ARCH_X86(CALL(avx512::downsample_4x, 4));
         IF_ARCH_ARM(CALL(neon_d32::downsample_4x, 4));
         IF_ARCH_AARCH64(CALL(asimd::downsample_4x, 4));
         PTEST_SEPARATOR;
@@ -133,6 +157,8 @@ PTEST_BEGIN("dsp.resampling", downsampling, 5, 1000)
         CALL(generic::downsample_6x, 6);
         IF_ARCH_X86(CALL(sse::downsample_6x, 6));
         IF_ARCH_X86(CALL(avx::downsample_6x, 6));
+        IF_ARCH_X86(CALL(avx2::downsample_6x, 6));
+        IF_ARCH_X86(CALL(avx512::downsample_6x, 6));
         IF_ARCH_ARM(CALL(neon_d32::downsample_6x, 6));
         IF_ARCH_AARCH64(CALL(asimd::downsample_6x, 6));
         PTEST_SEPARATOR;
@@ -140,6 +166,8 @@ PTEST_BEGIN("dsp.resampling", downsampling, 5, 1000)
         CALL(generic::downsample_8x, 8);
         IF_ARCH_X86(CALL(sse::downsample_8x, 8));
         IF_ARCH_X86(CALL(avx::downsample_8x, 8));
+        IF_ARCH_X86(CALL(avx2::downsample_8x, 8));
+        IF_ARCH_X86(CALL(avx512::downsample_8x, 8));
         IF_ARCH_ARM(CALL(neon_d32::downsample_8x, 8));
         IF_ARCH_AARCH64(CALL(asimd::downsample_8x, 8));
         PTEST_SEPARATOR;
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define RTEST_BUF_SIZE  0x1000
+#define RTEST_TIMES_MAX 16
+#define RTEST_TAIL_MAX  (2 * 16 * 10)
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t lanczos_kernel_size(size_t times, size_t lobes);
+        void lanczos_kernel_init(dsp::lanczos_kernel_t *kernel, void *buf, size_t times, size_t lobes);
+        void lanczos_resample(float *dst, const float *src, const dsp::lanczos_kernel_t *kernel, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace avx2
+        {
+            void lanczos_resample_fma3(float *dst, const float *src, const dsp::lanczos_kernel_t *kernel, size_t count);
+        }
+
+        namespace avx512
+        {
+            void lanczos_resample(float *dst, const float *src, const dsp::lanczos_kernel_t *kernel, size_t count);
+        }
+    )
+
+    typedef void (* lanczos_resample_t)(float *dst, const float *src, const dsp::lanczos_kernel_t *kernel, size_t count);
+}
+
+PTEST_BEGIN("dsp.resampling", lanczos, 5, 1000)
+
+    void call(float *out, const float *in, size_t count, const dsp::lanczos_kernel_t *k, const char *text, lanczos_resample_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s %dx%d", text, int(k->times), int(k->lobes));
+        printf("Testing %s oversampling for %d -> %d samples ...\n", buf, int(count), int(count * k->times));
+        size_t zeros = count * k->times + k->length;
+
+        PTEST_LOOP(buf,
+            dsp::fill_zero(out, zeros);
+            func(out, in, k, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        static const uint8_t params[][2] =
+        {
+            { 2, 4 }, { 5, 3 }, { 5, 10 }, { 16, 4 }, { 16, 10 }
+        };
+
+        float *out          = new float[RTEST_BUF_SIZE * RTEST_TIMES_MAX + RTEST_TAIL_MAX];
+        float *in           = new float[RTEST_BUF_SIZE];
+        uint8_t *data       = new uint8_t[generic::lanczos_kernel_size(RTEST_TIMES_MAX, 10)];
+
+        // Prepare data
+        for (size_t i=0; i<RTEST_BUF_SIZE; ++i)
+            in[i]               = (i % 2) ? 1.0f : -1.0f;
+        dsp::fill_zero(out, RTEST_BUF_SIZE * RTEST_TIMES_MAX + RTEST_TAIL_MAX);
+
+        #define CALL(func) \
+            call(out, in, RTEST_BUF_SIZE, &k, #func, func)
+
+        for (size_t i=0; i<sizeof(params)/sizeof(params[0]); ++i)
+        {
+            dsp::lanczos_kernel_t k;
+            generic::lanczos_kernel_init(&k, data, params[i][0], params[i][1]);
+
+            CALL(generic::lanczos_resample);
+            IF_ARCH_X86(CALL(avx2::lanczos_resample_fma3));
+            IF_ARCH_X86(CALL(avx512::lanczos_resample));
+            PTEST_SEPARATOR;
+        }
+
+        delete [] data;
+        delete [] out;
+        delete [] in;
+    }
+
+PTEST_END
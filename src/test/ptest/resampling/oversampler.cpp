@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define BLOCK_SIZE      0x400
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t oversampler_size(size_t factor, size_t zcross);
+        void oversampler_init(dsp::oversampler_t *os, void *buf, size_t factor, size_t zcross);
+        void oversampler_process(dsp::oversampler_t *os, float *dst, const float *src, size_t count,
+            dsp::oversampler_callback_t callback, void *arg);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for the oversampler compared with the separate lanczos
+// oversampling, processing and decimation, the result is reported in input
+// samples per second
+PTEST_BEGIN("dsp.resampling", oversampler, 5, 1000)
+
+    static void clip(void *arg, float *buf, size_t count)
+    {
+        dsp::limit1(buf, -0.5f, 0.5f, count);
+    }
+
+    void call(float *out, const float *in, size_t factor, size_t zcross)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "oversampler x%d zc=%d", int(factor), int(zcross));
+        printf("Testing %s on blocks of %d samples...\n", buf, int(BLOCK_SIZE));
+
+        uint8_t *data   = new uint8_t[generic::oversampler_size(factor, zcross)];
+        dsp::oversampler_t os;
+        generic::oversampler_init(&os, data, factor, zcross);
+
+        PTEST_KLOOP(buf, BLOCK_SIZE,
+            generic::oversampler_process(&os, out, in, BLOCK_SIZE, clip, NULL);
+        );
+
+        delete [] data;
+    }
+
+    void call_lanczos(float *out, float *tmp, const float *in, size_t factor,
+        dsp::resampling_function_t resample, dsp::resampling_function_t downsample)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "lanczos x%d", int(factor));
+        printf("Testing %s on blocks of %d samples...\n", buf, int(BLOCK_SIZE));
+
+        size_t os_count = BLOCK_SIZE * factor;
+
+        PTEST_KLOOP(buf, BLOCK_SIZE,
+            resample(tmp, in, BLOCK_SIZE);
+            clip(NULL, tmp, os_count);
+            downsample(out, tmp, BLOCK_SIZE);
+            dsp::move(tmp, &tmp[os_count], LSP_DSP_RESAMPLING_RSV_SAMPLES);
+            dsp::fill_zero(&tmp[LSP_DSP_RESAMPLING_RSV_SAMPLES], os_count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t tmp_size = BLOCK_SIZE * 8 + LSP_DSP_RESAMPLING_RSV_SAMPLES;
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BLOCK_SIZE * 2 + tmp_size, 64);
+        float *out      = &in[BLOCK_SIZE];
+        float *tmp      = &out[BLOCK_SIZE];
+
+        randomize_sign(in, BLOCK_SIZE);
+        dsp::fill_zero(tmp, tmp_size);
+
+        static const size_t zcross[] = { 4, 8, 16, 32 };
+
+        #define CALL(factor, resample, downsample) \
+            call_lanczos(out, tmp, in, factor, resample, downsample); \
+            for (size_t i=0; i<sizeof(zcross)/sizeof(size_t); ++i) \
+                call(out, in, factor, zcross[i]); \
+            PTEST_SEPARATOR;
+
+        CALL(2, dsp::lanczos_resample_2x3, dsp::downsample_2x);
+        CALL(3, dsp::lanczos_resample_3x3, dsp::downsample_3x);
+        CALL(4, dsp::lanczos_resample_4x3, dsp::downsample_4x);
+        CALL(6, dsp::lanczos_resample_6x3, dsp::downsample_6x);
+        CALL(8, dsp::lanczos_resample_8x3, dsp::downsample_8x);
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -32,18 +32,28 @@ namespace lsp
         void lanczos_resample_2x2(float *dst, const float *src, size_t count);
         void lanczos_resample_2x3(float *dst, const float *src, size_t count);
         void lanczos_resample_2x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_2x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_2x24bit(float *dst, const float *src, size_t count);
         void lanczos_resample_3x2(float *dst, const float *src, size_t count);
         void lanczos_resample_3x3(float *dst, const float *src, size_t count);
         void lanczos_resample_3x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_3x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_3x24bit(float *dst, const float *src, size_t count);
         void lanczos_resample_4x2(float *dst, const float *src, size_t count);
         void lanczos_resample_4x3(float *dst, const float *src, size_t count);
         void lanczos_resample_4x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_4x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_4x24bit(float *dst, const float *src, size_t count);
         void lanczos_resample_6x2(float *dst, const float *src, size_t count);
         void lanczos_resample_6x3(float *dst, const float *src, size_t count);
         void lanczos_resample_6x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_6x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_6x24bit(float *dst, const float *src, size_t count);
         void lanczos_resample_8x2(float *dst, const float *src, size_t count);
         void lanczos_resample_8x3(float *dst, const float *src, size_t count);
         void lanczos_resample_8x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_8x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_8x24bit(float *dst, const float *src, size_t count);
     }
 
     IF_ARCH_X86(
@@ -84,6 +94,64 @@ namespace lsp
             void lanczos_resample_8x3(float *dst, const float *src, size_t count);
             void lanczos_resample_8x4(float *dst, const float *src, size_t count);
         }
+
+        namespace avx2
+        {
+            void lanczos_resample_2x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x24bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x24bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x24bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x24bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x24bit_fma3(float *dst, const float *src, size_t count);
+        }
+
+        namespace avx512
+        {
+            void lanczos_resample_2x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x24bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x24bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x24bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x24bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x24bit(float *dst, const float *src, size_t count);
+        }
     )
 
     IF_ARCH_ARM(
@@ -164,6 +232,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_2x2, 2);
         IF_ARCH_X86(CALL(sse::lanczos_resample_2x2, 2));
         IF_ARCH_X86(CALL(avx::lanczos_resample_2x2, 2));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_2x2_fma3, 2));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_2x2, 2));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_2x2, 2));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_2x2, 2));
         PTEST_SEPARATOR;
@@ -171,6 +241,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_2x3, 2);
         IF_ARCH_X86(CALL(sse::lanczos_resample_2x3, 2));
         IF_ARCH_X86(CALL(avx::lanczos_resample_2x3, 2));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_2x3_fma3, 2));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_2x3, 2));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_2x3, 2));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_2x3, 2));
         PTEST_SEPARATOR;
@@ -178,6 +250,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_2x4, 2);
         IF_ARCH_X86(CALL(sse::lanczos_resample_2x4, 2));
         IF_ARCH_X86(CALL(avx::lanczos_resample_2x4, 2));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_2x4_fma3, 2));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_2x4, 2));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_2x4, 2));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_2x4, 2));
         PTEST_SEPARATOR;
@@ -185,6 +259,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_3x2, 3);
         IF_ARCH_X86(CALL(sse::lanczos_resample_3x2, 3));
         IF_ARCH_X86(CALL(avx::lanczos_resample_3x2, 3));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_3x2_fma3, 3));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_3x2, 3));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_3x2, 3));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_3x2, 3));
         PTEST_SEPARATOR;
@@ -192,6 +268,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_3x3, 3);
         IF_ARCH_X86(CALL(sse::lanczos_resample_3x3, 3));
         IF_ARCH_X86(CALL(avx::lanczos_resample_3x3, 3));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_3x3_fma3, 3));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_3x3, 3));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_3x3, 3));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_3x3, 3));
         PTEST_SEPARATOR;
@@ -199,6 +277,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_3x4, 3);
         IF_ARCH_X86(CALL(sse::lanczos_resample_3x4, 3));
         IF_ARCH_X86(CALL(avx::lanczos_resample_3x4, 3));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_3x4_fma3, 3));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_3x4, 3));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_3x4, 3));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_3x4, 3));
         PTEST_SEPARATOR;
@@ -206,6 +286,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_4x2, 4);
         IF_ARCH_X86(CALL(sse::lanczos_resample_4x2, 4));
         IF_ARCH_X86(CALL(avx::lanczos_resample_4x2, 4));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_4x2_fma3, 4));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_4x2, 4));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_4x2, 4));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_4x2, 4));
         PTEST_SEPARATOR;
@@ -213,6 +295,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_4x3, 4);
         IF_ARCH_X86(CALL(sse::lanczos_resample_4x3, 4));
         IF_ARCH_X86(CALL(avx::lanczos_resample_4x3, 4));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_4x3_fma3, 4));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_4x3, 4));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_4x3, 4));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_4x3, 4));
         PTEST_SEPARATOR;
@@ -220,6 +304,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_4x4, 4);
         IF_ARCH_X86(CALL(sse::lanczos_resample_4x4, 4));
         IF_ARCH_X86(CALL(avx::lanczos_resample_4x4, 4));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_4x4_fma3, 4));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_4x4, 4));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_4x4, 4));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_4x4, 4));
         PTEST_SEPARATOR;
@@ -227,6 +313,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_6x2, 6);
         IF_ARCH_X86(CALL(sse::lanczos_resample_6x2, 6));
         IF_ARCH_X86(CALL(avx::lanczos_resample_6x2, 6));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_6x2_fma3, 6));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_6x2, 6));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_6x2, 6));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_6x2, 6));
         PTEST_SEPARATOR;
@@ -234,6 +322,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_6x3, 6);
         IF_ARCH_X86(CALL(sse::lanczos_resample_6x3, 6));
         IF_ARCH_X86(CALL(avx::lanczos_resample_6x3, 6));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_6x3_fma3, 6));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_6x3, 6));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_6x3, 6));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_6x3, 6));
         PTEST_SEPARATOR;
@@ -241,6 +331,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_6x4, 6);
         IF_ARCH_X86(CALL(sse::lanczos_resample_6x4, 6));
         IF_ARCH_X86(CALL(avx::lanczos_resample_6x4, 6));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_6x4_fma3, 6));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_6x4, 6));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_6x4, 6));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_6x4, 6));
         PTEST_SEPARATOR;
@@ -248,6 +340,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_8x2, 8);
         IF_ARCH_X86(CALL(sse::lanczos_resample_8x2, 8));
         IF_ARCH_X86(CALL(avx::lanczos_resample_8x2, 8));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_8x2_fma3, 8));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_8x2, 8));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_8x2, 8));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_8x2, 8));
         PTEST_SEPARATOR;
@@ -255,6 +349,8 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_8x3, 8);
         IF_ARCH_X86(CALL(sse::lanczos_resample_8x3, 8));
         IF_ARCH_X86(CALL(avx::lanczos_resample_8x3, 8));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_8x3_fma3, 8));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_8x3, 8));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_8x3, 8));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_8x3, 8));
         PTEST_SEPARATOR;
@@ -262,10 +358,62 @@ PTEST_BEGIN("dsp.resampling", oversampling, 5, 1000)
         CALL(generic::lanczos_resample_8x4, 8);
         IF_ARCH_X86(CALL(sse::lanczos_resample_8x4, 8));
         IF_ARCH_X86(CALL(avx::lanczos_resample_8x4, 8));
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_8x4_fma3, 8));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_8x4, 8));
         IF_ARCH_ARM(CALL(neon_d32::lanczos_resample_8x4, 8));
         IF_ARCH_AARCH64(CALL(asimd::lanczos_resample_8x4, 8));
         PTEST_SEPARATOR;
 
+        CALL(generic::lanczos_resample_2x16bit, 2);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_2x16bit_fma3, 2));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_2x16bit, 2));
+        PTEST_SEPARATOR;
+
+        CALL(generic::lanczos_resample_2x24bit, 2);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_2x24bit_fma3, 2));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_2x24bit, 2));
+        PTEST_SEPARATOR;
+
+        CALL(generic::lanczos_resample_3x16bit, 3);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_3x16bit_fma3, 3));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_3x16bit, 3));
+        PTEST_SEPARATOR;
+
+        CALL(generic::lanczos_resample_3x24bit, 3);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_3x24bit_fma3, 3));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_3x24bit, 3));
+        PTEST_SEPARATOR;
+
+        CALL(generic::lanczos_resample_4x16bit, 4);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_4x16bit_fma3, 4));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_4x16bit, 4));
+        PTEST_SEPARATOR;
+
+        CALL(generic::lanczos_resample_4x24bit, 4);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_4x24bit_fma3, 4));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_4x24bit, 4));
+        PTEST_SEPARATOR;
+
+        CALL(generic::lanczos_resample_6x16bit, 6);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_6x16bit_fma3, 6));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_6x16bit, 6));
+        PTEST_SEPARATOR;
+
+        CALL(generic::lanczos_resample_6x24bit, 6);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_6x24bit_fma3, 6));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_6x24bit, 6));
+        PTEST_SEPARATOR;
+
+        CALL(generic::lanczos_resample_8x16bit, 8);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_8x16bit_fma3, 8));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_8x16bit, 8));
+        PTEST_SEPARATOR;
+
+        CALL(generic::lanczos_resample_8x24bit, 8);
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_8x24bit_fma3, 8));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample_8x24bit, 8));
+        PTEST_SEPARATOR;
+
         delete [] out;
         delete [] in;
     }
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define RTEST_BUF_SIZE  0x1000
+#define PHASE_TAPS      16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+        void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+        }
+
+        namespace avx
+        {
+            void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_interpolate_fma3(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_decimate_fma3(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+        }
+    )
+
+    typedef void (* fir_resample_t)(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for polyphase FIR resampling
+PTEST_BEGIN("dsp.resampling", polyphase, 5, 1000)
+
+    void call_interpolate(float *out, const float *in, const float *taps, size_t factor,
+        const char *label, fir_resample_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x%d", label, int(factor));
+        printf("Testing %s interpolation of %d samples with %d taps ...\n",
+            buf, int(RTEST_BUF_SIZE), int(PHASE_TAPS * factor));
+
+        PTEST_LOOP(buf,
+            func(out, in, taps, PHASE_TAPS, factor, RTEST_BUF_SIZE);
+        );
+    }
+
+    void call_decimate(float *out, const float *in, const float *taps, size_t factor,
+        const char *label, fir_resample_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x%d", label, int(factor));
+        printf("Testing %s decimation of %d samples with %d taps ...\n",
+            buf, int(RTEST_BUF_SIZE * factor), int(PHASE_TAPS * factor));
+
+        PTEST_LOOP(buf,
+            func(out, in, taps, PHASE_TAPS * factor, factor, RTEST_BUF_SIZE);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t in_size      = (RTEST_BUF_SIZE + PHASE_TAPS) * 8;
+        size_t out_size     = RTEST_BUF_SIZE * 8;
+        size_t taps_size    = PHASE_TAPS * 8;
+
+        uint8_t *data       = NULL;
+        float *in           = alloc_aligned<float>(data, in_size + out_size + taps_size, 64);
+        float *out          = &in[in_size];
+        float *taps         = &out[out_size];
+
+        // Prepare data
+        for (size_t i=0; i<in_size; ++i)
+            in[i]               = randf(-1.0f, 1.0f);
+        for (size_t i=0; i<taps_size; ++i)
+            taps[i]             = randf(-1.0f, 1.0f);
+
+        static const size_t factors[] = { 2, 3, 4, 6, 8 };
+
+        for (size_t i=0; i<sizeof(factors)/sizeof(size_t); ++i)
+        {
+            size_t factor       = factors[i];
+
+            call_interpolate(out, in, taps, factor, "generic::fir_interpolate", generic::fir_interpolate);
+            IF_ARCH_X86(call_interpolate(out, in, taps, factor, "sse::fir_interpolate", sse::fir_interpolate));
+            IF_ARCH_X86(call_interpolate(out, in, taps, factor, "avx::fir_interpolate", avx::fir_interpolate));
+            IF_ARCH_X86(call_interpolate(out, in, taps, factor, "avx::fir_interpolate_fma3", avx::fir_interpolate_fma3));
+            IF_ARCH_ARM(call_interpolate(out, in, taps, factor, "neon_d32::fir_interpolate", neon_d32::fir_interpolate));
+            PTEST_SEPARATOR;
+
+            call_decimate(out, in, taps, factor, "generic::fir_decimate", generic::fir_decimate);
+            IF_ARCH_X86(call_decimate(out, in, taps, factor, "sse::fir_decimate", sse::fir_decimate));
+            IF_ARCH_X86(call_decimate(out, in, taps, factor, "avx::fir_decimate", avx::fir_decimate));
+            IF_ARCH_X86(call_decimate(out, in, taps, factor, "avx::fir_decimate_fma3", avx::fir_decimate_fma3));
+            IF_ARCH_ARM(call_decimate(out, in, taps, factor, "neon_d32::fir_decimate", neon_d32::fir_decimate));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define BLOCK_SIZE      0x400
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t resampler_size(double ratio, size_t zcross);
+        void resampler_init(dsp::resampler_t *rs, void *buf, double ratio, size_t zcross);
+        void resampler_set_ratio(dsp::resampler_t *rs, double ratio);
+        size_t resampler_process(dsp::resampler_t *rs, float *dst, const float *src, size_t count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for the arbitrary-ratio sample rate converter,
+// the result is reported in input samples per second
+PTEST_BEGIN("dsp.resampling", resampler, 5, 1000)
+
+    void call(float *out, const float *in, double ratio, double drift, size_t zcross)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%.4f%s zc=%d", ratio, (drift > 0.0) ? " drift" : "", int(zcross));
+        printf("Testing resampler ratio %s on blocks of %d samples...\n", buf, int(BLOCK_SIZE));
+
+        uint8_t *data   = new uint8_t[generic::resampler_size(ratio, zcross)];
+        dsp::resampler_t rs;
+        generic::resampler_init(&rs, data, ratio, zcross);
+        size_t n        = 0;
+
+        PTEST_KLOOP(buf, BLOCK_SIZE,
+            if (drift > 0.0)
+                generic::resampler_set_ratio(&rs, ratio * (1.0 + drift * (double(++n & 0x3f) - 32.0) / 32.0));
+            generic::resampler_process(&rs, out, in, BLOCK_SIZE);
+        );
+
+        delete [] data;
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BLOCK_SIZE * 4, 64);
+        float *out      = &in[BLOCK_SIZE];
+
+        randomize_sign(in, BLOCK_SIZE);
+
+        static const size_t zcross[] = { 8, 16, 32 };
+
+        for (size_t i=0; i<sizeof(zcross)/sizeof(size_t); ++i)
+        {
+            call(out, in, 48000.0 / 44100.0, 0.0, zcross[i]);
+            call(out, in, 44100.0 / 48000.0, 0.0, zcross[i]);
+            call(out, in, 2.0, 0.0, zcross[i]);
+            call(out, in, 0.5, 0.0, zcross[i]);
+            call(out, in, 1.0, 0.001, zcross[i]);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
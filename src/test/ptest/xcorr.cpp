@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        8
+#define MAX_RANK        16
+#define LAGS            256
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t xcorr_size(size_t a_count, size_t b_count, ssize_t min_lag, ssize_t max_lag);
+        float xcorr(float *dst, const float *a, size_t a_count, const float *b, size_t b_count,
+            ssize_t min_lag, ssize_t max_lag, void *buf);
+    }
+
+    namespace test
+    {
+        static void xcorr_dotp(float *dst, const float *a, const float *b, size_t count, ssize_t lags)
+        {
+            for (ssize_t k=-lags; k<=lags; ++k)
+            {
+                *(dst++)    = (k >= 0) ?
+                    dsp::h_dotp(&a[k], b, count - k) :
+                    dsp::h_dotp(a, &b[-k], count + k);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for cross-correlation
+PTEST_BEGIN("dsp", xcorr, 5, 1000)
+
+    void call_dotp(float *dst, const float *a, const float *b, size_t count)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "test::xcorr_dotp %d lags=%d", int(count), int(LAGS * 2 + 1));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_LOOP(buf,
+            test::xcorr_dotp(dst, a, b, count, LAGS);
+        );
+    }
+
+    void call_fft(float *dst, const float *a, const float *b, size_t count, void *tmp)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "generic::xcorr %d lags=%d", int(count), int(LAGS * 2 + 1));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_LOOP(buf,
+            generic::xcorr(dst, a, count, b, count, -LAGS, LAGS, tmp);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *a        = alloc_aligned<float>(data, buf_size * 2 + LAGS * 2 + 1, 64);
+        float *b        = &a[buf_size];
+        float *dst      = &b[buf_size];
+        uint8_t *tmp    = new uint8_t[generic::xcorr_size(buf_size, buf_size, -LAGS, LAGS)];
+
+        randomize_sign(a, buf_size * 2);
+
+        for (size_t i=MIN_RANK; i<=MAX_RANK; i += 2)
+        {
+            size_t count = size_t(1) << i;
+            call_dotp(dst, a, b, count);
+            call_fft(dst, a, b, count, tmp);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+        delete [] tmp;
+    }
+
+PTEST_END
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        void corr_lags_incr(dsp::lag_correlation_t *corr, float *dst,
+            const float *a_head, const float *b_head,
+            const float *a_tail, const float *b_tail,
+            size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace avx512
+        {
+            void corr_lags_incr(dsp::lag_correlation_t *corr, float *dst,
+                const float *a_head, const float *b_head,
+                const float *a_tail, const float *b_tail,
+                size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void corr_lags_incr(dsp::lag_correlation_t *corr, float *dst,
+                const float *a_head, const float *b_head,
+                const float *a_tail, const float *b_tail,
+                size_t count);
+        }
+    )
+
+    typedef void (* corr_lags_incr_t)(dsp::lag_correlation_t *corr, float *dst,
+        const float *a_head, const float *b_head,
+        const float *a_tail, const float *b_tail,
+        size_t count);
+}
+
+UTEST_BEGIN("dsp", corr_lags_incr)
+    /**
+     * Compute normalized correlation of the window of a of specified length,
+     * starting at position pos, with the window of b, shifted by lag
+     */
+    static float corr_ref(const float *a, const float *b, size_t pos, size_t length, size_t lag)
+    {
+        double v = 0.0, xa = 0.0, xb = 0.0;
+        for (size_t i=0; i<length; ++i)
+        {
+            double ai   = a[pos + i];
+            double bi   = b[pos + i + lag];
+            v          += ai * bi;
+            xa         += ai * ai;
+            xb         += bi * bi;
+        }
+
+        double d    = xa * xb;
+        return (d >= 1e-18) ? v / sqrt(d) : 0.0f;
+    }
+
+    void call(const char *label, size_t align, corr_lags_incr_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        for (size_t mask=0; mask <= 0x03; ++mask)
+        {
+            UTEST_FOREACH(lags, 1, 3, 4, 5, 8, 12, 13, 16, 17, 31, 33, 64)
+            {
+                UTEST_FOREACH(count, 0, 1, 2, 3, 5, 8, 16, 33, 0x80)
+                {
+                    const size_t tail = 0x40;
+                    FloatBuffer a(tail + count * 2, align, mask & 0x01);
+                    FloatBuffer b(tail + count * 2 + lags, align, mask & 0x01);
+                    FloatBuffer v(lags, align, mask & 0x02);
+                    FloatBuffer xb(lags, align, mask & 0x02);
+                    FloatBuffer dst(lags, align, mask & 0x02);
+
+                    printf("Testing %s lag correlation lags=%d tail=%d on buffer count=%d mask=0x%x\n",
+                        label, int(lags), int(tail), int(count), int(mask));
+
+                    dsp::lag_correlation_t corr;
+                    v.fill_zero();
+                    xb.fill_zero();
+                    corr.v      = v.data();
+                    corr.b      = xb.data();
+                    corr.a      = 0.0f;
+                    corr.lags   = lags;
+                    dsp::corr_lags_init(&corr, a, b, tail);
+
+                    // Perform two steps to check the state update
+                    for (size_t step=0; step < 2; ++step)
+                    {
+                        const size_t pos    = step * count;
+                        func(&corr, dst,
+                            &a[pos + tail], &b[pos + tail],
+                            &a[pos], &b[pos],
+                            count);
+
+                        UTEST_ASSERT_MSG(a.valid(), "Buffer A corrupted");
+                        UTEST_ASSERT_MSG(b.valid(), "Buffer B corrupted");
+                        UTEST_ASSERT_MSG(v.valid(), "State V corrupted");
+                        UTEST_ASSERT_MSG(xb.valid(), "State B corrupted");
+                        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+
+                        for (size_t j=0; j<lags; ++j)
+                        {
+                            const float ref = corr_ref(a, b, pos + count, tail, j);
+                            if (!float_equals_adaptive(ref, dst[j], 1e-3f))
+                            {
+                                dst.dump("dst");
+                                UTEST_FAIL_MSG("Output of function '%s' differs at step %d, lag %d: %f vs %f",
+                                    label, int(step), int(j), ref, dst[j]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, align) \
+            call(#func, align, func)
+
+        CALL(generic::corr_lags_incr, 16);
+        IF_ARCH_X86(CALL(avx512::corr_lags_incr, 64));
+        IF_ARCH_AARCH64(CALL(asimd::corr_lags_incr, 16));
+    }
+
+UTEST_END;
+
+
+
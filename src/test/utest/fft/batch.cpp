@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       5e-2
+#define MIN_RANK        3
+#define MAX_RANK        12
+
+namespace lsp
+{
+    namespace generic
+    {
+        void batch_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t stride, size_t rank, size_t count);
+        void batch_reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t stride, size_t rank, size_t count);
+    }
+
+    IF_ARCH_X86_64(
+        namespace avx
+        {
+            void x64_batch_direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t stride, size_t rank, size_t count);
+            void x64_batch_reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t stride, size_t rank, size_t count);
+        }
+    )
+}
+
+typedef void (* batch_fft_t)(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t stride, size_t rank, size_t count);
+
+UTEST_BEGIN("dsp.fft", batch)
+
+    void call(const char *label, size_t align, batch_fft_t func1, batch_fft_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        static const size_t counts[] = { 1, 7, 8, 9, 16, 23, 64 };
+
+        for (size_t rank=MIN_RANK; rank<=MAX_RANK; ++rank)
+        {
+            for (size_t ci=0; ci < sizeof(counts)/sizeof(counts[0]); ++ci)
+            {
+                size_t channels = counts[ci];
+                for (size_t pad=0; pad <= 5; pad += 5)
+                {
+                    size_t stride   = (1 << rank) + pad;
+                    size_t count    = stride * channels;
+
+                    for (int same=0; same<2; ++same)
+                    {
+                        FloatBuffer src_re(count, align, pad > 0);
+                        FloatBuffer src_im(count, align, pad > 0);
+                        FloatBuffer dst1_re(count, align, pad > 0);
+                        FloatBuffer dst1_im(count, align, pad > 0);
+                        FloatBuffer dst2_re(dst1_re);
+                        FloatBuffer dst2_im(dst1_im);
+
+                        printf("Testing '%s' for rank=%d, channels=%d, stride=%d, same=%s...\n",
+                            label, int(rank), int(channels), int(stride), (same) ? "true" : "false");
+
+                        if (same)
+                        {
+                            dsp::copy(dst1_re, src_re, count);
+                            dsp::copy(dst1_im, src_im, count);
+                            dsp::copy(dst2_re, src_re, count);
+                            dsp::copy(dst2_im, src_im, count);
+
+                            func1(dst1_re, dst1_im, dst1_re, dst1_im, stride, rank, channels);
+                            func2(dst2_re, dst2_im, dst2_re, dst2_im, stride, rank, channels);
+                        }
+                        else
+                        {
+                            func1(dst1_re, dst1_im, src_re, src_im, stride, rank, channels);
+                            func2(dst2_re, dst2_im, src_re, src_im, stride, rank, channels);
+                        }
+
+                        UTEST_ASSERT_MSG(src_re.valid(), "Source buffer RE corrupted");
+                        UTEST_ASSERT_MSG(src_im.valid(), "Source buffer IM corrupted");
+                        UTEST_ASSERT_MSG(dst1_re.valid(), "Destination buffer 1 RE corrupted");
+                        UTEST_ASSERT_MSG(dst1_im.valid(), "Destination buffer 1 IM corrupted");
+                        UTEST_ASSERT_MSG(dst2_re.valid(), "Destination buffer 2 RE corrupted");
+                        UTEST_ASSERT_MSG(dst2_im.valid(), "Destination buffer 2 IM corrupted");
+
+                        // Compare buffers
+                        if ((!dst1_re.equals_adaptive(dst2_re, TOLERANCE)) || (!dst1_im.equals_adaptive(dst2_im, TOLERANCE)))
+                        {
+                            ssize_t diff = dst1_re.last_diff();
+                            if (diff >= 0)
+                            {
+                                UTEST_FAIL_MSG("Real output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                        label, int(diff), dst1_re.get(diff), dst2_re.get(diff));
+                            }
+                            else
+                            {
+                                diff = dst1_im.last_diff();
+                                UTEST_FAIL_MSG("Imaginary output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                        label, int(diff), dst1_im.get(diff), dst2_im.get(diff));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86_64(CALL(generic::batch_direct_fft, avx::x64_batch_direct_fft, 32));
+        IF_ARCH_X86_64(CALL(generic::batch_reverse_fft, avx::x64_batch_reverse_fft, 32));
+    }
+UTEST_END;
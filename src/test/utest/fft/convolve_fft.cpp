@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t convolve_fft_size(size_t length, size_t count);
+        void convolve_fft(float *dst, const float *src, const float *conv, size_t length, size_t count, void *buf);
+        void convolve_auto(float *dst, const float *src, const float *conv, size_t length, size_t count, void *buf);
+    }
+
+    typedef void (* convolve_fft_t)(float *dst, const float *src, const float *conv, size_t length, size_t count, void *buf);
+}
+
+UTEST_BEGIN("dsp.fft", convolve_fft)
+
+    void call(const char *label, convolve_fft_t func)
+    {
+        UTEST_FOREACH(count, 0, 1, 3, 8, 33, 100, 0x200, 0x1ff, 3000)
+        {
+            FloatBuffer src(count, 64, false);
+            src.randomize_sign();
+
+            UTEST_FOREACH(length, 0, 1, 4, 7, 64, 129, 0x200, 1000, 5000)
+            {
+                printf("Testing %s length=%d on buffer count=%d\n", label, int(length), int(count));
+
+                ssize_t clen = count + length - 1;
+                FloatBuffer conv(length, 64, false);
+                conv.randomize_sign();
+                FloatBuffer dst1((clen > 0) ? clen : 0, 64, false);
+                dst1.randomize_sign();
+                FloatBuffer dst2(dst1);
+                uint8_t *buf    = new uint8_t[generic::convolve_fft_size(length, count)];
+
+                dsp::convolve(dst1, src, conv, length, count);
+                func(dst2, src, conv, length, count, buf);
+                delete [] buf;
+
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(conv.valid(), "Convolution buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                // Compare buffers
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    ssize_t diff = dst2.last_diff();
+                    UTEST_FAIL_MSG("Output of %s differs at sample %d (%.6f vs %.6f)",
+                        label, int(diff), dst1.get(diff), dst2.get(diff));
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        call("generic::convolve_fft", generic::convolve_fft);
+        call("generic::convolve_auto", generic::convolve_auto);
+    }
+
+UTEST_END
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t convolver_size(size_t rank, size_t length);
+        void convolver_init(dsp::convolver_t *conv, void *buf, const float *ir, size_t length, size_t rank);
+        void convolver_reset(dsp::convolver_t *conv);
+        void convolver_process(dsp::convolver_t *conv, float *dst, const float *src, size_t count);
+    }
+}
+
+UTEST_BEGIN("dsp.fft", convolver)
+
+    void check(size_t rank, size_t length, size_t block)
+    {
+        size_t half     = size_t(1) << (rank - 1);
+        size_t count    = length + half * 4 + 17;
+
+        printf("Testing convolver rank=%d, length=%d, block=%d...\n",
+            int(rank), int(length), int(block));
+
+        FloatBuffer ir(length + 1, 64, false);
+        ir.randomize_sign();
+        FloatBuffer src(count, 64, false);
+        src.randomize_sign();
+        FloatBuffer dst(count, 64, false);
+        FloatBuffer ref(count, 64, false);
+        uint8_t *buf    = new uint8_t[generic::convolver_size(rank, length)];
+
+        // The output is the linear convolution delayed by 2^(rank-1) samples
+        dsp::fill_zero(ref, count);
+        for (size_t i=half; i<count; ++i)
+        {
+            double s        = 0.0;
+            size_t n        = lsp_min(i - half + 1, length);
+            for (size_t j=0; j<n; ++j)
+                s              += double(src[i - half - j]) * ir[j];
+            ref[i]          = s;
+        }
+
+        dsp::convolver_t conv;
+        generic::convolver_init(&conv, buf, ir, length, rank);
+        UTEST_ASSERT_MSG(ir.valid(), "IR buffer corrupted");
+        for (size_t i=0; i<count; i += block)
+        {
+            size_t to_do = lsp_min(block, count - i);
+            generic::convolver_process(&conv, &dst[i], &src[i], to_do);
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        if (!dst.equals_adaptive(ref, TOLERANCE))
+        {
+            ssize_t diff = dst.last_diff();
+            UTEST_FAIL_MSG("Output of convolver differs at sample %d (%.6f vs %.6f)",
+                int(diff), dst.get(diff), ref.get(diff));
+        }
+
+        // Check that the reset clears the state and in-place processing
+        generic::convolver_reset(&conv);
+        for (size_t i=0; i<count; i += block)
+        {
+            size_t to_do = lsp_min(block, count - i);
+            generic::convolver_process(&conv, &src[i], &src[i], to_do);
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        if (!src.equals_adaptive(ref, TOLERANCE))
+        {
+            ssize_t diff = src.last_diff();
+            UTEST_FAIL_MSG("Output of in-place convolver differs at sample %d (%.6f vs %.6f)",
+                int(diff), src.get(diff), ref.get(diff));
+        }
+
+        delete [] buf;
+    }
+
+    UTEST_MAIN
+    {
+        for (size_t rank=3; rank<=10; ++rank)
+        {
+            size_t half = size_t(1) << (rank - 1);
+
+            UTEST_FOREACH(block, 1, 7, 64, 100, 1000)
+            {
+                check(rank, 1, block);
+                check(rank, half, block);
+                check(rank, half * 5 - 3, block);
+            }
+
+            check(rank, 0, 33);
+            check(rank, half + 1, 33);
+            check(rank, 3000, 256);
+        }
+    }
+
+UTEST_END
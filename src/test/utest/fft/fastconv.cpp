@@ -36,6 +36,7 @@ namespace lsp
         void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
         void fastconv_restore(float *dst, float *src, size_t rank);
         void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
     }
 
     IF_ARCH_X86(
@@ -45,6 +46,7 @@ namespace lsp
             void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
             void fastconv_restore(float *dst, float *src, size_t rank);
             void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+            void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
         }
 
         namespace avx
@@ -53,11 +55,13 @@ namespace lsp
             void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
             void fastconv_restore(float *dst, float *src, size_t rank);
             void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+            void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank);
 
             void fastconv_parse_fma3(float *dst, const float *src, size_t rank);
             void fastconv_parse_apply_fma3(float *dst, float *tmp, const float *c, const float *src, size_t rank);
             void fastconv_restore_fma3(float *dst, float *src, size_t rank);
             void fastconv_apply_fma3(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+            void fastconv_fmadd_fma3(float *dst, const float *c1, const float *c2, size_t rank);
         }
     )
 
@@ -90,6 +94,8 @@ typedef void (* fastconv_restore_t)(float *dst, float *src, size_t rank);
 
 typedef void (* fastconv_apply_t)(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
 
+typedef void (* fastconv_fmadd_t)(float *dst, const float *c1, const float *c2, size_t rank);
+
 UTEST_BEGIN("dsp.fft", fastconv)
 
     // This is long-time test, raise time limit for it to one second
@@ -297,6 +303,76 @@ UTEST_BEGIN("dsp.fft", fastconv)
         }
     }
 
+    void call_pf(const char *label, size_t align,
+            fastconv_parse_t parse,
+            fastconv_restore_t restore,
+            fastconv_fmadd_t fmadd
+        )
+    {
+        if (!UTEST_SUPPORTED(parse))
+            return;
+        if (!UTEST_SUPPORTED(restore))
+            return;
+        if (!UTEST_SUPPORTED(fmadd))
+            return;
+
+        for (size_t rank=MIN_RANK; rank<=MAX_RANK; rank ++)
+        {
+            for (size_t mask=0; mask <= 0x0f; ++mask)
+            {
+                printf("Testing '%s' for FFT rank=%d, mask=0x%x\n", label, rank, mask);
+
+                FloatBuffer src1(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer src2(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer src3(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer fa(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fb(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fc1(1 << (rank+1), align, mask & 0x04);
+                FloatBuffer fc2(1 << (rank+1), align, mask & 0x04);
+                FloatBuffer dst1(1 << rank, align, mask & 0x08);
+                FloatBuffer dst2(1 << rank, align, mask & 0x08);
+
+                // Reference: src3 + src1 * src2 + src3 * src2 computed by generic functions
+                generic::fastconv_parse(fc1, src3, rank);
+                generic::fastconv_restore(dst1, fc1, rank);
+                generic::fastconv_parse(fa, src1, rank);
+                generic::fastconv_parse(fb, src2, rank);
+                generic::fastconv_apply(dst1, fc1, fb, fa, rank);
+                generic::fastconv_parse(fa, src3, rank);
+                generic::fastconv_apply(dst1, fc1, fb, fa, rank);
+                UTEST_ASSERT_MSG(fc1.valid(), "Buffer FC1 corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Buffer DST1 corrupted");
+
+                // Tested functions
+                parse(fa, src1, rank);
+                parse(fb, src2, rank);
+                parse(fc2, src3, rank);
+                fmadd(fc2, fb, fa, rank);
+                parse(fa, src3, rank);
+                fmadd(fc2, fb, fa, rank);
+                UTEST_ASSERT_MSG(fa.valid(), "Buffer FA corrupted");
+                UTEST_ASSERT_MSG(fb.valid(), "Buffer FB corrupted");
+                UTEST_ASSERT_MSG(fc2.valid(), "Buffer FC2 corrupted");
+                restore(dst2, fc2, rank);
+                UTEST_ASSERT_MSG(dst2.valid(), "Buffer DST2 corrupted");
+
+                // Compare buffers
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src1.dump("src1");
+                    src2.dump("src2");
+                    src3.dump("src3");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+
+                    ssize_t diff = dst2.last_diff();
+                    UTEST_FAIL_MSG("DST1 differs DST2 for test '%s' at sample %d (%.5f vs %.5f), rank=%d",
+                            label, int(diff), dst1.get(diff), dst2.get(diff), int(rank));
+                }
+            }
+        }
+    }
+
     UTEST_MAIN
     {
         // Do tests
@@ -317,6 +393,11 @@ UTEST_BEGIN("dsp.fft", fastconv)
         IF_ARCH_X86(call_pap("avx::fastconv_parse_fma3 + avx::fastconv_parse_apply_fma3", 32, avx::fastconv_parse_fma3, avx::fastconv_parse_apply_fma3));
         IF_ARCH_ARM(call_pap("neon_d32::fastconv_parse + neon_d32::fastconv_parse_apply", 16, neon_d32::fastconv_parse, neon_d32::fastconv_parse_apply));
         IF_ARCH_AARCH64(call_pap("asimd::fastconv_parse + asimd::fastconv_parse_apply", 16, asimd::fastconv_parse, asimd::fastconv_parse_apply));
+
+        call_pf("generic::fastconv_fmadd", 16, generic::fastconv_parse, generic::fastconv_restore, generic::fastconv_fmadd);
+        IF_ARCH_X86(call_pf("sse::fastconv_fmadd", 16, sse::fastconv_parse, sse::fastconv_restore, sse::fastconv_fmadd));
+        IF_ARCH_X86(call_pf("avx::fastconv_fmadd", 32, avx::fastconv_parse, avx::fastconv_restore, avx::fastconv_fmadd));
+        IF_ARCH_X86(call_pf("avx::fastconv_fmadd_fma3", 32, avx::fastconv_parse_fma3, avx::fastconv_restore_fma3, avx::fastconv_fmadd_fma3));
     }
 UTEST_END;
 
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-3
+#define MAX_CHANNELS    4
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t mconvolver_size(size_t rank, size_t length, size_t inputs, size_t outputs);
+        void mconvolver_init(dsp::mconvolver_t *conv, void *buf,
+            const float * const *ir, size_t length, size_t rank, size_t inputs, size_t outputs);
+        void mconvolver_reset(dsp::mconvolver_t *conv);
+        void mconvolver_process(dsp::mconvolver_t *conv, float * const *dst, const float * const *src, size_t count);
+    }
+}
+
+UTEST_BEGIN("dsp.fft", mconvolver)
+
+    void check(size_t rank, size_t length, size_t block, size_t inputs, size_t outputs)
+    {
+        size_t half     = size_t(1) << (rank - 1);
+        size_t count    = length + half * 4 + 17;
+
+        printf("Testing matrix convolver rank=%d, length=%d, block=%d, %dx%d...\n",
+            int(rank), int(length), int(block), int(inputs), int(outputs));
+
+        FloatBuffer *ir[MAX_CHANNELS * MAX_CHANNELS];
+        FloatBuffer *src[MAX_CHANNELS], *dst[MAX_CHANNELS], *ref[MAX_CHANNELS];
+        const float *vir[MAX_CHANNELS * MAX_CHANNELS];
+        const float *vsrc[MAX_CHANNELS];
+        float *vdst[MAX_CHANNELS];
+
+        // The impulse response from the first input to the last output is missing
+        for (size_t i=0; i<inputs * outputs; ++i)
+        {
+            ir[i]           = new FloatBuffer(length + 1, 64, false);
+            ir[i]->randomize_sign();
+            vir[i]          = ((i == outputs - 1) && (outputs > 1)) ? NULL : ir[i]->data();
+        }
+        for (size_t i=0; i<inputs; ++i)
+        {
+            src[i]          = new FloatBuffer(count, 64, false);
+            src[i]->randomize_sign();
+            vsrc[i]         = src[i]->data();
+        }
+        for (size_t i=0; i<outputs; ++i)
+        {
+            dst[i]          = new FloatBuffer(count, 64, false);
+            ref[i]          = new FloatBuffer(count, 64, false);
+            vdst[i]         = dst[i]->data();
+        }
+        uint8_t *buf    = new uint8_t[generic::mconvolver_size(rank, length, inputs, outputs)];
+
+        // Each output is the sum of linear convolutions delayed by 2^(rank-1) samples
+        for (size_t o=0; o<outputs; ++o)
+        {
+            float *r        = ref[o]->data();
+            dsp::fill_zero(r, count);
+            for (size_t k=half; k<count; ++k)
+            {
+                double s        = 0.0;
+                size_t n        = lsp_min(k - half + 1, length);
+                for (size_t i=0; i<inputs; ++i)
+                {
+                    const float *h  = vir[i * outputs + o];
+                    const float *x  = src[i]->data();
+                    if (h == NULL)
+                        continue;
+                    for (size_t j=0; j<n; ++j)
+                        s              += double(x[k - half - j]) * h[j];
+                }
+                r[k]            = s;
+            }
+        }
+
+        dsp::mconvolver_t conv;
+        generic::mconvolver_init(&conv, buf, vir, length, rank, inputs, outputs);
+        for (size_t i=0; i<inputs * outputs; ++i)
+            UTEST_ASSERT_MSG(ir[i]->valid(), "IR buffer %d corrupted", int(i));
+
+        for (size_t i=0; i<count; i += block)
+        {
+            size_t to_do = lsp_min(block, count - i);
+            const float *s[MAX_CHANNELS];
+            float *d[MAX_CHANNELS];
+            for (size_t j=0; j<inputs; ++j)
+                s[j]            = &vsrc[j][i];
+            for (size_t j=0; j<outputs; ++j)
+                d[j]            = &vdst[j][i];
+            generic::mconvolver_process(&conv, d, s, to_do);
+        }
+
+        for (size_t i=0; i<inputs; ++i)
+            UTEST_ASSERT_MSG(src[i]->valid(), "Source buffer %d corrupted", int(i));
+        for (size_t o=0; o<outputs; ++o)
+        {
+            UTEST_ASSERT_MSG(dst[o]->valid(), "Destination buffer %d corrupted", int(o));
+            if (!dst[o]->equals_adaptive(*ref[o], TOLERANCE))
+            {
+                ssize_t diff = dst[o]->last_diff();
+                UTEST_FAIL_MSG("Output %d of matrix convolver differs at sample %d (%.6f vs %.6f)",
+                    int(o), int(diff), dst[o]->get(diff), ref[o]->get(diff));
+            }
+        }
+
+        // Check that the reset clears the state and in-place processing
+        if (inputs == outputs)
+        {
+            generic::mconvolver_reset(&conv);
+            for (size_t i=0; i<count; i += block)
+            {
+                size_t to_do = lsp_min(block, count - i);
+                const float *s[MAX_CHANNELS];
+                float *d[MAX_CHANNELS];
+                for (size_t j=0; j<inputs; ++j)
+                {
+                    d[j]            = &src[j]->data()[i];
+                    s[j]            = d[j];
+                }
+                generic::mconvolver_process(&conv, d, s, to_do);
+            }
+
+            for (size_t o=0; o<outputs; ++o)
+            {
+                UTEST_ASSERT_MSG(src[o]->valid(), "Source buffer %d corrupted", int(o));
+                if (!src[o]->equals_adaptive(*ref[o], TOLERANCE))
+                {
+                    ssize_t diff = src[o]->last_diff();
+                    UTEST_FAIL_MSG("Output %d of in-place matrix convolver differs at sample %d (%.6f vs %.6f)",
+                        int(o), int(diff), src[o]->get(diff), ref[o]->get(diff));
+                }
+            }
+        }
+
+        for (size_t i=0; i<inputs * outputs; ++i)
+            delete ir[i];
+        for (size_t i=0; i<inputs; ++i)
+            delete src[i];
+        for (size_t i=0; i<outputs; ++i)
+        {
+            delete dst[i];
+            delete ref[i];
+        }
+        delete [] buf;
+    }
+
+    UTEST_MAIN
+    {
+        for (size_t rank=3; rank<=9; ++rank)
+        {
+            size_t half = size_t(1) << (rank - 1);
+
+            UTEST_FOREACH(block, 1, 64, 100)
+            {
+                check(rank, half, block, 2, 2);
+                check(rank, half * 5 - 3, block, 2, 2);
+            }
+
+            check(rank, 1, 33, 1, 1);
+            check(rank, 0, 33, 2, 2);
+            check(rank, half + 1, 33, 1, 4);
+            check(rank, half + 1, 33, 4, 1);
+            check(rank, 1000, 256, 2, 3);
+            check(rank, 1000, 77, 4, 4);
+        }
+    }
+
+UTEST_END
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/common/bits.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+#define TOLERANCE       5e-2
+
+namespace lsp
+{
+    namespace generic
+    {
+        void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+        void reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+
+        size_t mixed_fft_plan_size(size_t size);
+        void mixed_fft_plan_init(dsp::mixed_fft_plan_t *plan, void *buf, size_t size);
+        void mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+        void mixed_reverse_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+        void packed_mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp);
+        void packed_mixed_reverse_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp);
+    }
+
+    IF_ARCH_X86_64(
+        namespace avx
+        {
+            void x64_mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+            void x64_mixed_reverse_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+            void x64_packed_mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp);
+            void x64_packed_mixed_reverse_fft(const dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp);
+        }
+    )
+
+    namespace test
+    {
+        // Discrete Fourier transform by definition
+        static void dft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t n, double d)
+        {
+            for (size_t j=0; j<n; ++j)
+            {
+                double re = 0.0, im = 0.0;
+                for (size_t k=0; k<n; ++k)
+                {
+                    double a    = d * 2.0 * M_PI * double((j * k) % n) / double(n);
+                    re         += src_re[k] * cos(a) - src_im[k] * sin(a);
+                    im         += src_re[k] * sin(a) + src_im[k] * cos(a);
+                }
+                dst_re[j]   = (d > 0.0) ? re / n : re;
+                dst_im[j]   = (d > 0.0) ? im / n : im;
+            }
+        }
+
+        static void mixed_direct_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp)
+        {
+            size_t n = plan->size;
+            if ((n & (n - 1)) == 0)
+                generic::direct_fft(dst_re, dst_im, src_re, src_im, int_log2(n));
+            else
+            {
+                dft(tmp, &tmp[n], src_re, src_im, n, -1.0);
+                dsp::copy(dst_re, tmp, n);
+                dsp::copy(dst_im, &tmp[n], n);
+            }
+        }
+
+        static void mixed_reverse_fft(const dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp)
+        {
+            size_t n = plan->size;
+            if ((n & (n - 1)) == 0)
+                generic::reverse_fft(dst_re, dst_im, src_re, src_im, int_log2(n));
+            else
+            {
+                dft(tmp, &tmp[n], src_re, src_im, n, 1.0);
+                dsp::copy(dst_re, tmp, n);
+                dsp::copy(dst_im, &tmp[n], n);
+            }
+        }
+    }
+}
+
+typedef void (* mixed_fft_t)(const lsp::dsp::mixed_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+typedef void (* mixed_pfft_t)(const lsp::dsp::mixed_fft_plan_t *plan, float *dst, const float *src, float *tmp);
+
+UTEST_BEGIN("dsp.fft", mixed)
+
+    UTEST_TIMELIMIT(60)
+
+    void call(const char *label, size_t align, mixed_fft_t func1, mixed_fft_t func2, const size_t *sizes, size_t n)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (size_t i=0; i<n; ++i)
+        {
+            size_t count = sizes[i];
+            dsp::mixed_fft_plan_t plan;
+            size_t plan_size = generic::mixed_fft_plan_size(count);
+            UTEST_ASSERT_MSG(plan_size > 0, "Size %d should be supported", int(count));
+            uint8_t *buf = new uint8_t[plan_size];
+            generic::mixed_fft_plan_init(&plan, buf, count);
+
+            for (int same=0; same<2; ++same)
+            {
+                for (size_t mask=0; mask <= 0x0f; ++mask)
+                {
+                    FloatBuffer src_re(count, align, mask & 0x01);
+                    FloatBuffer src_im(count, align, mask & 0x02);
+                    FloatBuffer dst1_re(count, align, mask & 0x04);
+                    FloatBuffer dst1_im(count, align, mask & 0x08);
+                    FloatBuffer dst2_re(dst1_re);
+                    FloatBuffer dst2_im(dst1_im);
+                    FloatBuffer tmp(count * 2, align, false);
+
+                    printf("Testing '%s' for size=%d, mask=0x%x, same=%s...\n", label, int(count), int(mask), (same) ? "true" : "false");
+
+                    if (same)
+                    {
+                        dsp::copy(dst1_re, src_re, count);
+                        dsp::copy(dst1_im, src_im, count);
+                        dsp::copy(dst2_re, src_re, count);
+                        dsp::copy(dst2_im, src_im, count);
+
+                        func1(&plan, dst1_re, dst1_im, dst1_re, dst1_im, tmp);
+                        func2(&plan, dst2_re, dst2_im, dst2_re, dst2_im, tmp);
+                    }
+                    else
+                    {
+                        func1(&plan, dst1_re, dst1_im, src_re, src_im, tmp);
+                        func2(&plan, dst2_re, dst2_im, src_re, src_im, tmp);
+                    }
+
+                    UTEST_ASSERT_MSG(src_re.valid(), "Source buffer RE corrupted");
+                    UTEST_ASSERT_MSG(src_im.valid(), "Source buffer IM corrupted");
+                    UTEST_ASSERT_MSG(dst1_re.valid(), "Destination buffer 1 RE corrupted");
+                    UTEST_ASSERT_MSG(dst1_im.valid(), "Destination buffer 1 IM corrupted");
+                    UTEST_ASSERT_MSG(dst2_re.valid(), "Destination buffer 2 RE corrupted");
+                    UTEST_ASSERT_MSG(dst2_im.valid(), "Destination buffer 2 IM corrupted");
+                    UTEST_ASSERT_MSG(tmp.valid(), "Temporary buffer corrupted");
+
+                    // Compare buffers
+                    if ((!dst1_re.equals_adaptive(dst2_re, TOLERANCE)) || (!dst1_im.equals_adaptive(dst2_im, TOLERANCE)))
+                    {
+                        if (count <= 64)
+                        {
+                            src_re.dump("src_re ");
+                            src_im.dump("src_im ");
+                            dst1_re.dump("dst1_re");
+                            dst2_re.dump("dst2_re");
+                            dst1_im.dump("dst1_im");
+                            dst2_im.dump("dst2_im");
+                        }
+
+                        ssize_t diff = dst1_re.last_diff();
+                        if (diff >= 0)
+                        {
+                            UTEST_FAIL_MSG("Real output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                    label, int(diff), dst1_re.get(diff), dst2_re.get(diff));
+                        }
+                        else
+                        {
+                            diff = dst1_im.last_diff();
+                            UTEST_FAIL_MSG("Imaginary output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                    label, int(diff), dst1_im.get(diff), dst2_im.get(diff));
+                        }
+                    }
+                }
+            }
+
+            delete [] buf;
+        }
+    }
+
+    void call(const char *label, size_t align, mixed_pfft_t func1, mixed_pfft_t func2, const size_t *sizes, size_t n)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (size_t i=0; i<n; ++i)
+        {
+            size_t count = sizes[i];
+            dsp::mixed_fft_plan_t plan;
+            uint8_t *buf = new uint8_t[generic::mixed_fft_plan_size(count)];
+            generic::mixed_fft_plan_init(&plan, buf, count);
+
+            for (int same=0; same<2; ++same)
+            {
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    FloatBuffer src(count * 2, align, mask & 0x01);
+                    FloatBuffer dst1(count * 2, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+                    FloatBuffer tmp(count * 2, align, false);
+
+                    printf("Testing '%s' for size=%d, mask=0x%x, same=%s...\n", label, int(count), int(mask), (same) ? "true" : "false");
+
+                    if (same)
+                    {
+                        dsp::copy(dst1, src, count * 2);
+                        dsp::copy(dst2, src, count * 2);
+
+                        func1(&plan, dst1, dst1, tmp);
+                        func2(&plan, dst2, dst2, tmp);
+                    }
+                    else
+                    {
+                        func1(&plan, dst1, src, tmp);
+                        func2(&plan, dst2, src, tmp);
+                    }
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+                    UTEST_ASSERT_MSG(tmp.valid(), "Temporary buffer corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        if (count <= 32)
+                        {
+                            src.dump("src ");
+                            dst1.dump("dst1");
+                            dst2.dump("dst2");
+                        }
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(dst1.last_diff()), dst1.get(dst1.last_diff()), dst2.get(dst1.last_diff()));
+                    }
+                }
+            }
+
+            delete [] buf;
+        }
+    }
+
+    UTEST_MAIN
+    {
+        static const size_t sizes[] =
+        {
+            1, 2, 3, 4, 5, 6, 8, 9, 10, 12, 15, 16, 20, 24, 25, 27, 30, 32, 40, 45,
+            48, 60, 64, 72, 80, 96, 100, 120, 125, 128, 144, 160, 192, 240, 256, 360,
+            384, 480, 500, 512, 600, 720, 960, 1000, 1024, 1200, 1440, 1920, 2048,
+            3072, 3840, 4096, 4800, 7680, 8192, 9600
+        };
+        const size_t n = sizeof(sizes) / sizeof(sizes[0]);
+
+        // The reference is the DFT by definition, limit the size to save time
+        size_t n_ref = 0;
+        while ((n_ref < n) && (sizes[n_ref] <= 2048))
+            ++n_ref;
+
+        #define CALL(ref, func, align) \
+            call(#func, align, ref, func, sizes, n)
+
+        // Check the generic implementation against the reference
+        call("generic::mixed_direct_fft", 16, test::mixed_direct_fft, generic::mixed_direct_fft, sizes, n_ref);
+        call("generic::mixed_reverse_fft", 16, test::mixed_reverse_fft, generic::mixed_reverse_fft, sizes, n_ref);
+
+        // Check optimized implementations
+        IF_ARCH_X86_64(CALL(generic::mixed_direct_fft, avx::x64_mixed_direct_fft, 32));
+        IF_ARCH_X86_64(CALL(generic::mixed_reverse_fft, avx::x64_mixed_reverse_fft, 32));
+        IF_ARCH_X86_64(CALL(generic::packed_mixed_direct_fft, avx::x64_packed_mixed_direct_fft, 32));
+        IF_ARCH_X86_64(CALL(generic::packed_mixed_reverse_fft, avx::x64_packed_mixed_reverse_fft, 32));
+    }
+UTEST_END;
@@ -52,6 +52,12 @@ namespace lsp
             void normalize_fft3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
             void normalize_fft2(float *dst_re, float *dst_im, size_t rank);
         }
+
+        namespace avx512
+        {
+            void normalize_fft3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+            void normalize_fft2(float *dst_re, float *dst_im, size_t rank);
+        }
     )
 
     IF_ARCH_ARM(
@@ -205,6 +211,9 @@ UTEST_BEGIN("dsp.fft", norm)
         IF_ARCH_X86(CALL(generic::normalize_fft2, avx2::normalize_fft2, 32));
         IF_ARCH_X86(CALL(generic::normalize_fft3, avx2::normalize_fft3, 32));
 
+        IF_ARCH_X86(CALL(generic::normalize_fft2, avx512::normalize_fft2, 64));
+        IF_ARCH_X86(CALL(generic::normalize_fft3, avx512::normalize_fft3, 64));
+
         IF_ARCH_ARM(CALL(generic::normalize_fft2, neon_d32::normalize_fft2, 16));
         IF_ARCH_ARM(CALL(generic::normalize_fft3, neon_d32::normalize_fft3, 16));
 
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <pthread.h>
+#include <semaphore.h>
+
+#define TOLERANCE       1e-3
+#define MAX_THREADS     4
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t nu_convolver_size(size_t rank, size_t max_rank, size_t length);
+        void nu_convolver_init(dsp::nu_convolver_t *conv, void *buf, const float *ir, size_t length, size_t rank, size_t max_rank);
+        void nu_convolver_reset(dsp::nu_convolver_t *conv);
+        void nu_convolver_process(dsp::nu_convolver_t *conv, float *dst, const float *src, size_t count);
+        void nu_convolver_set_background(dsp::nu_convolver_t *conv, size_t rank);
+        void nu_convolver_set_notify(dsp::nu_convolver_t *conv, void (*notify)(void *arg), void *arg);
+        size_t nu_convolver_background(dsp::nu_convolver_t *conv);
+    }
+
+    /**
+     * Worker threads of the host which perform the background work of the convolver,
+     * idle threads sleep on the semaphore posted by the notification callback
+     */
+    typedef struct nu_pool_t
+    {
+        pthread_t               tid[MAX_THREADS];
+        sem_t                   sem;
+        dsp::nu_convolver_t    *conv;
+        size_t                  threads;
+        size_t                  notified;
+        bool                    stop;
+    } nu_pool_t;
+
+    static void nu_pool_notify(void *arg)
+    {
+        nu_pool_t *pool     = static_cast<nu_pool_t *>(arg);
+        __atomic_add_fetch(&pool->notified, 1, __ATOMIC_SEQ_CST);
+        sem_post(&pool->sem);
+    }
+
+    static void *nu_pool_thread(void *arg)
+    {
+        nu_pool_t *pool     = static_cast<nu_pool_t *>(arg);
+
+        while (!__atomic_load_n(&pool->stop, __ATOMIC_SEQ_CST))
+        {
+            // Sleep until the next handoff if there is no work
+            if (generic::nu_convolver_background(pool->conv) == 0)
+                sem_wait(&pool->sem);
+        }
+
+        return NULL;
+    }
+
+    static bool nu_pool_start(nu_pool_t *pool, dsp::nu_convolver_t *conv, size_t threads)
+    {
+        pool->conv      = conv;
+        pool->threads   = 0;
+        pool->notified  = 0;
+        pool->stop      = false;
+        if (sem_init(&pool->sem, 0, 0) != 0)
+            return false;
+
+        for (size_t i=0; i<threads; ++i)
+        {
+            if (pthread_create(&pool->tid[pool->threads], NULL, nu_pool_thread, pool) == 0)
+                ++pool->threads;
+        }
+
+        generic::nu_convolver_set_notify(conv, nu_pool_notify, pool);
+        return pool->threads > 0;
+    }
+
+    static void nu_pool_stop(nu_pool_t *pool)
+    {
+        generic::nu_convolver_set_notify(pool->conv, NULL, NULL);
+
+        __atomic_store_n(&pool->stop, true, __ATOMIC_SEQ_CST);
+        for (size_t i=0; i<pool->threads; ++i)
+            sem_post(&pool->sem);
+        for (size_t i=0; i<pool->threads; ++i)
+            pthread_join(pool->tid[i], NULL);
+        sem_destroy(&pool->sem);
+    }
+}
+
+UTEST_BEGIN("dsp.fft", nu_convolver)
+
+    // Emulate the worker that stalls in the middle of the task by holding locks of background stages
+    static void stall_workers(dsp::nu_convolver_t *conv, bool stall)
+    {
+        for (size_t i=conv->background; i<conv->nstages; ++i)
+            conv->stages[i].lock    = (stall) ? 1 : 0;
+    }
+
+    void check(size_t rank, size_t max_rank, size_t length, size_t block, size_t bg_rank = 0, ssize_t threads = -1, bool stall = false)
+    {
+        size_t count    = length + (size_t(1) << max_rank) * 2 + 17;
+
+        printf("Testing non-uniform convolver rank=%d, max_rank=%d, length=%d, block=%d, bg_rank=%d, threads=%d, stall=%s...\n",
+            int(rank), int(max_rank), int(length), int(block), int(bg_rank), int(threads), (stall) ? "true" : "false");
+
+        FloatBuffer ir(length + 1, 64, false);
+        ir.randomize_sign();
+        FloatBuffer src(count, 64, false);
+        src.randomize_sign();
+        FloatBuffer dst(count, 64, false);
+        FloatBuffer ref(count, 64, false);
+        uint8_t *buf    = new uint8_t[generic::nu_convolver_size(rank, max_rank, length)];
+
+        // The output is the linear convolution without any delay
+        for (size_t i=0; i<count; ++i)
+        {
+            double s        = 0.0;
+            size_t n        = lsp_min(i + 1, length);
+            for (size_t j=0; j<n; ++j)
+                s              += double(src[i - j]) * ir[j];
+            ref[i]          = s;
+        }
+
+        dsp::nu_convolver_t conv;
+        nu_pool_t pool;
+
+        generic::nu_convolver_init(&conv, buf, ir, length, rank, max_rank);
+        UTEST_ASSERT_MSG(ir.valid(), "IR buffer corrupted");
+        if (bg_rank > 0)
+            generic::nu_convolver_set_background(&conv, bg_rank);
+        if (threads > 0)
+            UTEST_ASSERT(nu_pool_start(&pool, &conv, threads));
+
+        for (size_t i=0; i<count; i += block)
+        {
+            size_t to_do = lsp_min(block, count - i);
+            if (stall)
+                stall_workers(&conv, (i >= count / 4) && (i < count / 2));
+            generic::nu_convolver_process(&conv, &dst[i], &src[i], to_do);
+            if (threads == 0)
+                generic::nu_convolver_background(&conv);
+        }
+
+        if (threads > 0)
+        {
+            nu_pool_stop(&pool);
+            if ((bg_rank > 0) && (bg_rank <= max_rank) && (conv.background < conv.nstages))
+                UTEST_ASSERT_MSG(pool.notified > 0, "Worker threads have not been notified");
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        if (!dst.equals_adaptive(ref, TOLERANCE))
+        {
+            ssize_t diff = dst.last_diff();
+            UTEST_FAIL_MSG("Output of convolver differs at sample %d (%.6f vs %.6f)",
+                int(diff), dst.get(diff), ref.get(diff));
+        }
+
+        // Check that the reset clears the state and in-place processing
+        if (stall)
+            stall_workers(&conv, true);
+        generic::nu_convolver_reset(&conv);
+        if (stall)
+            stall_workers(&conv, false);
+        generic::nu_convolver_set_background(&conv, max_rank + 1);
+        for (size_t i=0; i<count; i += block)
+        {
+            size_t to_do = lsp_min(block, count - i);
+            generic::nu_convolver_process(&conv, &src[i], &src[i], to_do);
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        if (!src.equals_adaptive(ref, TOLERANCE))
+        {
+            ssize_t diff = src.last_diff();
+            UTEST_FAIL_MSG("Output of in-place convolver differs at sample %d (%.6f vs %.6f)",
+                int(diff), src.get(diff), ref.get(diff));
+        }
+
+        delete [] buf;
+    }
+
+    UTEST_MAIN
+    {
+        for (size_t rank=3; rank<=7; ++rank)
+        {
+            size_t half = size_t(1) << (rank - 1);
+
+            for (size_t max_rank=rank; max_rank<=rank+4; max_rank += 2)
+            {
+                UTEST_FOREACH(block, 1, 7, 64, 100)
+                {
+                    check(rank, max_rank, half * 20 + 3, block);
+                }
+
+                check(rank, max_rank, 0, 33);
+                check(rank, max_rank, 1, 33);
+                check(rank, max_rank, half, 33);
+                check(rank, max_rank, half * 4 + 1, 33);
+                check(rank, max_rank, 5000, 256);
+
+                // Background processing by the caller, by the worker threads of the host
+                // and by the real-time thread if there are no workers
+                UTEST_FOREACH(bg_rank, rank, rank + 1, max_rank)
+                {
+                    check(rank, max_rank, 5000, 33, bg_rank, -1);
+                    check(rank, max_rank, 5000, 33, bg_rank, 0);
+                    check(rank, max_rank, 5000, 33, bg_rank, 1);
+                    check(rank, max_rank, 5000, 100, bg_rank, 2);
+
+                    // The real-time thread does not wait for the stalled worker
+                    check(rank, max_rank, 5000, 33, bg_rank, -1, true);
+                    check(rank, max_rank, 5000, 33, bg_rank, 0, true);
+                }
+            }
+        }
+    }
+
+UTEST_END
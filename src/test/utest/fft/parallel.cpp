@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       5e-2
+#define MIN_RANK        4
+#define MAX_RANK        20
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t fft_plan_size(size_t rank);
+        void fft_plan_init(dsp::fft_plan_t *plan, void *buf, size_t rank);
+        void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+        void fft_plan_reverse(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+
+        size_t parallel_fft_plan_size(size_t rank);
+        void parallel_fft_plan_init(dsp::parallel_fft_plan_t *plan, void *buf, size_t rank, size_t jobs);
+        void parallel_direct_fft(const dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+        void parallel_reverse_fft(const dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+        void parallel_direct_fft_pass(const dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp, size_t pass, size_t job);
+        void parallel_reverse_fft_pass(const dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp, size_t pass, size_t job);
+    }
+}
+
+typedef void (* plan_fft_t)(const lsp::dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+typedef void (* parallel_fft_t)(const lsp::dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp);
+typedef void (* parallel_fft_pass_t)(const lsp::dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im, float *tmp, size_t pass, size_t job);
+
+UTEST_BEGIN("dsp.fft", parallel)
+
+    UTEST_TIMELIMIT(120)
+
+    // Execute jobs of each pass in the reverse order to emulate the out-of-order execution by threads
+    static void call_passes(const dsp::parallel_fft_plan_t *plan, float *dst_re, float *dst_im,
+        const float *src_re, const float *src_im, float *tmp, parallel_fft_pass_t func)
+    {
+        for (size_t pass=0; pass<2; ++pass)
+            for (size_t job=plan->jobs; job > 0; --job)
+                func(plan, dst_re, dst_im, src_re, src_im, tmp, pass, job - 1);
+    }
+
+    void call(const char *label, size_t align, plan_fft_t func1, parallel_fft_t func2, parallel_fft_pass_t func3, size_t jobs)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+        if (!UTEST_SUPPORTED(func3))
+            return;
+
+        for (size_t rank=MIN_RANK; rank<=MAX_RANK; ++rank)
+        {
+            dsp::fft_plan_t plan1;
+            dsp::parallel_fft_plan_t plan2;
+            uint8_t *buf1 = new uint8_t[generic::fft_plan_size(rank)];
+            uint8_t *buf2 = new uint8_t[generic::parallel_fft_plan_size(rank)];
+            generic::fft_plan_init(&plan1, buf1, rank);
+            generic::parallel_fft_plan_init(&plan2, buf2, rank, jobs);
+
+            size_t count = 1 << rank;
+            for (int same=0; same<2; ++same)
+            {
+                FloatBuffer src_re(count, align, false);
+                FloatBuffer src_im(count, align, false);
+                FloatBuffer dst1_re(count, align, false);
+                FloatBuffer dst1_im(count, align, false);
+                FloatBuffer dst2_re(dst1_re);
+                FloatBuffer dst2_im(dst1_im);
+                FloatBuffer dst3_re(dst1_re);
+                FloatBuffer dst3_im(dst1_im);
+                FloatBuffer tmp(plan2.tmp_size + 1, align, false);
+
+                printf("Testing '%s' for rank=%d, jobs=%d, same=%s...\n",
+                    label, int(rank), int(plan2.jobs), (same) ? "true" : "false");
+
+                if (same)
+                {
+                    dsp::copy(dst1_re, src_re, count);
+                    dsp::copy(dst1_im, src_im, count);
+                    dsp::copy(dst2_re, src_re, count);
+                    dsp::copy(dst2_im, src_im, count);
+                    dsp::copy(dst3_re, src_re, count);
+                    dsp::copy(dst3_im, src_im, count);
+
+                    func1(&plan1, dst1_re, dst1_im, dst1_re, dst1_im);
+                    func2(&plan2, dst2_re, dst2_im, dst2_re, dst2_im, tmp);
+                    call_passes(&plan2, dst3_re, dst3_im, dst3_re, dst3_im, tmp, func3);
+                }
+                else
+                {
+                    func1(&plan1, dst1_re, dst1_im, src_re, src_im);
+                    func2(&plan2, dst2_re, dst2_im, src_re, src_im, tmp);
+                    call_passes(&plan2, dst3_re, dst3_im, src_re, src_im, tmp, func3);
+                }
+
+                UTEST_ASSERT_MSG(src_re.valid(), "Source buffer RE corrupted");
+                UTEST_ASSERT_MSG(src_im.valid(), "Source buffer IM corrupted");
+                UTEST_ASSERT_MSG(dst1_re.valid(), "Destination buffer 1 RE corrupted");
+                UTEST_ASSERT_MSG(dst1_im.valid(), "Destination buffer 1 IM corrupted");
+                UTEST_ASSERT_MSG(dst2_re.valid(), "Destination buffer 2 RE corrupted");
+                UTEST_ASSERT_MSG(dst2_im.valid(), "Destination buffer 2 IM corrupted");
+                UTEST_ASSERT_MSG(dst3_re.valid(), "Destination buffer 3 RE corrupted");
+                UTEST_ASSERT_MSG(dst3_im.valid(), "Destination buffer 3 IM corrupted");
+                UTEST_ASSERT_MSG(tmp.valid(), "Temporary buffer corrupted");
+
+                // Compare buffers
+                if ((!dst1_re.equals_adaptive(dst2_re, TOLERANCE)) || (!dst1_im.equals_adaptive(dst2_im, TOLERANCE)))
+                {
+                    ssize_t diff = dst1_re.last_diff();
+                    if (diff >= 0)
+                    {
+                        UTEST_FAIL_MSG("Real output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(diff), dst1_re.get(diff), dst2_re.get(diff));
+                    }
+                    else
+                    {
+                        diff = dst1_im.last_diff();
+                        UTEST_FAIL_MSG("Imaginary output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(diff), dst1_im.get(diff), dst2_im.get(diff));
+                    }
+                }
+
+                // Compare the result of jobs executed out of order
+                if ((!dst2_re.equals_absolute(dst3_re)) || (!dst2_im.equals_absolute(dst3_im)))
+                {
+                    ssize_t diff = dst2_re.last_diff();
+                    if (diff >= 0)
+                    {
+                        UTEST_FAIL_MSG("Real output of passes for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(diff), dst2_re.get(diff), dst3_re.get(diff));
+                    }
+                    else
+                    {
+                        diff = dst2_im.last_diff();
+                        UTEST_FAIL_MSG("Imaginary output of passes for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(diff), dst2_im.get(diff), dst3_im.get(diff));
+                    }
+                }
+            }
+
+            delete [] buf1;
+            delete [] buf2;
+        }
+    }
+
+    UTEST_MAIN
+    {
+        static const size_t jobs[] = { 1, 2, 3, 4, 8 };
+
+        #define CALL(func1, func2, func3, align) \
+            for (size_t i=0; i<sizeof(jobs)/sizeof(jobs[0]); ++i) \
+                call(#func2, align, func1, func2, func3, jobs[i]);
+
+        CALL(generic::fft_plan_direct, generic::parallel_direct_fft, generic::parallel_direct_fft_pass, 16);
+        CALL(generic::fft_plan_reverse, generic::parallel_reverse_fft, generic::parallel_reverse_fft_pass, 16);
+    }
+UTEST_END
@@ -49,6 +49,12 @@ namespace lsp
             void packed_direct_fft_fma3(float *dst, const float *src, size_t rank);
             void packed_reverse_fft_fma3(float *dst, const float *src, size_t rank);
         }
+
+        namespace avx512
+        {
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_reverse_fft(float *dst, const float *src, size_t rank);
+        }
     )
 
     IF_ARCH_ARM(
@@ -136,6 +142,8 @@ UTEST_BEGIN("dsp.fft", pfft)
         IF_ARCH_X86(CALL(generic::packed_reverse_fft, avx::packed_reverse_fft, 32));
         IF_ARCH_X86(CALL(generic::packed_direct_fft, avx::packed_direct_fft_fma3, 32));
         IF_ARCH_X86(CALL(generic::packed_reverse_fft, avx::packed_reverse_fft_fma3, 32));
+        IF_ARCH_X86(CALL(generic::packed_direct_fft, avx512::packed_direct_fft, 64));
+        IF_ARCH_X86(CALL(generic::packed_reverse_fft, avx512::packed_reverse_fft, 64));
 
         IF_ARCH_ARM(CALL(generic::packed_direct_fft, neon_d32::packed_direct_fft, 16));
         IF_ARCH_ARM(CALL(generic::packed_reverse_fft, neon_d32::packed_reverse_fft, 16));
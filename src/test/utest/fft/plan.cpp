@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       5e-2
+#define MAX_RANK        20
+
+namespace lsp
+{
+    namespace generic
+    {
+        void direct_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+        void reverse_fft(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank);
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+        void packed_reverse_fft(float *dst, const float *src, size_t rank);
+
+        size_t fft_plan_size(size_t rank);
+        void fft_plan_init(dsp::fft_plan_t *plan, void *buf, size_t rank);
+        void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+        void fft_plan_reverse(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+        void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        void fft_plan_packed_reverse(const dsp::fft_plan_t *plan, float *dst, const float *src);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_reverse(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void fft_plan_packed_reverse(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+
+        namespace avx
+        {
+            void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_reverse(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void fft_plan_packed_reverse(const dsp::fft_plan_t *plan, float *dst, const float *src);
+
+            void fft_plan_direct_fma3(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_reverse_fma3(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_packed_direct_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void fft_plan_packed_reverse_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+
+        namespace avx512
+        {
+            void fft_plan_direct(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_reverse(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void fft_plan_packed_direct(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void fft_plan_packed_reverse(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+    )
+
+    namespace test
+    {
+        static void direct_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            generic::direct_fft(dst_re, dst_im, src_re, src_im, plan->rank);
+        }
+
+        static void reverse_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            generic::reverse_fft(dst_re, dst_im, src_re, src_im, plan->rank);
+        }
+
+        static void packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            generic::packed_direct_fft(dst, src, plan->rank);
+        }
+
+        static void packed_reverse_fft(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            generic::packed_reverse_fft(dst, src, plan->rank);
+        }
+    }
+}
+
+typedef void (* plan_fft_t)(const lsp::dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+typedef void (* plan_pfft_t)(const lsp::dsp::fft_plan_t *plan, float *dst, const float *src);
+
+UTEST_BEGIN("dsp.fft", plan)
+
+    UTEST_TIMELIMIT(120)
+
+    void call(const char *label, size_t align, plan_fft_t func1, plan_fft_t func2, size_t min_rank, size_t max_rank)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (size_t rank=min_rank; rank<=max_rank; ++rank)
+        {
+            dsp::fft_plan_t plan;
+            uint8_t *buf = new uint8_t[generic::fft_plan_size(rank)];
+            generic::fft_plan_init(&plan, buf, rank);
+
+            size_t count = 1 << rank;
+            for (int same=0; same<2; ++same)
+            {
+                // Check misalignment only for small ranks to save time
+                for (size_t mask=0; mask <= ((rank <= 16) ? 0x0f : 0x00); ++mask)
+                {
+                    FloatBuffer src_re(count, align, mask & 0x01);
+                    FloatBuffer src_im(count, align, mask & 0x02);
+                    FloatBuffer dst1_re(count, align, mask & 0x04);
+                    FloatBuffer dst1_im(count, align, mask & 0x08);
+                    FloatBuffer dst2_re(dst1_re);
+                    FloatBuffer dst2_im(dst1_im);
+
+                    printf("Testing '%s' for rank=%d, mask=0x%x, same=%s...\n", label, int(rank), int(mask), (same) ? "true" : "false");
+
+                    if (same)
+                    {
+                        dsp::copy(dst1_re, src_re, count);
+                        dsp::copy(dst1_im, src_im, count);
+                        dsp::copy(dst2_re, src_re, count);
+                        dsp::copy(dst2_im, src_im, count);
+
+                        func1(&plan, dst1_re, dst1_im, dst1_re, dst1_im);
+                        func2(&plan, dst2_re, dst2_im, dst2_re, dst2_im);
+                    }
+                    else
+                    {
+                        func1(&plan, dst1_re, dst1_im, src_re, src_im);
+                        func2(&plan, dst2_re, dst2_im, src_re, src_im);
+                    }
+
+                    UTEST_ASSERT_MSG(src_re.valid(), "Source buffer RE corrupted");
+                    UTEST_ASSERT_MSG(src_im.valid(), "Source buffer IM corrupted");
+                    UTEST_ASSERT_MSG(dst1_re.valid(), "Destination buffer 1 RE corrupted");
+                    UTEST_ASSERT_MSG(dst1_im.valid(), "Destination buffer 1 IM corrupted");
+                    UTEST_ASSERT_MSG(dst2_re.valid(), "Destination buffer 2 RE corrupted");
+                    UTEST_ASSERT_MSG(dst2_im.valid(), "Destination buffer 2 IM corrupted");
+
+                    // Compare buffers
+                    if ((!dst1_re.equals_adaptive(dst2_re, TOLERANCE)) || (!dst1_im.equals_adaptive(dst2_im, TOLERANCE)))
+                    {
+                        if (count <= 64)
+                        {
+                            src_re.dump("src_re ");
+                            src_im.dump("src_im ");
+                            dst1_re.dump("dst1_re");
+                            dst2_re.dump("dst2_re");
+                            dst1_im.dump("dst1_im");
+                            dst2_im.dump("dst2_im");
+                        }
+
+                        ssize_t diff = dst1_re.last_diff();
+                        if (diff >= 0)
+                        {
+                            UTEST_FAIL_MSG("Real output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                    label, int(diff), dst1_re.get(diff), dst2_re.get(diff));
+                        }
+                        else
+                        {
+                            diff = dst1_im.last_diff();
+                            UTEST_FAIL_MSG("Imaginary output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                    label, int(diff), dst1_im.get(diff), dst2_im.get(diff));
+                        }
+                    }
+                }
+            }
+
+            delete [] buf;
+        }
+    }
+
+    void call(const char *label, size_t align, plan_pfft_t func1, plan_pfft_t func2, size_t min_rank, size_t max_rank)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (size_t rank=min_rank; rank<=max_rank; ++rank)
+        {
+            dsp::fft_plan_t plan;
+            uint8_t *buf = new uint8_t[generic::fft_plan_size(rank)];
+            generic::fft_plan_init(&plan, buf, rank);
+
+            size_t count = 2 << rank;
+            for (int same=0; same<2; ++same)
+            {
+                for (size_t mask=0; mask <= ((rank <= 16) ? 0x03 : 0x00); ++mask)
+                {
+                    FloatBuffer src(count, align, mask & 0x01);
+                    FloatBuffer dst1(count, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+
+                    printf("Testing '%s' for rank=%d, mask=0x%x, same=%s...\n", label, int(rank), int(mask), (same) ? "true" : "false");
+
+                    if (same)
+                    {
+                        dsp::copy(dst1, src, count);
+                        dsp::copy(dst2, src, count);
+
+                        func1(&plan, dst1, dst1);
+                        func2(&plan, dst2, dst2);
+                    }
+                    else
+                    {
+                        func1(&plan, dst1, src);
+                        func2(&plan, dst2, src);
+                    }
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        if (count <= 64)
+                        {
+                            src.dump("src ");
+                            dst1.dump("dst1");
+                            dst2.dump("dst2");
+                        }
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(dst1.last_diff()), dst1.get(dst1.last_diff()), dst2.get(dst1.last_diff()));
+                    }
+                }
+            }
+
+            delete [] buf;
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(generic, func, align, min_rank) \
+            call(#func, align, generic, func, min_rank, MAX_RANK)
+
+        // Check the generic implementation against the table-based FFT
+        call("generic::fft_plan_direct", 16, test::direct_fft, generic::fft_plan_direct, 2, 16);
+        call("generic::fft_plan_reverse", 16, test::reverse_fft, generic::fft_plan_reverse, 2, 16);
+        call("generic::fft_plan_packed_direct", 16, test::packed_direct_fft, generic::fft_plan_packed_direct, 2, 16);
+        call("generic::fft_plan_packed_reverse", 16, test::packed_reverse_fft, generic::fft_plan_packed_reverse, 2, 16);
+
+        // Check optimized implementations
+        IF_ARCH_X86(CALL(generic::fft_plan_direct, sse::fft_plan_direct, 16, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_reverse, sse::fft_plan_reverse, 16, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_packed_direct, sse::fft_plan_packed_direct, 16, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_packed_reverse, sse::fft_plan_packed_reverse, 16, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_direct, avx::fft_plan_direct, 32, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_reverse, avx::fft_plan_reverse, 32, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_packed_direct, avx::fft_plan_packed_direct, 32, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_packed_reverse, avx::fft_plan_packed_reverse, 32, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_direct, avx::fft_plan_direct_fma3, 32, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_reverse, avx::fft_plan_reverse_fma3, 32, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_packed_direct, avx::fft_plan_packed_direct_fma3, 32, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_packed_reverse, avx::fft_plan_packed_reverse_fma3, 32, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_direct, avx512::fft_plan_direct, 64, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_reverse, avx512::fft_plan_reverse, 64, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_packed_direct, avx512::fft_plan_packed_direct, 64, 0));
+        IF_ARCH_X86(CALL(generic::fft_plan_packed_reverse, avx512::fft_plan_packed_reverse, 64, 0));
+    }
+UTEST_END;
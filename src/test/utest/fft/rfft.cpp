@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       5e-2
+
+namespace lsp
+{
+    namespace generic
+    {
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+        void real_direct_fft(float *dst, const float *src, size_t rank);
+        void real_reverse_fft(float *dst, const float *src, size_t rank);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void real_direct_fft(float *dst, const float *src, size_t rank);
+            void real_reverse_fft(float *dst, const float *src, size_t rank);
+        }
+
+        namespace avx
+        {
+            void real_direct_fft(float *dst, const float *src, size_t rank);
+            void real_reverse_fft(float *dst, const float *src, size_t rank);
+
+            void real_direct_fft_fma3(float *dst, const float *src, size_t rank);
+            void real_reverse_fft_fma3(float *dst, const float *src, size_t rank);
+        }
+    )
+
+    IF_ARCH_X86_64(
+        namespace avx512
+        {
+            void x64_real_direct_fft(float *dst, const float *src, size_t rank);
+            void x64_real_reverse_fft(float *dst, const float *src, size_t rank);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void real_direct_fft(float *dst, const float *src, size_t rank);
+            void real_reverse_fft(float *dst, const float *src, size_t rank);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void real_direct_fft(float *dst, const float *src, size_t rank);
+            void real_reverse_fft(float *dst, const float *src, size_t rank);
+        }
+    )
+}
+
+typedef void (* real_fft_t)(float *dst, const float *src, size_t rank);
+
+UTEST_BEGIN("dsp.fft", rfft)
+
+    void validate()
+    {
+        for (size_t rank=1; rank<=16; ++rank)
+        {
+            size_t count = 1 << rank;
+
+            FloatBuffer src(count);
+            FloatBuffer csrc(count * 2);
+            FloatBuffer dst1(count + 2);
+            FloatBuffer dst2(count * 2);
+            FloatBuffer dst3(count);
+
+            printf("Validating real FFT for rank=%d...\n", int(rank));
+
+            // Compute the spectrum using the complex FFT
+            src.randomize_sign();
+            for (size_t i=0; i<count; ++i)
+            {
+                csrc[i*2]       = src[i];
+                csrc[i*2+1]     = 0.0f;
+            }
+
+            generic::real_direct_fft(dst1, src, rank);
+            generic::packed_direct_fft(dst2, csrc, rank);
+            generic::real_reverse_fft(dst3, dst1, rank);
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+            UTEST_ASSERT_MSG(dst3.valid(), "Destination buffer 3 corrupted");
+
+            // The real FFT should produce the lower half of the spectrum
+            for (size_t i=0; i<(count + 2); ++i)
+            {
+                if (!float_equals_adaptive(dst1[i], dst2[i], TOLERANCE))
+                {
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Spectrum differs at sample %d (%.5f vs %.5f)",
+                        int(i), dst1[i], dst2[i]);
+                }
+            }
+
+            // The reverse FFT should restore the original signal
+            if (!src.equals_adaptive(dst3, 1e-3))
+            {
+                ssize_t diff = src.last_diff();
+                src.dump("src ");
+                dst3.dump("dst3");
+                UTEST_FAIL_MSG("Restored signal differs at sample %d (%.5f vs %.5f)",
+                    int(diff), src.get(diff), dst3.get(diff));
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, bool direct, real_fft_t func1, real_fft_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (int same=0; same < 2; ++same)
+        {
+            for (size_t rank=1; rank<=16; ++rank)
+            {
+                size_t count    = 1 << rank;
+                size_t s_count  = (direct) ? count : count + 2;
+                size_t d_count  = (direct) ? count + 2 : count;
+
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    FloatBuffer src(s_count, align, mask & 0x01);
+                    FloatBuffer dst1(count + 2, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+
+                    printf("Testing '%s' for rank=%d, mask=0x%x, same=%s...\n", label, int(rank), int(mask), (same) ? "true" : "false");
+
+                    src.randomize_sign();
+                    if (same)
+                    {
+                        dsp::copy(dst1, src, s_count);
+                        dsp::copy(dst2, src, s_count);
+                        func1(dst1, dst1, rank);
+                        func2(dst2, dst2, rank);
+                    }
+                    else
+                    {
+                        func1(dst1, src, rank);
+                        func2(dst2, src, rank);
+                    }
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    for (size_t i=0; i<d_count; ++i)
+                    {
+                        if (!float_equals_adaptive(dst1[i], dst2[i], TOLERANCE))
+                        {
+                            src.dump("src ");
+                            dst1.dump("dst1");
+                            dst2.dump("dst2");
+                            UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                    label, int(i), dst1[i], dst2[i]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Validate the generic implementation
+        validate();
+
+        #define CALL(generic, func, align, direct) \
+            call(#func, align, direct, generic, func)
+
+        // Do tests
+        IF_ARCH_X86(CALL(generic::real_direct_fft, sse::real_direct_fft, 16, true));
+        IF_ARCH_X86(CALL(generic::real_reverse_fft, sse::real_reverse_fft, 16, false));
+        IF_ARCH_X86(CALL(generic::real_direct_fft, avx::real_direct_fft, 32, true));
+        IF_ARCH_X86(CALL(generic::real_reverse_fft, avx::real_reverse_fft, 32, false));
+        IF_ARCH_X86(CALL(generic::real_direct_fft, avx::real_direct_fft_fma3, 32, true));
+        IF_ARCH_X86(CALL(generic::real_reverse_fft, avx::real_reverse_fft_fma3, 32, false));
+        IF_ARCH_X86_64(CALL(generic::real_direct_fft, avx512::x64_real_direct_fft, 64, true));
+        IF_ARCH_X86_64(CALL(generic::real_reverse_fft, avx512::x64_real_reverse_fft, 64, false));
+
+        IF_ARCH_ARM(CALL(generic::real_direct_fft, neon_d32::real_direct_fft, 16, true));
+        IF_ARCH_ARM(CALL(generic::real_reverse_fft, neon_d32::real_reverse_fft, 16, false));
+
+        IF_ARCH_AARCH64(CALL(generic::real_direct_fft, asimd::real_direct_fft, 16, true));
+        IF_ARCH_AARCH64(CALL(generic::real_reverse_fft, asimd::real_reverse_fft, 16, false));
+    }
+UTEST_END;
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-4
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t stft_size(size_t rank);
+        void stft_init(dsp::stft_t *stft, void *buf, size_t rank, size_t hop, const float *window);
+        void stft_reset(dsp::stft_t *stft);
+        void stft_process(dsp::stft_t *stft, float *dst, const float *src, size_t count, dsp::stft_callback_t callback, void *arg);
+    }
+
+    namespace test
+    {
+        static void stft_gain(void *arg, float *spectrum, size_t rank)
+        {
+            float k = *static_cast<float *>(arg);
+            dsp::mul_k2(spectrum, k, 2 << rank);
+        }
+    }
+}
+
+UTEST_BEGIN("dsp.fft", stft)
+
+    void check(size_t rank, size_t hop, size_t block, const float *window, float gain)
+    {
+        size_t n        = size_t(1) << rank;
+        size_t count    = n * 8 + 17;
+
+        printf("Testing STFT rank=%d, hop=%d, block=%d, window=%s, gain=%.2f...\n",
+            int(rank), int(hop), int(block), (window != NULL) ? "custom" : "hann", gain);
+
+        FloatBuffer src(count, 64, false);
+        src.randomize_sign();
+        FloatBuffer dst(count, 64, false);
+        FloatBuffer ref(count, 64, false);
+        uint8_t *buf    = new uint8_t[generic::stft_size(rank)];
+
+        // The output repeats the input delayed by 2^rank samples
+        dsp::fill_zero(ref, count);
+        dsp::mul_k3(&ref[n], src, gain, count - n);
+
+        dsp::stft_t stft;
+        generic::stft_init(&stft, buf, rank, hop, window);
+        for (size_t i=0; i<count; i += block)
+        {
+            size_t to_do = lsp_min(block, count - i);
+            generic::stft_process(&stft, &dst[i], &src[i], to_do, (gain != 1.0f) ? test::stft_gain : NULL, &gain);
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        if (!dst.equals_absolute(ref, TOLERANCE))
+        {
+            ssize_t diff = dst.last_diff();
+            UTEST_FAIL_MSG("Output of STFT differs at sample %d (%.6f vs %.6f)",
+                int(diff), dst.get(diff), ref.get(diff));
+        }
+
+        // Check that the reset clears the state and in-place processing
+        generic::stft_reset(&stft);
+        for (size_t i=0; i<count; i += block)
+        {
+            size_t to_do = lsp_min(block, count - i);
+            generic::stft_process(&stft, &src[i], &src[i], to_do, (gain != 1.0f) ? test::stft_gain : NULL, &gain);
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        if (!src.equals_absolute(ref, TOLERANCE))
+        {
+            ssize_t diff = src.last_diff();
+            UTEST_FAIL_MSG("Output of in-place STFT differs at sample %d (%.6f vs %.6f)",
+                int(diff), src.get(diff), ref.get(diff));
+        }
+
+        delete [] buf;
+    }
+
+    UTEST_MAIN
+    {
+        float window[1 << 10];
+
+        for (size_t rank=4; rank<=10; ++rank)
+        {
+            size_t n = size_t(1) << rank;
+
+            // Periodic Hann window with different overlaps
+            UTEST_FOREACH(block, 1, 7, 64, 100, 1000)
+            {
+                check(rank, n >> 1, block, NULL, 1.0f);
+                check(rank, n >> 2, block, NULL, 1.0f);
+                check(rank, n / 3, block, NULL, 0.5f);
+            }
+
+            // Rectangular window without overlap
+            dsp::fill_one(window, n);
+            check(rank, n, 100, window, 1.0f);
+
+            // Square root of Hann window
+            for (size_t i=0; i<n; ++i)
+                window[i] = sqrtf(0.5f - 0.5f * cosf(2.0f * M_PI * i / n));
+            check(rank, n >> 2, 33, window, 2.0f);
+        }
+    }
+
+UTEST_END
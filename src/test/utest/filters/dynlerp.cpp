@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-3f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void dyn_biquad_process_x1(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x1_t *f);
+        void bilinear_transform_x1(dsp::biquad_x1_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
+
+        void dyn_biquad_lerp_x1(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x1_t *f0, const dsp::biquad_x1_t *f1);
+        void dyn_biquad_lerp_x2(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x2_t *f0, const dsp::biquad_x2_t *f1);
+        void dyn_biquad_lerp_x4(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x4_t *f0, const dsp::biquad_x4_t *f1);
+        void dyn_biquad_lerp_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f0, const dsp::biquad_x8_t *f1);
+
+        void dyn_cascade_lerp_x1(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        void dyn_cascade_lerp_x2(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        void dyn_cascade_lerp_x4(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        void dyn_cascade_lerp_x8(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void dyn_biquad_lerp_x1(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x1_t *f0, const dsp::biquad_x1_t *f1);
+            void dyn_biquad_lerp_x2(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x2_t *f0, const dsp::biquad_x2_t *f1);
+            void dyn_biquad_lerp_x4(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x4_t *f0, const dsp::biquad_x4_t *f1);
+            void dyn_biquad_lerp_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f0, const dsp::biquad_x8_t *f1);
+
+            void dyn_cascade_lerp_x1(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+            void dyn_cascade_lerp_x2(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+            void dyn_cascade_lerp_x4(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+            void dyn_cascade_lerp_x8(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        }
+
+        namespace avx
+        {
+            void dyn_biquad_lerp_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f0, const dsp::biquad_x8_t *f1);
+            void dyn_cascade_lerp_x8(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+        }
+    )
+
+    typedef void (* dyn_cascade_lerp_t)(float *dst, const float *src, float *d, size_t count, const dsp::f_cascade_t *c0, const dsp::f_cascade_t *c1, float kf);
+}
+
+UTEST_BEGIN("dsp.filters", dynlerp)
+
+    void init_cascades(dsp::f_cascade_t *c0, dsp::f_cascade_t *c1, size_t lanes)
+    {
+        // Sweep the shelving-like cascades between two different shapes
+        for (size_t j=0; j<lanes; ++j)
+        {
+            c0[j].t[0]  = 1.0f;
+            c0[j].t[1]  = 0.5f + 0.1f * j;
+            c0[j].t[2]  = 0.2f;
+            c0[j].t[3]  = 0.0f;
+            c0[j].b[0]  = 1.0f;
+            c0[j].b[1]  = 1.4f;
+            c0[j].b[2]  = 1.0f;
+            c0[j].b[3]  = 0.0f;
+
+            c1[j].t[0]  = 1.0f;
+            c1[j].t[1]  = 0.1f;
+            c1[j].t[2]  = 0.8f + 0.05f * j;
+            c1[j].t[3]  = 0.0f;
+            c1[j].b[0]  = 1.0f;
+            c1[j].b[1]  = 0.7f - 0.02f * j;
+            c1[j].b[2]  = 1.0f;
+            c1[j].b[3]  = 0.0f;
+        }
+    }
+
+    // Apply each lane as separate x1 dynamic filter with per-sample array of filters
+    void process_lanes(float *dst, const float *src, size_t count, size_t lanes, dsp::biquad_x1_t *fx, const dsp::biquad_x1_t *l0, const dsp::biquad_x1_t *l1)
+    {
+        float d[LSP_DSP_BIQUAD_D_ITEMS];
+        const float delta   = 1.0f / float(count);
+
+        for (size_t j=0; j<lanes; ++j)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                float k         = float(i) * delta;
+                fx[i].b0        = l0[j].b0 + (l1[j].b0 - l0[j].b0) * k;
+                fx[i].b1        = l0[j].b1 + (l1[j].b1 - l0[j].b1) * k;
+                fx[i].b2        = l0[j].b2 + (l1[j].b2 - l0[j].b2) * k;
+                fx[i].a1        = l0[j].a1 + (l1[j].a1 - l0[j].a1) * k;
+                fx[i].a2        = l0[j].a2 + (l1[j].a2 - l0[j].a2) * k;
+                fx[i].p0        = 0.0f;
+                fx[i].p1        = 0.0f;
+                fx[i].p2        = 0.0f;
+            }
+
+            dsp::fill_zero(d, LSP_DSP_BIQUAD_D_ITEMS);
+            generic::dyn_biquad_process_x1(dst, (j == 0) ? src : dst, d, count, fx);
+        }
+    }
+
+    template <class bank_t>
+        void call(const char *label, size_t lanes,
+            void (* func)(float *dst, const float *src, float *d, size_t count, const bank_t *f0, const bank_t *f1))
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        float d[LSP_DSP_BIQUAD_D_ITEMS];
+        dsp::f_cascade_t c0[8], c1[8];
+        dsp::biquad_x1_t l0[8], l1[8];
+        bank_t f0, f1;
+
+        // Lanes of the filter bank are stored with the stride of lanes floats
+        init_cascades(c0, c1, lanes);
+        generic::bilinear_transform_x1(l0, c0, 3.0f, lanes);
+        generic::bilinear_transform_x1(l1, c1, 0.5f, lanes);
+        float *v0   = reinterpret_cast<float *>(&f0);
+        float *v1   = reinterpret_cast<float *>(&f1);
+        dsp::fill_zero(v0, sizeof(bank_t) / sizeof(float));
+        dsp::fill_zero(v1, sizeof(bank_t) / sizeof(float));
+        for (size_t j=0; j<lanes; ++j)
+        {
+            const float *s0 = &l0[j].b0, *s1 = &l1[j].b0;
+            for (size_t r=0; r<5; ++r)
+            {
+                v0[r*lanes + j] = s0[r];
+                v1[r*lanes + j] = s1[r];
+            }
+        }
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 0x1f, 0x20, 0x21, 0x40, 0x41, 0x1ff)
+        {
+            printf("Testing %s on input buffer size=%d...\n", label, int(count));
+
+            FloatBuffer src(count);
+            FloatBuffer dst1(count);
+            FloatBuffer dst2(count);
+            src.randomize_sign();
+
+            void *p = NULL;
+            dsp::biquad_x1_t *fx = alloc_aligned<dsp::biquad_x1_t>(p, count + 1, 64);
+            UTEST_ASSERT_MSG(fx != NULL, "Out of memory while allocating fx");
+
+            // Apply processing
+            process_lanes(dst1, src, count, lanes, fx, l0, l1);
+            dsp::fill_zero(d, LSP_DSP_BIQUAD_D_ITEMS);
+            func(dst2, src, d, count, &f0, &f1);
+
+            // Perform validation
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                src.dump("src");
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                        label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+            }
+
+            free_aligned(p);
+        }
+    }
+
+    void call(const char *label, size_t lanes, dyn_cascade_lerp_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        float d[LSP_DSP_BIQUAD_D_ITEMS];
+        dsp::f_cascade_t c0[8], c1[8], c;
+        const float kf = 1.5f;
+
+        init_cascades(c0, c1, lanes);
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 0x1f, 0x20, 0x21, 0x40, 0x41, 0x1ff)
+        {
+            printf("Testing %s on input buffer size=%d...\n", label, int(count));
+
+            FloatBuffer src(count);
+            FloatBuffer dst1(count);
+            FloatBuffer dst2(count);
+            src.randomize_sign();
+
+            void *p = NULL;
+            dsp::biquad_x1_t *fx = alloc_aligned<dsp::biquad_x1_t>(p, count + 1, 64);
+            UTEST_ASSERT_MSG(fx != NULL, "Out of memory while allocating fx");
+
+            // Reference: interpolate cascades and transform them for each sample of each lane
+            const float delta   = 1.0f / float(count);
+            for (size_t j=0; j<lanes; ++j)
+            {
+                for (size_t i=0; i<count; ++i)
+                {
+                    float k         = float(i) * delta;
+                    for (size_t r=0; r<4; ++r)
+                    {
+                        c.t[r]          = c0[j].t[r] + (c1[j].t[r] - c0[j].t[r]) * k;
+                        c.b[r]          = c0[j].b[r] + (c1[j].b[r] - c0[j].b[r]) * k;
+                    }
+                    generic::bilinear_transform_x1(&fx[i], &c, kf, 1);
+                }
+
+                dsp::fill_zero(d, LSP_DSP_BIQUAD_D_ITEMS);
+                generic::dyn_biquad_process_x1(dst1, (j == 0) ? src : dst1, d, count, fx);
+            }
+
+            dsp::fill_zero(d, LSP_DSP_BIQUAD_D_ITEMS);
+            func(dst2, src, d, count, c0, c1, kf);
+
+            // Perform validation
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                src.dump("src");
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                        label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+            }
+
+            free_aligned(p);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, lanes) \
+            call(#func, lanes, func)
+
+        CALL(generic::dyn_biquad_lerp_x1, 1);
+        CALL(generic::dyn_biquad_lerp_x2, 2);
+        CALL(generic::dyn_biquad_lerp_x4, 4);
+        CALL(generic::dyn_biquad_lerp_x8, 8);
+        IF_ARCH_X86(CALL(sse::dyn_biquad_lerp_x1, 1));
+        IF_ARCH_X86(CALL(sse::dyn_biquad_lerp_x2, 2));
+        IF_ARCH_X86(CALL(sse::dyn_biquad_lerp_x4, 4));
+        IF_ARCH_X86(CALL(sse::dyn_biquad_lerp_x8, 8));
+        IF_ARCH_X86(CALL(avx::dyn_biquad_lerp_x8, 8));
+
+        CALL(generic::dyn_cascade_lerp_x1, 1);
+        CALL(generic::dyn_cascade_lerp_x2, 2);
+        CALL(generic::dyn_cascade_lerp_x4, 4);
+        CALL(generic::dyn_cascade_lerp_x8, 8);
+        IF_ARCH_X86(CALL(sse::dyn_cascade_lerp_x1, 1));
+        IF_ARCH_X86(CALL(sse::dyn_cascade_lerp_x2, 2));
+        IF_ARCH_X86(CALL(sse::dyn_cascade_lerp_x4, 4));
+        IF_ARCH_X86(CALL(sse::dyn_cascade_lerp_x8, 8));
+        IF_ARCH_X86(CALL(avx::dyn_cascade_lerp_x8, 8));
+    }
+
+UTEST_END
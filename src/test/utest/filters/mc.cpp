@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define CHANNELS        8
+#define CASCADES        3
+#define BUF_SIZE        1024
+#define BUF_STEP        13
+#define TOLERANCE       1e-3f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+
+        namespace avx
+        {
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+            void biquad_process_mc8_fma3(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+
+        namespace avx512
+        {
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void biquad_process_mc8(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+        }
+    )
+
+    typedef void (* biquad_process_mc_t)(float * const *dst, const float * const *src, size_t count, dsp::biquad_t *f, size_t nc);
+}
+
+UTEST_BEGIN("dsp.filters", mc)
+
+    void init_bank(dsp::biquad_t *f, size_t shift)
+    {
+        // Different shelving filters for each channel
+        static const float b0[] = { 1.79906213f, 1.16191483f, 1.13150513f, 1.11161804f, 0.515558779f, 0.878978848f, 0.346979439f, 0.704830527f };
+        static const float b1[] = { -3.38381839f, -2.20469999f, -2.18261695f, -2.19184852f, -0.994858623f, -1.69613969f, -0.683136344f, -1.38767684f };
+        static const float b2[] = { 1.59139514f, 1.04720736f, 1.05562544f, 1.08485937f, 0.481613606f, 0.821105599f, 0.337956876f, 0.686502695f };
+        static const float a1[] = { 1.8580488f, 1.88010871f, 1.91898823f, 1.96808743f, 1.93867457f, 1.93867457f, 1.97910678f, 1.97910678f };
+        static const float a2[] = { -0.863286555f, -0.88529253f, -0.924120247f, -0.97324127f, -0.942126751f, -0.942126751f, -0.981672168f, -0.981672168f };
+
+        dsp::biquad_x8_t *x8 = &f->x8;
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            size_t j    = (i + shift) % CHANNELS;
+            x8->b0[i]   = b0[j];
+            x8->b1[i]   = b1[j];
+            x8->b2[i]   = b2[j];
+            x8->a1[i]   = a1[j];
+            x8->a2[i]   = a2[j];
+        }
+        dsp::fill_zero(f->d, LSP_DSP_BIQUAD_D_ITEMS);
+    }
+
+    void init_banks(dsp::biquad_t *f, size_t nc)
+    {
+        // Each cascade uses different filters for the channel
+        for (size_t i=0; i<nc; ++i)
+            init_bank(&f[i], i * 3);
+    }
+
+    void call(const char *label, biquad_process_mc_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        dsp::biquad_t f1[CHANNELS * CASCADES] __lsp_aligned64;
+        dsp::biquad_t f2[CASCADES] __lsp_aligned64;
+
+        for (size_t nc=1; nc<=CASCADES; ++nc)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0x1f, 0x40, 0x1ff)
+            {
+                FloatBuffer src(count * CHANNELS);
+                FloatBuffer dst1(count * CHANNELS);
+                FloatBuffer dst2(count * CHANNELS);
+                src.randomize_sign();
+
+                printf("Testing %s on input buffer size=%d, cascades=%d...\n", label, int(count), int(nc));
+
+                // Each channel is processed by the chain of separate filters by the reference implementation
+                init_banks(f2, nc);
+                for (size_t i=0; i<CHANNELS; ++i)
+                {
+                    for (size_t j=0; j<nc; ++j)
+                    {
+                        dsp::biquad_t *f    = &f1[i * CASCADES + j];
+                        dsp::biquad_x1_t *x1= &f->x1;
+                        x1->b0      = f2[j].x8.b0[i];
+                        x1->b1      = f2[j].x8.b1[i];
+                        x1->b2      = f2[j].x8.b2[i];
+                        x1->a1      = f2[j].x8.a1[i];
+                        x1->a2      = f2[j].x8.a2[i];
+                        x1->p0      = 0.0f;
+                        x1->p1      = 0.0f;
+                        x1->p2      = 0.0f;
+                        dsp::fill_zero(f->d, LSP_DSP_BIQUAD_D_ITEMS);
+
+                        generic::biquad_process_x1(dst1.data(i * count), (j > 0) ? dst1.data(i * count) : src.data(i * count), count, f);
+                    }
+                }
+
+                const float *vs[CHANNELS];
+                float *vd[CHANNELS];
+                for (size_t i=0; i<CHANNELS; ++i)
+                {
+                    vs[i]       = src.data(i * count);
+                    vd[i]       = dst2.data(i * count);
+                }
+                func(vd, vs, count, f2, nc);
+
+                // Perform validation
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+
+                for (size_t i=0; i<CHANNELS; ++i)
+                {
+                    for (size_t j=0; j<nc; ++j)
+                    {
+                        const dsp::biquad_t *f  = &f1[i * CASCADES + j];
+                        if ((!float_equals_adaptive(f->d[0], f2[j].d[i], TOLERANCE)) ||
+                            (!float_equals_adaptive(f->d[1], f2[j].d[i + 8], TOLERANCE)))
+                            UTEST_FAIL_MSG("Filter memory of channel #%d, cascade #%d for test '%s' differs: {%.6f, %.6f} vs {%.6f, %.6f}",
+                                int(i), int(j), label, f->d[0], f->d[1], f2[j].d[i], f2[j].d[i + 8]);
+                    }
+                }
+            }
+        }
+    }
+
+    void call(const char *label, biquad_process_mc_t func1, biquad_process_mc_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        printf("Testing %s on buffer size %d...\n", label, BUF_SIZE);
+
+        dsp::biquad_t f1[CASCADES] __lsp_aligned64;
+        dsp::biquad_t f2[CASCADES] __lsp_aligned64;
+        init_banks(f1, CASCADES);
+        init_banks(f2, CASCADES);
+
+        FloatBuffer src(BUF_SIZE * CHANNELS);
+        FloatBuffer dst1(BUF_SIZE * CHANNELS);
+        FloatBuffer dst2(BUF_SIZE * CHANNELS);
+        src.randomize_sign();
+        dst2.copy(src);
+
+        // The second function processes data in-place
+        const float *vs[CHANNELS];
+        float *vd1[CHANNELS], *vd2[CHANNELS];
+
+        for (size_t i=0; i<BUF_SIZE; i += BUF_STEP)
+        {
+            size_t count = lsp_min(BUF_SIZE - i, size_t(BUF_STEP));
+            for (size_t j=0; j<CHANNELS; ++j)
+            {
+                vs[j]       = src.data(j * BUF_SIZE + i);
+                vd1[j]      = dst1.data(j * BUF_SIZE + i);
+                vd2[j]      = dst2.data(j * BUF_SIZE + i);
+            }
+
+            func1(vd1, vs, count, f1, CASCADES);
+            func2(vd2, vd2, count, f2, CASCADES);
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            src.dump("src");
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                    label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+
+        for (size_t i=0; i<CASCADES; ++i)
+        {
+            for (size_t j=0; j<LSP_DSP_BIQUAD_D_ITEMS; ++j)
+            {
+                if (float_equals_absolute(f1[i].d[j], f2[i].d[j], TOLERANCE))
+                    continue;
+                UTEST_FAIL_MSG("Filter memory items #%d of cascade #%d for test '%s' differ: %.6f vs %.6f",
+                        int(j), int(i), label, f1[i].d[j], f2[i].d[j]);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func) \
+            call(#func, func)
+
+        // PART 1, check against the independent processing of each channel
+        CALL(generic::biquad_process_mc8);
+        IF_ARCH_X86(CALL(sse::biquad_process_mc8));
+        IF_ARCH_X86(CALL(avx::biquad_process_mc8));
+        IF_ARCH_X86(CALL(avx::biquad_process_mc8_fma3));
+        IF_ARCH_X86(CALL(avx512::biquad_process_mc8));
+        IF_ARCH_ARM(CALL(neon_d32::biquad_process_mc8));
+        IF_ARCH_AARCH64(CALL(asimd::biquad_process_mc8));
+
+        #undef CALL
+        #define CALL(generic, func) \
+            call(#func, generic, func)
+
+        // PART 2, check block processing and in-place processing
+        IF_ARCH_X86(CALL(generic::biquad_process_mc8, sse::biquad_process_mc8));
+        IF_ARCH_X86(CALL(generic::biquad_process_mc8, avx::biquad_process_mc8));
+        IF_ARCH_X86(CALL(generic::biquad_process_mc8, avx::biquad_process_mc8_fma3));
+        IF_ARCH_X86(CALL(generic::biquad_process_mc8, avx512::biquad_process_mc8));
+        IF_ARCH_ARM(CALL(generic::biquad_process_mc8, neon_d32::biquad_process_mc8));
+        IF_ARCH_AARCH64(CALL(generic::biquad_process_mc8, asimd::biquad_process_mc8));
+    }
+
+UTEST_END
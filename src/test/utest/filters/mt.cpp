@@ -37,16 +37,66 @@ namespace lsp
     namespace generic
     {
         void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
     }
 
     IF_ARCH_X86(
-        namespace sse
+        namespace sse2
         {
             void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        }
+
+        namespace avx2
+        {
+            void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+
+            void matched_transform_x1_fma3(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2_fma3(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4_fma3(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8_fma3(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        }
+
+        namespace avx512
+        {
+            void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void matched_transform_x1(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x2(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x4(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+            void matched_transform_x8(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
         }
     )
 
     typedef void (* matched_transform_x1_t)(dsp::biquad_x1_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+    typedef void (* matched_transform_x2_t)(dsp::biquad_x2_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+    typedef void (* matched_transform_x4_t)(dsp::biquad_x4_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
+    typedef void (* matched_transform_x8_t)(dsp::biquad_x8_t *bf, dsp::f_cascade_t *bc, float kf, float td, size_t count);
 }
 
 UTEST_BEGIN("dsp.filters", mt)
@@ -76,7 +126,7 @@ UTEST_BEGIN("dsp.filters", mt)
         FloatBuffer dst2(BIQUAD_X1_FLOATS * CASCADES, 64, true);
 
         f1(dst1.data<dsp::biquad_x1_t>(), bc, 1.5f, td, CASCADES);
-        f2(dst2.data<dsp::biquad_x1_t>(), bc, 1.5f, td, CASCADES);
+        f2(dst2.data<dsp::biquad_x1_t>(), src2.data<dsp::f_cascade_t>(), 1.5f, td, CASCADES);
 
         UTEST_ASSERT_MSG(src1.valid(), "Source buffer corrupted");
         UTEST_ASSERT_MSG(src2.valid(), "Source buffer corrupted");
@@ -92,13 +142,114 @@ UTEST_BEGIN("dsp.filters", mt)
         }
     }
 
-    UTEST_MAIN
+    void init_cascades(FloatBuffer &src, size_t cascades)
     {
-        IF_ARCH_X86(call("mt_sse_x1", generic::matched_transform_x1, sse::matched_transform_x1));
+        // Mix polynoms of different orders, real and complex roots
+        dsp::f_cascade_t *bc = src.data<dsp::f_cascade_t>();
+        for (size_t i=0; i<cascades; ++i)
+        {
+            size_t k    = (i * 7) % 13;
+            float kt    = k * 0.1f;
+            float kb    = (i % 5) * 0.5f;
+
+            bc[i].t[0]  = 1.0f + kt;
+            bc[i].t[1]  = (k == 3) ? 0.0f : 0.5f + kt;
+            bc[i].t[2]  = ((k == 3) || (k == 5) || (k == 6)) ? 0.0f : 1.0f - kt * 0.5f;
+            bc[i].t[3]  = 1.0f;
+            bc[i].b[0]  = 1.0f;
+            bc[i].b[1]  = 0.5f + kb;
+            bc[i].b[2]  = 1.0f + kt * 0.2f;
+            bc[i].b[3]  = 1.0f;
+        }
     }
 
-UTEST_END;
-
-
+    template <class F, class T>
+        void call(const char *text, F f1, F f2, size_t lanes)
+        {
+            if (!UTEST_SUPPORTED(f1))
+                return;
+            if (!UTEST_SUPPORTED(f2))
+                return;
+
+            const size_t floats = sizeof(T) / sizeof(float);
+            const float td = 1.0f / 48000.0f;
+            static const float freqs[] = { 1.5f, 20.0f, 100.0f, 1000.0f, 5000.0f, 15000.0f };
+
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 16, 17, 0x1ff)
+            {
+                for (size_t j=0; j<sizeof(freqs)/sizeof(float); ++j)
+                {
+                    size_t filters  = count + lanes - 1;
+                    size_t cascades = filters * lanes;
+                    float kf        = 2.0f * M_PI * freqs[j];
+                    printf("Testing %s matched transformation, filters=%d, cascades=%d, kf=%.1f\n",
+                        text, int(filters), int(cascades), kf);
+
+                    FloatBuffer src1(CASCADE_FLOATS * cascades, 64, true);
+                    init_cascades(src1, cascades);
+                    FloatBuffer src2(src1);
+                    FloatBuffer dst1(floats * filters, 64, true);
+                    FloatBuffer dst2(dst1);
+
+                    f1(dst1.data<T>(), src1.data<dsp::f_cascade_t>(), kf, td, filters);
+                    f2(dst2.data<T>(), src2.data<dsp::f_cascade_t>(), kf, td, filters);
+
+                    UTEST_ASSERT_MSG(src1.valid(), "Source buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(src2.valid(), "Source buffer 2 corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+                    if (!dst1.equals_adaptive(dst2, 1e-4f))
+                    {
+                        src1.dump("src1");
+                        src2.dump("src2");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        printf("index=%d, %.6f vs %.6f\n", int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs", text);
+                    }
+                }
+            }
+        }
 
+    UTEST_MAIN
+    {
+        #define CALL(generic, func, type, lanes) \
+            call<matched_transform_ ## type ## _t, dsp::biquad_ ## type ## _t>(#func, generic, func, lanes)
+
+        IF_ARCH_X86(call("mt_sse2_x1", generic::matched_transform_x1, sse2::matched_transform_x1));
+        IF_ARCH_X86(call("mt_avx2_x1", generic::matched_transform_x1, avx2::matched_transform_x1));
+        IF_ARCH_X86(call("mt_avx2_x1_fma3", generic::matched_transform_x1, avx2::matched_transform_x1_fma3));
+        IF_ARCH_X86(call("mt_avx512_x1", generic::matched_transform_x1, avx512::matched_transform_x1));
+        IF_ARCH_ARM(call("mt_neon_d32_x1", generic::matched_transform_x1, neon_d32::matched_transform_x1));
+        IF_ARCH_AARCH64(call("mt_asimd_x1", generic::matched_transform_x1, asimd::matched_transform_x1));
+
+        IF_ARCH_X86(CALL(generic::matched_transform_x1, sse2::matched_transform_x1, x1, 1));
+        IF_ARCH_X86(CALL(generic::matched_transform_x1, avx2::matched_transform_x1, x1, 1));
+        IF_ARCH_X86(CALL(generic::matched_transform_x1, avx2::matched_transform_x1_fma3, x1, 1));
+        IF_ARCH_X86(CALL(generic::matched_transform_x1, avx512::matched_transform_x1, x1, 1));
+        IF_ARCH_ARM(CALL(generic::matched_transform_x1, neon_d32::matched_transform_x1, x1, 1));
+        IF_ARCH_AARCH64(CALL(generic::matched_transform_x1, asimd::matched_transform_x1, x1, 1));
+
+        IF_ARCH_X86(CALL(generic::matched_transform_x2, sse2::matched_transform_x2, x2, 2));
+        IF_ARCH_X86(CALL(generic::matched_transform_x2, avx2::matched_transform_x2, x2, 2));
+        IF_ARCH_X86(CALL(generic::matched_transform_x2, avx2::matched_transform_x2_fma3, x2, 2));
+        IF_ARCH_X86(CALL(generic::matched_transform_x2, avx512::matched_transform_x2, x2, 2));
+        IF_ARCH_ARM(CALL(generic::matched_transform_x2, neon_d32::matched_transform_x2, x2, 2));
+        IF_ARCH_AARCH64(CALL(generic::matched_transform_x2, asimd::matched_transform_x2, x2, 2));
+
+        IF_ARCH_X86(CALL(generic::matched_transform_x4, sse2::matched_transform_x4, x4, 4));
+        IF_ARCH_X86(CALL(generic::matched_transform_x4, avx2::matched_transform_x4, x4, 4));
+        IF_ARCH_X86(CALL(generic::matched_transform_x4, avx2::matched_transform_x4_fma3, x4, 4));
+        IF_ARCH_X86(CALL(generic::matched_transform_x4, avx512::matched_transform_x4, x4, 4));
+        IF_ARCH_ARM(CALL(generic::matched_transform_x4, neon_d32::matched_transform_x4, x4, 4));
+        IF_ARCH_AARCH64(CALL(generic::matched_transform_x4, asimd::matched_transform_x4, x4, 4));
+
+        IF_ARCH_X86(CALL(generic::matched_transform_x8, sse2::matched_transform_x8, x8, 8));
+        IF_ARCH_X86(CALL(generic::matched_transform_x8, avx2::matched_transform_x8, x8, 8));
+        IF_ARCH_X86(CALL(generic::matched_transform_x8, avx2::matched_transform_x8_fma3, x8, 8));
+        IF_ARCH_X86(CALL(generic::matched_transform_x8, avx512::matched_transform_x8, x8, 8));
+        IF_ARCH_ARM(CALL(generic::matched_transform_x8, neon_d32::matched_transform_x8, x8, 8));
+        IF_ARCH_AARCH64(CALL(generic::matched_transform_x8, asimd::matched_transform_x8, x8, 8));
+    }
 
+UTEST_END;
@@ -21,6 +21,7 @@
 
 #include <lsp-plug.in/common/types.h>
 #include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
 #include <lsp-plug.in/test-fw/utest.h>
 #include <lsp-plug.in/test-fw/helpers.h>
 #include <lsp-plug.in/test-fw/FloatBuffer.h>
@@ -37,6 +38,7 @@ namespace lsp
         void biquad_process_x2(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         void biquad_process_x4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_x16(float *dst, const float *src, size_t count, dsp::biquad16_t *f);
     }
 
     IF_ARCH_X86(
@@ -67,6 +69,13 @@ namespace lsp
             void x64_biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
             void biquad_process_x8_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         }
+
+        namespace avx512
+        {
+            void biquad_process_x4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_x16(float *dst, const float *src, size_t count, dsp::biquad16_t *f);
+        }
     )
 
     IF_ARCH_ARM(
@@ -90,6 +99,7 @@ namespace lsp
     )
 
     typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    typedef void (* biquad_process16_t)(float *dst, const float *src, size_t count, dsp::biquad16_t *f);
 }
 
 UTEST_BEGIN("dsp.filters", static)
@@ -241,6 +251,138 @@ UTEST_BEGIN("dsp.filters", static)
     }
 
 
+    /**
+     * Initialize the bank of 16 well-conditioned cascades: the poles are kept far enough
+     * from the unit circle to make the result of 16 chained single-precision cascades
+     * stay close to the result computed in double precision
+     */
+    void init_bank16(dsp::biquad16_t *f)
+    {
+        dsp::biquad_x16_t *x16 = &f->x16;
+        for (size_t i=0; i<16; ++i)
+        {
+            double r    = 0.5 + 0.025 * i;
+            double w    = M_PI * (i + 1) / 20.0;
+            double b0   = 1.0;
+            double b1   = -1.6 * cos(1.5 * w);
+            double b2   = 0.64;
+            double a1   = 2.0 * r * cos(w);
+            double a2   = -r * r;
+            double k    = (1.0 - a1 - a2) / (b0 + b1 + b2); // Unit gain at DC
+
+            x16->b0[i]  = b0 * k;
+            x16->b1[i]  = b1 * k;
+            x16->b2[i]  = b2 * k;
+            x16->a1[i]  = a1;
+            x16->a2[i]  = a2;
+        }
+
+        dsp::fill_zero(f->d, LSP_DSP_BIQUAD16_D_ITEMS);
+    }
+
+    void call16(const char *label, biquad_process16_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        dsp::biquad16_t f __lsp_aligned64;
+        init_bank16(&f);
+        const dsp::biquad_x16_t *x16 = &f.x16;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 0x1f, 0x40, 0x1ff)
+        {
+            FloatBuffer src(count);
+            FloatBuffer dst1(count);
+            FloatBuffer dst2(count);
+            src.randomize_sign();
+
+            printf("Testing %s on input buffer size=%d...\n", label, int(count));
+
+            // Compute the reference with double precision
+            double *ref = new double[count + 1];
+            for (size_t i=0; i<count; ++i)
+                ref[i]      = src[i];
+            for (size_t j=0; j<16; ++j)
+            {
+                double d0 = 0.0, d1 = 0.0;
+                for (size_t i=0; i<count; ++i)
+                {
+                    double s    = ref[i];
+                    double s2   = x16->b0[j]*s + d0;
+                    d0          = d1 + x16->b1[j]*s + x16->a1[j]*s2;
+                    d1          = x16->b2[j]*s + x16->a2[j]*s2;
+                    ref[i]      = s2;
+                }
+            }
+            for (size_t i=0; i<count; ++i)
+                dst1[i]     = ref[i];
+            delete [] ref;
+
+            // Apply processing
+            dsp::fill_zero(f.d, LSP_DSP_BIQUAD16_D_ITEMS);
+            func(dst2, src, count, &f);
+
+            // Perform validation
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                src.dump("src");
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                        label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+            }
+        }
+    }
+
+    void call16(const char *label, const dsp::biquad16_t *bq, biquad_process16_t func1, biquad_process16_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        printf("Testing %s on buffer size %d...\n", label, BUF_SIZE);
+
+        dsp::biquad16_t f1 = *bq, f2 = *bq;
+
+        FloatBuffer src(BUF_SIZE);
+        FloatBuffer dst1(BUF_SIZE);
+        FloatBuffer dst2(BUF_SIZE);
+
+        for (size_t i=0; i<BUF_SIZE; i += BUF_STEP)
+        {
+            size_t count = BUF_SIZE - i;
+            if (count > BUF_STEP)
+                count = BUF_STEP;
+            func1(dst1.data(i), src.data(i), count, &f1);
+            func2(dst2.data(i), src.data(i), count, &f2);
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            src.dump("src");
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                    label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+
+        for (size_t j=0; j<LSP_DSP_BIQUAD16_D_ITEMS; ++j)
+        {
+            if (float_equals_absolute(f1.d[j], f2.d[j], TOLERANCE))
+                continue;
+            UTEST_FAIL_MSG("Filter memory items #%d for test '%s' differ: %.6f vs %.6f",
+                    int(j), label, f1.d[j], f2.d[j]);
+        }
+    }
+
     UTEST_MAIN
     {
         #define CALL(func, count) \
@@ -265,6 +407,7 @@ UTEST_BEGIN("dsp.filters", static)
         IF_ARCH_X86(CALL(sse::biquad_process_x4, 4));
         IF_ARCH_X86(CALL(avx::biquad_process_x4, 4));
         IF_ARCH_X86(CALL(avx::biquad_process_x4_fma3, 4));
+        IF_ARCH_X86(CALL(avx512::biquad_process_x4, 4));
         IF_ARCH_ARM(CALL(neon_d32::biquad_process_x4, 4));
         IF_ARCH_AARCH64(CALL(asimd::biquad_process_x4, 4));
 
@@ -273,9 +416,13 @@ UTEST_BEGIN("dsp.filters", static)
         IF_ARCH_X86(CALL(sse3::x64_biquad_process_x8, 8));
         IF_ARCH_X86(CALL(avx::x64_biquad_process_x8, 8));
         IF_ARCH_X86(CALL(avx::biquad_process_x8_fma3, 8));
+        IF_ARCH_X86(CALL(avx512::biquad_process_x8, 8));
         IF_ARCH_ARM(CALL(neon_d32::biquad_process_x8, 8));
         IF_ARCH_AARCH64(CALL(asimd::biquad_process_x8, 8));
 
+        call16("generic::biquad_process_x16", generic::biquad_process_x16);
+        IF_ARCH_X86(call16("avx512::biquad_process_x16", avx512::biquad_process_x16));
+
         #undef CALL
         #define CALL(generic, func) \
             call(#func, &bq, generic, func)
@@ -354,6 +501,7 @@ UTEST_BEGIN("dsp.filters", static)
         IF_ARCH_X86(CALL(generic::biquad_process_x4, sse::biquad_process_x4));
         IF_ARCH_X86(CALL(generic::biquad_process_x4, avx::biquad_process_x4));
         IF_ARCH_X86(CALL(generic::biquad_process_x4, avx::biquad_process_x4_fma3));
+        IF_ARCH_X86(CALL(generic::biquad_process_x4, avx512::biquad_process_x4));
         IF_ARCH_ARM(CALL(generic::biquad_process_x4, neon_d32::biquad_process_x4));
         IF_ARCH_AARCH64(CALL(generic::biquad_process_x4, asimd::biquad_process_x4));
 
@@ -409,8 +557,15 @@ UTEST_BEGIN("dsp.filters", static)
         IF_ARCH_X86(CALL(generic::biquad_process_x8, sse3::x64_biquad_process_x8));
         IF_ARCH_X86(CALL(generic::biquad_process_x8, avx::x64_biquad_process_x8));
         IF_ARCH_X86(CALL(generic::biquad_process_x8, avx::biquad_process_x8_fma3));
+        IF_ARCH_X86(CALL(generic::biquad_process_x8, avx512::biquad_process_x8));
         IF_ARCH_ARM(CALL(generic::biquad_process_x8, neon_d32::biquad_process_x8));
         IF_ARCH_AARCH64(CALL(generic::biquad_process_x8, asimd::biquad_process_x8));
+
+        // Prepare 32 zero, 32 pole filter
+        dsp::biquad16_t bq16 __lsp_aligned64;
+        init_bank16(&bq16);
+
+        IF_ARCH_X86(call16("avx512::biquad_process_x16", &bq16, generic::biquad_process_x16, avx512::biquad_process_x16));
     }
 
 UTEST_END
@@ -0,0 +1,459 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define CHANNELS        8
+#define BUF_SIZE        1024
+#define BUF_STEP        13
+#define TOLERANCE       1e-3f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void svf_process_x1(float *dst, const float *src, float *d, size_t count, const dsp::svf_x1_t *f);
+        void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f);
+        void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+
+        void svf_lerp_x1(float *dst, const float *src, float *d, size_t count, const dsp::svf_x1_t *f0, const dsp::svf_x1_t *f1);
+        void svf_lerp_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f0, const dsp::svf_x4_t *f1);
+        void svf_lerp_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f);
+            void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+            void svf_lerp_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f0, const dsp::svf_x4_t *f1);
+            void svf_lerp_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1);
+        }
+
+        namespace avx
+        {
+            void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+            void svf_process_x8_fma3(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+            void svf_lerp_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1);
+            void svf_lerp_x8_fma3(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f0, const dsp::svf_x8_t *f1);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f);
+            void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+        }
+    )
+
+    IF_ARCH_AARCH64(
+        namespace asimd
+        {
+            void svf_process_x4(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x4_t *f);
+            void svf_process_x8(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x8_t *f);
+        }
+    )
+
+    // Wrappers of single-channel functions for testing them as multichannel ones
+    static void svf_process_x1_mc(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x1_t *f)
+    {
+        generic::svf_process_x1(dst[0], src[0], d, count, f);
+    }
+
+    static void svf_lerp_x1_mc(float * const *dst, const float * const *src, float *d, size_t count, const dsp::svf_x1_t *f0, const dsp::svf_x1_t *f1)
+    {
+        generic::svf_lerp_x1(dst[0], src[0], d, count, f0, f1);
+    }
+}
+
+UTEST_BEGIN("dsp.filters", svf)
+
+    /**
+     * Set the state of the j'th filter of the bank of N filters
+     */
+    void set_filter(float *f, size_t lanes, size_t j, size_t type, float freq, float k)
+    {
+        float g     = tanf(M_PI * freq);
+        float m0    = 0.0f, m1 = 0.0f, m2 = 0.0f;
+
+        switch (type % 5)
+        {
+            case 0: m2 = 1.0f; break;                               // Lowpass
+            case 1: m1 = 1.0f; break;                               // Bandpass
+            case 2: m0 = 1.0f; m1 = -k; m2 = -1.0f; break;          // Highpass
+            case 3: m0 = 1.0f; m1 = -k; break;                      // Notch
+            default: m0 = 1.0f; m1 = -2.0f * k; break;              // Allpass
+        }
+
+        f[0*lanes + j]  = g;
+        f[1*lanes + j]  = k;
+        f[2*lanes + j]  = m0;
+        f[3*lanes + j]  = m1;
+        f[4*lanes + j]  = m2;
+    }
+
+    /**
+     * Generate filter banks with cutoff frequency randomly modulated on each sample
+     */
+    template <class T>
+        void init_banks(T *f, size_t lanes, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                float *v = reinterpret_cast<float *>(&f[i]);
+                for (size_t j=0; j<sizeof(T)/sizeof(float); ++j)
+                    v[j]        = 0.0f;
+                for (size_t j=0; j<lanes; ++j)
+                    set_filter(v, lanes, j, j, randf(0.001f, 0.45f), 0.5f + 0.2f * j);
+            }
+        }
+
+    /**
+     * Extract the j'th filter of the bank
+     */
+    template <class T>
+        void get_filter(dsp::svf_x1_t *dst, const T *f, size_t lanes, size_t j)
+        {
+            const float *v  = reinterpret_cast<const float *>(f);
+            dst->g          = v[0*lanes + j];
+            dst->k          = v[1*lanes + j];
+            dst->m0         = v[2*lanes + j];
+            dst->m1         = v[3*lanes + j];
+            dst->m2         = v[4*lanes + j];
+            dst->p0         = 0.0f;
+            dst->p1         = 0.0f;
+            dst->p2         = 0.0f;
+        }
+
+    void check_dc()
+    {
+        dsp::svf_x1_t f[BUF_SIZE] __lsp_aligned64;
+        float d[2];
+        FloatBuffer src(BUF_SIZE);
+        FloatBuffer dst(BUF_SIZE);
+        src.fill(1.0f);
+
+        printf("Testing generic::svf_process_x1 for DC input...\n");
+
+        // Lowpass and notch should pass DC, bandpass, highpass should reject it
+        static const float expected[] = { 1.0f, 0.0f, 0.0f, 1.0f, 1.0f };
+        for (size_t type=0; type<5; ++type)
+        {
+            for (size_t i=0; i<BUF_SIZE; ++i)
+            {
+                f[i].p0     = 0.0f;
+                f[i].p1     = 0.0f;
+                f[i].p2     = 0.0f;
+                set_filter(reinterpret_cast<float *>(&f[i]), 1, 0, type, 0.01f, 0.7f);
+            }
+            d[0] = 0.0f;
+            d[1] = 0.0f;
+
+            generic::svf_process_x1(dst, src, d, BUF_SIZE, f);
+            UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+            if (type == 4)
+                continue; // Allpass passes DC with unit gain but settles slowly
+            if (!float_equals_absolute(dst[BUF_SIZE - 1], expected[type], TOLERANCE))
+                UTEST_FAIL_MSG("Filter of type %d has DC gain %.6f, expected %.6f",
+                    int(type), dst[BUF_SIZE - 1], expected[type]);
+        }
+    }
+
+    template <class T, class F>
+        void call(const char *label, size_t lanes, F func)
+        {
+            if (!UTEST_SUPPORTED(func))
+                return;
+
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0x1f, 0x40, 0x1ff)
+            {
+                void *data      = NULL;
+                T *f            = alloc_aligned<T>(data, count + 1, 64);
+                dsp::svf_x1_t *f1   = NULL;
+                void *data1     = NULL;
+                f1              = alloc_aligned<dsp::svf_x1_t>(data1, count + 1, 64);
+                UTEST_ASSERT(f != NULL);
+                UTEST_ASSERT(f1 != NULL);
+
+                FloatBuffer src(count * lanes);
+                FloatBuffer dst1(count * lanes);
+                FloatBuffer dst2(count * lanes);
+                src.randomize_sign();
+                init_banks(f, lanes, count);
+
+                float d1[CHANNELS * 2], d2[CHANNELS * 2];
+                for (size_t i=0; i<CHANNELS * 2; ++i)
+                {
+                    d1[i]       = randf(-1.0f, 1.0f);
+                    d2[i]       = d1[i];
+                }
+
+                printf("Testing %s on input buffer size=%d...\n", label, int(count));
+
+                // Each channel is processed by separate filter by the reference implementation
+                for (size_t j=0; j<lanes; ++j)
+                {
+                    float d[2]  = { d1[j], d1[j + lanes] };
+                    for (size_t i=0; i<count; ++i)
+                        get_filter(&f1[i], &f[i], lanes, j);
+                    generic::svf_process_x1(dst1.data(j * count), src.data(j * count), d, count, f1);
+                    d1[j]           = d[0];
+                    d1[j + lanes]   = d[1];
+                }
+
+                const float *vs[CHANNELS];
+                float *vd[CHANNELS];
+                for (size_t j=0; j<lanes; ++j)
+                {
+                    vs[j]       = src.data(j * count);
+                    vd[j]       = dst2.data(j * count);
+                }
+                func(vd, vs, d2, count, f);
+
+                free_aligned(data);
+                free_aligned(data1);
+
+                // Perform validation
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+
+                for (size_t j=0; j<lanes*2; ++j)
+                {
+                    if (!float_equals_adaptive(d1[j], d2[j], TOLERANCE))
+                        UTEST_FAIL_MSG("Filter memory item #%d for test '%s' differs: %.6f vs %.6f",
+                            int(j), label, d1[j], d2[j]);
+                }
+            }
+        }
+
+    template <class T, class F>
+        void call(const char *label, size_t lanes, F func1, F func2)
+        {
+            if (!UTEST_SUPPORTED(func1))
+                return;
+            if (!UTEST_SUPPORTED(func2))
+                return;
+
+            printf("Testing %s on buffer size %d...\n", label, BUF_SIZE);
+
+            void *data      = NULL;
+            T *f            = alloc_aligned<T>(data, BUF_SIZE, 64);
+            UTEST_ASSERT(f != NULL);
+            init_banks(f, lanes, BUF_SIZE);
+
+            float d1[CHANNELS * 2], d2[CHANNELS * 2];
+            for (size_t i=0; i<CHANNELS * 2; ++i)
+            {
+                d1[i]       = 0.0f;
+                d2[i]       = 0.0f;
+            }
+
+            FloatBuffer src(BUF_SIZE * lanes);
+            FloatBuffer dst1(BUF_SIZE * lanes);
+            FloatBuffer dst2(BUF_SIZE * lanes);
+            src.randomize_sign();
+            dst2.copy(src);
+
+            // The second function processes data in-place
+            const float *vs[CHANNELS];
+            float *vd1[CHANNELS], *vd2[CHANNELS];
+
+            for (size_t i=0; i<BUF_SIZE; i += BUF_STEP)
+            {
+                size_t count = lsp_min(BUF_SIZE - i, size_t(BUF_STEP));
+                for (size_t j=0; j<lanes; ++j)
+                {
+                    vs[j]       = src.data(j * BUF_SIZE + i);
+                    vd1[j]      = dst1.data(j * BUF_SIZE + i);
+                    vd2[j]      = dst2.data(j * BUF_SIZE + i);
+                }
+
+                func1(vd1, vs, d1, count, &f[i]);
+                func2(vd2, vd2, d2, count, &f[i]);
+            }
+
+            free_aligned(data);
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                src.dump("src");
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                        label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+            }
+
+            for (size_t j=0; j<lanes*2; ++j)
+            {
+                if (!float_equals_adaptive(d1[j], d2[j], TOLERANCE))
+                    UTEST_FAIL_MSG("Filter memory item #%d for test '%s' differs: %.6f vs %.6f",
+                        int(j), label, d1[j], d2[j]);
+            }
+        }
+
+    template <class T, class P, class L>
+        void call_lerp(const char *label, size_t lanes, P process, L lerp)
+        {
+            if (!UTEST_SUPPORTED(lerp))
+                return;
+
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 0x1f, 0x20, 0x21, 0x40, 0x41, 0x1ff)
+            {
+                printf("Testing %s on input buffer size=%d...\n", label, int(count));
+
+                void *data      = NULL;
+                T *f            = alloc_aligned<T>(data, count + 2, 64);
+                UTEST_ASSERT(f != NULL);
+                T *fs           = &f[count];
+                init_banks(fs, lanes, 2);
+
+                // The reference implementation uses coefficients interpolated by the test
+                const size_t items  = sizeof(T) / sizeof(float);
+                const float *v0     = reinterpret_cast<const float *>(&fs[0]);
+                const float *v1     = reinterpret_cast<const float *>(&fs[1]);
+                const float delta   = (count > 0) ? 1.0f / float(count) : 0.0f;
+                for (size_t i=0; i<count; ++i)
+                {
+                    float *v            = reinterpret_cast<float *>(&f[i]);
+                    for (size_t j=0; j<items; ++j)
+                        v[j]                = v0[j] + (v1[j] - v0[j]) * delta * float(i);
+                }
+
+                FloatBuffer src(count * lanes);
+                FloatBuffer dst1(count * lanes);
+                FloatBuffer dst2(count * lanes);
+                src.randomize_sign();
+
+                float d1[CHANNELS * 2], d2[CHANNELS * 2];
+                for (size_t i=0; i<CHANNELS * 2; ++i)
+                {
+                    d1[i]       = randf(-1.0f, 1.0f);
+                    d2[i]       = d1[i];
+                }
+
+                const float *vs[CHANNELS];
+                float *vd1[CHANNELS], *vd2[CHANNELS];
+                for (size_t j=0; j<lanes; ++j)
+                {
+                    vs[j]       = src.data(j * count);
+                    vd1[j]      = dst1.data(j * count);
+                    vd2[j]      = dst2.data(j * count);
+                }
+
+                process(vd1, vs, d1, count, f);
+                lerp(vd2, vs, d2, count, &fs[0], &fs[1]);
+
+                free_aligned(data);
+
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+
+                for (size_t j=0; j<lanes*2; ++j)
+                {
+                    if (!float_equals_adaptive(d1[j], d2[j], TOLERANCE))
+                        UTEST_FAIL_MSG("Filter memory item #%d for test '%s' differs: %.6f vs %.6f",
+                            int(j), label, d1[j], d2[j]);
+                }
+            }
+        }
+
+    UTEST_MAIN
+    {
+        // PART 0, check the reference implementation
+        check_dc();
+
+        #define CALL(T, lanes, func) \
+            call<T>(#func, lanes, func)
+
+        // PART 1, check against the independent processing of each channel
+        CALL(dsp::svf_x4_t, 4, generic::svf_process_x4);
+        IF_ARCH_X86(CALL(dsp::svf_x4_t, 4, sse::svf_process_x4));
+        IF_ARCH_ARM(CALL(dsp::svf_x4_t, 4, neon_d32::svf_process_x4));
+        IF_ARCH_AARCH64(CALL(dsp::svf_x4_t, 4, asimd::svf_process_x4));
+
+        CALL(dsp::svf_x8_t, 8, generic::svf_process_x8);
+        IF_ARCH_X86(CALL(dsp::svf_x8_t, 8, sse::svf_process_x8));
+        IF_ARCH_X86(CALL(dsp::svf_x8_t, 8, avx::svf_process_x8));
+        IF_ARCH_X86(CALL(dsp::svf_x8_t, 8, avx::svf_process_x8_fma3));
+        IF_ARCH_ARM(CALL(dsp::svf_x8_t, 8, neon_d32::svf_process_x8));
+        IF_ARCH_AARCH64(CALL(dsp::svf_x8_t, 8, asimd::svf_process_x8));
+
+        #undef CALL
+        #define CALL(T, lanes, generic, func) \
+            call<T>(#func, lanes, generic, func)
+
+        // PART 2, check block processing and in-place processing
+        IF_ARCH_X86(CALL(dsp::svf_x4_t, 4, generic::svf_process_x4, sse::svf_process_x4));
+        IF_ARCH_ARM(CALL(dsp::svf_x4_t, 4, generic::svf_process_x4, neon_d32::svf_process_x4));
+        IF_ARCH_AARCH64(CALL(dsp::svf_x4_t, 4, generic::svf_process_x4, asimd::svf_process_x4));
+
+        IF_ARCH_X86(CALL(dsp::svf_x8_t, 8, generic::svf_process_x8, sse::svf_process_x8));
+        IF_ARCH_X86(CALL(dsp::svf_x8_t, 8, generic::svf_process_x8, avx::svf_process_x8));
+        IF_ARCH_X86(CALL(dsp::svf_x8_t, 8, generic::svf_process_x8, avx::svf_process_x8_fma3));
+        IF_ARCH_ARM(CALL(dsp::svf_x8_t, 8, generic::svf_process_x8, neon_d32::svf_process_x8));
+        IF_ARCH_AARCH64(CALL(dsp::svf_x8_t, 8, generic::svf_process_x8, asimd::svf_process_x8));
+
+        #undef CALL
+        #define CALL(T, lanes, process, lerp) \
+            call_lerp<T>(#lerp, lanes, process, lerp)
+
+        // PART 3, check ramped filters
+        call_lerp<dsp::svf_x1_t>("generic::svf_lerp_x1", 1, svf_process_x1_mc, svf_lerp_x1_mc);
+        CALL(dsp::svf_x4_t, 4, generic::svf_process_x4, generic::svf_lerp_x4);
+        IF_ARCH_X86(CALL(dsp::svf_x4_t, 4, generic::svf_process_x4, sse::svf_lerp_x4));
+        CALL(dsp::svf_x8_t, 8, generic::svf_process_x8, generic::svf_lerp_x8);
+        IF_ARCH_X86(CALL(dsp::svf_x8_t, 8, generic::svf_process_x8, sse::svf_lerp_x8));
+        IF_ARCH_X86(CALL(dsp::svf_x8_t, 8, generic::svf_process_x8, avx::svf_lerp_x8));
+        IF_ARCH_X86(CALL(dsp::svf_x8_t, 8, generic::svf_process_x8, avx::svf_lerp_x8_fma3));
+
+        #undef CALL
+    }
+
+UTEST_END
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count);
+        void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+            const float *taps, size_t length, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count);
+            void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+                const float *taps, size_t length, size_t count);
+        }
+
+        namespace avx
+        {
+            void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count);
+            void fir_direct_fma3(float *dst, const float *src, const float *taps, size_t length, size_t count);
+            void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+                const float *taps, size_t length, size_t count);
+            void fir_direct_x2_fma3(float *dst1, float *dst2, const float *src1, const float *src2,
+                const float *taps, size_t length, size_t count);
+        }
+
+        namespace avx512
+        {
+            void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count);
+            void fir_direct_x2(float *dst1, float *dst2, const float *src1, const float *src2,
+                const float *taps, size_t length, size_t count);
+        }
+    )
+
+    static void fir_direct(float *dst, const float *src, const float *taps, size_t length, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            double s = 0.0;
+            for (size_t j=0; j<length; ++j)
+                s      += double(taps[j]) * double(src[i+j]);
+            dst[i]  = s;
+        }
+    }
+
+    typedef void (* fir_direct_t)(float *dst, const float *src, const float *taps, size_t length, size_t count);
+    typedef void (* fir_direct_x2_t)(float *dst1, float *dst2, const float *src1, const float *src2,
+        const float *taps, size_t length, size_t count);
+}
+
+UTEST_BEGIN("dsp.fir", direct)
+
+    void call(const char *label, size_t align, fir_direct_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        for (size_t mask=0; mask <= 0x07; ++mask)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 8, 15, 16, 17, 24, 32, 33, 47, 64, 65, 0x80, 0x1ff)
+            {
+                UTEST_FOREACH(length, 1, 2, 3, 4, 5, 8, 16, 17, 31, 32, 64, 0x80)
+                {
+                    printf("Testing %s length=%d on buffer count=%d mask=0x%x\n", label, int(length), int(count), int(mask));
+
+                    FloatBuffer src(count + length - 1, align, mask & 0x01);
+                    FloatBuffer taps(length, align, mask & 0x02);
+                    FloatBuffer dst1(count, align, mask & 0x04);
+                    FloatBuffer dst2(dst1);
+
+                    fir_direct(dst1, src, taps, length, count);
+                    func(dst2, src, taps, length, count);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(taps.valid(), "Taps buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    if (!dst1.equals_adaptive(dst2, 1e-4))
+                    {
+                        src.dump("src ");
+                        taps.dump("taps");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at index %d, value=%f vs %f",
+                            label, int(dst1.last_diff()), dst1.get(dst1.last_diff()), dst2.get(dst1.last_diff()));
+                    }
+
+                    // Check in-place processing
+                    FloatBuffer dst3(src);
+                    func(dst3, dst3, taps, length, count);
+                    UTEST_ASSERT_MSG(dst3.valid(), "Destination buffer 3 corrupted");
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        if (!float_equals_adaptive(dst1[i], dst3[i], 1e-4))
+                            UTEST_FAIL_MSG("In-place output of function '%s' differs at index %d, value=%f vs %f",
+                                label, int(i), dst1[i], dst3[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, fir_direct_x2_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        for (size_t mask=0; mask <= 0x07; ++mask)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 8, 15, 16, 17, 24, 32, 33, 47, 64, 65, 0x80, 0x1ff)
+            {
+                UTEST_FOREACH(length, 1, 2, 3, 4, 5, 8, 16, 17, 31, 32, 64, 0x80)
+                {
+                    printf("Testing %s length=%d on buffer count=%d mask=0x%x\n", label, int(length), int(count), int(mask));
+
+                    FloatBuffer src1(count + length - 1, align, mask & 0x01);
+                    FloatBuffer src2(count + length - 1, align, mask & 0x01);
+                    FloatBuffer taps(length, align, mask & 0x02);
+                    FloatBuffer dst1(count, align, mask & 0x04);
+                    FloatBuffer dst2(count, align, mask & 0x04);
+                    FloatBuffer dst3(dst1);
+                    FloatBuffer dst4(dst2);
+
+                    fir_direct(dst1, src1, taps, length, count);
+                    fir_direct(dst2, src2, taps, length, count);
+                    func(dst3, dst4, src1, src2, taps, length, count);
+
+                    UTEST_ASSERT_MSG(src1.valid(), "Source buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(src2.valid(), "Source buffer 2 corrupted");
+                    UTEST_ASSERT_MSG(taps.valid(), "Taps buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+                    UTEST_ASSERT_MSG(dst3.valid(), "Destination buffer 3 corrupted");
+                    UTEST_ASSERT_MSG(dst4.valid(), "Destination buffer 4 corrupted");
+
+                    if (!dst1.equals_adaptive(dst3, 1e-4))
+                    {
+                        dst1.dump("dst1");
+                        dst3.dump("dst3");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at index %d, value=%f vs %f",
+                            label, int(dst1.last_diff()), dst1.get(dst1.last_diff()), dst3.get(dst1.last_diff()));
+                    }
+                    if (!dst2.equals_adaptive(dst4, 1e-4))
+                    {
+                        dst2.dump("dst2");
+                        dst4.dump("dst4");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at index %d, value=%f vs %f",
+                            label, int(dst2.last_diff()), dst2.get(dst2.last_diff()), dst4.get(dst2.last_diff()));
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, align) \
+            call(#func, align, func)
+
+        CALL(generic::fir_direct, 16);
+        IF_ARCH_X86(CALL(sse::fir_direct, 16));
+        IF_ARCH_X86(CALL(avx::fir_direct, 32));
+        IF_ARCH_X86(CALL(avx::fir_direct_fma3, 32));
+        IF_ARCH_X86(CALL(avx512::fir_direct, 64));
+
+        CALL(generic::fir_direct_x2, 16);
+        IF_ARCH_X86(CALL(sse::fir_direct_x2, 16));
+        IF_ARCH_X86(CALL(avx::fir_direct_x2, 32));
+        IF_ARCH_X86(CALL(avx::fir_direct_x2_fma3, 32));
+        IF_ARCH_X86(CALL(avx512::fir_direct_x2, 64));
+    }
+
+UTEST_END;
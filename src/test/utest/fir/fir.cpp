@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-4
+#define MAX_CHANNELS    5
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t fir_size(size_t length, size_t channels);
+        void fir_init(dsp::fir_t *fir, void *buf, const float *taps, size_t length, size_t channels);
+        void fir_reset(dsp::fir_t *fir);
+        void fir_process(dsp::fir_t *fir, float * const *dst, const float * const *src, size_t count);
+    }
+}
+
+UTEST_BEGIN("dsp.fir", process)
+
+    void check(size_t length, size_t block, size_t channels)
+    {
+        size_t count    = length * 3 + 2500;
+
+        printf("Testing FIR filter length=%d, block=%d, channels=%d...\n",
+            int(length), int(block), int(channels));
+
+        FloatBuffer taps(length, 64, false);
+        FloatBuffer *src[MAX_CHANNELS], *dst[MAX_CHANNELS], *ref[MAX_CHANNELS];
+        taps.randomize_sign();
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            src[i]          = new FloatBuffer(count, 64, false);
+            dst[i]          = new FloatBuffer(count, 64, false);
+            ref[i]          = new FloatBuffer(count, 64, false);
+            src[i]->randomize_sign();
+
+            // Compute reference output
+            const float *x  = src[i]->data();
+            float *r        = ref[i]->data();
+            for (size_t k=0; k<count; ++k)
+            {
+                double s        = 0.0;
+                size_t n        = lsp_min(k + 1, length);
+                for (size_t j=0; j<n; ++j)
+                    s              += double(x[k - j]) * taps[j];
+                r[k]            = s;
+            }
+        }
+        uint8_t *buf    = new uint8_t[generic::fir_size(length, channels)];
+
+        dsp::fir_t fir;
+        generic::fir_init(&fir, buf, taps, length, channels);
+        UTEST_ASSERT_MSG(taps.valid(), "Taps buffer corrupted");
+
+        for (size_t i=0; i<count; i += block)
+        {
+            size_t to_do = lsp_min(block, count - i);
+            const float *s[MAX_CHANNELS];
+            float *d[MAX_CHANNELS];
+            for (size_t j=0; j<channels; ++j)
+            {
+                s[j]            = &src[j]->data()[i];
+                d[j]            = &dst[j]->data()[i];
+            }
+            generic::fir_process(&fir, d, s, to_do);
+        }
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            UTEST_ASSERT_MSG(src[i]->valid(), "Source buffer %d corrupted", int(i));
+            UTEST_ASSERT_MSG(dst[i]->valid(), "Destination buffer %d corrupted", int(i));
+            if (!dst[i]->equals_adaptive(*ref[i], TOLERANCE))
+            {
+                ssize_t diff = dst[i]->last_diff();
+                UTEST_FAIL_MSG("Output %d of FIR filter differs at sample %d (%.6f vs %.6f)",
+                    int(i), int(diff), dst[i]->get(diff), ref[i]->get(diff));
+            }
+        }
+
+        // Check that the reset clears the state and in-place processing
+        generic::fir_reset(&fir);
+        for (size_t i=0; i<count; i += block)
+        {
+            size_t to_do = lsp_min(block, count - i);
+            float *d[MAX_CHANNELS];
+            for (size_t j=0; j<channels; ++j)
+                d[j]            = &src[j]->data()[i];
+            generic::fir_process(&fir, d, d, to_do);
+        }
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            UTEST_ASSERT_MSG(src[i]->valid(), "Source buffer %d corrupted", int(i));
+            if (!src[i]->equals_adaptive(*ref[i], TOLERANCE))
+            {
+                ssize_t diff = src[i]->last_diff();
+                UTEST_FAIL_MSG("Output %d of in-place FIR filter differs at sample %d (%.6f vs %.6f)",
+                    int(i), int(diff), src[i]->get(diff), ref[i]->get(diff));
+            }
+        }
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            delete src[i];
+            delete dst[i];
+            delete ref[i];
+        }
+        delete [] buf;
+    }
+
+    UTEST_MAIN
+    {
+        UTEST_FOREACH(length, 1, 2, 7, 16, 33, 64, 128, 1500)
+        {
+            UTEST_FOREACH(block, 1, 13, 64, 1024, 3000)
+            {
+                for (size_t channels=1; channels <= MAX_CHANNELS; ++channels)
+                    check(length, block, channels);
+            }
+        }
+    }
+
+UTEST_END
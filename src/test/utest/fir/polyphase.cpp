@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+        void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+        }
+
+        namespace avx
+        {
+            void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_interpolate_fma3(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_decimate_fma3(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+        }
+    )
+
+    IF_ARCH_ARM(
+        namespace neon_d32
+        {
+            void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+            void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+        }
+    )
+
+    static void fir_interpolate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+            for (size_t p=0; p<factor; ++p)
+            {
+                double s = 0.0;
+                for (size_t j=0; j<length; ++j)
+                    s      += double(taps[p*length + j]) * double(src[i+j]);
+                dst[i*factor + p] = s;
+            }
+    }
+
+    static void fir_decimate(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            double s = 0.0;
+            for (size_t j=0; j<length; ++j)
+                s      += double(taps[j]) * double(src[i*factor + j]);
+            dst[i]  = s;
+        }
+    }
+
+    typedef void (* fir_resample_t)(float *dst, const float *src, const float *taps, size_t length, size_t factor, size_t count);
+}
+
+UTEST_BEGIN("dsp.fir", polyphase)
+
+    void call(const char *label, size_t align, fir_resample_t func, fir_resample_t ref, bool interpolate)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        for (size_t mask=0; mask <= 0x07; ++mask)
+        {
+            UTEST_FOREACH(factor, 2, 3, 4, 5, 6, 8)
+            {
+                UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 8, 15, 16, 17, 33, 64, 65, 0x80, 0x1ff)
+                {
+                    UTEST_FOREACH(length, 1, 2, 3, 4, 5, 8, 9, 16, 17, 31, 32, 64)
+                    {
+                        printf("Testing %s factor=%d length=%d on buffer count=%d mask=0x%x\n",
+                            label, int(factor), int(length), int(count), int(mask));
+
+                        size_t src_len  = (interpolate) ? count + length - 1 : count * factor + length;
+                        size_t dst_len  = (interpolate) ? count * factor : count;
+                        size_t taps_len = (interpolate) ? length * factor : length;
+
+                        FloatBuffer src(src_len, align, mask & 0x01);
+                        FloatBuffer taps(taps_len, align, mask & 0x02);
+                        FloatBuffer dst1(dst_len, align, mask & 0x04);
+                        FloatBuffer dst2(dst1);
+
+                        ref(dst1, src, taps, length, factor, count);
+                        func(dst2, src, taps, length, factor, count);
+
+                        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                        UTEST_ASSERT_MSG(taps.valid(), "Taps buffer corrupted");
+                        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                        if (!dst1.equals_adaptive(dst2, 1e-4))
+                        {
+                            src.dump("src ");
+                            taps.dump("taps");
+                            dst1.dump("dst1");
+                            dst2.dump("dst2");
+                            UTEST_FAIL_MSG("Output of functions for test '%s' differs at index %d, value=%f vs %f",
+                                label, int(dst1.last_diff()), dst1.get(dst1.last_diff()), dst2.get(dst1.last_diff()));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, align, interpolate) \
+            call(#func, align, func, (interpolate) ? fir_interpolate : fir_decimate, interpolate)
+
+        CALL(generic::fir_interpolate, 16, true);
+        IF_ARCH_X86(CALL(sse::fir_interpolate, 16, true));
+        IF_ARCH_X86(CALL(avx::fir_interpolate, 32, true));
+        IF_ARCH_X86(CALL(avx::fir_interpolate_fma3, 32, true));
+        IF_ARCH_ARM(CALL(neon_d32::fir_interpolate, 16, true));
+
+        CALL(generic::fir_decimate, 16, false);
+        IF_ARCH_X86(CALL(sse::fir_decimate, 16, false));
+        IF_ARCH_X86(CALL(avx::fir_decimate, 32, false));
+        IF_ARCH_X86(CALL(avx::fir_decimate_fma3, 32, false));
+        IF_ARCH_ARM(CALL(neon_d32::fir_decimate, 16, false));
+    }
+
+UTEST_END;
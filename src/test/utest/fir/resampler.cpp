@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-4
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t fir_interpolator_size(size_t length, size_t factor);
+        void fir_interpolator_init(dsp::fir_interpolator_t *intp, void *buf, const float *taps, size_t length, size_t factor);
+        void fir_interpolator_reset(dsp::fir_interpolator_t *intp);
+        void fir_interpolator_process(dsp::fir_interpolator_t *intp, float *dst, const float *src, size_t count);
+
+        size_t fir_decimator_size(size_t length, size_t factor);
+        void fir_decimator_init(dsp::fir_decimator_t *dec, void *buf, const float *taps, size_t length, size_t factor);
+        void fir_decimator_reset(dsp::fir_decimator_t *dec);
+        size_t fir_decimator_process(dsp::fir_decimator_t *dec, float *dst, const float *src, size_t count);
+    }
+}
+
+UTEST_BEGIN("dsp.fir", resampler)
+
+    void check_interpolator(size_t length, size_t factor, size_t block)
+    {
+        size_t count    = length + 2500;
+
+        printf("Testing FIR interpolator length=%d, factor=%d, block=%d...\n",
+            int(length), int(factor), int(block));
+
+        FloatBuffer taps(length, 64, false);
+        FloatBuffer src(count, 64, false);
+        FloatBuffer dst(count * factor, 64, false);
+        FloatBuffer ref(count * factor, 64, false);
+        taps.randomize_sign();
+        src.randomize_sign();
+
+        // Compute reference output: filter the zero-stuffed signal
+        for (size_t k=0; k<count*factor; ++k)
+        {
+            double s        = 0.0;
+            for (size_t j=0; (j<length) && (j <= k); ++j)
+            {
+                size_t m        = k - j;
+                if ((m % factor) == 0)
+                    s              += double(src[m / factor]) * taps[j];
+            }
+            ref[k]          = s;
+        }
+
+        uint8_t *buf    = new uint8_t[generic::fir_interpolator_size(length, factor)];
+        dsp::fir_interpolator_t intp;
+        generic::fir_interpolator_init(&intp, buf, taps, length, factor);
+        UTEST_ASSERT_MSG(taps.valid(), "Taps buffer corrupted");
+
+        for (size_t pass=0; pass<2; ++pass)
+        {
+            dst.fill_zero();
+            for (size_t i=0; i<count; i += block)
+            {
+                size_t to_do = lsp_min(block, count - i);
+                generic::fir_interpolator_process(&intp, &dst.data()[i * factor], &src.data()[i], to_do);
+            }
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+            if (!dst.equals_adaptive(ref, TOLERANCE))
+            {
+                ssize_t diff = dst.last_diff();
+                UTEST_FAIL_MSG("Output of FIR interpolator differs at sample %d (%.6f vs %.6f), pass %d",
+                    int(diff), dst.get(diff), ref.get(diff), int(pass));
+            }
+
+            // The second pass checks that the reset clears the state
+            generic::fir_interpolator_reset(&intp);
+        }
+
+        delete [] buf;
+    }
+
+    void check_decimator(size_t length, size_t factor, size_t block)
+    {
+        size_t count    = length + 2500;
+        size_t outputs  = (count + factor - 1) / factor;
+
+        printf("Testing FIR decimator length=%d, factor=%d, block=%d...\n",
+            int(length), int(factor), int(block));
+
+        FloatBuffer taps(length, 64, false);
+        FloatBuffer src(count, 64, false);
+        FloatBuffer dst(outputs, 64, false);
+        FloatBuffer ref(outputs, 64, false);
+        taps.randomize_sign();
+        src.randomize_sign();
+
+        // Compute reference output: filter the signal and keep each factor'th sample
+        for (size_t k=0; k<outputs; ++k)
+        {
+            double s        = 0.0;
+            size_t m        = k * factor;
+            for (size_t j=0; (j<length) && (j <= m); ++j)
+                s              += double(src[m - j]) * taps[j];
+            ref[k]          = s;
+        }
+
+        uint8_t *buf    = new uint8_t[generic::fir_decimator_size(length, factor)];
+        dsp::fir_decimator_t dec;
+        generic::fir_decimator_init(&dec, buf, taps, length, factor);
+        UTEST_ASSERT_MSG(taps.valid(), "Taps buffer corrupted");
+
+        for (size_t pass=0; pass<2; ++pass)
+        {
+            size_t produced = 0;
+            dst.fill_zero();
+            for (size_t i=0; i<count; i += block)
+            {
+                size_t to_do = lsp_min(block, count - i);
+                produced    += generic::fir_decimator_process(&dec, &dst.data()[produced], &src.data()[i], to_do);
+            }
+
+            UTEST_ASSERT_MSG(produced == outputs, "Number of output samples %d does not match expected %d",
+                int(produced), int(outputs));
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+            if (!dst.equals_adaptive(ref, TOLERANCE))
+            {
+                ssize_t diff = dst.last_diff();
+                UTEST_FAIL_MSG("Output of FIR decimator differs at sample %d (%.6f vs %.6f), pass %d",
+                    int(diff), dst.get(diff), ref.get(diff), int(pass));
+            }
+
+            // The second pass checks that the reset clears the state
+            generic::fir_decimator_reset(&dec);
+        }
+
+        delete [] buf;
+    }
+
+    UTEST_MAIN
+    {
+        UTEST_FOREACH(length, 1, 2, 7, 16, 33, 64, 255)
+        {
+            UTEST_FOREACH(factor, 2, 3, 4, 6, 8, 13)
+            {
+                UTEST_FOREACH(block, 1, 13, 64, 1024, 3000)
+                {
+                    check_interpolator(length, factor, block);
+                    check_decimator(length, factor, block);
+                }
+            }
+        }
+    }
+
+UTEST_END
@@ -52,6 +52,24 @@ namespace lsp
             void downsample_6x(float *dst, const float *src, size_t count);
             void downsample_8x(float *dst, const float *src, size_t count);
         }
+
+        namespace avx2
+        {
+            void downsample_2x(float *dst, const float *src, size_t count);
+            void downsample_3x(float *dst, const float *src, size_t count);
+            void downsample_4x(float *dst, const float *src, size_t count);
+            void downsample_6x(float *dst, const float *src, size_t count);
+            void downsample_8x(float *dst, const float *src, size_t count);
+        }
+
+        namespace avx512
+        {
+            void downsample_2x(float *dst, const float *src, size_t count);
+            void downsample_3x(float *dst, const float *src, size_t count);
+            void downsample_4x(float *dst, const float *src, size_t count);
+            void downsample_6x(float *dst, const float *src, size_t count);
+            void downsample_8x(float *dst, const float *src, size_t count);
+        }
     )
 
     IF_ARCH_ARM(
@@ -137,6 +155,18 @@ UTEST_BEGIN("dsp.resampling", downsampling)
         IF_ARCH_X86(CALL(generic::downsample_6x, avx::downsample_6x, 16, 6));
         IF_ARCH_X86(CALL(generic::downsample_8x, avx::downsample_8x, 16, 8));
 
+        IF_ARCH_X86(CALL(generic::downsample_2x, avx2::downsample_2x, 32, 2));
+        IF_ARCH_X86(CALL(generic::downsample_3x, avx2::downsample_3x, 32, 3));
+        IF_ARCH_X86(CALL(generic::downsample_4x, avx2::downsample_4x, 32, 4));
+        IF_ARCH_X86(CALL(generic::downsample_6x, avx2::downsample_6x, 32, 6));
+        IF_ARCH_X86(CALL(generic::downsample_8x, avx2::downsample_8x, 32, 8));
+
+        IF_ARCH_X86(CALL(generic::downsample_2x, avx512::downsample_2x, 64, 2));
+        IF_ARCH_X86(CALL(generic::downsample_3x, avx512::downsample_3x, 64, 3));
+        IF_ARCH_X86(CALL(generic::downsample_4x, avx512::downsample_4x, 64, 4));
+        IF_ARCH_X86(CALL(generic::downsample_6x, avx512::downsample_6x, 64, 6));
+        IF_ARCH_X86(CALL(generic::downsample_8x, avx512::downsample_8x, 64, 8));
+
         IF_ARCH_ARM(CALL(generic::downsample_2x, neon_d32::downsample_2x, 16, 2));
         IF_ARCH_ARM(CALL(generic::downsample_3x, neon_d32::downsample_3x, 16, 3));
         IF_ARCH_ARM(CALL(generic::downsample_4x, neon_d32::downsample_4x, 16, 4));
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t lanczos_kernel_size(size_t times, size_t lobes);
+        void lanczos_kernel_init(dsp::lanczos_kernel_t *kernel, void *buf, size_t times, size_t lobes);
+        void lanczos_resample(float *dst, const float *src, const dsp::lanczos_kernel_t *kernel, size_t count);
+
+        void lanczos_resample_2x2(float *dst, const float *src, size_t count);
+        void lanczos_resample_2x3(float *dst, const float *src, size_t count);
+        void lanczos_resample_2x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_3x2(float *dst, const float *src, size_t count);
+        void lanczos_resample_3x3(float *dst, const float *src, size_t count);
+        void lanczos_resample_3x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_4x2(float *dst, const float *src, size_t count);
+        void lanczos_resample_4x3(float *dst, const float *src, size_t count);
+        void lanczos_resample_4x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_6x2(float *dst, const float *src, size_t count);
+        void lanczos_resample_6x3(float *dst, const float *src, size_t count);
+        void lanczos_resample_6x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_8x2(float *dst, const float *src, size_t count);
+        void lanczos_resample_8x3(float *dst, const float *src, size_t count);
+        void lanczos_resample_8x4(float *dst, const float *src, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace avx2
+        {
+            void lanczos_resample_fma3(float *dst, const float *src, const dsp::lanczos_kernel_t *kernel, size_t count);
+        }
+
+        namespace avx512
+        {
+            void lanczos_resample(float *dst, const float *src, const dsp::lanczos_kernel_t *kernel, size_t count);
+        }
+    )
+
+    typedef void (* lanczos_resample_t)(float *dst, const float *src, const dsp::lanczos_kernel_t *kernel, size_t count);
+}
+
+UTEST_BEGIN("dsp.resampling", lanczos)
+
+    /**
+     * Check that the generated kernel gives the same result as the precomputed one
+     */
+    void check_generator(size_t times, size_t lobes, dsp::resampling_function_t func)
+    {
+        uint8_t *buf    = new uint8_t[generic::lanczos_kernel_size(times, lobes)];
+        dsp::lanczos_kernel_t k;
+        generic::lanczos_kernel_init(&k, buf, times, lobes);
+
+        UTEST_ASSERT(k.length == 2 * times * lobes);
+        UTEST_ASSERT((uintptr_t(k.data) & 0x3f) == 0);
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 7, 16, 33, 100)
+        {
+            printf("Testing generated %dx%d kernel for %d samples...\n", int(times), int(lobes), int(count));
+
+            FloatBuffer src(count, 16);
+            FloatBuffer dst1(count*times + LSP_DSP_RESAMPLING_RSV_SAMPLES, 16);
+            dst1.randomize_sign();
+            FloatBuffer dst2(dst1);
+
+            func(dst1, src, count);
+            generic::lanczos_resample(dst2, src, &k, count);
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            if (!dst1.equals_absolute(dst2))
+            {
+                src.dump("src");
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of generated %dx%d kernel differs", int(times), int(lobes));
+            }
+        }
+
+        delete [] buf;
+    }
+
+    void call(const char *text, size_t align, lanczos_resample_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        static const uint8_t params[][2] =
+        {
+            { 1, 1 }, { 1, 4 }, { 2, 2 }, { 5, 3 }, { 7, 5 }, { 12, 4 }, { 16, 4 }, { 16, 10 }, { 3, 62 }
+        };
+
+        for (size_t i=0; i<sizeof(params)/sizeof(params[0]); ++i)
+        {
+            const size_t times  = params[i][0];
+            const size_t lobes  = params[i][1];
+            uint8_t *buf        = new uint8_t[generic::lanczos_kernel_size(times, lobes)];
+            dsp::lanczos_kernel_t k;
+            generic::lanczos_kernel_init(&k, buf, times, lobes);
+
+            UTEST_FOREACH(count, 0, 1, 2, 3, 5, 8, 13, 16, 17, 31, 32, 63, 64, 100, 999)
+            {
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    printf("Testing %s %dx%d for %d samples, mask=0x%x...\n",
+                        text, int(times), int(lobes), int(count), int(mask));
+
+                    FloatBuffer src(count, align, mask & 0x01);
+                    FloatBuffer dst1(count*times + k.length, align, mask & 0x02);
+                    dst1.randomize_sign();
+                    FloatBuffer dst2(dst1);
+
+                    generic::lanczos_resample(dst1, src, &k, count);
+                    func(dst2, src, &k, count);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    if (!dst1.equals_absolute(dst2))
+                    {
+                        src.dump("src");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' %dx%d differs", text, int(times), int(lobes));
+                    }
+                }
+            }
+
+            delete [] buf;
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_generator(2, 2, generic::lanczos_resample_2x2);
+        check_generator(2, 3, generic::lanczos_resample_2x3);
+        check_generator(2, 4, generic::lanczos_resample_2x4);
+        check_generator(3, 2, generic::lanczos_resample_3x2);
+        check_generator(3, 3, generic::lanczos_resample_3x3);
+        check_generator(3, 4, generic::lanczos_resample_3x4);
+        check_generator(4, 2, generic::lanczos_resample_4x2);
+        check_generator(4, 3, generic::lanczos_resample_4x3);
+        check_generator(4, 4, generic::lanczos_resample_4x4);
+        check_generator(6, 2, generic::lanczos_resample_6x2);
+        check_generator(6, 3, generic::lanczos_resample_6x3);
+        check_generator(6, 4, generic::lanczos_resample_6x4);
+        check_generator(8, 2, generic::lanczos_resample_8x2);
+        check_generator(8, 3, generic::lanczos_resample_8x3);
+        check_generator(8, 4, generic::lanczos_resample_8x4);
+
+        #define CALL(func, align) \
+            call(#func, align, func)
+
+        IF_ARCH_X86(CALL(avx2::lanczos_resample_fma3, 32));
+        IF_ARCH_X86(CALL(avx512::lanczos_resample, 64));
+    }
+UTEST_END;
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define SRC_COUNT       4000
+#define SINE_FREQ       0.07    /* Frequency of the test tone, in cycles per input sample */
+#define TOLERANCE       1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t oversampler_size(size_t factor, size_t zcross);
+        void oversampler_init(dsp::oversampler_t *os, void *buf, size_t factor, size_t zcross);
+        void oversampler_reset(dsp::oversampler_t *os);
+        void oversampler_process(dsp::oversampler_t *os, float *dst, const float *src, size_t count,
+            dsp::oversampler_callback_t callback, void *arg);
+    }
+}
+
+UTEST_BEGIN("dsp.resampling", oversampler)
+
+    typedef struct cb_state_t
+    {
+        size_t      factor;
+        size_t      total;
+        bool        valid;
+    } cb_state_t;
+
+    static void halve(void *arg, float *buf, size_t count)
+    {
+        cb_state_t *st  = static_cast<cb_state_t *>(arg);
+        if ((count == 0) || ((count % st->factor) != 0))
+            st->valid       = false;
+        st->total      += count;
+
+        for (size_t i=0; i<count; ++i)
+            buf[i]         *= 0.5f;
+    }
+
+    void process(dsp::oversampler_t *os, float *dst, const float *src, size_t block, cb_state_t *st)
+    {
+        for (size_t i=0, n=0; i<SRC_COUNT; i += n, ++n)
+        {
+            n               = lsp_min(SRC_COUNT - i, (block > 0) ? block : n % 333 + 1);
+            if (st != NULL)
+                generic::oversampler_process(os, &dst[i], &src[i], n, halve, st);
+            else
+                generic::oversampler_process(os, &dst[i], &src[i], n, NULL, NULL);
+        }
+    }
+
+    void check_tone(const float *in, size_t factor, size_t zcross)
+    {
+        printf("Testing oversampler factor=%d, zcross=%d...\n", int(factor), int(zcross));
+
+        FloatBuffer out1(SRC_COUNT, 64, false);
+        FloatBuffer out2(SRC_COUNT, 64, false);
+        uint8_t *buf    = new uint8_t[generic::oversampler_size(factor, zcross)];
+        dsp::oversampler_t os;
+        generic::oversampler_init(&os, buf, factor, zcross);
+        UTEST_ASSERT(os.latency == zcross * 2);
+
+        // Without the callback the oversampler should give the delayed input signal
+        process(&os, out1.data(), in, SRC_COUNT, NULL);
+        UTEST_ASSERT_MSG(out1.valid(), "Output buffer 1 corrupted");
+        for (size_t i=os.latency * 2; i<SRC_COUNT; ++i)
+        {
+            float ref       = in[i - os.latency];
+            if (fabs(out1[i] - ref) > TOLERANCE)
+                UTEST_FAIL_MSG("Output sample #%d differs: %f vs %f (reference)", int(i), out1[i], ref);
+        }
+
+        // Process the same signal by blocks of random size with the callback after reset
+        cb_state_t st;
+        st.factor       = factor;
+        st.total        = 0;
+        st.valid        = true;
+
+        generic::oversampler_reset(&os);
+        process(&os, out2.data(), in, 0, &st);
+        UTEST_ASSERT_MSG(out2.valid(), "Output buffer 2 corrupted");
+        UTEST_ASSERT_MSG(st.valid, "Callback received invalid number of samples");
+        UTEST_ASSERT_MSG(st.total == SRC_COUNT * factor, "Callback received %d samples instead of %d",
+            int(st.total), int(SRC_COUNT * factor));
+
+        for (size_t i=0; i<SRC_COUNT; ++i)
+        {
+            if (fabs(out2[i] - out1[i] * 0.5f) > 1e-5)
+                UTEST_FAIL_MSG("Output sample #%d differs: %f vs %f (reference)", int(i), out2[i], out1[i] * 0.5f);
+        }
+
+        delete [] buf;
+    }
+
+    void check_alias(size_t factor, size_t zcross)
+    {
+        printf("Testing oversampler alias rejection factor=%d, zcross=%d...\n", int(factor), int(zcross));
+
+        // The tone above the Nyquist frequency of the input signal generated
+        // at the oversampled rate should be rejected by the anti-aliasing filter
+        class generator
+        {
+            public:
+                double  freq;
+                size_t  phase;
+
+                static void process(void *arg, float *buf, size_t count)
+                {
+                    generator *self = static_cast<generator *>(arg);
+                    for (size_t i=0; i<count; ++i, ++self->phase)
+                        buf[i]          = sin(2.0 * M_PI * self->freq * self->phase);
+                }
+        } gen;
+        gen.freq        = 0.7 / double(factor);
+        gen.phase       = 0;
+
+        FloatBuffer in(SRC_COUNT, 64, true);
+        FloatBuffer out(SRC_COUNT, 64, false);
+        uint8_t *buf    = new uint8_t[generic::oversampler_size(factor, zcross)];
+        dsp::oversampler_t os;
+        generic::oversampler_init(&os, buf, factor, zcross);
+
+        generic::oversampler_process(&os, out.data(), in.data(), SRC_COUNT, generator::process, &gen);
+        UTEST_ASSERT_MSG(out.valid(), "Output buffer corrupted");
+
+        for (size_t i=os.latency * 2; i<SRC_COUNT; ++i)
+        {
+            if (fabs(out[i]) > 1e-3)
+                UTEST_FAIL_MSG("Aliased output sample #%d is too loud: %f", int(i), out[i]);
+        }
+
+        delete [] buf;
+    }
+
+    UTEST_MAIN
+    {
+        FloatBuffer in(SRC_COUNT, 64, false);
+        for (size_t i=0; i<SRC_COUNT; ++i)
+            in[i]       = sin(2.0 * M_PI * SINE_FREQ * i);
+
+        static const size_t factors[] = { 1, 2, 3, 4, 6, 8 };
+        static const size_t zcross[] = { 8, 16, 32 };
+
+        for (size_t i=0; i<sizeof(factors)/sizeof(size_t); ++i)
+            for (size_t j=0; j<sizeof(zcross)/sizeof(size_t); ++j)
+            {
+                check_tone(in, factors[i], zcross[j]);
+                if (factors[i] > 1)
+                    check_alias(factors[i], zcross[j]);
+            }
+    }
+
+UTEST_END
@@ -32,18 +32,28 @@ namespace lsp
         void lanczos_resample_2x2(float *dst, const float *src, size_t count);
         void lanczos_resample_2x3(float *dst, const float *src, size_t count);
         void lanczos_resample_2x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_2x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_2x24bit(float *dst, const float *src, size_t count);
         void lanczos_resample_3x2(float *dst, const float *src, size_t count);
         void lanczos_resample_3x3(float *dst, const float *src, size_t count);
         void lanczos_resample_3x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_3x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_3x24bit(float *dst, const float *src, size_t count);
         void lanczos_resample_4x2(float *dst, const float *src, size_t count);
         void lanczos_resample_4x3(float *dst, const float *src, size_t count);
         void lanczos_resample_4x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_4x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_4x24bit(float *dst, const float *src, size_t count);
         void lanczos_resample_6x2(float *dst, const float *src, size_t count);
         void lanczos_resample_6x3(float *dst, const float *src, size_t count);
         void lanczos_resample_6x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_6x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_6x24bit(float *dst, const float *src, size_t count);
         void lanczos_resample_8x2(float *dst, const float *src, size_t count);
         void lanczos_resample_8x3(float *dst, const float *src, size_t count);
         void lanczos_resample_8x4(float *dst, const float *src, size_t count);
+        void lanczos_resample_8x16bit(float *dst, const float *src, size_t count);
+        void lanczos_resample_8x24bit(float *dst, const float *src, size_t count);
     }
 
     IF_ARCH_X86(
@@ -84,6 +94,64 @@ namespace lsp
             void lanczos_resample_8x3(float *dst, const float *src, size_t count);
             void lanczos_resample_8x4(float *dst, const float *src, size_t count);
         }
+
+        namespace avx2
+        {
+            void lanczos_resample_2x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x24bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x24bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x24bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x24bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x2_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x3_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x4_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x16bit_fma3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x24bit_fma3(float *dst, const float *src, size_t count);
+        }
+
+        namespace avx512
+        {
+            void lanczos_resample_2x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_2x24bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_3x24bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_4x24bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_6x24bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x2(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x3(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x4(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x16bit(float *dst, const float *src, size_t count);
+            void lanczos_resample_8x24bit(float *dst, const float *src, size_t count);
+        }
     )
 
     IF_ARCH_ARM(
@@ -175,10 +243,49 @@ UTEST_BEGIN("dsp.resampling", oversampling)
         }
     }
 
+    /**
+     * The output-driven kernels are shared with lanczos_resample() which requires only
+     * count*times + length samples in the destination buffer, so they should not touch
+     * the buffer after the convolution tail. Adding zeros of the kernel padding to -0.0
+     * gives +0.0, this allows to detect any store after the tail.
+     */
+    void check_tail(size_t times, size_t lobes, const char *text, size_t align, dsp::resampling_function_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 31, 32, 33, 100, 999)
+        {
+            printf("Testing %s convolution tail for %d -> %d samples...\n", text, int(count), int(count * times));
+
+            const size_t end = (count - 1) * times + 2 * times * lobes;
+            FloatBuffer src(count, align, false);
+            FloatBuffer dst(count*times + LSP_DSP_RESAMPLING_RSV_SAMPLES, align, false);
+            src.randomize_0to1();
+            dst.fill(-0.0f);
+
+            func(dst, src, count);
+
+            if (src.corrupted())
+                UTEST_FAIL_MSG("Source buffer corrupted");
+            if (dst.corrupted())
+                UTEST_FAIL_MSG("Destination buffer corrupted");
+
+            for (size_t i=end; i<dst.size(); ++i)
+            {
+                if (!signbit(dst[i]))
+                    UTEST_FAIL_MSG("Function '%s' modified sample %d after the convolution tail of %d samples",
+                        text, int(i), int(end));
+            }
+        }
+    }
+
     UTEST_MAIN
     {
         #define CALL(generic, func, align, order) \
             call(order, #func, align, generic, func)
+        #define TAIL(func, align, order, lobes) \
+            check_tail(order, lobes, #func, align, func)
 
         // Do tests
         IF_ARCH_X86(CALL(generic::lanczos_resample_2x2, sse::lanczos_resample_2x2, 16, 2));
@@ -213,6 +320,58 @@ UTEST_BEGIN("dsp.resampling", oversampling)
         IF_ARCH_X86(CALL(generic::lanczos_resample_8x3, avx::lanczos_resample_8x3, 32, 8));
         IF_ARCH_X86(CALL(generic::lanczos_resample_8x4, avx::lanczos_resample_8x4, 32, 8));
 
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x2, avx2::lanczos_resample_2x2_fma3, 32, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x3, avx2::lanczos_resample_2x3_fma3, 32, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x4, avx2::lanczos_resample_2x4_fma3, 32, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x16bit, avx2::lanczos_resample_2x16bit_fma3, 32, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x24bit, avx2::lanczos_resample_2x24bit_fma3, 32, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x2, avx2::lanczos_resample_3x2_fma3, 32, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x3, avx2::lanczos_resample_3x3_fma3, 32, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x4, avx2::lanczos_resample_3x4_fma3, 32, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x16bit, avx2::lanczos_resample_3x16bit_fma3, 32, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x24bit, avx2::lanczos_resample_3x24bit_fma3, 32, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x2, avx2::lanczos_resample_4x2_fma3, 32, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x3, avx2::lanczos_resample_4x3_fma3, 32, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x4, avx2::lanczos_resample_4x4_fma3, 32, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x16bit, avx2::lanczos_resample_4x16bit_fma3, 32, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x24bit, avx2::lanczos_resample_4x24bit_fma3, 32, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x2, avx2::lanczos_resample_6x2_fma3, 32, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x3, avx2::lanczos_resample_6x3_fma3, 32, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x4, avx2::lanczos_resample_6x4_fma3, 32, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x16bit, avx2::lanczos_resample_6x16bit_fma3, 32, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x24bit, avx2::lanczos_resample_6x24bit_fma3, 32, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x2, avx2::lanczos_resample_8x2_fma3, 32, 8));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x3, avx2::lanczos_resample_8x3_fma3, 32, 8));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x4, avx2::lanczos_resample_8x4_fma3, 32, 8));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x16bit, avx2::lanczos_resample_8x16bit_fma3, 32, 8));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x24bit, avx2::lanczos_resample_8x24bit_fma3, 32, 8));
+
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x2, avx512::lanczos_resample_2x2, 64, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x3, avx512::lanczos_resample_2x3, 64, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x4, avx512::lanczos_resample_2x4, 64, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x16bit, avx512::lanczos_resample_2x16bit, 64, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_2x24bit, avx512::lanczos_resample_2x24bit, 64, 2));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x2, avx512::lanczos_resample_3x2, 64, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x3, avx512::lanczos_resample_3x3, 64, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x4, avx512::lanczos_resample_3x4, 64, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x16bit, avx512::lanczos_resample_3x16bit, 64, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_3x24bit, avx512::lanczos_resample_3x24bit, 64, 3));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x2, avx512::lanczos_resample_4x2, 64, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x3, avx512::lanczos_resample_4x3, 64, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x4, avx512::lanczos_resample_4x4, 64, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x16bit, avx512::lanczos_resample_4x16bit, 64, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_4x24bit, avx512::lanczos_resample_4x24bit, 64, 4));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x2, avx512::lanczos_resample_6x2, 64, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x3, avx512::lanczos_resample_6x3, 64, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x4, avx512::lanczos_resample_6x4, 64, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x16bit, avx512::lanczos_resample_6x16bit, 64, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_6x24bit, avx512::lanczos_resample_6x24bit, 64, 6));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x2, avx512::lanczos_resample_8x2, 64, 8));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x3, avx512::lanczos_resample_8x3, 64, 8));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x4, avx512::lanczos_resample_8x4, 64, 8));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x16bit, avx512::lanczos_resample_8x16bit, 64, 8));
+        IF_ARCH_X86(CALL(generic::lanczos_resample_8x24bit, avx512::lanczos_resample_8x24bit, 64, 8));
+
         IF_ARCH_ARM(CALL(generic::lanczos_resample_2x2, neon_d32::lanczos_resample_2x2, 16, 2));
         IF_ARCH_ARM(CALL(generic::lanczos_resample_2x3, neon_d32::lanczos_resample_2x3, 16, 2));
         IF_ARCH_ARM(CALL(generic::lanczos_resample_2x4, neon_d32::lanczos_resample_2x4, 16, 2));
@@ -244,5 +403,57 @@ UTEST_BEGIN("dsp.resampling", oversampling)
         IF_ARCH_AARCH64(CALL(generic::lanczos_resample_8x2, asimd::lanczos_resample_8x2, 16, 8));
         IF_ARCH_AARCH64(CALL(generic::lanczos_resample_8x3, asimd::lanczos_resample_8x3, 16, 8));
         IF_ARCH_AARCH64(CALL(generic::lanczos_resample_8x4, asimd::lanczos_resample_8x4, 16, 8));
+
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_2x2_fma3, 32, 2, 2));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_2x3_fma3, 32, 2, 3));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_2x4_fma3, 32, 2, 4));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_2x16bit_fma3, 32, 2, 10));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_2x24bit_fma3, 32, 2, 62));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_3x2_fma3, 32, 3, 2));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_3x3_fma3, 32, 3, 3));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_3x4_fma3, 32, 3, 4));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_3x16bit_fma3, 32, 3, 10));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_3x24bit_fma3, 32, 3, 62));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_4x2_fma3, 32, 4, 2));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_4x3_fma3, 32, 4, 3));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_4x4_fma3, 32, 4, 4));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_4x16bit_fma3, 32, 4, 10));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_4x24bit_fma3, 32, 4, 62));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_6x2_fma3, 32, 6, 2));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_6x3_fma3, 32, 6, 3));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_6x4_fma3, 32, 6, 4));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_6x16bit_fma3, 32, 6, 10));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_6x24bit_fma3, 32, 6, 62));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_8x2_fma3, 32, 8, 2));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_8x3_fma3, 32, 8, 3));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_8x4_fma3, 32, 8, 4));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_8x16bit_fma3, 32, 8, 10));
+        IF_ARCH_X86(TAIL(avx2::lanczos_resample_8x24bit_fma3, 32, 8, 62));
+
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_2x2, 64, 2, 2));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_2x3, 64, 2, 3));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_2x4, 64, 2, 4));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_2x16bit, 64, 2, 10));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_2x24bit, 64, 2, 62));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_3x2, 64, 3, 2));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_3x3, 64, 3, 3));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_3x4, 64, 3, 4));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_3x16bit, 64, 3, 10));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_3x24bit, 64, 3, 62));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_4x2, 64, 4, 2));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_4x3, 64, 4, 3));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_4x4, 64, 4, 4));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_4x16bit, 64, 4, 10));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_4x24bit, 64, 4, 62));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_6x2, 64, 6, 2));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_6x3, 64, 6, 3));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_6x4, 64, 6, 4));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_6x16bit, 64, 6, 10));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_6x24bit, 64, 6, 62));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_8x2, 64, 8, 2));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_8x3, 64, 8, 3));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_8x4, 64, 8, 4));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_8x16bit, 64, 8, 10));
+        IF_ARCH_X86(TAIL(avx512::lanczos_resample_8x24bit, 64, 8, 62));
     }
 UTEST_END;
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define SRC_COUNT       8000
+#define SINE_FREQ       0.05    /* Frequency of the test tone, in cycles per input sample */
+#define TOLERANCE       2e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t resampler_size(double ratio, size_t zcross);
+        void resampler_init(dsp::resampler_t *rs, void *buf, double ratio, size_t zcross);
+        void resampler_set_ratio(dsp::resampler_t *rs, double ratio);
+        void resampler_reset(dsp::resampler_t *rs);
+        size_t resampler_process(dsp::resampler_t *rs, float *dst, const float *src, size_t count);
+    }
+}
+
+UTEST_BEGIN("dsp.resampling", resampler)
+
+    /**
+     * Process the tone by blocks of pseudo-random size, change the ratio between the blocks
+     * if the ratio drift is set and compare the result with the tone evaluated at the expected
+     * positions of output samples
+     */
+    size_t check_tone(float *out, const float *in, double ratio, double drift, size_t zcross, size_t block)
+    {
+        printf("Testing resampler ratio=%.4f, drift=%.4f, zcross=%d, block=%d...\n",
+            ratio, drift, int(zcross), int(block));
+
+        uint8_t *buf    = new uint8_t[generic::resampler_size(ratio, zcross)];
+        dsp::resampler_t rs;
+        generic::resampler_init(&rs, buf, ratio, zcross);
+
+        const size_t skip   = rs.taps * (ratio + 1.0);  // Skip the transient at the beginning
+        double pos          = 0.0;
+        double r            = ratio;
+        size_t done         = 0;
+
+        for (size_t i=0, n=0; i<SRC_COUNT; i += n, ++n)
+        {
+            n                   = lsp_min(SRC_COUNT - i, (block > 0) ? block : n % 97 + 1);
+            size_t res          = generic::resampler_process(&rs, &out[done], &in[i], n);
+            UTEST_ASSERT_MSG(res <= n * r + 2, "Too many samples produced: %d for %d input samples", int(res), int(n));
+
+            for (size_t j=0; j<res; ++j, ++done, pos += 1.0 / r)
+            {
+                if (done < skip)
+                    continue;
+                float ref           = sin(2.0 * M_PI * SINE_FREQ * pos);
+                if (fabs(out[done] - ref) > TOLERANCE)
+                    UTEST_FAIL_MSG("Output sample #%d differs: %f vs %f (reference)", int(done), out[done], ref);
+            }
+
+            // Follow the clock drift
+            if (drift > 0.0)
+            {
+                r                   = ratio * (1.0 + drift * sin(2.0 * M_PI * double(i) / SRC_COUNT));
+                generic::resampler_set_ratio(&rs, r);
+            }
+        }
+
+        // The output should lag by no more than the half of the kernel
+        if (drift <= 0.0)
+        {
+            double expected     = SRC_COUNT * ratio;
+            UTEST_ASSERT_MSG(fabs(done - expected) <= rs.taps * ratio * 0.5 + 2,
+                "Unexpected number of output samples: %d, expected about %d", int(done), int(expected));
+        }
+
+        delete [] buf;
+        return done;
+    }
+
+    void check_blocks(const float *in, double ratio, size_t zcross)
+    {
+        FloatBuffer out1(SRC_COUNT * 4, 64, false);
+        FloatBuffer out2(SRC_COUNT * 4, 64, false);
+
+        size_t n1 = check_tone(out1.data(), in, ratio, 0.0, zcross, SRC_COUNT);
+        size_t n2 = check_tone(out2.data(), in, ratio, 0.0, zcross, 0);
+        UTEST_ASSERT_MSG(out1.valid(), "Output buffer 1 corrupted");
+        UTEST_ASSERT_MSG(out2.valid(), "Output buffer 2 corrupted");
+        UTEST_ASSERT_MSG(n1 == n2, "Number of output samples depends on block size: %d vs %d", int(n1), int(n2));
+
+        // The result should not depend on the block size
+        for (size_t i=0; i<n1; ++i)
+        {
+            if (fabs(out1[i] - out2[i]) > 1e-5)
+                UTEST_FAIL_MSG("Sample #%d depends on block size: %f vs %f", int(i), out1[i], out2[i]);
+        }
+    }
+
+    void check_reset(const float *in)
+    {
+        printf("Testing resampler reset...\n");
+
+        FloatBuffer out1(SRC_COUNT * 2, 64, false);
+        FloatBuffer out2(SRC_COUNT * 2, 64, false);
+        uint8_t *buf    = new uint8_t[generic::resampler_size(1.5, 16)];
+        dsp::resampler_t rs;
+        generic::resampler_init(&rs, buf, 1.5, 16);
+
+        size_t n1   = generic::resampler_process(&rs, out1.data(), in, SRC_COUNT);
+        generic::resampler_reset(&rs);
+        size_t n2   = generic::resampler_process(&rs, out2.data(), in, SRC_COUNT);
+
+        UTEST_ASSERT_MSG(out1.valid(), "Output buffer 1 corrupted");
+        UTEST_ASSERT_MSG(out2.valid(), "Output buffer 2 corrupted");
+        UTEST_ASSERT(n1 == n2);
+        for (size_t i=0; i<n1; ++i)
+        {
+            if (out1[i] != out2[i])
+                UTEST_FAIL_MSG("Sample #%d differs after reset: %f vs %f", int(i), out1[i], out2[i]);
+        }
+
+        delete [] buf;
+    }
+
+    UTEST_MAIN
+    {
+        FloatBuffer in(SRC_COUNT, 64, false);
+        FloatBuffer out(SRC_COUNT * 4, 64, false);
+        for (size_t i=0; i<SRC_COUNT; ++i)
+            in[i]       = sin(2.0 * M_PI * SINE_FREQ * i);
+
+        static const double ratios[] = { 1.0, 48000.0 / 44100.0, 44100.0 / 48000.0, 2.0, 0.5, 3.17, 0.37 };
+        static const size_t zcross[] = { 8, 16, 32 };
+
+        for (size_t i=0; i<sizeof(ratios)/sizeof(double); ++i)
+            for (size_t j=0; j<sizeof(zcross)/sizeof(size_t); ++j)
+                check_blocks(in, ratios[i], zcross[j]);
+
+        // Time-varying ratio
+        check_tone(out.data(), in, 1.0, 0.01, 16, 0);
+        check_tone(out.data(), in, 48000.0 / 44100.0, 0.05, 16, 64);
+
+        check_reset(in);
+    }
+
+UTEST_END
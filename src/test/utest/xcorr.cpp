@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#define TOLERANCE       1e-4
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t xcorr_size(size_t a_count, size_t b_count, ssize_t min_lag, ssize_t max_lag);
+        float xcorr(float *dst, const float *a, size_t a_count, const float *b, size_t b_count,
+            ssize_t min_lag, ssize_t max_lag, void *buf);
+        size_t autocorr_size(size_t count, size_t max_lag);
+        float autocorr(float *dst, const float *src, size_t count, size_t min_lag, size_t max_lag, void *buf);
+    }
+
+    static void xcorr(float *dst, const float *a, size_t a_count, const float *b, size_t b_count,
+        ssize_t min_lag, ssize_t max_lag)
+    {
+        double ea = 0.0, eb = 0.0;
+        for (size_t i=0; i<a_count; ++i)
+            ea         += double(a[i]) * a[i];
+        for (size_t i=0; i<b_count; ++i)
+            eb         += double(b[i]) * b[i];
+        double norm = sqrt(ea * eb);
+
+        for (ssize_t k=min_lag; k<=max_lag; ++k)
+        {
+            double s    = 0.0;
+            for (ssize_t i=0; i<ssize_t(b_count); ++i)
+            {
+                if ((i + k >= 0) && (i + k < ssize_t(a_count)))
+                    s          += double(a[i + k]) * b[i];
+            }
+            *(dst++)    = (norm > 0.0) ? s / norm : 0.0;
+        }
+    }
+}
+
+UTEST_BEGIN("dsp", xcorr)
+
+    void check_xcorr(size_t a_count, size_t b_count, ssize_t min_lag, ssize_t max_lag)
+    {
+        printf("Testing xcorr a_count=%d, b_count=%d, lags=[%d, %d]\n",
+            int(a_count), int(b_count), int(min_lag), int(max_lag));
+
+        size_t count = max_lag - min_lag + 1;
+        FloatBuffer a(a_count, 64, false);
+        FloatBuffer b(b_count, 64, false);
+        FloatBuffer dst1(count, 64, false);
+        FloatBuffer dst2(count, 64, false);
+        a.randomize_sign();
+        b.randomize_sign();
+        uint8_t *buf = new uint8_t[generic::xcorr_size(a_count, b_count, min_lag, max_lag)];
+
+        xcorr(dst1, a, a_count, b, b_count, min_lag, max_lag);
+        generic::xcorr(dst2, a, a_count, b, b_count, min_lag, max_lag, buf);
+        delete [] buf;
+
+        UTEST_ASSERT_MSG(a.valid(), "Buffer A corrupted");
+        UTEST_ASSERT_MSG(b.valid(), "Buffer B corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer corrupted");
+        if (!dst1.equals_absolute(dst2, TOLERANCE))
+        {
+            ssize_t diff = dst2.last_diff();
+            UTEST_FAIL_MSG("Output of xcorr differs at lag %d (%.6f vs %.6f)",
+                int(diff + min_lag), dst1.get(diff), dst2.get(diff));
+        }
+    }
+
+    void check_autocorr(size_t count, size_t min_lag, size_t max_lag)
+    {
+        printf("Testing autocorr count=%d, lags=[%d, %d]\n",
+            int(count), int(min_lag), int(max_lag));
+
+        size_t lags = max_lag - min_lag + 1;
+        FloatBuffer src(count, 64, false);
+        FloatBuffer dst1(lags, 64, false);
+        FloatBuffer dst2(lags, 64, false);
+        src.randomize_sign();
+        uint8_t *buf = new uint8_t[generic::autocorr_size(count, max_lag)];
+
+        xcorr(dst1, src, count, src, count, min_lag, max_lag);
+        generic::autocorr(dst2, src, count, min_lag, max_lag, buf);
+        delete [] buf;
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer corrupted");
+        if (!dst1.equals_absolute(dst2, TOLERANCE))
+        {
+            ssize_t diff = dst2.last_diff();
+            UTEST_FAIL_MSG("Output of autocorr differs at lag %d (%.6f vs %.6f)",
+                int(diff + min_lag), dst1.get(diff), dst2.get(diff));
+        }
+    }
+
+    void check_peak(float delay)
+    {
+        printf("Testing peak detection for delay=%.3f\n", delay);
+
+        // Gaussian pulses, the first one is delayed
+        size_t count = 512;
+        FloatBuffer a(count, 64, false);
+        FloatBuffer b(count, 64, false);
+        FloatBuffer dst(201, 64, false);
+        for (size_t i=0; i<count; ++i)
+        {
+            float x     = (float(i) - 200.0f - delay) / 20.0f;
+            float y     = (float(i) - 200.0f) / 20.0f;
+            a[i]        = expf(-x*x);
+            b[i]        = expf(-y*y);
+        }
+
+        uint8_t *buf = new uint8_t[generic::xcorr_size(count, count, -100, 100)];
+        float lag = generic::xcorr(dst, a, count, b, count, -100, 100, buf);
+        delete [] buf;
+
+        UTEST_ASSERT_MSG(fabsf(lag - delay) < 0.05f, "Estimated lag %.4f, expected %.4f", lag, delay);
+        UTEST_ASSERT_MSG(fabsf(dst[100 + ssize_t(roundf(delay))] - 1.0f) < 0.01f, "Peak value is %.4f",
+            dst[100 + ssize_t(roundf(delay))]);
+
+        // The autocorrelation of the periodic signal has peaks at multiples of the period
+        for (size_t i=0; i<count; ++i)
+            a[i]        = sinf(2.0f * M_PI * i / (40.0f + delay));
+        buf = new uint8_t[generic::autocorr_size(count, 70)];
+        lag = generic::autocorr(dst, a, count, 20, 70, buf);
+        delete [] buf;
+
+        UTEST_ASSERT_MSG(fabsf(lag - 40.0f - delay) < 0.2f, "Estimated period %.4f, expected %.4f", lag, 40.0f + delay);
+    }
+
+    UTEST_MAIN
+    {
+        check_xcorr(1, 1, 0, 0);
+        check_xcorr(1, 1, -5, 5);
+        check_xcorr(100, 50, -49, 99);
+        check_xcorr(100, 50, -200, 200);
+        check_xcorr(100, 50, 10, 20);
+        check_xcorr(100, 50, -20, -10);
+        check_xcorr(100, 50, 150, 160);
+        check_xcorr(100, 50, -70, -60);
+        check_xcorr(50, 100, -5, 5);
+        check_xcorr(1000, 1000, -30, 30);
+        check_xcorr(4096, 777, -1000, 0);
+        check_xcorr(4096, 4096, 0, 4095);
+
+        check_autocorr(1, 0, 0);
+        check_autocorr(100, 0, 10);
+        check_autocorr(100, 0, 200);
+        check_autocorr(100, 150, 200);
+        check_autocorr(1000, 20, 999);
+        check_autocorr(4096, 0, 1024);
+
+        check_peak(0.0f);
+        check_peak(0.3f);
+        check_peak(-7.6f);
+        check_peak(12.5f);
+    }
+
+UTEST_END